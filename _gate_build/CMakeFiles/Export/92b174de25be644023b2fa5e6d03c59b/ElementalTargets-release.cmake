@@ -0,0 +1,42 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "pmrrr" for configuration "Release"
+set_property(TARGET pmrrr APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(pmrrr PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELEASE "/usr/lib/x86_64-linux-gnu/openmpi/lib/libmpi.so;/usr/lib/x86_64-linux-gnu/libopenblas.so;/usr/lib/gcc/x86_64-linux-gnu/12/libgfortran.so;/usr/lib/x86_64-linux-gnu/libm.so"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libpmrrr.so.88-dev"
+  IMPORTED_SONAME_RELEASE "libpmrrr.so.0"
+  )
+
+list(APPEND _cmake_import_check_targets pmrrr )
+list(APPEND _cmake_import_check_files_for_pmrrr "${_IMPORT_PREFIX}/lib/libpmrrr.so.88-dev" )
+
+# Import target "ElSuiteSparse" for configuration "Release"
+set_property(TARGET ElSuiteSparse APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(ElSuiteSparse PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELEASE "m"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libElSuiteSparse.so"
+  IMPORTED_SONAME_RELEASE "libElSuiteSparse.so"
+  )
+
+list(APPEND _cmake_import_check_targets ElSuiteSparse )
+list(APPEND _cmake_import_check_files_for_ElSuiteSparse "${_IMPORT_PREFIX}/lib/libElSuiteSparse.so" )
+
+# Import target "El" for configuration "Release"
+set_property(TARGET El APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(El PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELEASE "pmrrr;ElSuiteSparse;/usr/local/lib/libmetis.so;/usr/lib/x86_64-linux-gnu/libopenblas.so;/usr/lib/gcc/x86_64-linux-gnu/12/libgfortran.so;/usr/lib/x86_64-linux-gnu/libm.so;/usr/lib/x86_64-linux-gnu/openmpi/lib/libmpi_cxx.so;/usr/lib/x86_64-linux-gnu/openmpi/lib/libmpi.so"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libEl.so.88-dev"
+  IMPORTED_SONAME_RELEASE "libEl.so.0"
+  )
+
+list(APPEND _cmake_import_check_targets El )
+list(APPEND _cmake_import_check_files_for_El "${_IMPORT_PREFIX}/lib/libEl.so.88-dev" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "Fortran"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_Fortran
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/call_mod.f90" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/CMakeFiles/FortranCInterface.dir/call_mod.f90.o"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/call_sub.f" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/CMakeFiles/FortranCInterface.dir/call_sub.f.o"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/main.F" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/CMakeFiles/FortranCInterface.dir/main.F.o"
+  )
+set(CMAKE_Fortran_COMPILER_ID "GNU")
+set(CMAKE_Fortran_SUBMODULE_SEP "@")
+set(CMAKE_Fortran_SUBMODULE_EXT ".smod")
+
+# The include file search paths:
+set(CMAKE_Fortran_TARGET_INCLUDE_PATH
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/CMakeFiles/myfort.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
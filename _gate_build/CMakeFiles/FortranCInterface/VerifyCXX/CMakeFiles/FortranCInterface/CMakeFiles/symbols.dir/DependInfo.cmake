@@ -0,0 +1,57 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "C"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_C
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/MYMODULE.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/MYMODULE.c.o"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/MY_MODULE.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/MY_MODULE.c.o"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/my_module_.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/my_module_.c.o"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/mymodule_.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/mymodule_.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/MYMODULE_mp_MYSUB-UPPER.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/MYMODULE_mp_MYSUB-UPPER.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/MYSUB-UPPER.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/MYSUB-UPPER.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/MY_MODULE_mp_MY_SUB-UPPER.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/MY_MODULE_mp_MY_SUB-UPPER.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/MY_SUB-UPPER.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/MY_SUB-UPPER.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/_QMmy_modulePmy_sub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/_QMmy_modulePmy_sub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/_QMmymodulePmysub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/_QMmymodulePmysub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/__my_module_MOD_my_sub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/__my_module_MOD_my_sub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/__my_module_NMOD_my_sub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/__my_module_NMOD_my_sub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/__my_module__my_sub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/__my_module__my_sub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/__mymodule_MOD_mysub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/__mymodule_MOD_mysub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/__mymodule_NMOD_mysub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/__mymodule_NMOD_mysub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/__mymodule__mysub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/__mymodule__mysub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/my_moduleSmy_sub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/my_moduleSmy_sub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/my_module_MP_my_sub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/my_module_MP_my_sub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/my_module_mp_my_sub_.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/my_module_mp_my_sub_.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/my_module_my_sub_.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/my_module_my_sub_.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/my_sub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/my_sub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/my_sub_.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/my_sub_.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/my_sub__.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/my_sub__.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/mymoduleSmysub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/mymoduleSmysub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/mymodule_MP_mysub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/mymodule_MP_mysub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/mymodule_mp_mysub_.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/mymodule_mp_mysub_.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/mymodule_mysub_.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/mymodule_mysub_.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/mysub.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/mysub.c.o"
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/symbols/mysub_.c" "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/symbols.dir/symbols/mysub_.c.o"
+  )
+set(CMAKE_C_COMPILER_ID "GNU")
+
+# The include file search paths:
+set(CMAKE_C_TARGET_INCLUDE_PATH
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/CMakeFiles/myfort.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,4 @@
+const char* my_sub_(void)
+{
+  return "INFO:symbol[my_sub_]";
+}
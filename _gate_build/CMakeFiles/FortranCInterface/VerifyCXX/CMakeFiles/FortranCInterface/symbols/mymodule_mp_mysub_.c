@@ -0,0 +1,4 @@
+const char* mymodule_mp_mysub_(void)
+{
+  return "INFO:symbol[mymodule_mp_mysub_]";
+}
@@ -0,0 +1,62 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/_gate_build/CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "/root/repo/_gate_build/CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "/root/repo/_gate_build/CMakeFiles/3.25.1/CMakeFortranCompiler.cmake"
+  "/root/repo/_gate_build/CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/FortranCInterface/Output.cmake"
+  "CMakeFiles/FortranCInterface/exe-Release.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFortranInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface.cmake"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/Detect.cmake"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/Input.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/Macro.h.in"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/Output.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/Verify/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/FortranCInterface/Input.cmake"
+  "CMakeFiles/FortranCInterface/Output.cmake"
+  "VerifyFortran.h"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/VerifyFortran.dir/DependInfo.cmake"
+  "CMakeFiles/VerifyFortranC.dir/DependInfo.cmake"
+  )
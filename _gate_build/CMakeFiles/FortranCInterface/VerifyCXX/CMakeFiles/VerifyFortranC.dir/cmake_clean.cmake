@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/VerifyFortranC.dir/VerifyC.c.o"
+  "CMakeFiles/VerifyFortranC.dir/VerifyCXX.cxx.o"
+  "CMakeFiles/VerifyFortranC.dir/main.c.o"
+  "VerifyFortranC"
+  "VerifyFortranC.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/VerifyFortranC.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,4 @@
+const char* __mymodule_MOD_mysub(void)
+{
+  return "INFO:symbol[__mymodule_MOD_mysub]";
+}
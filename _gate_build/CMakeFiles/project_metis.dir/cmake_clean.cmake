@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/project_metis"
+  "CMakeFiles/project_metis-complete"
+  "download/metis/build/stamp/project_metis-build"
+  "download/metis/build/stamp/project_metis-configure"
+  "download/metis/build/stamp/project_metis-download"
+  "download/metis/build/stamp/project_metis-install"
+  "download/metis/build/stamp/project_metis-mkdir"
+  "download/metis/build/stamp/project_metis-patch"
+  "download/metis/build/stamp/project_metis-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/project_metis.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sandbox-test.dir/sandbox/test.cpp.o"
+  "CMakeFiles/sandbox-test.dir/sandbox/test.cpp.o.d"
+  "bin/sandbox-test"
+  "bin/sandbox-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sandbox-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+set(Elemental_INCLUDE_DIRS "/usr/local/include")
+set(Elemental_INCLUDE_DIRS "${Elemental_INCLUDE_DIRS};/usr/lib/x86_64-linux-gnu/openmpi/include;/usr/lib/x86_64-linux-gnu/openmpi/include/openmpi")
+set(Elemental_INCLUDE_DIRS "${Elemental_INCLUDE_DIRS};QD_INCLUDES-NOTFOUND")
+set(Elemental_INCLUDE_DIRS "${Elemental_INCLUDE_DIRS};")
+set(Elemental_INCLUDE_DIRS "${Elemental_INCLUDE_DIRS};MPFR_INCLUDES-NOTFOUND")
+set(Elemental_INCLUDE_DIRS "${Elemental_INCLUDE_DIRS};/usr/include/x86_64-linux-gnu")
+set(Elemental_INCLUDE_DIRS
+  "${Elemental_INCLUDE_DIRS};")
+
+set(Elemental_COMPILE_FLAGS "-O3 -fcx-fortran-rules -std=gnu++14 ")
+set(Elemental_LINK_FLAGS "")
+
+set(Elemental_DEFINITIONS "")
+
+# Our library dependencies (contains definitions for IMPORTED targets)
+include("${CMAKE_CURRENT_LIST_DIR}/ElementalTargets.cmake")
+
+set(Elemental_LIBRARIES El)
@@ -0,0 +1,87 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS El pmrrr ElSuiteSparse)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Create imported target El
+add_library(El SHARED IMPORTED)
+
+# Create imported target pmrrr
+add_library(pmrrr SHARED IMPORTED)
+
+# Create imported target ElSuiteSparse
+add_library(ElSuiteSparse SHARED IMPORTED)
+
+# Import target "El" for configuration "Release"
+set_property(TARGET El APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(El PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELEASE "pmrrr;ElSuiteSparse;/usr/local/lib/libmetis.so;/usr/lib/x86_64-linux-gnu/libopenblas.so;/usr/lib/gcc/x86_64-linux-gnu/12/libgfortran.so;/usr/lib/x86_64-linux-gnu/libm.so;/usr/lib/x86_64-linux-gnu/openmpi/lib/libmpi_cxx.so;/usr/lib/x86_64-linux-gnu/openmpi/lib/libmpi.so"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_gate_build/libEl.so.88-dev"
+  IMPORTED_SONAME_RELEASE "libEl.so.0"
+  )
+
+# Import target "pmrrr" for configuration "Release"
+set_property(TARGET pmrrr APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(pmrrr PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELEASE "/usr/lib/x86_64-linux-gnu/openmpi/lib/libmpi.so;/usr/lib/x86_64-linux-gnu/libopenblas.so;/usr/lib/gcc/x86_64-linux-gnu/12/libgfortran.so;/usr/lib/x86_64-linux-gnu/libm.so"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_gate_build/external/pmrrr/libpmrrr.so.88-dev"
+  IMPORTED_SONAME_RELEASE "libpmrrr.so.0"
+  )
+
+# Import target "ElSuiteSparse" for configuration "Release"
+set_property(TARGET ElSuiteSparse APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(ElSuiteSparse PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELEASE "m"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_gate_build/external/suite_sparse/libElSuiteSparse.so"
+  IMPORTED_SONAME_RELEASE "libElSuiteSparse.so"
+  )
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_gate_build/download/metis/source"
+  "/root/repo/_gate_build/download/metis/build"
+  "/usr/local"
+  "/root/repo/_gate_build/download/metis/build/tmp"
+  "/root/repo/_gate_build/download/metis/build/stamp"
+  "/usr/local/src"
+  "/root/repo/_gate_build/download/metis/build/stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_gate_build/download/metis/build/stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_gate_build/download/metis/build/stamp${cfgdir}") # cfgdir has leading slash
+endif()
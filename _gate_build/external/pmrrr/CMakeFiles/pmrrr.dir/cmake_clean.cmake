@@ -0,0 +1,99 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pmrrr.dir/src/blas/odcpy.c.o"
+  "CMakeFiles/pmrrr.dir/src/blas/odcpy.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/blas/odscal.c.o"
+  "CMakeFiles/pmrrr.dir/src/blas/odscal.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/blas/odswap.c.o"
+  "CMakeFiles/pmrrr.dir/src/blas/odswap.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/core/counter.c.o"
+  "CMakeFiles/pmrrr.dir/src/core/counter.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/core/queue.c.o"
+  "CMakeFiles/pmrrr.dir/src/core/queue.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/core/rrr.c.o"
+  "CMakeFiles/pmrrr.dir/src/core/rrr.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/core/tasks.c.o"
+  "CMakeFiles/pmrrr.dir/src/core/tasks.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/ode2.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/ode2.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odebz.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odebz.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odev2.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odev2.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odnan.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odnan.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odneg.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odneg.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odnst.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odnst.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odr1v.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odr1v.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrnv.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrnv.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrra.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrra.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrb.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrb.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrc.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrc.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrd.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrd.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrre.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrre.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrf.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrf.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrj.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrj.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrk.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrk.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrr.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrr.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrv.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odrrv.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odruv.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odruv.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odset.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odset.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsnan.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsnan.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsq2.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsq2.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsq3.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsq3.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsq4.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsq4.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsq5.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsq5.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsq6.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsq6.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsrt.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odsrt.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odssq.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odssq.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/odstmr.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/odstmr.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/oerbla.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/oerbla.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/lapack/olsame.c.o"
+  "CMakeFiles/pmrrr.dir/src/lapack/olsame.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/plarre.c.o"
+  "CMakeFiles/pmrrr.dir/src/plarre.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/plarrv.c.o"
+  "CMakeFiles/pmrrr.dir/src/plarrv.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/pmrrr.c.o"
+  "CMakeFiles/pmrrr.dir/src/pmrrr.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/process_c_task.c.o"
+  "CMakeFiles/pmrrr.dir/src/process_c_task.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/process_r_task.c.o"
+  "CMakeFiles/pmrrr.dir/src/process_r_task.c.o.d"
+  "CMakeFiles/pmrrr.dir/src/process_s_task.c.o"
+  "CMakeFiles/pmrrr.dir/src/process_s_task.c.o.d"
+  "libpmrrr.pdb"
+  "libpmrrr.so"
+  "libpmrrr.so.0"
+  "libpmrrr.so.88-dev"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pmrrr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
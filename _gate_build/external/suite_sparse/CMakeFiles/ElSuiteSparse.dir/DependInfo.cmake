@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/suite_sparse/src/amd/amd_1.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_1.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_1.c.o.d"
+  "/root/repo/external/suite_sparse/src/amd/amd_2.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_2.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_2.c.o.d"
+  "/root/repo/external/suite_sparse/src/amd/amd_aat.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_aat.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_aat.c.o.d"
+  "/root/repo/external/suite_sparse/src/amd/amd_control.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_control.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_control.c.o.d"
+  "/root/repo/external/suite_sparse/src/amd/amd_defaults.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_defaults.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_defaults.c.o.d"
+  "/root/repo/external/suite_sparse/src/amd/amd_dump.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_dump.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_dump.c.o.d"
+  "/root/repo/external/suite_sparse/src/amd/amd_info.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_info.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_info.c.o.d"
+  "/root/repo/external/suite_sparse/src/amd/amd_order.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_order.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_order.c.o.d"
+  "/root/repo/external/suite_sparse/src/amd/amd_post_tree.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_post_tree.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_post_tree.c.o.d"
+  "/root/repo/external/suite_sparse/src/amd/amd_postorder.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_postorder.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_postorder.c.o.d"
+  "/root/repo/external/suite_sparse/src/amd/amd_preprocess.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_preprocess.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_preprocess.c.o.d"
+  "/root/repo/external/suite_sparse/src/amd/amd_valid.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_valid.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/amd/amd_valid.c.o.d"
+  "/root/repo/external/suite_sparse/src/config.c" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/config.c.o" "gcc" "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/src/config.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_1.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_1.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_2.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_2.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_aat.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_aat.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_control.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_control.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_defaults.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_defaults.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_dump.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_dump.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_info.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_info.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_order.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_order.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_post_tree.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_post_tree.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_postorder.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_postorder.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_preprocess.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_preprocess.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_valid.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/amd/amd_valid.c.o.d"
+  "CMakeFiles/ElSuiteSparse.dir/src/config.c.o"
+  "CMakeFiles/ElSuiteSparse.dir/src/config.c.o.d"
+  "libElSuiteSparse.pdb"
+  "libElSuiteSparse.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ElSuiteSparse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BENCHMARKS_BENCHMARK_HPP
+#define EL_BENCHMARKS_BENCHMARK_HPP
+
+#include <El.hpp>
+
+// Shared machinery for the benchmark drivers: pinned seeding, barrier-fenced
+// timing with communication-volume capture, and one-JSON-line-per-measurement
+// reporting so that regression harnesses can parse the output without
+// scraping free-form logs.
+
+namespace El {
+namespace bench {
+
+// Reseed the (already deterministic) per-rank generator so that sweeps over
+// seeds are possible while each individual measurement stays reproducible
+inline void PinSeed( long seed )
+{
+    const unsigned rank = mpi::Rank( mpi::COMM_WORLD );
+    Generator().seed( (seed<<16) | (rank & 0xFFFF) );
+    srand( (seed<<16) | (rank & 0xFFFF) );
+}
+
+// A barrier-fenced measurement of a kernel invocation; the cross-rank MPI
+// payload is captured through the event tracer's running volume counter
+class Measurement
+{
+public:
+    Measurement( mpi::Comm comm )
+    : comm_(comm), wasEnabled_(trace::Enabled())
+    {
+        // A small ring suffices since only the running totals are consumed
+        trace::Enable( 1u<<16 );
+        mpi::Barrier( comm_ );
+        timer_.Start();
+    }
+
+    void Stop()
+    {
+        mpi::Barrier( comm_ );
+        seconds_ = timer_.Stop();
+        // Read the local volume before the reduction pollutes the counter
+        const double localVolume = double(trace::MPIVolume());
+        mpiBytes_ = mpi::AllReduce( localVolume, comm_ );
+        if( !wasEnabled_ )
+            trace::Disable();
+    }
+
+    double Seconds() const { return seconds_; }
+    double MPIBytes() const { return mpiBytes_; }
+
+private:
+    mpi::Comm comm_;
+    bool wasEnabled_;
+    Timer timer_;
+    double seconds_=0, mpiBytes_=0;
+};
+
+// Accumulate one machine-readable output record; Emit prints it as a single
+// JSON line from the root rank
+class JSONLine
+{
+public:
+    JSONLine
+    ( const string& benchmark, const string& variant, const string& type )
+    {
+        os_ << "{\"benchmark\":\"" << benchmark
+            << "\",\"variant\":\"" << variant
+            << "\",\"type\":\"" << type << "\"";
+    }
+
+    void Add( const string& key, const string& value )
+    { os_ << ",\"" << key << "\":\"" << value << "\""; }
+    void Add( const string& key, double value )
+    { os_ << ",\"" << key << "\":" << value; }
+    void Add( const string& key, Int value )
+    { os_ << ",\"" << key << "\":" << value; }
+
+    void Add( const Measurement& measurement )
+    {
+        Add( "seconds", measurement.Seconds() );
+        Add( "mpiBytes", measurement.MPIBytes() );
+    }
+
+    void Emit( mpi::Comm comm ) const
+    {
+        if( mpi::Rank(comm) == 0 )
+            Output( os_.str(), "}" );
+    }
+
+private:
+    ostringstream os_;
+};
+
+} // namespace bench
+} // namespace El
+
+#endif // ifndef EL_BENCHMARKS_BENCHMARK_HPP
@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename T>
+void BenchmarkGemm
+( Int n, Int nb, long seed, Int numReps, const Grid& g )
+{
+    SetBlocksize( nb );
+    bench::PinSeed( seed );
+
+    DistMatrix<T> A(g), B(g), COrig(g), C(g);
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    Uniform( COrig, n, n );
+
+    const double realGFlop = 2.*Pow(double(n),3.)/1.e9;
+    const double gFlop = ( IsComplex<T>::value ? 4*realGFlop : realGFlop );
+
+    const pair<string,GemmAlgorithm> variants[] =
+      { std::make_pair("SUMMA_A",GEMM_SUMMA_A),
+        std::make_pair("SUMMA_B",GEMM_SUMMA_B),
+        std::make_pair("SUMMA_C",GEMM_SUMMA_C) };
+    for( const auto& variant : variants )
+    {
+        for( Int rep=0; rep<numReps; ++rep )
+        {
+            C = COrig;
+            bench::Measurement measurement( g.Comm() );
+            Gemm( NORMAL, NORMAL, T(3), A, B, T(4), C, variant.second );
+            measurement.Stop();
+
+            bench::JSONLine line( "Gemm", variant.first, TypeName<T>() );
+            line.Add( "n", n );
+            line.Add( "nb", nb );
+            line.Add( "seed", Int(seed) );
+            line.Add( "rep", rep );
+            line.Add( measurement );
+            line.Add( "gflops", gFlop/measurement.Seconds() );
+            line.Emit( g.Comm() );
+        }
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int nMin = Input("--nMin","smallest problem size",500);
+        const Int nMax = Input("--nMax","largest problem size",2000);
+        const Int nStep = Input("--nStep","problem-size increment",500);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const long seed = Input("--seed","pinned RNG seed",21);
+        const Int numReps = Input("--numReps","repetitions per size",3);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+
+        for( Int n=nMin; n<=nMax; n+=nStep )
+        {
+            BenchmarkGemm<double>( n, nb, seed, numReps, g );
+            BenchmarkGemm<Complex<double>>( n, nb, seed, numReps, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
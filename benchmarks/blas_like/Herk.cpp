@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename T>
+void BenchmarkHerk
+( Int n, Int k, Int nb, long seed, Int numReps, const Grid& g )
+{
+    typedef Base<T> Real;
+    SetBlocksize( nb );
+    bench::PinSeed( seed );
+
+    DistMatrix<T> A(g), COrig(g), C(g);
+    Uniform( A, n, k );
+    Uniform( COrig, n, n );
+    MakeHermitian( LOWER, COrig );
+
+    const double realGFlop = double(n)*double(n)*double(k)/1.e9;
+    const double gFlop = ( IsComplex<T>::value ? 4*realGFlop : realGFlop );
+
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        C = COrig;
+        bench::Measurement measurement( g.Comm() );
+        Herk( LOWER, NORMAL, Real(3), A, Real(4), C );
+        measurement.Stop();
+
+        bench::JSONLine line( "Herk", "LN", TypeName<T>() );
+        line.Add( "n", n );
+        line.Add( "k", k );
+        line.Add( "nb", nb );
+        line.Add( "seed", Int(seed) );
+        line.Add( "rep", rep );
+        line.Add( measurement );
+        line.Add( "gflops", gFlop/measurement.Seconds() );
+        line.Emit( g.Comm() );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int nMin = Input("--nMin","smallest output size",500);
+        const Int nMax = Input("--nMax","largest output size",2000);
+        const Int nStep = Input("--nStep","problem-size increment",500);
+        const Int k = Input("--k","rank of the update",500);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const long seed = Input("--seed","pinned RNG seed",21);
+        const Int numReps = Input("--numReps","repetitions per size",3);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+
+        for( Int n=nMin; n<=nMax; n+=nStep )
+        {
+            BenchmarkHerk<double>( n, k, nb, seed, numReps, g );
+            BenchmarkHerk<Complex<double>>( n, k, nb, seed, numReps, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename T>
+void BenchmarkTrsm
+( Int m, Int n, Int nb, long seed, Int numReps, const Grid& g )
+{
+    SetBlocksize( nb );
+    bench::PinSeed( seed );
+
+    // Form a well-conditioned lower-triangular A and a dense batch of
+    // right-hand sides
+    DistMatrix<T> A(g), XOrig(g), X(g);
+    Uniform( A, m, m );
+    ShiftDiagonal( A, T(m) );
+    MakeTrapezoidal( LOWER, A );
+    Uniform( XOrig, m, n );
+
+    const double realGFlop = double(m)*double(m)*double(n)/1.e9;
+    const double gFlop = ( IsComplex<T>::value ? 4*realGFlop : realGFlop );
+
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        X = XOrig;
+        bench::Measurement measurement( g.Comm() );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, T(1), A, X );
+        measurement.Stop();
+
+        bench::JSONLine line( "Trsm", "LLNN", TypeName<T>() );
+        line.Add( "m", m );
+        line.Add( "n", n );
+        line.Add( "nb", nb );
+        line.Add( "seed", Int(seed) );
+        line.Add( "rep", rep );
+        line.Add( measurement );
+        line.Add( "gflops", gFlop/measurement.Seconds() );
+        line.Emit( g.Comm() );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int mMin = Input("--mMin","smallest triangular size",500);
+        const Int mMax = Input("--mMax","largest triangular size",2000);
+        const Int mStep = Input("--mStep","problem-size increment",500);
+        const Int n = Input("--n","number of right-hand sides",500);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const long seed = Input("--seed","pinned RNG seed",21);
+        const Int numReps = Input("--numReps","repetitions per size",3);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+
+        for( Int m=mMin; m<=mMax; m+=mStep )
+        {
+            BenchmarkTrsm<double>( m, n, nb, seed, numReps, g );
+            BenchmarkTrsm<Complex<double>>( m, n, nb, seed, numReps, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
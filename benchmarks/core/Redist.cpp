@@ -0,0 +1,81 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void BenchmarkRedist
+( const string& variant, const DistMatrix<T>& A, long seed, Int numReps,
+  const Grid& g )
+{
+    const Int n = A.Height();
+    const double gigaBytes =
+      double(n)*double(A.Width())*sizeof(T)/1.e9;
+
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        DistMatrix<T,U,V> B(g);
+        bench::Measurement measurement( g.Comm() );
+        B = A;
+        measurement.Stop();
+
+        bench::JSONLine line( "Redist", variant, TypeName<T>() );
+        line.Add( "n", n );
+        line.Add( "seed", Int(seed) );
+        line.Add( "rep", rep );
+        line.Add( measurement );
+        line.Add( "gbPerSec", gigaBytes/measurement.Seconds() );
+        line.Emit( g.Comm() );
+    }
+}
+
+template<typename T>
+void BenchmarkRedists( Int n, long seed, Int numReps, const Grid& g )
+{
+    bench::PinSeed( seed );
+    DistMatrix<T> A(g);
+    Uniform( A, n, n );
+
+    BenchmarkRedist<T,VC,STAR>( "MC_MR_to_VC_STAR", A, seed, numReps, g );
+    BenchmarkRedist<T,VR,STAR>( "MC_MR_to_VR_STAR", A, seed, numReps, g );
+    BenchmarkRedist<T,MR,MC>( "MC_MR_to_MR_MC", A, seed, numReps, g );
+    BenchmarkRedist<T,STAR,STAR>( "MC_MR_to_STAR_STAR", A, seed, numReps, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int nMin = Input("--nMin","smallest problem size",500);
+        const Int nMax = Input("--nMax","largest problem size",2000);
+        const Int nStep = Input("--nStep","problem-size increment",500);
+        const long seed = Input("--seed","pinned RNG seed",21);
+        const Int numReps = Input("--numReps","repetitions per size",3);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+
+        for( Int n=nMin; n<=nMax; n+=nStep )
+        {
+            BenchmarkRedists<double>( n, seed, numReps, g );
+            BenchmarkRedists<Complex<double>>( n, seed, numReps, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename T>
+void BenchmarkQR
+( Int m, Int n, Int nb, long seed, Int numReps, const Grid& g )
+{
+    SetBlocksize( nb );
+    bench::PinSeed( seed );
+
+    DistMatrix<T> AOrig(g), A(g);
+    Uniform( AOrig, m, n );
+
+    const double realGFlop =
+      ( 2.*double(m)*double(n)*double(n) -
+        2.*Pow(double(n),3.)/3. )/1.e9;
+    const double gFlop = ( IsComplex<T>::value ? 4*realGFlop : realGFlop );
+
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        A = AOrig;
+        DistMatrix<T,MD,STAR> householderScalars(g);
+        DistMatrix<Base<T>,MD,STAR> signature(g);
+        bench::Measurement measurement( g.Comm() );
+        QR( A, householderScalars, signature );
+        measurement.Stop();
+
+        bench::JSONLine line( "QR", "householder", TypeName<T>() );
+        line.Add( "m", m );
+        line.Add( "n", n );
+        line.Add( "nb", nb );
+        line.Add( "seed", Int(seed) );
+        line.Add( "rep", rep );
+        line.Add( measurement );
+        line.Add( "gflops", gFlop/measurement.Seconds() );
+        line.Emit( g.Comm() );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int nMin = Input("--nMin","smallest problem size",500);
+        const Int nMax = Input("--nMax","largest problem size",2000);
+        const Int nStep = Input("--nStep","problem-size increment",500);
+        const double aspect = Input("--aspect","height/width ratio",1.);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const long seed = Input("--seed","pinned RNG seed",21);
+        const Int numReps = Input("--numReps","repetitions per size",3);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+
+        for( Int n=nMin; n<=nMax; n+=nStep )
+        {
+            const Int m = Int(aspect*n);
+            BenchmarkQR<double>( m, n, nb, seed, numReps, g );
+            BenchmarkQR<Complex<double>>( m, n, nb, seed, numReps, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename Field>
+void BenchmarkSparseLDL
+( Int n1, Int n2, Int n3, Int numRHS, long seed, Int numReps,
+  const Grid& grid )
+{
+    bench::PinSeed( seed );
+
+    // A (negated) 3D grid Laplacian keeps the sparsity pattern pinned
+    const Int N = n1*n2*n3;
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -Field(1);
+
+    DistMultiVec<Field> Y( N, numRHS, grid ), YOrig( N, numRHS, grid );
+    MakeUniform( YOrig );
+
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        const bool hermitian = true;
+        BisectCtrl ctrl;
+        DistSparseLDLFactorization<Field> sparseLDLFact;
+        sparseLDLFact.Initialize( A, hermitian, ctrl );
+
+        bench::Measurement factMeasurement( grid.Comm() );
+        sparseLDLFact.Factor( LDL_2D );
+        factMeasurement.Stop();
+
+        const bool selInv = false;
+        const double localFactGFlops =
+          sparseLDLFact.LocalFactorGFlops( selInv );
+        const double factGFlops =
+          mpi::AllReduce( localFactGFlops, grid.Comm() );
+
+        bench::JSONLine factLine( "SparseLDL", "factor", TypeName<Field>() );
+        factLine.Add( "n1", n1 );
+        factLine.Add( "n2", n2 );
+        factLine.Add( "n3", n3 );
+        factLine.Add( "seed", Int(seed) );
+        factLine.Add( "rep", rep );
+        factLine.Add( factMeasurement );
+        factLine.Add( "gflops", factGFlops/factMeasurement.Seconds() );
+        factLine.Emit( grid.Comm() );
+
+        Y = YOrig;
+        bench::Measurement solveMeasurement( grid.Comm() );
+        sparseLDLFact.Solve( Y );
+        solveMeasurement.Stop();
+
+        const double localSolveGFlops =
+          sparseLDLFact.LocalSolveGFlops( numRHS );
+        const double solveGFlops =
+          mpi::AllReduce( localSolveGFlops, grid.Comm() );
+
+        bench::JSONLine solveLine( "SparseLDL", "solve", TypeName<Field>() );
+        solveLine.Add( "n1", n1 );
+        solveLine.Add( "n2", n2 );
+        solveLine.Add( "n3", n3 );
+        solveLine.Add( "numRHS", numRHS );
+        solveLine.Add( "seed", Int(seed) );
+        solveLine.Add( "rep", rep );
+        solveLine.Add( solveMeasurement );
+        solveLine.Add( "gflops", solveGFlops/solveMeasurement.Seconds() );
+        solveLine.Emit( grid.Comm() );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nMin = Input("--nMin","smallest grid dimension",10);
+        const Int nMax = Input("--nMax","largest grid dimension",30);
+        const Int nStep = Input("--nStep","grid-dimension increment",10);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",10);
+        const long seed = Input("--seed","pinned RNG seed",21);
+        const Int numReps = Input("--numReps","repetitions per size",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+
+        for( Int n=nMin; n<=nMax; n+=nStep )
+            BenchmarkSparseLDL<double>
+            ( n, n, n, numRHS, seed, numReps, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
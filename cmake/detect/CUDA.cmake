@@ -0,0 +1,22 @@
+#
+#  Copyright 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+if(NOT EL_DISABLE_CUDA)
+  find_package(CUDA QUIET)
+  if(CUDA_FOUND AND CUDA_CUBLAS_LIBRARIES)
+    set(EL_HAVE_CUDA TRUE)
+    include_directories(${CUDA_INCLUDE_DIRS})
+    list(APPEND EXTERNAL_LIBS ${CUDA_CUBLAS_LIBRARIES} ${CUDA_LIBRARIES})
+    message(STATUS "Found CUDA toolkit; GPU front offload will be available")
+  else()
+    set(EL_HAVE_CUDA FALSE)
+    message(STATUS "CUDA toolkit not found; GPU front offload disabled")
+  endif()
+else()
+  set(EL_HAVE_CUDA FALSE)
+endif()
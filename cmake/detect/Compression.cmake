@@ -0,0 +1,30 @@
+#
+#  Copyright 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+set(EL_HAVE_LZ4 FALSE)
+set(EL_HAVE_ZSTD FALSE)
+if(NOT EL_DISABLE_COMPRESSION)
+  find_path(LZ4_INCLUDE_DIR NAMES lz4.h)
+  find_library(LZ4_LIBRARY NAMES lz4)
+  if(LZ4_INCLUDE_DIR AND LZ4_LIBRARY)
+    set(EL_HAVE_LZ4 TRUE)
+    message(STATUS "Found LZ4: ${LZ4_LIBRARY}")
+    include_directories(${LZ4_INCLUDE_DIR})
+  else()
+    message(STATUS "Did NOT find LZ4")
+  endif()
+  find_path(ZSTD_INCLUDE_DIR NAMES zstd.h)
+  find_library(ZSTD_LIBRARY NAMES zstd)
+  if(ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+    set(EL_HAVE_ZSTD TRUE)
+    message(STATUS "Found Zstd: ${ZSTD_LIBRARY}")
+    include_directories(${ZSTD_INCLUDE_DIR})
+  else()
+    message(STATUS "Did NOT find Zstd")
+  endif()
+endif()
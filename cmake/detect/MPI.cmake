@@ -200,6 +200,35 @@ set(MPI_REDUCE_SCATTER_BLOCK_CODE
      }")
 El_check_c_source_compiles("${MPI_REDUCE_SCATTER_BLOCK_CODE}" 
   EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
+set(MPI_ALLREDUCE_INIT_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       double *a, *b;
+       MPI_Request request;
+       MPI_Allreduce_init
+       ( a, b, 5, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD, MPI_INFO_NULL,
+         &request );
+       MPI_Finalize();
+       return 0;
+     }")
+El_check_c_source_compiles("${MPI_ALLREDUCE_INIT_CODE}"
+  EL_HAVE_MPI_PERSISTENT_COLLECTIVES)
+set(MPI_LARGE_COUNT_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       double *a, *b;
+       MPI_Count count = 5;
+       MPI_Send_c( a, count, MPI_DOUBLE, 0, 0, MPI_COMM_WORLD );
+       MPI_Allreduce_c( a, b, count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+       MPI_Finalize();
+       return 0;
+     }")
+El_check_c_source_compiles("${MPI_LARGE_COUNT_CODE}"
+  EL_HAVE_MPI_LARGE_COUNT)
 set(MPI_IALLGATHER_CODE
     "#include \"mpi.h\"
      int main( int argc, char* argv[] )
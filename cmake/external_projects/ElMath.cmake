@@ -73,6 +73,12 @@ if(MATH_LIBS)
       # The potential underscore suffix will be taken care of elsewhere
       set(EL_HAVE_MKL_GEMMT TRUE)
     endif()
+    El_check_function_exists(dgemm_batch EL_HAVE_DGEMM_BATCH)
+    El_check_function_exists(dgemm_batch_ EL_HAVE_DGEMM_BATCH_POST)
+    if(EL_HAVE_DGEMM_BATCH OR EL_HAVE_DGEMM_BATCH_POST)
+      # The potential underscore suffix will be taken care of elsewhere
+      set(EL_HAVE_MKL_GEMM_BATCH TRUE)
+    endif()
   endif()
   unset(CMAKE_REQUIRED_LIBRARIES)
 # NOTE:
@@ -113,6 +119,12 @@ elseif(NOT EL_DISABLE_MKL AND
         # The potential underscore suffix will be taken care of elsewhere
         set(EL_HAVE_MKL_GEMMT TRUE)
       endif()
+      El_check_function_exists(dgemm_batch EL_HAVE_DGEMM_BATCH)
+      El_check_function_exists(dgemm_batch_ EL_HAVE_DGEMM_BATCH_POST)
+      if(EL_HAVE_DGEMM_BATCH OR EL_HAVE_DGEMM_BATCH_POST)
+        # The potential underscore suffix will be taken care of elsewhere
+        set(EL_HAVE_MKL_GEMM_BATCH TRUE)
+      endif()
     endif()
     unset(CMAKE_REQUIRED_FLAGS)
   else()
@@ -135,6 +147,12 @@ elseif(NOT EL_DISABLE_MKL AND
         # The potential underscore suffix will be taken care of elsewhere
         set(EL_HAVE_MKL_GEMMT TRUE)
       endif()
+      El_check_function_exists(dgemm_batch EL_HAVE_DGEMM_BATCH)
+      El_check_function_exists(dgemm_batch_ EL_HAVE_DGEMM_BATCH_POST)
+      if(EL_HAVE_DGEMM_BATCH OR EL_HAVE_DGEMM_BATCH_POST)
+        # The potential underscore suffix will be taken care of elsewhere
+        set(EL_HAVE_MKL_GEMM_BATCH TRUE)
+      endif()
     endif()
     unset(CMAKE_REQUIRED_FLAGS)
     unset(CMAKE_REQUIRED_LINKER_FLAGS)
@@ -157,6 +175,12 @@ elseif(NOT EL_DISABLE_MKL AND
           # The potential underscore suffix will be taken care of elsewhere
           set(EL_HAVE_MKL_GEMMT TRUE)
         endif()
+        El_check_function_exists(dgemm_batch EL_HAVE_DGEMM_BATCH)
+        El_check_function_exists(dgemm_batch_ EL_HAVE_DGEMM_BATCH_POST)
+        if(EL_HAVE_DGEMM_BATCH OR EL_HAVE_DGEMM_BATCH_POST)
+          # The potential underscore suffix will be taken care of elsewhere
+          set(EL_HAVE_MKL_GEMM_BATCH TRUE)
+        endif()
       endif()
       unset(CMAKE_REQUIRED_FLAGS)
     endif()
@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Sweep over a set of algorithmic blocksizes for several common routines,
+// record the fastest choice for each (routine,datatype,problem size), and
+// optionally save the resulting profile so that it may later be loaded via
+// the EL_TUNING_PROFILE environment variable (or El::LoadTuningProfile).
+
+template<typename F>
+void TuneField
+( const std::vector<El::Int>& sizes,
+  const std::vector<El::Int>& blocksizes,
+  El::Int numTrials,
+  bool progress )
+{
+    const std::string typeTag = El::TypeName<F>();
+    for( El::Int n : sizes )
+    {
+        El::DistMatrix<F> AOrig;
+        El::HermitianUniformSpectrum
+        ( AOrig, n, El::Base<F>(1), El::Base<F>(10) );
+        El::DistMatrix<F> BOrig;
+        El::Uniform( BOrig, n, n );
+
+        double bestCholesky=0, bestLU=0, bestTrsm=0;
+        El::Int bestCholeskyNB=0, bestLUNB=0, bestTrsmNB=0;
+        for( El::Int nb : blocksizes )
+        {
+            El::SetTunedBlocksize( "Cholesky/"+typeTag, 0, nb );
+            El::SetTunedBlocksize( "LU/"+typeTag, 0, nb );
+            El::SetTunedBlocksize( "Trsm/"+typeTag, 0, nb );
+            double choleskyTime=0, luTime=0, trsmTime=0;
+            for( El::Int trial=0; trial<numTrials; ++trial )
+            {
+                El::DistMatrix<F> A( AOrig ), B( BOrig );
+                El::mpi::Barrier();
+                double start = El::mpi::Time();
+                El::Cholesky( El::LOWER, A );
+                choleskyTime += El::mpi::Time()-start;
+
+                A = AOrig;
+                El::DistPermutation dp;
+                El::mpi::Barrier();
+                start = El::mpi::Time();
+                El::LU( A, dp );
+                luTime += El::mpi::Time()-start;
+
+                El::mpi::Barrier();
+                start = El::mpi::Time();
+                El::Trsm
+                ( El::LEFT, El::LOWER, El::NORMAL, El::NON_UNIT,
+                  F(1), A, B );
+                trsmTime += El::mpi::Time()-start;
+            }
+            if( progress && El::mpi::Rank() == 0 )
+                El::Output
+                (typeTag," n=",n," nb=",nb,
+                 ": Cholesky=",choleskyTime,
+                 ", LU=",luTime,", Trsm=",trsmTime);
+            if( bestCholeskyNB == 0 || choleskyTime < bestCholesky )
+            { bestCholesky = choleskyTime; bestCholeskyNB = nb; }
+            if( bestLUNB == 0 || luTime < bestLU )
+            { bestLU = luTime; bestLUNB = nb; }
+            if( bestTrsmNB == 0 || trsmTime < bestTrsm )
+            { bestTrsm = trsmTime; bestTrsmNB = nb; }
+        }
+        // Record the winners; also overwrite the sweep's probe entry at zero
+        // so that problems smaller than the smallest tested size inherit its
+        // winner rather than the last candidate tried
+        const El::Int minKey = ( n == sizes.front() ? 0 : n );
+        El::SetTunedBlocksize( "Cholesky/"+typeTag, minKey, bestCholeskyNB );
+        El::SetTunedBlocksize( "LU/"+typeTag, minKey, bestLUNB );
+        El::SetTunedBlocksize( "Trsm/"+typeTag, minKey, bestTrsmNB );
+        if( El::mpi::Rank() == 0 )
+            El::Output
+            (typeTag," n=",n,": Cholesky nb=",bestCholeskyNB,
+             ", LU nb=",bestLUNB,", Trsm nb=",bestTrsmNB);
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    El::Environment env( argc, argv );
+
+    try
+    {
+        const El::Int minSize =
+          El::Input("--minSize","smallest problem size",250);
+        const El::Int maxSize =
+          El::Input("--maxSize","largest problem size",2000);
+        const El::Int minNB = El::Input("--minNB","smallest blocksize",32);
+        const El::Int maxNB = El::Input("--maxNB","largest blocksize",256);
+        const El::Int numTrials =
+          El::Input("--numTrials","trials per configuration",3);
+        const std::string profile =
+          El::Input("--profile","output profile filename",std::string(""));
+        const bool progress =
+          El::Input("--progress","print per-configuration timings?",false);
+        El::ProcessInput();
+        El::PrintInputReport();
+
+        std::vector<El::Int> sizes;
+        for( El::Int n=minSize; n<=maxSize; n*=2 )
+            sizes.push_back( n );
+        std::vector<El::Int> blocksizes;
+        for( El::Int nb=minNB; nb<=maxNB; nb*=2 )
+            blocksizes.push_back( nb );
+
+        El::ClearTunedBlocksizes();
+        TuneField<float>( sizes, blocksizes, numTrials, progress );
+        TuneField<double>( sizes, blocksizes, numTrials, progress );
+        TuneField<El::Complex<float>>( sizes, blocksizes, numTrials, progress );
+        TuneField<El::Complex<double>>
+        ( sizes, blocksizes, numTrials, progress );
+
+        if( profile != "" && El::mpi::Rank() == 0 )
+            El::SaveTuningProfile( profile );
+    }
+    catch( std::exception& e ) { El::ReportException(e); }
+
+    return 0;
+}
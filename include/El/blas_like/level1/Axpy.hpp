@@ -112,6 +112,24 @@ void Axpy( S alphaS, const ElementalMatrix<T>& X, ElementalMatrix<T>& Y )
     }
 }
 
+// Statically identical distributions: only the alignments (and root) need
+// to be verified before running the purely local kernel, so identically
+// aligned updates execute with zero communication calls and without the
+// generic dispatch and DistData comparisons above
+template<typename T,typename S,Dist U,Dist V>
+void Axpy( S alphaS, const DistMatrix<T,U,V>& X, DistMatrix<T,U,V>& Y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( X, Y ))
+    if( X.ColAlign() == Y.ColAlign() && X.RowAlign() == Y.RowAlign() &&
+        X.Root() == Y.Root() )
+        Axpy( T(alphaS), X.LockedMatrix(), Y.Matrix() );
+    else
+        Axpy( T(alphaS),
+              static_cast<const ElementalMatrix<T>&>(X),
+              static_cast<      ElementalMatrix<T>&>(Y) );
+}
+
 template<typename T,typename S>
 void Axpy( S alphaS, const BlockMatrix<T>& X, BlockMatrix<T>& Y )
 {
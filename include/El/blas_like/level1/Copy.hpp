@@ -10,8 +10,10 @@
 #define EL_BLAS_COPY_HPP
 
 #include <El/blas_like/level1/Copy/internal_decl.hpp>
+#include <El/blas_like/level1/Copy/Plan.hpp>
 #include <El/blas_like/level1/Copy/GeneralPurpose.hpp>
 #include <El/blas_like/level1/Copy/util.hpp>
+#include <El/blas_like/level1/Copy/NonblockingRedist.hpp>
 
 namespace El {
 
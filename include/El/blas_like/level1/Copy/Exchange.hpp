@@ -50,6 +50,18 @@ void Exchange
         ( A.LockedBuffer(), sendSize, sendRank,
           B.Buffer(),       recvSize, recvRank, comm );
     }
+    else if( mpi::UseStridedMatrixType
+             ( localHeightA, localWidthA, A.LDim(), sizeof(T) ) &&
+             mpi::UseStridedMatrixType
+             ( localHeightB, localWidthB, B.LDim(), sizeof(T) ) )
+    {
+        // Hand MPI the strided local sections directly through cached
+        // derived datatypes rather than packing staging buffers
+        mpi::StridedSendRecv
+        ( A.LockedBuffer(), localHeightA, localWidthA, A.LDim(), sendRank,
+          B.Buffer(),       localHeightB, localWidthB, B.LDim(), recvRank,
+          comm );
+    }
     else if( contigB )
     {
         // Pack A's data
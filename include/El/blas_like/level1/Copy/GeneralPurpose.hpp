@@ -12,32 +12,25 @@
 namespace El {
 namespace copy {
 
-template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
-void Helper
+// Compute the structural metadata (owner maps, packing permutation, and
+// send counts) of a general-purpose redistribution. The result depends only
+// upon the shapes and distributions of A and B, not their values, and may
+// therefore be cached and replayed (see Copy/Plan.hpp).
+template<typename S,typename T>
+void BuildRedistributionPlan
 ( const AbstractDistMatrix<S>& A,
-        AbstractDistMatrix<T>& B )
+  const AbstractDistMatrix<T>& B,
+        RedistributionPlan& plan )
 {
     EL_DEBUG_CSE
-
-    // TODO: Decide whether S or T should be used as the transmission type
-    //       based upon which is smaller. Transmit S by default.
-    const Int height = A.Height();
-    const Int width = A.Width();
     const Grid& g = B.Grid();
-    B.Resize( height, width );
-    Zero( B );
     const bool BPartic = B.Participating();
     const int BRoot = B.Root();
-
     const bool includeViewers = (A.Grid() != B.Grid());
 
     const Int localHeight = A.LocalHeight();
     const Int localWidth = A.LocalWidth();
-    auto& ALoc = A.LockedMatrix();
-    auto& BLoc = B.Matrix();
 
-    // TODO: Break into smaller pieces to avoid excessive memory usage?
-    vector<Entry<S>> remoteEntries;
     vector<int> distOwners;
     if( A.RedundantRank() == 0 )
     {
@@ -57,7 +50,6 @@ void Helper
             localRows[iLoc] = B.LocalRow(i,ownerRow);
         }
 
-        remoteEntries.reserve( localHeight*localWidth );
         distOwners.reserve( localHeight*localWidth );
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
         {
@@ -70,15 +62,19 @@ void Helper
                 const int ownerRow = ownerRows[iLoc];
                 const Int localRow = localRows[iLoc];
                 const bool isLocalRow = ( BPartic && ownerRow == colRank );
-                const S& alpha = ALoc(iLoc,jLoc);
                 if( noRedundant && isLocalRow && isLocalCol )
                 {
-                    BLoc(localRow,localCol) = Caster<S,T>::Cast(alpha);
+                    plan.localSourceRows.push_back( iLoc );
+                    plan.localSourceCols.push_back( jLoc );
+                    plan.localTargetRows.push_back( localRow );
+                    plan.localTargetCols.push_back( localCol );
                 }
                 else
                 {
-                    remoteEntries.push_back
-                    ( Entry<S>{localRow,localCol,alpha} );
+                    plan.sourceRows.push_back( iLoc );
+                    plan.sourceCols.push_back( jLoc );
+                    plan.targetRows.push_back( localRow );
+                    plan.targetCols.push_back( localCol );
                     distOwners.push_back( ownerRow + colStride*ownerCol );
                 }
             }
@@ -88,14 +84,11 @@ void Helper
     // We will first push to redundant rank 0 of B
     const int redundantRootB = 0;
 
-    // Compute the metadata
-    // ====================
-    const Int totalSend = remoteEntries.size();
-    mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
+    const Int totalSend = distOwners.size();
+    plan.totalSend = totalSend;
+    vector<int> owners(totalSend);
     if( includeViewers )
     {
-        comm = g.ViewingComm();
         const int viewingSize = mpi::Size( g.ViewingComm() );
         const int distBSize = mpi::Size( B.DistComm() );
 
@@ -108,19 +101,15 @@ void Helper
             distBToViewing[distBRank] = g.VCToViewing(vcOwner);
         }
 
-        sendCounts.resize(viewingSize,0);
+        plan.sendCounts.resize(viewingSize,0);
         for( Int k=0; k<totalSend; ++k )
         {
             owners[k] = distBToViewing[distOwners[k]];
-            ++sendCounts[owners[k]];
+            ++plan.sendCounts[owners[k]];
         }
     }
     else
     {
-        if( !g.InGrid() )
-            return;
-        comm = g.VCComm();
-
         const int distBSize = mpi::Size( B.DistComm() );
         vector<int> distBToVC(distBSize);
         for( int distBRank=0; distBRank<distBSize; ++distBRank )
@@ -131,30 +120,94 @@ void Helper
         }
 
         const int vcSize = mpi::Size( g.VCComm() );
-        sendCounts.resize(vcSize,0);
+        plan.sendCounts.resize(vcSize,0);
         for( Int k=0; k<totalSend; ++k )
         {
             owners[k] = distBToVC[distOwners[k]];
-            ++sendCounts[owners[k]];
+            ++plan.sendCounts[owners[k]];
         }
     }
     SwapClear( distOwners );
 
+    Scan( plan.sendCounts, plan.sendOffs );
+    plan.sendSlots.resize( totalSend );
+    auto offs = plan.sendOffs;
+    for( Int k=0; k<totalSend; ++k )
+        plan.sendSlots[k] = offs[owners[k]]++;
+}
+
+template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
+void Helper
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+
+    // TODO: Decide whether S or T should be used as the transmission type
+    //       based upon which is smaller. Transmit S by default.
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Grid& g = B.Grid();
+    B.Resize( height, width );
+    Zero( B );
+    const bool BPartic = B.Participating();
+
+    const bool includeViewers = (A.Grid() != B.Grid());
+    if( !includeViewers && !g.InGrid() )
+        return;
+
+    auto& ALoc = A.LockedMatrix();
+    auto& BLoc = B.Matrix();
+
+    // We will first push to redundant rank 0 of B
+    const int redundantRootB = 0;
+
+    // Retrieve or compute the communication schedule
+    // ==============================================
+    std::shared_ptr<const RedistributionPlan> plan;
+    if( RedistributionPlanCacheEnabled() )
+    {
+        const string signature = RedistributionSignature( A, B );
+        plan = FindRedistributionPlan( signature );
+        if( plan == nullptr )
+        {
+            auto newPlan = std::make_shared<RedistributionPlan>();
+            BuildRedistributionPlan( A, B, *newPlan );
+            CacheRedistributionPlan( signature, newPlan );
+            plan = newPlan;
+        }
+    }
+    else
+    {
+        auto newPlan = std::make_shared<RedistributionPlan>();
+        BuildRedistributionPlan( A, B, *newPlan );
+        plan = newPlan;
+    }
+
+    // Assign the entries which do not need to be communicated
+    // =======================================================
+    const Int numLocal = plan->localSourceRows.size();
+    for( Int k=0; k<numLocal; ++k )
+        BLoc(plan->localTargetRows[k],plan->localTargetCols[k]) =
+          Caster<S,T>::Cast
+          ( ALoc(plan->localSourceRows[k],plan->localSourceCols[k]) );
+
     // Pack the data
     // =============
-    vector<int> sendOffs;
-    Scan( sendCounts, sendOffs );
+    // TODO: Break into smaller pieces to avoid excessive memory usage?
+    const Int totalSend = plan->totalSend;
     vector<Entry<S>> sendBuf;
     FastResize( sendBuf, totalSend );
-    auto offs = sendOffs;
     for( Int k=0; k<totalSend; ++k )
-        sendBuf[offs[owners[k]]++] = remoteEntries[k];
-    SwapClear( remoteEntries );
-    SwapClear( owners );
+        sendBuf[plan->sendSlots[k]] =
+          Entry<S>{plan->targetRows[k],plan->targetCols[k],
+                   ALoc(plan->sourceRows[k],plan->sourceCols[k])};
 
     // Exchange and unpack the data
     // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+    mpi::Comm comm = ( includeViewers ? g.ViewingComm() : g.VCComm() );
+    auto recvBuf =
+      mpi::AllToAll( sendBuf, plan->sendCounts, plan->sendOffs, comm );
     if( BPartic )
     {
         if( B.RedundantRank() == redundantRootB )
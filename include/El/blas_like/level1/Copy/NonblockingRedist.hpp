@@ -0,0 +1,189 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_NONBLOCKINGREDIST_HPP
+#define EL_BLAS_COPY_NONBLOCKINGREDIST_HPP
+
+namespace El {
+namespace copy {
+
+// A future-like handle for a redistribution which is in flight, returned by
+// BeginRedistribute and completed by EndRedistribute. The aligned column and
+// row AllGather redistributions (e.g., [MC,MR] |-> [* ,MR] and
+// [MC,MR] |-> [MC,* ], which dominate distributed Gemm) are issued through
+// nonblocking collectives so that local computation may proceed while the
+// communication progresses; all other redistributions fall back to a
+// blocking Copy within BeginRedistribute, and the handle then completes
+// trivially.
+template<typename T>
+class NonblockingRedist
+{
+public:
+    NonblockingRedist() EL_NO_EXCEPT { }
+    NonblockingRedist( NonblockingRedist<T>&& other ) EL_NO_EXCEPT
+    { *this = std::move(other); }
+    NonblockingRedist<T>& operator=( NonblockingRedist<T>&& other )
+    EL_NO_EXCEPT
+    {
+        B_ = other.B_;
+        unpackAlign_ = other.unpackAlign_;
+        unpackStride_ = other.unpackStride_;
+        portionSize_ = other.portionSize_;
+        columnwise_ = other.columnwise_;
+        inFlight_ = other.inFlight_;
+        buffer_ = std::move(other.buffer_);
+        recvCounts_ = std::move(other.recvCounts_);
+        recvDispls_ = std::move(other.recvDispls_);
+        request_ = other.request_;
+        other.inFlight_ = false;
+        other.B_ = nullptr;
+        return *this;
+    }
+    NonblockingRedist( const NonblockingRedist<T>& ) = delete;
+    NonblockingRedist<T>& operator=( const NonblockingRedist<T>& ) = delete;
+
+    ~NonblockingRedist() EL_NO_RELEASE_EXCEPT { Wait(); }
+
+    // Whether communication is still outstanding
+    bool InFlight() const EL_NO_EXCEPT { return inFlight_; }
+
+    // Complete the communication (if any) and unpack into the target
+    void Wait() EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_CSE
+        if( !inFlight_ )
+            return;
+        mpi::Wait( request_ );
+        const T* recvBuf = &buffer_[0];
+        if( columnwise_ )
+            util::ColStridedUnpack
+            ( B_->Height(), B_->LocalWidth(), unpackAlign_, unpackStride_,
+              recvBuf, portionSize_,
+              B_->Buffer(), B_->LDim() );
+        else
+            util::RowStridedUnpack
+            ( B_->LocalHeight(), B_->Width(), unpackAlign_, unpackStride_,
+              recvBuf, portionSize_,
+              B_->Buffer(), B_->LDim() );
+        inFlight_ = false;
+        SwapClear( buffer_ );
+    }
+
+private:
+    template<typename S>
+    friend NonblockingRedist<S> BeginRedistribute
+    ( const ElementalMatrix<S>& A, ElementalMatrix<S>& B );
+
+    void StartAllGather
+    ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, bool columnwise )
+    {
+        EL_DEBUG_CSE
+        const Int gatherStride = columnwise ? A.ColStride() : A.RowStride();
+        mpi::Comm gatherComm = columnwise ? A.ColComm() : A.RowComm();
+        const Int maxGatherLength = columnwise ?
+          MaxLength(A.Height(),gatherStride) :
+          MaxLength(A.Width(),gatherStride);
+        const Int keptLength = columnwise ? A.LocalWidth() : A.LocalHeight();
+        portionSize_ = mpi::Pad( maxGatherLength*keptLength );
+
+        FastResize( buffer_, (gatherStride+1)*portionSize_ );
+        T* recvBuf = &buffer_[0];
+        T* sendBuf = &buffer_[gatherStride*portionSize_];
+
+        // Pack
+        util::InterleaveMatrix
+        ( A.LocalHeight(), A.LocalWidth(),
+          A.LockedBuffer(), 1, A.LDim(),
+          sendBuf,          1, A.LocalHeight() );
+
+        // The count and displacement arrays must outlive the request
+        recvCounts_.resize( gatherStride, int(portionSize_) );
+        recvDispls_.resize( gatherStride );
+        for( Int q=0; q<gatherStride; ++q )
+            recvDispls_[q] = int(q*portionSize_);
+        mpi::IAllGather
+        ( sendBuf, portionSize_,
+          recvBuf, recvCounts_.data(), recvDispls_.data(), gatherComm,
+          request_ );
+
+        B_ = &B;
+        unpackAlign_ = columnwise ? A.ColAlign() : A.RowAlign();
+        unpackStride_ = gatherStride;
+        columnwise_ = columnwise;
+        inFlight_ = true;
+    }
+
+    ElementalMatrix<T>* B_=nullptr;
+    Int unpackAlign_=0, unpackStride_=1;
+    Int portionSize_=0;
+    bool columnwise_=true;
+    bool inFlight_=false;
+    vector<T> buffer_;
+    vector<int> recvCounts_, recvDispls_;
+    mpi::Request<T> request_;
+};
+
+// Begin a redistribution of A into B and return a handle which must be
+// completed (via EndRedistribute or its Wait member) before B is used.
+// A must not be modified while the redistribution is in flight.
+template<typename T>
+NonblockingRedist<T> BeginRedistribute
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    NonblockingRedist<T> handle;
+
+    // Only the aligned, in-grid AllGather patterns are overlapped; everything
+    // else completes immediately through the blocking general-purpose path
+    const bool sameGrid = ( &A.Grid() == &B.Grid() );
+    const bool trivialCross =
+      !A.Grid().InGrid() || A.CrossComm() == mpi::COMM_SELF;
+    if( sameGrid && trivialCross && A.Participating() )
+    {
+        if( B.ColDist() == Collect(A.ColDist()) &&
+            B.RowDist() == A.RowDist() &&
+            A.ColStride() > 1 && A.Height() > 1 )
+        {
+            B.AlignRowsAndResize
+            ( A.RowAlign(), A.Height(), A.Width(), false, false );
+            if( B.RowAlign() == A.RowAlign() )
+            {
+                handle.StartAllGather( A, B, true );
+                return handle;
+            }
+        }
+        else if( B.RowDist() == Collect(A.RowDist()) &&
+                 B.ColDist() == A.ColDist() &&
+                 A.RowStride() > 1 && A.Width() > 1 )
+        {
+            B.AlignColsAndResize
+            ( A.ColAlign(), A.Height(), A.Width(), false, false );
+            if( B.ColAlign() == A.ColAlign() )
+            {
+                handle.StartAllGather( A, B, false );
+                return handle;
+            }
+        }
+    }
+
+    Copy( A, B );
+    return handle;
+}
+
+// Complete a redistribution begun by BeginRedistribute
+template<typename T>
+void EndRedistribute( NonblockingRedist<T>& handle )
+{
+    EL_DEBUG_CSE
+    handle.Wait();
+}
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_NONBLOCKINGREDIST_HPP
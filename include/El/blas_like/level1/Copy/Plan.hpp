@@ -0,0 +1,70 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_PLAN_HPP
+#define EL_BLAS_COPY_PLAN_HPP
+
+namespace El {
+namespace copy {
+
+// A cached communication schedule for a general-purpose redistribution with
+// a fixed signature (shape, source and target distribution data, and grids).
+// Iterative solvers redistribute identically-shaped matrices every iteration,
+// and the owner maps, packing permutation, and send counts are purely
+// structural, so steady-state copies can skip their computation entirely and
+// proceed straight to pack/AllToAll/unpack.
+struct RedistributionPlan
+{
+    Int totalSend=0;
+    // The local indices within A of each entry which must be communicated,
+    // the local indices within B which it targets, and its slot within the
+    // packed send buffer
+    vector<Int> sourceRows, sourceCols;
+    vector<Int> targetRows, targetCols;
+    vector<Int> sendSlots;
+    vector<int> sendCounts, sendOffs;
+    // The entries which are simply copied into the local portion of B
+    vector<Int> localSourceRows, localSourceCols,
+                localTargetRows, localTargetCols;
+};
+
+// The per-process plan cache is opt-in (see EnableMemoryPool for the
+// analogous allocator control)
+void EnableRedistributionPlanCache();
+void DisableRedistributionPlanCache();
+bool RedistributionPlanCacheEnabled() EL_NO_EXCEPT;
+void FlushRedistributionPlanCache();
+
+std::shared_ptr<const RedistributionPlan>
+FindRedistributionPlan( const string& signature );
+void CacheRedistributionPlan
+( const string& signature, const std::shared_ptr<const RedistributionPlan>& plan );
+
+template<typename S,typename T>
+string RedistributionSignature
+( const AbstractDistMatrix<S>& A,
+  const AbstractDistMatrix<T>& B )
+{
+    ostringstream os;
+    os << A.Height() << ',' << A.Width()
+       << '|' << int(A.ColDist()) << ',' << int(A.RowDist())
+       << ',' << int(A.Wrap())
+       << ',' << A.ColAlign() << ',' << A.RowAlign()
+       << ',' << A.ColCut() << ',' << A.RowCut() << ',' << A.Root()
+       << '|' << int(B.ColDist()) << ',' << int(B.RowDist())
+       << ',' << int(B.Wrap())
+       << ',' << B.ColAlign() << ',' << B.RowAlign()
+       << ',' << B.ColCut() << ',' << B.RowCut() << ',' << B.Root()
+       << '|' << &A.Grid() << ',' << &B.Grid();
+    return os.str();
+}
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_PLAN_HPP
@@ -32,6 +32,19 @@ T Dot( const DistMultiVec<T>& A, const DistMultiVec<T>& B )
     return HilbertSchmidt( A, B );
 }
 
+// Queue the inner product into a reduction batch rather than performing its
+// AllReduce immediately; 'innerProd' is set when the batch is flushed
+template<typename T>
+void Dot
+( const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        mpi::ReductionBatch<T>& batch,
+        T& innerProd )
+{
+    EL_DEBUG_CSE
+    HilbertSchmidt( A, B, batch, innerProd );
+}
+
 // TODO(poulson): Think about using a more stable accumulation algorithm?
 
 template<typename T>
@@ -117,6 +130,11 @@ T Dotu( const DistMultiVec<T>& A, const DistMultiVec<T>& B )
   ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B ); \
   EL_EXTERN template T Dot \
   ( const DistMultiVec<T>& A, const DistMultiVec<T>& B ); \
+  EL_EXTERN template void Dot \
+  ( const AbstractDistMatrix<T>& A, \
+    const AbstractDistMatrix<T>& B, \
+          mpi::ReductionBatch<T>& batch, \
+          T& innerProd ); \
   EL_EXTERN template T Dotu \
   ( const Matrix<T>& A, const Matrix<T>& B ); \
   EL_EXTERN template T Dotu \
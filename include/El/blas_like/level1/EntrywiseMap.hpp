@@ -11,8 +11,14 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
+// The following function-object overloads form the elementwise engine: the
+// kernel's type is carried into the loop so that the compiler is free to
+// inline it and vectorize (whereas a kernel hidden behind the virtual
+// dispatch of a std::function rarely is). The std::function overloads below
+// forward here and remain for callers which genuinely require type erasure.
+
+template<typename T,class UnaryFunc>
+void EntrywiseMap( Matrix<T>& A, const UnaryFunc& func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -44,8 +50,8 @@ void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
     }
 }
 
-template<typename T>
-void EntrywiseMap( SparseMatrix<T>& A, function<T(const T&)> func )
+template<typename T,class UnaryFunc>
+void EntrywiseMap( SparseMatrix<T>& A, const UnaryFunc& func )
 {
     EL_DEBUG_CSE
     T* vBuf = A.ValueBuffer();
@@ -55,12 +61,12 @@ void EntrywiseMap( SparseMatrix<T>& A, function<T(const T&)> func )
         vBuf[k] = func(vBuf[k]);
 }
 
-template<typename T>
-void EntrywiseMap( AbstractDistMatrix<T>& A, function<T(const T&)> func )
+template<typename T,class UnaryFunc>
+void EntrywiseMap( AbstractDistMatrix<T>& A, const UnaryFunc& func )
 { EntrywiseMap( A.Matrix(), func ); }
 
-template<typename T>
-void EntrywiseMap( DistSparseMatrix<T>& A, function<T(const T&)> func )
+template<typename T,class UnaryFunc>
+void EntrywiseMap( DistSparseMatrix<T>& A, const UnaryFunc& func )
 {
     EL_DEBUG_CSE
     T* vBuf = A.ValueBuffer();
@@ -70,13 +76,13 @@ void EntrywiseMap( DistSparseMatrix<T>& A, function<T(const T&)> func )
         vBuf[k] = func(vBuf[k]);
 }
 
-template<typename T>
-void EntrywiseMap( DistMultiVec<T>& A, function<T(const T&)> func )
+template<typename T,class UnaryFunc>
+void EntrywiseMap( DistMultiVec<T>& A, const UnaryFunc& func )
 { EntrywiseMap( A.Matrix(), func ); }
 
-template<typename S,typename T>
+template<typename S,typename T,class UnaryFunc>
 void EntrywiseMap
-( const Matrix<S>& A, Matrix<T>& B, function<T(const S&)> func )
+( const Matrix<S>& A, Matrix<T>& B, const UnaryFunc& func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -97,11 +103,36 @@ void EntrywiseMap
     }
 }
 
+template<typename T>
+void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename T>
+void EntrywiseMap( SparseMatrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename T>
+void EntrywiseMap( AbstractDistMatrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap( A.Matrix(), func ); }
+
+template<typename T>
+void EntrywiseMap( DistSparseMatrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename T>
+void EntrywiseMap( DistMultiVec<T>& A, function<T(const T&)> func )
+{ EntrywiseMap( A.Matrix(), func ); }
+
 template<typename S,typename T>
 void EntrywiseMap
+( const Matrix<S>& A, Matrix<T>& B, function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T,class UnaryFunc>
+void EntrywiseMap
 ( const SparseMatrix<S>& A,
         SparseMatrix<T>& B,
-        function<T(const S&)> func )
+  const UnaryFunc& func )
 {
     EL_DEBUG_CSE
     const Int numEntries = A.NumEntries();
@@ -114,11 +145,11 @@ void EntrywiseMap
         BValBuf[k] = func(AValBuf[k]);
 }
 
-template<typename S,typename T>
+template<typename S,typename T,class UnaryFunc>
 void EntrywiseMap
 ( const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B,
-        function<T(const S&)> func )
+  const UnaryFunc& func )
 {
     if( A.DistData().colDist == B.DistData().colDist &&
         A.DistData().rowDist == B.DistData().rowDist &&
@@ -145,11 +176,11 @@ void EntrywiseMap
     }
 }
 
-template<typename S,typename T>
+template<typename S,typename T,class UnaryFunc>
 void EntrywiseMap
 ( const DistSparseMatrix<S>& A,
         DistSparseMatrix<T>& B,
-        function<T(const S&)> func )
+  const UnaryFunc& func )
 {
     EL_DEBUG_CSE
     const Int numLocalEntries = A.NumLocalEntries();
@@ -163,11 +194,11 @@ void EntrywiseMap
         BValBuf[k] = func(AValBuf[k]);
 }
 
-template<typename S,typename T>
+template<typename S,typename T,class UnaryFunc>
 void EntrywiseMap
 ( const DistMultiVec<S>& A,
         DistMultiVec<T>& B,
-        function<T(const S&)> func )
+  const UnaryFunc& func )
 {
     EL_DEBUG_CSE
     B.SetGrid( A.Grid() );
@@ -175,6 +206,34 @@ void EntrywiseMap
     EntrywiseMap( A.LockedMatrix(), B.Matrix(), func );
 }
 
+template<typename S,typename T>
+void EntrywiseMap
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const SparseMatrix<S>& A,
+        SparseMatrix<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const DistSparseMatrix<S>& A,
+        DistSparseMatrix<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const DistMultiVec<S>& A,
+        DistMultiVec<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -15,8 +15,19 @@ template<typename T>
 void GetDiagonal( const Matrix<T>& A, Matrix<T>& d, Int offset )
 {
     EL_DEBUG_CSE
-    function<T(const T&)> identity( []( const T& alpha ) { return alpha; } );
-    GetMappedDiagonal( A, d, identity, offset );
+    // Copy the diagonal directly rather than routing each entry through the
+    // function indirection of GetMappedDiagonal
+    const Int diagLength = A.DiagonalLength(offset);
+    d.Resize( diagLength, 1 );
+
+    const Int iStart = Max(-offset,0);
+    const Int jStart = Max( offset,0);
+    T* dBuf = d.Buffer();
+    const T* ABuf = A.LockedBuffer();
+    const Int ldim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<diagLength; ++k )
+        dBuf[k] = ABuf[(iStart+k)+(jStart+k)*ldim];
 }
 
 template<typename T>
@@ -74,6 +85,50 @@ void GetDiagonal
     GetMappedDiagonal( A, d, identity, offset );
 }
 
+// When the output is already distributed and aligned as A's diagonal, the
+// harvest is a purely local strided copy with zero communication calls and
+// none of the proxy or per-entry function overhead of the general path
+template<typename T,Dist U,Dist V>
+void GetDiagonal
+( const DistMatrix<T,U,V>& A, AbstractDistMatrix<T>& d, Int offset )
+{
+    EL_DEBUG_CSE
+    if( d.Wrap() == ELEMENT &&
+        d.ColDist() == DiagCol<U,V>() && d.RowDist() == DiagRow<U,V>() &&
+        A.DiagonalAlignedWith( d.DistData(), offset ) )
+    {
+        d.Resize( A.DiagonalLength(offset), 1 );
+        if( d.Participating() )
+        {
+            const Int diagShift = d.ColShift();
+            const Int iStart = diagShift + Max(-offset,0);
+            const Int jStart = diagShift + Max( offset,0);
+
+            const Int colStride = A.ColStride();
+            const Int rowStride = A.RowStride();
+            const Int iLocStart = (iStart-A.ColShift()) / colStride;
+            const Int jLocStart = (jStart-A.RowShift()) / rowStride;
+            const Int iLocStride = d.ColStride() / colStride;
+            const Int jLocStride = d.ColStride() / rowStride;
+
+            const Int localDiagLength = d.LocalHeight();
+            T* dBuf = d.Buffer();
+            const T* ABuf = A.LockedBuffer();
+            const Int ldim = A.LDim();
+            EL_PARALLEL_FOR
+            for( Int k=0; k<localDiagLength; ++k )
+            {
+                const Int iLoc = iLocStart + k*iLocStride;
+                const Int jLoc = jLocStart + k*jLocStride;
+                dBuf[k] = ABuf[iLoc+jLoc*ldim];
+            }
+        }
+        return;
+    }
+    function<T(const T&)> identity( []( const T& alpha ) { return alpha; } );
+    GetMappedDiagonal( A, d, identity, offset );
+}
+
 template<typename T,Dist U,Dist V,DistWrap wrap>
 void GetRealPartOfDiagonal
 ( const DistMatrix<T,U,V,wrap>& A, AbstractDistMatrix<Base<T>>& d, Int offset )
@@ -204,6 +204,136 @@ void GetSubmatrix
     LogicError("This routine is not yet written");
 }
 
+// Extract many (possibly overlapping) contiguous submatrices at once, e.g.,
+// the diagonal blocks of an overlapping domain decomposition. Each local
+// nonzero is binned across all of the ranges containing it in a single
+// sweep, the entries of all submatrices are exchanged with one AllToAll,
+// and each sub-CSR is then assembled from purely local queues; the
+// alternative of calling GetSubmatrix once per block rescans the local
+// nonzeros and synchronizes for every block.
+template<typename T>
+void GetSubmatrices
+( const DistSparseMatrix<T>& A,
+  const vector<Range<Int>>& I,
+  const vector<Range<Int>>& J,
+        vector<DistSparseMatrix<T>>& ASubs )
+{
+    EL_DEBUG_CSE
+    const Int numSub = I.size();
+    if( Int(J.size()) != numSub )
+        LogicError("Expected the same number of row and column ranges");
+    const Grid& grid = A.Grid();
+    const int commSize = grid.Size();
+
+    vector<Range<Int>> IRes(I), JRes(J);
+    ASubs.resize( numSub );
+    for( Int b=0; b<numSub; ++b )
+    {
+        if( IRes[b].end == END )
+            IRes[b].end = A.Height();
+        if( JRes[b].end == END )
+            JRes[b].end = A.Width();
+        ASubs[b].SetGrid( grid );
+        ASubs[b].Resize( IRes[b].end-IRes[b].beg, JRes[b].end-JRes[b].beg );
+        Zero( ASubs[b] );
+    }
+
+    // Form, for each local row, the list of ranges containing it
+    // ==========================================================
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    vector<Int> rowRangeSizes(localHeight,0);
+    for( Int b=0; b<numSub; ++b )
+    {
+        const Int beg = Max( IRes[b].beg-firstLocalRow, Int(0) );
+        const Int end = Min( IRes[b].end-firstLocalRow, localHeight );
+        for( Int iLoc=beg; iLoc<end; ++iLoc )
+            ++rowRangeSizes[iLoc];
+    }
+    vector<Int> rowRangeOffs;
+    const Int totalRowRanges = Scan( rowRangeSizes, rowRangeOffs );
+    vector<Int> rowRanges(totalRowRanges);
+    auto rangeOffs = rowRangeOffs;
+    for( Int b=0; b<numSub; ++b )
+    {
+        const Int beg = Max( IRes[b].beg-firstLocalRow, Int(0) );
+        const Int end = Min( IRes[b].end-firstLocalRow, localHeight );
+        for( Int iLoc=beg; iLoc<end; ++iLoc )
+            rowRanges[rangeOffs[iLoc]++] = b;
+    }
+
+    // Compute the metadata with a single sweep over the local nonzeros
+    // ================================================================
+    const Int numEntries = A.NumLocalEntries();
+    vector<int> sendCounts(commSize,0);
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int iLoc = A.Row(e) - firstLocalRow;
+        const Int j = A.Col(e);
+        for( Int k=rowRangeOffs[iLoc]; k<rowRangeOffs[iLoc+1]; ++k )
+        {
+            const Int b = rowRanges[k];
+            if( j >= JRes[b].beg && j < JRes[b].end )
+                ++sendCounts[ ASubs[b].RowOwner(A.Row(e)-IRes[b].beg) ];
+        }
+    }
+
+    // Pack the data
+    // =============
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    auto offs = sendOffs;
+    vector<Int> sendRanges(totalSend), sendRows(totalSend),
+                sendCols(totalSend);
+    vector<T> sendVals(totalSend);
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int iLoc = A.Row(e) - firstLocalRow;
+        const Int j = A.Col(e);
+        for( Int k=rowRangeOffs[iLoc]; k<rowRangeOffs[iLoc+1]; ++k )
+        {
+            const Int b = rowRanges[k];
+            if( j >= JRes[b].beg && j < JRes[b].end )
+            {
+                const Int iSub = A.Row(e) - IRes[b].beg;
+                const int owner = ASubs[b].RowOwner( iSub );
+                sendRanges[offs[owner]] = b;
+                sendRows[offs[owner]] = iSub;
+                sendCols[offs[owner]] = j - JRes[b].beg;
+                sendVals[offs[owner]] = A.Value(e);
+                ++offs[owner];
+            }
+        }
+    }
+
+    // Exchange and unpack the data
+    // ============================
+    auto recvRanges =
+      mpi::AllToAll( sendRanges, sendCounts, sendOffs, grid.Comm() );
+    auto recvRows =
+      mpi::AllToAll( sendRows, sendCounts, sendOffs, grid.Comm() );
+    auto recvCols =
+      mpi::AllToAll( sendCols, sendCounts, sendOffs, grid.Comm() );
+    auto recvVals =
+      mpi::AllToAll( sendVals, sendCounts, sendOffs, grid.Comm() );
+    const Int totalRecv = recvRanges.size();
+    vector<Int> subRecvCounts(numSub,0);
+    for( Int p=0; p<totalRecv; ++p )
+        ++subRecvCounts[recvRanges[p]];
+    for( Int b=0; b<numSub; ++b )
+        ASubs[b].Reserve( subRecvCounts[b] );
+    for( Int p=0; p<totalRecv; ++p )
+    {
+        const Int b = recvRanges[p];
+        ASubs[b].QueueLocalUpdate
+        ( recvRows[p]-ASubs[b].FirstLocalRow(), recvCols[p], recvVals[p] );
+    }
+    // Every received entry was routed to its owner, so the assembly of each
+    // submatrix is independent and communication-free
+    for( Int b=0; b<numSub; ++b )
+        ASubs[b].ProcessLocalQueues();
+}
+
 template<typename T>
 void GetSubmatrix
 ( const DistMultiVec<T>& A,
@@ -604,6 +734,11 @@ void GetSubmatrix
     const vector<Int>& I, \
     const vector<Int>& J, \
           DistSparseMatrix<T>& ASub ); \
+  EL_EXTERN template void GetSubmatrices \
+  ( const DistSparseMatrix<T>& A, \
+    const vector<Range<Int>>& I, \
+    const vector<Range<Int>>& J, \
+          vector<DistSparseMatrix<T>>& ASubs ); \
   EL_EXTERN template void GetSubmatrix \
   ( const DistMultiVec<T>& A, \
           Range<Int> I, \
@@ -55,6 +55,42 @@ Base<F> Nrm2( const DistMultiVec<F>& x )
     return FrobeniusNorm( x );
 }
 
+// Queue the two-norm into a reduction batch: the local sum of squares is
+// enqueued and a square root is applied to the reduced value when the batch
+// is flushed. Note that, since the summands must be combinable with those of
+// the other queued reductions, this forgoes the scaled accumulation that the
+// immediate version uses to guard the intermediate squares against overflow
+template<typename F>
+void Nrm2
+( const AbstractDistMatrix<F>& x,
+        mpi::ReductionBatch<Base<F>>& batch,
+        Base<F>& norm )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( x.Height() != 1 && x.Width() != 1 )
+          LogicError("x must be a vector");
+    )
+    typedef Base<F> Real;
+    if( x.RedundantSize() != 1 || x.CrossSize() != 1 )
+        LogicError
+        ("Batched Nrm2 requires trivial cross and redundant communicators");
+    Real localScale=0, localScaledSquare=1;
+    if( x.Participating() )
+    {
+        const Matrix<F>& xLoc = x.LockedMatrix();
+        const Int localHeight = x.LocalHeight();
+        const Int localWidth = x.LocalWidth();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                UpdateScaledSquare
+                ( xLoc(iLoc,jLoc), localScale, localScaledSquare );
+    }
+    const Real localSquaredNorm = localScale*localScale*localScaledSquare;
+    batch.Queue
+    ( localSquaredNorm, norm, []( const Real& t ) { return Sqrt(t); } );
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -64,7 +100,11 @@ Base<F> Nrm2( const DistMultiVec<F>& x )
 #define PROTO(F) \
   EL_EXTERN template Base<F> Nrm2( const Matrix<F>& x ); \
   EL_EXTERN template Base<F> Nrm2( const AbstractDistMatrix<F>& x ); \
-  EL_EXTERN template Base<F> Nrm2( const DistMultiVec<F>& x );
+  EL_EXTERN template Base<F> Nrm2( const DistMultiVec<F>& x ); \
+  EL_EXTERN template void Nrm2 \
+  ( const AbstractDistMatrix<F>& x, \
+          mpi::ReductionBatch<Base<F>>& batch, \
+          Base<F>& norm );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -67,6 +67,65 @@ void PartialColAllGather
 ( const BlockMatrix<T>& A,
         BlockMatrix<T>& B, bool conjugate );
 
+// The interior of each cache block of the blocked transposes below is
+// processed as a grid of microBlockSize x microBlockSize register tiles;
+// the fixed trip counts allow the compiler to fully unroll and vectorize
+// the tile loops, while the (rare) partial edge tiles fall back to the
+// generic loops.
+const Int microBlockSize = 8;
+
+template<typename T>
+void MicroTile
+( const T* ABlockBuf, Int ldA,
+        T* BBlockBuf, Int ldB )
+{
+    for( Int jb=0; jb<microBlockSize; ++jb )
+        for( Int ib=0; ib<microBlockSize; ++ib )
+            BBlockBuf[jb+ib*ldB] = ABlockBuf[ib+jb*ldA];
+}
+
+template<typename T>
+void ConjMicroTile
+( const T* ABlockBuf, Int ldA,
+        T* BBlockBuf, Int ldB )
+{
+    for( Int jb=0; jb<microBlockSize; ++jb )
+        for( Int ib=0; ib<microBlockSize; ++ib )
+            BBlockBuf[jb+ib*ldB] = Conj(ABlockBuf[ib+jb*ldA]);
+}
+
+// (Conjugate-)transpose an mb x nb cache block of A into B
+template<typename T>
+void Tile
+( Int mb, Int nb,
+  const T* ABlockBuf, Int ldA,
+        T* BBlockBuf, Int ldB,
+  bool conjugate )
+{
+    const Int mMicro = mb - Mod( mb, microBlockSize );
+    const Int nMicro = nb - Mod( nb, microBlockSize );
+    if( conjugate )
+    {
+        for( Int jb=0; jb<nMicro; jb+=microBlockSize )
+            for( Int ib=0; ib<mMicro; ib+=microBlockSize )
+                ConjMicroTile
+                ( &ABlockBuf[ib+jb*ldA], ldA, &BBlockBuf[jb+ib*ldB], ldB );
+        for( Int jb=0; jb<nb; ++jb )
+            for( Int ib=(jb<nMicro ? mMicro : 0); ib<mb; ++ib )
+                BBlockBuf[jb+ib*ldB] = Conj(ABlockBuf[ib+jb*ldA]);
+    }
+    else
+    {
+        for( Int jb=0; jb<nMicro; jb+=microBlockSize )
+            for( Int ib=0; ib<mMicro; ib+=microBlockSize )
+                MicroTile
+                ( &ABlockBuf[ib+jb*ldA], ldA, &BBlockBuf[jb+ib*ldB], ldB );
+        for( Int jb=0; jb<nb; ++jb )
+            for( Int ib=(jb<nMicro ? mMicro : 0); ib<mb; ++ib )
+                BBlockBuf[jb+ib*ldB] = ABlockBuf[ib+jb*ldA];
+    }
+}
+
 } // namespace transpose
 
 template<typename T>
@@ -85,49 +144,112 @@ void Transpose( const Matrix<T>& A, Matrix<T>& B, bool conjugate )
     // in src/core/imports/openblas.cpp
     
     // Blocked matrix transpose
-    // Note: block size should be a multiple of cache line size and
-    // should be small enough to fit in L1 cache. On recent Intel
-    // CPUs, cache line size is 64 B and L1 cache is 32 KB per core.
-    const Int bsize = Max( 64 / sizeof(T), 1 );
+    // Note: each cache block should be small enough for a read/write pair
+    // to comfortably fit in L1 cache (32 KB per core on recent Intel CPUs),
+    // and its interior is swept with the fully-unrolled register tiles of
+    // transpose::Tile
+    const Int bsize = Max( Int(256/sizeof(T)), transpose::microBlockSize );
     const T* ABuf = A.LockedBuffer();
           T* BBuf = B.Buffer();
     const Int ldA = A.LDim();
     const Int ldB = B.LDim();
-    if( conjugate )
+    EL_PARALLEL_FOR_COLLAPSE2
+    for( Int j=0; j<n; j+=bsize )
     {
-        EL_PARALLEL_FOR_COLLAPSE2
-        for( Int j=0; j<n; j+=bsize )
+        for( Int i=0; i<m; i+=bsize )
         {
-            for( Int i=0; i<m; i+=bsize )
-            {
-                const Int mb = Min( bsize, m - i );
-                const Int nb = Min( bsize, n - j );
-                const T* ABlockBuf = &ABuf[i+j*ldA];
-                      T* BBlockBuf = &BBuf[j+i*ldB];
-                for( Int jb=0; jb<nb; ++jb )
-                    for( Int ib=0; ib<mb; ++ib )
-                        BBlockBuf[jb+ib*ldB] = Conj(ABlockBuf[ib+jb*ldA]);
-            }
+            const Int mb = Min( bsize, m - i );
+            const Int nb = Min( bsize, n - j );
+            transpose::Tile
+            ( mb, nb, &ABuf[i+j*ldA], ldA, &BBuf[j+i*ldB], ldB, conjugate );
         }
     }
-    else
+#endif
+}
+
+// In-place (conjugate-)transposition of a square matrix: the diagonal cache
+// blocks are transposed via symmetric swaps and each pair of off-diagonal
+// blocks is swapped through a transposition, so that no workspace is needed.
+// (An in-place transposition of a non-square matrix would permute the
+// entries along the cycles of length m*n-1, but would also exchange the
+// roles of the height and leading dimension, which a Matrix cannot express;
+// use the out-of-place form for non-square operands.)
+template<typename T>
+void Transpose( Matrix<T>& A, bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m != n )
+        LogicError("In-place transposition requires a square matrix");
+    const Int bsize = Max( Int(256/sizeof(T)), transpose::microBlockSize );
+    T* ABuf = A.Buffer();
+    const Int ldA = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; j+=bsize )
     {
-        EL_PARALLEL_FOR_COLLAPSE2
-        for( Int j=0; j<n; j+=bsize )
+        const Int nb = Min( bsize, n - j );
+
+        // Transpose the diagonal block in place
+        T* ADiagBuf = &ABuf[j+j*ldA];
+        if( conjugate )
         {
-            for( Int i=0; i<m; i+=bsize )
+            for( Int jb=0; jb<nb; ++jb )
+            {
+                ADiagBuf[jb+jb*ldA] = Conj(ADiagBuf[jb+jb*ldA]);
+                for( Int ib=jb+1; ib<nb; ++ib )
+                {
+                    const T alpha = ADiagBuf[ib+jb*ldA];
+                    ADiagBuf[ib+jb*ldA] = Conj(ADiagBuf[jb+ib*ldA]);
+                    ADiagBuf[jb+ib*ldA] = Conj(alpha);
+                }
+            }
+        }
+        else
+        {
+            for( Int jb=0; jb<nb; ++jb )
+            {
+                for( Int ib=jb+1; ib<nb; ++ib )
+                {
+                    const T alpha = ADiagBuf[ib+jb*ldA];
+                    ADiagBuf[ib+jb*ldA] = ADiagBuf[jb+ib*ldA];
+                    ADiagBuf[jb+ib*ldA] = alpha;
+                }
+            }
+        }
+
+        // Swap each block below the diagonal with its transposed partner
+        for( Int i=j+bsize; i<n; i+=bsize )
+        {
+            const Int mb = Min( bsize, n - i );
+            T* ALowerBuf = &ABuf[i+j*ldA];
+            T* AUpperBuf = &ABuf[j+i*ldA];
+            if( conjugate )
             {
-                const Int mb = Min( bsize, m - i );
-                const Int nb = Min( bsize, n - j );
-                const T* ABlockBuf = &ABuf[i+j*ldA];
-                      T* BBlockBuf = &BBuf[j+i*ldB];
                 for( Int jb=0; jb<nb; ++jb )
+                {
                     for( Int ib=0; ib<mb; ++ib )
-                        BBlockBuf[jb+ib*ldB] = ABlockBuf[ib+jb*ldA];
+                    {
+                        const T alpha = ALowerBuf[ib+jb*ldA];
+                        ALowerBuf[ib+jb*ldA] = Conj(AUpperBuf[jb+ib*ldA]);
+                        AUpperBuf[jb+ib*ldA] = Conj(alpha);
+                    }
+                }
+            }
+            else
+            {
+                for( Int jb=0; jb<nb; ++jb )
+                {
+                    for( Int ib=0; ib<mb; ++ib )
+                    {
+                        const T alpha = ALowerBuf[ib+jb*ldA];
+                        ALowerBuf[ib+jb*ldA] = AUpperBuf[jb+ib*ldA];
+                        AUpperBuf[jb+ib*ldA] = alpha;
+                    }
+                }
             }
         }
     }
-#endif
 }
 
 template<typename T>
@@ -312,10 +434,103 @@ void Transpose
 ( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B, bool conjugate )
 {
     EL_DEBUG_CSE
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const Int numLocalEntries = A.NumLocalEntries();
     B.SetGrid( A.Grid() );
     B.Resize( A.Width(), A.Height() );
-    Zero( B, false );
-    TransposeAxpy( T(1), A, B, conjugate );
+
+    // Form (or reuse) the exchange plan: bucket the local entries by the
+    // owner of their column under the transposed row distribution, exchange
+    // the index pairs, and record the permutation sending each received
+    // entry to its slot in the sorted CSR arrays. Since A is assembled, the
+    // transposed entries are already unique, so no compression is needed.
+    auto& meta = A.LockedDistGraph().transposeMeta;
+    if( !meta.ready )
+    {
+        meta.sendSizes.assign( commSize, 0 );
+        for( Int e=0; e<numLocalEntries; ++e )
+            ++meta.sendSizes[ B.RowOwner(A.Col(e)) ];
+        meta.recvSizes.resize( commSize );
+        mpi::AllToAll
+        ( meta.sendSizes.data(), 1, meta.recvSizes.data(), 1, comm );
+        Scan( meta.sendSizes, meta.sendOffs );
+        meta.numRecvEntries = Scan( meta.recvSizes, meta.recvOffs );
+
+        meta.sendSlots.resize( numLocalEntries );
+        auto offs = meta.sendOffs;
+        for( Int e=0; e<numLocalEntries; ++e )
+            meta.sendSlots[e] = offs[ B.RowOwner(A.Col(e)) ]++;
+
+        vector<int> pairSendSizes( commSize ), pairSendOffs( commSize ),
+                    pairRecvSizes( commSize ), pairRecvOffs( commSize );
+        for( int q=0; q<commSize; ++q )
+        {
+            pairSendSizes[q] = 2*meta.sendSizes[q];
+            pairSendOffs[q] = 2*meta.sendOffs[q];
+            pairRecvSizes[q] = 2*meta.recvSizes[q];
+            pairRecvOffs[q] = 2*meta.recvOffs[q];
+        }
+        vector<Int> sendPairs( 2*numLocalEntries ),
+                    recvPairs( 2*meta.numRecvEntries );
+        for( Int e=0; e<numLocalEntries; ++e )
+        {
+            const Int slot = meta.sendSlots[e];
+            sendPairs[2*slot] = A.Col(e);
+            sendPairs[2*slot+1] = A.Row(e);
+        }
+        mpi::AllToAll
+        ( sendPairs.data(), pairSendSizes.data(), pairSendOffs.data(),
+          recvPairs.data(), pairRecvSizes.data(), pairRecvOffs.data(), comm );
+
+        vector<Int> perm( meta.numRecvEntries );
+        for( Int p=0; p<meta.numRecvEntries; ++p )
+            perm[p] = p;
+        std::sort
+        ( perm.begin(), perm.end(),
+          [&]( const Int& a, const Int& b )
+          {
+              if( recvPairs[2*a] != recvPairs[2*b] )
+                  return recvPairs[2*a] < recvPairs[2*b];
+              return recvPairs[2*a+1] < recvPairs[2*b+1];
+          } );
+        meta.recvSlots.resize( meta.numRecvEntries );
+        meta.sources.resize( meta.numRecvEntries );
+        meta.targets.resize( meta.numRecvEntries );
+        for( Int q=0; q<meta.numRecvEntries; ++q )
+        {
+            const Int p = perm[q];
+            meta.recvSlots[p] = q;
+            meta.sources[q] = recvPairs[2*p];
+            meta.targets[q] = recvPairs[2*p+1];
+        }
+        meta.ready = true;
+    }
+
+    // With the plan in hand, the transpose is pure data movement: pack the
+    // (possibly conjugated) values, exchange them, and scatter them straight
+    // into CSR order
+    vector<T> sendVals( numLocalEntries ), recvVals( meta.numRecvEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+        sendVals[meta.sendSlots[e]] =
+          ( conjugate ? Conj(A.Value(e)) : A.Value(e) );
+    mpi::AllToAll
+    ( sendVals.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      recvVals.data(), meta.recvSizes.data(), meta.recvOffs.data(), comm );
+
+    B.ForceNumLocalEntries( meta.numRecvEntries );
+    Int* sourceBuf = B.SourceBuffer();
+    Int* targetBuf = B.TargetBuffer();
+    T* valBuf = B.ValueBuffer();
+    for( Int q=0; q<meta.numRecvEntries; ++q )
+    {
+        sourceBuf[q] = meta.sources[q];
+        targetBuf[q] = meta.targets[q];
+    }
+    for( Int p=0; p<meta.numRecvEntries; ++p )
+        valBuf[meta.recvSlots[p]] = recvVals[p];
+    B.DistGraph().ComputeSourceOffsets();
+    B.ForceConsistency( true );
 }
 
 template<typename T>
@@ -325,6 +540,13 @@ void Adjoint( const Matrix<T>& A, Matrix<T>& B )
     Transpose( A, B, true );
 }
 
+template<typename T>
+void Adjoint( Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    Transpose( A, true );
+}
+
 template<typename T>
 void Adjoint( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
@@ -372,6 +594,8 @@ void Adjoint( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B )
   EL_EXTERN template void Transpose \
   ( const Matrix<T>& A, Matrix<T>& B, bool conjugate ); \
   EL_EXTERN template void Transpose \
+  ( Matrix<T>& A, bool conjugate ); \
+  EL_EXTERN template void Transpose \
   ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, bool conjugate ); \
   EL_EXTERN template void Transpose \
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B, bool conjugate ); \
@@ -385,6 +609,8 @@ void Adjoint( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B )
   EL_EXTERN template void Adjoint \
   ( const Matrix<T>& A, Matrix<T>& B ); \
   EL_EXTERN template void Adjoint \
+  ( Matrix<T>& A ); \
+  EL_EXTERN template void Adjoint \
   ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B ); \
   EL_EXTERN template void Adjoint \
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B ); \
@@ -15,9 +15,17 @@ template<typename T>
 void UpdateDiagonal( Matrix<T>& A, T alpha, const Matrix<T>& d, Int offset )
 {
     EL_DEBUG_CSE
-    function<void(T&,const T&)> func
-    ( [alpha]( T& beta, const T& gamma ) { beta += alpha*gamma; } );
-    UpdateMappedDiagonal( A, d, func, offset );
+    // Update the diagonal directly rather than routing each entry through
+    // the function indirection of UpdateMappedDiagonal
+    const Int iStart = Max(-offset,0);
+    const Int jStart = Max( offset,0);
+    const Int diagLength = d.Height();
+    const T* dBuf = d.LockedBuffer();
+    T* ABuf = A.Buffer();
+    const Int ldim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<diagLength; ++k )
+        ABuf[(iStart+k)+(jStart+k)*ldim] += alpha*dBuf[k];
 }
 
 template<typename T>
@@ -47,6 +55,39 @@ void UpdateDiagonal
 ( DistMatrix<T,U,V>& A, T alpha, const ElementalMatrix<T>& d, Int offset )
 {
     EL_DEBUG_CSE
+    // When d is already distributed and aligned as A's diagonal, the update
+    // is a purely local strided axpy with zero communication calls and none
+    // of the proxy or per-entry function overhead of the general path
+    if( d.ColDist() == DiagCol<U,V>() && d.RowDist() == DiagRow<U,V>() &&
+        A.DiagonalAlignedWith( d.DistData(), offset ) )
+    {
+        if( d.Participating() )
+        {
+            const Int diagShift = d.ColShift();
+            const Int iStart = diagShift + Max(-offset,0);
+            const Int jStart = diagShift + Max( offset,0);
+
+            const Int colStride = A.ColStride();
+            const Int rowStride = A.RowStride();
+            const Int iLocStart = (iStart-A.ColShift()) / colStride;
+            const Int jLocStart = (jStart-A.RowShift()) / rowStride;
+            const Int iLocStride = d.ColStride() / colStride;
+            const Int jLocStride = d.ColStride() / rowStride;
+
+            const Int localDiagLength = d.LocalHeight();
+            const T* dBuf = d.LockedBuffer();
+            T* ABuf = A.Buffer();
+            const Int ldim = A.LDim();
+            EL_PARALLEL_FOR
+            for( Int k=0; k<localDiagLength; ++k )
+            {
+                const Int iLoc = iLocStart + k*iLocStride;
+                const Int jLoc = jLocStart + k*jLocStride;
+                ABuf[iLoc+jLoc*ldim] += alpha*dBuf[k];
+            }
+        }
+        return;
+    }
     function<void(T&,const T&)> func
     ( [alpha]( T& beta, const T& gamma ) { beta += alpha*gamma; } );
     UpdateMappedDiagonal( A, d, func, offset );
@@ -62,7 +62,10 @@ void UpdateSubmatrix
             }
         }
     }
-    A.ProcessQueues();
+    // If an accumulation epoch is open, leave the contributions queued so
+    // that EndAccumulation can flush them in a single exchange
+    if( !A.Accumulating() )
+        A.ProcessQueues();
 }
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
@@ -23,6 +23,9 @@ namespace El {
 // =======
 template<typename Ring>
 void Adjoint( const Matrix<Ring>& A, Matrix<Ring>& B );
+// In-place adjoint of a square matrix
+template<typename Ring>
+void Adjoint( Matrix<Ring>& A );
 template<typename Ring>
 void Adjoint( const ElementalMatrix<Ring>& A, ElementalMatrix<Ring>& B );
 template<typename Ring>
@@ -805,6 +808,14 @@ template<typename T>
 T Dot( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B );
 template<typename T>
 T Dot( const DistMultiVec<T>& A, const DistMultiVec<T>& B );
+// Queue the inner product into a reduction batch rather than performing its
+// AllReduce immediately; 'innerProd' is set when the batch is flushed
+template<typename T>
+void Dot
+( const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        mpi::ReductionBatch<T>& batch,
+        T& innerProd );
 
 // Dotu
 // ====
@@ -826,6 +837,38 @@ void EntrywiseFill( DistMultiVec<T>& A, function<T(void)> func );
 
 // EntrywiseMap
 // ============
+// The function-object overloads keep the kernel's type visible to the
+// compiler (and therefore inlinable and vectorizable); the std::function
+// overloads forward to them and remain for callers requiring type erasure
+template<typename T,class UnaryFunc>
+void EntrywiseMap( Matrix<T>& A, const UnaryFunc& func );
+template<typename T,class UnaryFunc>
+void EntrywiseMap( SparseMatrix<T>& A, const UnaryFunc& func );
+template<typename T,class UnaryFunc>
+void EntrywiseMap( AbstractDistMatrix<T>& A, const UnaryFunc& func );
+template<typename T,class UnaryFunc>
+void EntrywiseMap( DistSparseMatrix<T>& A, const UnaryFunc& func );
+template<typename T,class UnaryFunc>
+void EntrywiseMap( DistMultiVec<T>& A, const UnaryFunc& func );
+
+template<typename S,typename T,class UnaryFunc>
+void EntrywiseMap
+( const Matrix<S>& A, Matrix<T>& B, const UnaryFunc& func );
+template<typename S,typename T,class UnaryFunc>
+void EntrywiseMap
+( const SparseMatrix<S>& A, SparseMatrix<T>& B, const UnaryFunc& func );
+template<typename S,typename T,class UnaryFunc>
+void EntrywiseMap
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B,
+  const UnaryFunc& func );
+template<typename S,typename T,class UnaryFunc>
+void EntrywiseMap
+( const DistSparseMatrix<S>& A, DistSparseMatrix<T>& B,
+  const UnaryFunc& func );
+template<typename S,typename T,class UnaryFunc>
+void EntrywiseMap
+( const DistMultiVec<S>& A, DistMultiVec<T>& B, const UnaryFunc& func );
+
 template<typename T>
 void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func );
 template<typename T>
@@ -1016,6 +1059,13 @@ void GetSubgraph
   const vector<Int>& J,
         DistGraph& subgraph );
 
+// Batched extraction of many (possibly overlapping) contiguous subgraphs
+void GetSubgraphs
+( const DistGraph& graph,
+  const vector<Range<Int>>& I,
+  const vector<Range<Int>>& J,
+        vector<DistGraph>& subgraphs );
+
 // GetSubmatrix
 // ============
 
@@ -1124,6 +1174,14 @@ void GetSubmatrix
   const vector<Int>& J,
         DistSparseMatrix<T>& ASub );
 
+// Batched extraction of many (possibly overlapping) contiguous submatrices
+template<typename T>
+void GetSubmatrices
+( const DistSparseMatrix<T>& A,
+  const vector<Range<Int>>& I,
+  const vector<Range<Int>>& J,
+        vector<DistSparseMatrix<T>>& ASubs );
+
 template<typename T>
 void GetSubmatrix
 ( const DistMultiVec<T>& A,
@@ -1173,6 +1231,14 @@ T HilbertSchmidt
 ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& C );
 template<typename T>
 T HilbertSchmidt( const DistMultiVec<T>& A, const DistMultiVec<T>& B );
+// Queue the inner product into a reduction batch rather than performing its
+// AllReduce immediately; 'innerProd' is set when the batch is flushed
+template<typename T>
+void HilbertSchmidt
+( const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        mpi::ReductionBatch<T>& batch,
+        T& innerProd );
 
 // Imaginary part
 // ==============
@@ -1488,6 +1554,13 @@ template<typename Field>
 Base<Field> Nrm2( const AbstractDistMatrix<Field>& x );
 template<typename Field>
 Base<Field> Nrm2( const DistMultiVec<Field>& x );
+// Queue the two-norm into a reduction batch rather than performing its
+// AllReduce immediately; 'norm' is set when the batch is flushed
+template<typename Field>
+void Nrm2
+( const AbstractDistMatrix<Field>& x,
+        mpi::ReductionBatch<Base<Field>>& batch,
+        Base<Field>& norm );
 
 // QuasiDiagonalScale
 // ==================
@@ -1955,6 +2028,9 @@ void Transpose
 ( const Matrix<T>& A,
         Matrix<T>& B,
   bool conjugate=false );
+// In-place transposition of a square matrix (no workspace is required)
+template<typename T>
+void Transpose( Matrix<T>& A, bool conjugate=false );
 template<typename T>
 void Transpose
 ( const ElementalMatrix<T>& A,
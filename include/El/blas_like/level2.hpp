@@ -19,6 +19,14 @@ struct SymvCtrl
 {
     Int bsize=LocalSymvBlocksize<T>();
     bool avoidTrmvBasedLocalSymv=true;
+    // Merge the two partial-sum reductions (over the row and column
+    // communicators) into a single summed AllReduce of the full-length
+    // result vector. This halves the number of synchronizations per
+    // application, which is a significant win for the latency-bound
+    // repeated Symv/Hemv applications of iterative methods (e.g.,
+    // Chebyshev filtering), at the cost of communicating O(n) rather
+    // than O(n/sqrt(p)) entries per process.
+    bool fusedReduction=false;
 };
 
 // Gemv
@@ -65,6 +73,32 @@ void LocalGemv
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& x,
   T beta,        AbstractDistMatrix<T>& y );
 
+// An amortization of the vector redistributions performed by a sequence of
+// distributed Gemv applications with a fixed matrix (e.g., the repeated
+// applications within a Krylov iteration): the redistributed copy of x and
+// the unreduced partial product stay resident in their pinned
+// [MR,STAR]/[MC,STAR] forms across calls, so that only the per-call
+// contraction of the partial product remains.
+template<typename T>
+class GemvPlan
+{
+public:
+    GemvPlan( const DistMatrix<T>& A );
+
+    // Form y := alpha op(A) x + beta y, where op is determined by
+    // 'orientation'; x and y must be column vectors over A's grid
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const AbstractDistMatrix<T>& x,
+      T beta,        AbstractDistMatrix<T>& y );
+
+private:
+    const DistMatrix<T>& A_;
+    DistMatrix<T,MR,STAR> x_MR_STAR_, z_MR_STAR_;
+    DistMatrix<T,MC,STAR> x_MC_STAR_, z_MC_STAR_;
+    DistMatrix<T,MR,MC> z_MR_MC_;
+};
+
 // Ger
 // ===
 template<typename T>
@@ -246,6 +280,13 @@ void Trr2
 
 // Trsv
 // ====
+
+// The matrix dimension at or below which the distributed solve simply
+// gathers the triangular matrix and right-hand side to a single process
+// and solves locally, sidestepping the latency-bound block recurrence
+template<typename F> void SetTrsvGatherCutoff( Int cutoff );
+template<typename F> Int TrsvGatherCutoff();
+
 template<typename F>
 void Trsv
 ( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
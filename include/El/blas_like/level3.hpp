@@ -17,6 +17,20 @@ template<typename T> Int LocalTrrkBlocksize();
 template<typename T> void SetLocalTrr2kBlocksize( Int blocksize );
 template<typename T> Int LocalTrr2kBlocksize();
 
+// BlockAxpy
+// =========
+// The multi-vector update W := W + V C, where the (small) coefficient
+// matrix C is stored redundantly in the distributed case, so that the
+// update requires no communication. This is the update step of block
+// Krylov methods, where the columns of W are corrected by combinations
+// of the columns of a basis V.
+template<typename T>
+void BlockAxpy
+( const Matrix<T>& V, const Matrix<T>& C, Matrix<T>& W );
+template<typename T>
+void BlockAxpy
+( const DistMultiVec<T>& V, const Matrix<T>& C, DistMultiVec<T>& W );
+
 // Gemm
 // ====
 namespace GemmAlgorithmNS {
@@ -25,12 +39,42 @@ enum GemmAlgorithm {
   GEMM_SUMMA_A,
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
+  // Stationary-C SUMMA whose panel allgathers are overlapped with the local
+  // updates via nonblocking collectives (currently Normal/Normal only; the
+  // other orientations defer to the standard stationary-C algorithm)
+  GEMM_SUMMA_C_OVERLAP,
   GEMM_SUMMA_DOT,
+  // Communication-avoiding (2.5D) algorithm which replicates slabs of the
+  // contraction dimension across a fibration of team grids and sums the
+  // partial contributions to C at the end (currently Normal/Normal only)
+  GEMM_SUMMA_25D,
   GEMM_CANNON
 };
 }
 using namespace GemmAlgorithmNS;
 
+// The replication depth used by the GEMM_SUMMA_25D algorithm
+void SetGemm25DDepth( Int depth );
+Int Gemm25DDepth();
+
+namespace gemm {
+
+// Measure the machine constants behind the SUMMA cost models (the local
+// Gemm rate, the per-process bandwidth, and the effective message latency
+// over the given grid) and store them in the tuning registry, so that
+// Save/LoadTuningProfile persists them alongside the blocksize tables.
+// Once calibrated, GEMM_DEFAULT resolves the SUMMA variant by comparing
+// the predicted time of each candidate for the actual (m, n, k, grid)
+// rather than by the static dimension-ratio heuristics.
+void CalibrateSumma( const Grid& grid, Int localDim=1000 );
+
+// Report each model-based variant decision (with the per-variant time
+// predictions) from the root of the grid, so that mispredictions can be
+// audited against measured timings
+void SetSummaModelLogging( bool logging );
+
+} // namespace gemm
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -53,6 +97,25 @@ void Gemm
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// Natively multiply block-cyclic operands through PBLAS, so that pipelines
+// mixing ScaLAPACK calls with Elemental ones need not redistribute to an
+// elemental distribution and back around each level-3 product
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+           const DistMatrix<T,MC,MR,BLOCK>& B,
+  T beta,        DistMatrix<T,MC,MR,BLOCK>& C );
+
+// Form C := beta C + alpha op(A) op(B), where A is only available through
+// a lazy generator view: the tiles of op(A) are materialized one at a time
+// as they are consumed, so that an enormous structured operand never needs
+// to be stored in full
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const LazyMatrix<T>& A, const Matrix<T>& B, T beta, Matrix<T>& C );
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -66,6 +129,60 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// Form C := beta C + alpha op(A) op(B) by demoting A and B to the next
+// lower precision (e.g., double to float), multiplying there, and
+// accumulating the product back into C in the original precision. When no
+// lower precision exists for T, this defers to the standard Gemm.
+template<typename T>
+void MixedPrecisionGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B, T beta, Matrix<T>& C );
+
+template<typename T>
+void MixedPrecisionGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+
+// Perform a batch of independent (typically small) GEMM's through a single
+// call, which amortizes the per-call dispatch overhead and, where MKL's
+// batched kernels are available, hands the entire batch to the vendor
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& AList,
+           const vector<Matrix<T>>& BList,
+  T beta,        vector<Matrix<T>>& CList );
+
+// The strided variant, in which matrix b of the batch begins at
+// A[b*AStride] (and similarly for B and C) with common dimensions
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim, Int AStride,
+           const T* B, Int BLDim, Int BStride,
+  T beta,        T* C, Int CLDim, Int CStride, Int batchCount );
+
+// Gram
+// ====
+// Fused inner products of the columns of a pair of multi-vectors,
+//
+//     G := V^H W,
+//
+// formed with a single local Gemm plus (in the distributed case) a single
+// AllReduce, rather than one reduction per column pair; the small result
+// is returned redundantly on every process. The single-operand variant
+// forms G := V^H V through a Herk on the lower triangle instead.
+template<typename T>
+void Gram( const Matrix<T>& V, const Matrix<T>& W, Matrix<T>& G );
+template<typename T>
+void Gram( const DistMultiVec<T>& V, const DistMultiVec<T>& W, Matrix<T>& G );
+template<typename T>
+void Gram( const Matrix<T>& V, Matrix<T>& G );
+template<typename T>
+void Gram( const DistMultiVec<T>& V, Matrix<T>& G );
+
 // Hemm
 // ====
 template<typename T>
@@ -100,6 +217,12 @@ void Herk
 ( UpperOrLower uplo, Orientation orientation,
   Base<T> alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C );
 
+template<typename T>
+void Herk
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+  Base<T> beta,        DistMatrix<T,MC,MR,BLOCK>& C );
+
 template<typename T>
 void Herk
 ( UpperOrLower uplo, Orientation orientation,
@@ -182,6 +305,66 @@ void Multiply
   T beta,
         AbstractDistMatrix<T>& Y );
 
+// A plan for forming the product of two one-dimensionally distributed
+// sparse matrices: the halo-exchange schedule for the needed rows of the
+// right-hand factor, their fetched pattern, and the local pattern of the
+// product. All of said information depends only upon the sparsity patterns,
+// so a plan formed by one product can be passed to repeated products with
+// the same patterns (e.g., the Gram matrices of an unchanging graph), which
+// then skip the symbolic phase and reduce to a value exchange followed by
+// the numeric accumulation.
+struct DistSparseMultPlan
+{
+    bool ready=false;
+
+    // The sorted global rows of the right-hand factor needed locally and,
+    // for each local entry of the left-hand factor, the position of its
+    // column within said list
+    vector<Int> neededRows, entryHaloRows;
+
+    // The number of rows requested from (and served to) each process
+    vector<int> reqSendSizes, reqSendOffs,
+                reqRecvSizes, reqRecvOffs;
+    // The local rows of the right-hand factor served to other processes,
+    // grouped by requesting process
+    vector<Int> servedRows;
+
+    // The entry-wise exchange plan for the contents of the fetched rows
+    Int numHaloEntries=0;
+    vector<int> servSizes, servOffs,
+                haloSizes, haloOffs;
+    // The CSR pattern of the fetched rows, aligned with neededRows
+    vector<Int> haloRowOffs, haloTargets;
+
+    // The sorted local pattern of the product
+    vector<Int> sources, targets;
+};
+
+// C := A B for one-dimensionally distributed sparse matrices, with each
+// local row of the product merged through hash-based accumulation of the
+// (possibly remote) rows of B selected by the local entries of A. The
+// overload accepting a plan reuses its symbolic information when marked
+// ready, which assumes that the sparsity patterns of A and B are unchanged
+// since the plan was formed.
+template<typename T>
+void Multiply
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C );
+template<typename T>
+void Multiply
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C,
+        DistSparseMultPlan& plan );
+
+// Multiply a band matrix against a set of vectors (via gbmv)
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const BandMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                Matrix<T>& Y );
+
 // MultiShiftQuasiTrsm
 // ===================
 template<typename F>
@@ -466,6 +649,13 @@ void Trsm
   const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<F>& B,
   bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B );
 
 template<typename F>
 void LocalTrsm
@@ -510,6 +700,16 @@ void Trtrmm
 
 // TwoSidedTrmm
 // ============
+// The blocked sequential two-sided algorithms apply two large updates per
+// panel (a rank-2k update and a panel Gemm) which traverse the same
+// trailing matrix separately; enabling fusion instead sweeps the trailing
+// matrix once per panel and applies both updates to each tile while it is
+// cache-resident. The distributed variants already fuse their trailing
+// updates through LocalTrr2k and are unaffected.
+void EnableFusedTwoSidedUpdates() EL_NO_EXCEPT;
+void DisableFusedTwoSidedUpdates() EL_NO_EXCEPT;
+bool FusedTwoSidedUpdatesEnabled() EL_NO_EXCEPT;
+
 template<typename T>
 void TwoSidedTrmm
 ( UpperOrLower uplo, UnitOrNonUnit diag,
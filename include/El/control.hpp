@@ -77,11 +77,50 @@ void Sylvester
 template<typename F>
 void Sylvester
 ( const ElementalMatrix<F>& A,
-  const ElementalMatrix<F>& B, 
+  const ElementalMatrix<F>& B,
   const ElementalMatrix<F>& C,
-        ElementalMatrix<F>& X, 
+        ElementalMatrix<F>& X,
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+// Bartels-Stewart substitution for inputs which are already upper
+// triangular (e.g., Schur factors): X is returned as the solution of
+//   op(A) X + X op(B) = C,
+// where A and B are upper triangular and op is controlled by the given
+// orientations. The sequential algorithm is a recursive blocked
+// substitution, while the distributed algorithm sweeps a wavefront over
+// the block anti-diagonals of X. A SingularMatrixException is thrown if
+// op(A) and -op(B) share an eigenvalue. Note that real quasi-triangular
+// Schur factors (with 2x2 diagonal blocks) are not supported.
+template<typename F>
+void TriangularSylvester
+( Orientation orientA,
+  Orientation orientB,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X );
+template<typename F>
+void TriangularSylvester
+( Orientation orientA,
+  Orientation orientB,
+  const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X );
+
+// Bartels-Stewart substitution for an upper-triangular A: X is returned
+// as the solution of A X + X A^H = C
+template<typename F>
+void TriangularLyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& C,
+        Matrix<F>& X );
+template<typename F>
+void TriangularLyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X );
+
 } // namespace El
 
 #endif // ifndef EL_CONTROL_HPP
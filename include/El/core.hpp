@@ -17,6 +17,7 @@
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -243,6 +244,8 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/environment/decl.hpp>
 
 #include <El/core/Timer.hpp>
+#include <El/core/Trace.hpp>
+#include <El/core/Profile.hpp>
 #include <El/core/indexing/decl.hpp>
 #include <El/core/imports/blas.hpp>
 #include <El/core/imports/lapack.hpp>
@@ -270,7 +273,10 @@ class DistMatrix;
 
 } // namespace El
 
+#include <El/core/imports/cuda.hpp>
+
 #include <El/core/Matrix/decl.hpp>
+#include <El/core/SparseAssembly.hpp>
 #include <El/core/Graph/decl.hpp>
 #include <El/core/DistMap/decl.hpp>
 #include <El/core/DistGraph/decl.hpp>
@@ -284,6 +290,13 @@ class DistMatrix;
 #include <El/core/Grid.hpp>
 #include <El/core/DistMatrix.hpp>
 #include <El/core/Proxy.hpp>
+#include <El/core/RmaInterface.hpp>
+#include <El/core/NodeSharedReplica.hpp>
+#include <El/core/EnsemblePool.hpp>
+#include <El/core/LazyMatrix.hpp>
+#include <El/core/WorkspaceArena.hpp>
+#include <El/core/BandMatrix.hpp>
+#include <El/core/TileStore.hpp>
 
 // Implement the intertwined parts of the library
 #include <El/core/Element/impl.hpp>
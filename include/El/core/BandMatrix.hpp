@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_BANDMATRIX_HPP
+#define EL_CORE_BANDMATRIX_HPP
+
+namespace El {
+
+// A band matrix stored in the standard LAPACK band layout: entry (i,j) of
+// the underlying height x width matrix resides in row ku+i-j of column j of
+// the (kl+ku+1) x width storage matrix whenever j-ku <= i <= j+kl, where kl
+// and ku are the numbers of sub- and super-diagonals. Entries outside of the
+// band are implicitly zero. A tridiagonal matrix therefore requires only
+// three rows of storage regardless of its dimension, and the layout is
+// directly consumable by the banded BLAS/LAPACK kernels (e.g., gbmv, gbtrf,
+// and pbtrf).
+template<typename Ring>
+class BandMatrix
+{
+public:
+    // Constructors and destructor
+    // ===========================
+    BandMatrix() { }
+    BandMatrix( Int height, Int width, Int lowerBandwidth, Int upperBandwidth )
+    { Resize( height, width, lowerBandwidth, upperBandwidth ); }
+    BandMatrix( const BandMatrix<Ring>& A ) = default;
+    BandMatrix( BandMatrix<Ring>&& A ) = default;
+    ~BandMatrix() { }
+
+    // Assignment
+    // ==========
+    BandMatrix<Ring>& operator=( const BandMatrix<Ring>& A ) = default;
+    BandMatrix<Ring>& operator=( BandMatrix<Ring>&& A ) = default;
+
+    // Reconfiguration
+    // ===============
+    void Empty()
+    {
+        height_ = 0;
+        width_ = 0;
+        lowerBandwidth_ = 0;
+        upperBandwidth_ = 0;
+        bands_.Empty();
+    }
+
+    void Resize( Int height, Int width, Int lowerBandwidth, Int upperBandwidth )
+    {
+        EL_DEBUG_CSE
+        EL_DEBUG_ONLY(
+          if( height < 0 || width < 0 )
+              LogicError("Height and width must be non-negative");
+          if( lowerBandwidth < 0 || upperBandwidth < 0 )
+              LogicError("Bandwidths must be non-negative");
+        )
+        height_ = height;
+        width_ = width;
+        lowerBandwidth_ = lowerBandwidth;
+        upperBandwidth_ = upperBandwidth;
+        bands_.Resize( lowerBandwidth+upperBandwidth+1, width );
+        Zero( bands_ );
+    }
+
+    // Basic queries
+    // =============
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    Int LowerBandwidth() const EL_NO_EXCEPT { return lowerBandwidth_; }
+    Int UpperBandwidth() const EL_NO_EXCEPT { return upperBandwidth_; }
+    // The leading dimension of the band storage, lowerBandwidth+upperBandwidth+1
+    Int LDim() const EL_NO_EXCEPT { return bands_.LDim(); }
+
+    bool InBand( Int i, Int j ) const EL_NO_EXCEPT
+    { return i-j <= lowerBandwidth_ && j-i <= upperBandwidth_; }
+
+    // Direct access to the (kl+ku+1) x width band storage
+    Ring* Buffer() EL_NO_RELEASE_EXCEPT { return bands_.Buffer(); }
+    const Ring* LockedBuffer() const EL_NO_EXCEPT
+    { return bands_.LockedBuffer(); }
+    Matrix<Ring>& Bands() EL_NO_EXCEPT { return bands_; }
+    const Matrix<Ring>& LockedBands() const EL_NO_EXCEPT { return bands_; }
+
+    // Single-entry manipulation
+    // =========================
+    Ring Get( Int i, Int j ) const EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_CSE
+        EL_DEBUG_ONLY(AssertValidEntry( i, j ))
+        if( !InBand(i,j) )
+            return Ring(0);
+        return bands_.Get( upperBandwidth_+i-j, j );
+    }
+
+    void Set( Int i, Int j, const Ring& alpha ) EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_CSE
+        EL_DEBUG_ONLY(AssertValidEntry( i, j ))
+        if( !InBand(i,j) )
+            LogicError
+            ("Entry (",i,",",j,") is outside of the band of width (",
+             lowerBandwidth_,",",upperBandwidth_,")");
+        bands_.Set( upperBandwidth_+i-j, j, alpha );
+    }
+
+    void Update( Int i, Int j, const Ring& alpha ) EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_CSE
+        EL_DEBUG_ONLY(AssertValidEntry( i, j ))
+        if( !InBand(i,j) )
+            LogicError
+            ("Entry (",i,",",j,") is outside of the band of width (",
+             lowerBandwidth_,",",upperBandwidth_,")");
+        bands_.Update( upperBandwidth_+i-j, j, alpha );
+    }
+
+private:
+    Int height_=0, width_=0;
+    Int lowerBandwidth_=0, upperBandwidth_=0;
+    Matrix<Ring> bands_;
+
+    void AssertValidEntry( Int i, Int j ) const
+    {
+        EL_DEBUG_CSE
+        if( i < 0 || j < 0 )
+            LogicError("Indices must be non-negative");
+        if( i >= height_ || j >= width_ )
+            LogicError
+            ("Out of bounds: (",i,",",j,") of ",height_," x ",width_,
+             " band matrix");
+    }
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_BANDMATRIX_HPP
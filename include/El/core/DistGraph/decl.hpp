@@ -32,6 +32,12 @@ struct DistGraphMultMeta
                 recvSizes, recvOffs;
     vector<Int> sendInds, colOffs;
 
+    // The local sources partitioned by whether their edges only reference
+    // locally-owned vector data ('interior') or also require data from other
+    // processes ('halo'), so that normal multiplies can overlap the exchange
+    // of the halo with the multiplication of the interior rows.
+    vector<Int> interiorRows, haloRows;
+
     DistGraphMultMeta() : ready(false), numRecvInds(0) { }
 
     void Clear()
@@ -44,6 +50,8 @@ struct DistGraphMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( interiorRows );
+        SwapClear( haloRows );
     }
 
     const DistGraphMultMeta& operator=( const DistGraphMultMeta& meta )
@@ -56,10 +64,50 @@ struct DistGraphMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        interiorRows = meta.interiorRows;
+        haloRows = meta.haloRows;
         return *this;
     }
 };
 
+// The communication plan for transposing a distributed sparse matrix with
+// this graph: each local edge is bucketed by the owner of its target under
+// the transposed row distribution, and each received edge is permuted
+// directly into its slot in the sorted CSR arrays. Since the plan (and the
+// transposed pattern itself) depends only upon the sparsity pattern, a
+// repeated transpose with a fixed pattern reduces to packing and exchanging
+// the values. As with DistGraphMultMeta, the plan is not automatically
+// invalidated when the pattern is modified.
+struct DistGraphTransposeMeta
+{
+    bool ready;
+    Int numRecvEntries;
+    vector<int> sendSizes, sendOffs,
+                recvSizes, recvOffs;
+    // The slot in the send buffer for each local edge
+    vector<Int> sendSlots;
+    // The slot in the sorted CSR arrays for each received edge
+    vector<Int> recvSlots;
+    // The sorted local sources and targets of the transposed pattern
+    vector<Int> sources, targets;
+
+    DistGraphTransposeMeta() : ready(false), numRecvEntries(0) { }
+
+    void Clear()
+    {
+        ready = false;
+        numRecvEntries = 0;
+        SwapClear( sendSizes );
+        SwapClear( sendOffs );
+        SwapClear( recvSizes );
+        SwapClear( recvOffs );
+        SwapClear( sendSlots );
+        SwapClear( recvSlots );
+        SwapClear( sources );
+        SwapClear( targets );
+    }
+};
+
 
 
 using std::set;
@@ -186,6 +234,8 @@ public:
     mutable DistGraphMultMeta multMeta;
     DistGraphMultMeta InitializeMultMeta() const;
 
+    mutable DistGraphTransposeMeta transposeMeta;
+
     void AssertConsistent() const;
     void AssertLocallyConsistent() const;
 
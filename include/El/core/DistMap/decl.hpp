@@ -39,6 +39,11 @@ public:
     void Translate( vector<Int>& localInds ) const;
     void Translate
     ( vector<Int>& localInds, const vector<int>& origOwners ) const;
+    // Defer a translation so that several index sets can be aggregated into
+    // a single exchange; the queued vectors must remain valid (and should
+    // not be read) until the collective call to ProcessTranslationQueue
+    void QueueTranslation( vector<Int>& localInds ) const;
+    void ProcessTranslationQueue() const;
 
     // composite(i) := second(first(i))
     void Extend( DistMap& firstMap ) const;
@@ -80,7 +85,19 @@ private:
 
     vector<Int> map_;
 
+    // Observing pointers to index sets awaiting a batched translation
+    mutable vector<vector<Int>*> translationQueue_;
+
+    // The request and result of the last translation, so that the repeated
+    // index lists of the sparse-direct pipeline avoid fresh exchanges.
+    // Since Translate is collective, the cache is only used when every
+    // process agrees that its request matches.
+    mutable vector<Int> cachedRequest_, cachedTranslation_;
+    mutable size_t cachedHash_=0;
+    mutable bool cacheValid_=false;
+
     void InitializeLocalData();
+    void InvalidateTranslationCache();
 };
 
 void InvertMap( const vector<Int>& map, vector<Int>& inverseMap );
@@ -87,8 +87,173 @@ FillDesc( const AbstractDistMatrix<scalarType>& A )
           A.ColAlign(), A.RowAlign(), int(A.LDim()) };
     return desc;
 }
+
+// Returns true when a ScaLAPACK descriptor may be constructed directly over
+// A's local buffer: A must be distributed over the (MC,MR) process grid
+// without partial-block offsets. Note that an elemental (MC,MR) matrix is
+// block-cyclic with 1 x 1 blocks and therefore always qualifies, though
+// callers wanting performant ScaLAPACK calls should pre-shape their
+// matrices into block form with this query rather than rely on the
+// (legal but slow) unit block size.
+template<typename scalarType>
+inline bool ScaLAPACKCompatible( const AbstractDistMatrix<scalarType>& A )
+{
+    return A.ColDist() == MC && A.RowDist() == MR &&
+           A.ColCut() == 0 && A.RowCut() == 0;
+}
+
+// View A's local buffer as a block-cyclic matrix without any copying so
+// that the ScaLAPACK wrappers (which demand block distributions) can be
+// invoked on any compatible matrix without paying for a redistribution in
+// and out
+template<typename scalarType>
+inline void AttachScaLAPACKView
+( AbstractDistMatrix<scalarType>& A,
+  DistMatrix<scalarType,MC,MR,BLOCK>& AView )
+{
+    if( !ScaLAPACKCompatible( A ) )
+        LogicError("Matrix layout was not compatible with ScaLAPACK");
+    AView.Attach
+    ( A.Height(), A.Width(), A.Grid(),
+      A.BlockHeight(), A.BlockWidth(),
+      A.ColAlign(), A.RowAlign(), 0, 0,
+      A.Matrix(), A.Root() );
+}
+template<typename scalarType>
+inline void LockedAttachScaLAPACKView
+( const AbstractDistMatrix<scalarType>& A,
+  DistMatrix<scalarType,MC,MR,BLOCK>& AView )
+{
+    if( !ScaLAPACKCompatible( A ) )
+        LogicError("Matrix layout was not compatible with ScaLAPACK");
+    AView.LockedAttach
+    ( A.Height(), A.Width(), A.Grid(),
+      A.BlockHeight(), A.BlockWidth(),
+      A.ColAlign(), A.RowAlign(), 0, 0,
+      A.LockedMatrix(), A.Root() );
+}
 #endif
 
+// Devirtualized local access
+// ==========================
+// Generic code written against AbstractDistMatrix pays a virtual call for
+// every index-mapping query (GlobalRow, RowOwner, etc.), which dominates
+// tight loops over local entries. The descriptors below capture an
+// elemental matrix's distribution parameters and local buffer once so that
+// the same queries inline down to raw integer and pointer arithmetic.
+// They are snapshots: any resize, redistribution, or realignment of the
+// captured matrix invalidates them.
+
+template<typename scalarType>
+struct LocalAccessView
+{
+    scalarType* buffer;
+    Int ldim;
+    Int height, width;
+    Int localHeight, localWidth;
+    Int colShift, rowShift;
+    Int colAlign, rowAlign;
+    Int colStride, rowStride;
+    int colRank, rowRank;
+
+    LocalAccessView( AbstractDistMatrix<scalarType>& A )
+    : buffer(A.Buffer()), ldim(A.LDim()),
+      height(A.Height()), width(A.Width()),
+      localHeight(A.LocalHeight()), localWidth(A.LocalWidth()),
+      colShift(A.ColShift()), rowShift(A.RowShift()),
+      colAlign(A.ColAlign()), rowAlign(A.RowAlign()),
+      colStride(A.ColStride()), rowStride(A.RowStride()),
+      colRank(A.ColRank()), rowRank(A.RowRank())
+    {
+        EL_DEBUG_CSE
+        EL_DEBUG_ONLY(
+          if( A.Wrap() != ELEMENT )
+              LogicError("Local access views require elemental wrapping");
+        )
+    }
+
+    Int GlobalRow( Int iLoc ) const EL_NO_EXCEPT
+    { return colShift + iLoc*colStride; }
+    Int GlobalCol( Int jLoc ) const EL_NO_EXCEPT
+    { return rowShift + jLoc*rowStride; }
+
+    int RowOwner( Int i ) const EL_NO_EXCEPT
+    { return int((i+colAlign) % colStride); }
+    int ColOwner( Int j ) const EL_NO_EXCEPT
+    { return int((j+rowAlign) % rowStride); }
+
+    bool IsLocalRow( Int i ) const EL_NO_EXCEPT
+    { return RowOwner(i) == colRank; }
+    bool IsLocalCol( Int j ) const EL_NO_EXCEPT
+    { return ColOwner(j) == rowRank; }
+    bool IsLocal( Int i, Int j ) const EL_NO_EXCEPT
+    { return IsLocalRow(i) && IsLocalCol(j); }
+
+    // The local row in which global row i resides (only meaningful when
+    // RowOwner(i) == colRank), and similarly for the columns
+    Int GlobalToLocalRow( Int i ) const EL_NO_EXCEPT
+    { return Length_(i,colShift,colStride); }
+    Int GlobalToLocalCol( Int j ) const EL_NO_EXCEPT
+    { return Length_(j,rowShift,rowStride); }
+
+    scalarType& Entry( Int iLoc, Int jLoc ) const EL_NO_EXCEPT
+    { return buffer[iLoc+jLoc*ldim]; }
+};
+
+template<typename scalarType>
+struct LockedLocalAccessView
+{
+    const scalarType* buffer;
+    Int ldim;
+    Int height, width;
+    Int localHeight, localWidth;
+    Int colShift, rowShift;
+    Int colAlign, rowAlign;
+    Int colStride, rowStride;
+    int colRank, rowRank;
+
+    LockedLocalAccessView( const AbstractDistMatrix<scalarType>& A )
+    : buffer(A.LockedBuffer()), ldim(A.LDim()),
+      height(A.Height()), width(A.Width()),
+      localHeight(A.LocalHeight()), localWidth(A.LocalWidth()),
+      colShift(A.ColShift()), rowShift(A.RowShift()),
+      colAlign(A.ColAlign()), rowAlign(A.RowAlign()),
+      colStride(A.ColStride()), rowStride(A.RowStride()),
+      colRank(A.ColRank()), rowRank(A.RowRank())
+    {
+        EL_DEBUG_CSE
+        EL_DEBUG_ONLY(
+          if( A.Wrap() != ELEMENT )
+              LogicError("Local access views require elemental wrapping");
+        )
+    }
+
+    Int GlobalRow( Int iLoc ) const EL_NO_EXCEPT
+    { return colShift + iLoc*colStride; }
+    Int GlobalCol( Int jLoc ) const EL_NO_EXCEPT
+    { return rowShift + jLoc*rowStride; }
+
+    int RowOwner( Int i ) const EL_NO_EXCEPT
+    { return int((i+colAlign) % colStride); }
+    int ColOwner( Int j ) const EL_NO_EXCEPT
+    { return int((j+rowAlign) % rowStride); }
+
+    bool IsLocalRow( Int i ) const EL_NO_EXCEPT
+    { return RowOwner(i) == colRank; }
+    bool IsLocalCol( Int j ) const EL_NO_EXCEPT
+    { return ColOwner(j) == rowRank; }
+    bool IsLocal( Int i, Int j ) const EL_NO_EXCEPT
+    { return IsLocalRow(i) && IsLocalCol(j); }
+
+    Int GlobalToLocalRow( Int i ) const EL_NO_EXCEPT
+    { return Length_(i,colShift,colStride); }
+    Int GlobalToLocalCol( Int j ) const EL_NO_EXCEPT
+    { return Length_(j,rowShift,rowStride); }
+
+    const scalarType& Entry( Int iLoc, Int jLoc ) const EL_NO_EXCEPT
+    { return buffer[iLoc+jLoc*ldim]; }
+};
+
 template<typename scalarType>
 inline void AssertSameGrids( const AbstractDistMatrix<scalarType>& A ) { }
 
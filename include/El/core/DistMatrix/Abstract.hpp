@@ -61,6 +61,28 @@ public:
 
     void SetRoot( int root, bool constrain=true );
 
+    // Proxy caching
+    // =============
+    // An opt-in cache of redistributed replicas of this matrix so that
+    // read-only proxies with an identical target distribution (e.g., those
+    // repeatedly formed within a loop of matrix-vector multiplications with
+    // a fixed matrix) need not be re-formed on every call. Writes through
+    // this matrix's standard interface invalidate the cache, but writes
+    // through views or previously extracted local buffers cannot be
+    // detected and require a manual call to InvalidateProxyCache.
+    // Invalidation deletes the cached replicas, so no proxy formed from
+    // this matrix may outlive a write to it.
+    void EnableProxyCache() const EL_NO_EXCEPT;
+    void DisableProxyCache() const EL_NO_EXCEPT;
+    void InvalidateProxyCache() const EL_NO_EXCEPT;
+    bool ProxyCacheEnabled() const EL_NO_EXCEPT;
+    type* SearchProxyCache
+    ( Dist colDist, Dist rowDist, DistWrap wrap,
+      bool colConstrain, int colAlign,
+      bool rowConstrain, int rowAlign,
+      bool rootConstrain, int root ) const;
+    void DonateToProxyCache( type* replica ) const;
+
     // Operator overloading
     // ====================
 
@@ -228,8 +250,21 @@ public:
     void Reserve( Int numRemoteEntries );
     void QueueUpdate( const Entry<Ring>& entry ) EL_NO_RELEASE_EXCEPT;
     void QueueUpdate( Int i, Int j, Ring value ) EL_NO_RELEASE_EXCEPT;
+    void QueueUpdateSubmatrix
+    ( Int iBeg, Int jBeg, Ring alpha, const El::Matrix<Ring>& ASub )
+    EL_NO_RELEASE_EXCEPT;
     void ProcessQueues( bool includeViewers=true );
 
+    // Accumulation epochs
+    // -------------------
+    // While an epoch is open, Update (which otherwise silently ignores
+    // remotely-owned entries) and UpdateSubmatrix route their contributions
+    // into the remote update queue, which EndAccumulation flushes with a
+    // single sorted exchange and local merge.
+    void BeginAccumulation( Int numRemoteEntries=0 );
+    void EndAccumulation( bool includeViewers=true );
+    bool Accumulating() const EL_NO_EXCEPT;
+
     // Batch extraction of remote entries
     // ----------------------------------
     void ReservePulls( Int numPulls ) const;
@@ -333,6 +368,14 @@ protected:
     //       require separate MPI wrappers from ValueInt<Int>
     mutable vector<ValueInt<Int>> remotePulls_;
 
+    // Whether an accumulation epoch is currently open
+    bool accumulating_=false;
+
+    // Proxy cache
+    // -----------
+    mutable bool proxyCacheEnabled_=false;
+    mutable vector<type*> proxyCache_;
+
     // Protected constructors
     // ======================
     // Create a 0 x 0 distributed matrix
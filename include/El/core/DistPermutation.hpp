@@ -142,6 +142,20 @@ public:
     ( AbstractDistMatrix<T>& A,
       Int offset=0 ) const;
 
+    // Apply the same row permutation to a group of matrices which share a
+    // grid and column alignment so that the communication plan is only
+    // constructed once and the pivot rows of the entire group travel in a
+    // single exchange (groups which do not satisfy said constraints are
+    // transparently handled one matrix at a time)
+    template<typename T>
+    void PermuteRows
+    ( const vector<AbstractDistMatrix<T>*>& As,
+      Int offset=0 ) const;
+    template<typename T>
+    void InversePermuteRows
+    ( const vector<AbstractDistMatrix<T>*>& As,
+      Int offset=0 ) const;
+
     template<typename T>
     void PermuteSymmetrically
     ( UpperOrLower uplo,
@@ -162,6 +176,17 @@ public:
     void ExplicitMatrix( AbstractDistMatrix<Int>& P ) const;
 
 private:
+    // Compose a swap sequence into the explicit permutation vectors without
+    // abandoning the swap representation (which remains necessary for
+    // offset and symmetric applications) so that offset-zero applications
+    // can be coalesced into a single AllToAll through the cached plans
+    void ComposeSwaps() const;
+
+    // Retrieve (building and caching if necessary) the communication plan
+    // for the given alignment and communicator
+    PermutationMeta& RowPlan( Int align, mpi::Comm comm ) const;
+    PermutationMeta& ColPlan( Int align, mpi::Comm comm ) const;
+
     Int size_=0;
     const Grid* grid_;
     mutable bool parity_=false;
@@ -178,6 +203,8 @@ private:
     mutable Int numSwaps_=0;
     mutable bool implicitSwapOrigins_=true;
     mutable DistMatrix<Int,VC,STAR> swapDests_, swapOrigins_;
+    // Whether perm_ no longer reflects the composition of the swap sequence
+    mutable bool staleComposition_=true;
 
     // Only used if swapSequence_=false
     // --------------------------------
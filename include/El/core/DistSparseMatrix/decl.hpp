@@ -55,6 +55,13 @@ public:
     // --------
     void Reserve( Int numLocalEntries, Int numRemoteEntries=0 );
 
+    // Adopt the sparsity pattern of an already-assembled matrix (zeroing the
+    // values) and freeze it, so that repeated assemblies with a fixed pattern
+    // apply their updates directly to the stored values and skip the sorting
+    // performed by ProcessQueues. Passing the matrix itself is allowed and
+    // simply zeroes the values of the current pattern.
+    void ReservePattern( const DistSparseMatrix<Ring>& pattern );
+
     void FreezeSparsity() EL_NO_EXCEPT;
     void UnfreezeSparsity() EL_NO_EXCEPT;
     bool FrozenSparsity() const EL_NO_EXCEPT;
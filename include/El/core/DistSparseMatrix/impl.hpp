@@ -111,6 +111,25 @@ void DistSparseMatrix<Ring>::Reserve( Int numLocalEntries, Int numRemoteEntries
     remoteVals_.reserve( currRemoteSize+numRemoteEntries );
 }
 
+template<typename Ring>
+void DistSparseMatrix<Ring>::ReservePattern
+( const DistSparseMatrix<Ring>& pattern )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !pattern.LocallyConsistent() )
+          LogicError("Pattern matrix must be locally consistent");
+    )
+    if( this != &pattern )
+    {
+        distGraph_ = pattern.distGraph_;
+        vals_.resize( pattern.vals_.size() );
+    }
+    std::fill( vals_.begin(), vals_.end(), Ring(0) );
+    SwapClear( remoteVals_ );
+    FreezeSparsity();
+}
+
 template<typename Ring>
 void DistSparseMatrix<Ring>::FreezeSparsity() EL_NO_EXCEPT
 { distGraph_.frozenSparsity_ = true; }
@@ -333,63 +352,38 @@ void DistSparseMatrix<Ring>::ProcessLocalQueues()
     if( distGraph_.locallyConsistent_ )
         return;
 
-    Int numRemoved = 0;
-    const Int numLocalEntries = vals_.size();
-    vector<Entry<Ring>> entries( numLocalEntries );
+    // Filter out any entries marked for removal
+    // -----------------------------------------
     if( distGraph_.markedForRemoval_.size() != 0 )
     {
-        for( Int s=0; s<numLocalEntries; ++s )
+        const Int numQueued = vals_.size();
+        Int numKept = 0;
+        for( Int s=0; s<numQueued; ++s )
         {
             pair<Int,Int> candidate(distGraph_.sources_[s],
                                     distGraph_.targets_[s]);
             if( distGraph_.markedForRemoval_.find(candidate) ==
                 distGraph_.markedForRemoval_.end() )
             {
-                entries[s-numRemoved].i = distGraph_.sources_[s];
-                entries[s-numRemoved].j = distGraph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
+                distGraph_.sources_[numKept] = distGraph_.sources_[s];
+                distGraph_.targets_[numKept] = distGraph_.targets_[s];
+                vals_[numKept] = vals_[s];
+                ++numKept;
             }
         }
         SwapClear( distGraph_.markedForRemoval_ );
-        entries.resize( numLocalEntries-numRemoved );
-    }
-    else
-    {
-        for( Int s=0; s<numLocalEntries; ++s )
-            entries[s] = Entry<Ring>{distGraph_.sources_[s],
-                                  distGraph_.targets_[s],vals_[s]};
-    }
-    std::sort( entries.begin(), entries.end(), CompareEntries );
-    const Int numSorted = entries.size();
-
-    // Combine duplicates
-    // ------------------
-    Int lastUnique=0;
-    for( Int s=1; s<numSorted; ++s )
-    {
-        if( entries[s].i != entries[lastUnique].i ||
-            entries[s].j != entries[lastUnique].j )
-            entries[++lastUnique] = entries[s];
-        else
-            entries[lastUnique].value += entries[s].value;
+        distGraph_.sources_.resize( numKept );
+        distGraph_.targets_.resize( numKept );
+        vals_.resize( numKept );
     }
-    const Int numUnique = lastUnique+1;
 
-    entries.resize( numUnique );
-    distGraph_.sources_.resize( numUnique );
-    distGraph_.targets_.resize( numUnique );
-    vals_.resize( numUnique );
-    for( Int s=0; s<numUnique; ++s )
-    {
-        distGraph_.sources_[s] = entries[s].i;
-        distGraph_.targets_[s] = entries[s].j;
-        vals_[s] = entries[s].value;
-    }
-    distGraph_.ComputeSourceOffsets();
+    // Bucket the local entries by row (the most significant key) in a
+    // single counting pass, sort each row by column and combine its
+    // duplicates in parallel, and recover the offsets from the bucket scan
+    sparse_assembly::SortAndCompress
+    ( FirstLocalRow(), LocalHeight(),
+      distGraph_.sources_, distGraph_.targets_, vals_,
+      distGraph_.localSourceOffsets_ );
     distGraph_.locallyConsistent_ = true;
 }
 
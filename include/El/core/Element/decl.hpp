@@ -152,6 +152,38 @@ template<typename Real> struct PromoteHelper<Complex<Real>>
 
 template<typename Field> using Promote = typename PromoteHelper<Field>::type;
 
+// Decrease the precision (if possible)
+// ------------------------------------
+// This is the inverse of the above promotion map and is meant for
+// mixed-precision algorithms which factor in a lower precision and then
+// refine in the working precision
+template<typename Field> struct DemoteHelper { typedef Field type; };
+template<> struct DemoteHelper<double> { typedef float type; };
+
+#ifdef EL_HAVE_QD
+template<> struct DemoteHelper<DoubleDouble> { typedef double type; };
+template<> struct DemoteHelper<QuadDouble> { typedef DoubleDouble type; };
+#endif
+
+#ifdef EL_HAVE_QUAD
+template<> struct DemoteHelper<Quad> { typedef double type; };
+#endif
+
+#ifdef EL_HAVE_MPC
+#ifdef EL_HAVE_QD
+template<> struct DemoteHelper<BigFloat> { typedef QuadDouble type; };
+#elif defined(EL_HAVE_QUAD)
+template<> struct DemoteHelper<BigFloat> { typedef Quad type; };
+#else
+template<> struct DemoteHelper<BigFloat> { typedef double type; };
+#endif
+#endif
+
+template<typename Real> struct DemoteHelper<Complex<Real>>
+{ typedef Complex<typename DemoteHelper<Real>::type> type; };
+
+template<typename Field> using Demote = typename DemoteHelper<Field>::type;
+
 template<typename S,typename T>
 struct CanCast
 {
@@ -1034,6 +1066,19 @@ template<> BigInt Floor( const BigInt& alpha );
 template<> BigFloat Floor( const BigFloat& alpha );
 #endif
 
+// Fused multiply-add
+// ==================
+// Update gamma += alpha*beta, with a single rounding where supported
+// (for BigFloat, mpfr_fma avoids the temporaries behind the product and sum)
+template<typename Field,
+         typename=EnableIf<IsScalar<Field>>>
+void FusedMultiplyAdd
+( const Field& alpha, const Field& beta, Field& gamma );
+#ifdef EL_HAVE_MPC
+void FusedMultiplyAdd
+( const BigFloat& alpha, const BigFloat& beta, BigFloat& gamma );
+#endif
+
 // Two-norm formation
 // ==================
 // TODO(poulson): Move this somewhere more fitting; perhaps in blas_like/
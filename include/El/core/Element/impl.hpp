@@ -775,6 +775,13 @@ template<typename Real>
 Complex<Real> Floor( const Complex<Real>& alpha )
 { return Complex<Real>(Floor(alpha.real()),Floor(alpha.imag())); }
 
+// Fused multiply-add
+// ==================
+template<typename F,
+         typename/*=EnableIf<IsScalar<F>>*/>
+void FusedMultiplyAdd( const F& alpha, const F& beta, F& gamma )
+{ gamma += alpha*beta; }
+
 // Two-norm formation
 // ==================
 template<typename F,
@@ -0,0 +1,185 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_ENSEMBLEPOOL_HPP
+#define EL_CORE_ENSEMBLEPOOL_HPP
+
+namespace El {
+
+// Ensemble execution over a pool of worker subgrids
+// =================================================
+// Solving many independent medium-size problems by launching one MPI job
+// per problem pays the launch and Grid setup cost for every solve, while
+// running them back-to-back on the full grid wastes the parallelism past
+// each problem's scaling limit. An EnsemblePool instead partitions a
+// parent grid once into a pool of worker subgrids and dynamically deals a
+// bag of tasks across them: each worker repeatedly claims the next
+// unsolved task from a shared atomic ticket counter hosted on the
+// parent's root, so a subgrid that finishes early immediately takes over
+// work that would otherwise have queued behind a slow worker (the
+// dynamic-scheduling analogue of stealing from a static assignment).
+//
+// The constructor, destructor, StartTasks, Run, and the scatter/gather
+// helpers are collective over the parent grid; claiming a task is
+// collective only over the claiming worker's subgrid. The worker grids
+// follow the viewer/owner subgrid construction used by the SDC Schur
+// splitting, so redistributions between the parent grid and any worker
+// grid involve every parent process.
+
+class EnsemblePool
+{
+public:
+    EnsemblePool( const Grid& grid, int numWorkers )
+    : parentGrid_(&grid)
+    {
+        EL_DEBUG_CSE
+        const int p = grid.Size();
+        const int poolSize = Max( Min( numWorkers, p ), 1 );
+        const int rank = grid.Rank();
+        mpi::Group owningGroup = grid.OwningGroup();
+        workerGrids_.resize( poolSize );
+        for( int worker=0; worker<poolSize; ++worker )
+        {
+            const int beg = (worker*p) / poolSize;
+            const int end = ((worker+1)*p) / poolSize;
+            const int size = end - beg;
+            vector<int> ranks(size);
+            for( int q=0; q<size; ++q )
+                ranks[q] = beg + q;
+            mpi::Group workerGroup;
+            mpi::Incl( owningGroup, size, ranks.data(), workerGroup );
+            workerGrids_[worker].reset
+            ( new Grid
+              ( grid.VCComm(), workerGroup, Grid::DefaultHeight(size) ) );
+            mpi::Free( workerGroup );
+            if( rank >= beg && rank < end )
+                myWorker_ = worker;
+        }
+        mpi::WindowCreate
+        ( &counter_, ( rank == 0 ? sizeof(Int) : 0 ),
+          grid.VCComm(), window_ );
+    }
+
+    ~EnsemblePool() { mpi::WindowFree( window_ ); }
+
+    int NumWorkers() const EL_NO_EXCEPT
+    { return int(workerGrids_.size()); }
+    int Worker() const EL_NO_EXCEPT { return myWorker_; }
+    const Grid& ParentGrid() const EL_NO_EXCEPT { return *parentGrid_; }
+    const Grid& WorkerGrid() const EL_NO_EXCEPT
+    { return *workerGrids_[myWorker_]; }
+    const Grid& WorkerGrid( int worker ) const EL_NO_EXCEPT
+    { return *workerGrids_[worker]; }
+
+    // Reset the shared ticket counter for a bag of numTasks tasks
+    void StartTasks( Int numTasks )
+    {
+        EL_DEBUG_CSE
+        numTasks_ = numTasks;
+        if( parentGrid_->Rank() == 0 )
+        {
+            // An exclusive self-lock separates this reset from the atomic
+            // increments of any previous bag
+            mpi::WindowLock( 0, window_, false );
+            counter_ = 0;
+            mpi::WindowUnlock( 0, window_ );
+        }
+        mpi::Barrier( parentGrid_->VCComm() );
+    }
+
+    // Claim the next unsolved task (collective over the worker subgrid);
+    // returns false once the bag is empty
+    bool TryPopTask( Int& task )
+    {
+        EL_DEBUG_CSE
+        const Grid& workerGrid = WorkerGrid();
+        Int ticket = numTasks_;
+        if( workerGrid.Rank() == 0 )
+        {
+            // Fetch-and-op increments are atomic under a shared lock, so
+            // concurrently claiming workers receive distinct tickets
+            mpi::WindowLock( 0, window_ );
+            ticket = mpi::FetchAndAdd( Int(1), 0, 0, window_ );
+            mpi::WindowUnlock( 0, window_ );
+        }
+        mpi::Broadcast( ticket, 0, workerGrid.VCComm() );
+        if( ticket >= numTasks_ )
+            return false;
+        task = ticket;
+        return true;
+    }
+
+    // Claim-and-solve loop over a bag of tasks: every worker repeatedly
+    // claims a task index and invokes taskFunction(task,workerGrid) on its
+    // subgrid until the bag is empty
+    template<class TaskFunction>
+    void Run( Int numTasks, const TaskFunction& taskFunction )
+    {
+        EL_DEBUG_CSE
+        StartTasks( numTasks );
+        Int task;
+        while( TryPopTask( task ) )
+            taskFunction( task, WorkerGrid() );
+        mpi::Barrier( parentGrid_->VCComm() );
+    }
+
+    // Push a parent-grid operand shared by every task onto each worker
+    // subgrid; AWorker must be distributed over the caller's WorkerGrid()
+    template<typename T>
+    void ReplicateToWorkers
+    ( const DistMatrix<T>& A, DistMatrix<T>& AWorker ) const
+    {
+        EL_DEBUG_CSE
+        const int poolSize = NumWorkers();
+        for( int worker=0; worker<poolSize; ++worker )
+        {
+            // Every parent process participates in each redistribution but
+            // only retains its own worker's copy
+            if( worker == myWorker_ )
+            {
+                AWorker = A;
+            }
+            else
+            {
+                DistMatrix<T> AScratch( *workerGrids_[worker] );
+                AScratch = A;
+            }
+        }
+    }
+
+    // Sum the per-task result rows into a copy replicated over the parent
+    // grid: each worker fills in the rows of the tasks it solved (leaving
+    // the others zero), and only the contribution of each subgrid's rank
+    // zero survives the reduction, so results replicated within a subgrid
+    // are not double-counted
+    template<typename T>
+    void GatherResults( Matrix<T>& results ) const
+    {
+        EL_DEBUG_CSE
+        const Int height = results.Height();
+        const Int width = results.Width();
+        if( WorkerGrid().Rank() != 0 )
+            Zero( results );
+        for( Int j=0; j<width; ++j )
+            mpi::AllReduce
+            ( results.Buffer(0,j), height, mpi::SUM,
+              parentGrid_->VCComm() );
+    }
+
+private:
+    const Grid* parentGrid_;
+    vector<unique_ptr<Grid>> workerGrids_;
+    int myWorker_=0;
+    Int numTasks_=0;
+    Int counter_=0; // the ticket counter, hosted at parent rank zero
+    mpi::Window window_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_ENSEMBLEPOOL_HPP
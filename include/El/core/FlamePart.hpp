@@ -10,6 +10,7 @@
 #define EL_FLAMEPART_HPP
 
 #include <El/core/FlamePart/Merge.hpp>
+#include <El/core/FlamePart/Spans.hpp>
 #include <El/core/FlamePart/Partition.hpp>
 #include <El/core/FlamePart/Repartition.hpp>
 #include <El/core/FlamePart/SlidePartition.hpp>
@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FLAMEPART_SPANS_HPP
+#define EL_FLAMEPART_SPANS_HPP
+
+namespace El {
+
+// Lightweight analogues of the FLAME-style traversal routines: the
+// Partition/Repartition helpers (and Range-based indexing) construct full
+// Matrix view objects for every loop iteration, whose bookkeeping is
+// visible next to small panel kernels. The descriptors below are
+// plain-old-data spans whose repartition arithmetic is inlined and whose
+// assertions compile out in release mode; a fixed set of Matrix views can
+// be reattached to them when a kernel interface demands one. Blocked
+// algorithms are free to adopt them incrementally, since the spans
+// describe exactly the same submatrices as the traversal macros.
+
+template<typename T>
+struct MatrixSpan
+{
+    T* buffer;
+    Int height, width, ldim;
+
+    T* Offset( Int i, Int j ) const EL_NO_EXCEPT
+    { return &buffer[i+j*ldim]; }
+
+    MatrixSpan<T> Sub( Int i, Int j, Int h, Int w ) const
+      EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(
+          if( i < 0 || j < 0 || h < 0 || w < 0 ||
+              i+h > height || j+w > width )
+              LogicError
+              ("Subspan (",i,",",j,") x (",h,",",w,") of a ",
+               height," x ",width," span is out of bounds");
+        )
+        return MatrixSpan<T>{ &buffer[i+j*ldim], h, w, ldim };
+    }
+
+    // Reattach an existing Matrix as a view of this span (the matrix is
+    // reconfigured in place, so no per-iteration construction is needed)
+    void View( Matrix<T>& A ) const
+    { A.Attach( height, width, buffer, ldim ); }
+    void LockedView( Matrix<T>& A ) const
+    { A.LockedAttach( height, width, buffer, ldim ); }
+};
+
+template<typename T>
+MatrixSpan<T> FullSpan( Matrix<T>& A ) EL_NO_EXCEPT
+{ return MatrixSpan<T>{ A.Buffer(), A.Height(), A.Width(), A.LDim() }; }
+
+// A cursor over the diagonal of a square span which plays the role of the
+// [Locked]RepartitionDownDiagonal/SlidePartitionDownDiagonal pair: the
+// (beg,size) pair describes the current diagonal block, and the usual
+// FLAME quadrants are recovered with inline arithmetic
+template<typename T>
+struct DiagonalBlockCursor
+{
+    MatrixSpan<T> matrix;
+    Int beg, size;
+
+    bool Done() const EL_NO_EXCEPT { return beg >= matrix.height; }
+
+    void Slide( Int blocksize ) EL_NO_EXCEPT
+    {
+        beg += size;
+        size = Min( blocksize, matrix.height-beg );
+    }
+
+    MatrixSpan<T> Block10() const EL_NO_RELEASE_EXCEPT
+    { return matrix.Sub( beg, 0, size, beg ); }
+    MatrixSpan<T> Block01() const EL_NO_RELEASE_EXCEPT
+    { return matrix.Sub( 0, beg, beg, size ); }
+    MatrixSpan<T> Block11() const EL_NO_RELEASE_EXCEPT
+    { return matrix.Sub( beg, beg, size, size ); }
+    MatrixSpan<T> Block21() const EL_NO_RELEASE_EXCEPT
+    { return matrix.Sub( beg+size, beg, matrix.height-(beg+size), size ); }
+    MatrixSpan<T> Block12() const EL_NO_RELEASE_EXCEPT
+    { return matrix.Sub( beg, beg+size, size, matrix.width-(beg+size) ); }
+    MatrixSpan<T> Block22() const EL_NO_RELEASE_EXCEPT
+    {
+        return matrix.Sub
+        ( beg+size, beg+size,
+          matrix.height-(beg+size), matrix.width-(beg+size) );
+    }
+};
+
+template<typename T>
+DiagonalBlockCursor<T>
+BeginDiagonalTraversal( const MatrixSpan<T>& span, Int blocksize )
+  EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_ONLY(
+      if( span.height != span.width )
+          LogicError("Diagonal traversals require square spans");
+    )
+    return DiagonalBlockCursor<T>{ span, 0, Min(blocksize,span.height) };
+}
+
+} // namespace El
+
+#endif // ifndef EL_FLAMEPART_SPANS_HPP
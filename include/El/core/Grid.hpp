@@ -28,10 +28,10 @@ public:
     int Size() const EL_NO_EXCEPT;         // VCSize() and VRSize()
     int Rank() const EL_NO_RELEASE_EXCEPT; // same as OwningRank()
     GridOrder Order() const EL_NO_EXCEPT;  // either COLUMN_MAJOR or ROW_MAJOR
-    mpi::Comm ColComm() const EL_NO_EXCEPT; // MCComm()
-    mpi::Comm RowComm() const EL_NO_EXCEPT; // MRComm()
+    mpi::Comm ColComm() const EL_NO_RELEASE_EXCEPT; // MCComm()
+    mpi::Comm RowComm() const EL_NO_RELEASE_EXCEPT; // MRComm()
     // VCComm (VRComm) if COLUMN_MAJOR (ROW_MAJOR)
-    mpi::Comm Comm() const EL_NO_EXCEPT;
+    mpi::Comm Comm() const EL_NO_RELEASE_EXCEPT;
 
     // Distribution-based interface
     int MCRank() const EL_NO_RELEASE_EXCEPT;
@@ -48,12 +48,14 @@ public:
     int VCSize() const EL_NO_EXCEPT;
     int VRSize() const EL_NO_EXCEPT;
 
-    mpi::Comm MCComm() const EL_NO_EXCEPT;
-    mpi::Comm MRComm() const EL_NO_EXCEPT;
-    mpi::Comm VCComm() const EL_NO_EXCEPT;
-    mpi::Comm VRComm() const EL_NO_EXCEPT;
-    mpi::Comm MDComm() const EL_NO_EXCEPT;
-    mpi::Comm MDPerpComm() const EL_NO_EXCEPT;
+    // The distribution communicators are constructed on first access
+    // (see SetUpCommunicators), so these may perform MPI calls
+    mpi::Comm MCComm() const EL_NO_RELEASE_EXCEPT;
+    mpi::Comm MRComm() const EL_NO_RELEASE_EXCEPT;
+    mpi::Comm VCComm() const EL_NO_RELEASE_EXCEPT;
+    mpi::Comm VRComm() const EL_NO_RELEASE_EXCEPT;
+    mpi::Comm MDComm() const EL_NO_RELEASE_EXCEPT;
+    mpi::Comm MDPerpComm() const EL_NO_RELEASE_EXCEPT;
 
     // Advanced routines
     explicit Grid
@@ -101,6 +103,18 @@ public:
     static const Grid& Default() EL_NO_RELEASE_EXCEPT;
     static const Grid& Trivial() EL_NO_RELEASE_EXCEPT;
 
+    // Return a process-wide cached grid, creating (and retaining) it on the
+    // first request so that repeatedly building an identical grid for
+    // independent subproblems reduces to a lookup rather than a fresh set of
+    // communicator constructions. The cache is keyed on the communicator
+    // *handle*, so the parent communicator should outlive its cache entries;
+    // the cache itself is emptied by ClearCache (called from Finalize).
+    static const Grid& FindOrCreate
+    ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR );
+    static const Grid& FindOrCreate
+    ( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR );
+    static void ClearCache();
+
 private:
     bool haveViewers_;
     int height_, size_, gcd_;
@@ -117,11 +131,14 @@ private:
                owningGroup_;
 
     mpi::Comm viewingComm_,
-              owningComm_,
-              cartComm_, 
-              mcComm_, mrComm_,
-              mdComm_, mdPerpComm_,
-              vcComm_, vrComm_;
+              owningComm_;
+
+    // Lazily constructed on first access (see SetUpCommunicators)
+    mutable bool setUpComms_;
+    mutable mpi::Comm cartComm_,
+                      mcComm_, mrComm_,
+                      mdComm_, mdPerpComm_,
+                      vcComm_, vrComm_;
 
     int viewingRank_,
         owningRank_,
@@ -135,6 +152,7 @@ private:
 #endif
 
     void SetUpGrid();
+    void SetUpCommunicators() const;
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
@@ -0,0 +1,88 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_LAZYMATRIX_HPP
+#define EL_CORE_LAZYMATRIX_HPP
+
+namespace El {
+
+// A generator view of a matrix: the dimensions together with a function
+// mapping global indices to entries. Structured operands (e.g., a 1M x 1M
+// Fourier matrix) can be handed to consumers through this view and
+// materialized one tile at a time, so that the full matrix never needs to
+// exist in memory. Distributed materialization computes each local entry
+// directly from its global indices on the owning rank, with no
+// communication.
+template<typename T>
+class LazyMatrix
+{
+public:
+    LazyMatrix() { }
+    LazyMatrix( Int height, Int width, function<T(Int,Int)> entry )
+    : height_(height), width_(width), entry_(std::move(entry))
+    { }
+
+    void Reset( Int height, Int width, function<T(Int,Int)> entry )
+    {
+        height_ = height;
+        width_ = width;
+        entry_ = std::move(entry);
+    }
+
+    Int Height() const { return height_; }
+    Int Width() const { return width_; }
+
+    T Get( Int i, Int j ) const
+    {
+        EL_DEBUG_ONLY(
+          if( i < 0 || i >= height_ || j < 0 || j >= width_ )
+              LogicError
+              ("Entry (",i,",",j,") of ",height_," x ",width_,
+               " lazy matrix is out of bounds");
+        )
+        return entry_(i,j);
+    }
+
+    // Evaluate the tile with global upper-left corner (iBeg,jBeg)
+    void MaterializeTile
+    ( Int iBeg, Int jBeg, Int height, Int width, Matrix<T>& ATile ) const
+    {
+        EL_DEBUG_ONLY(
+          if( iBeg+height > height_ || jBeg+width > width_ )
+              LogicError("Requested tile does not fit in the lazy matrix");
+        )
+        ATile.Resize( height, width );
+        for( Int j=0; j<width; ++j )
+            for( Int i=0; i<height; ++i )
+                ATile(i,j) = entry_(iBeg+i,jBeg+j);
+    }
+
+    void Materialize( Matrix<T>& A ) const
+    { MaterializeTile( 0, 0, height_, width_, A ); }
+
+    void Materialize( AbstractDistMatrix<T>& A ) const
+    {
+        A.Resize( height_, width_ );
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                A.SetLocal( iLoc, jLoc, entry_(A.GlobalRow(iLoc),j) );
+        }
+    }
+
+private:
+    Int height_=0, width_=0;
+    function<T(Int,Int)> entry_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_LAZYMATRIX_HPP
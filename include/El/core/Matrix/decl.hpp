@@ -9,6 +9,8 @@
 #ifndef EL_MATRIX_DECL_HPP
 #define EL_MATRIX_DECL_HPP
 
+#include <memory>
+
 #include <El/core/Grid.hpp>
 
 namespace El {
@@ -71,6 +73,14 @@ public:
     // Force the size to remain constant (but allow the entries to be modified).
     void FixSize() EL_NO_EXCEPT;
 
+    // Set the NUMA placement policy applied to subsequent buffer allocations
+    // (the policy of an existing buffer cannot be changed without migration)
+    void SetNumaPolicy( NumaPolicy policy ) EL_NO_EXCEPT;
+
+    // Set the huge-page policy applied to subsequent buffer allocations
+    // (an existing buffer keeps the page size it was mapped with)
+    void SetHugePagePolicy( HugePagePolicy policy ) EL_NO_EXCEPT;
+
     // Operator overloading
     // ====================
 
@@ -121,6 +131,8 @@ public:
     bool Viewing()   const EL_NO_EXCEPT;
     bool FixedSize() const EL_NO_EXCEPT;
     bool Locked()    const EL_NO_EXCEPT;
+    // Whether the buffer is shared with another matrix via copy-on-write
+    bool Shared()    const EL_NO_EXCEPT;
     // Advanced
     // --------
     void SetViewType( El::ViewType viewType ) EL_NO_EXCEPT;
@@ -175,7 +187,12 @@ private:
     El::ViewType viewType_=OWNER;
     Int height_=0, width_=0, leadingDimension_=1;
 
-    Memory<Ring> memory_;
+    // The memory is marked mutable so that assignment from a const source
+    // may promote its buffer into shared (copy-on-write) ownership
+    mutable Memory<Ring> memory_;
+    // Engaged if and only if the buffer is shared via copy-on-write
+    // (see MatrixCopyOnWriteEnabled)
+    mutable std::shared_ptr<Memory<Ring>> sharedMemory_;
     // Const-correctness is internally managed to avoid the need for storing
     // two separate pointers with different 'const' attributes
     Ring* data_=nullptr;
@@ -184,6 +201,13 @@ private:
     // =====================================
     void ShallowSwap( Matrix<Ring>& A );
 
+    // Copy-on-write management
+    // ========================
+    // Share the buffer of A and defer any deep copy until a mutable access
+    void ShareWith_( const Matrix<Ring>& A );
+    // Regain exclusive ownership of the buffer, deep copying if necessary
+    void EnsureUnique_();
+
     // Reconfigure without error-checking
     // ==================================
     void Empty_( bool freeMemory=true );
@@ -236,6 +260,42 @@ private:
     int RowAlign() const EL_NO_EXCEPT;
 };
 
+// A matrix of compile-time shape whose entries live directly on the stack
+// rather than in a heap-backed Memory<Ring> buffer. It is implemented as a
+// pre-attached, fixed-size view of its own internal array, and may therefore
+// be passed to any routine expecting a Matrix (or sliced into further views).
+// It is meant as a drop-in replacement for the small temporaries of kernels
+// which are invoked O(n^2) times per factorization or solve, e.g., the 2x2
+// transformations and the secular equation solvers, where the allocation and
+// deallocation of a 2x2 or 3x1 workspace can rival the arithmetic in cost.
+template<typename Ring,Int HEIGHT,Int WIDTH>
+class StaticMatrix : public Matrix<Ring>
+{
+public:
+    StaticMatrix()
+    {
+        this->Attach( HEIGHT, WIDTH, buffer_, HEIGHT );
+        this->FixSize();
+    }
+    StaticMatrix( const StaticMatrix<Ring,HEIGHT,WIDTH>& A )
+    : StaticMatrix()
+    { Matrix<Ring>::operator=( A ); }
+    // Deep-copy the entries of a (conformal) dynamically-sized matrix
+    explicit StaticMatrix( const Matrix<Ring>& A )
+    : StaticMatrix()
+    { Matrix<Ring>::operator=( A ); }
+
+    const StaticMatrix<Ring,HEIGHT,WIDTH>&
+    operator=( const StaticMatrix<Ring,HEIGHT,WIDTH>& A )
+    { Matrix<Ring>::operator=( A ); return *this; }
+    const StaticMatrix<Ring,HEIGHT,WIDTH>&
+    operator=( const Matrix<Ring>& A )
+    { Matrix<Ring>::operator=( A ); return *this; }
+
+private:
+    Ring buffer_[HEIGHT*WIDTH];
+};
+
 } // namespace El
 
 #endif // ifndef EL_MATRIX_DECL_HPP
@@ -77,7 +77,8 @@ template<typename Ring>
 Matrix<Ring>::Matrix( Matrix<Ring>&& A ) EL_NO_EXCEPT
 : viewType_(A.viewType_),
   height_(A.height_), width_(A.width_), leadingDimension_(A.leadingDimension_),
-  memory_(std::move(A.memory_)), data_(nullptr)
+  memory_(std::move(A.memory_)), sharedMemory_(std::move(A.sharedMemory_)),
+  data_(nullptr)
 { std::swap( data_, A.data_ ); }
 
 template<typename Ring>
@@ -233,7 +234,11 @@ template<typename Ring>
 const Matrix<Ring>& Matrix<Ring>::operator=( const Matrix<Ring>& A )
 {
     EL_DEBUG_CSE
-    Copy( A, *this );
+    if( MatrixCopyOnWriteEnabled() &&
+        &A != this && !Viewing() && !FixedSize() && !A.Viewing() )
+        ShareWith_( A );
+    else
+        Copy( A, *this );
     return *this;
 }
 
@@ -250,6 +255,7 @@ Matrix<Ring>& Matrix<Ring>::operator=( Matrix<Ring>&& A )
     else
     {
         memory_.ShallowSwap( A.memory_ );
+        std::swap( sharedMemory_, A.sharedMemory_ );
         std::swap( data_, A.data_ );
         viewType_ = A.viewType_;
         height_ = A.height_;
@@ -300,7 +306,8 @@ template<typename Ring>
 Int Matrix<Ring>::LDim() const EL_NO_EXCEPT { return leadingDimension_; }
 
 template<typename Ring>
-Int Matrix<Ring>::MemorySize() const EL_NO_EXCEPT { return memory_.Size(); }
+Int Matrix<Ring>::MemorySize() const EL_NO_EXCEPT
+{ return ( sharedMemory_ ? sharedMemory_->Size() : memory_.Size() ); }
 
 template<typename Ring>
 Int Matrix<Ring>::DiagonalLength( Int offset ) const EL_NO_EXCEPT
@@ -314,6 +321,7 @@ Ring* Matrix<Ring>::Buffer() EL_NO_RELEASE_EXCEPT
       if( Locked() )
           LogicError("Cannot return non-const buffer of locked Matrix");
     )
+    EnsureUnique_();
     return data_;
 }
 
@@ -325,6 +333,7 @@ Ring* Matrix<Ring>::Buffer( Int i, Int j ) EL_NO_RELEASE_EXCEPT
       if( Locked() )
           LogicError("Cannot return non-const buffer of locked Matrix");
     )
+    EnsureUnique_();
     if( data_ == nullptr )
         return nullptr;
     if( i == END ) i = height_ - 1;
@@ -358,6 +367,14 @@ void Matrix<Ring>::FixSize() EL_NO_EXCEPT
     viewType_ = static_cast<El::ViewType>(viewType_ | OWNER_FIXED);
 }
 
+template<typename Ring>
+void Matrix<Ring>::SetNumaPolicy( NumaPolicy policy ) EL_NO_EXCEPT
+{ memory_.SetNumaPolicy( policy ); }
+
+template<typename Ring>
+void Matrix<Ring>::SetHugePagePolicy( HugePagePolicy policy ) EL_NO_EXCEPT
+{ memory_.SetHugePagePolicy( policy ); }
+
 template<typename Ring>
 bool Matrix<Ring>::FixedSize() const EL_NO_EXCEPT
 { return IsFixedSize( viewType_ ); }
@@ -366,6 +383,10 @@ template<typename Ring>
 bool Matrix<Ring>::Locked() const EL_NO_EXCEPT
 { return IsLocked( viewType_ ); }
 
+template<typename Ring>
+bool Matrix<Ring>::Shared() const EL_NO_EXCEPT
+{ return bool(sharedMemory_); }
+
 template<typename Ring>
 void Matrix<Ring>::SetViewType( El::ViewType viewType ) EL_NO_EXCEPT
 { viewType_ = viewType; }
@@ -565,6 +586,7 @@ template<typename Ring>
 void Matrix<Ring>::ShallowSwap( Matrix<Ring>& A )
 {
     memory_.ShallowSwap( A.memory_ );
+    std::swap( sharedMemory_, A.sharedMemory_ );
     std::swap( data_, A.data_ );
     std::swap( viewType_, A.viewType_ );
     std::swap( height_, A.height_ );
@@ -572,12 +594,60 @@ void Matrix<Ring>::ShallowSwap( Matrix<Ring>& A )
     std::swap( leadingDimension_, A.leadingDimension_ );
 }
 
+// Copy-on-write management
+// ========================
+
+template<typename Ring>
+void Matrix<Ring>::ShareWith_( const Matrix<Ring>& A )
+{
+    EL_DEBUG_CSE
+    // Promote the source matrix's buffer into shared ownership (which leaves
+    // its buffer address, and therefore its validity, unchanged)
+    if( !A.sharedMemory_ )
+    {
+        A.sharedMemory_ = std::make_shared<Memory<Ring>>();
+        A.sharedMemory_->ShallowSwap( A.memory_ );
+    }
+    memory_.Empty();
+    sharedMemory_ = A.sharedMemory_;
+    height_ = A.height_;
+    width_ = A.width_;
+    leadingDimension_ = A.leadingDimension_;
+    data_ = A.data_;
+    viewType_ = OWNER;
+}
+
+template<typename Ring>
+void Matrix<Ring>::EnsureUnique_()
+{
+    if( !sharedMemory_ )
+        return;
+    if( sharedMemory_.use_count() == 1 )
+    {
+        // We are the last owner, so simply reclaim the buffer
+        memory_.ShallowSwap( *sharedMemory_ );
+    }
+    else
+    {
+        const Ring* sharedData = data_;
+        memory_.Require( leadingDimension_*width_ );
+        data_ = memory_.Buffer();
+        for( Int j=0; j<width_; ++j )
+            MemCopy
+            ( &data_[j*leadingDimension_],
+              &sharedData[j*leadingDimension_], height_ );
+    }
+    sharedMemory_.reset();
+}
+
 // Reconfigure without error-checking
 // ==================================
 
 template<typename Ring>
 void Matrix<Ring>::Empty_( bool freeMemory )
 {
+    // Any shared buffer is simply released
+    sharedMemory_.reset();
     if( freeMemory )
         memory_.Empty();
     height_ = 0;
@@ -591,6 +661,7 @@ template<typename Ring>
 void Matrix<Ring>::Attach_
 ( Int height, Int width, Ring* buffer, Int leadingDimension )
 {
+    sharedMemory_.reset();
     height_ = height;
     width_ = width;
     leadingDimension_ = leadingDimension;
@@ -602,6 +673,7 @@ template<typename Ring>
 void Matrix<Ring>::LockedAttach_
 ( Int height, Int width, const Ring* buffer, Int leadingDimension )
 {
+    sharedMemory_.reset();
     height_ = height;
     width_ = width;
     leadingDimension_ = leadingDimension;
@@ -613,6 +685,7 @@ template<typename Ring>
 void Matrix<Ring>::Control_
 ( Int height, Int width, Ring* buffer, Int leadingDimension )
 {
+    sharedMemory_.reset();
     height_ = height;
     width_ = width;
     leadingDimension_ = leadingDimension;
@@ -639,9 +712,10 @@ EL_NO_RELEASE_EXCEPT
 }
 
 template<typename Ring>
-Ring& Matrix<Ring>::Ref( Int i, Int j ) 
+Ring& Matrix<Ring>::Ref( Int i, Int j )
 EL_NO_RELEASE_EXCEPT
 {
+    EnsureUnique_();
     return data_[i+j*leadingDimension_];
 }
 
@@ -655,6 +729,7 @@ EL_NO_RELEASE_EXCEPT
       if( Locked() )
           LogicError("Cannot modify data of locked matrices");
     )
+    EnsureUnique_();
     return data_[i+j*leadingDimension_];
 }
 
@@ -710,6 +785,9 @@ void Matrix<Ring>::Resize_( Int height, Int width )
     width_ = width;
     if( reallocate )
     {
+        // The contents need not be preserved, so a shared buffer is released
+        // rather than deep copied
+        sharedMemory_.reset();
         leadingDimension_ = Max( height, 1 );
         memory_.Require( leadingDimension_ * width );
         data_ = memory_.Buffer();
@@ -726,6 +804,7 @@ void Matrix<Ring>::Resize_( Int height, Int width, Int leadingDimension )
     width_ = width;
     if( reallocate )
     {
+        sharedMemory_.reset();
         leadingDimension_ = leadingDimension;
         memory_.Require(leadingDimension*width);
         data_ = memory_.Buffer();
@@ -11,12 +11,203 @@
 
 namespace El {
 
+// An opt-in, thread-safe, power-of-two size-class pool which allows Memory<T>
+// to recycle buffers of packed datatypes rather than repeatedly returning them
+// to the system allocator (which is often a hot spot for algorithms which
+// create and destroy many temporaries of similar shape per iteration).
+// The pool itself is untyped and lives in src/core/Memory.cpp.
+struct MemoryPoolStats
+{
+    size_t numAcquires=0;
+    size_t numHits=0;
+    size_t bytesInUse=0;
+    size_t bytesPooled=0;
+    size_t peakBytesInUse=0;
+};
+
+void EnableMemoryPool();
+void DisableMemoryPool();
+bool MemoryPoolEnabled() EL_NO_EXCEPT;
+// Return all currently unused pooled buffers to the system allocator
+void FlushMemoryPool();
+MemoryPoolStats PoolMemoryStats();
+
+// For internal use by Memory<T>
+void* AcquirePooledBuffer( size_t numBytes );
+void ReleasePooledBuffer( void* buffer, size_t numBytes );
+
+// NUMA placement policy for the buffers allocated through Memory<T>.
+// Rather than introducing a hard dependency on libnuma, the policies are
+// implemented through eager page initialization (parallelized over the
+// OpenMP thread team when EL_HYBRID is enabled), relying on the standard
+// operating-system behavior of backing each page with memory local to the
+// thread which first writes to it.
+namespace NumaPolicyNS {
+enum NumaPolicy {
+  // Defer to the process-wide policy set via SetNumaPolicy
+  NUMA_INHERIT,
+  // Leave the page placement to the operating system
+  NUMA_DEFAULT,
+  // Touch the pages with a statically-scheduled parallel loop so that each
+  // contiguous chunk faults onto the socket of the thread which will later
+  // stream through it (matching the static partitioning used by threaded
+  // BLAS implementations)
+  NUMA_FIRST_TOUCH,
+  // Touch the pages cyclically from the thread team so that consecutive
+  // pages are spread over the sockets' memory controllers
+  NUMA_INTERLEAVE
+};
+}
+using namespace NumaPolicyNS;
+
+// The process-wide placement policy (NUMA_DEFAULT unless overridden), which
+// is applied by every Memory<T> whose own policy is left as NUMA_INHERIT
+void SetNumaPolicy( NumaPolicy policy ) EL_NO_EXCEPT;
+NumaPolicy CurrentNumaPolicy() EL_NO_EXCEPT;
+
+// Placement diagnostics, reported through the logging layer: each placement
+// is logged with its size, policy, and thread count, and running totals may
+// be queried via NumaPlacementStats
+struct NumaStats
+{
+    size_t numPlacements=0;
+    size_t numPagesTouched=0;
+    size_t bytesPlaced=0;
+};
+void EnableNumaDiagnostics();
+void DisableNumaDiagnostics();
+bool NumaDiagnosticsEnabled() EL_NO_EXCEPT;
+NumaStats NumaPlacementStats();
+
+// For internal use by Memory<T>; note that a buffer recycled through the
+// memory pool retains the placement from when its pages were first touched
+void ApplyNumaPolicy( void* buffer, size_t numBytes, NumaPolicy policy );
+
+// Huge-page backing for the buffers of packed datatypes. Large local
+// buffers (e.g., the 100 GB-per-rank panels streamed through Gemm) suffer
+// measurable TLB miss rates with 4 KiB pages, so Memory<T> can instead map
+// its storage with explicit 2 MiB or 1 GiB huge pages (mmap with
+// MAP_HUGETLB, which requires pages to have been reserved by the
+// administrator) or request transparent huge pages from the kernel
+// (madvise with MADV_HUGEPAGE). An explicit request which cannot be
+// satisfied falls back to transparent huge pages and then to the standard
+// allocator, with each decision logged through the logging layer (at
+// verbosity level one) for audit. On platforms without the relevant mmap
+// support every policy silently degrades to the standard allocator.
+namespace HugePagePolicyNS {
+enum HugePagePolicy {
+  // Defer to the process-wide policy set via SetHugePagePolicy
+  HUGE_PAGES_INHERIT,
+  // Use the standard allocator and the default page size
+  HUGE_PAGES_OFF,
+  // Ask the kernel to back the buffer with transparent huge pages
+  HUGE_PAGES_TRANSPARENT,
+  // Map the buffer with explicitly reserved 2 MiB pages
+  HUGE_PAGES_2MB,
+  // Map the buffer with explicitly reserved 1 GiB pages
+  HUGE_PAGES_1GB
+};
+}
+using namespace HugePagePolicyNS;
+
+// The process-wide huge-page policy (HUGE_PAGES_OFF unless overridden,
+// e.g., through the EL_HUGE_PAGES environment variable at initialization),
+// which is applied by every Memory<T> whose own policy is HUGE_PAGES_INHERIT
+void SetHugePagePolicy( HugePagePolicy policy ) EL_NO_EXCEPT;
+HugePagePolicy CurrentHugePagePolicy() EL_NO_EXCEPT;
+
+// For internal use by Memory<T>: returns nullptr when the resolved policy
+// is off (or unsupported), in which case the caller should allocate through
+// its usual path
+void* AcquireHugeBuffer( size_t numBytes, HugePagePolicy policy );
+void ReleaseHugeBuffer( void* buffer, size_t numBytes );
+
+// An opt-in allocation backend for the buffers of packed datatypes, meant
+// for letting applications back local Matrix/DistMatrix storage with
+// host-accessible memory from an accelerator runtime (e.g., page-locked
+// allocations from cudaHostAlloc/hipHostMalloc, or managed/unified memory).
+// CUDA-aware MPI implementations can then move distributed panels directly
+// between the NIC and the device without an extra host staging copy, while
+// Elemental itself takes no dependency on any particular runtime. Note that
+// the buffers must remain dereferenceable from the host, since Elemental's
+// computational kernels run there; device-only residency would additionally
+// require device BLAS dispatch, which this backend deliberately leaves out.
+// The backend takes precedence over the memory pool and may not be changed
+// while any buffer allocated through it is still alive.
+typedef void* (*MemoryAllocFunction)( size_t numBytes );
+typedef void (*MemoryFreeFunction)( void* buffer, size_t numBytes );
+void SetMemoryBackend
+( MemoryAllocFunction allocFunc, MemoryFreeFunction freeFunc );
+void ClearMemoryBackend();
+bool MemoryBackendSet() EL_NO_EXCEPT;
+
+// For internal use by Memory<T>
+void* AcquireBackendBuffer( size_t numBytes );
+void ReleaseBackendBuffer( void* buffer, size_t numBytes );
+
+// Per-subsystem accounting of the storage allocated through Memory<T>.
+// Out-of-memory failures at scale are hard to attribute between local
+// matrix storage, sparse factors, and staging buffers, so every buffer is
+// charged against the calling thread's current allocation tag and per-tag
+// current/peak byte counters are maintained. The hot path only updates
+// thread-local deltas, which are folded into the process-wide counters
+// once a (1 MiB) flush threshold accumulates -- allocations at least as
+// large as the threshold are folded in immediately -- so the peaks are
+// exact up to the flush granularity and the per-allocation cost is a few
+// arithmetic operations. The high-water marks are reported through the
+// logging layer at Finalize (at verbosity level one).
+namespace MemoryTagNS {
+enum MemoryTag {
+  // Local storage of Matrix and DistMatrix (the default tag)
+  MEM_TAG_MATRIX,
+  // Sparse factorization storage (frontal trees and their workspaces)
+  MEM_TAG_SPARSE_FACTOR,
+  // Packing/staging buffers for communication
+  MEM_TAG_STAGING,
+  MEM_NUM_TAGS
+};
+}
+using namespace MemoryTagNS;
+
+struct MemoryTagStats
+{
+    size_t bytesInUse=0;
+    size_t peakBytesInUse=0;
+};
+
+// Tag the calling thread's Memory<T> allocations for the scope's lifetime
+class MemoryTagScope
+{
+public:
+    MemoryTagScope( MemoryTag tag );
+    ~MemoryTagScope();
+private:
+    MemoryTag previous_;
+};
+
+MemoryTag CurrentMemoryTag() EL_NO_EXCEPT;
+const char* MemoryTagString( MemoryTag tag ) EL_NO_EXCEPT;
+// Aggregate the thread-local deltas and return the given tag's counters
+MemoryTagStats TaggedMemoryStats( MemoryTag tag );
+// Log the per-tag high-water marks (called during Finalize)
+void ReportMemoryHighWater();
+
+// For internal use by Memory<T>
+void RecordTaggedAllocation( MemoryTag tag, size_t numBytes );
+void RecordTaggedRelease( MemoryTag tag, size_t numBytes );
+
 template<typename G>
 class Memory
 {
     size_t size_;
     G* rawBuffer_;
     G* buffer_;
+    bool pooled_;
+    bool backend_;
+    bool huge_;
+    NumaPolicy numaPolicy_;
+    HugePagePolicy hugePagePolicy_;
+    MemoryTag tag_;
 public:
     Memory();
     Memory( size_t size );
@@ -31,6 +222,14 @@ public:
     G* Buffer() const EL_NO_EXCEPT;
     size_t Size() const EL_NO_EXCEPT;
 
+    // The NUMA placement policy applied to subsequent allocations
+    void SetNumaPolicy( NumaPolicy policy ) EL_NO_EXCEPT;
+    NumaPolicy GetNumaPolicy() const EL_NO_EXCEPT;
+
+    // The huge-page policy applied to subsequent allocations
+    void SetHugePagePolicy( HugePagePolicy policy ) EL_NO_EXCEPT;
+    HugePagePolicy GetHugePagePolicy() const EL_NO_EXCEPT;
+
     G* Require( size_t size );
     void Release();
     void Empty();
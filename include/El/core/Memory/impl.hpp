@@ -11,34 +11,112 @@ namespace El {
 
 namespace {
 
-template<typename G>
-static G* New( size_t size )
+// Only packed datatypes may be backed by the untyped buffer pool or by a
+// custom allocation backend, since both hand back raw storage rather than
+// constructed objects
+template<typename G,
+         typename=EnableIf<IsPacked<G>>>
+static G* New
+( size_t size, bool& pooled, bool& backend, bool& huge,
+  HugePagePolicy hugePolicy )
 {
+    if( MemoryBackendSet() )
+    {
+        pooled = false;
+        backend = true;
+        huge = false;
+        return static_cast<G*>( AcquireBackendBuffer( size*sizeof(G) ) );
+    }
+    backend = false;
+    void* hugeBuffer = AcquireHugeBuffer( size*sizeof(G), hugePolicy );
+    if( hugeBuffer != nullptr )
+    {
+        pooled = false;
+        huge = true;
+        return static_cast<G*>( hugeBuffer );
+    }
+    huge = false;
+    if( MemoryPoolEnabled() )
+    {
+        pooled = true;
+        return static_cast<G*>( AcquirePooledBuffer( size*sizeof(G) ) );
+    }
+    pooled = false;
+    return new G[size];
+}
+template<typename G,
+         typename=DisableIf<IsPacked<G>>,
+         typename=void>
+static G* New
+( size_t size, bool& pooled, bool& backend, bool& huge,
+  HugePagePolicy hugePolicy )
+{
+    pooled = false;
+    backend = false;
+    huge = false;
     return new G[size];
 }
 
 template<typename G>
-static void Delete( G*& ptr )
+static void Delete
+( G*& ptr, size_t size, bool& pooled, bool& backend, bool& huge )
 {
-    delete[] ptr;
+    if( backend )
+    {
+        ReleaseBackendBuffer( ptr, size*sizeof(G) );
+        backend = false;
+    }
+    else if( huge )
+    {
+        ReleaseHugeBuffer( ptr, size*sizeof(G) );
+        huge = false;
+    }
+    else if( pooled )
+    {
+        ReleasePooledBuffer( ptr, size*sizeof(G) );
+        pooled = false;
+    }
+    else
+        delete[] ptr;
     ptr = nullptr;
 }
 
+// Only packed datatypes may have their pages eagerly faulted, since the
+// placement pass writes raw bytes into (as yet unused) storage
+template<typename G,
+         typename=EnableIf<IsPacked<G>>>
+static void Place( G* buffer, size_t size, NumaPolicy policy )
+{ ApplyNumaPolicy( buffer, size*sizeof(G), policy ); }
+template<typename G,
+         typename=DisableIf<IsPacked<G>>,
+         typename=void>
+static void Place( G* buffer, size_t size, NumaPolicy policy )
+{ }
+
 } // anonymous namespace
 
 template<typename G>
 Memory<G>::Memory()
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr), pooled_(false),
+  backend_(false), huge_(false), numaPolicy_(NUMA_INHERIT),
+  hugePagePolicy_(HUGE_PAGES_INHERIT), tag_(MEM_TAG_MATRIX)
 { }
 
 template<typename G>
 Memory<G>::Memory( size_t size )
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr), pooled_(false),
+  backend_(false), huge_(false), numaPolicy_(NUMA_INHERIT),
+  hugePagePolicy_(HUGE_PAGES_INHERIT), tag_(MEM_TAG_MATRIX)
 { Require( size ); }
 
+// Note that the swap must leave the source empty (in particular, with a
+// zero size), since the destructor charges a release of size_*sizeof(G)
+// bytes against tag_ and the buffer's accounting travels with the buffer
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr), pooled_(false),
+  backend_(false), huge_(false), numaPolicy_(NUMA_INHERIT),
+  hugePagePolicy_(HUGE_PAGES_INHERIT), tag_(MEM_TAG_MATRIX)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -51,12 +129,19 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
     std::swap(size_,mem.size_);
     std::swap(rawBuffer_,mem.rawBuffer_);
     std::swap(buffer_,mem.buffer_);
+    std::swap(pooled_,mem.pooled_);
+    std::swap(backend_,mem.backend_);
+    std::swap(huge_,mem.huge_);
+    std::swap(numaPolicy_,mem.numaPolicy_);
+    std::swap(hugePagePolicy_,mem.hugePagePolicy_);
+    std::swap(tag_,mem.tag_);
 }
 
 template<typename G>
-Memory<G>::~Memory() 
-{ 
-    Delete( rawBuffer_ );
+Memory<G>::~Memory()
+{
+    RecordTaggedRelease( tag_, size_*sizeof(G) );
+    Delete( rawBuffer_, size_, pooled_, backend_, huge_ );
 }
 
 template<typename G>
@@ -65,21 +150,47 @@ G* Memory<G>::Buffer() const EL_NO_EXCEPT { return buffer_; }
 template<typename G>
 size_t  Memory<G>::Size() const EL_NO_EXCEPT { return size_; }
 
+template<typename G>
+void Memory<G>::SetNumaPolicy( NumaPolicy policy ) EL_NO_EXCEPT
+{ numaPolicy_ = policy; }
+
+template<typename G>
+NumaPolicy Memory<G>::GetNumaPolicy() const EL_NO_EXCEPT
+{ return numaPolicy_; }
+
+template<typename G>
+void Memory<G>::SetHugePagePolicy( HugePagePolicy policy ) EL_NO_EXCEPT
+{ hugePagePolicy_ = policy; }
+
+template<typename G>
+HugePagePolicy Memory<G>::GetHugePagePolicy() const EL_NO_EXCEPT
+{ return hugePagePolicy_; }
+
 template<typename G>
 G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        RecordTaggedRelease( tag_, size_*sizeof(G) );
+        Delete( rawBuffer_, size_, pooled_, backend_, huge_ );
 
 #ifndef EL_RELEASE
         try {
 #endif
 
             // TODO: Optionally overallocate to force alignment of buffer_
-            rawBuffer_ = New<G>( size );
+            rawBuffer_ = New<G>( size, pooled_, backend_, huge_,
+                                 hugePagePolicy_ );
             buffer_ = rawBuffer_;
 
+            // Eagerly fault the pages according to the NUMA policy before
+            // any (possibly serial) kernel first writes into them
+            Place( rawBuffer_, size, numaPolicy_ );
+
+            // Charge the buffer against the thread's current subsystem tag
+            tag_ = CurrentMemoryTag();
+            RecordTaggedAllocation( tag_, size*sizeof(G) );
+
             size_ = size;
 #ifndef EL_RELEASE
         } 
@@ -110,7 +221,8 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    RecordTaggedRelease( tag_, size_*sizeof(G) );
+    Delete( rawBuffer_, size_, pooled_, backend_, huge_ );
     buffer_ = nullptr;
     size_ = 0;
 }
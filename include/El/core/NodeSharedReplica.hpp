@@ -0,0 +1,146 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_NODESHAREDREPLICA_HPP
+#define EL_CORE_NODESHAREDREPLICA_HPP
+
+namespace El {
+
+// Node-shared read-only replication of a DistMatrix
+// =================================================
+// A fully-replicated ([STAR,STAR]-style) copy of a distributed matrix
+// stores one private instance per process, so on a node hosting p ranks
+// the operand occupies p times its size and its formation broadcasts the
+// same bytes to every rank of the node. This utility instead gathers the
+// matrix once, stores a single physical copy per node inside an MPI-3
+// shared-memory window, and hands every rank of the node a locked view of
+// that copy: the per-node footprint and the inter-node traffic both drop
+// by a factor of the ranks-per-node count.
+//
+// The replica is strictly read-only (the window is never locked for
+// writing and the view is const), is only valid while the replica object
+// is alive, and its constructor and destructor are collective over the
+// matrix's grid. When shared-memory windows are unavailable -- a pre-MPI-3
+// library, an entry type whose in-memory representation cannot be shared
+// across processes, or a single rank per node -- each rank falls back to a
+// private [STAR,STAR] copy, so callers need not special-case the
+// environment.
+
+namespace node_shared_replica {
+
+template<typename T,
+         typename=EnableIf<IsPacked<T>>>
+bool TryAttach
+( const AbstractDistMatrix<T>& A,
+        mpi::Comm nodeComm,
+        mpi::Comm crossNodeComm,
+        mpi::Window& window,
+        Matrix<T>& matrix )
+{
+    EL_DEBUG_CSE
+    if( !mpi::SharedMemoryWindowsSupported() || mpi::Size(nodeComm) == 1 )
+        return false;
+    const Int height = A.Height();
+    const Int width = A.Width();
+
+    // Funnel the matrix to VC rank zero, which is both the default root of
+    // the [CIRC,CIRC] distribution and (since SplitIntoNodes keys both of
+    // its splits on the parent rank) rank zero of the leader communicator
+    DistMatrix<T,CIRC,CIRC> ARoot( A );
+
+    const bool nodeLeader = ( mpi::Rank(nodeComm) == 0 );
+    const size_t numBytes =
+      ( nodeLeader ? size_t(height)*size_t(width)*sizeof(T) : 0 );
+    void* base;
+    mpi::WindowAllocateShared( numBytes, nodeComm, window, base );
+    if( nodeLeader )
+    {
+        T* buf = static_cast<T*>( base );
+        if( ARoot.CrossRank() == ARoot.Root() )
+        {
+            const Matrix<T>& ALoc = ARoot.LockedMatrix();
+            const T* ABuf = ALoc.LockedBuffer();
+            const Int ALDim = ALoc.LDim();
+            for( Int j=0; j<width; ++j )
+                MemCopy( &buf[j*height], &ABuf[j*ALDim], height );
+        }
+        mpi::Broadcast( buf, height*width, 0, crossNodeComm );
+    }
+    // The leaders' stores must land before the node's other ranks attach
+    mpi::Barrier( nodeComm );
+    const T* viewBuf =
+      static_cast<const T*>
+      ( nodeLeader ? base : mpi::WindowSharedQuery( 0, window ) );
+    matrix.LockedAttach( height, width, viewBuf, Max(height,Int(1)) );
+    return true;
+}
+
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,typename=void>
+bool TryAttach
+( const AbstractDistMatrix<T>&,
+        mpi::Comm, mpi::Comm, mpi::Window&, Matrix<T>& )
+{ return false; }
+
+} // namespace node_shared_replica
+
+template<typename T>
+class NodeSharedReplica
+{
+public:
+    // Collectively form the replica (one gather to the grid root followed
+    // by one broadcast across the node leaders)
+    NodeSharedReplica( const AbstractDistMatrix<T>& A )
+    {
+        EL_DEBUG_CSE
+        mpi::SplitIntoNodes( A.Grid().VCComm(), nodeComm_, crossNodeComm_ );
+        shared_ = node_shared_replica::TryAttach
+          ( A, nodeComm_, crossNodeComm_, window_, matrix_ );
+        if( !shared_ )
+        {
+            DistMatrix<T,STAR,STAR> AFull( A );
+            matrix_ = AFull.LockedMatrix();
+        }
+    }
+
+    // Collectively free the window (and must therefore be reached by every
+    // process of the grid before any of them reuses the storage)
+    ~NodeSharedReplica()
+    {
+        if( !mpi::Finalized() )
+        {
+            if( shared_ )
+            {
+                matrix_.Empty();
+                mpi::Barrier( nodeComm_ );
+                mpi::WindowFree( window_ );
+            }
+            mpi::Free( nodeComm_ );
+            mpi::Free( crossNodeComm_ );
+        }
+    }
+
+    // The node's (or, in the fallback regime, this rank's) copy
+    const Matrix<T>& LockedMatrix() const EL_NO_EXCEPT { return matrix_; }
+
+    // Whether the copy is physically shared by the ranks of the node
+    bool Shared() const EL_NO_EXCEPT { return shared_; }
+
+private:
+    bool shared_=false;
+    mpi::Comm nodeComm_, crossNodeComm_;
+    mpi::Window window_;
+    Matrix<T> matrix_;
+
+    NodeSharedReplica( const NodeSharedReplica<T>& );
+    NodeSharedReplica<T>& operator=( const NodeSharedReplica<T>& );
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_NODESHAREDREPLICA_HPP
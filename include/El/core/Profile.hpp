@@ -0,0 +1,78 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_PROFILE_HPP
+#define EL_CORE_PROFILE_HPP
+
+namespace El {
+namespace prof {
+
+// An always-compiled sampling profiler for release builds, where the call
+// stack of callStack.cpp is compiled out: while sampling is enabled, the
+// EL_DEBUG_CSE markers maintain a per-thread chain of the active routine
+// tags (two pointer writes per instrumented call), and a profiling-timer
+// signal walks the chain of whichever thread it interrupts, accumulating
+// per-routine inclusive sample counts into a lock-free table. While
+// sampling is disabled, each marker costs a single branch. The resulting
+// histogram is written to a per-rank file at Finalize (or on Disable).
+// Sampling may be switched on either programmatically or by setting the
+// EL_PROFILE environment variable (with an optional EL_PROFILE_HZ rate).
+
+class Frame;
+
+// Only mutated by Enable/Disable, but read by every marker and (with the
+// frame chain) by the signal handler
+extern volatile bool samplingActive;
+extern thread_local Frame* volatile currentFrame;
+
+// Begin sampling at the given rate (997 Hz if unspecified, chosen prime to
+// avoid locking onto periodic program behavior)
+void Enable( Int samplesPerSec=0 );
+void Disable();
+bool Enabled() EL_NO_EXCEPT;
+
+// Write the per-routine histogram (sorted by inclusive sample count, with
+// the estimated inclusive seconds and the fraction of all samples) to the
+// given file; the no-argument form uses the per-rank default name,
+// "El-Profile-ProcXXX.txt", and is invoked automatically by Finalize
+void Dump( const string& filename );
+void Dump();
+
+// The RAII enter/exit marker planted by EL_DEBUG_CSE
+class Frame
+{
+public:
+    Frame( const char* tag ) EL_NO_EXCEPT
+    {
+        if( !samplingActive )
+            return;
+        tag_ = tag;
+        parent_ = currentFrame;
+        currentFrame = this;
+        linked_ = true;
+    }
+
+    ~Frame()
+    {
+        if( linked_ )
+            currentFrame = parent_;
+    }
+
+    const char* Tag() const EL_NO_EXCEPT { return tag_; }
+    Frame* Parent() const EL_NO_EXCEPT { return parent_; }
+
+private:
+    const char* tag_="";
+    Frame* parent_=nullptr;
+    bool linked_=false;
+};
+
+} // namespace prof
+} // namespace El
+
+#endif // ifndef EL_CORE_PROFILE_HPP
@@ -252,6 +252,35 @@ public:
                 return;
             }
         }
+        if( A.ProxyCacheEnabled() )
+        {
+            // Consult (and, on a miss, extend) A's cache of read-only
+            // replicas rather than redistributing on every call. The cache
+            // retains ownership, so the destructor must not free the proxy.
+            locked_ = true;
+            madeCopy_ = false;
+            auto* replica =
+              A.SearchProxyCache
+              ( U, V, ELEMENT,
+                ctrl.colConstrain, ctrl.colAlign,
+                ctrl.rowConstrain, ctrl.rowAlign,
+                ctrl.rootConstrain, ctrl.root );
+            if( replica != nullptr )
+            {
+                prox_ = static_cast<proxType*>(replica);
+                return;
+            }
+            prox_ = new proxType(A.Grid());
+            if( ctrl.rootConstrain )
+                prox_->SetRoot( ctrl.root );
+            if( ctrl.colConstrain )
+                prox_->AlignCols( ctrl.colAlign );
+            if( ctrl.rowConstrain )
+                prox_->AlignRows( ctrl.rowAlign );
+            Copy( A, *prox_ );
+            A.DonateToProxyCache( prox_ );
+            return;
+        }
         locked_ = false;
         madeCopy_ = true;
         prox_ = new proxType(A.Grid());
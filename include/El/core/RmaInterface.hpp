@@ -0,0 +1,91 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_RMAINTERFACE_HPP
+#define EL_CORE_RMAINTERFACE_HPP
+
+namespace El {
+
+// One-sided access engine for irregular reads and updates of a DistMatrix
+// =======================================================================
+// Irregular gather/scatter access patterns (e.g., the assembly of a
+// distributed matrix from an unstructured mesh) are a poor match for the
+// collective redistribution machinery, since every entry would require a
+// rendezvous between the origin and the owning process. This interface
+// instead collectively exposes each process's local buffer through an MPI
+// window so that, between Attach and Detach, any process may queue up reads
+// and remote sums of individual entries and then issue them as batched
+// passive-target RMA operations without the targets' participation.
+//
+// Queued operations are only guaranteed to have completed after the
+// subsequent call to Flush, and the usual one-sided caveats apply: the
+// local entries of the attached matrix should not be modified directly
+// while remote accumulations might be in flight, and Detach (which is
+// collective) is the only synchronization point between the processes.
+
+template<typename T>
+class RmaInterface
+{
+public:
+    RmaInterface();
+    // If the interface is still attached, the destructor collectively
+    // detaches it (and must therefore be reached by every process)
+    ~RmaInterface();
+
+    // Collectively expose the local buffer of Z for one-sided access.
+    // Matrices with redundant or cross communicators of size greater than
+    // one are not (yet) supported, since remote updates would leave their
+    // copies inconsistent.
+    void Attach( ElementalMatrix<T>& Z );
+    // Collectively complete all outstanding operations and free the window
+    void Detach();
+
+    // Record a request to read entry (i,j) of the attached matrix into
+    // *value; purely local. The read is only performed (and *value only
+    // defined) after the next call to Flush.
+    void QueueGet( Int i, Int j, T* value );
+    // Record a request to add value onto entry (i,j) of the attached
+    // matrix; purely local until the next call to Flush
+    void QueueAccumulate( Int i, Int j, T value );
+
+    // Issue the queued operations, batched into one passive-target access
+    // epoch per target process, and wait for their local completion. No
+    // participation from the target processes is required. Accumulations
+    // are issued before reads so that a process's own queued updates are
+    // visible to its queued reads of the same entry.
+    void Flush();
+
+private:
+    struct GetRequest
+    {
+        int target;
+        mpi::Aint offset;
+        T* value;
+    };
+    struct AccumulateRequest
+    {
+        int target;
+        mpi::Aint offset;
+        T value;
+    };
+
+    bool attached_=false;
+    ElementalMatrix<T>* Z_=nullptr;
+    mpi::Window window_;
+    // The leading dimension of each process's local buffer, gathered at
+    // Attach so that remote offsets can be computed without communication
+    vector<Int> localLDims_;
+    vector<GetRequest> getQueue_;
+    vector<AccumulateRequest> accumulateQueue_;
+
+    mpi::Aint Offset( Int i, Int j, int target ) const;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_RMAINTERFACE_HPP
@@ -11,6 +11,114 @@
 
 namespace El {
 
+template<typename T> class Matrix;
+template<typename T> class AbstractDistMatrix;
+
+// Scatter-gather serialization
+// ============================
+// Serializing a multi-gigabyte matrix through a contiguous staging buffer
+// doubles its peak memory footprint and adds a full copy pass. For packed
+// element types the local buffer can instead be exposed as a short list of
+// (pointer, length) spans -- a single span when the columns are contiguous --
+// which may be handed directly to writev/readv-style scatter-gather I/O or
+// attached to an MPI derived datatype without any intermediate staging.
+// The spans alias the matrix's buffer and are invalidated by anything which
+// invalidates Matrix::LockedBuffer.
+
+struct SerializedSpan
+{
+    const byte* buf;
+    std::size_t numBytes;
+};
+
+struct MutableSerializedSpan
+{
+    byte* buf;
+    std::size_t numBytes;
+};
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+std::vector<SerializedSpan> SerializedSpans( const Matrix<T>& A )
+{
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int ldim = A.LDim();
+    std::vector<SerializedSpan> spans;
+    if( height == 0 || width == 0 )
+        return spans;
+    if( height == ldim || width == 1 )
+    {
+        // Contiguous-column fast path: the local data is a single block
+        spans.push_back
+        ( SerializedSpan{
+            reinterpret_cast<const byte*>(A.LockedBuffer()),
+            std::size_t(height)*std::size_t(width)*sizeof(T) } );
+    }
+    else
+    {
+        // One span per column
+        spans.reserve( width );
+        for( Int j=0; j<width; ++j )
+            spans.push_back
+            ( SerializedSpan{
+                reinterpret_cast<const byte*>(A.LockedBuffer(0,j)),
+                std::size_t(height)*sizeof(T) } );
+    }
+    return spans;
+}
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+std::vector<MutableSerializedSpan> SerializedSpans( Matrix<T>& A )
+{
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int ldim = A.LDim();
+    std::vector<MutableSerializedSpan> spans;
+    if( height == 0 || width == 0 )
+        return spans;
+    if( height == ldim || width == 1 )
+    {
+        spans.push_back
+        ( MutableSerializedSpan{
+            reinterpret_cast<byte*>(A.Buffer()),
+            std::size_t(height)*std::size_t(width)*sizeof(T) } );
+    }
+    else
+    {
+        spans.reserve( width );
+        for( Int j=0; j<width; ++j )
+            spans.push_back
+            ( MutableSerializedSpan{
+                reinterpret_cast<byte*>(A.Buffer(0,j)),
+                std::size_t(height)*sizeof(T) } );
+    }
+    return spans;
+}
+
+// Spans over the local portion of a distributed matrix
+template<typename T,typename=EnableIf<IsPacked<T>>>
+std::vector<SerializedSpan> SerializedSpans( const AbstractDistMatrix<T>& A )
+{ return SerializedSpans( A.LockedMatrix() ); }
+template<typename T,typename=EnableIf<IsPacked<T>>>
+std::vector<MutableSerializedSpan> SerializedSpans( AbstractDistMatrix<T>& A )
+{ return SerializedSpans( A.Matrix() ); }
+
+inline std::size_t TotalSerializedSize( const std::vector<SerializedSpan>& spans )
+{
+    std::size_t numBytes = 0;
+    for( const auto& span : spans )
+        numBytes += span.numBytes;
+    return numBytes;
+}
+inline std::size_t
+TotalSerializedSize( const std::vector<MutableSerializedSpan>& spans )
+{
+    std::size_t numBytes = 0;
+    for( const auto& span : spans )
+        numBytes += span.numBytes;
+    return numBytes;
+}
+
 #ifdef EL_HAVE_MPC
 
 byte* Serialize( Int n, const BigInt* x, byte* xPacked );
@@ -0,0 +1,207 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_SPARSEASSEMBLY_HPP
+#define EL_CORE_SPARSEASSEMBLY_HPP
+
+namespace El {
+namespace sparse_assembly {
+
+// Shared machinery for processing the edge and entry queues of the
+// (distributed) graph and sparse matrix classes: rather than
+// comparison-sorting all of the queued records at once, they are bucketed
+// by source with a single counting pass over the most-significant key,
+// after which each source's targets are sorted and deduplicated
+// independently in parallel. The source offsets of the compressed storage
+// are recovered with a prefix scan over the per-source unique counts, so
+// no separate offset-construction pass over the edges is needed.
+//
+// The sources are assumed to lie in [sourceBeg,sourceBeg+numSources), as
+// is guaranteed by the queueing routines, and sourceOffsets[k] is the
+// offset of (local) source k's first edge, as in ComputeSourceOffsets.
+
+inline bool SortedAndUnique
+( const vector<Int>& sources, const vector<Int>& targets )
+{
+    const Int numEdges = sources.size();
+    for( Int e=1; e<numEdges; ++e )
+        if( sources[e] < sources[e-1] ||
+            (sources[e] == sources[e-1] && targets[e] <= targets[e-1]) )
+            return false;
+    return true;
+}
+
+// Build the source offsets of an already sorted-and-unique edge list
+inline void ScanSourceOffsets
+( Int sourceBeg, Int numSources,
+  const vector<Int>& sources, vector<Int>& sourceOffsets )
+{
+    const Int numEdges = sources.size();
+    sourceOffsets.resize( numSources+1 );
+    Int sourceOffset = 0;
+    Int prevSource = sourceBeg-1;
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int source = sources[e];
+        for( ; prevSource<source; ++prevSource )
+            sourceOffsets[sourceOffset++] = e;
+    }
+    for( ; sourceOffset<=numSources; ++sourceOffset )
+        sourceOffsets[sourceOffset] = numEdges;
+}
+
+// Sort the queued edges, drop exact duplicates, and build the offsets
+inline void SortAndCompress
+( Int sourceBeg, Int numSources,
+  vector<Int>& sources, vector<Int>& targets, vector<Int>& sourceOffsets )
+{
+    const Int numEdges = sources.size();
+
+    // If the edges were queued in order without duplicates (e.g., when
+    // rebuilding a previously assembled pattern), no data motion is needed
+    if( SortedAndUnique( sources, targets ) )
+    {
+        ScanSourceOffsets( sourceBeg, numSources, sources, sourceOffsets );
+        return;
+    }
+
+    // Bucket the targets by source with a counting pass
+    vector<Int> bucketStarts( numSources+1, 0 );
+    for( Int e=0; e<numEdges; ++e )
+        ++bucketStarts[sources[e]-sourceBeg+1];
+    for( Int s=0; s<numSources; ++s )
+        bucketStarts[s+1] += bucketStarts[s];
+    vector<Int> bucketedTargets( numEdges );
+    {
+        auto offs = bucketStarts;
+        for( Int e=0; e<numEdges; ++e )
+            bucketedTargets[offs[sources[e]-sourceBeg]++] = targets[e];
+    }
+
+    // Sort each source's targets and drop its duplicates. The sources are
+    // independent, so this pass is trivially parallel
+    vector<Int> bucketSizes( numSources, 0 );
+    EL_PARALLEL_FOR
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int beg = bucketStarts[s];
+        const Int end = bucketStarts[s+1];
+        if( beg == end )
+            continue;
+        std::sort( bucketedTargets.begin()+beg, bucketedTargets.begin()+end );
+        Int lastUnique = beg;
+        for( Int e=beg+1; e<end; ++e )
+            if( bucketedTargets[e] != bucketedTargets[lastUnique] )
+                bucketedTargets[++lastUnique] = bucketedTargets[e];
+        bucketSizes[s] = (lastUnique+1) - beg;
+    }
+
+    // The prefix scan of the unique counts is the compressed offset array
+    sourceOffsets.resize( numSources+1 );
+    sourceOffsets[0] = 0;
+    for( Int s=0; s<numSources; ++s )
+        sourceOffsets[s+1] = sourceOffsets[s] + bucketSizes[s];
+
+    // Compact the surviving edges back into the graph buffers
+    const Int numUnique = sourceOffsets[numSources];
+    sources.resize( numUnique );
+    targets.resize( numUnique );
+    EL_PARALLEL_FOR
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int off = sourceOffsets[s];
+        const Int beg = bucketStarts[s];
+        for( Int e=0; e<bucketSizes[s]; ++e )
+        {
+            sources[off+e] = s + sourceBeg;
+            targets[off+e] = bucketedTargets[beg+e];
+        }
+    }
+}
+
+// Sort the queued entries, accumulate duplicates, and build the offsets
+template<typename Ring>
+void SortAndCompress
+( Int sourceBeg, Int numSources,
+  vector<Int>& sources, vector<Int>& targets, vector<Ring>& vals,
+  vector<Int>& sourceOffsets )
+{
+    typedef pair<Int,Ring> TargetValuePair;
+    const Int numEntries = sources.size();
+
+    if( SortedAndUnique( sources, targets ) )
+    {
+        ScanSourceOffsets( sourceBeg, numSources, sources, sourceOffsets );
+        return;
+    }
+
+    // Bucket the (target,value) pairs by source with a counting pass
+    vector<Int> bucketStarts( numSources+1, 0 );
+    for( Int e=0; e<numEntries; ++e )
+        ++bucketStarts[sources[e]-sourceBeg+1];
+    for( Int s=0; s<numSources; ++s )
+        bucketStarts[s+1] += bucketStarts[s];
+    vector<TargetValuePair> bucketed( numEntries );
+    {
+        auto offs = bucketStarts;
+        for( Int e=0; e<numEntries; ++e )
+            bucketed[offs[sources[e]-sourceBeg]++] =
+              TargetValuePair(targets[e],vals[e]);
+    }
+
+    // Sort each source's entries by target and combine its duplicates
+    vector<Int> bucketSizes( numSources, 0 );
+    EL_PARALLEL_FOR
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int beg = bucketStarts[s];
+        const Int end = bucketStarts[s+1];
+        if( beg == end )
+            continue;
+        std::sort
+        ( bucketed.begin()+beg, bucketed.begin()+end,
+          []( const TargetValuePair& a, const TargetValuePair& b )
+          { return a.first < b.first; } );
+        Int lastUnique = beg;
+        for( Int e=beg+1; e<end; ++e )
+        {
+            if( bucketed[e].first != bucketed[lastUnique].first )
+                bucketed[++lastUnique] = bucketed[e];
+            else
+                bucketed[lastUnique].second += bucketed[e].second;
+        }
+        bucketSizes[s] = (lastUnique+1) - beg;
+    }
+
+    sourceOffsets.resize( numSources+1 );
+    sourceOffsets[0] = 0;
+    for( Int s=0; s<numSources; ++s )
+        sourceOffsets[s+1] = sourceOffsets[s] + bucketSizes[s];
+
+    const Int numUnique = sourceOffsets[numSources];
+    sources.resize( numUnique );
+    targets.resize( numUnique );
+    vals.resize( numUnique );
+    EL_PARALLEL_FOR
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int off = sourceOffsets[s];
+        const Int beg = bucketStarts[s];
+        for( Int e=0; e<bucketSizes[s]; ++e )
+        {
+            sources[off+e] = s + sourceBeg;
+            targets[off+e] = bucketed[beg+e].first;
+            vals[off+e] = bucketed[beg+e].second;
+        }
+    }
+}
+
+} // namespace sparse_assembly
+} // namespace El
+
+#endif // ifndef EL_CORE_SPARSEASSEMBLY_HPP
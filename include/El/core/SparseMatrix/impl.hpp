@@ -425,63 +425,35 @@ void SparseMatrix<Ring>::ProcessQueues()
     if( graph_.consistent_ )
         return;
 
-    Int numRemoved = 0;
-    const Int numEntries = vals_.size();
-    vector<Entry<Ring>> entries( numEntries );
+    // Filter out any entries marked for removal
+    // -----------------------------------------
     if( graph_.markedForRemoval_.size() != 0 )
     {
-        for( Int s=0; s<numEntries; ++s )
+        const Int numQueued = vals_.size();
+        Int numKept = 0;
+        for( Int s=0; s<numQueued; ++s )
         {
             pair<Int,Int> candidate(graph_.sources_[s],graph_.targets_[s]);
             if( graph_.markedForRemoval_.find(candidate) ==
                 graph_.markedForRemoval_.end() )
             {
-                entries[s-numRemoved].i = graph_.sources_[s];
-                entries[s-numRemoved].j = graph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
+                graph_.sources_[numKept] = graph_.sources_[s];
+                graph_.targets_[numKept] = graph_.targets_[s];
+                vals_[numKept] = vals_[s];
+                ++numKept;
             }
         }
         graph_.markedForRemoval_.clear();
-        entries.resize( numEntries-numRemoved );
-    }
-    else
-    {
-        for( Int s=0; s<numEntries; ++s )
-            entries[s] =
-              Entry<Ring>{graph_.sources_[s],graph_.targets_[s],vals_[s]};
-    }
-    CompareEntriesFunctor comparer;
-    std::sort( entries.begin(), entries.end(), comparer );
-    const Int numSorted = entries.size();
-
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int s=1; s<numSorted; ++s )
-    {
-        if( entries[s].i != entries[lastUnique].i ||
-            entries[s].j != entries[lastUnique].j )
-            entries[++lastUnique] = entries[s];
-        else
-            entries[lastUnique].value += entries[s].value;
-    }
-    const Int numUnique = lastUnique+1;
-    entries.resize( numUnique );
-
-    graph_.sources_.resize( numUnique );
-    graph_.targets_.resize( numUnique );
-    vals_.resize( numUnique );
-    for( Int s=0; s<numUnique; ++s )
-    {
-        graph_.sources_[s] = entries[s].i;
-        graph_.targets_[s] = entries[s].j;
-        vals_[s] = entries[s].value;
+        graph_.sources_.resize( numKept );
+        graph_.targets_.resize( numKept );
+        vals_.resize( numKept );
     }
 
-    graph_.ComputeSourceOffsets();
+    // Bucket the entries by row, sort each row by column and combine its
+    // duplicates in parallel, and recover the offsets from the bucket scan
+    sparse_assembly::SortAndCompress
+    ( 0, graph_.numSources_,
+      graph_.sources_, graph_.targets_, vals_, graph_.sourceOffsets_ );
     graph_.consistent_ = true;
 }
 
@@ -0,0 +1,359 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_TILESTORE_HPP
+#define EL_CORE_TILESTORE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace El {
+
+// An out-of-core tile container: the height x width matrix is decomposed
+// into square tiles which are paged between a backing file (e.g., on NVMe)
+// and a bounded set of in-memory slots. A background I/O thread services
+// load and writeback requests so that Prefetch calls overlap the disk
+// traffic of the next tiles with the computation on the current ones; the
+// calling thread only blocks inside Tile/LockedTile when it requests a tile
+// whose load has not yet completed.
+//
+// Tiles handed out by Tile/LockedTile are pinned (exempt from eviction)
+// until the matching Release; eviction of the least-recently-used unpinned
+// tile writes it back only when it was accessed mutably. Tiles which have
+// never been written to the backing file materialize as zero.
+//
+// Only packed datatypes may be stored, since the tiles are spilled as raw
+// bytes. Like the blocksize stack, the container assumes that it is driven
+// from a single thread.
+template<typename T>
+class TileStore
+{
+public:
+    TileStore
+    ( Int height, Int width, Int tileSize, Int maxResidentTiles,
+      string spillPath )
+    : height_(height), width_(width), tileSize_(tileSize),
+      maxResidentTiles_(Max(maxResidentTiles,Int(4))), spillPath_(spillPath)
+    {
+        EL_DEBUG_CSE
+        static_assert( IsPacked<T>::value,
+          "TileStore requires a packed datatype" );
+        EL_DEBUG_ONLY(
+          if( height < 0 || width < 0 || tileSize <= 0 )
+              LogicError("Invalid TileStore dimensions");
+        )
+        numRowTiles_ = (height_+tileSize_-1) / tileSize_;
+        numColTiles_ = (width_+tileSize_-1) / tileSize_;
+        onDisk_.resize( numRowTiles_*numColTiles_, false );
+        file_.open
+        ( spillPath_.c_str(),
+          std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc );
+        if( !file_ )
+            RuntimeError("Could not open tile spill file ",spillPath_);
+        worker_ = std::thread( &TileStore<T>::Work, this );
+    }
+
+    ~TileStore()
+    {
+        {
+            std::unique_lock<std::mutex> lock( mutex_ );
+            stop_ = true;
+        }
+        cv_.notify_all();
+        worker_.join();
+        file_.close();
+        std::remove( spillPath_.c_str() );
+        // (any retired tiles are destructed with retired_ below)
+    }
+
+    TileStore( const TileStore<T>& ) = delete;
+    TileStore<T>& operator=( const TileStore<T>& ) = delete;
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    Int TileSize() const EL_NO_EXCEPT { return tileSize_; }
+    Int NumRowTiles() const EL_NO_EXCEPT { return numRowTiles_; }
+    Int NumColTiles() const EL_NO_EXCEPT { return numColTiles_; }
+    Int TileHeight( Int i ) const EL_NO_EXCEPT
+    { return Min( tileSize_, height_-i*tileSize_ ); }
+    Int TileWidth( Int j ) const EL_NO_EXCEPT
+    { return Min( tileSize_, width_-j*tileSize_ ); }
+
+    // Begin loading tile (i,j) on the I/O thread if it is not yet resident
+    void Prefetch( Int i, Int j )
+    {
+        EL_DEBUG_CSE
+        CollectRetired();
+        EnsureSpace( 1 );
+        StartLoad( i, j );
+    }
+
+    // Return a pinned reference to tile (i,j), blocking until any pending
+    // load completes; the mutable variant marks the tile for writeback
+    Matrix<T>& Tile( Int i, Int j )
+    {
+        EL_DEBUG_CSE
+        Slot& slot = WaitFor( i, j );
+        slot.dirty = true;
+        ++slot.pins;
+        return *slot.tile;
+    }
+    const Matrix<T>& LockedTile( Int i, Int j )
+    {
+        EL_DEBUG_CSE
+        Slot& slot = WaitFor( i, j );
+        ++slot.pins;
+        return *slot.tile;
+    }
+
+    // Unpin a tile previously returned by Tile/LockedTile
+    void Release( Int i, Int j )
+    {
+        EL_DEBUG_CSE
+        auto it = resident_.find( Key(i,j) );
+        EL_DEBUG_ONLY(
+          if( it == resident_.end() || it->second.pins <= 0 )
+              LogicError("Released tile (",i,",",j,") was not pinned");
+        )
+        --it->second.pins;
+    }
+
+    // Write every dirty resident tile back to the backing file
+    void Flush()
+    {
+        EL_DEBUG_CSE
+        WaitForWorker();
+        for( auto& entry : resident_ )
+        {
+            Slot& slot = entry.second;
+            if( slot.dirty )
+            {
+                WriteTile( entry.first, slot.tile->LockedBuffer(),
+                           slot.tile->Height()*slot.tile->Width() );
+                slot.dirty = false;
+            }
+        }
+    }
+
+private:
+    // The worker thread never touches resident_ (whose nodes are created and
+    // destroyed by the calling thread); load completion is signalled through
+    // a pointer to the slot's atomic flag, which remains valid because
+    // loading slots are exempt from eviction and std::map nodes are stable
+    struct Slot
+    {
+        std::unique_ptr<Matrix<T>> tile;
+        bool dirty=false;
+        std::atomic<bool> loading{false};
+        Int pins=0;
+    };
+
+    struct Request
+    {
+        bool store;
+        Int key;
+        T* buffer;
+        size_t numEntries;
+        std::atomic<bool>* loadingFlag=nullptr;
+        std::unique_ptr<Matrix<T>> owned; // keeps evicted tiles alive
+    };
+
+    Int height_, width_, tileSize_;
+    Int numRowTiles_, numColTiles_;
+    Int maxResidentTiles_;
+    string spillPath_;
+    std::fstream file_;
+
+    std::map<Int,Slot> resident_;
+    std::list<Int> lru_; // least-recently-used at the front
+    vector<bool> onDisk_;
+
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Request> requests_;
+    // Written-back tiles whose destruction is deferred to the calling thread
+    vector<std::unique_ptr<Matrix<T>>> retired_;
+    Int numActive_=0; // requests popped but not yet completed
+    bool stop_=false;
+
+    Int Key( Int i, Int j ) const EL_NO_EXCEPT { return i + j*numRowTiles_; }
+
+    std::streamoff Offset( Int key ) const EL_NO_EXCEPT
+    {
+        const std::streamoff slotBytes =
+          std::streamoff(tileSize_)*tileSize_*sizeof(T);
+        return std::streamoff(key)*slotBytes;
+    }
+
+    // The file is only touched by the worker, except within Flush (which
+    // first drains the request queue)
+    void ReadTile( Int key, T* buffer, size_t numEntries )
+    {
+        file_.seekg( Offset(key) );
+        file_.read
+        ( reinterpret_cast<char*>(buffer), numEntries*sizeof(T) );
+    }
+    void WriteTile( Int key, const T* buffer, size_t numEntries )
+    {
+        file_.seekp( Offset(key) );
+        file_.write
+        ( reinterpret_cast<const char*>(buffer), numEntries*sizeof(T) );
+    }
+
+    void Work()
+    {
+        while( true )
+        {
+            Request request;
+            {
+                std::unique_lock<std::mutex> lock( mutex_ );
+                cv_.wait
+                ( lock, [this]{ return stop_ || !requests_.empty(); } );
+                if( requests_.empty() )
+                    return; // only stop once all writebacks have landed
+                request = std::move( requests_.front() );
+                requests_.pop_front();
+                ++numActive_;
+            }
+            if( request.store )
+                WriteTile( request.key, request.buffer, request.numEntries );
+            else
+                ReadTile( request.key, request.buffer, request.numEntries );
+            {
+                std::unique_lock<std::mutex> lock( mutex_ );
+                --numActive_;
+                if( request.loadingFlag != nullptr )
+                    request.loadingFlag->store( false );
+                if( request.owned )
+                    retired_.push_back( std::move(request.owned) );
+            }
+            cv_.notify_all();
+        }
+    }
+
+    void WaitForWorker()
+    {
+        std::unique_lock<std::mutex> lock( mutex_ );
+        cv_.wait
+        ( lock, [this]{ return requests_.empty() && numActive_ == 0; } );
+    }
+
+    void Touch( Int key )
+    {
+        lru_.remove( key );
+        lru_.push_back( key );
+    }
+
+    // Destruct (on this thread) any tiles whose writebacks have completed
+    void CollectRetired()
+    {
+        vector<std::unique_ptr<Matrix<T>>> retired;
+        {
+            std::unique_lock<std::mutex> lock( mutex_ );
+            retired.swap( retired_ );
+        }
+    }
+
+    // Evict least-recently-used unpinned tiles until 'needed' more slots fit
+    void EnsureSpace( Int needed )
+    {
+        while( Int(resident_.size()) > maxResidentTiles_-needed )
+        {
+            auto lruIt = lru_.begin();
+            while( lruIt != lru_.end() )
+            {
+                auto resIt = resident_.find( *lruIt );
+                if( resIt->second.pins == 0 && !resIt->second.loading.load() )
+                    break;
+                ++lruIt;
+            }
+            if( lruIt == lru_.end() )
+                break; // every tile is pinned or in flight
+            const Int key = *lruIt;
+            auto resIt = resident_.find( key );
+            Slot& slot = resIt->second;
+            if( slot.dirty )
+            {
+                // Hand the tile to the I/O thread for asynchronous writeback
+                Request request;
+                request.store = true;
+                request.key = key;
+                request.buffer = slot.tile->Buffer();
+                request.numEntries = slot.tile->Height()*slot.tile->Width();
+                request.owned = std::move( slot.tile );
+                onDisk_[key] = true;
+                {
+                    std::unique_lock<std::mutex> lock( mutex_ );
+                    requests_.push_back( std::move(request) );
+                }
+                cv_.notify_all();
+            }
+            lru_.erase( lruIt );
+            resident_.erase( resIt );
+        }
+    }
+
+    void StartLoad( Int i, Int j )
+    {
+        const Int key = Key(i,j);
+        if( resident_.count(key) )
+        {
+            Touch( key );
+            return;
+        }
+        Slot& slot = resident_[key];
+        slot.tile.reset( new Matrix<T>( TileHeight(i), TileWidth(j) ) );
+        Touch( key );
+        if( !onDisk_[key] )
+        {
+            // First touch: the tile materializes as zero
+            Zero( *slot.tile );
+            return;
+        }
+        slot.loading.store( true );
+        Request request;
+        request.store = false;
+        request.key = key;
+        request.buffer = slot.tile->Buffer();
+        request.numEntries = slot.tile->Height()*slot.tile->Width();
+        request.loadingFlag = &slot.loading;
+        {
+            std::unique_lock<std::mutex> lock( mutex_ );
+            requests_.push_back( std::move(request) );
+        }
+        cv_.notify_all();
+    }
+
+    Slot& WaitFor( Int i, Int j )
+    {
+        CollectRetired();
+        EnsureSpace( 1 );
+        StartLoad( i, j );
+        const Int key = Key(i,j);
+        Slot& slot = resident_[key];
+        if( slot.loading.load() )
+        {
+            std::unique_lock<std::mutex> lock( mutex_ );
+            cv_.wait( lock, [&slot]{ return !slot.loading.load(); } );
+        }
+        Touch( key );
+        return slot;
+    }
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_TILESTORE_HPP
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_TRACE_HPP
+#define EL_CORE_TRACE_HPP
+
+namespace El {
+namespace trace {
+
+// An always-compiled, low-overhead event tracer: while tracing is enabled,
+// instrumented regions (the major MPI collectives and the level-3 BLAS
+// dispatches) append fixed-size records to a per-process ring buffer, which
+// is dumped to a per-rank binary file at Finalize. While tracing is disabled,
+// each instrumentation point costs a single branch. Tracing may be switched
+// on either programmatically or by setting the EL_TRACE environment variable
+// (with an optional EL_TRACE_CAPACITY record count).
+
+enum EventCategory
+{
+    MPI_EVENT=0,
+    BLAS_EVENT=1
+};
+
+// A fixed-size record so that recording an event never allocates
+struct Event
+{
+    double start, stop; // seconds since the tracer was enabled
+    long long bytes;    // the principal payload (or working set) in bytes
+    int commSize;       // the number of ranks involved (one for local events)
+    int category;       // an EventCategory
+    char name[16];      // a null-terminated event label
+};
+
+// Enabling (re)allocates the ring buffer, whose capacity defaults to 2^20
+// records; once the buffer wraps, the oldest events are overwritten
+void Enable( Int capacity=0 );
+void Disable();
+bool Enabled() EL_NO_EXCEPT;
+
+// The number of seconds since the tracer was enabled
+double LocalTime();
+
+// Running totals over the recorded events (unlike the ring buffer itself,
+// these survive wrap-around), e.g., for reporting communication volume
+long long NumRecordedEvents();
+long long MPIVolume();
+
+void RecordEvent
+( EventCategory category, const char* name,
+  double start, double stop, long long bytes, int commSize );
+
+// Write the recorded events (preceded by a small self-describing header) to
+// the given file; the no-argument form uses the per-rank default name,
+// "El-Trace-ProcXXX.bin", and is invoked automatically by Finalize
+void Dump( const string& filename );
+void Dump();
+
+// An RAII instrumentation region; the communicator-size overload defers its
+// (local, but not free) size query until tracing is known to be enabled
+class Region
+{
+public:
+    Region
+    ( EventCategory category, const char* name,
+      long long bytes, int commSize=1 )
+    {
+        if( !Enabled() )
+            return;
+        active_ = true;
+        category_ = category;
+        name_ = name;
+        bytes_ = bytes;
+        commSize_ = commSize;
+        start_ = LocalTime();
+    }
+
+    Region
+    ( EventCategory category, const char* name,
+      long long bytes, mpi::Comm comm )
+    {
+        if( !Enabled() )
+            return;
+        active_ = true;
+        category_ = category;
+        name_ = name;
+        bytes_ = bytes;
+        commSize_ = mpi::Size( comm );
+        start_ = LocalTime();
+    }
+
+    ~Region()
+    {
+        if( active_ )
+            RecordEvent
+            ( category_, name_, start_, LocalTime(), bytes_, commSize_ );
+    }
+
+private:
+    bool active_=false;
+    EventCategory category_=MPI_EVENT;
+    const char* name_="";
+    long long bytes_=0;
+    int commSize_=1;
+    double start_=0;
+};
+
+} // namespace trace
+} // namespace El
+
+#endif // ifndef EL_CORE_TRACE_HPP
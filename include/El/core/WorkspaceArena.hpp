@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_WORKSPACEARENA_HPP
+#define EL_CORE_WORKSPACEARENA_HPP
+
+#include <map>
+
+namespace El {
+
+// A per-grid arena of reusable distributed temporaries. Algorithms such as
+// the SUMMA variants construct the same handful of distribution-typed
+// workspaces on every invocation, paying a fresh local allocation each
+// time. Checking the temporaries out of the arena instead returns them to
+// a per-(type,distribution) cache on scope exit with their local buffers
+// intact, so a tight loop of fixed-shape products reaches a steady state
+// with zero allocations. The cache is keyed by the owning grid and is
+// flushed when that grid is destructed.
+//
+// The arena is not thread-safe; like the blocksize stack, it assumes that
+// distributed algorithms are driven from a single thread per rank.
+
+namespace workspace_arena {
+
+typedef function<void(const Grid*)> FlushFunction;
+
+inline vector<FlushFunction>& FlushFunctions()
+{
+    static vector<FlushFunction> flushFunctions;
+    return flushFunctions;
+}
+
+// Return every cached temporary associated with the given grid to the
+// system (called by the Grid destructor)
+inline void FlushGrid( const Grid* grid )
+{
+    for( auto& flush : FlushFunctions() )
+        flush( grid );
+}
+
+} // namespace workspace_arena
+
+template<typename T,Dist U,Dist V>
+class WorkspacePool
+{
+public:
+    static WorkspacePool<T,U,V>& Instance()
+    {
+        static WorkspacePool<T,U,V> pool;
+        return pool;
+    }
+
+    std::unique_ptr<DistMatrix<T,U,V>> Acquire( const Grid& grid )
+    {
+        auto& cache = cache_[&grid];
+        if( cache.empty() )
+            return std::unique_ptr<DistMatrix<T,U,V>>
+                   ( new DistMatrix<T,U,V>(grid) );
+        auto A = std::move( cache.back() );
+        cache.pop_back();
+        return A;
+    }
+
+    void Release( std::unique_ptr<DistMatrix<T,U,V>> A )
+    {
+        // Reset the metadata (including any alignment constraints) but
+        // keep the local buffer for the next checkout
+        A->Empty( false );
+        cache_[&A->Grid()].push_back( std::move(A) );
+    }
+
+    void Flush( const Grid* grid ) { cache_.erase( grid ); }
+
+private:
+    WorkspacePool()
+    {
+        workspace_arena::FlushFunctions().push_back
+        ( []( const Grid* grid ) { Instance().Flush( grid ); } );
+    }
+
+    std::map<const Grid*,
+             vector<std::unique_ptr<DistMatrix<T,U,V>>>> cache_;
+};
+
+// An RAII checkout from the arena, used exactly like a locally-declared
+// temporary:
+//
+//   ArenaMatrix<T,MC,STAR> A1Arena( g );
+//   auto& A1_MC_STAR = A1Arena.Get();
+//
+template<typename T,Dist U,Dist V>
+class ArenaMatrix
+{
+public:
+    explicit ArenaMatrix( const Grid& grid )
+    : mat_( WorkspacePool<T,U,V>::Instance().Acquire(grid) )
+    { }
+
+    ~ArenaMatrix()
+    {
+        if( mat_ )
+            WorkspacePool<T,U,V>::Instance().Release( std::move(mat_) );
+    }
+
+    ArenaMatrix( const ArenaMatrix<T,U,V>& ) = delete;
+    ArenaMatrix<T,U,V>& operator=( const ArenaMatrix<T,U,V>& ) = delete;
+
+    DistMatrix<T,U,V>& Get() { return *mat_; }
+    const DistMatrix<T,U,V>& Get() const { return *mat_; }
+
+private:
+    std::unique_ptr<DistMatrix<T,U,V>> mat_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_WORKSPACEARENA_HPP
@@ -93,6 +93,56 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// For getting and setting the number of threads available to Elemental's
+// hybrid parallel regions and to any threaded BLAS implementation. Setting
+// the count propagates it to the OpenMP runtime and to MKL/OpenBLAS so that
+// the two need not be configured separately, and queries issued from within
+// an active parallel region return a fair share of the configured count
+// rather than oversubscribing the machine
+Int NumThreads();
+void SetNumThreads( Int numThreads );
+
+// For manipulating the thread count as a stack (cf. PushBlocksizeStack),
+// e.g., to temporarily serialize threaded kernels around an
+// application-level parallel region
+void PushNumThreadsStack( Int numThreads );
+void PopNumThreadsStack();
+void EmptyNumThreadsStack();
+
+// For opting into shared-buffer copy-on-write semantics for Matrix
+// assignment, which turns the deep copies performed by read-only pipeline
+// stages into O(1) handoffs (the deep copy is deferred until a mutable
+// access of a shared buffer occurs)
+void EnableMatrixCopyOnWrite() EL_NO_EXCEPT;
+void DisableMatrixCopyOnWrite() EL_NO_EXCEPT;
+bool MatrixCopyOnWriteEnabled() EL_NO_EXCEPT;
+
+// Tuned per-routine blocksizes
+// ----------------------------
+// Routines may register blocksize tables keyed on a routine tag (typically
+// including the datatype, e.g., "Cholesky/double") and a minimum problem
+// size; queries select the entry with the largest minimum problem size not
+// exceeding the query and fall back to the global blocksize stack when no
+// entry applies.
+Int TunedBlocksize( const string& routine, Int problemSize );
+void SetTunedBlocksize
+( const string& routine, Int minProblemSize, Int blocksize );
+// Return whether any tuned entry has been registered for the routine tag
+// (queries for unregistered tags fall back to the global blocksize stack)
+bool HaveTunedBlocksize( const string& routine );
+void ClearTunedBlocksizes();
+// Tuning profiles are whitespace-separated text files whose lines have the
+// form "<routine> <minProblemSize> <blocksize>"; lines beginning with '#'
+// are ignored. The profile named by the environment variable
+// EL_TUNING_PROFILE is loaded during Initialize.
+void LoadTuningProfile( const string& filename );
+void SaveTuningProfile( const string& filename );
+
+// Append the datatype to the routine tag
+template<typename T>
+Int AlgorithmicBlocksize( const string& routine, Int problemSize )
+{ return TunedBlocksize( routine+"/"+TypeName<T>(), problemSize ); }
+
 template<typename T,
          typename=EnableIf<IsScalar<T>>>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT;
@@ -269,9 +319,28 @@ std::ostream & LogOS();
 
 template<typename... ArgPack>
 void Log( const ArgPack& ... args );
+// As above, but dropped (before any formatting) when 'level' exceeds the
+// current log verbosity
+template<typename... ArgPack>
+void LogAt( Int level, const ArgPack& ... args );
 
 void CloseLog();
 
+// Route log records through per-process buffers drained by a dedicated
+// writer thread so that file-system stalls never block the caller; each
+// record is timestamped (in seconds since the backend was enabled)
+void EnableAsynchronousLogging( bool async=true );
+bool AsynchronousLogging();
+
+// Records logged at a level above the verbosity, or from a rank rejected
+// by the filter, are dropped at the cost of a single branch
+void SetLogVerbosity( Int verbosity );
+Int LogVerbosity();
+void SetLogRankFilter( std::function<bool(int)> filter );
+
+bool ShouldLog( Int level );
+void WriteLog( const std::string& msg );
+
 void ReportException( const exception& e, ostream& os=cerr );
 
 void ComplainIfDebug();
@@ -399,7 +468,11 @@ Int Find( const vector<Int>& sortedInds, Int index );
  El::LogicError(EL_FUNCTION," in ",__FILE__,"@",__LINE__,": ",__VA_ARGS__);
 #define EL_RUNTIME_ERROR(...) \
  El::RuntimeError(EL_FUNCTION," in ",__FILE__,"@",__LINE__,": ",__VA_ARGS__);
-#define EL_DEBUG_CSE EL_DEBUG_ONLY(El::CSE cse(EL_FUNCTION))
+// In debug builds this maintains the call stack; in release builds it
+// plants the (branch-guarded) enter/exit marker for the sampling profiler
+#define EL_DEBUG_CSE \
+  EL_DEBUG_ONLY(El::CSE cse(EL_FUNCTION)) \
+  EL_RELEASE_ONLY(El::prof::Frame profFrame(EL_FUNCTION))
 
 } // namespace El
 
@@ -214,9 +214,21 @@ string DimsString( const MatType& A, string label )
 template<typename... ArgPack>
 void Log( const ArgPack& ... args )
 {
+    if( !ShouldLog(0) )
+        return;
     std::ostringstream str;
     BuildStream( str, args... );
-    LogOS() << str.str() << std::endl;
+    WriteLog( str.str() );
+}
+
+template<typename... ArgPack>
+void LogAt( Int level, const ArgPack& ... args )
+{
+    if( !ShouldLog(level) )
+        return;
+    std::ostringstream str;
+    BuildStream( str, args... );
+    WriteLog( str.str() );
 }
 
 template<typename... ArgPack>
@@ -249,7 +249,46 @@ void Gemv
 void Gemv
 ( char trans, BlasInt m, BlasInt n,
   const dcomplex& alpha,
-  const dcomplex* A, BlasInt ALDim, 
+  const dcomplex* A, BlasInt ALDim,
+  const dcomplex* x, BlasInt incx,
+  const dcomplex& beta,
+        dcomplex* y, BlasInt incy );
+
+// NOTE: AB is stored in the standard LAPACK band layout
+template<typename T>
+void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const T& alpha,
+  const T* AB, BlasInt ALDim,
+  const T* x, BlasInt incx,
+  const T& beta,
+        T* y, BlasInt incy );
+
+void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const float& alpha,
+  const float* AB, BlasInt ALDim,
+  const float* x, BlasInt incx,
+  const float& beta,
+        float* y, BlasInt incy );
+void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const double& alpha,
+  const double* AB, BlasInt ALDim,
+  const double* x, BlasInt incx,
+  const double& beta,
+        double* y, BlasInt incy );
+void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const scomplex& alpha,
+  const scomplex* AB, BlasInt ALDim,
+  const scomplex* x, BlasInt incx,
+  const scomplex& beta,
+        scomplex* y, BlasInt incy );
+void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const dcomplex& alpha,
+  const dcomplex* AB, BlasInt ALDim,
   const dcomplex* x, BlasInt incx,
   const dcomplex& beta,
         dcomplex* y, BlasInt incy );
@@ -0,0 +1,50 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IMPORTS_CUDA_HPP
+#define EL_IMPORTS_CUDA_HPP
+
+#ifdef EL_HAVE_CUDA
+namespace El {
+namespace gpu {
+
+// Lazily create (and eventually destroy) the cuBLAS handle and pinned
+// staging buffers used for offloading dense frontal updates
+void Initialize();
+void Finalize();
+
+// Whether a usable CUDA device was found during El::gpu::Initialize
+bool Available();
+
+// Offloading is disabled by default and may be activated either through
+// these routines or by setting the EL_GPU_FRONTS environment variable
+void EnableFrontOffload();
+void DisableFrontOffload();
+bool FrontOffloadEnabled();
+
+// The minimum number of rows in a front before offload is attempted
+// (small fronts are dominated by transfer latency)
+Int FrontOffloadThreshold();
+void SetFrontOffloadThreshold( Int thresh );
+
+// Attempt to perform an unpivoted LDL^T factorization of the frontal
+// matrix AL, with the trailing Schur complement accumulated onto ABR,
+// on the GPU. The diagonal panels are factored on the host while the
+// trapezoidal updates run through cuBLAS. A return value of 'false'
+// indicates that the caller should fall back to the CPU implementation.
+bool TryProcessFrontVanilla( Matrix<float>& AL, Matrix<float>& ABR );
+bool TryProcessFrontVanilla( Matrix<double>& AL, Matrix<double>& ABR );
+template<typename F>
+bool TryProcessFrontVanilla( Matrix<F>& AL, Matrix<F>& ABR )
+{ return false; }
+
+} // namespace gpu
+} // namespace El
+#endif // ifdef EL_HAVE_CUDA
+
+#endif // ifndef EL_IMPORTS_CUDA_HPP
@@ -736,6 +736,64 @@ void Eig
   dcomplex* X, BlasInt ldX,
   bool time=false );
 
+// Banded factorizations
+// =====================
+
+// Cholesky factorization of a Hermitian positive-definite band matrix
+// (stored in the standard LAPACK band layout)
+void BandCholesky( char uplo, BlasInt n, BlasInt kd, float* AB, BlasInt ldAB );
+void BandCholesky( char uplo, BlasInt n, BlasInt kd, double* AB, BlasInt ldAB );
+void BandCholesky
+( char uplo, BlasInt n, BlasInt kd, scomplex* AB, BlasInt ldAB );
+void BandCholesky
+( char uplo, BlasInt n, BlasInt kd, dcomplex* AB, BlasInt ldAB );
+
+void BandCholeskySolve
+( char uplo, BlasInt n, BlasInt kd, BlasInt numRHS,
+  const float* AB, BlasInt ldAB, float* B, BlasInt ldB );
+void BandCholeskySolve
+( char uplo, BlasInt n, BlasInt kd, BlasInt numRHS,
+  const double* AB, BlasInt ldAB, double* B, BlasInt ldB );
+void BandCholeskySolve
+( char uplo, BlasInt n, BlasInt kd, BlasInt numRHS,
+  const scomplex* AB, BlasInt ldAB, scomplex* B, BlasInt ldB );
+void BandCholeskySolve
+( char uplo, BlasInt n, BlasInt kd, BlasInt numRHS,
+  const dcomplex* AB, BlasInt ldAB, dcomplex* B, BlasInt ldB );
+
+// LU factorization of a general band matrix with partial pivoting
+// (AB requires ldAB >= 2*kl+ku+1, with the matrix beginning in row kl,
+//  in order to leave room for the fill-in generated by the row swaps)
+void BandLU
+( BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  float* AB, BlasInt ldAB, BlasInt* ipiv );
+void BandLU
+( BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  double* AB, BlasInt ldAB, BlasInt* ipiv );
+void BandLU
+( BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  scomplex* AB, BlasInt ldAB, BlasInt* ipiv );
+void BandLU
+( BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  dcomplex* AB, BlasInt ldAB, BlasInt* ipiv );
+
+void BandLUSolve
+( char trans, BlasInt n, BlasInt kl, BlasInt ku, BlasInt numRHS,
+  const float* AB, BlasInt ldAB, const BlasInt* ipiv,
+  float* B, BlasInt ldB );
+void BandLUSolve
+( char trans, BlasInt n, BlasInt kl, BlasInt ku, BlasInt numRHS,
+  const double* AB, BlasInt ldAB, const BlasInt* ipiv,
+  double* B, BlasInt ldB );
+void BandLUSolve
+( char trans, BlasInt n, BlasInt kl, BlasInt ku, BlasInt numRHS,
+  const scomplex* AB, BlasInt ldAB, const BlasInt* ipiv,
+  scomplex* B, BlasInt ldB );
+void BandLUSolve
+( char trans, BlasInt n, BlasInt kl, BlasInt ku, BlasInt numRHS,
+  const dcomplex* AB, BlasInt ldAB, const BlasInt* ipiv,
+  dcomplex* B, BlasInt ldB );
+
 } // namespace lapack
 
 } // namespace El
@@ -13,6 +13,11 @@
 namespace El {
 namespace mkl {
 
+// For querying and controlling MKL's internal thread count (normally via
+// the central El::SetNumThreads rather than directly)
+void SetNumThreads( int numThreads );
+int NumThreads();
+
 void csrmv
 ( Orientation orientation, BlasInt m, BlasInt k,
   float alpha, const char* matDescrA,
@@ -38,6 +43,59 @@ void csrmv
   const BlasInt* pntrb, const BlasInt* pntre,
   const Complex<double>* x, Complex<double> beta, Complex<double>* y );
 
+// Inspector-executor sparse handles
+// ---------------------------------
+// An opaque handle for MKL's inspector-executor representation of a CSR
+// matrix. Creation registers the usage hints and runs the inspector, so a
+// handle should be reused across many multiplies to amortize the analysis.
+// The handle references (rather than copies) the CSR arrays: the values may
+// be rewritten in place between multiplies, but the handle must be destroyed
+// and recreated whenever the sparsity pattern (and therefore the buffers)
+// change.
+typedef void* SparseCSRHandle;
+
+SparseCSRHandle CreateSparseCSR
+( BlasInt m, BlasInt n,
+  const BlasInt* rowOffsets, const BlasInt* colIndices,
+  const float* values, BlasInt expectedCalls );
+SparseCSRHandle CreateSparseCSR
+( BlasInt m, BlasInt n,
+  const BlasInt* rowOffsets, const BlasInt* colIndices,
+  const double* values, BlasInt expectedCalls );
+SparseCSRHandle CreateSparseCSR
+( BlasInt m, BlasInt n,
+  const BlasInt* rowOffsets, const BlasInt* colIndices,
+  const Complex<float>* values, BlasInt expectedCalls );
+SparseCSRHandle CreateSparseCSR
+( BlasInt m, BlasInt n,
+  const BlasInt* rowOffsets, const BlasInt* colIndices,
+  const Complex<double>* values, BlasInt expectedCalls );
+
+void DestroySparseCSR( SparseCSRHandle handle );
+
+// Y := alpha op(A) X + beta Y for column-major X and Y (the leading
+// dimensions are ignored when there is only a single right-hand side)
+void SparseCSRMultiply
+( Orientation orientation, BlasInt numRHS,
+  float alpha, SparseCSRHandle handle,
+  const float* X, BlasInt ldX,
+  float beta, float* Y, BlasInt ldY );
+void SparseCSRMultiply
+( Orientation orientation, BlasInt numRHS,
+  double alpha, SparseCSRHandle handle,
+  const double* X, BlasInt ldX,
+  double beta, double* Y, BlasInt ldY );
+void SparseCSRMultiply
+( Orientation orientation, BlasInt numRHS,
+  Complex<float> alpha, SparseCSRHandle handle,
+  const Complex<float>* X, BlasInt ldX,
+  Complex<float> beta, Complex<float>* Y, BlasInt ldY );
+void SparseCSRMultiply
+( Orientation orientation, BlasInt numRHS,
+  Complex<double> alpha, SparseCSRHandle handle,
+  const Complex<double>* X, BlasInt ldX,
+  Complex<double> beta, Complex<double>* Y, BlasInt ldY );
+
 void omatcopy
 ( Orientation orientation, BlasInt m, BlasInt n,
   float alpha, const float* A, BlasInt lda, float* B, BlasInt ldb );
@@ -180,6 +238,45 @@ void Trrk
         dcomplex beta,
         dcomplex* C, BlasInt CLDim );
 
+// Grouped batches of GEMM's issued through a single call; entries within
+// group g share the dimension, transposition, and scaling data at index g
+void GemmBatch
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const float* alphaList,
+  const float** AList, const BlasInt* ALDimList,
+  const float** BList, const BlasInt* BLDimList,
+  const float* betaList,
+        float** CList, const BlasInt* CLDimList,
+  BlasInt groupCount, const BlasInt* groupSizeList );
+void GemmBatch
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const double* alphaList,
+  const double** AList, const BlasInt* ALDimList,
+  const double** BList, const BlasInt* BLDimList,
+  const double* betaList,
+        double** CList, const BlasInt* CLDimList,
+  BlasInt groupCount, const BlasInt* groupSizeList );
+void GemmBatch
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const scomplex* alphaList,
+  const scomplex** AList, const BlasInt* ALDimList,
+  const scomplex** BList, const BlasInt* BLDimList,
+  const scomplex* betaList,
+        scomplex** CList, const BlasInt* CLDimList,
+  BlasInt groupCount, const BlasInt* groupSizeList );
+void GemmBatch
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const dcomplex* alphaList,
+  const dcomplex** AList, const BlasInt* ALDimList,
+  const dcomplex** BList, const BlasInt* BLDimList,
+  const dcomplex* betaList,
+        dcomplex** CList, const BlasInt* CLDimList,
+  BlasInt groupCount, const BlasInt* groupSizeList );
+
 } // namespace mkl
 } // namespace El
 #endif // ifdef EL_HAVE_MKL
@@ -76,6 +76,16 @@ inline bool operator==( const Op& a, const Op& b ) EL_NO_EXCEPT
 inline bool operator!=( const Op& a, const Op& b ) EL_NO_EXCEPT
 { return a.op != b.op; }
 
+struct Window
+{
+    MPI_Win win;
+    Window( MPI_Win mpiWin=MPI_WIN_NULL ) EL_NO_EXCEPT : win(mpiWin) { }
+};
+inline bool operator==( const Window& a, const Window& b ) EL_NO_EXCEPT
+{ return a.win == b.win; }
+inline bool operator!=( const Window& a, const Window& b ) EL_NO_EXCEPT
+{ return a.win != b.win; }
+
 // Datatype definitions
 // TODO(poulson): Convert these to structs/classes
 typedef MPI_Aint Aint;
@@ -207,6 +217,46 @@ Op& MaxLocPairOp() { return Types<Entry<T>>::maxOp; }
 template<typename T>
 Op& MinLocPairOp() { return Types<Entry<T>>::minOp; }
 
+// Derived-datatype cache for strided local matrices
+// -------------------------------------------------
+// A committed vector datatype describing a height x width column-major
+// matrix with leading dimension ldim, cached per process and keyed on
+// (element type, height, width, ldim) so that strided local submatrices
+// can be handed to MPI without an intermediate pack into a contiguous
+// staging buffer
+template<typename T,
+         typename=EnableIf<IsPacked<T>>>
+Datatype StridedMatrixType( int height, int width, int ldim )
+EL_NO_RELEASE_EXCEPT;
+
+// Whether handing MPI the strided datatype is expected to beat an explicit
+// pack: datatype engines process one column at a time, so the zero-copy
+// path only wins once the columns themselves are long enough to be
+// bandwidth-bound
+bool UseStridedMatrixType
+( int height, int width, int ldim, size_t elemSize ) EL_NO_EXCEPT;
+int StridedMatrixTypeThreshold() EL_NO_EXCEPT;
+void SetStridedMatrixTypeThreshold( int numBytes ) EL_NO_EXCEPT;
+
+// Internally called once between MPI_Init and MPI_Finalize
+void DestroyStridedMatrixTypes() EL_NO_RELEASE_EXCEPT;
+
+// Exchange strided local matrices through the cached datatypes (datatypes
+// which require serialization instead pack into intermediate buffers)
+template<typename T,
+         typename=EnableIf<IsPacked<T>>>
+void StridedSendRecv
+( const T* sbuf, int sendHeight, int sendWidth, int sendLDim, int to,
+        T* rbuf, int recvHeight, int recvWidth, int recvLDim, int from,
+  Comm comm ) EL_NO_RELEASE_EXCEPT;
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void StridedSendRecv
+( const T* sbuf, int sendHeight, int sendWidth, int sendLDim, int to,
+        T* rbuf, int recvHeight, int recvWidth, int recvLDim, int from,
+  Comm comm ) EL_NO_RELEASE_EXCEPT;
+
 // Added constant(s)
 const int MIN_COLL_MSG = 1; // minimum message size for collectives
 inline int Pad( int count ) EL_NO_EXCEPT
@@ -228,6 +278,22 @@ void Create( UserFunction* func, bool commutes, Op& op ) EL_NO_RELEASE_EXCEPT;
 void Free( Op& op ) EL_NO_RELEASE_EXCEPT;
 void Free( Datatype& type ) EL_NO_RELEASE_EXCEPT;
 
+// Progress engine
+// ---------------
+// Most MPI implementations only advance nonblocking operations from within
+// MPI calls, so communication issued to overlap with long local kernels
+// (e.g., within the pipelined matrix-multiplication algorithms) can
+// silently serialize. The progress engine spawns a thread which
+// periodically pokes the MPI runtime (via MPI_Iprobe on a private duplicate
+// of the supplied communicator, which cannot match application traffic) so
+// that outstanding operations complete in the background. Starting it
+// requires MPI to have been initialized with THREAD_MULTIPLE support, e.g.,
+// via a hybrid build of Elemental; to enable it for a particular grid,
+// simply pass in that grid's communicator.
+void StartProgressEngine( Comm comm=COMM_WORLD, int pollMicroseconds=100 );
+void StopProgressEngine();
+bool ProgressEngineEnabled() EL_NO_EXCEPT;
+
 // Communicator manipulation
 int Rank( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
 int Size( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
@@ -327,6 +393,67 @@ void SetUserReduceFunc
         Types<T>::userFunc = func;
 }
 
+// One-sided communication
+// =======================
+// Expose 'numBytes' bytes beginning at 'buffer' for passive-target access
+// by the members of 'comm' (the displacement unit is a byte, though the
+// typed operations below take offsets in units of their element type)
+void WindowCreate
+( void* buffer, size_t numBytes, Comm comm, Window& window )
+EL_NO_RELEASE_EXCEPT;
+void WindowFree( Window& window ) EL_NO_RELEASE_EXCEPT;
+
+// Whether MPI-3 shared-memory windows are available
+bool SharedMemoryWindowsSupported() EL_NO_EXCEPT;
+// Collectively allocate a shared-memory window over 'comm', whose members
+// must be shared-memory peers (e.g., the intra-node piece produced by
+// SplitIntoNodes); 'baseBuf' receives the base of the calling process's
+// contribution of 'numBytes' bytes, which may be zero
+void WindowAllocateShared
+( size_t numBytes, Comm comm, Window& window, void*& baseBuf )
+EL_NO_RELEASE_EXCEPT;
+// Query the base of the given rank's segment of a shared-memory window
+void* WindowSharedQuery( int rank, Window& window ) EL_NO_RELEASE_EXCEPT;
+
+// Open/close a passive-target access epoch at the given rank; the origin
+// buffers of the operations issued within the epoch may only be reused
+// (and the results of Gets only read) after the epoch is closed
+void WindowLock( int rank, Window& window, bool shared=true )
+EL_NO_RELEASE_EXCEPT;
+void WindowUnlock( int rank, Window& window ) EL_NO_RELEASE_EXCEPT;
+
+// Read 'count' entries beginning at entry 'targetOffset' of the target's
+// window into 'buf'
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void Get
+( Real* buf, int count, int target, Aint targetOffset, Window& window )
+EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void Get
+( Complex<Real>* buf, int count, int target, Aint targetOffset,
+  Window& window ) EL_NO_RELEASE_EXCEPT;
+
+// Remotely sum the 'count' entries of 'buf' onto the entries beginning at
+// entry 'targetOffset' of the target's window
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void Accumulate
+( const Real* buf, int count, int target, Aint targetOffset, Window& window )
+EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void Accumulate
+( const Complex<Real>* buf, int count, int target, Aint targetOffset,
+  Window& window ) EL_NO_RELEASE_EXCEPT;
+
+// Atomically add 'value' onto the Int at entry 'targetOffset' of the
+// target's window and return its previous contents; the result is only
+// defined once the enclosing access epoch has been closed. Requires MPI-3.
+Int FetchAndAdd( Int value, int target, Aint targetOffset, Window& window )
+EL_NO_RELEASE_EXCEPT;
+
 // Point-to-point communication
 // ============================
 
@@ -593,6 +720,70 @@ template<typename T>
 void SendRecv( T* buf, int count, int to, int from, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+// Large-count interface
+// =====================
+// The classical MPI interface caps every transfer at 2^31-1 elements; the
+// following overloads of the workhorse routines accept 64-bit counts and
+// map onto the MPI-4 large-count routines (MPI_Send_c et al.) when the
+// implementation provides them, falling back to a sequence of calls with
+// counts small enough for the classical interface otherwise. Note that,
+// when Elemental is configured with 64-bit integers, passing an Int count
+// selects these overloads automatically.
+template<typename T>
+void Send( const T* buf, long long count, int to, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void Recv( T* buf, long long count, int from, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void Broadcast( T* buf, long long count, int root, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void AllGather
+( const T* sbuf, long long sc,
+        T* rbuf, long long rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void AllReduce
+( const T* sbuf, T* rbuf, long long count, Op op, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void AllReduce( T* buf, long long count, Op op, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+
+// Dispatch every other integral count type (e.g., the size_t returned by
+// vector::size) through the 64-bit count entry points. Such counts would
+// otherwise be ambiguous, since they convert equally well to int and to
+// long long; an exact match here wins overload resolution, while int and
+// long long counts still prefer the (more specialized) overloads above.
+template<typename T,typename S,typename=EnableIf<IsIntegral<S>>>
+void Send( const T* buf, S count, int to, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{ Send( buf, (long long)count, to, comm ); }
+template<typename T,typename S,typename=EnableIf<IsIntegral<S>>>
+void Recv( T* buf, S count, int from, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{ Recv( buf, (long long)count, from, comm ); }
+template<typename T,typename S,typename=EnableIf<IsIntegral<S>>>
+void Broadcast( T* buf, S count, int root, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{ Broadcast( buf, (long long)count, root, comm ); }
+template<typename T,typename S,typename U,
+         typename=EnableIf<IsIntegral<S>>,
+         typename=EnableIf<IsIntegral<U>>>
+void AllGather
+( const T* sbuf, S sc,
+        T* rbuf, U rc, Comm comm ) EL_NO_RELEASE_EXCEPT
+{ AllGather( sbuf, (long long)sc, rbuf, (long long)rc, comm ); }
+template<typename T,typename S,typename=EnableIf<IsIntegral<S>>>
+void AllReduce
+( const T* sbuf, T* rbuf, S count, Op op, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{ AllReduce( sbuf, rbuf, (long long)count, op, comm ); }
+template<typename T,typename S,typename=EnableIf<IsIntegral<S>>>
+void AllReduce( T* buf, S count, Op op, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{ AllReduce( buf, (long long)count, op, comm ); }
+
 // Collective communication
 // ========================
 
@@ -751,6 +942,28 @@ void AllGather
         T* rbuf, const int* rcs, const int* rds, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+// Nonblocking AllGather with variable recv sizes
+// ----------------------------------------------
+// NOTE: The count and displacement arrays must remain valid until the
+//       request completes. When MPI-3 nonblocking collectives are
+//       unavailable the gather is performed immediately and the request
+//       completes trivially.
+template<typename T,
+         typename=EnableIf<IsPacked<T>>>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<T>& request )
+EL_NO_RELEASE_EXCEPT;
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<T>& request )
+EL_NO_RELEASE_EXCEPT;
+
 // Scatter
 // -------
 template<typename Real,
@@ -989,6 +1202,50 @@ T AllReduce
 template<typename T>
 T AllReduce( T sb, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Persistent AllReduce
+// --------------------
+// A reusable handle for an AllReduce which is issued repeatedly with the
+// same buffers, count, op, and communicator (e.g., once per iteration of
+// power iteration or an Interior Point Method). When MPI_Allreduce_init is
+// available (see EL_HAVE_MPI_PERSISTENT_COLLECTIVES), the setup and schedule
+// costs are paid once at initialization; otherwise each Start() simply
+// issues a standard blocking AllReduce.
+template<typename T>
+class PersistentAllReduce
+{
+public:
+    PersistentAllReduce() EL_NO_EXCEPT { }
+    PersistentAllReduce( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
+    EL_NO_RELEASE_EXCEPT
+    { Initialize( sbuf, rbuf, count, op, comm ); }
+    ~PersistentAllReduce() EL_NO_RELEASE_EXCEPT;
+
+    PersistentAllReduce( const PersistentAllReduce<T>& ) = delete;
+    PersistentAllReduce<T>& operator=( const PersistentAllReduce<T>& ) =
+      delete;
+
+    void Initialize( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
+    EL_NO_RELEASE_EXCEPT;
+    bool Initialized() const EL_NO_EXCEPT { return initialized_; }
+    void Free() EL_NO_RELEASE_EXCEPT;
+
+    // Begin and complete one round of the collective
+    void Start() EL_NO_RELEASE_EXCEPT;
+    void Wait() EL_NO_RELEASE_EXCEPT;
+    // A convenience blocking round
+    void Run() EL_NO_RELEASE_EXCEPT { Start(); Wait(); }
+
+private:
+    const T* sbuf_=nullptr;
+    T* rbuf_=nullptr;
+    int count_=0;
+    Op op_;
+    Comm comm_;
+    bool initialized_=false;
+    bool persistent_=false;
+    MPI_Request request_;
+};
+
 // Single-buffer AllReduce
 // -----------------------
 template<typename Real,
@@ -1022,6 +1279,103 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Nonblocking single-buffer AllReduce
+// -----------------------------------
+// NOTE: The buffer must remain valid (and unread) until the request
+//       completes. When MPI-3 nonblocking collectives are unavailable the
+//       reduction is performed immediately and the request completes
+//       trivially.
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce( Real* buf, int count, Op op, Comm comm,
+  Request<Real>& request )
+EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT;
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce( T* buf, int count, Op op, Comm comm,
+  Request<T>& request )
+EL_NO_RELEASE_EXCEPT;
+
+// Batched reductions
+// ------------------
+// Aggregates several scalar (or short-vector) summations into a single
+// AllReduce over a combined buffer so that latency-bound sequences of small
+// reductions, e.g., the norms and inner products of a Krylov iteration, pay
+// one message latency rather than one per quantity. Local contributions are
+// enqueued together with the location that the corresponding reduced value
+// should be written to, and all pending reductions are performed by Flush.
+// An optional finalizing function (e.g., a square root for a two-norm) is
+// applied to each reduced value just before it is stored. Every member of
+// the communicator must enqueue the same sequence of reductions before
+// flushing.
+template<typename T>
+class ReductionBatch
+{
+public:
+    explicit ReductionBatch( Comm comm, Op op=SUM )
+    : comm_(comm), op_(op)
+    { }
+
+    // Enqueue 'count' local summands whose reduced values should be written
+    // to 'buf' when the batch is flushed
+    void Queue( const T* localBuf, T* buf, Int count )
+    {
+        localValues_.insert( localValues_.end(), localBuf, localBuf+count );
+        entries_.push_back( Entry{buf,count,function<T(const T&)>()} );
+    }
+
+    void Queue( const T& localValue, T& value )
+    { Queue( &localValue, &value, 1 ); }
+
+    void Queue
+    ( const T& localValue, T& value, function<T(const T&)> finalize )
+    {
+        Queue( &localValue, &value, 1 );
+        entries_.back().finalize = std::move(finalize);
+    }
+
+    Int NumQueued() const EL_NO_EXCEPT { return Int(entries_.size()); }
+
+    // Perform the pending reductions with a single AllReduce on the combined
+    // buffer and scatter the results to their requested locations
+    void Flush()
+    {
+        if( entries_.empty() )
+            return;
+        AllReduce( localValues_.data(), int(localValues_.size()), op_, comm_ );
+        Int offset = 0;
+        for( const auto& entry : entries_ )
+        {
+            for( Int k=0; k<entry.count; ++k )
+                entry.buf[k] =
+                  ( entry.finalize ? entry.finalize(localValues_[offset+k])
+                                   : localValues_[offset+k] );
+            offset += entry.count;
+        }
+        localValues_.clear();
+        entries_.clear();
+    }
+
+private:
+    struct Entry
+    {
+        T* buf;
+        Int count;
+        function<T(const T&)> finalize;
+    };
+
+    Comm comm_;
+    Op op_;
+    vector<T> localValues_;
+    vector<Entry> entries_;
+};
+
 // ReduceScatter
 // -------------
 template<typename Real,
@@ -1231,6 +1585,71 @@ void VerifySendsAndRecvs
 ( const vector<int>& sendCounts,
   const vector<int>& recvCounts, Comm comm );
 
+// Node-aware collectives
+// ======================
+// Large reductions can be staged shared-memory-first: an intra-node
+// reduction to a node leader, an inter-node AllReduce amongst the leaders,
+// and an intra-node broadcast. The necessary intra-node and inter-node
+// subcommunicators are split once per registered communicator (each Grid
+// registers its full vector communicator at construction), and sufficiently
+// large AllReduces over a registered communicator are then automatically
+// routed through the two-level algorithm.
+//
+// The hierarchical routing is opt-in (see EnableMemoryPool for the
+// analogous allocator control)
+void EnableHierarchicalCollectives() EL_NO_EXCEPT;
+void DisableHierarchicalCollectives() EL_NO_EXCEPT;
+bool HierarchicalCollectivesEnabled() EL_NO_EXCEPT;
+// The minimum number of entries before an AllReduce is staged (the
+// node-leader hops are pure overhead for latency-bound messages)
+int HierarchicalCollectiveThreshold() EL_NO_EXCEPT;
+void SetHierarchicalCollectiveThreshold( int numEntries ) EL_NO_EXCEPT;
+
+// Split a communicator into an intra-node piece (shared-memory peers, via
+// MPI_Comm_split_type where MPI-3 is available) and an inter-node piece
+// (the processes with the same intra-node rank); both are collective
+void SplitIntoNodes
+( Comm comm, Comm& nodeComm, Comm& crossNodeComm ) EL_NO_RELEASE_EXCEPT;
+// Idempotently split and cache the node decomposition of a communicator
+// (collective over said communicator)
+void RegisterNodeSplit( Comm comm ) EL_NO_RELEASE_EXCEPT;
+void FreeNodeSplit( Comm comm ) EL_NO_RELEASE_EXCEPT;
+
+// File I/O
+// ========
+// Thin wrappers around MPI-IO which allow every rank to concurrently read
+// or write its own portion of a shared file
+void FileOpen
+( Comm comm, const char* filename, int accessMode, MPI_File& file )
+EL_NO_RELEASE_EXCEPT;
+void FileClose( MPI_File& file ) EL_NO_RELEASE_EXCEPT;
+MPI_Offset FileGetSize( MPI_File& file ) EL_NO_RELEASE_EXCEPT;
+void FileSetSize( MPI_File& file, MPI_Offset numBytes ) EL_NO_RELEASE_EXCEPT;
+
+// Set a file view whose elements are of type T and spaced 'stride' entries
+// apart in the file, beginning 'offset' bytes into it, so that a contiguous
+// read or write accesses a strided local section
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void FileSetStridedView( MPI_File& file, MPI_Offset offset, int stride )
+EL_NO_RELEASE_EXCEPT;
+
+// Read or write 'count' entries at the current view and position
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void FileRead( MPI_File& file, T* buf, int count ) EL_NO_RELEASE_EXCEPT;
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void FileWrite( MPI_File& file, const T* buf, int count )
+EL_NO_RELEASE_EXCEPT;
+
+// Read or write 'count' entries at an explicit byte offset (using the
+// default byte view)
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void FileReadAt( MPI_File& file, MPI_Offset offset, T* buf, int count )
+EL_NO_RELEASE_EXCEPT;
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void FileWriteAt
+( MPI_File& file, MPI_Offset offset, const T* buf, int count )
+EL_NO_RELEASE_EXCEPT;
+
 void CreateCustom() EL_NO_RELEASE_EXCEPT;
 void DestroyCustom() EL_NO_RELEASE_EXCEPT;
 
@@ -22,10 +22,22 @@
 # else
 #  define EL_SIMD
 # endif
+# ifdef EL_HAVE_OMP_TASK
+#  define EL_TASK_REGION _Pragma("omp parallel") _Pragma("omp single")
+#  define EL_TASK _Pragma("omp task default(shared)")
+#  define EL_TASKWAIT _Pragma("omp taskwait")
+# else
+#  define EL_TASK_REGION
+#  define EL_TASK
+#  define EL_TASKWAIT
+# endif
 #else
-# define EL_PARALLEL_FOR 
+# define EL_PARALLEL_FOR
 # define EL_PARALLEL_FOR_COLLAPSE2
 # define EL_SIMD
+# define EL_TASK_REGION
+# define EL_TASK
+# define EL_TASKWAIT
 #endif
 
 #ifdef EL_AVOID_OMP_FMA
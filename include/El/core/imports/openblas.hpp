@@ -13,6 +13,11 @@
 namespace El {
 namespace openblas {
 
+// For querying and controlling OpenBLAS's internal thread count (normally
+// via the central El::SetNumThreads rather than directly)
+void SetNumThreads( int numThreads );
+int NumThreads();
+
 void omatcopy
 ( Orientation orientation, BlasInt m, BlasInt n,
   float alpha, const float* A, BlasInt lda, float* B, BlasInt ldb );  
@@ -12,6 +12,17 @@
 namespace El {
 namespace herm_tridiag_eig {
 
+// Set the number of worker threads per rank for PMRRR's internal pthread
+// layer (which parallelizes the tasks of its representation tree). A
+// non-positive value restores the default, which is the OpenMP thread count
+// in hybrid builds (or the PMR_NUM_THREADS environment variable, if set).
+// Multithreaded execution requires MPI to have been initialized with at
+// least MPI_THREAD_FUNNELED support, as hybrid builds of Elemental request.
+void SetNumThreads( int numThreads );
+
+// The number of worker threads per rank that PMRRR will be asked to use
+int NumThreads();
+
 struct Estimate {
     int numLocalEigenvalues;
     int numGlobalEigenvalues;
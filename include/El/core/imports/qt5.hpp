@@ -20,6 +20,19 @@ void FinalizeQt5();
 // This is useful if images are to be written to file using Qt5's wrappers.
 bool GuiDisabled();
 
+// Return true if the "-async-gui" command-line flag deferred ownership of
+// the Qt application to a dedicated render thread, in which case Display
+// and Spy publish snapshot frames rather than painting on the calling
+// thread (see the asynchronous rendering section of El/io.hpp)
+bool AsyncGui();
+// The saved copies of the command-line arguments, which the render thread
+// needs in order to construct the deferred application object
+int& QtArgc();
+char**& QtArgv();
+// Invoked during FinalizeQt5 so that the render thread (which lives above
+// the core imports) can be shut down before the application is torn down
+void RegisterAsyncGuiCleanup( std::function<void()> cleanup );
+
 // When Elemental is finalized, if no window was opened, then it must call 
 // app.exit() instead
 void OpenedWindow();
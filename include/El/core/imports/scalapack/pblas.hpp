@@ -130,6 +130,25 @@ void Gemm
                   const dcomplex* B, const int* descB,
   dcomplex beta,        dcomplex* C, const int* descC );
 
+// Herk
+// ----
+void Herk
+( char uplo, char trans, int n, int k,
+  float alpha, const float* A, const int* descA,
+  float beta,        float* C, const int* descC );
+void Herk
+( char uplo, char trans, int n, int k,
+  double alpha, const double* A, const int* descA,
+  double beta,        double* C, const int* descC );
+void Herk
+( char uplo, char trans, int n, int k,
+  float alpha, const scomplex* A, const int* descA,
+  float beta,        scomplex* C, const int* descC );
+void Herk
+( char uplo, char trans, int n, int k,
+  double alpha, const dcomplex* A, const int* descA,
+  double beta,        dcomplex* C, const int* descC );
+
 // Trmm
 // ----
 void Trmm
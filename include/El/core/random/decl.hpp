@@ -99,6 +99,60 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>> 
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based sampling (in the style of Philox from Salmon et al.,
+// "Parallel random numbers: as easy as 1, 2, 3", SC'11). Each sample is a
+// keyed bijection of a 128-bit counter rather than a draw from a shared
+// stream, so entries keyed on their global index may be generated in
+// parallel, in any order, and bitwise identically on every process grid.
+void Philox4x32
+( const uint32_t key[2], const uint32_t ctr[4], uint32_t out[4] );
+
+// Fill 'out' with the four raw output words for the given (seed,stream,index)
+void CounterBits
+( uint64_t seed, uint64_t stream, uint64_t index, uint32_t out[4] );
+
+// The rank-independent seed shared by the counter-based samplers and the
+// stream index distinguishing successive fills. Each distributed fill
+// consumes one stream, so such fills must be invoked in the same order on
+// every rank for their results to remain consistent
+uint64_t CounterSeed();
+void SetCounterSeed( uint64_t seed );
+uint64_t NextCounterStream();
+
+// Return two uniform samples from [0,1) keyed on (seed,stream,index)
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void SampleUniformCounter
+( uint64_t seed, uint64_t stream, uint64_t index, Real& u0, Real& u1 );
+
+// Counter-based analogues of SampleBall and SampleNormal
+template<typename F,typename=EnableIf<IsComplex<F>>>
+F SampleBallCounter
+( uint64_t seed, uint64_t stream, uint64_t index,
+  const F& center=F(0), const Base<F>& radius=Base<F>(1) );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>,
+         typename=DisableIf<IsIntegral<Real>>>
+Real SampleBallCounter
+( uint64_t seed, uint64_t stream, uint64_t index,
+  const Real& center=Real(0), const Real& radius=Real(1) );
+template<typename T,
+         typename=EnableIf<IsIntegral<T>>,
+         typename=void,typename=void>
+T SampleBallCounter
+( uint64_t seed, uint64_t stream, uint64_t index,
+  const T& center=T(0), const T& radius=T(1) );
+
+template<typename F,typename=EnableIf<IsComplex<F>>>
+F SampleNormalCounter
+( uint64_t seed, uint64_t stream, uint64_t index,
+  const F& mean=F(0), const Base<F>& stddev=Base<F>(1) );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>,
+         typename=DisableIf<IsIntegral<Real>>>
+Real SampleNormalCounter
+( uint64_t seed, uint64_t stream, uint64_t index,
+  const Real& mean=Real(0), const Real& stddev=Real(1) );
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
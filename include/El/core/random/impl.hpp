@@ -223,6 +223,107 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(center-radius,center+radius); }
 
+// Map a pair of 32-bit counter output words into a sample from [0,1). The
+// generic formula is exact for the extended-precision types, whose mantissas
+// hold all 64 bits, but float and double must instead keep only as many of
+// the leading bits as fit exactly in the mantissa: the conversion of the
+// high word could otherwise round up (e.g., float(2^32-1) rounds to 2^32)
+// and return exactly one, which the Box-Muller transform maps to infinity.
+template<typename Real>
+Real UniformFromCounterBits( uint32_t hi, uint32_t lo )
+{
+    const Real inv32 = Real(1) / (Real(65536)*Real(65536));
+    return (Real(hi) + Real(lo)*inv32)*inv32;
+}
+template<>
+inline float UniformFromCounterBits<float>( uint32_t hi, uint32_t lo )
+{
+    // Keep the top 24 of the 64 bits
+    const float inv24 = 1.f / float(1u<<24);
+    return float(hi>>8)*inv24;
+}
+template<>
+inline double UniformFromCounterBits<double>( uint32_t hi, uint32_t lo )
+{
+    // Keep the top 53 of the 64 bits
+    const uint64_t bits = (uint64_t(hi)<<32) | lo;
+    const double inv53 = 1. / double(1ull<<53);
+    return double(bits>>11)*inv53;
+}
+
+template<typename Real,typename>
+void SampleUniformCounter
+( uint64_t seed, uint64_t stream, uint64_t index, Real& u0, Real& u1 )
+{
+    uint32_t out[4];
+    CounterBits( seed, stream, index, out );
+    u0 = UniformFromCounterBits<Real>( out[1], out[0] );
+    u1 = UniformFromCounterBits<Real>( out[3], out[2] );
+}
+
+template<typename F,typename>
+F SampleBallCounter
+( uint64_t seed, uint64_t stream, uint64_t index,
+  const F& center, const Base<F>& radius )
+{
+    typedef Base<F> Real;
+    Real u0, u1;
+    SampleUniformCounter( seed, stream, index, u0, u1 );
+    const Real r = radius*u0;
+    const Real angle = 2*Pi<Real>()*u1;
+    return center + F(r*Cos(angle),r*Sin(angle));
+}
+
+template<typename Real,typename,typename>
+Real SampleBallCounter
+( uint64_t seed, uint64_t stream, uint64_t index,
+  const Real& center, const Real& radius )
+{
+    Real u0, u1;
+    SampleUniformCounter( seed, stream, index, u0, u1 );
+    return (center-radius) + 2*radius*u0;
+}
+
+template<typename T,typename,typename,typename>
+T SampleBallCounter
+( uint64_t seed, uint64_t stream, uint64_t index,
+  const T& center, const T& radius )
+{
+    // Uniform over {center-radius,...,center+radius}, accepting the
+    // negligible modulo bias of reducing 64 random bits
+    uint32_t out[4];
+    CounterBits( seed, stream, index, out );
+    const unsigned long long bits =
+      ((unsigned long long)(out[1])<<32) | out[0];
+    const T span = T(2)*radius + T(1);
+    return (center-radius) + Mod( T(bits), span );
+}
+
+template<typename F,typename>
+F SampleNormalCounter
+( uint64_t seed, uint64_t stream, uint64_t index,
+  const F& mean, const Base<F>& stddev )
+{
+    typedef Base<F> Real;
+    Real u0, u1;
+    SampleUniformCounter( seed, stream, index, u0, u1 );
+    // The two members of the Box-Muller pair form the real and imaginary
+    // components, which thus each have standard deviation 'stddev'
+    const Real r = stddev*Sqrt(-2*Log(1-u0));
+    const Real angle = 2*Pi<Real>()*u1;
+    return mean + F(r*Cos(angle),r*Sin(angle));
+}
+
+template<typename Real,typename,typename>
+Real SampleNormalCounter
+( uint64_t seed, uint64_t stream, uint64_t index,
+  const Real& mean, const Real& stddev )
+{
+    Real u0, u1;
+    SampleUniformCounter( seed, stream, index, u0, u1 );
+    return mean + stddev*Sqrt(-2*Log(1-u0))*Cos(2*Pi<Real>()*u1);
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
@@ -238,7 +238,9 @@ typedef enum {
   EL_ASCII,
   EL_ASCII_MATLAB,
   EL_BINARY,
+  EL_BINARY_COMPRESSED,
   EL_BINARY_FLAT,
+  EL_BINARY_MMAP,
   EL_BMP,
   EL_JPG,
   EL_JPEG,
@@ -497,7 +497,9 @@ enum FileFormat
     ASCII,
     ASCII_MATLAB,
     BINARY,
+    BINARY_COMPRESSED,
     BINARY_FLAT,
+    BINARY_MMAP,
     BMP,
     JPG,
     JPEG,
@@ -72,6 +72,26 @@ namespace ldl { struct DistNodeInfo; }
 void DisplayLocal
 ( const ldl::DistNodeInfo& info, bool beforeFact, string title="" );
 
+// Asynchronous rendering
+// ----------------------
+// When the "-async-gui" command-line flag is passed, a dedicated render
+// thread owns the Qt application and its event loop, and Display/Spy
+// instead downsample their argument into a bounded frame, publish it to a
+// single-slot mailbox for its title, and return immediately. Publication is
+// an atomic pointer exchange (the newest frame simply replaces any
+// unconsumed predecessor), so always-on monitoring of a production solve
+// never blocks the compute threads on the display.
+void SetAsyncDisplayResolution( Int resolution );
+Int AsyncDisplayResolution();
+
+// Used internally by Display and Spy to publish frames to the render
+// thread, which is started by the first published frame
+void PushDisplayFrame( string title, Matrix<double>&& frame );
+void PushDisplayFrame( string title, Matrix<Complex<double>>&& frame );
+void PushSpyFrame( string title, Matrix<Int>&& frame );
+// Ask the render thread to quit and wait for it (called during Finalize)
+void StopAsyncDisplay();
+
 // Print
 // =====
 
@@ -113,6 +133,100 @@ void Print( const vector<T>& x, string title="vector", ostream& os=cout );
 
 // Read
 // ====
+
+// The header of the page-aligned, versioned BINARY_MMAP format. The data is
+// stored contiguously in column-major order beginning at 'dataOffset', which
+// is chosen as a multiple of the page size so that a sequential read may
+// attach a Matrix directly to a memory map of the file.
+struct BinaryMmapHeader
+{
+    char magic[8];
+    unsigned long long version;
+    unsigned long long height;
+    unsigned long long width;
+    unsigned long long elementSize;
+    unsigned long long dataOffset;
+};
+const char BINARY_MMAP_MAGIC[8] =
+  {'E','l','B','i','n','M','a','t'};
+const unsigned long long BINARY_MMAP_VERSION = 1;
+const unsigned long long BINARY_MMAP_DATA_OFFSET = 4096;
+
+// Used internally to track the memory map backing a BINARY_MMAP read
+void RegisterMemoryMap
+( const void* buffer, void* baseAddress, size_t numBytes );
+// Unmap the file backing a matrix attached by a BINARY_MMAP read. This must
+// not be called until the attached matrix is no longer in use.
+void FreeMemoryMap( const void* buffer );
+
+// The header of the chunked BINARY_COMPRESSED container, which stores each
+// chunk as an independently compressed, packed column-major block of entries
+// lying on a strided subset of the rows and columns. Sequential writes chunk
+// over contiguous column panels, while parallel writes store each rank's
+// local matrix as its own chunk, so that a restore (parallel or not) only
+// ever decompresses the chunks which intersect its portion of the matrix.
+struct BinaryCompressedHeader
+{
+    char magic[8];
+    unsigned long long version;
+    unsigned long long height;
+    unsigned long long width;
+    unsigned long long elementSize;
+    unsigned long long codec;
+    unsigned long long numChunks;
+};
+// The chunk table immediately follows the header; entry k describes the
+// entries (rowShift + s*rowStride, colShift + t*colStride), for
+// s in [0,localHeight) and t in [0,localWidth), stored by chunk k
+struct BinaryCompressedChunk
+{
+    unsigned long long offset;
+    unsigned long long compressedBytes;
+    unsigned long long rowShift, rowStride, localHeight;
+    unsigned long long colShift, colStride, localWidth;
+};
+const char BINARY_COMPRESSED_MAGIC[8] =
+  {'E','l','B','i','n','C','m','p'};
+const unsigned long long BINARY_COMPRESSED_VERSION = 1;
+
+// The codec applied to the chunks of a BINARY_COMPRESSED file. The built-in
+// codec transposes the bytes of each entry (so that the slowly-varying
+// high-order bytes of smooth floating-point fields form long runs) and then
+// run-length encodes the result; LZ4 and Zstd typically compress better and
+// faster but are only available when Elemental was configured against them.
+namespace CompressionNS {
+enum Compression
+{
+    COMPRESSION_NONE,
+    COMPRESSION_SHUFFLE_RLE,
+    COMPRESSION_LZ4,
+    COMPRESSION_ZSTD
+};
+}
+using namespace CompressionNS;
+
+bool HaveCompression( Compression codec );
+// Select the codec applied by subsequent BINARY_COMPRESSED writes (reads
+// recover the codec of each file from its header)
+void SetBinaryCompression( Compression codec );
+Compression BinaryCompression();
+// The target number of uncompressed bytes per chunk of a sequential write
+void SetCompressionChunkSize( Int numBytes );
+Int CompressionChunkSize();
+
+// Compress a buffer of whole entries into 'dst' (which is resized to the
+// compressed length), and decompress a chunk whose uncompressed length is
+// already known from the chunk table. The element size steers the shuffle
+// stage of the built-in codec (and is recorded in the file header). Chunks
+// are independent, so batches of either may be processed by concurrent
+// threads.
+void Compress
+( Compression codec, size_t elementSize,
+  const byte* src, size_t numBytes, vector<byte>& dst );
+void Decompress
+( Compression codec, size_t elementSize,
+  const byte* src, size_t numBytes, byte* dst, size_t dstNumBytes );
+
 template<typename T>
 void Read( Matrix<T>& A, const string filename, FileFormat format=AUTO );
 template<typename T>
@@ -127,6 +241,18 @@ template<typename T>
 void Read
 ( DistSparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
 
+// Collective MPI-IO reads in which every rank concurrently reads its own
+// portion of the file: BINARY and BINARY_MMAP are supported for dense
+// distributed matrices (via strided file views), and coordinate
+// MATRIX_MARKET files are parsed in parallel byte-range chunks for sparse
+// distributed matrices
+template<typename T>
+void ParallelRead
+( AbstractDistMatrix<T>& A, const string filename, FileFormat format=AUTO );
+template<typename T>
+void ParallelRead
+( DistSparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
+
 // Spy
 // ===
 template<typename T>
@@ -135,6 +261,20 @@ template<typename T>
 void Spy
 ( const AbstractDistMatrix<T>& A, string title="DistMatrix", Base<T> tol=0 );
 
+// Graphs and sparse matrices
+// --------------------------
+// Rather than materializing a copy of the operator on a single rank, each
+// rank bins its local entries into a fixed-resolution density grid and the
+// small grids are summed onto the root, which renders the result. This keeps
+// visual inspection of production-scale structure O(resolution^2) in both
+// memory and communication.
+void Spy
+( const DistGraph& graph, string title="DistGraph", Int resolution=2048 );
+template<typename T>
+void Spy
+( const DistSparseMatrix<T>& A, string title="DistSparseMatrix",
+  Base<T> tol=0, Int resolution=2048 );
+
 // Write
 // =====
 template<typename T>
@@ -146,6 +286,14 @@ void Write
 ( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
   FileFormat format=BINARY, string title="" );
 
+// A collective MPI-IO write in which every rank concurrently writes its own
+// local strided section; the resulting file is identical to a sequential
+// write of the same format (BINARY or BINARY_MMAP)
+template<typename T>
+void ParallelWrite
+( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
+  FileFormat format=BINARY );
+
 } // namespace El
 
 #ifdef EL_HAVE_QT5
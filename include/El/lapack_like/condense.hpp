@@ -16,13 +16,27 @@ namespace El {
 // Bidiag
 // ======
 
+template<typename Field>
+struct BidiagCtrl
+{
+    // If positive, the sequential algorithm first reduces the matrix to an
+    // upper band matrix of the given bandwidth with blocked level-3 kernels
+    // and then chases the band down to bidiagonal form. Only the
+    // band-reduction reflectors are accumulated, so this mode is only
+    // appropriate when the back-transformation is not needed (e.g., for
+    // singular values without singular vectors). Currently sequential only,
+    // and only for matrices at least as tall as they are wide.
+    Int twoStageBandwidth=0;
+};
+
 // Return the packed reduction to bidiagonal form
 // ----------------------------------------------
 template<typename Field>
 void Bidiag
 ( Matrix<Field>& A,
   Matrix<Field>& householderScalarsP,
-  Matrix<Field>& householderScalarsQ );
+  Matrix<Field>& householderScalarsQ,
+  const BidiagCtrl<Field>& ctrl=BidiagCtrl<Field>() );
 
 template<typename Field>
 void Bidiag
@@ -107,11 +121,23 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<Field> symvCtrl;
+
+    // If positive, the sequential algorithm first reduces the matrix to a
+    // Hermitian band matrix of the given bandwidth with blocked level-3
+    // kernels and then chases the band down to tridiagonal form. Only the
+    // band-reduction reflectors are accumulated, so this mode is only
+    // appropriate when the back-transformation is not needed (e.g., for
+    // eigenvalues without eigenvectors). Currently sequential lower-storage
+    // only.
+    Int twoStageBandwidth=0;
 };
 
 template<typename Field>
 void HermitianTridiag
-( UpperOrLower uplo, Matrix<Field>& A, Matrix<Field>& householderScalars );
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
 template<typename Field>
 void HermitianTridiag
 ( UpperOrLower uplo,
@@ -145,9 +171,24 @@ void ApplyQ
 
 // Hessenberg
 // ==========
+
+template<typename Field>
+struct HessenbergCtrl
+{
+    // If greater than one, the sequential upper algorithm first reduces the
+    // matrix to a block Hessenberg matrix with the given number of
+    // subdiagonals via blocked level-3 kernels and then chases the band down
+    // to Hessenberg form. Only the band-reduction reflectors are
+    // accumulated, so this mode is only appropriate when the similarity
+    // transformation is not needed (e.g., for eigenvalues without Schur
+    // vectors). Currently sequential upper-Hessenberg only.
+    Int twoStageBandwidth=0;
+};
+
 template<typename Field>
 void Hessenberg
-( UpperOrLower uplo, Matrix<Field>& A, Matrix<Field>& householderScalars );
+( UpperOrLower uplo, Matrix<Field>& A, Matrix<Field>& householderScalars,
+  const HessenbergCtrl<Field>& ctrl=HessenbergCtrl<Field>() );
 template<typename Field>
 void Hessenberg
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
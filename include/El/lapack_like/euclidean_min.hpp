@@ -78,6 +78,19 @@ struct LeastSquaresCtrl
 
     SQSDCtrl<Real> sqsdCtrl;
 
+    // Solve sufficiently rectangular sparse problems through the corrected
+    // seminormal equations instead of the (much larger) augmented system:
+    // the Gram matrix of the smaller dimension is formed sparsely and
+    // factored, and a step of seminormal refinement compensates for the
+    // squared conditioning. The augmented system remains the fallback
+    // whenever the aspect ratio is below 'normalEqRatio', a cheap estimate
+    // of cond(A) exceeds 'normalEqCondLimit' (past roughly eps^{-1/3} even
+    // the corrected solve becomes unreliable), or the factorization of the
+    // Gram matrix breaks down.
+    bool allowNormalEq=true;
+    Real normalEqRatio=Real(10);
+    Real normalEqCondLimit=Pow(limits::Epsilon<Real>(),Real(-1)/Real(3));
+
     bool equilibrate=true;
     bool progress=false;
     bool time=false;
@@ -155,6 +168,25 @@ void Ridge
         AbstractDistMatrix<Field>& X,
   RidgeAlg alg=RIDGE_CHOLESKY );
 
+// Solve the above for an entire sweep of regularization parameters while
+// only factoring A once: a single (thin) SVD is shared by every gamma, so
+// that each additional solution costs two small GEMM's and a diagonal
+// scaling rather than a fresh factorization.
+template<typename Field>
+void RidgeSweep
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const vector<Base<Field>>& gammas,
+        vector<Matrix<Field>>& XList );
+template<typename Field>
+void RidgeSweep
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const vector<Base<Field>>& gammas,
+        vector<DistMatrix<Field>>& XList );
+
 template<typename Field>
 void Ridge
 ( Orientation orientation,
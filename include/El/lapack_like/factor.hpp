@@ -26,6 +26,32 @@ void Cholesky
 template<typename Field>
 void Cholesky( UpperOrLower uplo, DistMatrix<Field,STAR,STAR>& A );
 
+namespace CholeskyVariantNS {
+enum CholeskyVariant {
+  // The standard blocked right-looking factorization
+  CHOLESKY_BLOCKED,
+  // Decompose the matrix into square tiles and execute the resulting
+  // POTRF/TRSM/HERK/GEMM task DAG through a work-stealing thread pool
+  CHOLESKY_TILED
+};
+}
+using namespace CholeskyVariantNS;
+
+struct CholeskyCtrl
+{
+    CholeskyVariant variant=CHOLESKY_BLOCKED;
+    // The tile dimension for CHOLESKY_TILED (if non-positive, the current
+    // algorithmic blocksize is used)
+    Int tileSize=0;
+    // The number of worker threads for CHOLESKY_TILED (if non-positive,
+    // the hardware concurrency is used)
+    Int numThreads=0;
+};
+
+template<typename Field>
+void Cholesky
+( UpperOrLower uplo, Matrix<Field>& A, const CholeskyCtrl& ctrl );
+
 template<typename Field>
 void ReverseCholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
@@ -57,6 +83,46 @@ void HPSDCholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
 
+// Early-exit pivoted Cholesky factorization for Hermitian positive
+// semi-definite matrices of low numerical rank (e.g., RBF kernel matrices):
+// greedy diagonal pivoting halts as soon as the trace of the (implicit)
+// Schur complement falls below relTol times the trace of A, and the
+// trailing matrix is never updated -- each column of the Schur complement
+// is instead formed lazily from the stored factor, for O( n k^2 ) total
+// work when k steps are taken. The achieved rank, k, is returned, and, on
+// exit, A ~= L L^H, where the n x k factor L is expressed in the original
+// ordering and P orders the selected pivots first (so that P L is lower
+// trapezoidal). Only the 'uplo' triangle of A is ever read, and a
+// non-positive maxRank is interpreted as no limit on the rank.
+template<typename Field>
+Int LowRankCholesky
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Matrix<Field>& L,
+        Permutation& P,
+  Base<Field> relTol,
+  Int maxRank=0 );
+template<typename Field>
+Int LowRankCholesky
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& L,
+        DistPermutation& P,
+  Base<Field> relTol,
+  Int maxRank=0 );
+
+// Out-of-core Cholesky factorization of a tile store whose in-core window
+// is paged against disk (only instantiated for the BLAS field types)
+template<typename Field>
+void Cholesky( UpperOrLower uplo, TileStore<Field>& A );
+
+// Cholesky factorization of a Hermitian positive-definite band matrix
+// -------------------------------------------------------------------
+// The band of the given triangle is overwritten with the triangular factor.
+// Only instantiated for the BLAS/LAPACK field types.
+template<typename Field>
+void Cholesky( UpperOrLower uplo, BandMatrix<Field>& A );
+
 namespace cholesky {
 
 template<typename Field>
@@ -87,6 +153,12 @@ void SolveAfter
   const DistPermutation& P,
         AbstractDistMatrix<Field>& B );
 
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  const BandMatrix<Field>& A,
+        Matrix<Field>& B );
+
 } // namespace cholesky
 
 // LDL
@@ -266,6 +338,34 @@ struct RegSolveCtrl
 
 namespace reg_ldl {
 
+// Summary statistics of the diagonal regularization relative to the matrix
+// being factored, for tuning the regularization magnitude (which directly
+// trades factorization stability against the number of refinement
+// iterations needed by the solves below). Since the regularization in this
+// tree is a static per-diagonal-entry vector rather than dynamic per-front
+// pivot perturbation, the statistics are aggregated over the entries.
+template<typename Real>
+struct RegularizationInfo
+{
+    // The number of diagonal entries with a nonzero perturbation
+    Int numPerturbed=0;
+    // The largest and smallest nonzero perturbation magnitudes
+    Real maxPerturbation=0;
+    Real minPerturbation=0;
+    // The largest ratio of a perturbation to the magnitude of the
+    // corresponding (nonzero) original diagonal entry
+    Real maxRelPerturbation=0;
+};
+
+template<typename Field>
+RegularizationInfo<Base<Field>> RegularizationStats
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg );
+template<typename Field>
+RegularizationInfo<Base<Field>> RegularizationStats
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg );
+
 template<typename Field>
 Int RegularizedSolveAfter
 ( const SparseMatrix<Field>& A,
@@ -377,6 +477,26 @@ void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
 void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
 
+// The number of panels which the distributed partially-pivoted
+// factorization factors ahead of the wide trailing updates (the HPL-style
+// pipeline). A depth of zero recovers the synchronous right-looking
+// algorithm; any positive depth currently yields the depth-one pipeline.
+template<typename Field>
+void SetLULookaheadDepth( Int depth );
+template<typename Field>
+Int LULookaheadDepth();
+
+// Whether the distributed factorization selects each panel's pivots through
+// communication-avoiding tournament pivoting (a binomial-tree election of
+// the panel pivot rows followed by a single batched row exchange) rather
+// than a pivot search and swap per column. This replaces the O(n) grid
+// reductions per panel with O(log p) messages, in exchange for the slightly
+// weaker (but provably stable) growth guarantees of CALU.
+template<typename Field>
+void SetLUTournamentPivoting( bool useTournament );
+template<typename Field>
+bool LUTournamentPivoting();
+
 // LU with full pivoting
 // ---------------------
 // P A Q^T = L U
@@ -413,6 +533,15 @@ void LUMod
   bool conjugate=true,
   Base<Field> tau=Base<Field>(1)/Base<Field>(10) );
 
+// LU with partial pivoting of a band matrix
+// -----------------------------------------
+// On exit, the upper bandwidth of A is expanded from ku to kl+ku in order to
+// accommodate the fill-in generated by the row swaps, the band of A holds the
+// factorization, and p holds the zero-based sequence of row-swap indices.
+// Only instantiated for the BLAS/LAPACK field types.
+template<typename Field>
+void LU( BandMatrix<Field>& A, Matrix<Int>& p );
+
 namespace lu {
 
 // Solve linear systems using an implicit unpivoted LU factorization
@@ -460,6 +589,15 @@ void SolveAfter
   const DistPermutation& Q,
         AbstractDistMatrix<Field>& B );
 
+// Solve linear systems using a band LU factorization and its swap sequence
+// ------------------------------------------------------------------------
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const BandMatrix<Field>& A,
+  const Matrix<Int>& p,
+        Matrix<Field>& B );
+
 } // namespace lu
 
 // LQ
@@ -555,6 +693,18 @@ struct QRCtrl
 
     bool alwaysRecomputeNorms=false;
 
+    // Elect each panel's pivots from a small Gaussian sketch of the trailing
+    // matrix rather than maintaining exact column norms: one summation over
+    // the process column per 'sketchPanel' columns replaces the per-column
+    // MaxLoc reduction and norm-downdating traffic. The pivots are those of
+    // a column-pivoted Gram-Schmidt sweep over the replicated sketch, and
+    // the adaptive stopping test is applied to the (unbiased) sketch-based
+    // norm estimates. Currently only exploited by the distributed dense
+    // factorization, and ignored when 'smallestFirst' is requested.
+    bool randomizedPiv=false;
+    Int sketchPanel=32;
+    Int sketchOversample=8;
+
     // Selecting for the smallest norm first is an important preprocessing
     // step for LLL suggested by Wubben et al.
     //
@@ -594,6 +744,14 @@ void QR
   DistPermutation& Omega,
   const QRCtrl<Base<Field>>& ctrl=QRCtrl<Base<Field>>() );
 
+// Out-of-core blocked Householder QR of a tile store whose in-core window
+// is paged against disk (only instantiated for the BLAS field types)
+template<typename Field>
+void QR
+( TileStore<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature );
+
 namespace qr {
 
 // Apply Q using its implicit representation
@@ -615,6 +773,56 @@ void ApplyQ
   const AbstractDistMatrix<Base<Field>>& signature,
         AbstractDistMatrix<Field>& B );
 
+// Cached compact WY application of Q
+// ----------------------------------
+// Every blocked application of Q otherwise re-forms the triangular factor
+// of each panel's compact WY representation with a Herk; caching the Gram
+// matrices of the (scaled) Householder panels once allows repeated ApplyQ
+// calls (e.g., repeatedly forming Q^H B after LeastSquares) to skip that
+// reconstruction. Since the cache's panel decomposition is independent of
+// the factorization's, a block size wider than the algorithmic default may
+// be requested so that bandwidth-bound application sweeps make fewer
+// passes over B.
+template<typename Field>
+struct WYCache
+{
+    Int blocksize=0;
+    // The k'th entry holds tril(U_k^H U_k), where U_k is the k'th panel of
+    // scaled Householder vectors; the diagonal is refreshed at application
+    // time since it depends upon the conjugation
+    vector<Matrix<Field>> gramList;
+};
+
+template<typename Field>
+void FormWYCache
+( const Matrix<Field>& A,
+        WYCache<Field>& cache,
+  Int blocksize=0 );
+template<typename Field>
+void FormWYCache
+( const AbstractDistMatrix<Field>& A,
+        WYCache<Field>& cache,
+  Int blocksize=0 );
+
+template<typename Field>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature,
+  const WYCache<Field>& cache,
+        Matrix<Field>& B );
+template<typename Field>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const AbstractDistMatrix<Base<Field>>& signature,
+  const WYCache<Field>& cache,
+        AbstractDistMatrix<Field>& B );
+
 // Solve a linear system with the implicit QR factorization
 // --------------------------------------------------------
 template<typename Field>
@@ -715,6 +923,17 @@ void DisjointNeighborColSwaps
         Matrix<Field>& R,
   const Matrix<Int>& colSwaps );
 
+// Update the triangular factor after appending the k rows B
+// ---------------------------------------------------------
+// R is overwritten with the triangular factor R' of the row-appended matrix,
+// which satisfies R'^H R' = R^H R + B^H B, at an O(n^2 k) cost; B is
+// overwritten with the Householder vectors of the update. (A rank-k update
+// or downdate of a Cholesky factor is instead provided by CholeskyMod.)
+template<typename Field>
+void RowUpdate( Matrix<Field>& R, Matrix<Field>& B );
+template<typename Field>
+void RowUpdate( AbstractDistMatrix<Field>& R, AbstractDistMatrix<Field>& B );
+
 template<typename Field>
 struct TreeData
 {
@@ -930,6 +1149,41 @@ void ID
   const QRCtrl<Base<Field>>& ctrl=QRCtrl<Base<Field>>(),
   bool canOverwrite=false );
 
+template<typename Real>
+struct RandomizedIDCtrl
+{
+    // The target bound on the (estimated) two-norm of A - A(:,J) [I, Z]
+    Real tol=Real(0);
+    // The number of Gaussian sketch columns added per block
+    Int blockSize=32;
+    // An upper bound on the rank (if non-positive, Min(height,width))
+    Int maxRank=0;
+    // The number of probe vectors for the residual norm estimate; the
+    // estimate overshoots the true norm with probability 1 - 10^{-numProbes}
+    Int numProbes=10;
+};
+
+// Adaptively build an orthonormal range basis Q one Gaussian block at a
+// time (each block is merely projected against the basis accumulated so
+// far rather than the factorization being restarted), estimate
+// || A - Q Q^H A ||_2 after each block with the randomized probe estimator
+// of Halko, Martinsson, and Tropp, and stop once the estimate drops below
+// ctrl.tol; the interpolative decomposition is then extracted from the
+// small matrix Q^H A, so that, unlike ID, no rank guess is required up
+// front. The achieved rank is returned.
+template<typename Field>
+Int RandomizedID
+( const Matrix<Field>& A,
+        Permutation& P,
+        Matrix<Field>& Z,
+  const RandomizedIDCtrl<Base<Field>>& ctrl=RandomizedIDCtrl<Base<Field>>() );
+template<typename Field>
+Int RandomizedID
+( const AbstractDistMatrix<Field>& A,
+        DistPermutation& P,
+        AbstractDistMatrix<Field>& Z,
+  const RandomizedIDCtrl<Base<Field>>& ctrl=RandomizedIDCtrl<Base<Field>>() );
+
 // Skeleton
 // ========
 template<typename Field>
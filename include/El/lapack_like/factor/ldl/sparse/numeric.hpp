@@ -267,6 +267,16 @@ struct Front
     Matrix<Field> workDense;
     SparseMatrix<Field> workSparse;
 
+    // If 'offDiagRank' is non-negative, the bottom-left block of the front
+    // has been replaced with the truncated SVD outer product
+    //
+    //   LB ~= UOffDiag VOffDiag^H,
+    //
+    // with the singular values absorbed into UOffDiag, and LDense shrunk to
+    // the top-left block (see CompressOffDiagonals).
+    Int offDiagRank=-1;
+    Matrix<Field> UOffDiag, VOffDiag;
+
     // An observing pointer for the parent front (should it exist).
     Front<Field>* parent=nullptr;
 
@@ -277,6 +287,14 @@ struct Front
     // Unique pointers to the child fronts (should they exist).
     vector<unique_ptr<Front<Field>>> children;
 
+    // The root of the front tree owns a single buffer holding the dense
+    // factor storage of every front in the tree, with each LDense a view
+    // into it (see Front::Pull). Since the symbolic analysis fixes every
+    // front's dimensions, the buffer is sized exactly and reused across
+    // numeric refactorizations, avoiding fragmenting the heap with one
+    // allocation per front.
+    vector<Field> arena;
+
     Front( Front<Field>* parentNode=nullptr );
 
     Front( DistFront<Field>* dupNode );
@@ -306,6 +324,13 @@ struct Front
 
     void Unpack( SparseMatrix<Field>& A, const NodeInfo& rootInfo ) const;
 
+    // Replace the bottom-left block of each (vanilla LDL) front with a
+    // truncated SVD outer product whenever doing so reduces the storage,
+    // dropping singular values under relTol times the block's two-norm.
+    // This should only be called after factorization and is incompatible
+    // with subsequent storage conversions via ChangeFrontType.
+    void CompressOffDiagonals( const Base<Field>& relTol );
+
     const Front<Field>& operator=( const Front<Field>& front );
 
     Int Height() const;
@@ -472,10 +497,24 @@ public:
     // Factor the initialized multifrontal tree.
     void Factor( LDLFrontType frontType=LDL_2D );
 
+    // Numerically refactor with a new sparse matrix whose nonzero pattern
+    // matches that of the original: the reordering, separator and
+    // elimination trees, and front structures are all reused, and only the
+    // numeric front processing is repeated.
+    void Refactor
+    ( const SparseMatrix<Field>& ANew, LDLFrontType frontType=LDL_2D );
+
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
     void ChangeFrontType( LDLFrontType frontType );
 
+    // Compress the off-diagonal blocks of the factored fronts into truncated
+    // SVD outer products, dropping singular values under 'relTol' times each
+    // block's two-norm. For matrices with numerically low-rank off-diagonal
+    // coupling (e.g., discretized 3D PDE's), this substantially reduces the
+    // factor storage at the expense of a perturbed solve.
+    void CompressFronts( const Base<Field>& relTol );
+
     // Overwrite 'B' with the solution to 'A X = B'.
     void Solve( Matrix<Field>& B ) const;
     void Solve( ldl::MatrixNode<Field>& B ) const;
@@ -585,6 +624,13 @@ public:
     // Factor the initialized multifrontal tree.
     void Factor( LDLFrontType frontType=LDL_2D );
 
+    // Numerically refactor with a new sparse matrix whose nonzero pattern
+    // matches that of the original: the reordering, separator and
+    // elimination trees, and front structures are all reused, and only the
+    // numeric front processing is repeated.
+    void Refactor
+    ( const DistSparseMatrix<Field>& ANew, LDLFrontType frontType=LDL_2D );
+
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
     void ChangeFrontType( LDLFrontType frontType );
@@ -27,8 +27,11 @@
 namespace El {
 namespace ldl {
 
-Int Analysis( NodeInfo& rootInfo, Int myOff=0 );
-void Analysis( DistNodeInfo& rootInfo, bool storeFactRecvInds=true );
+Int Analysis
+( NodeInfo& rootInfo, Int myOff=0, double amalgFillFraction=0. );
+void Analysis
+( DistNodeInfo& rootInfo, bool storeFactRecvInds=true,
+  double amalgFillFraction=0. );
 
 void AMDOrder
 ( const vector<Int>& subOffsets,
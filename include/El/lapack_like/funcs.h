@@ -28,6 +28,9 @@ typedef struct {
   float power;
   ElSignScaling scaling;
   bool progress;
+  bool newtonSchulzHybrid;
+  float newtonSchulzTestRatio;
+  float newtonSchulzSwitchBound;
 } ElSignCtrl_s;
 EL_EXPORT ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl );
 
@@ -37,6 +40,9 @@ typedef struct {
   double power;
   ElSignScaling scaling;
   bool progress;
+  bool newtonSchulzHybrid;
+  double newtonSchulzTestRatio;
+  double newtonSchulzSwitchBound;
 } ElSignCtrl_d;
 EL_EXPORT ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl );
 
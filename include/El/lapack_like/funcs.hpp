@@ -31,6 +31,18 @@ struct SignCtrl
     Real power=Real(1);
     SignScaling scaling=SIGN_SCALE_FROB;
     bool progress=false;
+    // Whether to finish the scaled Newton iteration with the inverse-free
+    // (and entirely level-3) Newton-Schulz iteration once its convergence
+    // can be guaranteed
+    bool newtonSchulzHybrid=false;
+    // Each test for the safety of switching over costs a matrix-matrix
+    // product, so it only begins once the relative Newton update has dropped
+    // below newtonSchulzTestRatio; the switch itself occurs once
+    // || X^2 - I ||_1 <= newtonSchulzSwitchBound, and any value less than
+    // one guarantees convergence (though values near one lengthen the
+    // Newton-Schulz phase)
+    Real newtonSchulzTestRatio=Real(1)/Real(10);
+    Real newtonSchulzSwitchBound=Real(1)/Real(2);
 };
 
 template<typename Real>
@@ -44,23 +56,41 @@ struct SquareRootCtrl
 
 // Hermitian function
 // ==================
+template<typename Real>
+struct HermitianFunctionCtrl
+{
+    // If positive, mapped eigenvalues whose magnitude is at most relTol
+    // times the largest mapped magnitude are dropped, and the
+    // reconstruction A := Z f(Omega) Z^H only traverses the surviving
+    // columns of Z. This is useful for rapidly decaying spectral maps,
+    // e.g., matrix exponentials of graph Laplacians, where most of the
+    // mapped spectrum is negligible.
+    Real relTol=Real(0);
+};
+
 template<typename Field>
 void HermitianFunction
 ( UpperOrLower uplo, Matrix<Field>& A,
-  function<Base<Field>(const Base<Field>&)> func );
+  function<Base<Field>(const Base<Field>&)> func,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl=
+        HermitianFunctionCtrl<Base<Field>>() );
 template<typename Field>
 void HermitianFunction
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
-  function<Base<Field>(const Base<Field>&)> func );
+  function<Base<Field>(const Base<Field>&)> func,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl=
+        HermitianFunctionCtrl<Base<Field>>() );
 
 template<typename Real>
 void HermitianFunction
 ( UpperOrLower uplo, Matrix<Complex<Real>>& A,
-  function<Complex<Real>(const Real&)> func );
+  function<Complex<Real>(const Real&)> func,
+  const HermitianFunctionCtrl<Real>& ctrl=HermitianFunctionCtrl<Real>() );
 template<typename Real>
 void HermitianFunction
 ( UpperOrLower uplo, AbstractDistMatrix<Complex<Real>>& A,
-  function<Complex<Real>(const Real&)> func );
+  function<Complex<Real>(const Real&)> func,
+  const HermitianFunctionCtrl<Real>& ctrl=HermitianFunctionCtrl<Real>() );
 
 // Inverse
 // =======
@@ -131,6 +161,29 @@ void Pseudoinverse( Matrix<Field>& A, Base<Field> tolerance=0 );
 template<typename Field>
 void Pseudoinverse( AbstractDistMatrix<Field>& A, Base<Field> tolerance=0 );
 
+// Return the number of kept singular triplets, k, together with a factored
+// representation of the pseudoinverse, pinv(A) = V inv(Sigma) U^H, where
+// U is m x k, Sigma = diag(s) is k x k, and V is n x k. The numerical rank
+// is detected with an adaptively truncated column-pivoted QR factorization,
+// and only the surviving rows of R are decomposed, so the cost is
+// O(m n k) rather than the O(m n Min(m,n)) of the dense routine. The
+// factored form may be multiplied against vectors directly or contracted
+// into a dense pseudoinverse by the caller if desired.
+template<typename Field>
+Int TruncatedPseudoinverse
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  Base<Field> tolerance=0 );
+template<typename Field>
+Int TruncatedPseudoinverse
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  Base<Field> tolerance=0 );
+
 template<typename Field>
 void HermitianPseudoinverse
 ( UpperOrLower uplo, Matrix<Field>& A, Base<Field> tolerance=0 );
@@ -30,6 +30,46 @@ void PivotsToPartialPermutation
         AbstractDistMatrix<Int>& pInv,
         Int offset=0 );
 
+// Batched application of a pivot sequence
+// =======================================
+// The pivot vector follows the LAPACK convention: pivots(k) is the global
+// index of the row which was swapped with row k+offset. Rather than
+// applying the swaps one dependent row exchange at a time, these routines
+// compose the entire sequence into a permutation so that every displaced
+// row of a distributed matrix travels in a single Alltoallv (through the
+// communication-plan caching of DistPermutation), and so that the local
+// kernel swaps every pivot pair per pass through a block of columns
+// instead of streaming the full row length once per swap.
+
+// Record the composed pivot sequence into a permutation of the given size
+// so that it may be repeatedly applied with a cached communication plan
+void PivotsToPermutation
+( const Matrix<Int>& pivots, Int size,
+        Permutation& P,
+        Int offset=0 );
+void PivotsToPermutation
+( const AbstractDistMatrix<Int>& pivots, Int size,
+        DistPermutation& P,
+        Int offset=0 );
+
+template<typename T>
+void ApplyRowPivots
+( Matrix<T>& A, const Matrix<Int>& pivots, Int offset=0 );
+template<typename T>
+void ApplyInverseRowPivots
+( Matrix<T>& A, const Matrix<Int>& pivots, Int offset=0 );
+
+template<typename T>
+void ApplyRowPivots
+( AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<Int>& pivots,
+  Int offset=0 );
+template<typename T>
+void ApplyInverseRowPivots
+( AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<Int>& pivots,
+  Int offset=0 );
+
 } // namespace El
 
 #endif // ifndef EL_PERM_HPP
@@ -11,6 +11,20 @@
 
 namespace El {
 
+// Norm control
+// ============
+// Callers which only consume a norm within a convergence or conditioning
+// test can opt into a cheap randomized estimate in place of the exact
+// (SVD-grade, in the case of the two-norm) computation
+template<typename Real>
+struct NormCtrl
+{
+    bool estimate=false;
+    // The tolerance and iteration cap forwarded to the estimator
+    Real tol=Real(1)/Real(100);
+    Int maxIts=100;
+};
+
 // Condition number
 // ================
 template<typename F>
@@ -38,6 +52,14 @@ Base<F> OneCondition( const Matrix<F>& A );
 template<typename F>
 Base<F> OneCondition( const AbstractDistMatrix<F>& A );
 
+// Estimate the one-norm condition number through an LU factorization and a
+// Hager-Higham estimate of || inv(A) ||_1, which avoids forming the
+// explicit inverse required by OneCondition
+template<typename F>
+Base<F> OneConditionEstimate( const Matrix<F>& A, Int maxIts=10 );
+template<typename F>
+Base<F> OneConditionEstimate( const AbstractDistMatrix<F>& A, Int maxIts=10 );
+
 template<typename F>
 Base<F> TwoCondition( const Matrix<F>& A );
 template<typename F>
@@ -89,6 +111,22 @@ template<typename F>
 Base<F> HPDDeterminant
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool canOverwrite=false );
 
+// Evaluate the determinants of a batch of (small) matrices with a single
+// thread-pool dispatch
+template<typename F>
+vector<SafeProduct<F>> BatchedSafeDeterminant
+( const vector<Matrix<F>>& AList );
+template<typename F>
+vector<SafeProduct<F>> BatchedSafeDeterminant
+( vector<Matrix<F>>& AList, bool canOverwrite=false );
+
+template<typename F>
+vector<SafeProduct<Base<F>>> BatchedSafeHPDDeterminant
+( UpperOrLower uplo, const vector<Matrix<F>>& AList );
+template<typename F>
+vector<SafeProduct<Base<F>>> BatchedSafeHPDDeterminant
+( UpperOrLower uplo, vector<Matrix<F>>& AList, bool canOverwrite=false );
+
 namespace hpd_det {
 
 template<typename F>
@@ -122,6 +160,17 @@ InertiaType Inertia
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A,
   const LDLPivotCtrl<Base<F>>& ctrl=LDLPivotCtrl<Base<F>>() );
 
+// Evaluate the inertia of A - shift I at each of the given shifts, reusing
+// a single symbolic analysis of A's (shift-invariant) nonzero pattern and
+// factoring the shifts concurrently. This is the building block of
+// spectrum-slicing eigenvalue counts.
+template<typename F>
+vector<InertiaType> MultiShiftInertia
+( const SparseMatrix<F>& A,
+  const vector<Base<F>>& shifts,
+        LDLFrontType frontType=LDL_2D,
+  const BisectCtrl& bisectCtrl=BisectCtrl() );
+
 // Norm
 // ====
 template<typename F>
@@ -407,6 +456,13 @@ Base<F> SymmetricTwoNorm( UpperOrLower uplo, const Matrix<F>& A );
 template<typename F>
 Base<F> SymmetricTwoNorm( UpperOrLower uplo, const AbstractDistMatrix<F>& A );
 
+// Dispatch between the exact (SVD-based) two-norm and the randomized
+// power-iteration estimate based upon the given control structure
+template<typename F>
+Base<F> TwoNorm( const Matrix<F>& A, const NormCtrl<Base<F>>& ctrl );
+template<typename F>
+Base<F> TwoNorm( const AbstractDistMatrix<F>& A, const NormCtrl<Base<F>>& ctrl );
+
 // Zero "norm"
 // -----------
 template<typename T>
@@ -418,6 +474,15 @@ Int ZeroNorm( const AbstractDistMatrix<T>& A, Base<T> tol=0 );
 template<typename T>
 Int ZeroNorm( const DistSparseMatrix<T>& A, Base<T> tol=0 );
 
+// One-norm estimate
+// -----------------
+// A Hager-Higham iteration which lower-bounds || A ||_1 through a handful
+// of matrix-vector products rather than a full reduction over the entries
+template<typename F>
+Base<F> OneNormEstimate( const Matrix<F>& A, Int maxIts=10 );
+template<typename F>
+Base<F> OneNormEstimate( const AbstractDistMatrix<F>& A, Int maxIts=10 );
+
 // Two-norm estimate
 // -----------------
 template<typename F>
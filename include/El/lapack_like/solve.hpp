@@ -46,6 +46,89 @@ void Overwrite( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B );
 
 } // namespace lin_solve
 
+// A persistent handle for the LU factorization formed by LinearSolve so that
+// codes which repeatedly solve against the same operator (e.g., implicit
+// time-steppers) can factor once and then only pay for the permutation
+// application and two triangular solves on each subsequent (possibly
+// multiple right-hand side) solve.
+template<typename Field>
+class LinearSolver
+{
+public:
+    LinearSolver();
+
+    // Overwrite any previous factorization with an LU with partial pivoting
+    // of a copy of the square matrix A.
+    void Factor( const Matrix<Field>& A );
+
+    // Overwrite each right-hand side in B with the corresponding solution to
+    // A X = B (or A^T X = B or A^H X = B).
+    void Solve( Matrix<Field>& B ) const;
+    void Solve( Orientation orientation, Matrix<Field>& B ) const;
+
+    // Overwrite B with the solution to A X = B using iterative refinement
+    // and return the number of refinement iterations performed. The matrix
+    // provided must be the one which was factored.
+    Int SolveWithIterativeRefinement
+    ( const Matrix<Field>& A,
+            Matrix<Field>& B,
+      Base<Field> relTol=limits::Epsilon<Base<Field>>(),
+      Int maxRefineIts=10 ) const;
+
+    bool Factored() const;
+    Int Height() const;
+
+private:
+    bool factored_=false;
+    Matrix<Field> LU_;
+    Permutation P_;
+};
+
+template<typename Field>
+class DistLinearSolver
+{
+public:
+    DistLinearSolver();
+
+    void Factor( const AbstractDistMatrix<Field>& A );
+
+    void Solve( AbstractDistMatrix<Field>& B ) const;
+    void Solve( Orientation orientation, AbstractDistMatrix<Field>& B ) const;
+
+    Int SolveWithIterativeRefinement
+    ( const AbstractDistMatrix<Field>& A,
+            AbstractDistMatrix<Field>& B,
+      Base<Field> relTol=limits::Epsilon<Base<Field>>(),
+      Int maxRefineIts=10 ) const;
+
+    bool Factored() const;
+    Int Height() const;
+
+private:
+    bool factored_=false;
+    DistMatrix<Field> LU_;
+    DistPermutation P_;
+};
+
+// Solve a square linear system by factoring a demoted copy of A (e.g., in
+// single precision when Field is double precision) and then iteratively
+// refining the solution in the working precision. The number of refinement
+// iterations performed is returned.
+template<typename Field>
+Int RefinedSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  Base<Field> relTol=limits::Epsilon<Base<Field>>(),
+  Int maxRefineIts=10,
+  bool progress=false );
+template<typename Field>
+Int RefinedSolve
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  Base<Field> relTol=limits::Epsilon<Base<Field>>(),
+  Int maxRefineIts=10,
+  bool progress=false );
+
 // Hermitian
 // =========
 template<typename Field>
@@ -91,6 +174,76 @@ void Overwrite
 
 } // namespace herm_solve
 
+// A persistent handle for the pivoted LDL factorization formed by
+// HermitianSolve. As with herm_solve::Overwrite, only lower-triangular
+// storage is currently supported.
+template<typename Field>
+class HermitianSolver
+{
+public:
+    HermitianSolver();
+
+    // Overwrite any previous factorization with a Bunch-Kaufman LDL^H
+    // factorization of a copy of the Hermitian matrix A.
+    void Factor
+    ( UpperOrLower uplo,
+      const Matrix<Field>& A,
+      const LDLPivotCtrl<Base<Field>>& ctrl=LDLPivotCtrl<Base<Field>>() );
+
+    void Solve( Matrix<Field>& B ) const;
+    void Solve( Orientation orientation, Matrix<Field>& B ) const;
+
+    // Overwrite B with the solution to A X = B using iterative refinement
+    // and return the number of refinement iterations performed. Only the
+    // lower triangle of the provided matrix is accessed.
+    Int SolveWithIterativeRefinement
+    ( const Matrix<Field>& A,
+            Matrix<Field>& B,
+      Base<Field> relTol=limits::Epsilon<Base<Field>>(),
+      Int maxRefineIts=10 ) const;
+
+    bool Factored() const;
+    Int Height() const;
+
+private:
+    bool factored_=false;
+    UpperOrLower uplo_=LOWER;
+    Matrix<Field> LDL_;
+    Matrix<Field> dSub_;
+    Permutation P_;
+};
+
+template<typename Field>
+class DistHermitianSolver
+{
+public:
+    DistHermitianSolver();
+
+    void Factor
+    ( UpperOrLower uplo,
+      const AbstractDistMatrix<Field>& A,
+      const LDLPivotCtrl<Base<Field>>& ctrl=LDLPivotCtrl<Base<Field>>() );
+
+    void Solve( AbstractDistMatrix<Field>& B ) const;
+    void Solve( Orientation orientation, AbstractDistMatrix<Field>& B ) const;
+
+    Int SolveWithIterativeRefinement
+    ( const AbstractDistMatrix<Field>& A,
+            AbstractDistMatrix<Field>& B,
+      Base<Field> relTol=limits::Epsilon<Base<Field>>(),
+      Int maxRefineIts=10 ) const;
+
+    bool Factored() const;
+    Int Height() const;
+
+private:
+    bool factored_=false;
+    UpperOrLower uplo_=LOWER;
+    DistMatrix<Field> LDL_;
+    DistMatrix<Field,MD,STAR> dSub_;
+    DistPermutation P_;
+};
+
 // Symmetric
 // =========
 template<typename Field>
@@ -227,6 +380,64 @@ void Overwrite
 
 } // namespace hpd_solve
 
+// A persistent handle for the Cholesky factorization formed by HPDSolve.
+template<typename Field>
+class HPDSolver
+{
+public:
+    HPDSolver();
+
+    // Overwrite any previous factorization with a Cholesky factorization of
+    // a copy of the given triangle of the HPD matrix A.
+    void Factor( UpperOrLower uplo, const Matrix<Field>& A );
+
+    void Solve( Matrix<Field>& B ) const;
+    void Solve( Orientation orientation, Matrix<Field>& B ) const;
+
+    // Overwrite B with the solution to A X = B using iterative refinement
+    // and return the number of refinement iterations performed. Only the
+    // factored triangle of the provided matrix is accessed.
+    Int SolveWithIterativeRefinement
+    ( const Matrix<Field>& A,
+            Matrix<Field>& B,
+      Base<Field> relTol=limits::Epsilon<Base<Field>>(),
+      Int maxRefineIts=10 ) const;
+
+    bool Factored() const;
+    Int Height() const;
+
+private:
+    bool factored_=false;
+    UpperOrLower uplo_=LOWER;
+    Matrix<Field> chol_;
+};
+
+template<typename Field>
+class DistHPDSolver
+{
+public:
+    DistHPDSolver();
+
+    void Factor( UpperOrLower uplo, const AbstractDistMatrix<Field>& A );
+
+    void Solve( AbstractDistMatrix<Field>& B ) const;
+    void Solve( Orientation orientation, AbstractDistMatrix<Field>& B ) const;
+
+    Int SolveWithIterativeRefinement
+    ( const AbstractDistMatrix<Field>& A,
+            AbstractDistMatrix<Field>& B,
+      Base<Field> relTol=limits::Epsilon<Base<Field>>(),
+      Int maxRefineIts=10 ) const;
+
+    bool Factored() const;
+    Int Height() const;
+
+private:
+    bool factored_=false;
+    UpperOrLower uplo_=LOWER;
+    DistMatrix<Field> chol_;
+};
+
 // Multi-shift Hessenberg
 // ======================
 template<typename Field>
@@ -21,6 +21,14 @@
 // result in higher residual norms than necessary (as monotonicity must be
 // specifically enforced), and more iterations than necessary may be performed,
 // it is a compromise between performance and accuracy.
+//
+// Each iteration fuses the solution update with the residual update: since
+// the residual of the candidate x + dx is r - A dx, applying A to the
+// computed correction simultaneously yields the new residual, avoiding the
+// former separate passes which formed the candidate and subtracted A times
+// it from the original right-hand side. Because the incrementally-updated
+// residual slowly accumulates roundoff, it is recomputed from scratch every
+// few accepted iterations.
 
 // TODO(poulson): DistMatrix implementations
 // TODO(poulson): Simplify once DistMultiVec is eliminated
@@ -69,7 +77,7 @@ Int Single
     auto x = b;
     applyAInv( x );
 
-    Matrix<Field> dx, xCand, y;
+    Matrix<Field> dx, y;
     Zeros( y, x.Height(), 1 );
 
     applyA( x, y );
@@ -92,20 +100,17 @@ Int Single
         // -------------------------------------------
         dx = b;
         applyAInv( dx );
-        xCand = x;
-        xCand += dx;
 
-        // Check the new residual
-        // ----------------------
-        applyA( xCand, y );
-        b = bOrig;
+        // Fused update: b - A dx is the residual of the candidate x + dx
+        // --------------------------------------------------------------
+        applyA( dx, y );
         b -= y;
         auto newErrorNorm = MaxNorm( b );
         if( progress )
             Output("refined rel error: ",newErrorNorm/bNorm);
 
         if( newErrorNorm < errorNorm )
-            x = xCand;
+            x += dx;
         else
             break;
 
@@ -113,6 +118,16 @@ Int Single
         ++refineIt;
         if( refineIt >= maxRefineIts )
             break;
+
+        // Periodically recompute the residual to remove accumulated roundoff
+        // ------------------------------------------------------------------
+        if( refineIt % 4 == 0 )
+        {
+            applyA( x, y );
+            b = bOrig;
+            b -= y;
+            errorNorm = MaxNorm( b );
+        }
     }
     b = x;
     return refineIt;
@@ -144,8 +159,6 @@ Int Pair
     const Base<Field> bRNorm = MaxNorm( bR );
 
     auto BOrig = B;
-    auto bOrigL = BOrig( ALL, IR(0) );
-    auto bOrigR = BOrig( ALL, IR(1) );
 
     // Compute the initial guess
     // =========================
@@ -154,15 +167,12 @@ Int Pair
     auto xR = X( ALL, IR(1) );
     applyAInv( X );
 
-    Matrix<Field> dX, XCand, Y;
+    Matrix<Field> dX, Y;
     Zeros( dX, X.Height(), X.Width() );
-    Zeros( XCand, X.Height(), X.Width() );
     Zeros( Y, X.Height(), X.Width() );
 
     auto dxL = dX( ALL, IR(0) );
     auto dxR = dX( ALL, IR(1) );
-    auto xLCand = XCand( ALL, IR(0) );
-    auto xRCand = XCand( ALL, IR(1) );
     auto yL = Y( ALL, IR(0) );
     auto yR = Y( ALL, IR(1) );
 
@@ -201,13 +211,10 @@ Int Pair
             // -------------------------------------------
             dxR = bR;
             applyAInv( dxR );
-            xRCand = xR;
-            xRCand += dxR;
 
-            // Check the new residual
-            // ----------------------
-            applyA( xRCand, yR );
-            bR = bOrigR;
+            // Fused update: the residual of the candidate is bR - A dxR
+            // ---------------------------------------------------------
+            applyA( dxR, yR );
             bR -= yR;
             auto newErrorNormR = MaxNorm( bR );
             if( progress )
@@ -215,7 +222,7 @@ Int Pair
 
             if( newErrorNormR < errorNormR )
             {
-                xR = xRCand;
+                xR += dxR;
                 errorNormR = newErrorNormR;
             }
             else
@@ -227,13 +234,10 @@ Int Pair
             // -------------------------------------------
             dxL = bL;
             applyAInv( dxL );
-            xLCand = xL;
-            xLCand += dxL;
 
-            // Check the new residual
-            // ----------------------
-            applyA( xLCand, yL );
-            bL = bOrigL;
+            // Fused update: the residual of the candidate is bL - A dxL
+            // ---------------------------------------------------------
+            applyA( dxL, yL );
             bL -= yL;
             auto newErrorNormL = MaxNorm( bL );
             if( progress )
@@ -241,7 +245,7 @@ Int Pair
 
             if( newErrorNormL < errorNormL )
             {
-                xL = xLCand;
+                xL += dxL;
                 errorNormL = newErrorNormL;
             }
             else
@@ -249,17 +253,14 @@ Int Pair
         }
         else
         {
-            // Compute the proposed update to the solution
-            // -------------------------------------------
+            // Compute the proposed updates to the solutions
+            // ---------------------------------------------
             dX = B;
             applyAInv( dX );
-            XCand = X;
-            XCand += dX;
 
-            // Check the new residual
-            // ----------------------
-            applyA( XCand, Y );
-            B = BOrig;
+            // Fused update: the residuals of the candidates are B - A dX
+            // ----------------------------------------------------------
+            applyA( dX, Y );
             B -= Y;
             auto newErrorNormL = MaxNorm( bL );
             auto newErrorNormR = MaxNorm( bR );
@@ -271,7 +272,7 @@ Int Pair
 
             if( newErrorNormL < errorNormL )
             {
-                xL = xLCand;
+                xL += dxL;
                 errorNormL = newErrorNormL;
             }
             else
@@ -279,7 +280,7 @@ Int Pair
 
             if( newErrorNormR < errorNormR )
             {
-                xR = xRCand;
+                xR += dxR;
                 errorNormR = newErrorNormR;
             }
             else
@@ -288,6 +289,19 @@ Int Pair
         ++refineIt;
         if( refineIt >= maxRefineIts )
             break;
+
+        // Periodically recompute the residuals to remove accumulated roundoff
+        // -------------------------------------------------------------------
+        if( refineIt % 4 == 0 && !(leftConv && rightConv) )
+        {
+            applyA( X, Y );
+            B = BOrig;
+            B -= Y;
+            if( !leftConv )
+                errorNormL = MaxNorm( bL );
+            if( !rightConv )
+                errorNormR = MaxNorm( bR );
+        }
     }
     B = X;
     return refineIt;
@@ -333,11 +347,20 @@ Int Batch
         ++refineIt;
         if( refineIt < maxRefineIts )
         {
-            // Compute the new residual
-            // ------------------------
-            applyA( X, Y );
-            B = BOrig;
-            B -= Y;
+            // Compute the new residual, recomputing it from scratch every
+            // few iterations to remove accumulated roundoff
+            // -----------------------------------------------------------
+            if( refineIt % 4 == 0 )
+            {
+                applyA( X, Y );
+                B = BOrig;
+                B -= Y;
+            }
+            else
+            {
+                applyA( dX, Y );
+                B -= Y;
+            }
         }
         else
             break;
@@ -405,7 +428,7 @@ Int PromotedSingle
     Matrix<PField> xProm;
     Copy( b, xProm );
 
-    Matrix<PField> dxProm, xCandProm, yProm;
+    Matrix<PField> dxProm, yProm;
     Zeros( yProm, xProm.Height(), 1 );
 
     applyA( xProm, yProm );
@@ -429,20 +452,17 @@ Int PromotedSingle
         Copy( bProm, b );
         applyAInv( b );
         Copy( b, dxProm );
-        xCandProm = xProm;
-        xCandProm += dxProm;
 
-        // Check the new residual
-        // ----------------------
-        applyA( xCandProm, yProm );
-        bProm = bOrigProm;
+        // Fused update: bProm - A dxProm is the residual of the candidate
+        // ---------------------------------------------------------------
+        applyA( dxProm, yProm );
         bProm -= yProm;
         auto newErrorNorm = MaxNorm( bProm );
         if( progress )
             Output("refined rel error: ",newErrorNorm/bNorm);
 
         if( newErrorNorm < errorNorm )
-            xProm = xCandProm;
+            xProm += dxProm;
         else
             break;
 
@@ -450,6 +470,16 @@ Int PromotedSingle
         ++refineIt;
         if( refineIt >= maxRefineIts )
             break;
+
+        // Periodically recompute the residual to remove accumulated roundoff
+        // ------------------------------------------------------------------
+        if( refineIt % 4 == 0 )
+        {
+            applyA( xProm, yProm );
+            bProm = bOrigProm;
+            bProm -= yProm;
+            errorNorm = MaxNorm( bProm );
+        }
     }
     Copy( xProm, b );
     return refineIt;
@@ -501,15 +531,12 @@ Int PromotedPair
     auto xLProm = XProm( ALL, IR(0) );
     auto xRProm = XProm( ALL, IR(1) );
 
-    Matrix<PField> dXProm, XCandProm, YProm;
+    Matrix<PField> dXProm, YProm;
     Zeros( dXProm, XProm.Height(), XProm.Width() );
-    Zeros( XCandProm, XProm.Height(), XProm.Width() );
     Zeros( YProm, XProm.Height(), XProm.Width() );
 
     auto dxLProm = dXProm( ALL, IR(0) );
     auto dxRProm = dXProm( ALL, IR(1) );
-    auto xLCandProm = XCandProm( ALL, IR(0) );
-    auto xRCandProm = XCandProm( ALL, IR(1) );
     auto yLProm = YProm( ALL, IR(0) );
     auto yRProm = YProm( ALL, IR(1) );
 
@@ -549,13 +576,10 @@ Int PromotedPair
             Copy( bRProm, bR );
             applyAInv( bR );
             Copy( bR, dxRProm );
-            xRCandProm = xRProm;
-            xRCandProm += dxRProm;
 
-            // Check the new residual
-            // ----------------------
-            applyA( xRCandProm, yRProm );
-            bRProm = bROrigProm;
+            // Fused update: the residual of the candidate is bRProm - A dxRProm
+            // -----------------------------------------------------------------
+            applyA( dxRProm, yRProm );
             bRProm -= yRProm;
             auto newErrorNormR = MaxNorm( bRProm );
             if( progress )
@@ -563,7 +587,7 @@ Int PromotedPair
 
             if( newErrorNormR < errorNormR )
             {
-                xRProm = xRCandProm;
+                xRProm += dxRProm;
                 errorNormR = newErrorNormR;
             }
             else
@@ -576,13 +600,10 @@ Int PromotedPair
             Copy( bLProm, bL );
             applyAInv( bL );
             Copy( bL, dxLProm );
-            xLCandProm = xLProm;
-            xLCandProm += dxLProm;
 
-            // Check the new residual
-            // ----------------------
-            applyA( xLCandProm, yLProm );
-            bLProm = bLOrigProm;
+            // Fused update: the residual of the candidate is bLProm - A dxLProm
+            // -----------------------------------------------------------------
+            applyA( dxLProm, yLProm );
             bLProm -= yLProm;
             auto newErrorNormL = MaxNorm( bLProm );
             if( progress )
@@ -590,7 +611,7 @@ Int PromotedPair
 
             if( newErrorNormL < errorNormL )
             {
-                xLProm = xLCandProm;
+                xLProm += dxLProm;
                 errorNormL = newErrorNormL;
             }
             else
@@ -598,18 +619,15 @@ Int PromotedPair
         }
         else
         {
-            // Compute the proposed update to the solution
-            // -------------------------------------------
+            // Compute the proposed updates to the solutions
+            // ---------------------------------------------
             Copy( BProm, B );
             applyAInv( B );
             Copy( B, dXProm );
-            XCandProm = XProm;
-            XCandProm += dXProm;
 
-            // Check the new residual
-            // ----------------------
-            applyA( XCandProm, YProm );
-            BProm = BOrigProm;
+            // Fused update: the residuals of the candidates are BProm - A dXProm
+            // ------------------------------------------------------------------
+            applyA( dXProm, YProm );
             BProm -= YProm;
             auto newErrorNormL = MaxNorm( bLProm );
             auto newErrorNormR = MaxNorm( bRProm );
@@ -621,7 +639,7 @@ Int PromotedPair
 
             if( newErrorNormL < errorNormL )
             {
-                xLProm = xLCandProm;
+                xLProm += dxLProm;
                 errorNormL = newErrorNormL;
             }
             else
@@ -629,7 +647,7 @@ Int PromotedPair
 
             if( newErrorNormR < errorNormR )
             {
-                xRProm = xRCandProm;
+                xRProm += dxRProm;
                 errorNormR = newErrorNormR;
             }
             else
@@ -639,6 +657,19 @@ Int PromotedPair
         ++refineIt;
         if( refineIt >= maxRefineIts )
             break;
+
+        // Periodically recompute the residuals to remove accumulated roundoff
+        // -------------------------------------------------------------------
+        if( refineIt % 4 == 0 && !(leftConv && rightConv) )
+        {
+            applyA( XProm, YProm );
+            BProm = BOrigProm;
+            BProm -= YProm;
+            if( !leftConv )
+                errorNormL = MaxNorm( bLProm );
+            if( !rightConv )
+                errorNormR = MaxNorm( bRProm );
+        }
     }
     Copy( XProm, B );
     return refineIt;
@@ -688,11 +719,20 @@ Int PromotedBatch
         ++refineIt;
         if( refineIt < maxRefineIts )
         {
-            // Form the new residuals
-            // ----------------------
-            applyA( XProm, YProm );
-            BProm = BOrigProm;
-            BProm -= YProm;
+            // Form the new residuals, recomputing them from scratch every
+            // few iterations to remove accumulated roundoff
+            // -----------------------------------------------------------
+            if( refineIt % 4 == 0 )
+            {
+                applyA( XProm, YProm );
+                BProm = BOrigProm;
+                BProm -= YProm;
+            }
+            else
+            {
+                applyA( dXProm, YProm );
+                BProm -= YProm;
+            }
         }
         else
             break;
@@ -771,7 +811,7 @@ Int Single
     auto x = b;
     applyAInv( x );
 
-    DistMultiVec<Field> dx(grid), xCand(grid), y(grid);
+    DistMultiVec<Field> dx(grid), y(grid);
     Zeros( y, x.Height(), 1 );
     applyA( x, y );
     b -= y;
@@ -794,20 +834,17 @@ Int Single
         // -------------------------------------------
         dx = b;
         applyAInv( dx );
-        xCand = x;
-        xCand += dx;
 
-        // Compute the new residual
-        // ------------------------
-        applyA( xCand, y );
-        b = bOrig;
+        // Fused update: b - A dx is the residual of the candidate x + dx
+        // --------------------------------------------------------------
+        applyA( dx, y );
         b -= y;
         Base<Field> newErrorNorm = MaxNorm( b );
         if( progress && commRank == 0 )
             Output("refined rel error: ",newErrorNorm/bNorm);
 
         if( newErrorNorm < errorNorm )
-            x = xCand;
+            x += dx;
         else
             break;
 
@@ -815,6 +852,16 @@ Int Single
         ++refineIt;
         if( refineIt >= maxRefineIts )
             break;
+
+        // Periodically recompute the residual to remove accumulated roundoff
+        // ------------------------------------------------------------------
+        if( refineIt % 4 == 0 )
+        {
+            applyA( x, y );
+            b = bOrig;
+            b -= y;
+            errorNorm = MaxNorm( b );
+        }
     }
     SetIndent( indent );
     b = x;
@@ -862,11 +909,20 @@ Int Batch
         ++refineIt;
         if( refineIt < maxRefineIts )
         {
-            // Compute the new residual
-            // ------------------------
-            applyA( X, Y );
-            B = BOrig;
-            B -= Y;
+            // Compute the new residual, recomputing it from scratch every
+            // few iterations to remove accumulated roundoff
+            // -----------------------------------------------------------
+            if( refineIt % 4 == 0 )
+            {
+                applyA( X, Y );
+                B = BOrig;
+                B -= Y;
+            }
+            else
+            {
+                applyA( dX, Y );
+                B -= Y;
+            }
         }
         else
             break;
@@ -932,7 +988,7 @@ Int PromotedSingle
     DistMultiVec<PField> xProm(grid);
     Copy( b, xProm );
 
-    DistMultiVec<PField> dxProm(grid), xCandProm(grid), yProm(grid);
+    DistMultiVec<PField> dxProm(grid), yProm(grid);
     Zeros( yProm, xProm.Height(), 1 );
     applyA( xProm, yProm );
     bProm -= yProm;
@@ -956,20 +1012,17 @@ Int PromotedSingle
         Copy( bProm, b );
         applyAInv( b );
         Copy( b, dxProm );
-        xCandProm = xProm;
-        xCandProm += dxProm;
 
-        // Check the new residual
-        // ----------------------
-        applyA( xCandProm, yProm );
-        bProm = bOrigProm;
+        // Fused update: bProm - A dxProm is the residual of the candidate
+        // ---------------------------------------------------------------
+        applyA( dxProm, yProm );
         bProm -= yProm;
         auto newErrorNorm = MaxNorm( bProm );
         if( progress && commRank == 0 )
             Output("refined rel error: ",newErrorNorm/bNorm);
 
         if( newErrorNorm < errorNorm )
-            xProm = xCandProm;
+            xProm += dxProm;
         else
             break;
 
@@ -977,6 +1030,16 @@ Int PromotedSingle
         ++refineIt;
         if( refineIt >= maxRefineIts )
             break;
+
+        // Periodically recompute the residual to remove accumulated roundoff
+        // ------------------------------------------------------------------
+        if( refineIt % 4 == 0 )
+        {
+            applyA( xProm, yProm );
+            bProm = bOrigProm;
+            bProm -= yProm;
+            errorNorm = MaxNorm( bProm );
+        }
     }
     SetIndent( indent );
     Copy( xProm, b );
@@ -1029,11 +1092,20 @@ Int PromotedBatch
         ++refineIt;
         if( refineIt < maxRefineIts )
         {
-            // Form the new residuals
-            // ----------------------
-            applyA( XProm, YProm );
-            BProm = BOrigProm;
-            BProm -= YProm;
+            // Form the new residuals, recomputing them from scratch every
+            // few iterations to remove accumulated roundoff
+            // -----------------------------------------------------------
+            if( refineIt % 4 == 0 )
+            {
+                applyA( XProm, YProm );
+                BProm = BOrigProm;
+                BProm -= YProm;
+            }
+            else
+            {
+                applyA( dXProm, YProm );
+                BProm -= YProm;
+            }
         }
         else
             break;
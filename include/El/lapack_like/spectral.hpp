@@ -337,7 +337,10 @@ struct HermitianTridiagEigInfo
 enum HermitianTridiagEigAlg {
   HERM_TRIDIAG_EIG_QR = 0,
   HERM_TRIDIAG_EIG_DC = 1,
-  HERM_TRIDIAG_EIG_MRRR = 2
+  HERM_TRIDIAG_EIG_MRRR = 2,
+  // Select the path with the smallest predicted time at dispatch, using the
+  // closed-form cost models and calibrated rates described below
+  HERM_TRIDIAG_EIG_AUTO = 3
 };
 
 template<typename Real,
@@ -356,6 +359,96 @@ struct HermitianTridiagEigCtrl
     // TODO(poulson): MRRR ctrl
 };
 
+namespace herm_tridiag_eig {
+
+// Closed-form flop models for the tridiagonal eigensolver paths. The
+// constants are coarse; calibration (see Calibrate below) absorbs the
+// machine-dependent factors into per-path rates.
+inline double AlgCost
+( HermitianTridiagEigAlg alg, bool wantEigVecs, double n, double k )
+{
+    if( alg == HERM_TRIDIAG_EIG_QR )
+    {
+        // The QR algorithm always computes the entire spectrum
+        return ( wantEigVecs ? 6*n*n*n + 30*n*n : 30*n*n );
+    }
+    else if( alg == HERM_TRIDIAG_EIG_DC )
+    {
+        // Deflation typically shrinks the cubic term substantially; the
+        // calibrated rate absorbs the typical deflation fraction
+        return ( wantEigVecs ? (4./3.)*n*n*n + 20*n*n : 20*n*n );
+    }
+    else
+    {
+        // MRRR computes k eigenpairs in O(n k) work
+        return ( wantEigVecs ? 30*n*k : 10*n*k );
+    }
+}
+
+// The tuned-blocksize registry key under which a path's calibrated rate
+// (in units of model flops per microsecond) is stored, so that the rates
+// are saved and restored together with blocksize tuning profiles
+inline string AlgRateKey( HermitianTridiagEigAlg alg, bool wantEigVecs )
+{
+    string key = "herm_tridiag_eig/rate/";
+    if( alg == HERM_TRIDIAG_EIG_QR )
+        key += "qr";
+    else if( alg == HERM_TRIDIAG_EIG_DC )
+        key += "dc";
+    else
+        key += "mrrr";
+    return key + ( wantEigVecs ? "/vecs" : "/vals" );
+}
+
+// Run a small one-time benchmark of the QR, D&C, and MRRR tridiagonal
+// paths (both eigenvalues-only and with eigenvectors) in double precision
+// and store the measured rates in the tuned-blocksize registry, where
+// SaveTuningProfile will persist them alongside the blocksize tables
+void Calibrate( Int n=512 );
+
+// Resolve HERM_TRIDIAG_EIG_AUTO to the path with the smallest predicted
+// time, consulting the calibrated rates when present and otherwise falling
+// back to a pure flop-count comparison. The predicted time (in seconds) is
+// returned so that callers can report predicted-versus-actual timings.
+template<typename Real>
+HermitianTridiagEigAlg ChooseAlg
+( Int n,
+  const HermitianTridiagEigCtrl<Real>& ctrl,
+  double& predictedSeconds )
+{
+    if( ctrl.alg != HERM_TRIDIAG_EIG_AUTO )
+    {
+        predictedSeconds = -1;
+        return ctrl.alg;
+    }
+    double k = double(n);
+    if( ctrl.subset.indexSubset )
+        k = double(ctrl.subset.upperIndex-ctrl.subset.lowerIndex+1);
+    else if( ctrl.subset.rangeSubset )
+        k = n/2.; // the count is not known a priori; assume half
+    const HermitianTridiagEigAlg algs[] =
+      { HERM_TRIDIAG_EIG_QR, HERM_TRIDIAG_EIG_DC, HERM_TRIDIAG_EIG_MRRR };
+    HermitianTridiagEigAlg bestAlg = HERM_TRIDIAG_EIG_MRRR;
+    double bestSeconds = -1;
+    for( auto alg : algs )
+    {
+        const string key = AlgRateKey( alg, ctrl.wantEigVecs );
+        const double rate =
+          ( HaveTunedBlocksize(key) ? double(TunedBlocksize(key,n)) : 1000. );
+        const double seconds =
+          AlgCost( alg, ctrl.wantEigVecs, double(n), k ) / (rate*1.e6);
+        if( bestSeconds < 0 || seconds < bestSeconds )
+        {
+            bestSeconds = seconds;
+            bestAlg = alg;
+        }
+    }
+    predictedSeconds = bestSeconds;
+    return bestAlg;
+}
+
+} // namespace herm_tridiag_eig
+
 // Compute eigenvalues
 // --------------------
 template<typename Field>
@@ -581,6 +674,74 @@ HermitianGenDefEig
         AbstractDistMatrix<Field>& X,
   const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
 
+// Repeated solves against a fixed B
+// ---------------------------------
+// Electronic-structure and similar outer loops solve long sequences of
+// pencils which share their (overlap) matrix B. These drivers Cholesky-
+// factor B once, keep the triangular factor resident, and reduce the
+// per-solve B-related work to the two-sided transformation of A and the
+// back-transformation of the extracted eigenvector panel.
+template<typename Field>
+class HermitianGenDefEigSolver
+{
+public:
+    HermitianGenDefEigSolver();
+    HermitianGenDefEigSolver
+    ( Pencil pencil, UpperOrLower uplo, const Matrix<Field>& B );
+
+    // (Re)factor the fixed matrix of the pencil
+    void Factor( Pencil pencil, UpperOrLower uplo, const Matrix<Field>& B );
+    bool Factored() const;
+
+    // Compute the eigenvalues of the pencil formed from the cached factor
+    HermitianEigInfo Solve
+    (       Matrix<Field>& A,
+            Matrix<Base<Field>>& w,
+      const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() ) const;
+    // Compute eigenpairs; the back-transformation is applied directly to
+    // the (possibly subset) eigenvector panel returned by HermitianEig
+    HermitianEigInfo Solve
+    (       Matrix<Field>& A,
+            Matrix<Base<Field>>& w,
+            Matrix<Field>& X,
+      const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() ) const;
+
+private:
+    Pencil pencil_=AXBX;
+    UpperOrLower uplo_=LOWER;
+    bool factored_=false;
+    Matrix<Field> cholB_;
+};
+
+template<typename Field>
+class DistHermitianGenDefEigSolver
+{
+public:
+    DistHermitianGenDefEigSolver();
+    DistHermitianGenDefEigSolver
+    ( Pencil pencil, UpperOrLower uplo, const AbstractDistMatrix<Field>& B );
+
+    void Factor
+    ( Pencil pencil, UpperOrLower uplo, const AbstractDistMatrix<Field>& B );
+    bool Factored() const;
+
+    HermitianEigInfo Solve
+    (       AbstractDistMatrix<Field>& A,
+            AbstractDistMatrix<Base<Field>>& w,
+      const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() ) const;
+    HermitianEigInfo Solve
+    (       AbstractDistMatrix<Field>& A,
+            AbstractDistMatrix<Base<Field>>& w,
+            AbstractDistMatrix<Field>& X,
+      const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() ) const;
+
+private:
+    Pencil pencil_=AXBX;
+    UpperOrLower uplo_=LOWER;
+    bool factored_=false;
+    DistMatrix<Field> cholB_;
+};
+
 // Polar decomposition
 // ===================
 struct QDWHCtrl
@@ -763,6 +924,17 @@ struct HessenbergSchurCtrl
     // the distributed multibulge algorithm.
     function<Int(Int)> numBulgesPerBlock =
       function<Int(Int)>(hess_schur::multibulge::NumBulgesPerBlock);
+
+    // The minimum deflation-window size for which the window's Schur
+    // decomposition is computed with the distributed multibulge algorithm
+    // (over the owning grid) rather than on a single root process
+    Int minParallelAEDSize=800;
+
+    // Whether the distributed AED driver should adaptively retune the
+    // bulge-packet spacing and the deflation-window size from the measured
+    // wall-clock throughput of each QR sweep (the measurements are reduced
+    // over the grid so that every process makes the same decisions)
+    bool tuneAED=false;
 };
 
 template<typename Field>
@@ -825,6 +997,13 @@ struct SDCCtrl
     Real spreadFactor=Real(1e-6);
     bool random=true;
     bool progress=false;
+    // The grid is split in half, so that the two subproblems recurse
+    // concurrently on disjoint subgrids, whenever the larger subproblem
+    // requires at most splitFactor times as much work as the smaller.
+    // Raising this factor trades per-subproblem parallelism for concurrency
+    // between the subproblems, which converts the recursion from a serial
+    // chain into a balanced tree on unbalanced spectral divides.
+    Real splitFactor=Real(2);
 
     SignCtrl<Real> signCtrl;
 };
@@ -958,16 +1137,44 @@ void TriangEig
 
 // Compute the eigendecomposition of a square matrix
 // =================================================
+struct EigCtrl
+{
+    // Empty A as soon as its contents have been absorbed by the later
+    // stages of the pipeline rather than leaving the (quasi-)triangular
+    // Schur factor behind in it. Together with the eager release of the
+    // internal stage temporaries, this lowers the peak working set of the
+    // real-field pipeline from roughly four to three complex copies of A
+    // (see eig::PeakExtraEntries for the precise accounting).
+    bool destroyInput=false;
+};
+
+namespace eig {
+
+// The number of Complex<Base<Field>> entries which Eig transiently
+// allocates beyond the caller's A, w, and X for an n x n problem, so that
+// a driver can check whether the decomposition fits in memory before
+// committing to it. The bound covers the full-size stage temporaries
+// (the real Schur vectors, the complexified triangular factor, and the
+// triangular eigenvector matrix); the O(n) vectors and the temporaries
+// internal to the Hessenberg reduction and its QR iteration are not
+// included.
+template<typename Field>
+size_t PeakExtraEntries( Int n );
+
+} // namespace eig
+
 template<typename Field>
 void Eig
 ( Matrix<Field>& A,
   Matrix<Complex<Base<Field>>>& w,
-  Matrix<Complex<Base<Field>>>& X );
+  Matrix<Complex<Base<Field>>>& X,
+  const EigCtrl& ctrl=EigCtrl() );
 template<typename Field>
 void Eig
 ( AbstractDistMatrix<Field>& A,
   AbstractDistMatrix<Complex<Base<Field>>>& w,
-  AbstractDistMatrix<Complex<Base<Field>>>& X );
+  AbstractDistMatrix<Complex<Base<Field>>>& X,
+  const EigCtrl& ctrl=EigCtrl() );
 
 // Bidiagonal Singular Value Decomposition
 // =======================================
@@ -1214,6 +1421,28 @@ struct SVDInfo
     BidiagSVDInfo bidiagSVDInfo;
 };
 
+// Parameters for the Halko-Martinsson-Tropp randomized range finder
+// (cf. svd::Randomized)
+struct RandomizedSVDCtrl
+{
+    // The target rank of the approximation
+    Int rank=10;
+
+    // The number of extra columns in the random sketch beyond the target
+    // rank
+    Int oversample=10;
+
+    // The number of power iterations used to sharpen the range estimate
+    // (each is re-orthonormalized to avoid collapsing onto the dominant
+    // singular subspace)
+    Int numPowerIts=2;
+
+    // Whether the matrix should only be touched through a single pass of
+    // sketches of its column and row spaces (at the expense of accuracy),
+    // which is appropriate when revisiting the matrix is expensive
+    bool singlePass=false;
+};
+
 template<typename Real>
 struct SVDCtrl
 {
@@ -1238,6 +1467,7 @@ struct SVDCtrl
     double fullChanRatio=1.5;
 
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
+    RandomizedSVDCtrl randomizedCtrl;
 };
 
 // Compute the singular values
@@ -1276,6 +1506,25 @@ SVDInfo TSQR
 ( const AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Base<Field>>& s );
 
+// Approximate the truncated SVD of A through the randomized range finder
+// of Halko, Martinsson, and Tropp, with the target rank, oversampling,
+// and power-iteration parameters taken from ctrl.randomizedCtrl (which
+// also selects the streaming single-pass variant)
+template<typename Field>
+SVDInfo Randomized
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl=SVDCtrl<Base<Field>>() );
+template<typename Field>
+SVDInfo Randomized
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl=SVDCtrl<Base<Field>>() );
+
 template<typename Real,
          typename=EnableIf<IsReal<Real>>>
 void TwoByTwoUpper
@@ -1488,6 +1737,95 @@ Base<Field> LanczosDecomp
         DistMultiVec<Field>& v,
         Int basisSize=15 );
 
+// Block Lanczos
+// =============
+// Form the projection, T := V^H A V, of an (explicitly) Hermitian matrix
+// onto an orthonormal block Krylov basis V built b columns at a time, so
+// that each application of A becomes a sparse matrix-matrix multiply rather
+// than b separate matrix-vector multiplies. The loss of orthogonality is
+// monitored with a scalar recurrence and full reorthogonalization sweeps are
+// only performed when the estimate degrades past Sqrt(eps), and an optional
+// number of thick restarts compresses the basis onto its extremal Ritz
+// vectors rather than growing it. Note that, unlike the single-vector
+// Lanczos above, T is returned in the (possibly complex) field of A, as the
+// off-diagonal coupling blocks cannot generally be made real.
+
+template<typename Real>
+struct BlockLanczosCtrl
+{
+    Int blockSize=4;
+    Int numBlocks=10;
+
+    // Perform full reorthogonalization sweeps only when the monitored
+    // orthogonality estimate exceeds Sqrt(eps) (rather than at every step)?
+    bool selectiveReorthog=true;
+
+    // The number of thick restarts to (at most) perform after the initial
+    // pass; each keeps roughly half of the basis (split between the two
+    // extremal ends of the spectrum)
+    Int maxRestarts=0;
+    // The relative residual tolerance for declaring the extremal Ritz pairs
+    // converged between restarts (if zero, Sqrt(eps) is used)
+    Real tol=Real(0);
+
+    bool progress=false;
+};
+
+template<typename Field>
+void BlockLanczos
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& T,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() );
+template<typename Field>
+void BlockLanczos
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Field>& T,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() );
+
+// LOBPCG
+// ======
+// Locally Optimal Block Preconditioned Conjugate Gradient iteration for the
+// smallest eigenpairs of a large (explicitly) Hermitian matrix. Unlike the
+// (block) Lanczos routines above, a user-supplied preconditioner callback
+// can be used to accelerate convergence (see the overloads within
+// spectral/LOBPCG.hpp); the overloads below substitute the identity. On
+// return, X holds the Ritz block and w its Ritz values in ascending order
+// (w is returned redundantly on every process in the distributed case, as
+// it is formed from globally-reduced data).
+
+struct LOBPCGInfo
+{
+    Int numIterations=0;
+    Int numConverged=0;
+};
+
+template<typename Real>
+struct LOBPCGCtrl
+{
+    // The number of eigenpairs to simultaneously converge
+    Int blockSize=8;
+
+    Int maxIts=100;
+    // The relative residual tolerance for declaring an eigenpair converged
+    // (if zero, Sqrt(eps) is used)
+    Real tol=Real(0);
+
+    bool progress=false;
+};
+
+template<typename Field>
+LOBPCGInfo LOBPCG
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const LOBPCGCtrl<Base<Field>>& ctrl=LOBPCGCtrl<Base<Field>>() );
+template<typename Field>
+LOBPCGInfo LOBPCG
+( const DistSparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const LOBPCGCtrl<Base<Field>>& ctrl=LOBPCGCtrl<Base<Field>>() );
+
 // Product Lanczos
 // ===============
 // Form the product Lanczos decomposition
@@ -1583,6 +1921,29 @@ struct SnapshotCtrl
     }
 };
 
+// Configuration for cooperative checkpoint/restart of long-running shift
+// iterations: if saveFreq is positive, the solver state (the iterate
+// matrices and per-shift convergence state) is atomically serialized to
+// base+".ckpt" every saveFreq iterations, and setting resume causes the
+// next solve to pick up from that file rather than from a random initial
+// iterate. Currently honored by the sequential inverse-iteration, Lanczos,
+// and restarted Arnoldi drivers.
+struct CheckpointCtrl
+{
+    Int saveFreq=-1;
+    string base="ps";
+    bool resume=false;
+
+    // Whether a multiple of saveFreq was crossed during the last 'stride'
+    // iterations (the Arnoldi driver only stops at restart boundaries)
+    bool ShouldSave( Int numIts, Int stride=1 ) const
+    {
+        return saveFreq > 0 && numIts > 0 &&
+               (numIts/saveFreq) != ((numIts-stride)/saveFreq);
+    }
+    string Filename() const { return base + ".ckpt"; }
+};
+
 template<typename Real>
 struct PseudospecCtrl
 {
@@ -1600,6 +1961,28 @@ struct PseudospecCtrl
     Real tol=Real(1e-6);
     bool deflate=true;
 
+    // If positive, process the shifts in blocks of (at most) this many at a
+    // time: each block's shifts still share their MultiShiftTrsm sweeps and
+    // are deflated out of the block as they converge, but the workspace of
+    // the iteration (several n x numShifts matrices) is kept bounded for
+    // very large spectral clouds
+    Int shiftBlockSize=0;
+
+    // If greater than one, partition the process grid into (at most) this
+    // many independent subgrid teams, each iterating on its own queue of
+    // shifts. Since shifts near the spectrum can require orders of magnitude
+    // more iterations than distant ones, the teams work in rounds of a
+    // (doubling) iteration quantum and pool and re-deal their unconverged
+    // shifts at each round boundary, so that teams whose shifts converged
+    // early take over the queues of the overloaded teams. Each team holds
+    // its own copy of the (quasi-)triangular factor, so this trades memory
+    // for the elimination of the idle time of a static shift partition.
+    // Currently honored by the distributed triangular and quasi-triangular
+    // drivers.
+    Int numTeams=1;
+    // The iteration allowance of the first team round
+    Int teamQuantum=10;
+
     // (Implicitly Restarted) Arnoldi/Lanczos. If basisSize > 1, then
     // there is implicit restarting
     bool arnoldi=true;
@@ -1610,6 +1993,7 @@ struct PseudospecCtrl
     bool progress=false;
 
     SnapshotCtrl snapCtrl;
+    CheckpointCtrl checkpointCtrl;
 
     mutable Complex<Real> center = Complex<Real>(0);
     mutable Real realWidth=Real(0), imagWidth=Real(0);
@@ -2013,6 +2397,8 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 #include <El/lapack_like/spectral/HermitianEig.hpp>
 #include <El/lapack_like/spectral/SVD.hpp>
 #include <El/lapack_like/spectral/Lanczos.hpp>
+#include <El/lapack_like/spectral/BlockLanczos.hpp>
+#include <El/lapack_like/spectral/LOBPCG.hpp>
 #include <El/lapack_like/spectral/ProductLanczos.hpp>
 
 #endif // ifndef EL_SPECTRAL_HPP
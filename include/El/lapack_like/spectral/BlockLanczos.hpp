@@ -0,0 +1,395 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SPECTRAL_BLOCK_LANCZOS_HPP
+#define EL_SPECTRAL_BLOCK_LANCZOS_HPP
+
+namespace El {
+
+// Form the projection T := V^H A V of an (explicitly) Hermitian matrix onto
+// an orthonormal block Krylov basis. The basis is expanded a block of b
+// columns at a time so that each application of A amortizes into a single
+// sparse matrix-matrix multiply, the new block is only reorthogonalized
+// against the entire basis when a scalar recurrence suggests that the
+// three-term recurrence has lost orthogonality past Sqrt(eps), and an
+// optional number of thick restarts compresses the basis onto its extremal
+// Ritz vectors (so that long searches need not store or orthogonalize
+// against an ever-growing basis).
+//
+// As with the single-vector Lanczos, the current implementation exists for
+// the purpose of cheap estimates of the extremal eigenvalues of very large
+// sparse operators; the eigenvalues of the returned T are the estimates.
+//
+
+namespace block_lanczos {
+
+// Orthonormalize W in place via twice-iterated Cholesky-based QR, returning
+// the (upper-triangular) factor B such that W_orig = W B. The second pass
+// both cleans up the orthogonality of the first and detects near rank
+// deficiency, which is reported through a return value of 'false'.
+template<typename Field>
+bool CholeskyQR( Matrix<Field>& W, Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int b = W.Width();
+    Matrix<Field> G;
+    Zeros( G, b, b );
+    Herk( UPPER, ADJOINT, Real(1), W, Real(0), G );
+    try
+    {
+        Cholesky( UPPER, G );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), G, W );
+        B = G;
+        Zeros( G, b, b );
+        Herk( UPPER, ADJOINT, Real(1), W, Real(0), G );
+        Cholesky( UPPER, G );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), G, W );
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), G, B );
+    }
+    catch( NonHPDMatrixException& e ) { return false; }
+    return true;
+}
+
+// The same, but with the tall matrix distributed by rows over 'comm' and
+// only its local portion provided
+template<typename Field>
+bool CholeskyQR( Matrix<Field>& WLoc, Matrix<Field>& B, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int b = WLoc.Width();
+    Matrix<Field> G;
+    Zeros( G, b, b );
+    Herk( UPPER, ADJOINT, Real(1), WLoc, Real(0), G );
+    mpi::AllReduce( G.Buffer(), b*b, mpi::SUM, comm );
+    try
+    {
+        Cholesky( UPPER, G );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), G, WLoc );
+        B = G;
+        Zeros( G, b, b );
+        Herk( UPPER, ADJOINT, Real(1), WLoc, Real(0), G );
+        mpi::AllReduce( G.Buffer(), b*b, mpi::SUM, comm );
+        Cholesky( UPPER, G );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), G, WLoc );
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), G, B );
+    }
+    catch( NonHPDMatrixException& e ) { return false; }
+    return true;
+}
+
+template<typename Field>
+bool CholeskyQR( DistMultiVec<Field>& W, Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    return CholeskyQR( W.Matrix(), B, W.Grid().Comm() );
+}
+
+// Subtract off the components of W in the directions of columns [lo,hi) of
+// the basis, returning the coefficients H := V(:,lo:hi)^H W
+template<typename Field>
+void ProjectOut
+( const Matrix<Field>& V, Int lo, Int hi,
+        Matrix<Field>& W, Matrix<Field>& H )
+{
+    EL_DEBUG_CSE
+    auto VSub = V( ALL, IR(lo,hi) );
+    Gemm( ADJOINT, NORMAL, Field(1), VSub, W, H );
+    Gemm( NORMAL, NORMAL, Field(-1), VSub, H, Field(1), W );
+}
+
+template<typename Field>
+void ProjectOut
+( const DistMultiVec<Field>& V, Int lo, Int hi,
+        DistMultiVec<Field>& W, Matrix<Field>& H )
+{
+    EL_DEBUG_CSE
+    auto VSub = V.LockedMatrix()( ALL, IR(lo,hi) );
+    Zeros( H, hi-lo, W.Width() );
+    Gemm( ADJOINT, NORMAL, Field(1), VSub, W.LockedMatrix(), Field(0), H );
+    mpi::AllReduce
+    ( H.Buffer(), (hi-lo)*W.Width(), mpi::SUM, W.Grid().Comm() );
+    Gemm( NORMAL, NORMAL, Field(-1), VSub, H, Field(1), W.Matrix() );
+}
+
+// Copy the block W into columns [dest,dest+b) of the basis
+template<typename Field>
+void PlaceBlock( const Matrix<Field>& W, Matrix<Field>& V, Int dest )
+{
+    EL_DEBUG_CSE
+    auto VSub = V( ALL, IR(dest,dest+W.Width()) );
+    VSub = W;
+}
+
+template<typename Field>
+void PlaceBlock
+( const DistMultiVec<Field>& W, DistMultiVec<Field>& V, Int dest )
+{
+    EL_DEBUG_CSE
+    auto VSub = V.Matrix()( ALL, IR(dest,dest+W.Width()) );
+    VSub = W.LockedMatrix();
+}
+
+// Overwrite the first Q.Width() columns of the basis with V Q
+template<typename Field>
+void RestartBasis( Matrix<Field>& V, const Matrix<Field>& Q )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> VNew;
+    Gemm( NORMAL, NORMAL, Field(1), V, Q, VNew );
+    auto VSub = V( ALL, IR(0,Q.Width()) );
+    VSub = VNew;
+}
+
+template<typename Field>
+void RestartBasis( DistMultiVec<Field>& V, const Matrix<Field>& Q )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> VNewLoc;
+    Gemm( NORMAL, NORMAL, Field(1), V.LockedMatrix(), Q, VNewLoc );
+    auto VSub = V.Matrix()( ALL, IR(0,Q.Width()) );
+    VSub = VNewLoc;
+}
+
+// Reorthonormalize the first 'keep' columns of the basis, returning the
+// (near-identity) upper-triangular change-of-basis factor R
+template<typename Field>
+bool OrthonormalizeKept( Matrix<Field>& V, Int keep, Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    auto VSub = V( ALL, IR(0,keep) );
+    return CholeskyQR( VSub, R );
+}
+
+template<typename Field>
+bool OrthonormalizeKept( DistMultiVec<Field>& V, Int keep, Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    auto VSub = V.Matrix()( ALL, IR(0,keep) );
+    return CholeskyQR( VSub, R, V.Grid().Comm() );
+}
+
+template<typename Field>
+bool IsRoot( const Matrix<Field>& V ) { return true; }
+template<typename Field>
+bool IsRoot( const DistMultiVec<Field>& V )
+{ return V.Grid().Rank() == 0; }
+
+// The driver shared between the sequential and distributed variants: the
+// basis and block workspace are of the same (caller-constructed) type, while
+// T is maintained as a sequential matrix (redundantly on every rank in the
+// distributed case, as every update is formed from globally-reduced data).
+template<typename Field,class ApplyAType,class BasisType>
+void Run
+(       Int n,
+  const ApplyAType& applyA,
+        BasisType& V,
+        BasisType& W,
+        Matrix<Field>& T,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real sqrtEps = Sqrt(eps);
+    const Real tol = ( ctrl.tol == Real(0) ? sqrtEps : ctrl.tol );
+
+    const Int b = Min( ctrl.blockSize, n );
+    const Int numBlocks = Max( Min( ctrl.numBlocks, n/b ), Int(1) );
+    const Int dim = numBlocks*b;
+
+    Zeros( T, dim, dim );
+    Zeros( V, n, dim );
+
+    // Choose and orthonormalize the initial block
+    // -------------------------------------------
+    Matrix<Field> B, H, HSecond;
+    Uniform( W, n, b );
+    if( !CholeskyQR( W, B ) )
+        LogicError("Could not orthonormalize the initial block");
+
+    Int j0 = 0;          // the number of locked (kept) columns
+    Int effDim = dim;    // lowered if the recurrence breaks down
+    Real omega = eps;    // the running orthogonality-loss estimate
+    Real normTEst = 0;   // a running lower bound on || T ||_2
+    bool brokeDown = false;
+    for( Int restart=0; restart<=ctrl.maxRestarts; ++restart )
+    {
+        // Expand the basis from column j0 up to column dim
+        // ------------------------------------------------
+        Int p = j0;
+        PlaceBlock( W, V, p );
+        while( true )
+        {
+            // W := A V_p
+            // ----------
+            auto VBlk = V( ALL, IR(p,p+b) );
+            applyA( VBlk, W );
+
+            // Orthogonalize, by default only against the previous blocks
+            // ----------------------------------------------------------
+            // Two passes of Gram-Schmidt are used; the sweep covers the
+            // entire basis directly after a restart (where the locked Ritz
+            // vectors genuinely couple to the new block), when the
+            // orthogonality estimate has degraded past Sqrt(eps), or always
+            // when selective reorthogonalization was disabled
+            const bool fullSweep = ( p == j0 && j0 > 0 ) ||
+                                   !ctrl.selectiveReorthog ||
+                                   omega > sqrtEps;
+            const Int lo = ( fullSweep ? 0 : Max(p-b,Int(0)) );
+            if( !fullSweep && j0 > 0 )
+            {
+                // Always subtract off the locked directions (twice, as the
+                // new Krylov directions become nearly parallel to them once
+                // the corresponding Ritz vectors converge); the coefficients
+                // are roundoff and need not enter T
+                ProjectOut( V, 0, j0, W, HSecond );
+                ProjectOut( V, 0, j0, W, HSecond );
+            }
+            ProjectOut( V, lo, p+b, W, H );
+            ProjectOut( V, lo, p+b, W, HSecond );
+            Axpy( Field(1), HSecond, H );
+            if( fullSweep )
+                omega = eps;
+
+            // Record the new column block of T (the locked rows are only
+            // nonzero for the first block after a restart; the coefficients
+            // onto the interior of the basis are discarded as noise)
+            const Int recLo = ( p == j0 ? lo : p-b );
+            for( Int j=0; j<b; ++j )
+            {
+                for( Int i=recLo; i<p+b; ++i )
+                {
+                    if( i > p+j )
+                        continue; // set by symmetry from the upper triangle
+                    const Field eta = H(i-lo,j);
+                    T(i,p+j) = eta;
+                    T(p+j,i) = Conj(eta);
+                }
+            }
+
+            // Orthonormalize the residual block
+            // ---------------------------------
+            const bool qrSuccess = CholeskyQR( W, B );
+            Real betaMin = limits::Max<Real>();
+            for( Int j=0; j<b; ++j )
+                betaMin = Min( betaMin, Abs(B(j,j)) );
+            normTEst = Max( normTEst, FrobeniusNorm(H)+FrobeniusNorm(B) );
+            if( !qrSuccess || betaMin <= eps*Max(normTEst,Real(1)) )
+            {
+                if( ctrl.progress && IsRoot(V) )
+                    Output
+                    ("Block Lanczos broke down at column ",p+b," of ",dim);
+                effDim = p+b;
+                brokeDown = true;
+                break;
+            }
+            omega = (omega+eps)*(normTEst/betaMin);
+
+            if( p+2*b <= dim )
+            {
+                // Append the next block and record its coupling
+                // ---------------------------------------------
+                for( Int j=0; j<b; ++j )
+                {
+                    for( Int i=0; i<=j; ++i )
+                    {
+                        T(p+b+i,p+j) = B(i,j);
+                        T(p+j,p+b+i) = Conj(B(i,j));
+                    }
+                }
+                PlaceBlock( W, V, p+b );
+                p += b;
+            }
+            else
+                break; // W and B hold the residual for a possible restart
+        }
+        if( brokeDown || restart == ctrl.maxRestarts )
+            break;
+
+        // Thick restart: compress the basis onto its extremal Ritz vectors
+        // ----------------------------------------------------------------
+        Matrix<Field> TCopy( T ), Q;
+        Matrix<Real> w;
+        HermitianEig( UPPER, TCopy, w, Q );
+
+        // The Ritz residuals are the column norms of B Q(end-b:end,:)
+        Matrix<Field> S;
+        auto QBot = Q( IR(dim-b,dim), ALL );
+        Gemm( NORMAL, NORMAL, Field(1), B, QBot, S );
+        const Real resLo = FrobeniusNorm( S(ALL,IR(0)) );
+        const Real resHi = FrobeniusNorm( S(ALL,IR(dim-1)) );
+        const Real normT = Max( Abs(w(0,0)), Abs(w(dim-1,0)) );
+        if( ctrl.progress && IsRoot(V) )
+            Output
+            ("Block Lanczos restart ",restart,": extremal Ritz values ",
+             w(0,0)," and ",w(dim-1,0)," with residuals ",resLo," and ",
+             resHi);
+        if( resLo <= tol*normT && resHi <= tol*normT )
+            break;
+
+        // Keep the extremal halves of the spectrum, leaving a whole number
+        // of blocks free for the next expansion
+        const Int numFree = Max( dim/(2*b), Int(1) )*b;
+        const Int keep = dim - numFree;
+        if( keep <= 0 )
+            break; // a single-block basis cannot be compressed
+        const Int keepLo = (keep+1)/2;
+        const Int keepHi = keep - keepLo;
+        Matrix<Field> QSel;
+        Zeros( QSel, dim, keep );
+        for( Int j=0; j<keepLo; ++j )
+        {
+            auto qSel = QSel( ALL, IR(j) );
+            qSel = Q( ALL, IR(j) );
+        }
+        for( Int j=0; j<keepHi; ++j )
+        {
+            auto qSel = QSel( ALL, IR(keepLo+j) );
+            qSel = Q( ALL, IR(dim-keepHi+j) );
+        }
+        RestartBasis( V, QSel );
+        Zeros( T, dim, dim );
+        for( Int j=0; j<keepLo; ++j )
+            T(j,j) = w(j,0);
+        for( Int j=0; j<keepHi; ++j )
+            T(keepLo+j,keepLo+j) = w(dim-keepHi+j,0);
+
+        // Recombining the basis compounds its orthogonality error
+        // geometrically across restarts if left unchecked, so the kept
+        // columns are freshly orthonormalized and the (near-identity)
+        // change of basis is folded into the projection, T := R^-H T R^-1
+        Matrix<Field> R;
+        if( !OrthonormalizeKept( V, keep, R ) )
+            break;
+        auto TSub = T( IR(0,keep), IR(0,keep) );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), R, TSub );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, Field(1), R, TSub );
+
+        // The residual block likewise inherits the old basis's error, so
+        // clean it against the kept columns and reorthonormalize it before
+        // it seeds the next expansion (its coupling to the locked columns
+        // is recomputed, as the projection of A W onto them, by the full
+        // sweep at the start of that expansion)
+        ProjectOut( V, 0, keep, W, HSecond );
+        ProjectOut( V, 0, keep, W, HSecond );
+        Matrix<Field> RW;
+        if( !CholeskyQR( W, RW ) )
+            break;
+        j0 = keep;
+    }
+    if( effDim < dim )
+        T.Resize( effDim, effDim );
+}
+
+} // namespace block_lanczos
+
+} // namespace El
+
+#endif // ifndef EL_SPECTRAL_BLOCK_LANCZOS_HPP
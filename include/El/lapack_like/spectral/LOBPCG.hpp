@@ -0,0 +1,295 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SPECTRAL_LOBPCG_HPP
+#define EL_SPECTRAL_LOBPCG_HPP
+
+namespace El {
+
+// Locally Optimal Block Preconditioned Conjugate Gradient iteration for the
+// smallest eigenpairs of a large (explicitly) Hermitian matrix. Each
+// iteration performs a Rayleigh-Ritz procedure over the 3b-dimensional
+// subspace spanned by the current Ritz block X, the preconditioned residual
+// block W, and the implicit conjugate-direction block P, so that a single
+// application of A to b vectors (plus one application of the preconditioner)
+// is performed per iteration. All of the inner products required by the
+// Rayleigh-Ritz procedure, together with the residual norms, are merged into
+// a single AllReduce per iteration in the distributed case.
+//
+// The preconditioner is supplied as a callback which overwrites its second
+// argument with an approximation of A^{-1} applied to its first; the
+// unpreconditioned variants substitute the identity.
+//
+
+namespace lobpcg {
+
+// Plumbing which allows the iteration to be written once over both the
+// sequential and distributed (locally-stored) bases
+template<typename Field>
+inline Matrix<Field>& LocalMatrix( Matrix<Field>& X ) { return X; }
+template<typename Field>
+inline Matrix<Field>& LocalMatrix( DistMultiVec<Field>& X )
+{ return X.Matrix(); }
+
+template<typename Field>
+inline void GlobalSum( const Matrix<Field>& X, Matrix<Field>& C )
+{ }
+template<typename Field>
+inline void GlobalSum( const DistMultiVec<Field>& X, Matrix<Field>& C )
+{
+    mpi::AllReduce
+    ( C.Buffer(), C.Height()*C.Width(), mpi::SUM, X.Grid().Comm() );
+}
+
+template<typename Field,
+         class ApplyAType,
+         class ApplyPrecType,
+         class BasisType>
+LOBPCGInfo Run
+(       Int n,
+  const ApplyAType& applyA,
+  const ApplyPrecType& applyPrec,
+        Matrix<Base<Field>>& w,
+        BasisType& X,
+  const LOBPCGCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol == Real(0) ? Sqrt(eps) : ctrl.tol );
+    const Int b = Min( ctrl.blockSize, n );
+    LOBPCGInfo info;
+
+    // Fall back to a random initial block unless a conforming one was given
+    if( X.Height() != n || X.Width() != b )
+        Uniform( X, n, b );
+    Matrix<Field> RFact;
+    if( !block_lanczos::CholeskyQR( X, RFact ) )
+        RuntimeError("LOBPCG initial block was numerically rank-deficient");
+
+    BasisType AX(X), R(X), W(X), AW(X), P(X), AP(X);
+    P.Resize( n, 0 );
+    AP.Resize( n, 0 );
+    applyA( X, AX );
+
+    auto& XLoc = LocalMatrix( X );
+    auto& AXLoc = LocalMatrix( AX );
+    auto& RLoc = LocalMatrix( R );
+    auto& WLoc = LocalMatrix( W );
+    auto& AWLoc = LocalMatrix( AW );
+    auto& PLoc = LocalMatrix( P );
+    auto& APLoc = LocalMatrix( AP );
+    const Int nLoc = XLoc.Height();
+
+    // Rayleigh-Ritz within span(X) to initialize the Ritz values
+    Matrix<Field> G, Y;
+    Matrix<Real> theta;
+    Zeros( G, b, b );
+    Gemm( ADJOINT, NORMAL, Field(1), XLoc, AXLoc, Field(0), G );
+    GlobalSum( X, G );
+    HermitianEig( UPPER, G, theta, Y );
+    Matrix<Field> Z( XLoc );
+    Gemm( NORMAL, NORMAL, Field(1), Z, Y, Field(0), XLoc );
+    Z = AXLoc;
+    Gemm( NORMAL, NORMAL, Field(1), Z, Y, Field(0), AXLoc );
+
+    Matrix<Real> resNorms;
+    Zeros( resNorms, b, 1 );
+    Real normAEst = Real(0);
+    Int pWidth = 0;
+    Int iter = 0;
+    for( ; iter<ctrl.maxIts; ++iter )
+    {
+        // R := A X - X diag(theta)
+        RLoc = AXLoc;
+        for( Int j=0; j<b; ++j )
+        {
+            const Real thetaJ = theta(j,0);
+            const Field* xCol = XLoc.LockedBuffer(0,j);
+                  Field* rCol = RLoc.Buffer(0,j);
+            for( Int iLoc=0; iLoc<nLoc; ++iLoc )
+                rCol[iLoc] -= thetaJ*xCol[iLoc];
+        }
+
+        applyPrec( R, W );
+        applyA( W, AW );
+
+        // Gather the basis S = [ X, W, P ] (and A S) locally so that both
+        // Gram matrices and the residual norms can share one AllReduce
+        const Int sWidth = 2*b + pWidth;
+        Matrix<Field> SLoc, ASLoc;
+        Zeros( SLoc, nLoc, sWidth );
+        Zeros( ASLoc, nLoc, sWidth );
+        {
+            auto S0 = SLoc( ALL, IR(0,b) );      S0 = XLoc;
+            auto S1 = SLoc( ALL, IR(b,2*b) );    S1 = WLoc;
+            auto AS0 = ASLoc( ALL, IR(0,b) );    AS0 = AXLoc;
+            auto AS1 = ASLoc( ALL, IR(b,2*b) );  AS1 = AWLoc;
+            if( pWidth > 0 )
+            {
+                auto S2 = SLoc( ALL, IR(2*b,sWidth) );    S2 = PLoc;
+                auto AS2 = ASLoc( ALL, IR(2*b,sWidth) );  AS2 = APLoc;
+            }
+        }
+        Matrix<Field> C;
+        Zeros( C, sWidth, 2*sWidth+1 );
+        auto GM = C( ALL, IR(0,sWidth) );
+        auto GA = C( ALL, IR(sWidth,2*sWidth) );
+        Gemm( ADJOINT, NORMAL, Field(1), SLoc, SLoc, Field(0), GM );
+        Gemm( ADJOINT, NORMAL, Field(1), SLoc, ASLoc, Field(0), GA );
+        for( Int j=0; j<b; ++j )
+        {
+            Real sum = 0;
+            const Field* rCol = RLoc.LockedBuffer(0,j);
+            for( Int iLoc=0; iLoc<nLoc; ++iLoc )
+                sum += RealPart(Conj(rCol[iLoc])*rCol[iLoc]);
+            C(j,2*sWidth) = sum;
+        }
+        GlobalSum( X, C );
+
+        for( Int j=0; j<b; ++j )
+        {
+            resNorms(j,0) = Sqrt( RealPart(C(j,2*sWidth)) );
+            normAEst = Max( normAEst, Abs(theta(j,0)) );
+        }
+        info.numConverged = 0;
+        for( Int j=0; j<b; ++j )
+            if( resNorms(j,0) <= tol*Max(normAEst,Real(1)) )
+                ++info.numConverged;
+        if( ctrl.progress && block_lanczos::IsRoot(X) )
+            Output
+            ("LOBPCG iteration ",iter,": ",info.numConverged," of ",b,
+             " converged, max residual = ",MaxNorm(resNorms));
+        if( info.numConverged == b )
+            break;
+
+        // Implicitly scale the basis columns to unit length to improve the
+        // conditioning of the projected pencil (W and P are otherwise left
+        // unnormalized to avoid further reductions)
+        vector<Real> scales(sWidth);
+        for( Int j=0; j<sWidth; ++j )
+        {
+            const Real diag = Sqrt( RealPart(GM(j,j)) );
+            scales[j] = ( diag > Real(0) ? diag : Real(1) );
+        }
+        for( Int j=0; j<sWidth; ++j )
+        {
+            for( Int i=0; i<sWidth; ++i )
+            {
+                GM(i,j) /= scales[i]*scales[j];
+                GA(i,j) /= scales[i]*scales[j];
+            }
+        }
+
+        // Rayleigh-Ritz over span(S); if the Gram matrix of the subspace is
+        // numerically indefinite (the search directions have become
+        // dependent, which is typical near convergence), retry with the
+        // conjugate directions dropped before giving up
+        Int useWidth = sWidth;
+        Matrix<Real> thetaAll;
+        Matrix<Field> YAll;
+        bool ritzFailed = false;
+        while( true )
+        {
+            Matrix<Field> GASub( GA(IR(0,useWidth),IR(0,useWidth)) ),
+                          GMSub( GM(IR(0,useWidth),IR(0,useWidth)) );
+            try
+            {
+                HermitianGenDefEig
+                ( AXBX, UPPER, GASub, GMSub, thetaAll, YAll );
+                break;
+            }
+            catch( NonHPDMatrixException& e )
+            {
+                if( useWidth == 2*b )
+                {
+                    ritzFailed = true;
+                    break;
+                }
+                useWidth = 2*b;
+            }
+        }
+        if( ritzFailed )
+            break;
+
+        Matrix<Field> YSub( YAll(ALL,IR(0,b)) );
+        for( Int j=0; j<b; ++j )
+        {
+            for( Int i=0; i<useWidth; ++i )
+                YSub(i,j) /= scales[i];
+            theta(j,0) = thetaAll(j,0);
+        }
+
+        // X := S Y and A X := (A S) Y, avoiding a fresh application of A,
+        // while the new conjugate-direction block collects the W and P
+        // contributions to the new iterates
+        auto SUse = SLoc( ALL, IR(0,useWidth) );
+        auto ASUse = ASLoc( ALL, IR(0,useWidth) );
+        auto SDir = SLoc( ALL, IR(b,useWidth) );
+        auto ASDir = ASLoc( ALL, IR(b,useWidth) );
+        auto YDir = YSub( IR(b,useWidth), ALL );
+        Gemm( NORMAL, NORMAL, Field(1), SUse, YSub, Field(0), XLoc );
+        Gemm( NORMAL, NORMAL, Field(1), ASUse, YSub, Field(0), AXLoc );
+        P.Resize( n, b );
+        AP.Resize( n, b );
+        Gemm( NORMAL, NORMAL, Field(1), SDir, YDir, Field(0), PLoc );
+        Gemm( NORMAL, NORMAL, Field(1), ASDir, YDir, Field(0), APLoc );
+        pWidth = b;
+    }
+    info.numIterations = iter;
+    w = theta;
+    return info;
+}
+
+} // namespace lobpcg
+
+template<typename Field,class ApplyPrecType>
+LOBPCGInfo LOBPCG
+( const SparseMatrix<Field>& A,
+  const ApplyPrecType& applyPrec,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const LOBPCGCtrl<Base<Field>>& ctrl=LOBPCGCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const Matrix<Field>& Y, Matrix<Field>& Z )
+      {
+          Zeros( Z, n, Y.Width() );
+          Multiply( NORMAL, Field(1), A, Y, Field(0), Z );
+      };
+    return lobpcg::Run<Field>( n, applyA, applyPrec, w, X, ctrl );
+}
+
+template<typename Field,class ApplyPrecType>
+LOBPCGInfo LOBPCG
+( const DistSparseMatrix<Field>& A,
+  const ApplyPrecType& applyPrec,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const LOBPCGCtrl<Base<Field>>& ctrl=LOBPCGCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const DistMultiVec<Field>& Y, DistMultiVec<Field>& Z )
+      {
+          Zeros( Z, n, Y.Width() );
+          Multiply( NORMAL, Field(1), A, Y, Field(0), Z );
+      };
+    return lobpcg::Run<Field>( n, applyA, applyPrec, w, X, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPECTRAL_LOBPCG_HPP
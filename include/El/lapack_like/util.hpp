@@ -21,9 +21,35 @@ struct BisectCtrl
     Int cutoff;
     bool storeFactRecvInds;
 
+    // The maximum fraction of a merged front's entries which may consist of
+    // fill introduced by relaxed supernode amalgamation during the symbolic
+    // analysis (zero disables amalgamation). Modest values (e.g., 0.1) merge
+    // the many tiny fronts produced for very sparse matrices into fronts
+    // large enough for blocked dense kernels.
+    double amalgFillFraction;
+
+    // Use the native multilevel bisection engine (see MultilevelBisect)
+    // rather than the (Par)METIS interfaces. When Elemental was built
+    // without METIS support, the native engine is used regardless.
+    bool useNativeBisect;
+
+    // Assign each side of a distributed bisection a number of processes
+    // proportional to an estimate of its factorization work rather than
+    // splitting the team evenly, which leaves processes idle beneath small
+    // subtrees of unbalanced elimination trees. Disabling this falls back
+    // to the classical even split.
+    bool proportionalMapping;
+
+    // Have the root process print the estimated load-balance factor of each
+    // distributed process split (the maximum per-process work divided by the
+    // ideal even share).
+    bool reportLoadBalance;
+
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false), amalgFillFraction(0.),
+      useNativeBisect(false), proportionalMapping(true),
+      reportLoadBalance(false)
     { }
 };
 
@@ -43,6 +69,22 @@ Int Bisect
         bool& onLeft,
   const BisectCtrl& ctrl=BisectCtrl() );
 
+// A native multilevel bisection (heavy-edge matching coarsening, greedy
+// region-growing initial partition, and boundary Fiduccia-Mattheyses
+// refinement during uncoarsening) which does not require METIS. The
+// three-way partition routine labels each source with 0 (left), 1 (right),
+// or 2 (separator) and returns the size of the separator.
+Int MultilevelVertexSeparator
+( const Graph& graph,
+        vector<Int>& part,
+  const BisectCtrl& ctrl=BisectCtrl() );
+Int MultilevelBisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& perm,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
 Int NaturalBisect
 ( Int nx,
   Int ny,
@@ -82,7 +124,8 @@ void BuildChildrenFromPerm
 void BuildChildFromPerm
 ( const DistGraph& graph, const DistMap& perm,
   Int leftChildSize, Int rightChildSize,
-  bool& onLeft, unique_ptr<Grid>& childGrid, DistGraph& child );
+  bool& onLeft, unique_ptr<Grid>& childGrid, DistGraph& child,
+  const BisectCtrl& ctrl=BisectCtrl() );
 
 // Median
 // ======
@@ -6,6 +6,18 @@
    which can be found in the LICENSE file in the root directory, or at 
    http://opensource.org/licenses/BSD-2-Clause
 */
+// Honor the configure-time, library-wide instantiation opt-outs by mapping
+// them onto the per-file EL_NO_*_PROTO macros; since the extern-template
+// declarations in the headers pass through this same logic, they remain
+// consistent with the instantiations actually compiled into the library
+#if defined(EL_DISABLE_FLOAT) && !defined(EL_NO_FLOAT_PROTO)
+# define EL_NO_FLOAT_PROTO
+#endif
+#if (defined(EL_DISABLE_FLOAT) || defined(EL_DISABLE_COMPLEX_FLOAT)) && \
+    !defined(EL_NO_COMPLEX_FLOAT_PROTO)
+# define EL_NO_COMPLEX_FLOAT_PROTO
+#endif
+
 #ifndef PROTO_INT
 # define PROTO_INT(T) PROTO(T)
 #endif
@@ -51,6 +51,8 @@ template<typename T>
 void Circulant( AbstractDistMatrix<T>& A, const Matrix<T>& a );
 template<typename T>
 void Circulant( AbstractDistMatrix<T>& A, const vector<T>& a );
+template<typename T>
+void Circulant( LazyMatrix<T>& A, const vector<T>& a );
 
 // Diagonal
 // --------
@@ -93,6 +95,8 @@ template<typename Real>
 void Fourier( Matrix<Complex<Real>>& A, Int n );
 template<typename Real>
 void Fourier( AbstractDistMatrix<Complex<Real>>& A, Int n );
+template<typename Real>
+void Fourier( LazyMatrix<Complex<Real>>& A, Int n );
 
 // Greatest Common Denominator matrix
 // ----------------------------------
@@ -159,6 +163,9 @@ void Toeplitz
 template<typename S,typename T>
 void Toeplitz
 ( AbstractDistMatrix<S>& A, Int m, Int n, const vector<T>& a );
+template<typename S,typename T>
+void Toeplitz
+( LazyMatrix<S>& A, Int m, Int n, const vector<T>& a );
 
 // Walsh
 // -----
@@ -55,6 +55,17 @@ void Circulant( AbstractDistMatrix<T>& A, const vector<T>& a )
     IndexDependentFill( A, function<T(Int,Int)>(circFill) );
 }
 
+template<typename T>
+void Circulant( LazyMatrix<T>& A, const vector<T>& a )
+{
+    EL_DEBUG_CSE
+    const Int n = a.size();
+    // The first column is captured by value so that the view remains valid
+    // after the caller's buffer goes out of scope
+    auto circFill = [a,n]( Int i, Int j ) -> T { return a[Mod(i-j,n)]; };
+    A.Reset( n, n, function<T(Int,Int)>(circFill) );
+}
+
 } // namespace El
 
 #endif // ifndef EL_MATRICES_DETERMINISTIC_CLASSICAL_CIRCULANT_HPP
@@ -33,6 +33,7 @@ public:
 private:
     bool keepAll_;
     T lowerBound_; // always return the first prime >= lowerBound_
+    T generatedBound_; // the largest bound fully covered by Generate
     T oddPrimeBound_;
     vector<TSmall> oddPrimeStarts_;
 
@@ -46,6 +47,11 @@ private:
     // corresponds to a precomputed prime (i.e., table[halvedIndex] is one)
     bool SeekSegmentPrime();
     TSmall ComputeSegmentStart( const TSmall& p ) const;
+    TSmall ComputeIntervalStart( const TSmall& p, const T& intervalOffset )
+      const;
+
+    void FillWheelPattern( T intervalOffset, vector<char>& table ) const;
+    void SieveInterval( T intervalOffset, vector<char>& table ) const;
 
     void AugmentPrimes( T numPrimes );
     void MoveSegmentOffset( T segmentOffset );
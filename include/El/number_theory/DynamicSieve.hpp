@@ -18,6 +18,7 @@ DynamicSieve<T,TSmall>::DynamicSieve
   TSmall segmentSize )
 {
     keepAll_ = false;
+    generatedBound_ = 0;
     oddPrimeBound_ = 0;
 
     // Ensure that the lower bound is odd
@@ -127,6 +128,12 @@ void DynamicSieve<T,TSmall>::SetStorage( bool keepAll )
 template<typename T,typename TSmall>
 void DynamicSieve<T,TSmall>::Generate( T upperBound )
 {
+    // The sieve (and, in particular, the global trial-division sieve) is
+    // persistent, so bulk scans which repeatedly request the same bound
+    // should not pay for anything beyond the first generation
+    if( upperBound <= generatedBound_ )
+        return;
+
     SetStorage( true );
 
     // Compute all of the needed "small" odd primes for testing candidates
@@ -143,19 +150,42 @@ void DynamicSieve<T,TSmall>::Generate( T upperBound )
         MoveSegmentOffset( oddPrimes.back()+2 );
     }
 
-    for( ; segmentOffset_<upperBound; segmentOffset_+=2*segmentSize_ )
+    // Sieve batches of segments in parallel: every prime that can be
+    // crossed off below 'upperBound' is already stored, so the segments
+    // are independent once their starting indices are computed from scratch.
+    // The primes are then harvested serially, in order.
+    const T segmentSpan = 2*T(segmentSize_);
+    const Int maxBatchSize = 32;
+    vector<vector<char>> tables( maxBatchSize );
+    T offset = segmentOffset_;
+    while( offset < upperBound )
     {
-        SieveSegment();
-        for( TSmall k=0; k<segmentSize_; ++k )
+        const T numSegmentsLeft = (upperBound-offset+segmentSpan-1) /
+                                  segmentSpan;
+        const Int numSegments = Int(Min(T(maxBatchSize),numSegmentsLeft));
+        EL_PARALLEL_FOR
+        for( Int b=0; b<numSegments; ++b )
+            SieveInterval( offset + T(b)*segmentSpan, tables[b] );
+        for( Int b=0; b<numSegments; ++b )
         {
-            if( segmentTable_[k] )
-            {
-                T p = segmentOffset_ + 2*k;
-                oddPrimes.push_back( p );
-            }
+            const T intervalOffset = offset + T(b)*segmentSpan;
+            const auto& table = tables[b];
+            for( TSmall k=0; k<segmentSize_; ++k )
+                if( table[k] )
+                    oddPrimes.push_back( intervalOffset + 2*k );
         }
+        offset += T(numSegments)*segmentSpan;
+    }
+
+    // Re-anchor the serial segment machinery (whose incrementally carried
+    // starting indices were bypassed above) at the first unharvested segment
+    if( offset != segmentOffset_ )
+    {
+        MoveSegmentOffset( offset );
+        SieveSegment();
     }
 
+    generatedBound_ = upperBound;
     SetStorage( false );
 }
 
@@ -179,19 +209,29 @@ bool DynamicSieve<T,TSmall>::SeekSegmentPrime()
     return false;
 }
 
-// Find the integer k such that segmentOffset_ + 2*k is the first odd 
+// Find the integer k such that segmentOffset_ + 2*k is the first odd
 // multiple of p that is greater than or equal to Max(segmentOffset_,p^2)
 template<typename T,typename TSmall>
 TSmall DynamicSieve<T,TSmall>::ComputeSegmentStart
 ( const TSmall& p ) const
+{ return ComputeIntervalStart( p, segmentOffset_ ); }
+
+// The same, but relative to an arbitrary interval offset so that intervals
+// other than the current segment may be sieved
+template<typename T,typename TSmall>
+TSmall DynamicSieve<T,TSmall>::ComputeIntervalStart
+( const TSmall& p, const T& intervalOffset ) const
 {
-    if( p*p >= segmentOffset_ )
+    // The square must be formed in the wide type, as TSmall arithmetic
+    // overflows for p above 2^16 (i.e., when sieving beyond ~4*10^9)
+    const T pSquared = T(p)*T(p);
+    if( pSquared >= intervalOffset )
     {
-        return (p*p - segmentOffset_) / 2;
+        return TSmall( (pSquared - intervalOffset) / 2 );
     }
     else
     {
-        auto complement = (p - (segmentOffset_ % p)) % p;
+        auto complement = TSmall( (T(p) - (intervalOffset % p)) % p );
         if( complement % 2 == 0 )
         {
             return complement / 2;
@@ -249,12 +289,64 @@ void DynamicSieve<T,TSmall>::AugmentPrimes
     }
 }
 
+// Fill the table with the periodic pattern of odd integers surviving the
+// wheel {3,5}: since the candidates are intervalOffset + 2*k, divisibility
+// by 3 and 5 repeats in k with period 15, so one period is built and tiled
+// rather than crossing off the two densest primes stride-by-stride. (The
+// segment offset is guaranteed to lie beyond the initial hard-coded primes,
+// so 3 and 5 themselves can never be candidates.)
+template<typename T,typename TSmall>
+void DynamicSieve<T,TSmall>::FillWheelPattern
+( T intervalOffset, vector<char>& table ) const
+{
+    const TSmall wheelPeriod = 15;
+    char pattern[wheelPeriod];
+    for( TSmall k=0; k<wheelPeriod; ++k )
+    {
+        const T value = intervalOffset + 2*k;
+        pattern[k] = ( value % 3 == 0 || value % 5 == 0 ? 0 : 1 );
+    }
+    table.resize( segmentSize_ );
+    for( TSmall k=0; k<segmentSize_; k+=wheelPeriod )
+        std::memcpy
+        ( &table[k], pattern,
+          std::min(size_t(wheelPeriod),size_t(segmentSize_-k)) );
+}
+
+// Cross off the odd multiples of the stored primes over the interval
+// beginning at the given (odd) offset. Unlike SieveSegment, the starting
+// indices are computed from scratch rather than carried from the previous
+// segment, so distinct intervals may be sieved concurrently.
+template<typename T,typename TSmall>
+void DynamicSieve<T,TSmall>::SieveInterval
+( T intervalOffset, vector<char>& table ) const
+{
+    FillWheelPattern( intervalOffset, table );
+
+    const T largestCandidate = intervalOffset + 2*(segmentSize_-1);
+    const auto factorBound = TSmall(std::sqrt(largestCandidate)) + 1;
+    auto boundIter =
+      std::lower_bound( oddPrimes.begin(), oddPrimes.end(), factorBound );
+    const auto indexEnd = TSmall(boundIter-oddPrimes.begin());
+
+    // The wheel pattern already handled 3 and 5
+    for( TSmall j=2; j<indexEnd; ++j )
+    {
+        const TSmall p = oddPrimes[j];
+        for( auto k=ComputeIntervalStart(p,intervalOffset);
+             k<segmentSize_; k+=p )
+        {
+            table[k] = 0;
+        }
+    }
+}
+
 template<typename T,typename TSmall>
 void DynamicSieve<T,TSmall>::SieveSegment()
 {
-    std::fill( segmentTable_.begin(), segmentTable_.end(), char(1) );
+    FillWheelPattern( segmentOffset_, segmentTable_ );
 
-    // Since sqrt(n) is an upper-bound on the smallest prime factor of 
+    // Since sqrt(n) is an upper-bound on the smallest prime factor of
     // a number n, we can a priori compute which of our stored primes is
     // the last that we need to sieve with in this segment
     T largestCandidate = segmentOffset_ + 2*(segmentSize_-1);
@@ -264,7 +356,7 @@ void DynamicSieve<T,TSmall>::SieveSegment()
     auto indexEnd = TSmall(boundIter-oddPrimes.begin());
 
     // Compute the starting index in this segment of all of the newly
-    // incorporated small primes 
+    // incorporated small primes
     while( oddPrimeBound_ < indexEnd )
     {
         oddPrimeStarts_.push_back
@@ -272,7 +364,10 @@ void DynamicSieve<T,TSmall>::SieveSegment()
         ++oddPrimeBound_;
     }
 
-    for( TSmall j=0; j<indexEnd; ++j )
+    // The wheel pattern already handled 3 and 5 (whose recorded starting
+    // indices are left untouched; they are recomputed whenever the segment
+    // offset moves)
+    for( TSmall j=2; j<indexEnd; ++j )
     {
         TSmall p = oddPrimes[j];
 
@@ -100,9 +100,82 @@ Int AlgebraicRelationSearch
   Int n,
   Base<F> NSqrt,
   Matrix<F>& B,
-  Matrix<F>& U, 
+  Matrix<F>& U,
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// Precision-laddered relation searches
+// ====================================
+// Relation searches rarely need the full input precision to either find a
+// relation or rule one out, so the laddered drivers first attempt the
+// search at a sequence of lower working precisions, lifting each candidate
+// relation back to the input precision for verification (the unimodular
+// transformation is integer-valued and therefore lifts exactly) and only
+// restarting at a higher working precision upon failure. A final attempt
+// at the input precision makes the laddered searches equivalent to the
+// one-shot versions in the worst case. Since the laddering adjusts the
+// (global) working precision, it is only active for BigFloat input.
+template<typename Real>
+struct RelationLadderCtrl
+{
+    // The working precisions (in bits) to attempt, in increasing order,
+    // before the final attempt at the input precision; if empty, the
+    // working precision is instead successively doubled from 64 bits up
+    // to the input precision
+    vector<unsigned> precisionLadder;
+
+    // A candidate relation, a, detected at a working precision is accepted
+    // if its residual at the input precision satisfies
+    //
+    //   sqrt(N) | z^T a | <= relTol || a ||_2.
+    //
+    Real relTol=Pow(limits::Epsilon<Real>(),Real(0.9));
+
+    bool progress=false;
+
+    LLLCtrl<Real> lllCtrl;
+};
+
+template<typename F>
+Int ZDependenceLadderSearch
+( const Matrix<F>& z,
+        Base<F> NSqrt,
+        Matrix<F>& B,
+        Matrix<F>& U,
+  const RelationLadderCtrl<Base<F>>& ctrl=RelationLadderCtrl<Base<F>>() );
+
+template<typename F>
+Int AlgebraicRelationLadderSearch
+( F alpha,
+  Int n,
+  Base<F> NSqrt,
+  Matrix<F>& B,
+  Matrix<F>& U,
+  const RelationLadderCtrl<Base<F>>& ctrl=RelationLadderCtrl<Base<F>>() );
+
+// Run independent laddered searches over the columns of Z (respectively,
+// over the entries of the vector of constants alpha). Since the candidate
+// lattices are independent, each rung of the ladder processes the
+// still-unresolved candidates in parallel across threads; the working
+// precision itself is only adjusted outside of the parallel regions.
+template<typename F>
+void ZDependenceSweep
+( const Matrix<F>& Z,
+        Base<F> NSqrt,
+        vector<Matrix<F>>& B,
+        vector<Matrix<F>>& U,
+        vector<Int>& numFound,
+  const RelationLadderCtrl<Base<F>>& ctrl=RelationLadderCtrl<Base<F>>() );
+
+template<typename F>
+void AlgebraicRelationSweep
+( const Matrix<F>& alpha,
+  Int n,
+  Base<F> NSqrt,
+  vector<Matrix<F>>& B,
+  vector<Matrix<F>>& U,
+  vector<Int>& numFound,
+  const RelationLadderCtrl<Base<F>>& ctrl=RelationLadderCtrl<Base<F>>() );
+
 } // namespace El
 
 #include <El/number_theory/lattice/Enumerate.hpp>
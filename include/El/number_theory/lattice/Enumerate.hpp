@@ -34,6 +34,10 @@ struct EnumCtrl
     // Explicitly transpose 'N' to encourage unit-stride access
     bool explicitTranspose=true;
 
+    // Partition the top-level branches of the GNR enumeration tree across
+    // the available OpenMP threads (no effect in non-hybrid builds)
+    bool parallel=true;
+
     // GNR_ENUM
     // --------
     // TODO: Add ability to further tune the bounding function
@@ -72,6 +76,7 @@ struct EnumCtrl
         progress = ctrl.progress;
         innerProgress = ctrl.innerProgress;
         explicitTranspose = ctrl.explicitTranspose;
+        parallel = ctrl.parallel;
 
         // GNR_ENUM
         // --------
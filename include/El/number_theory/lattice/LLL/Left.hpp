@@ -208,7 +208,11 @@ bool Step
         }
         else
         {
+            // The size-reduction rounds only modify the k'th column of QR,
+            // so the (integer) coefficients can be accumulated across rounds
+            // and applied to B (and U) in a single deferred batch afterwards
             vector<F> xBuf(k);
+            vector<Z> xAccumBuf(k,Z(0));
             // NOTE: Unless LLL is being aggressively executed in low precision,
             //       this loop should only need to be executed once
             const Int maxSizeReductions = 128;
@@ -236,32 +240,37 @@ bool Step
                     break;
 
                 colUpdated = true;
+                for( Int i=0; i<k; ++i )
+                    xAccumBuf[i] += Z(xBuf[i]);
+            }
 
-                const float nonzeroRatio = float(numNonzero)/float(k); 
-                if( nonzeroRatio >= ctrl.blockingThresh && k >= ctrl.minColThresh )
+            Int numNonzeroAccum = 0;
+            for( Int i=0; i<k; ++i )
+                if( xAccumBuf[i] != Z(0) )
+                    ++numNonzeroAccum;
+            if( numNonzeroAccum > 0 )
+            {
+                const float nonzeroRatio = float(numNonzeroAccum)/float(k);
+                if( nonzeroRatio >= ctrl.blockingThresh &&
+                    k >= ctrl.minColThresh )
                 {
-                    vector<Z> xzBuf(k);
-                    // Need array of type Z
-                    for( Int i=0; i<k; ++i)
-                        xzBuf[i] = Z(xBuf[i]);
-                
                     blas::Gemv
                     ( 'N', m, k,
                       Z(-1), &B(0,0),  B.LDim(),
-                             &xzBuf[0], 1,
+                             &xAccumBuf[0], 1,
                       Z(+1), &B(0,k),  1 );
                     if( formU )
                         blas::Gemv
                         ( 'N', n, k,
                           Z(-1), &U(0,0),  U.LDim(),
-                                 &xzBuf[0], 1,
+                                 &xAccumBuf[0], 1,
                           Z(+1), &U(0,k),  1 );
                 }
                 else
                 {
                     for( Int i=k-1; i>=0; --i )
                     {
-                        const Z chi = Z(xBuf[i]);
+                        const Z chi = xAccumBuf[i];
                         if( chi == Z(0) )
                             continue;
                         blas::Axpy
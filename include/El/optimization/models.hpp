@@ -354,6 +354,17 @@ template<typename Real>
 struct NMFCtrl {
   NNLSCtrl<Real> nnlsCtrl;
   Int maxIter=20;
+
+  // Replace the full nonnegative least-squares solve per side with HALS
+  // block-coordinate sweeps, which cache the k x k Gram matrix of the
+  // opposing factor and refine one rank-one block at a time
+  bool hals=false;
+  // The maximum number of HALS sweeps over the factor blocks per side
+  // (per outer iteration)
+  Int halsMaxSweeps=4;
+  // A block is skipped for the remaining sweeps of the current side once
+  // the relative change of its column falls below this tolerance
+  Real halsTol=Real(1e-4);
 };
 
 template<typename Real>
@@ -428,6 +439,27 @@ void BPDN
         DistMultiVec<Real>& x,
   const BPDNCtrl<Real>& ctrl=BPDNCtrl<Real>() );
 
+// Solve for an entire (typically decreasing) path of regularization
+// parameters, with the j'th column of X holding the solution for
+// lambdas(j). The ADMM splitting is used since its factorization of
+// A^H A + rho I is independent of lambda and may therefore be shared
+// across the whole path (an interior-point method would need to refactor
+// for every solve); each solve is warm-started from its predecessor.
+template<typename Real>
+void BPDNPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl=bpdn::ADMMCtrl<Real>() );
+template<typename Real>
+void BPDNPath
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+  const Matrix<Real>& lambdas,
+        AbstractDistMatrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl=bpdn::ADMMCtrl<Real>() );
+
 // Elastic net (EN):
 //   min || b - A x ||_2^2 + lambda_1 || x ||_1 + lambda_2 || x ||_2^2
 // ===================================================================
@@ -466,6 +498,27 @@ void EN
         DistMultiVec<Real>& x,
   const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
 
+// Solve along a path of l1 penalties with the Tikhonov penalty lambda2
+// held fixed (so that the cached ADMM factorization remains valid for the
+// whole path); the j'th column of X holds the solution for lambda1s(j),
+// and each solve is warm-started from its predecessor.
+template<typename Real>
+void ENPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& lambda1s,
+        Real lambda2,
+        Matrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl=bpdn::ADMMCtrl<Real>() );
+template<typename Real>
+void ENPath
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+  const Matrix<Real>& lambda1s,
+        Real lambda2,
+        AbstractDistMatrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl=bpdn::ADMMCtrl<Real>() );
+
 // Robust Principal Component Analysis (RPCA)
 // ==========================================
 
@@ -474,6 +527,10 @@ struct RPCACtrl
 {
     bool useALM=true;
     bool usePivQR=false;
+    // Whether to replace the full SVD in each singular-value thresholding
+    // step with a partial SVD warm-started from the previous iterate's
+    // dominant subspace (see svt::Incremental)
+    bool useIncremental=false;
     bool progress=true;
 
     Int numPivSteps=75;
@@ -543,6 +600,11 @@ template<typename Real>
 struct SVMCtrl
 {
     qp::affine::Ctrl<Real> ipmCtrl;
+
+    // The relative trace tolerance (and optional rank cap) of the pivoted
+    // Cholesky factorization used by the factored-kernel driver below
+    Real kernelRelTol=Real(1e-8);
+    Int maxKernelRank=0;
 };
 
 // TODO(poulson): Switch to explicitly returning w, beta, and z, as it is
@@ -576,6 +638,33 @@ void SVM
         DistMultiVec<Real>& x,
   const SVMCtrl<Real>& ctrl=SVMCtrl<Real>() );
 
+// Train a kernelized soft-margin SVM from a (numerically low-rank) m x m
+// kernel matrix K: an early-exit pivoted Cholesky factorization K ~= L L^H
+// is computed first, and, since a kernel machine over K is equivalent to a
+// linear machine over the rows of its factor, the QP is then posed over
+// the m x k factor rather than the m x m kernel, so every KKT system the
+// interior-point method factors involves k columns instead of m. On exit,
+// x = [w; beta] with w in the k-dimensional reduced feature space: the
+// decision value of training sample i is L(i,:) w + beta, and L is
+// returned so that out-of-sample points may be mapped into the same
+// feature space (Nystrom-style) for classification.
+template<typename Real>
+void KernelSVM
+( const Matrix<Real>& K,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& L,
+        Matrix<Real>& x,
+  const SVMCtrl<Real>& ctrl=SVMCtrl<Real>() );
+template<typename Real>
+void KernelSVM
+( const AbstractDistMatrix<Real>& K,
+  const AbstractDistMatrix<Real>& d,
+        Real lambda,
+        AbstractDistMatrix<Real>& L,
+        AbstractDistMatrix<Real>& x,
+  const SVMCtrl<Real>& ctrl=SVMCtrl<Real>() );
+
 // 1D total variation denoising (TV):
 //
 //   min (1/2) || b - x ||_2^2 + lambda || D x ||_1,
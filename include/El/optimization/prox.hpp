@@ -158,6 +158,22 @@ Int TSQR
   const Base<Field>& rho,
   bool relative=false );
 
+// Warm-start a partial SVD from the previous iterate's dominant left
+// subspace (carried in and out through Q) and stop resolving singular
+// triplets once they fall below the threshold
+template<typename Field>
+Int Incremental
+( Matrix<Field>& A,
+  const Base<Field>& rho,
+        Matrix<Field>& Q,
+  bool relative=false );
+template<typename Field>
+Int Incremental
+( AbstractDistMatrix<Field>& A,
+  const Base<Field>& rho,
+        DistMatrix<Field>& Q,
+  bool relative=false );
+
 } // namespace svt
 
 // Soft-thresholding
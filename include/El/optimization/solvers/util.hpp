@@ -43,8 +43,12 @@ struct MehrotraCtrl
     // 'affine' cone constraints, i.e., (h - G x) in K, the primal variables are
     // 'x' and 's', while the dual variables are again 'y' and 'z'.
     //
-    // NOTE: User initialization has not yet been tested, so there might be a
-    //       trivial bug.
+    // When both are marked, the provided iterates are treated as a warm
+    // start: the expensive least-squares initialization is skipped and only
+    // the shift-to-interior safeguard is applied. Since the safeguard's
+    // standard shift can move nearly-converged iterates far into the
+    // interior, 'standardInitShift=false' (an entrywise clip) is usually
+    // preferable when warm starting from a neighboring problem's solution.
     bool primalInit=false, dualInit=false;
 
     // Throw an exception if this tolerance could not be achieved.
@@ -115,6 +119,16 @@ struct MehrotraCtrl
     // Time the components of the Interior Point Method?
     bool time=false;
 
+    // Overlap the reductions behind the convergence test with the next
+    // iteration's factorization and solves by launching them as a
+    // nonblocking AllReduce which is only consumed one iteration later
+    // (a delayed termination decision). At large scale this hides the
+    // dominant bulk-synchronous stall of the iteration at the price of at
+    // most one extra step; when MPI lacks nonblocking collectives, the
+    // reduction silently degrades to a blocking one. This is currently
+    // only exploited by the distributed sparse solvers.
+    bool delayedTermination=false;
+
     // A lower bound on the maximum entry in the Nesterov-Todd scaling point
     // before ad-hoc procedures to enforce the cone constraints should be
     // employed.
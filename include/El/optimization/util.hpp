@@ -29,6 +29,54 @@ void Covariance( const Matrix<F>& D, Matrix<F>& S );
 template<typename F>
 void Covariance( const AbstractDistMatrix<F>& D, AbstractDistMatrix<F>& S );
 
+// Incrementally accumulate a covariance matrix from batches of observation
+// rows: the scatter matrix and observation sum are maintained so that
+// incorporating (or, for a sliding window, removing) a batch of k rows
+// costs one rank-k Herk update plus a mean-correction vector accumulation
+// rather than a recompute over the full observation history.
+template<typename F>
+class CovarianceAccumulator
+{
+public:
+    CovarianceAccumulator( Int n );
+
+    // Incorporate or remove the observations in the rows of D
+    void Update( const Matrix<F>& D );
+    void Downdate( const Matrix<F>& D );
+
+    Int NumObservations() const;
+
+    // Form the covariance of the currently accumulated observations
+    // (at least two must have been accumulated)
+    void Covariance( Matrix<F>& S ) const;
+
+private:
+    Int n_;
+    Int numObs_=0;
+    Matrix<F> scatter_; // the lower triangle of the accumulated D^H D
+    Matrix<F> sum_;     // the accumulated column sums of the observations
+};
+
+template<typename F>
+class DistCovarianceAccumulator
+{
+public:
+    DistCovarianceAccumulator( const Grid& g, Int n );
+
+    void Update( const AbstractDistMatrix<F>& D );
+    void Downdate( const AbstractDistMatrix<F>& D );
+
+    Int NumObservations() const;
+
+    void Covariance( AbstractDistMatrix<F>& S ) const;
+
+private:
+    Int n_;
+    Int numObs_=0;
+    DistMatrix<F> scatter_;
+    DistMatrix<F> sum_;
+};
+
 // Log barrier
 // ===========
 template<typename F>
@@ -43,6 +91,61 @@ template<typename F>
 Base<F> LogBarrier
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool canOverwrite=false );
 
+// An evaluation context which factors a Hermitian positive-definite matrix
+// once and derives its log-determinant, log barrier, and log-det
+// divergences (against another context) from the single cached Cholesky
+// factorization; trace terms such as tr(inv(A) M) follow from Solve and a
+// subsequent Trace. This avoids refactoring the same iterate for each of
+// the quantities needed within a single step of, e.g., a trust-region
+// method.
+template<typename F>
+class CholeskyContext
+{
+public:
+    CholeskyContext( UpperOrLower uplo, const Matrix<F>& A );
+
+    UpperOrLower Uplo() const;
+    Int Height() const;
+
+    Base<F> LogDet() const;
+    Base<F> LogBarrier() const;
+    // The divergence of the matrix of this context relative to that of B
+    Base<F> LogDetDiv( const CholeskyContext<F>& B ) const;
+
+    // B := inv(A) B via triangular solves with the cached factor
+    void Solve( Matrix<F>& B ) const;
+
+    const Matrix<F>& Factor() const;
+
+private:
+    UpperOrLower uplo_;
+    Matrix<F> factor_;
+    Base<F> logDet_;
+};
+
+template<typename F>
+class DistCholeskyContext
+{
+public:
+    DistCholeskyContext( UpperOrLower uplo, const AbstractDistMatrix<F>& A );
+
+    UpperOrLower Uplo() const;
+    Int Height() const;
+
+    Base<F> LogDet() const;
+    Base<F> LogBarrier() const;
+    Base<F> LogDetDiv( const DistCholeskyContext<F>& B ) const;
+
+    void Solve( AbstractDistMatrix<F>& B ) const;
+
+    const DistMatrix<F>& Factor() const;
+
+private:
+    UpperOrLower uplo_;
+    DistMatrix<F> factor_;
+    Base<F> logDet_;
+};
+
 // Log-det divergence
 // ==================
 template<typename F>
@@ -8,6 +8,9 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like.hpp>
+#include <fstream>
+#include <map>
+#include <sstream>
 #include <stack>
 
 namespace {
@@ -15,6 +18,10 @@ using namespace El;
 
 std::stack<Int> blocksizeStack;
 
+// Tuned per-routine blocksizes: for each routine tag, the map from minimum
+// problem size to blocksize
+std::map<std::string,std::map<Int,Int>> tunedBlocksizes;
+
 template<typename T>
 struct LocalSymvBlocksizeHelper { static Int value; };
 template<typename T>
@@ -70,6 +77,67 @@ void EmptyBlocksizeStack()
         ::blocksizeStack.pop();
 }
 
+Int TunedBlocksize( const string& routine, Int problemSize )
+{
+    auto tableIt = ::tunedBlocksizes.find( routine );
+    if( tableIt == ::tunedBlocksizes.end() )
+        return Blocksize();
+    const auto& table = tableIt->second;
+    auto it = table.upper_bound( problemSize );
+    if( it == table.begin() )
+        return Blocksize();
+    --it;
+    return it->second;
+}
+
+void SetTunedBlocksize
+( const string& routine, Int minProblemSize, Int blocksize )
+{
+    EL_DEBUG_ONLY(
+      if( minProblemSize < 0 || blocksize < 1 )
+          LogicError("Invalid tuned blocksize entry");
+    )
+    ::tunedBlocksizes[routine][minProblemSize] = blocksize;
+}
+
+bool HaveTunedBlocksize( const string& routine )
+{ return ::tunedBlocksizes.count( routine ) != 0; }
+
+void ClearTunedBlocksizes()
+{ ::tunedBlocksizes.clear(); }
+
+void LoadTuningProfile( const string& filename )
+{
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open tuning profile ",filename);
+    string line;
+    while( std::getline( file, line ) )
+    {
+        std::istringstream is( line );
+        string routine;
+        if( !(is >> routine) || routine[0] == '#' )
+            continue;
+        Int minProblemSize, blocksize;
+        if( !(is >> minProblemSize >> blocksize) )
+            RuntimeError("Malformed tuning profile line: ",line);
+        SetTunedBlocksize( routine, minProblemSize, blocksize );
+    }
+}
+
+void SaveTuningProfile( const string& filename )
+{
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open tuning profile ",filename);
+    file << "# Elemental blocksize tuning profile\n"
+         << "# <routine> <minProblemSize> <blocksize>\n";
+    for( const auto& tableEntry : ::tunedBlocksizes )
+        for( const auto& entry : tableEntry.second )
+            file << tableEntry.first << ' ' << entry.first << ' '
+                 << entry.second << '\n';
+}
+
 template<typename T>
 void SetLocalSymvBlocksize( Int blocksize )
 { LocalSymvBlocksizeHelper<T>::value = blocksize; }
@@ -9,7 +9,59 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 
+#include <atomic>
+#include <map>
+#include <mutex>
+
+namespace {
+
+std::atomic<bool> planCacheEnabled( false );
+std::mutex planCacheMutex;
+std::map<std::string,
+         std::shared_ptr<const El::copy::RedistributionPlan>> planCache;
+
+} // anonymous namespace
+
 namespace El {
+namespace copy {
+
+void EnableRedistributionPlanCache()
+{ planCacheEnabled = true; }
+
+void DisableRedistributionPlanCache()
+{
+    planCacheEnabled = false;
+    FlushRedistributionPlanCache();
+}
+
+bool RedistributionPlanCacheEnabled() EL_NO_EXCEPT
+{ return planCacheEnabled; }
+
+void FlushRedistributionPlanCache()
+{
+    std::lock_guard<std::mutex> lock( planCacheMutex );
+    planCache.clear();
+}
+
+std::shared_ptr<const RedistributionPlan>
+FindRedistributionPlan( const string& signature )
+{
+    std::lock_guard<std::mutex> lock( planCacheMutex );
+    auto it = planCache.find( signature );
+    if( it == planCache.end() )
+        return nullptr;
+    return it->second;
+}
+
+void CacheRedistributionPlan
+( const string& signature,
+  const std::shared_ptr<const RedistributionPlan>& plan )
+{
+    std::lock_guard<std::mutex> lock( planCacheMutex );
+    planCache[signature] = plan;
+}
+
+} // namespace copy
 
 void Copy( const Graph& A, Graph& B )
 {
@@ -71,6 +123,7 @@ void Copy( const DistGraph& A, DistGraph& B )
     B.sources_ = A.sources_;
     B.targets_ = A.targets_;
     B.multMeta = A.multMeta;
+    B.transposeMeta = A.transposeMeta;
     B.locallyConsistent_ = A.locallyConsistent_;
     B.localSourceOffsets_ = A.localSourceOffsets_;
     B.ProcessLocalQueues();
@@ -200,4 +200,131 @@ void GetSubgraph
     LogicError("This routine is not yet written");
 }
 
+// Extract many (possibly overlapping) contiguous subgraphs at once. Rather
+// than scanning the local edges once per subgraph and exchanging each
+// subgraph separately, every local edge is binned across all of the ranges
+// containing it in a single sweep, the edges of all subgraphs are exchanged
+// with one AllToAll, and each sub-CSR is then assembled from purely local
+// queues.
+void GetSubgraphs
+( const DistGraph& graph,
+  const vector<Range<Int>>& I,
+  const vector<Range<Int>>& J,
+        vector<DistGraph>& subgraphs )
+{
+    EL_DEBUG_CSE
+    const Int numSub = I.size();
+    if( Int(J.size()) != numSub )
+        LogicError("Expected the same number of row and column ranges");
+    const Grid& grid = graph.Grid();
+    const int commSize = grid.Size();
+
+    vector<Range<Int>> IRes(I), JRes(J);
+    subgraphs.resize( numSub );
+    for( Int b=0; b<numSub; ++b )
+    {
+        if( IRes[b].end == END )
+            IRes[b].end = graph.NumSources();
+        if( JRes[b].end == END )
+            JRes[b].end = graph.NumTargets();
+        subgraphs[b].Empty();
+        subgraphs[b].SetGrid( grid );
+        subgraphs[b].Resize( IRes[b].end-IRes[b].beg, JRes[b].end-JRes[b].beg );
+    }
+
+    // Form, for each local source, the list of ranges containing it
+    // =============================================================
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int numLocalSources = graph.NumLocalSources();
+    vector<Int> rowRangeSizes(numLocalSources,0);
+    for( Int b=0; b<numSub; ++b )
+    {
+        const Int beg = Max( IRes[b].beg-firstLocalSource, Int(0) );
+        const Int end = Min( IRes[b].end-firstLocalSource, numLocalSources );
+        for( Int iLoc=beg; iLoc<end; ++iLoc )
+            ++rowRangeSizes[iLoc];
+    }
+    vector<Int> rowRangeOffs;
+    const Int totalRowRanges = Scan( rowRangeSizes, rowRangeOffs );
+    vector<Int> rowRanges(totalRowRanges);
+    auto rangeOffs = rowRangeOffs;
+    for( Int b=0; b<numSub; ++b )
+    {
+        const Int beg = Max( IRes[b].beg-firstLocalSource, Int(0) );
+        const Int end = Min( IRes[b].end-firstLocalSource, numLocalSources );
+        for( Int iLoc=beg; iLoc<end; ++iLoc )
+            rowRanges[rangeOffs[iLoc]++] = b;
+    }
+
+    // Compute the metadata with a single sweep over the local edges
+    // =============================================================
+    const Int numEdges = graph.NumLocalEdges();
+    const Int* sourceBuf = graph.LockedSourceBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+    vector<int> sendCounts(commSize,0);
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int iLoc = sourceBuf[e] - firstLocalSource;
+        const Int j = targetBuf[e];
+        for( Int k=rowRangeOffs[iLoc]; k<rowRangeOffs[iLoc+1]; ++k )
+        {
+            const Int b = rowRanges[k];
+            if( j >= JRes[b].beg && j < JRes[b].end )
+                ++sendCounts
+                  [ subgraphs[b].SourceOwner(sourceBuf[e]-IRes[b].beg) ];
+        }
+    }
+
+    // Pack the data
+    // =============
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    auto offs = sendOffs;
+    vector<Int> sendRanges(totalSend), sendSources(totalSend),
+                sendTargets(totalSend);
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int iLoc = sourceBuf[e] - firstLocalSource;
+        const Int j = targetBuf[e];
+        for( Int k=rowRangeOffs[iLoc]; k<rowRangeOffs[iLoc+1]; ++k )
+        {
+            const Int b = rowRanges[k];
+            if( j >= JRes[b].beg && j < JRes[b].end )
+            {
+                const Int iSub = sourceBuf[e] - IRes[b].beg;
+                const int owner = subgraphs[b].SourceOwner( iSub );
+                sendRanges[offs[owner]] = b;
+                sendSources[offs[owner]] = iSub;
+                sendTargets[offs[owner]] = j - JRes[b].beg;
+                ++offs[owner];
+            }
+        }
+    }
+
+    // Exchange and unpack the data
+    // ============================
+    auto recvRanges =
+      mpi::AllToAll( sendRanges, sendCounts, sendOffs, grid.Comm() );
+    auto recvSources =
+      mpi::AllToAll( sendSources, sendCounts, sendOffs, grid.Comm() );
+    auto recvTargets =
+      mpi::AllToAll( sendTargets, sendCounts, sendOffs, grid.Comm() );
+    const Int totalRecv = recvRanges.size();
+    vector<Int> subRecvCounts(numSub,0);
+    for( Int p=0; p<totalRecv; ++p )
+        ++subRecvCounts[recvRanges[p]];
+    for( Int b=0; b<numSub; ++b )
+        subgraphs[b].Reserve( subRecvCounts[b] );
+    for( Int p=0; p<totalRecv; ++p )
+    {
+        const Int b = recvRanges[p];
+        subgraphs[b].QueueLocalConnection
+        ( recvSources[p]-subgraphs[b].FirstLocalSource(), recvTargets[p] );
+    }
+    // Every received edge was routed to its owner, so the assembly of each
+    // subgraph is independent and communication-free
+    for( Int b=0; b<numSub; ++b )
+        subgraphs[b].ProcessLocalQueues();
+}
+
 } // namespace El
@@ -111,13 +111,72 @@ Ring HilbertSchmidt( const DistMultiVec<Ring>& A, const DistMultiVec<Ring>& B )
     return mpi::AllReduce( localInnerProd, A.Grid().Comm() );
 }
 
+// Queue the distributed inner product into a reduction batch rather than
+// performing its AllReduce immediately; 'innerProd' is set when the batch is
+// flushed. The batch must reduce over the matrices' distribution
+// communicator, so distributions with nontrivial cross or redundant
+// communicators are not supported
+template<typename Ring>
+void HilbertSchmidt
+( const AbstractDistMatrix<Ring>& A,
+  const AbstractDistMatrix<Ring>& B,
+        mpi::ReductionBatch<Ring>& batch,
+        Ring& innerProd )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError("Matrices must be the same size");
+    AssertSameGrids( A, B );
+    if( A.DistData().colDist != B.DistData().colDist ||
+        A.DistData().rowDist != B.DistData().rowDist )
+        LogicError("A and B must have the same distribution");
+    if( A.ColAlign() != B.ColAlign() || A.RowAlign() != B.RowAlign() )
+        LogicError("Matrices must be aligned");
+    if ( A.BlockHeight() != B.BlockHeight() ||
+         A.BlockWidth() != B.BlockWidth())
+      LogicError("A and B must have the same block size");
+    if( A.RedundantSize() != 1 || A.CrossSize() != 1 )
+        LogicError
+        ("Batched HilbertSchmidt requires trivial cross and redundant "
+         "communicators");
+
+    Ring localInnerProd(0);
+    if( A.Participating() )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const Ring* ABuf = A.LockedBuffer();
+        const Ring* BBuf = B.LockedBuffer();
+        const Int ALDim = A.LDim();
+        const Int BLDim = B.LDim();
+        if( localHeight == ALDim && localHeight == BLDim )
+        {
+            localInnerProd +=
+              blas::Dot( localHeight*localWidth, ABuf, 1, BBuf, 1 );
+        }
+        else
+        {
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    localInnerProd += Conj(ABuf[iLoc+jLoc*ALDim])*
+                                           BBuf[iLoc+jLoc*BLDim];
+        }
+    }
+    batch.Queue( localInnerProd, innerProd );
+}
+
 #define PROTO(Ring) \
   template Ring HilbertSchmidt \
   ( const Matrix<Ring>& A, const Matrix<Ring>& B ); \
   template Ring HilbertSchmidt \
   ( const AbstractDistMatrix<Ring>& A, const AbstractDistMatrix<Ring>& B ); \
   template Ring HilbertSchmidt \
-  ( const DistMultiVec<Ring>& A, const DistMultiVec<Ring>& B );
+  ( const DistMultiVec<Ring>& A, const DistMultiVec<Ring>& B ); \
+  template void HilbertSchmidt \
+  ( const AbstractDistMatrix<Ring>& A, \
+    const AbstractDistMatrix<Ring>& B, \
+          mpi::ReductionBatch<Ring>& batch, \
+          Ring& innerProd );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
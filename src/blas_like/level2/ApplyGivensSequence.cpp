@@ -8,6 +8,20 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level2.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace {
+
+// The number of consecutive rotations of a variable sequence which are
+// accumulated into a small dense factor that can be applied with a single
+// matrix-matrix multiplication
+const El::Int blockedGivensSize = 16;
+
+// The minimum height of the target matrix for said accumulated application
+// of a variable right sequence to be worthwhile
+const El::Int blockedGivensMinHeight = 128;
+
+} // anonymous namespace
 
 namespace El {
 
@@ -102,6 +116,116 @@ void ApplyVariableRight
     }
 }
 
+// Apply two consecutive rotations of a variable left sequence within a
+// single pass over the columns, working directly on the underlying buffer.
+// The rotation in rows (i,i+1) is applied before the one in rows (i+1,i+2).
+template<typename F,typename S>
+void ApplyVariableLeftPair
+( Int i,
+  const Base<F>& c0,
+  const S& s0,
+  const Base<F>& c1,
+  const S& s1,
+        Matrix<F>& A,
+  const Base<F>& one,
+  const S& zeroS )
+{
+    if( c0 == one && s0 == zeroS && c1 == one && s1 == zeroS )
+        return;
+    const Int n = A.Width();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    const S s0Conj = Conj(s0);
+    const S s1Conj = Conj(s1);
+    for( Int j=0; j<n; ++j )
+    {
+        F* aCol = &ABuf[j*ALDim];
+        F tmp = aCol[i+1];
+        aCol[i+1] = c0*tmp - s0Conj*aCol[i];
+        aCol[i  ] = s0*tmp +     c0*aCol[i];
+        tmp = aCol[i+2];
+        aCol[i+2] = c1*tmp - s1Conj*aCol[i+1];
+        aCol[i+1] = s1*tmp +     c1*aCol[i+1];
+    }
+}
+
+// The analogue for a backward sequence, where the rotation in rows
+// (i+1,i+2) is applied before the one in rows (i,i+1)
+template<typename F,typename S>
+void ApplyVariableLeftPairReverse
+( Int i,
+  const Base<F>& c0,
+  const S& s0,
+  const Base<F>& c1,
+  const S& s1,
+        Matrix<F>& A,
+  const Base<F>& one,
+  const S& zeroS )
+{
+    if( c0 == one && s0 == zeroS && c1 == one && s1 == zeroS )
+        return;
+    const Int n = A.Width();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    const S s0Conj = Conj(s0);
+    const S s1Conj = Conj(s1);
+    for( Int j=0; j<n; ++j )
+    {
+        F* aCol = &ABuf[j*ALDim];
+        F tmp = aCol[i+2];
+        aCol[i+2] = c1*tmp - s1Conj*aCol[i+1];
+        aCol[i+1] = s1*tmp +     c1*aCol[i+1];
+        tmp = aCol[i+1];
+        aCol[i+1] = c0*tmp - s0Conj*aCol[i];
+        aCol[i  ] = s0*tmp +     c0*aCol[i];
+    }
+}
+
+// Accumulate a contiguous group of rotations from a variable right sequence
+// into a small dense factor, W, and apply the group to the (contiguous)
+// strip of columns it touches with a single matrix-matrix multiplication.
+// The rotations only increase the flop count by a small constant factor but
+// are then applied at level-3 rather than level-1 speed.
+template<typename F,typename S>
+void ApplyVariableRightBlocked
+( Int j0,
+  Int numRots,
+  ForwardOrBackward direction,
+  const Matrix<Base<F>>& cList,
+  const Matrix<S>& sList,
+        Matrix<F>& A,
+        Matrix<F>& W,
+        Matrix<F>& C )
+{
+    const Int nW = numRots+1;
+    W.Resize( nW, nW );
+    Zero( W );
+    F* WBuf = W.Buffer();
+    const Int WLDim = W.LDim();
+    for( Int r=0; r<nW; ++r )
+        WBuf[r+r*WLDim] = F(1);
+
+    const Int tBeg = ( direction==FORWARD ? 0 : numRots-1 );
+    const Int tStep = ( direction==FORWARD ? 1 : -1 );
+    for( Int k=0; k<numRots; ++k )
+    {
+        const Int t = tBeg + k*tStep;
+        const Base<F> c = cList(j0+t);
+        const S s = sList(j0+t);
+        const S sConj = Conj(s);
+        for( Int r=0; r<nW; ++r )
+        {
+            const F tmp = WBuf[r+(t+1)*WLDim];
+            WBuf[r+(t+1)*WLDim] = c*tmp - sConj*WBuf[r+t*WLDim];
+            WBuf[r+ t   *WLDim] = s*tmp +     c*WBuf[r+t*WLDim];
+        }
+    }
+
+    auto ABlock = A( ALL, IR(j0,j0+nW) );
+    Gemm( NORMAL, NORMAL, F(1), ABlock, W, C );
+    ABlock = C;
+}
+
 template<typename F,typename=DisableIf<IsReal<F>>>
 void ApplyTopLeft
 ( Int i,
@@ -302,7 +426,14 @@ void ApplyGivensSequence
         {
             if( direction == FORWARD )
             {
-                for( Int i=0; i<m-1; ++i )
+                Int i=0;
+                for( ; i+1<m-1; i+=2 )
+                {
+                    ApplyVariableLeftPair
+                    ( i, cList(i), sList(i), cList(i+1), sList(i+1),
+                      A, one, zeroF );
+                }
+                for( ; i<m-1; ++i )
                 {
                     ApplyVariableLeft
                     ( i, cList(i), sList(i), A, tmp, one, zeroF );
@@ -310,7 +441,14 @@ void ApplyGivensSequence
             }
             else
             {
-                for( Int i=m-2; i>=0; --i )
+                Int i=m-2;
+                for( ; i>=1; i-=2 )
+                {
+                    ApplyVariableLeftPairReverse
+                    ( i-1, cList(i-1), sList(i-1), cList(i), sList(i),
+                      A, one, zeroF );
+                }
+                for( ; i>=0; --i )
                 {
                     ApplyVariableLeft
                     ( i, cList(i), sList(i), A, tmp, one, zeroF );
@@ -362,18 +500,49 @@ void ApplyGivensSequence
         {
             if( direction == FORWARD )
             {
-                for( Int j=0; j<n-1; ++j )
+                if( m >= ::blockedGivensMinHeight && n-1 > 1 )
                 {
-                    ApplyVariableRight
-                    ( j, cList(j), sList(j), A, tmp, one, zeroF );
+                    Matrix<F> W, C;
+                    Int j=0;
+                    while( j < n-1 )
+                    {
+                        const Int numRots = Min( ::blockedGivensSize, n-1-j );
+                        ApplyVariableRightBlocked
+                        ( j, numRots, FORWARD, cList, sList, A, W, C );
+                        j += numRots;
+                    }
+                }
+                else
+                {
+                    for( Int j=0; j<n-1; ++j )
+                    {
+                        ApplyVariableRight
+                        ( j, cList(j), sList(j), A, tmp, one, zeroF );
+                    }
                 }
             }
             else
             {
-                for( Int j=n-2; j>=0; --j )
+                if( m >= ::blockedGivensMinHeight && n-1 > 1 )
                 {
-                    ApplyVariableRight
-                    ( j, cList(j), sList(j), A, tmp, one, zeroF );
+                    Matrix<F> W, C;
+                    Int jEnd=n-1;
+                    while( jEnd > 0 )
+                    {
+                        const Int numRots = Min( ::blockedGivensSize, jEnd );
+                        ApplyVariableRightBlocked
+                        ( jEnd-numRots, numRots, BACKWARD,
+                          cList, sList, A, W, C );
+                        jEnd -= numRots;
+                    }
+                }
+                else
+                {
+                    for( Int j=n-2; j>=0; --j )
+                    {
+                        ApplyVariableRight
+                        ( j, cList(j), sList(j), A, tmp, one, zeroF );
+                    }
                 }
             }
         }
@@ -441,7 +610,14 @@ void ApplyGivensSequence
         {
             if( direction == FORWARD )
             {
-                for( Int i=0; i<m-1; ++i )
+                Int i=0;
+                for( ; i+1<m-1; i+=2 )
+                {
+                    ApplyVariableLeftPair
+                    ( i, cList(i), sList(i), cList(i+1), sList(i+1),
+                      A, one, zero );
+                }
+                for( ; i<m-1; ++i )
                 {
                     ApplyVariableLeft
                     ( i, cList(i), sList(i), A, tmp, one, zero );
@@ -449,7 +625,14 @@ void ApplyGivensSequence
             }
             else
             {
-                for( Int i=m-2; i>=0; --i )
+                Int i=m-2;
+                for( ; i>=1; i-=2 )
+                {
+                    ApplyVariableLeftPairReverse
+                    ( i-1, cList(i-1), sList(i-1), cList(i), sList(i),
+                      A, one, zero );
+                }
+                for( ; i>=0; --i )
                 {
                     ApplyVariableLeft
                     ( i, cList(i), sList(i), A, tmp, one, zero );
@@ -501,18 +684,49 @@ void ApplyGivensSequence
         {
             if( direction == FORWARD )
             {
-                for( Int j=0; j<n-1; ++j )
+                if( m >= ::blockedGivensMinHeight && n-1 > 1 )
                 {
-                    ApplyVariableRight
-                    ( j, cList(j), sList(j), A, tmp, one, zero );
+                    Matrix<F> W, C;
+                    Int j=0;
+                    while( j < n-1 )
+                    {
+                        const Int numRots = Min( ::blockedGivensSize, n-1-j );
+                        ApplyVariableRightBlocked
+                        ( j, numRots, FORWARD, cList, sList, A, W, C );
+                        j += numRots;
+                    }
+                }
+                else
+                {
+                    for( Int j=0; j<n-1; ++j )
+                    {
+                        ApplyVariableRight
+                        ( j, cList(j), sList(j), A, tmp, one, zero );
+                    }
                 }
             }
             else
             {
-                for( Int j=n-2; j>=0; --j )
+                if( m >= ::blockedGivensMinHeight && n-1 > 1 )
                 {
-                    ApplyVariableRight
-                    ( j, cList(j), sList(j), A, tmp, one, zero );
+                    Matrix<F> W, C;
+                    Int jEnd=n-1;
+                    while( jEnd > 0 )
+                    {
+                        const Int numRots = Min( ::blockedGivensSize, jEnd );
+                        ApplyVariableRightBlocked
+                        ( jEnd-numRots, numRots, BACKWARD,
+                          cList, sList, A, W, C );
+                        jEnd -= numRots;
+                    }
+                }
+                else
+                {
+                    for( Int j=n-2; j>=0; --j )
+                    {
+                        ApplyVariableRight
+                        ( j, cList(j), sList(j), A, tmp, one, zero );
+                    }
                 }
             }
         }
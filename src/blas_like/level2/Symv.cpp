@@ -56,6 +56,77 @@ void Symv
     }
 }
 
+namespace symv {
+
+// Scatter the locally-held partial sums of the length-n vector z into the
+// redundantly-stored dense buffer zFull
+template<typename T>
+void AddPartials( const AbstractDistMatrix<T>& z, vector<T>& zFull )
+{
+    EL_DEBUG_CSE
+    const T* zBuf = z.LockedBuffer();
+    if( z.Width() == 1 )
+    {
+        const Int localHeight = z.LocalHeight();
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            zFull[z.GlobalRow(iLoc)] += zBuf[iLoc];
+    }
+    else
+    {
+        const Int ldim = z.LDim();
+        const Int localWidth = z.LocalWidth();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            zFull[z.GlobalCol(jLoc)] += zBuf[jLoc*ldim];
+    }
+}
+
+// Merge the two sets of partial sums into y via a single summed AllReduce.
+// The partial contributions held by each process (which the standard
+// formulation reduces separately over the row and column communicators)
+// are scattered into a dense length-n buffer, one AllReduce over the VC
+// communicator forms the complete result everywhere, and each process then
+// adds its locally-owned entries into y. Entry i of the result contributes
+// to entry i of y regardless of whether y is a column or row vector, so
+// the transposed cases require no extra redistribution.
+template<typename T>
+void FusedAxpyReduce
+( const AbstractDistMatrix<T>& zA,
+  const AbstractDistMatrix<T>& zB,
+        DistMatrix<T>& y )
+{
+    EL_DEBUG_CSE
+    const Grid& g = y.Grid();
+    const Int n = ( y.Width()==1 ? y.Height() : y.Width() );
+    vector<T> zFull( n, T(0) );
+    AddPartials( zA, zFull );
+    AddPartials( zB, zFull );
+    if( g.InGrid() )
+        mpi::AllReduce( zFull.data(), n, mpi::SUM, g.VCComm() );
+    if( y.Width() == 1 )
+    {
+        if( y.LocalWidth() == 1 )
+        {
+            T* yBuf = y.Buffer();
+            const Int localHeight = y.LocalHeight();
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                yBuf[iLoc] += zFull[y.GlobalRow(iLoc)];
+        }
+    }
+    else
+    {
+        if( y.LocalHeight() == 1 )
+        {
+            T* yBuf = y.Buffer();
+            const Int ldim = y.LDim();
+            const Int localWidth = y.LocalWidth();
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                yBuf[jLoc*ldim] += zFull[y.GlobalCol(jLoc)];
+        }
+    }
+}
+
+} // namespace symv
+
 template<typename T>
 void Symv
 ( UpperOrLower uplo,
@@ -121,14 +192,21 @@ void Symv
               ctrl );
         }
 
-        DistMatrix<T,MR,MC> z_MR_MC(g);
-        Contract( z_MR_STAR, z_MR_MC );
-
-        DistMatrix<T> z(g);
-        z.AlignWith( y );
-        z = z_MR_MC;
-        AxpyContract( T(1), z_MC_STAR, z );
-        Axpy( T(1), z, y );
+        if( ctrl.fusedReduction )
+        {
+            symv::FusedAxpyReduce( z_MC_STAR, z_MR_STAR, y );
+        }
+        else
+        {
+            DistMatrix<T,MR,MC> z_MR_MC(g);
+            Contract( z_MR_STAR, z_MR_MC );
+
+            DistMatrix<T> z(g);
+            z.AlignWith( y );
+            z = z_MR_MC;
+            AxpyContract( T(1), z_MC_STAR, z );
+            Axpy( T(1), z, y );
+        }
     }
     else if( x.Width() == 1 )
     {
@@ -161,18 +239,25 @@ void Symv
               ctrl );
         }
 
-        DistMatrix<T> z(g);
-        z.AlignWith( y );
-        Contract( z_MC_STAR, z );
-
-        DistMatrix<T,MR,MC> z_MR_MC(g);
-        z_MR_MC.AlignWith( y );
-        z_MR_MC = z;
-        AxpyContract( T(1), z_MR_STAR, z_MR_MC );
-
-        DistMatrix<T> zTrans(g);
-        Transpose( z_MR_MC, zTrans );
-        Axpy( T(1), zTrans, y );
+        if( ctrl.fusedReduction )
+        {
+            symv::FusedAxpyReduce( z_MC_STAR, z_MR_STAR, y );
+        }
+        else
+        {
+            DistMatrix<T> z(g);
+            z.AlignWith( y );
+            Contract( z_MC_STAR, z );
+
+            DistMatrix<T,MR,MC> z_MR_MC(g);
+            z_MR_MC.AlignWith( y );
+            z_MR_MC = z;
+            AxpyContract( T(1), z_MR_STAR, z_MR_MC );
+
+            DistMatrix<T> zTrans(g);
+            Transpose( z_MR_MC, zTrans );
+            Axpy( T(1), zTrans, y );
+        }
     }
     else if( y.Width() == 1 )
     {
@@ -205,18 +290,25 @@ void Symv
               ctrl );
         }
 
-        DistMatrix<T> z(g);
-        z.AlignWith( y );
-        Contract( z_STAR_MR, z );
-
-        DistMatrix<T,MR,MC> z_MR_MC(g);
-        z_MR_MC.AlignWith( y );
-        z_MR_MC = z;
-        AxpyContract( T(1), z_STAR_MC, z_MR_MC );
-
-        DistMatrix<T> zTrans(g);
-        Transpose( z_MR_MC, zTrans );
-        Axpy( T(1), zTrans, y );
+        if( ctrl.fusedReduction )
+        {
+            symv::FusedAxpyReduce( z_STAR_MC, z_STAR_MR, y );
+        }
+        else
+        {
+            DistMatrix<T> z(g);
+            z.AlignWith( y );
+            Contract( z_STAR_MR, z );
+
+            DistMatrix<T,MR,MC> z_MR_MC(g);
+            z_MR_MC.AlignWith( y );
+            z_MR_MC = z;
+            AxpyContract( T(1), z_STAR_MC, z_MR_MC );
+
+            DistMatrix<T> zTrans(g);
+            Transpose( z_MR_MC, zTrans );
+            Axpy( T(1), zTrans, y );
+        }
     }
     else
     {
@@ -249,15 +341,22 @@ void Symv
               ctrl );
         }
 
-        DistMatrix<T,MR,MC> z_MR_MC(g);
-        z_MR_MC.AlignWith( y );
-        Contract( z_STAR_MC, z_MR_MC );
-
-        DistMatrix<T> z(g);
-        z.AlignWith( y );
-        z = z_MR_MC;
-        AxpyContract( T(1), z_STAR_MR, z );
-        Axpy( T(1), z, y );
+        if( ctrl.fusedReduction )
+        {
+            symv::FusedAxpyReduce( z_STAR_MC, z_STAR_MR, y );
+        }
+        else
+        {
+            DistMatrix<T,MR,MC> z_MR_MC(g);
+            z_MR_MC.AlignWith( y );
+            Contract( z_STAR_MC, z_MR_MC );
+
+            DistMatrix<T> z(g);
+            z.AlignWith( y );
+            z = z_MR_MC;
+            AxpyContract( T(1), z_STAR_MR, z );
+            Axpy( T(1), z, y );
+        }
     }
 }
 
@@ -9,13 +9,32 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level2.hpp>
 
+#include "./Trsv/Util.hpp"
 #include "./Trsv/LN.hpp"
 #include "./Trsv/LT.hpp"
 #include "./Trsv/UN.hpp"
 #include "./Trsv/UT.hpp"
 
+namespace {
+using namespace El;
+
+template<typename F>
+struct TrsvGatherCutoffHelper { static Int value; };
+template<typename F>
+Int TrsvGatherCutoffHelper<F>::value = 1000;
+
+}
+
 namespace El {
 
+template<typename F>
+void SetTrsvGatherCutoff( Int cutoff )
+{ ::TrsvGatherCutoffHelper<F>::value = cutoff; }
+
+template<typename F>
+Int TrsvGatherCutoff()
+{ return ::TrsvGatherCutoffHelper<F>::value; }
+
 template<typename F>
 void Trsv
 ( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
@@ -47,6 +66,22 @@ void Trsv
   const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& x )
 {
     EL_DEBUG_CSE
+    // Below the cutoff dimension the block recurrence is entirely
+    // latency-bound, and simply gathering the triangular matrix and
+    // right-hand side to a single process and solving locally wins by a
+    // wide margin
+    if( A.Height() <= TrsvGatherCutoff<F>() )
+    {
+        DistMatrixReadProxy<F,F,CIRC,CIRC> AProx( A );
+        DistMatrixReadWriteProxy<F,F,CIRC,CIRC> xProx( x );
+        auto& ARoot = AProx.GetLocked();
+        auto& xRoot = xProx.Get();
+        if( ARoot.CrossRank() == ARoot.Root() )
+            Trsv
+            ( uplo, orientation, diag,
+              ARoot.LockedMatrix(), xRoot.Matrix() );
+        return;
+    }
     if( uplo == LOWER )
     {
         if( orientation == NORMAL )
@@ -64,6 +99,8 @@ void Trsv
 }
 
 #define PROTO(F) \
+  template void SetTrsvGatherCutoff<F>( Int cutoff ); \
+  template Int TrsvGatherCutoff<F>(); \
   template void Trsv \
   ( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag, \
     const Matrix<F>& A, Matrix<F>& x ); \
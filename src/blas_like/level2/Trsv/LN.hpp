@@ -67,10 +67,7 @@ void LN
             View( z1_MC_STAR, z_MC_STAR, IR(k,k+nb), ALL );
             View( z2_MC_STAR, z_MC_STAR, IR(k+nb,m), ALL );
 
-            if( k != 0 )
-                AxpyContract( F(1), z1_MC_STAR, x1 );
-
-            x1_STAR_STAR = x1;
+            AccumulateRHS( z1_MC_STAR, x1, x1_STAR_STAR );
             L11_STAR_STAR = L11;
             Trsv
             ( LOWER, NORMAL, diag,
@@ -85,7 +82,6 @@ void LN
     else
     {
         DistMatrix<F,STAR,MR> x1_STAR_MR(g);
-        DistMatrix<F,MR,  MC> z1_MR_MC(g);
         DistMatrix<F,STAR,MC> z_STAR_MC(g);
 
         // Views of z[* ,MC]
@@ -107,13 +103,7 @@ void LN
             View( z1_STAR_MC, z_STAR_MC, ALL, IR(k,k+nb) );
             View( z2_STAR_MC, z_STAR_MC, ALL, IR(k+nb,m) );
 
-            if( k != 0 )
-            {
-                Contract( z1_STAR_MC, z1_MR_MC );
-                x1 += z1_MR_MC;
-            }
-
-            x1_STAR_STAR = x1;
+            AccumulateRHS( z1_STAR_MC, x1, x1_STAR_STAR );
             L11_STAR_STAR = L11;
             Trsv
             ( LOWER, NORMAL, diag,
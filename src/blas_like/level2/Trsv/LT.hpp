@@ -50,7 +50,6 @@ void LT
     if( x.Width() == 1 )
     {
         DistMatrix<F,MC,STAR> x1_MC_STAR(g);
-        DistMatrix<F,MR,MC  > z1_MR_MC(g);
         DistMatrix<F,MR,STAR> z_MR_STAR(g);
 
         // Views of z[MR,* ]
@@ -72,13 +71,7 @@ void LT
             View( z0_MR_STAR, z_MR_STAR, IR(0,k), ALL );
             View( z1_MR_STAR, z_MR_STAR, IR(k,k+nb), ALL );
 
-            if( k+nb != m )
-            {
-                Contract( z1_MR_STAR, z1_MR_MC );
-                x1 += z1_MR_MC;
-            }
-
-            x1_STAR_STAR = x1;
+            AccumulateRHS( z1_MR_STAR, x1, x1_STAR_STAR );
             L11_STAR_STAR = L11;
             Trsv
             ( LOWER, orientation, diag,
@@ -114,10 +107,7 @@ void LT
             View( z0_STAR_MR, z_STAR_MR, ALL, IR(0,k) );
             View( z1_STAR_MR, z_STAR_MR, ALL, IR(k,k+nb) );
 
-            if( k+nb != m )
-                AxpyContract( F(1), z1_STAR_MR, x1 );
-
-            x1_STAR_STAR = x1;
+            AccumulateRHS( z1_STAR_MR, x1, x1_STAR_STAR );
             L11_STAR_STAR = L11;
             Trsv
             ( LOWER, orientation, diag,
@@ -68,10 +68,7 @@ void UN
             View( z0_MC_STAR, z_MC_STAR, IR(0,k), ALL );
             View( z1_MC_STAR, z_MC_STAR, IR(k,k+nb), ALL );
 
-            if( k+nb != m )
-                AxpyContract( F(1), z1_MC_STAR, x1 );
-
-            x1_STAR_STAR = x1;
+            AccumulateRHS( z1_MC_STAR, x1, x1_STAR_STAR );
             U11_STAR_STAR = U11;
             Trsv
             ( UPPER, NORMAL, diag,
@@ -86,7 +83,6 @@ void UN
     else
     {
         DistMatrix<F,STAR,MR> x1_STAR_MR(g);
-        DistMatrix<F,MR,  MC> z1_MR_MC(g);
         DistMatrix<F,STAR,MC> z_STAR_MC(g);
 
         // Views of z[* ,MC]
@@ -108,13 +104,7 @@ void UN
             View( z0_STAR_MC, z_STAR_MC, ALL, IR(0,k) );
             View( z1_STAR_MC, z_STAR_MC, ALL, IR(k,k+nb) );
 
-            if( k+nb != m )
-            {
-                Contract( z1_STAR_MC, z1_MR_MC );
-                x1 += z1_MR_MC;
-            }
-
-            x1_STAR_STAR = x1;
+            AccumulateRHS( z1_STAR_MC, x1, x1_STAR_STAR );
             U11_STAR_STAR = U11;
             Trsv
             ( UPPER, NORMAL, diag,
@@ -49,7 +49,6 @@ void UT
     if( x.Width() == 1 )
     {
         DistMatrix<F,MC,  STAR> x1_MC_STAR(g);
-        DistMatrix<F,MR,  MC  > z1_MR_MC(g);
         DistMatrix<F,MR,  STAR> z_MR_STAR(g);
 
         // Views of z[MR,* ]
@@ -71,13 +70,7 @@ void UT
             View( z1_MR_STAR, z_MR_STAR, IR(k,k+nb), ALL );
             View( z2_MR_STAR, z_MR_STAR, IR(k+nb,m), ALL );
 
-            if( k != 0 )
-            {
-                Contract( z1_MR_STAR, z1_MR_MC );
-                x1 += z1_MR_MC;
-            }
-
-            x1_STAR_STAR = x1;
+            AccumulateRHS( z1_MR_STAR, x1, x1_STAR_STAR );
             U11_STAR_STAR = U11;
             Trsv
             ( UPPER, orientation, diag,
@@ -113,10 +106,7 @@ void UT
             View( z1_STAR_MR, z_STAR_MR, ALL, IR(k,k+nb) );
             View( z2_STAR_MR, z_STAR_MR, ALL, IR(k+nb,m) );
 
-            if( k != 0 )
-                AxpyContract( F(1), z1_STAR_MR, x1 );
-
-            x1_STAR_STAR = x1;
+            AccumulateRHS( z1_STAR_MR, x1, x1_STAR_STAR );
             U11_STAR_STAR = U11;
             Trsv
             ( UPPER, orientation, diag,
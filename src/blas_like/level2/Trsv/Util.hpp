@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace trsv {
+
+// Deliver the current block's right-hand side, x1 plus the accumulated
+// partial sums z1 (which are partitioned over the grid), to every process
+// with a single all-reduce: each block step of the substitution then
+// synchronizes once, rather than contracting z1 into x1 and subsequently
+// gathering x1, and the block solve may proceed redundantly with no
+// further communication.
+template<typename F,Dist U,Dist V>
+void AccumulateRHS
+( const DistMatrix<F,U,V>& z1,
+  const DistMatrix<F>& x1,
+        DistMatrix<F,STAR,STAR>& x1_STAR_STAR )
+{
+    EL_DEBUG_CSE
+    const Grid& g = x1.Grid();
+    const bool isColVec = ( x1.Width() == 1 );
+    const Int nb = ( isColVec ? x1.Height() : x1.Width() );
+    vector<F> rhs( nb, F(0) );
+    const Matrix<F>& z1Loc = z1.LockedMatrix();
+    const Matrix<F>& x1Loc = x1.LockedMatrix();
+    if( isColVec )
+    {
+        const Int z1LocalHeight = z1.LocalHeight();
+        for( Int iLoc=0; iLoc<z1LocalHeight; ++iLoc )
+            rhs[z1.GlobalRow(iLoc)] += z1Loc(iLoc,0);
+        if( x1.LocalWidth() == 1 )
+        {
+            const Int x1LocalHeight = x1.LocalHeight();
+            for( Int iLoc=0; iLoc<x1LocalHeight; ++iLoc )
+                rhs[x1.GlobalRow(iLoc)] += x1Loc(iLoc,0);
+        }
+        mpi::AllReduce( rhs.data(), nb, g.VCComm() );
+        x1_STAR_STAR.Resize( nb, 1 );
+        for( Int i=0; i<nb; ++i )
+            x1_STAR_STAR.Matrix()(i,0) = rhs[i];
+    }
+    else
+    {
+        const Int z1LocalWidth = z1.LocalWidth();
+        for( Int jLoc=0; jLoc<z1LocalWidth; ++jLoc )
+            rhs[z1.GlobalCol(jLoc)] += z1Loc(0,jLoc);
+        if( x1.LocalHeight() == 1 )
+        {
+            const Int x1LocalWidth = x1.LocalWidth();
+            for( Int jLoc=0; jLoc<x1LocalWidth; ++jLoc )
+                rhs[x1.GlobalCol(jLoc)] += x1Loc(0,jLoc);
+        }
+        mpi::AllReduce( rhs.data(), nb, g.VCComm() );
+        x1_STAR_STAR.Resize( 1, nb );
+        for( Int j=0; j<nb; ++j )
+            x1_STAR_STAR.Matrix()(0,j) = rhs[j];
+    }
+}
+
+} // namespace trsv
+} // namespace El
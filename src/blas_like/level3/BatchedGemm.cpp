@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& AList,
+           const vector<Matrix<T>>& BList,
+  T beta,        vector<Matrix<T>>& CList )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( AList.size() != CList.size() || BList.size() != CList.size() )
+          LogicError("Batch lists were of different lengths");
+    )
+    const Int batchCount = CList.size();
+    // The per-entry conformability checks are deferred to the scalar Gemm
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        Gemm( orientA, orientB, alpha, AList[b], BList[b], beta, CList[b] );
+}
+
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim, Int AStride,
+           const T* B, Int BLDim, Int BStride,
+  T beta,        T* C, Int CLDim, Int CStride, Int batchCount )
+{
+    EL_DEBUG_CSE
+    const char transA = OrientationToChar( orientA );
+    const char transB = OrientationToChar( orientB );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, &A[b*AStride], ALDim,
+                 &B[b*BStride], BLDim,
+          beta,  &C[b*CStride], CLDim );
+}
+
+#if defined(EL_HAVE_MKL) && defined(EL_HAVE_MKL_GEMM_BATCH)
+namespace {
+
+// Hand an entire batch to MKL in one call; each entry forms its own group
+// so that the matrices within a batch may have different dimensions
+template<typename F>
+void MKLGemmBatch
+( Orientation orientA, Orientation orientB,
+  F alpha, const vector<Matrix<F>>& AList,
+           const vector<Matrix<F>>& BList,
+  F beta,        vector<Matrix<F>>& CList )
+{
+    const BlasInt batchCount = CList.size();
+    const char transA = OrientationToChar( orientA );
+    const char transB = OrientationToChar( orientB );
+    vector<char> transAList( batchCount, transA ),
+                 transBList( batchCount, transB );
+    vector<BlasInt> mList( batchCount ), nList( batchCount ),
+                    kList( batchCount ),
+                    ALDimList( batchCount ), BLDimList( batchCount ),
+                    CLDimList( batchCount ),
+                    groupSizeList( batchCount, 1 );
+    vector<F> alphaList( batchCount, alpha ), betaList( batchCount, beta );
+    vector<const F*> APtrList( batchCount ), BPtrList( batchCount );
+    vector<F*> CPtrList( batchCount );
+    for( BlasInt b=0; b<batchCount; ++b )
+    {
+        mList[b] = CList[b].Height();
+        nList[b] = CList[b].Width();
+        kList[b] = ( orientA == NORMAL ?
+                     AList[b].Width() : AList[b].Height() );
+        APtrList[b] = AList[b].LockedBuffer();
+        BPtrList[b] = BList[b].LockedBuffer();
+        CPtrList[b] = CList[b].Buffer();
+        ALDimList[b] = AList[b].LDim();
+        BLDimList[b] = BList[b].LDim();
+        CLDimList[b] = CList[b].LDim();
+    }
+    mkl::GemmBatch
+    ( transAList.data(), transBList.data(),
+      mList.data(), nList.data(), kList.data(),
+      alphaList.data(), APtrList.data(), ALDimList.data(),
+                        BPtrList.data(), BLDimList.data(),
+      betaList.data(),  CPtrList.data(), CLDimList.data(),
+      batchCount, groupSizeList.data() );
+}
+
+// The strided variant shares all of its dimension data, so the entire
+// batch forms a single group
+template<typename F>
+void MKLGemmBatch
+( Orientation orientA, Orientation orientB,
+  BlasInt m, BlasInt n, BlasInt k,
+  F alpha, const F* A, BlasInt ALDim, Int AStride,
+           const F* B, BlasInt BLDim, Int BStride,
+  F beta,        F* C, BlasInt CLDim, Int CStride, BlasInt batchCount )
+{
+    const char transA = OrientationToChar( orientA );
+    const char transB = OrientationToChar( orientB );
+    vector<const F*> APtrList( batchCount ), BPtrList( batchCount );
+    vector<F*> CPtrList( batchCount );
+    for( BlasInt b=0; b<batchCount; ++b )
+    {
+        APtrList[b] = &A[b*AStride];
+        BPtrList[b] = &B[b*BStride];
+        CPtrList[b] = &C[b*CStride];
+    }
+    mkl::GemmBatch
+    ( &transA, &transB, &m, &n, &k,
+      &alpha, APtrList.data(), &ALDim,
+              BPtrList.data(), &BLDim,
+      &beta,  CPtrList.data(), &CLDim,
+      1, &batchCount );
+}
+
+} // anonymous namespace
+
+#define MKL_BATCH_PROTO(F) \
+  template<> \
+  void BatchedGemm \
+  ( Orientation orientA, Orientation orientB, \
+    F alpha, const vector<Matrix<F>>& AList, \
+             const vector<Matrix<F>>& BList, \
+    F beta,        vector<Matrix<F>>& CList ) \
+  { \
+      EL_DEBUG_CSE \
+      EL_DEBUG_ONLY( \
+        if( AList.size() != CList.size() || BList.size() != CList.size() ) \
+            LogicError("Batch lists were of different lengths"); \
+      ) \
+      MKLGemmBatch( orientA, orientB, alpha, AList, BList, beta, CList ); \
+  } \
+  template<> \
+  void BatchedGemm \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    F alpha, const F* A, Int ALDim, Int AStride, \
+             const F* B, Int BLDim, Int BStride, \
+    F beta,        F* C, Int CLDim, Int CStride, Int batchCount ) \
+  { \
+      EL_DEBUG_CSE \
+      MKLGemmBatch \
+      ( orientA, orientB, m, n, k, \
+        alpha, A, ALDim, AStride, \
+               B, BLDim, BStride, \
+        beta,  C, CLDim, CStride, batchCount ); \
+  }
+MKL_BATCH_PROTO(float)
+MKL_BATCH_PROTO(double)
+MKL_BATCH_PROTO(Complex<float>)
+MKL_BATCH_PROTO(Complex<double>)
+#endif // defined(EL_HAVE_MKL) && defined(EL_HAVE_MKL_GEMM_BATCH)
+
+#define PROTO(T) \
+  template void BatchedGemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const vector<Matrix<T>>& AList, \
+             const vector<Matrix<T>>& BList, \
+    T beta,        vector<Matrix<T>>& CList ); \
+  template void BatchedGemm \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    T alpha, const T* A, Int ALDim, Int AStride, \
+             const T* B, Int BLDim, Int BStride, \
+    T beta,        T* C, Int CLDim, Int CStride, Int batchCount );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,49 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename T>
+void BlockAxpy( const Matrix<T>& V, const Matrix<T>& C, Matrix<T>& W )
+{
+    EL_DEBUG_CSE
+    if( V.Height() != W.Height() )
+        LogicError("V and W must have the same height");
+    if( V.Width() != C.Height() || C.Width() != W.Width() )
+        LogicError("Nonconformal coefficient matrix");
+    Gemm( NORMAL, NORMAL, T(1), V, C, T(1), W );
+}
+
+template<typename T>
+void BlockAxpy
+( const DistMultiVec<T>& V, const Matrix<T>& C, DistMultiVec<T>& W )
+{
+    EL_DEBUG_CSE
+    if( V.Height() != W.Height() )
+        LogicError("V and W must have the same height");
+    if( V.Width() != C.Height() || C.Width() != W.Width() )
+        LogicError("Nonconformal coefficient matrix");
+    Gemm( NORMAL, NORMAL, T(1), V.LockedMatrix(), C, T(1), W.Matrix() );
+}
+
+#define PROTO(T) \
+  template void BlockAxpy \
+  ( const Matrix<T>& V, const Matrix<T>& C, Matrix<T>& W ); \
+  template void BlockAxpy \
+  ( const DistMultiVec<T>& V, const Matrix<T>& C, DistMultiVec<T>& W );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -9,6 +9,32 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 
+namespace {
+
+El::Int gemm25DDepth = 2;
+
+// Products with every dimension at most this large bypass the vendor
+// interface in favor of a fully-inlined loop nest
+const El::Int smallGemmCutoff = 4;
+
+} // anonymous namespace
+
+namespace El {
+
+void SetGemm25DDepth( Int depth )
+{
+    EL_DEBUG_CSE
+    if( depth < 1 )
+        LogicError("Replication depth must be at least one");
+    gemm25DDepth = depth;
+}
+
+Int Gemm25DDepth()
+{ return gemm25DDepth; }
+
+} // namespace El
+
+#include "./Gemm/CostModel.hpp"
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
@@ -16,11 +42,126 @@
 
 namespace El {
 
+namespace gemm {
+
+// Evaluate C := alpha op(A) op(B) + beta C with a plain loop nest; products
+// small enough for this routine (e.g., those of Transform2x2-heavy code and
+// frontal-tree leaves) are dominated by the cost of reaching the vendor
+// kernel rather than by the arithmetic itself
+template<typename T>
+void SmallKernel
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C )
+{
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const T* ABuf = A.LockedBuffer();
+    const T* BBuf = B.LockedBuffer();
+    T* CBuf = C.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    const Int CLDim = C.LDim();
+    const bool conjA = ( orientA == ADJOINT );
+    const bool conjB = ( orientB == ADJOINT );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            T gamma = 0;
+            for( Int l=0; l<k; ++l )
+            {
+                T aVal = ( orientA == NORMAL ? ABuf[i+l*ALDim]
+                                             : ABuf[l+i*ALDim] );
+                if( conjA )
+                    aVal = Conj( aVal );
+                T bVal = ( orientB == NORMAL ? BBuf[l+j*BLDim]
+                                             : BBuf[j+l*BLDim] );
+                if( conjB )
+                    bVal = Conj( bVal );
+                gamma += aVal*bVal;
+            }
+            CBuf[i+j*CLDim] = alpha*gamma + beta*CBuf[i+j*CLDim];
+        }
+    }
+}
+
+void SetSummaModelLogging( bool logging )
+{
+    EL_DEBUG_CSE
+    SummaModelLoggingFlag() = logging;
+}
+
+void CalibrateSumma( const Grid& grid, Int localDim )
+{
+    EL_DEBUG_CSE
+    if( localDim < 1 )
+        LogicError("Calibration problems must be nonempty");
+    Timer timer;
+
+    // Local Gemm rate (MFlop/s); the timing is insensitive to the values
+    Matrix<double> A, B, C;
+    A.Resize( localDim, localDim );
+    B.Resize( localDim, localDim );
+    C.Resize( localDim, localDim );
+    const double fillValue = 1./double(localDim);
+    for( Int j=0; j<localDim; ++j )
+    {
+        for( Int i=0; i<localDim; ++i )
+        {
+            A(i,j) = fillValue;
+            B(i,j) = fillValue;
+            C(i,j) = 0;
+        }
+    }
+    timer.Start();
+    Gemm( NORMAL, NORMAL, 1., A, B, 1., C );
+    double gemmTime = Max( timer.Stop(), 1.e-9 );
+
+    // Effective message latency: the average time of repeated single-word
+    // reductions over the grid (which folds the collective's tree depth
+    // into the constant, as the SUMMA panel broadcasts pay for it as well)
+    const Int numPings = 100;
+    double one = 1;
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    for( Int ping=0; ping<numPings; ++ping )
+        mpi::AllReduce( &one, 1, grid.Comm() );
+    double latencyTime = Max( timer.Stop()/numPings, 1.e-9 );
+
+    // Per-process bandwidth: the time to reduce a buffer large enough for
+    // the latency to be negligible
+    const Int bufSize = 1<<20;
+    vector<double> buf( bufSize, 1. );
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    mpi::AllReduce( buf.data(), bufSize, grid.Comm() );
+    double bandwidthTime = Max( timer.Stop(), 1.e-9 );
+
+    // Agree on the pessimistic constants across the grid
+    gemmTime = mpi::AllReduce( gemmTime, mpi::MAX, grid.Comm() );
+    latencyTime = mpi::AllReduce( latencyTime, mpi::MAX, grid.Comm() );
+    bandwidthTime = mpi::AllReduce( bandwidthTime, mpi::MAX, grid.Comm() );
+
+    const double localDimD = double(localDim);
+    const double rate = (2.*localDimD*localDimD*localDimD)/(gemmTime*1.e6);
+    const double bandwidth =
+      (double(sizeof(double))*bufSize)/(bandwidthTime*1.e6);
+    const double latency = latencyTime*1.e9;
+    SetTunedBlocksize( "GemmSummaRate", 0, Max(Int(rate),Int(1)) );
+    SetTunedBlocksize( "GemmSummaBandwidth", 0, Max(Int(bandwidth),Int(1)) );
+    SetTunedBlocksize( "GemmSummaLatency", 0, Max(Int(latency),Int(1)) );
+}
+
+} // namespace gemm
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const Matrix<T>& A,
-           const Matrix<T>& B, 
+           const Matrix<T>& B,
   T beta,        Matrix<T>& C )
 {
     EL_DEBUG_CSE
@@ -52,13 +193,19 @@ void Gemm
             A.Height() != B.Width() )
             LogicError("Nonconformal Gemm(T/C)(T/C)");
     }
-    const char transA = OrientationToChar( orientA );
-    const char transB = OrientationToChar( orientB );
     const Int m = C.Height();
     const Int n = C.Width();
     const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
-    if( k != 0 )
+    if( m <= ::smallGemmCutoff &&
+        n <= ::smallGemmCutoff &&
+        k <= ::smallGemmCutoff )
     {
+        gemm::SmallKernel( orientA, orientB, alpha, A, B, beta, C );
+    }
+    else if( k != 0 )
+    {
+        const char transA = OrientationToChar( orientA );
+        const char transB = OrientationToChar( orientB );
         blas::Gemm
         ( transA, transB, m, n, k,
           alpha, A.LockedBuffer(), A.LDim(),
@@ -86,12 +233,108 @@ void Gemm
     Gemm( orientA, orientB, alpha, A, B, T(0), C );
 }
 
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const LazyMatrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = ( orientA == NORMAL ? A.Height() : A.Width() );
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const Int n = ( orientB == NORMAL ? B.Width() : B.Height() );
+    const Int kB = ( orientB == NORMAL ? B.Height() : B.Width() );
+    if( m != C.Height() || n != C.Width() || k != kB )
+        LogicError("Nonconformal lazy Gemm");
+
+    // Consume op(A) in bsize x bsize tiles so that only one tile of the
+    // lazy operand is ever materialized at a time
+    const Int bsize = Blocksize();
+    C *= beta;
+    Matrix<T> ATile;
+    for( Int i=0; i<m; i+=bsize )
+    {
+        const Int nb = Min( bsize, m-i );
+        auto C1 = C( IR(i,i+nb), ALL );
+        for( Int l=0; l<k; l+=bsize )
+        {
+            const Int kb = Min( bsize, k-l );
+            if( orientA == NORMAL )
+                A.MaterializeTile( i, l, nb, kb, ATile );
+            else
+                A.MaterializeTile( l, i, kb, nb, ATile );
+            if( orientB == NORMAL )
+            {
+                auto B1 = B( IR(l,l+kb), ALL );
+                Gemm( orientA, orientB, alpha, ATile, B1, T(1), C1 );
+            }
+            else
+            {
+                auto B1 = B( ALL, IR(l,l+kb) );
+                Gemm( orientA, orientB, alpha, ATile, B1, T(1), C1 );
+            }
+        }
+    }
+}
+
+namespace gemm {
+
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+void ScaLAPACKHelper
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+           const DistMatrix<T,MC,MR,BLOCK>& B,
+  T beta,        DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    AssertScaLAPACKSupport();
+#ifdef EL_HAVE_SCALAPACK
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const char transA = OrientationToChar( orientA );
+    const char transB = OrientationToChar( orientB );
+
+    auto descA = FillDesc( A );
+    auto descB = FillDesc( B );
+    auto descC = FillDesc( C );
+    pblas::Gemm
+    ( transA, transB, m, n, k,
+      alpha, A.LockedBuffer(), descA.data(),
+             B.LockedBuffer(), descB.data(),
+      beta,  C.Buffer(),       descC.data() );
+#endif
+}
+
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+void ScaLAPACKHelper
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+           const DistMatrix<T,MC,MR,BLOCK>& B,
+  T beta,        DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    LogicError("ScaLAPACK does not support this datatype");
+}
+
+} // namespace gemm
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+           const DistMatrix<T,MC,MR,BLOCK>& B,
+  T beta,        DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    EL_DEBUG_CSE
+    gemm::ScaLAPACKHelper( orientA, orientB, alpha, A, B, beta, C );
+}
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const AbstractDistMatrix<T>& A,
            const AbstractDistMatrix<T>& B,
-  T beta,        AbstractDistMatrix<T>& C, 
+  T beta,        AbstractDistMatrix<T>& C,
   GemmAlgorithm alg )
 {
     EL_DEBUG_CSE
@@ -132,6 +375,56 @@ void Gemm
     Gemm( orientA, orientB, alpha, A, B, T(0), C, alg );
 }
 
+template<typename T>
+void MixedPrecisionGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    typedef Demote<T> TLow;
+    if( IsSame<T,TLow>::value )
+    {
+        Gemm( orientA, orientB, alpha, A, B, beta, C );
+        return;
+    }
+    Matrix<TLow> ALow, BLow, CLow;
+    Copy( A, ALow );
+    Copy( B, BLow );
+    Gemm( orientA, orientB, TLow(1), ALow, BLow, CLow );
+    Matrix<T> CProd;
+    Copy( CLow, CProd );
+    C *= beta;
+    Axpy( alpha, CProd, C );
+}
+
+template<typename T>
+void MixedPrecisionGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C,
+  GemmAlgorithm alg )
+{
+    EL_DEBUG_CSE
+    typedef Demote<T> TLow;
+    if( IsSame<T,TLow>::value )
+    {
+        Gemm( orientA, orientB, alpha, A, B, beta, C, alg );
+        return;
+    }
+    const Grid& g = C.Grid();
+    DistMatrix<TLow> ALow(g), BLow(g), CLow(g);
+    Copy( A, ALow );
+    Copy( B, BLow );
+    Gemm( orientA, orientB, TLow(1), ALow, BLow, CLow, alg );
+    DistMatrix<T> CProd(g);
+    Copy( CLow, CProd );
+    C *= beta;
+    Axpy( alpha, CProd, C );
+}
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -270,6 +563,16 @@ void LocalGemm
              const Matrix<T>& B, \
                    Matrix<T>& C ); \
   template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const LazyMatrix<T>& A, \
+             const Matrix<T>& B, \
+    T beta,        Matrix<T>& C ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const DistMatrix<T,MC,MR,BLOCK>& A, \
+             const DistMatrix<T,MC,MR,BLOCK>& B, \
+    T beta,        DistMatrix<T,MC,MR,BLOCK>& C ); \
+  template void Gemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
@@ -279,6 +582,16 @@ void LocalGemm
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
                    AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
+  template void MixedPrecisionGemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const Matrix<T>& A, \
+             const Matrix<T>& B, \
+    T beta,        Matrix<T>& C ); \
+  template void MixedPrecisionGemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const AbstractDistMatrix<T>& A, \
+             const AbstractDistMatrix<T>& B, \
+    T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
   template void LocalGemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_COSTMODEL_HPP
+#define EL_GEMM_COSTMODEL_HPP
+
+namespace El {
+namespace gemm {
+
+// The SUMMA variants perform the same arithmetic and differ only in which
+// operand remains stationary, so, given the machine constants measured by
+// CalibrateSumma (the local Gemm rate, the per-process bandwidth, and the
+// effective message latency, all stored in the tuning registry), the
+// fastest variant for a particular (m, n, k, grid) can be predicted by
+// comparing the per-process communication volumes of the two
+// non-stationary operands. When the constants have not been calibrated,
+// ChooseSummaVariant returns GEMM_DEFAULT and the static dimension-ratio
+// heuristics of the dispatchers remain in effect.
+
+inline bool& SummaModelLoggingFlag()
+{
+    static bool logging = false;
+    return logging;
+}
+
+inline bool HaveSummaModel()
+{
+    return HaveTunedBlocksize("GemmSummaRate") &&
+           HaveTunedBlocksize("GemmSummaBandwidth") &&
+           HaveTunedBlocksize("GemmSummaLatency");
+}
+
+inline const char* SummaVariantName( GemmAlgorithm alg )
+{
+    switch( alg )
+    {
+    case GEMM_SUMMA_A:   return "SUMMA-A";
+    case GEMM_SUMMA_B:   return "SUMMA-B";
+    case GEMM_SUMMA_C:   return "SUMMA-C";
+    case GEMM_SUMMA_DOT: return "SUMMA-Dot";
+    default:             return "default";
+    }
+}
+
+template<typename T>
+GemmAlgorithm ChooseSummaVariant
+( Int m, Int n, Int k, Int blockSizeDot, const Grid& g )
+{
+    EL_DEBUG_CSE
+    if( !HaveSummaModel() )
+        return GEMM_DEFAULT;
+
+    // The registry stores the local Gemm rate in MFlop/s, the per-process
+    // bandwidth in MB/s, and the effective message latency in nanoseconds
+    const double rate = double(TunedBlocksize("GemmSummaRate",0))*1.e6;
+    const double bandwidth =
+      double(TunedBlocksize("GemmSummaBandwidth",0))*1.e6;
+    const double latency = double(TunedBlocksize("GemmSummaLatency",0))*1.e-9;
+
+    const double r = double(g.Height());
+    const double c = double(g.Width());
+    const double p = r*c;
+    const double wordSize = double(sizeof(T));
+    const double nb = double(Blocksize());
+    const double mD = double(m);
+    const double nD = double(n);
+    const double kD = double(k);
+
+    // The arithmetic is identical across the variants; it only matters for
+    // the absolute times reported by the decision log
+    const double computeTime = (2.*mD*nD*kD/p)/rate;
+    auto commTime = [&]( double volume, double messages )
+    { return (wordSize*volume)/bandwidth + latency*messages; };
+
+    // Each variant sweeps one dimension in blocks of (roughly) the
+    // algorithmic blocksize, replicating panels of its two non-stationary
+    // operands within process rows/columns as it goes
+    const double costA =
+      computeTime + commTime( nD*kD/c + nD*mD/r, 2.*Max(nD/nb,1.) );
+    const double costB =
+      computeTime + commTime( mD*kD/r + mD*nD/c, 2.*Max(mD/nb,1.) );
+    const double costC =
+      computeTime + commTime( kD*mD/r + kD*nD/c, 2.*Max(kD/nb,1.) );
+    // The inner-product variant repartitions the operands over the
+    // contraction dimension and sum-reduces every process's contribution
+    // to the (small) product
+    const double costDot =
+      computeTime +
+      commTime
+      ( mD*nD + (mD*kD+kD*nD)/p, 2.*Max(kD/double(blockSizeDot),1.) );
+
+    GemmAlgorithm alg = GEMM_SUMMA_A;
+    double minCost = costA;
+    if( costB < minCost ) { alg = GEMM_SUMMA_B; minCost = costB; }
+    if( costC < minCost ) { alg = GEMM_SUMMA_C; minCost = costC; }
+    if( costDot < minCost ) { alg = GEMM_SUMMA_DOT; minCost = costDot; }
+
+    if( SummaModelLoggingFlag() && g.Rank() == 0 )
+        Output
+        ("SUMMA model (m=",m,", n=",n,", k=",k,", grid=",g.Height(),"x",
+         g.Width(),"): A=",costA," B=",costB," C=",costC," Dot=",costDot,
+         " [sec] -> ",SummaVariantName(alg));
+
+    return alg;
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_COSTMODEL_HPP
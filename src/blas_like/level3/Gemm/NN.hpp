@@ -108,10 +108,14 @@ void SUMMA_NNA
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
-    DistMatrix<T,VR,STAR> B1_VR_STAR(g);
-    DistMatrix<T,STAR,MR> B1Trans_STAR_MR(g);
-    DistMatrix<T,MC,STAR> D1_MC_STAR(g);
+    // Temporary distributions, checked out of the grid's workspace arena
+    // so that repeated products of the same shape reuse their buffers
+    ArenaMatrix<T,VR,STAR> B1Arena( g );
+    ArenaMatrix<T,STAR,MR> B1TransArena( g );
+    ArenaMatrix<T,MC,STAR> D1Arena( g );
+    auto& B1_VR_STAR = B1Arena.Get();
+    auto& B1Trans_STAR_MR = B1TransArena.Get();
+    auto& D1_MC_STAR = D1Arena.Get();
 
     B1_VR_STAR.AlignWith( A );
     B1Trans_STAR_MR.AlignWith( A );
@@ -153,9 +157,12 @@ void SUMMA_NNB
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
-    DistMatrix<T,STAR,MC> A1_STAR_MC(g);
-    DistMatrix<T,MR,STAR> D1Trans_MR_STAR(g);
+    // Temporary distributions, checked out of the grid's workspace arena
+    // so that repeated products of the same shape reuse their buffers
+    ArenaMatrix<T,STAR,MC> A1Arena( g );
+    ArenaMatrix<T,MR,STAR> D1TransArena( g );
+    auto& A1_STAR_MC = A1Arena.Get();
+    auto& D1Trans_MR_STAR = D1TransArena.Get();
 
     A1_STAR_MC.AlignWith( B );
     D1Trans_MR_STAR.AlignWith( B );
@@ -195,9 +202,12 @@ void SUMMA_NNC
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
-    DistMatrix<T,MC,STAR> A1_MC_STAR(g);
-    DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g); 
+    // Temporary distributions, checked out of the grid's workspace arena
+    // so that repeated products of the same shape reuse their buffers
+    ArenaMatrix<T,MC,STAR> A1Arena( g );
+    ArenaMatrix<T,MR,STAR> B1TransArena( g );
+    auto& A1_MC_STAR = A1Arena.Get();
+    auto& B1Trans_MR_STAR = B1TransArena.Get();
 
     A1_MC_STAR.AlignWith( C );
     B1Trans_MR_STAR.AlignWith( C );
@@ -217,6 +227,284 @@ void SUMMA_NNC
     }
 }
 
+// Communication-avoiding (2.5D) Normal Normal Gemm: the owning ranks of the
+// grid are partitioned into 'depth' equally-sized team grids, the slabs of
+// the contraction dimension are replicated onto the teams, each team runs a
+// stationary-C SUMMA over its own slab, and the partial contributions to C
+// are summed across teams before being redistributed back onto the original
+// grid. The extra memory is the classic factor-of-depth replication of A
+// and B.
+template<typename T>
+void SUMMA_NN25D
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre,
+  Int depth )
+{
+    EL_DEBUG_CSE
+    const Grid& g = CPre.Grid();
+    const int p = g.Size();
+    const Int sumDim = APre.Width();
+    if( depth <= 1 || p % depth != 0 || sumDim < depth )
+    {
+        SUMMA_NNC( alpha, APre, BPre, CPre );
+        return;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const int teamSize = p / depth;
+    const int teamHeight = Grid::DefaultHeight( teamSize );
+
+    // Construct the team grids from contiguous blocks of the VC ordering of
+    // g's owning group, sharing g's viewing communicator so that every rank
+    // can participate in the inter-grid redistributions
+    vector<std::unique_ptr<Grid>> teamGrids(depth);
+    mpi::Group owningGroup = g.OwningGroup();
+    for( Int t=0; t<depth; ++t )
+    {
+        vector<int> teamRanks(teamSize);
+        for( int q=0; q<teamSize; ++q )
+            teamRanks[q] = t*teamSize + q;
+        mpi::Group teamGroup;
+        mpi::Incl( owningGroup, teamSize, teamRanks.data(), teamGroup );
+        teamGrids[t].reset
+        ( new Grid( g.ViewingComm(), teamGroup, teamHeight ) );
+    }
+    const int myTeam = ( g.InGrid() ? g.VCRank() / teamSize : -1 );
+
+    // Replicate the contraction slabs onto the teams
+    const Int slabSize = sumDim / depth;
+    vector<std::unique_ptr<DistMatrix<T>>> ATeams(depth), BTeams(depth),
+                                           CTeams(depth);
+    for( Int t=0; t<depth; ++t )
+    {
+        const Int kStart = t*slabSize;
+        const Int kEnd = ( t == depth-1 ? sumDim : kStart+slabSize );
+        auto A1 = A( ALL, IR(kStart,kEnd) );
+        auto B1 = B( IR(kStart,kEnd), ALL );
+        ATeams[t].reset( new DistMatrix<T>(*teamGrids[t]) );
+        BTeams[t].reset( new DistMatrix<T>(*teamGrids[t]) );
+        CTeams[t].reset( new DistMatrix<T>(*teamGrids[t]) );
+        *ATeams[t] = A1;
+        *BTeams[t] = B1;
+        CTeams[t]->Resize( m, n );
+        Zero( *CTeams[t] );
+    }
+
+    if( myTeam != -1 )
+    {
+        // Each team computes its slab's contribution to C
+        SUMMA_NNC
+        ( alpha, *ATeams[myTeam], *BTeams[myTeam], *CTeams[myTeam] );
+
+        // Sum the partial contributions across the teams. Corresponding VC
+        // ranks of the team grids own identically-shaped local data, so the
+        // reduction is a flat AllReduce over the fibration
+        auto& CTeamLoc = CTeams[myTeam]->Matrix();
+        const Int localHeight = CTeamLoc.Height();
+        const Int localWidth = CTeamLoc.Width();
+        mpi::Comm depthComm;
+        mpi::Split
+        ( g.VCComm(), g.VCRank() % teamSize, g.VCRank() / teamSize,
+          depthComm );
+        if( CTeamLoc.LDim() == localHeight )
+        {
+            mpi::AllReduce
+            ( CTeamLoc.Buffer(), localHeight*localWidth, depthComm );
+        }
+        else
+        {
+            vector<T> packed;
+            FastResize( packed, localHeight*localWidth );
+            copy::util::InterleaveMatrix
+            ( localHeight, localWidth,
+              CTeamLoc.LockedBuffer(), 1, CTeamLoc.LDim(),
+              packed.data(), 1, localHeight );
+            mpi::AllReduce( packed.data(), localHeight*localWidth, depthComm );
+            copy::util::InterleaveMatrix
+            ( localHeight, localWidth,
+              packed.data(), 1, localHeight,
+              CTeamLoc.Buffer(), 1, CTeamLoc.LDim() );
+        }
+        mpi::Free( depthComm );
+    }
+
+    // Every team now holds the replicated sum; accumulate team zero's copy
+    // back into C
+    DistMatrix<T> CSum(g);
+    CSum = *CTeams[0];
+    Axpy( T(1), CSum, C );
+}
+
+// Overlapped (pipelined) Normal Normal Gemm that avoids communicating C:
+// the panel allgathers for step k+1 are issued as nonblocking collectives
+// and progress while the local update of step k executes. The panels are
+// gathered manually (rather than through DistMatrix assignment) so that the
+// communication can be split across stages; when the operand alignments do
+// not line up with C we defer to the standard stationary-C algorithm.
+template<typename T,
+         typename=EnableIf<IsPacked<T>>>
+void SUMMA_NNC_Overlap
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    // The manual panel gathers below keep the row distribution of A and the
+    // column distribution of B untouched, so the operands must already be
+    // aligned with C in those dimensions
+    if( A.ColAlign() != C.ColAlign() || B.RowAlign() != C.RowAlign() )
+    {
+        SUMMA_NNC( alpha, A, B, C );
+        return;
+    }
+    if( !C.Participating() )
+        return;
+
+    mpi::Comm rowComm = g.RowComm();
+    mpi::Comm colComm = g.ColComm();
+    const int rowStride = g.Width();
+    const int colStride = g.Height();
+    const int rowRank = g.Col();
+    const int colRank = g.Row();
+
+    const Int localHeightA = A.LocalHeight();
+    const Int localWidthB = B.LocalWidth();
+    const Int numStages = ( sumDim + bsize - 1 ) / bsize;
+
+    // Double-buffered communication state, indexed by stage parity
+    vector<T> sendBufA[2], recvBufA[2], sendBufB[2], recvBufB[2];
+    vector<int> rcsA[2], rdsA[2], rcsB[2], rdsB[2];
+    mpi::Request<T> reqA[2], reqB[2];
+
+    auto postStage =
+      [&]( Int stage )
+      {
+        const Int k = stage*bsize;
+        const Int nb = Min(bsize,sumDim-k);
+        const int parity = stage % 2;
+
+        // Gather A(:,k:k+nb) into [MC,*] form along the process row
+        rcsA[parity].assign( rowStride, 0 );
+        for( Int j=k; j<k+nb; ++j )
+            rcsA[parity][A.RowOwner(j)] += localHeightA;
+        rdsA[parity].resize( rowStride );
+        Scan( rcsA[parity], rdsA[parity] );
+        const Int jLocA = A.LocalColOffset(k);
+        const Int numLocalColsA = A.LocalColOffset(k+nb) - jLocA;
+        FastResize( sendBufA[parity], numLocalColsA*localHeightA );
+        copy::util::InterleaveMatrix
+        ( localHeightA, numLocalColsA,
+          A.LockedBuffer(0,jLocA), 1, A.LDim(),
+          sendBufA[parity].data(), 1, localHeightA );
+        FastResize( recvBufA[parity], nb*localHeightA );
+        mpi::IAllGather
+        ( sendBufA[parity].data(), rcsA[parity][rowRank],
+          recvBufA[parity].data(),
+          rcsA[parity].data(), rdsA[parity].data(), rowComm, reqA[parity] );
+
+        // Gather B(k:k+nb,:)^T into [MR,*] form along the process column
+        rcsB[parity].assign( colStride, 0 );
+        for( Int i=k; i<k+nb; ++i )
+            rcsB[parity][B.RowOwner(i)] += localWidthB;
+        rdsB[parity].resize( colStride );
+        Scan( rcsB[parity], rdsB[parity] );
+        const Int iLocB = B.LocalRowOffset(k);
+        const Int numLocalRowsB = B.LocalRowOffset(k+nb) - iLocB;
+        FastResize( sendBufB[parity], numLocalRowsB*localWidthB );
+        copy::util::InterleaveMatrix
+        ( localWidthB, numLocalRowsB,
+          B.LockedBuffer(iLocB,0), B.LDim(), 1,
+          sendBufB[parity].data(), 1, localWidthB );
+        FastResize( recvBufB[parity], nb*localWidthB );
+        mpi::IAllGather
+        ( sendBufB[parity].data(), rcsB[parity][colRank],
+          recvBufB[parity].data(),
+          rcsB[parity].data(), rdsB[parity].data(), colComm, reqB[parity] );
+      };
+
+    Matrix<T> A1Loc, B1TransLoc;
+    if( numStages > 0 )
+        postStage( 0 );
+    for( Int stage=0; stage<numStages; ++stage )
+    {
+        const Int k = stage*bsize;
+        const Int nb = Min(bsize,sumDim-k);
+        const int parity = stage % 2;
+
+        mpi::Wait( reqA[parity] );
+        mpi::Wait( reqB[parity] );
+
+        // Issue the gathers for the next stage before the local update so
+        // that they can progress during the computation
+        if( stage+1 < numStages )
+            postStage( stage+1 );
+
+        // Unpack the gathered panels, whose columns arrive grouped by owner
+        A1Loc.Resize( localHeightA, nb, Max(localHeightA,1) );
+        {
+            vector<int> offs = rdsA[parity];
+            for( Int t=0; t<nb; ++t )
+            {
+                const int owner = A.RowOwner(k+t);
+                MemCopy
+                ( A1Loc.Buffer(0,t),
+                  &recvBufA[parity][offs[owner]], localHeightA );
+                offs[owner] += localHeightA;
+            }
+        }
+        B1TransLoc.Resize( localWidthB, nb, Max(localWidthB,1) );
+        {
+            vector<int> offs = rdsB[parity];
+            for( Int t=0; t<nb; ++t )
+            {
+                const int owner = B.RowOwner(k+t);
+                MemCopy
+                ( B1TransLoc.Buffer(0,t),
+                  &recvBufB[parity][offs[owner]], localWidthB );
+                offs[owner] += localWidthB;
+            }
+        }
+
+        // C_loc += alpha A1_loc B1Trans_loc^T
+        Gemm
+        ( NORMAL, TRANSPOSE, alpha, A1Loc, B1TransLoc, T(1), C.Matrix() );
+    }
+}
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void SUMMA_NNC_Overlap
+( T alpha,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    SUMMA_NNC( alpha, A, B, C );
+}
+
 // Normal Normal Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -299,6 +587,10 @@ void SUMMA_NN
     // TODO(poulson): Make this tunable
     const Int blockSizeDot = 2000;
 
+    // Consult the calibrated machine model (when one is available)
+    if( alg == GEMM_DEFAULT )
+        alg = ChooseSummaVariant<T>( m, n, sumDim, blockSizeDot, C.Grid() );
+
     switch( alg )
     {
     case GEMM_DEFAULT:
@@ -314,6 +606,10 @@ void SUMMA_NN
     case GEMM_SUMMA_A:   SUMMA_NNA( alpha, A, B, C ); break;
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
+    case GEMM_SUMMA_C_OVERLAP: SUMMA_NNC_Overlap( alpha, A, B, C ); break;
+    case GEMM_SUMMA_25D:
+        SUMMA_NN25D( alpha, A, B, C, Gemm25DDepth() );
+        break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C, blockSizeDot ); break;
     default: LogicError("Unsupported Gemm option");
     }
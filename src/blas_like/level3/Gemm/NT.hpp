@@ -233,6 +233,10 @@ void SUMMA_NT
     // TODO(poulson): Make this tunable
     const Int blockSizeDot = 2000;
 
+    // Consult the calibrated machine model (when one is available)
+    if( alg == GEMM_DEFAULT )
+        alg = ChooseSummaVariant<T>( m, n, sumDim, blockSizeDot, C.Grid() );
+
     switch( alg )
     {
     case GEMM_DEFAULT:
@@ -248,6 +252,8 @@ void SUMMA_NT
     case GEMM_SUMMA_A: SUMMA_NTA( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_NTB( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_NTC( orientB, alpha, A, B, C ); break;
+    case GEMM_SUMMA_C_OVERLAP: SUMMA_NTC( orientB, alpha, A, B, C ); break;
+    case GEMM_SUMMA_25D: SUMMA_NTC( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NTDot( orientB, alpha, A, B, C ); break;
     default: LogicError("Unsupported Gemm option");
     }
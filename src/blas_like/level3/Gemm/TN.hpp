@@ -228,6 +228,10 @@ void SUMMA_TN
     // TODO(poulson): Make this tunable
     const Int blockSizeDot = 2000;
 
+    // Consult the calibrated machine model (when one is available)
+    if( alg == GEMM_DEFAULT )
+        alg = ChooseSummaVariant<T>( m, n, sumDim, blockSizeDot, C.Grid() );
+
     switch( alg )
     {
     case GEMM_DEFAULT:
@@ -243,6 +247,8 @@ void SUMMA_TN
     case GEMM_SUMMA_A: SUMMA_TNA( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_TNB( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_TNC( orientA, alpha, A, B, C ); break;
+    case GEMM_SUMMA_C_OVERLAP: SUMMA_TNC( orientA, alpha, A, B, C ); break;
+    case GEMM_SUMMA_25D: SUMMA_TNC( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_TNDot( orientA, alpha, A, B, C ); break;
     default: LogicError("Unsupported Gemm option");
     }
@@ -245,6 +245,10 @@ void SUMMA_TT
     // TODO(poulson): Make this tunable
     const Int blockSizeDot = 2000;
 
+    // Consult the calibrated machine model (when one is available)
+    if( alg == GEMM_DEFAULT )
+        alg = ChooseSummaVariant<T>( m, n, sumDim, blockSizeDot, C.Grid() );
+
     switch( alg )
     {
     case GEMM_DEFAULT:
@@ -264,6 +268,8 @@ void SUMMA_TT
         SUMMA_TTB( orientA, orientB, alpha, A, B, C );
         break;
     case GEMM_SUMMA_C:
+    case GEMM_SUMMA_C_OVERLAP:
+    case GEMM_SUMMA_25D:
         SUMMA_TTC( orientA, orientB, alpha, A, B, C );
         break;
     case GEMM_SUMMA_DOT:
@@ -0,0 +1,76 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename T>
+void Gram( const Matrix<T>& V, const Matrix<T>& W, Matrix<T>& G )
+{
+    EL_DEBUG_CSE
+    if( V.Height() != W.Height() )
+        LogicError("V and W must have the same height");
+    Zeros( G, V.Width(), W.Width() );
+    Gemm( ADJOINT, NORMAL, T(1), V, W, T(0), G );
+}
+
+template<typename T>
+void Gram( const DistMultiVec<T>& V, const DistMultiVec<T>& W, Matrix<T>& G )
+{
+    EL_DEBUG_CSE
+    if( V.Height() != W.Height() )
+        LogicError("V and W must have the same height");
+    Zeros( G, V.Width(), W.Width() );
+    Gemm
+    ( ADJOINT, NORMAL,
+      T(1), V.LockedMatrix(), W.LockedMatrix(), T(0), G );
+    mpi::AllReduce
+    ( G.Buffer(), G.Height()*G.Width(), mpi::SUM, V.Grid().Comm() );
+}
+
+template<typename T>
+void Gram( const Matrix<T>& V, Matrix<T>& G )
+{
+    EL_DEBUG_CSE
+    Zeros( G, V.Width(), V.Width() );
+    Herk( LOWER, ADJOINT, Base<T>(1), V, Base<T>(0), G );
+    MakeHermitian( LOWER, G );
+}
+
+template<typename T>
+void Gram( const DistMultiVec<T>& V, Matrix<T>& G )
+{
+    EL_DEBUG_CSE
+    Zeros( G, V.Width(), V.Width() );
+    Herk( LOWER, ADJOINT, Base<T>(1), V.LockedMatrix(), Base<T>(0), G );
+    // Reduce the (filled) Hermitian matrix rather than its lower triangle
+    // so that a single contiguous AllReduce suffices
+    MakeHermitian( LOWER, G );
+    mpi::AllReduce
+    ( G.Buffer(), G.Height()*G.Width(), mpi::SUM, V.Grid().Comm() );
+}
+
+#define PROTO(T) \
+  template void Gram \
+  ( const Matrix<T>& V, const Matrix<T>& W, Matrix<T>& G ); \
+  template void Gram \
+  ( const DistMultiVec<T>& V, const DistMultiVec<T>& W, Matrix<T>& G ); \
+  template void Gram \
+  ( const Matrix<T>& V, Matrix<T>& G ); \
+  template void Gram \
+  ( const DistMultiVec<T>& V, Matrix<T>& G );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
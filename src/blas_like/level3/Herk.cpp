@@ -54,6 +54,54 @@ void Herk
     Syrk( uplo, orientation, T(alpha), A, T(0), C, true );
 }
 
+namespace herk {
+
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+void ScaLAPACKHelper
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+  Base<T> beta,        DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    AssertScaLAPACKSupport();
+#ifdef EL_HAVE_SCALAPACK
+    const Int n = C.Height();
+    const Int k = ( orientation == NORMAL ? A.Width() : A.Height() );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    // PBLAS's rank-k updates only accept a conjugate-transposition for
+    // complex data and a transposition for real data
+    const char transChar =
+      ( orientation == NORMAL ? 'N' : ( IsComplex<T>::value ? 'C' : 'T' ) );
+
+    auto descA = FillDesc( A );
+    auto descC = FillDesc( C );
+    pblas::Herk
+    ( uploChar, transChar, n, k,
+      alpha, A.LockedBuffer(), descA.data(),
+      beta,  C.Buffer(),       descC.data() );
+#endif
+}
+
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+void ScaLAPACKHelper
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+  Base<T> beta,        DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    LogicError("ScaLAPACK does not support this datatype");
+}
+
+} // namespace herk
+
+template<typename T>
+void Herk
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+  Base<T> beta,        DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    EL_DEBUG_CSE
+    herk::ScaLAPACKHelper( uplo, orientation, alpha, A, beta, C );
+}
+
 template<typename T>
 void Herk
 ( UpperOrLower uplo, Orientation orientation,
@@ -110,6 +158,10 @@ void Herk
     Base<T> alpha, const AbstractDistMatrix<T>& A, \
     Base<T> beta,        AbstractDistMatrix<T>& C ); \
   template void Herk \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Base<T> alpha, const DistMatrix<T,MC,MR,BLOCK>& A, \
+    Base<T> beta,        DistMatrix<T,MC,MR,BLOCK>& C ); \
+  template void Herk \
   ( UpperOrLower uplo, Orientation orientation, \
     Base<T> alpha, const SparseMatrix<T>& A, \
     Base<T> beta,        SparseMatrix<T>& C ); \
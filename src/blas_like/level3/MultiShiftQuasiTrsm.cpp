@@ -10,6 +10,7 @@
 #include <El/blas_like/level1.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./QuasiTrsm/BlockStructure.hpp"
 #include "./MultiShiftQuasiTrsm/LLN.hpp"
 #include "./MultiShiftQuasiTrsm/LLT.hpp"
 #include "./MultiShiftQuasiTrsm/LUN.hpp"
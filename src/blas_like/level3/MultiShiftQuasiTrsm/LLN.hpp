@@ -23,10 +23,16 @@ void LLNUnb( const Matrix<F>& L, const Matrix<F>& shifts, Matrix<F>& X )
     const Int ldl = L.LDim();
     const Int ldx = X.LDim();
 
+    // Consult the precomputed block structure rather than probing the
+    // couplings at every step
+    const auto runs = quasitrsm::QuasiBlockRuns( LOWER, L );
+    auto run = runs.cbegin();
     Int k=0;
     while( k < m )
     {
-        const bool in2x2 = ( k+1<m && LBuf[k+(k+1)*ldl] != F(0) );
+        if( k >= run->end )
+            ++run;
+        const bool in2x2 = run->twoByTwo;
         if( in2x2 ) 
         {
             // Solve the 2x2 linear systems via 2x2 LQ decompositions produced
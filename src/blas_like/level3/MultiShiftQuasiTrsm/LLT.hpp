@@ -27,10 +27,16 @@ void LLTUnb
     if( conjugate )
         Conjugate( X );
 
+    // Consult the precomputed block structure rather than probing the
+    // couplings at every step
+    const auto runs = quasitrsm::QuasiBlockRuns( LOWER, L );
+    auto run = runs.crbegin();
     Int k=m-1;
     while( k >= 0 )
     {
-        const bool in2x2 = ( k>0 && LBuf[(k-1)+k*ldl] != F(0) );
+        if( k < run->beg )
+            ++run;
+        const bool in2x2 = run->twoByTwo;
         if( in2x2 )
         {
             --k;
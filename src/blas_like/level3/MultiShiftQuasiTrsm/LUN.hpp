@@ -30,10 +30,16 @@ void LUNUnb( const Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X )
     const Int ldu = U.LDim();
     const Int ldX = X.LDim();
     
+    // Consult the precomputed block structure rather than probing the
+    // couplings at every step
+    const auto runs = quasitrsm::QuasiBlockRuns( UPPER, U );
+    auto run = runs.crbegin();
     Int k=m-1;
     while( k >= 0 )
     {
-        const bool in2x2 = ( k>0 && UBuf[k+(k-1)*ldu] != F(0) );
+        if( k < run->beg )
+            ++run;
+        const bool in2x2 = run->twoByTwo;
         if( in2x2 )
         {
             --k;
@@ -118,10 +124,16 @@ void LUNUnb
     const Int ldXReal = XReal.LDim();
     const Int ldXImag = XImag.LDim();
     
+    // Consult the precomputed block structure rather than probing the
+    // couplings at every step
+    const auto runs = quasitrsm::QuasiBlockRuns( UPPER, U );
+    auto run = runs.crbegin();
     Int k=m-1;
     while( k >= 0 )
     {
-        const bool in2x2 = ( k>0 && UBuf[k+(k-1)*ldu] != Real(0) );
+        if( k < run->beg )
+            ++run;
+        const bool in2x2 = run->twoByTwo;
         if( in2x2 )
         {
             --k;
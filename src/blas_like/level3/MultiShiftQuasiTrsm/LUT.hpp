@@ -27,10 +27,16 @@ void LUTUnb
     const Int ldU = U.LDim();
     const Int ldX = X.LDim();
 
+    // Consult the precomputed block structure rather than probing the
+    // couplings at every step
+    const auto runs = quasitrsm::QuasiBlockRuns( UPPER, U );
+    auto run = runs.cbegin();
     Int k=0;
     while( k < m )
     {
-        const bool in2x2 = ( k+1<m && UBuf[(k+1)+k*ldU] != F(0) );
+        if( k >= run->end )
+            ++run;
+        const bool in2x2 = run->twoByTwo;
         if( in2x2 )
         {
             // Solve the 2x2 linear systems via 2x2 QR decompositions produced
@@ -116,10 +122,16 @@ void LUTUnb
     const Int ldXReal = XReal.LDim();
     const Int ldXImag = XImag.LDim();
 
+    // Consult the precomputed block structure rather than probing the
+    // couplings at every step
+    const auto runs = quasitrsm::QuasiBlockRuns( UPPER, U );
+    auto run = runs.cbegin();
     Int k=0;
     while( k < m )
     {
-        const bool in2x2 = ( k+1<m && UBuf[(k+1)+k*ldU] != Real(0) );
+        if( k >= run->end )
+            ++run;
+        const bool in2x2 = run->twoByTwo;
         if( in2x2 )
         {
             // Solve the 2x2 linear systems via 2x2 QR decompositions produced
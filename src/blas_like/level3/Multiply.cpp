@@ -11,9 +11,131 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include <unordered_map>
+#include <unordered_set>
+
 namespace El {
 
 namespace {
+
+// The number of right-hand sides fused into a single traversal of the CSR
+// data in the multi-vector kernels below. Each row's indices and values are
+// thereby read once per block rather than once per vector, which is the
+// dominant memory traffic for blocked Krylov methods.
+const Int spmvFuseWidth = 8;
+
+#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_SPARSE)
+
+// The number of inspector-executor handles retained for recently multiplied
+// CSR blocks and the number of multiplies hinted to MKL's optimizer
+const Int mklSparseCacheCapacity = 16;
+const Int mklSparseExpectedCalls = 100;
+
+// A least-recently-used registry of MKL inspector-executor handles for the
+// CSR blocks passed through MultiplyCSR, so that the Krylov methods which
+// repeatedly multiply with the same operator run the vendor-optimized
+// kernels without any per-call conversion or analysis. A handle references
+// (rather than copies) the CSR arrays of its matrix, so in-place changes to
+// the values (e.g., via ChangeNonzeroValues within an IPM) are picked up
+// automatically, while any change to the sparsity pattern alters the entry
+// count or reallocates the buffers and therefore registers a new handle.
+template<typename T>
+class MKLSparseCache
+{
+public:
+    ~MKLSparseCache()
+    {
+        for( auto& entry : entries_ )
+            mkl::DestroySparseCSR( entry.handle );
+    }
+
+    mkl::SparseCSRHandle Get
+    ( Int m, Int n,
+      const Int* rowOffsets, const Int* colIndices, const T* values )
+    {
+        const Int numEntries = rowOffsets[m];
+        for( auto iter=entries_.begin(); iter!=entries_.end(); ++iter )
+        {
+            if( iter->m == m && iter->n == n &&
+                iter->numEntries == numEntries &&
+                iter->rowOffsets == rowOffsets &&
+                iter->colIndices == colIndices &&
+                iter->values == values )
+            {
+                // Move the hit to the most-recently-used position
+                const Entry entry = *iter;
+                entries_.erase( iter );
+                entries_.push_back( entry );
+                return entry.handle;
+            }
+        }
+        if( Int(entries_.size()) >= mklSparseCacheCapacity )
+        {
+            mkl::DestroySparseCSR( entries_.front().handle );
+            entries_.erase( entries_.begin() );
+        }
+        Entry entry;
+        entry.m = m;
+        entry.n = n;
+        entry.numEntries = numEntries;
+        entry.rowOffsets = rowOffsets;
+        entry.colIndices = colIndices;
+        entry.values = values;
+        entry.handle =
+          mkl::CreateSparseCSR
+          ( m, n, rowOffsets, colIndices, values, mklSparseExpectedCalls );
+        entries_.push_back( entry );
+        return entry.handle;
+    }
+
+private:
+    struct Entry
+    {
+        Int m, n, numEntries;
+        const Int* rowOffsets;
+        const Int* colIndices;
+        const T* values;
+        mkl::SparseCSRHandle handle;
+    };
+    vector<Entry> entries_;
+};
+
+template<typename T,typename=DisableIf<IsBlasScalar<T>>>
+bool MKLSparseApply
+( Orientation orientation,
+  Int m, Int n, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   values,
+  const T*   X, Int ldX,
+  T beta,
+        T*   Y, Int ldY )
+{ return false; }
+
+template<typename T,typename=EnableIf<IsBlasScalar<T>>,typename=void>
+bool MKLSparseApply
+( Orientation orientation,
+  Int m, Int n, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   values,
+  const T*   X, Int ldX,
+  T beta,
+        T*   Y, Int ldY )
+{
+    EL_DEBUG_CSE
+    static MKLSparseCache<T> cache;
+    mkl::SparseCSRHandle handle =
+      cache.Get( m, n, rowOffsets, colIndices, values );
+    mkl::SparseCSRMultiply
+    ( orientation, numRHS, alpha, handle, X, ldX, beta, Y, ldY );
+    return true;
+}
+
+#endif // defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_SPARSE)
+
 /**
  * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
  */
@@ -31,6 +153,7 @@ void MultiplyCSR
     EL_DEBUG_CSE
     if( orientation == NORMAL )
     {
+        EL_PARALLEL_FOR
         for( Int i=0; i<m; ++i )
         {
             T sum = 0;
@@ -43,16 +166,15 @@ void MultiplyCSR
     }
     else
     {
-        for( Int j=0; j<n; ++j ){
+        for( Int j=0; j<n; ++j )
             y[j] *= beta;
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*x[i];
-            }
-	}
+        for( Int i=0; i<m; ++i )
+        {
+            const Int eStart = rowOffsets[i];
+            const Int eStop = rowOffsets[i+1];
+            for( Int e=eStart; e<eStop; ++e )
+                y[colIndices[e]] += alpha*x[i];
+        }
     }
 }
 
@@ -71,6 +193,7 @@ void MultiplyCSR
     EL_DEBUG_CSE
     if( orientation == NORMAL )
     {
+        EL_PARALLEL_FOR
         for( Int i=0; i<m; ++i )
         {
             T sum = 0;
@@ -122,6 +245,14 @@ void MultiplyCSR
         T*   y )
 {
     EL_DEBUG_CSE
+#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_SPARSE)
+    const Int xHeight = ( orientation==NORMAL ? n : m );
+    const Int yHeight = ( orientation==NORMAL ? m : n );
+    if( MKLSparseApply
+        ( orientation, m, n, Int(1), alpha,
+          rowOffsets, colIndices, values, x, xHeight, beta, y, yHeight ) )
+        return;
+#endif
 #if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
     char matDescrA[6];
     matDescrA[0] = 'G';
@@ -132,6 +263,7 @@ void MultiplyCSR
 #else
     if( orientation == NORMAL )
     {
+        EL_PARALLEL_FOR
         for( Int i=0; i<m; ++i )
         {
             T sum = 0;
@@ -191,19 +323,39 @@ void MultiplyCSR
           rowOffsets, colIndices, values, X, beta, Y );
         return;
     }
+#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_SPARSE)
+    if( MKLSparseApply
+        ( orientation, m, n, numRHS, alpha,
+          rowOffsets, colIndices, values, X, ldX, beta, Y, ldY ) )
+        return;
+#endif
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        for( Int kBeg=0; kBeg<numRHS; kBeg+=spmvFuseWidth )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int kSize = Min( numRHS-kBeg, spmvFuseWidth );
+            EL_PARALLEL_FOR
+            for( Int i=0; i<m; ++i )
             {
-                T sum = 0;
+                T sums[spmvFuseWidth];
+                for( Int kOff=0; kOff<kSize; ++kOff )
+                    sums[kOff] = 0;
                 const Int eStart = rowOffsets[i];
                 const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
+                {
+                    const T value = values[e];
+                    const T* XRow = &X[colIndices[e]+kBeg*ldX];
+                    EL_SIMD
+                    for( Int kOff=0; kOff<kSize; ++kOff )
+                        sums[kOff] += value*XRow[kOff*ldX];
+                }
+                for( Int kOff=0; kOff<kSize; ++kOff )
+                {
+                    T& eta = Y[i+(kBeg+kOff)*ldY];
+                    eta = alpha*sums[kOff] + beta*eta;
+                }
             }
         }
     }
@@ -266,35 +418,44 @@ void MultiplyCSR
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        for( Int kBeg=0; kBeg<numRHS; kBeg+=spmvFuseWidth )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int kSize = Min( numRHS-kBeg, spmvFuseWidth );
+            EL_PARALLEL_FOR
+            for( Int i=0; i<m; ++i )
             {
-                T sum = 0;
+                T sums[spmvFuseWidth];
+                for( Int kOff=0; kOff<kSize; ++kOff )
+                    sums[kOff] = 0;
                 const Int eStart = rowOffsets[i];
                 const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    sum += X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
+                {
+                    const T* XRow = &X[colIndices[e]+kBeg*ldX];
+                    EL_SIMD
+                    for( Int kOff=0; kOff<kSize; ++kOff )
+                        sums[kOff] += XRow[kOff*ldX];
+                }
+                for( Int kOff=0; kOff<kSize; ++kOff )
+                {
+                    T& eta = Y[i+(kBeg+kOff)*ldY];
+                    eta = alpha*sums[kOff] + beta*eta;
+                }
             }
         }
     }
     else
     {
         for( Int k=0; k<numRHS; ++k )
-	{
             for( Int j=0; j<n; ++j )
-	    {
                 Y[j+k*ldY] *= beta;
-            	for( Int i=0; i<m; ++i )
-            	{
-            	    const Int eStart = rowOffsets[i];
-            	    const Int eStop = rowOffsets[i+1];
-            	    for( Int e=eStart; e<eStop; ++e )
-            	        for( Int k=0; k<numRHS; ++k )
-            	            Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX];
-            	}
-            }
+        for( Int i=0; i<m; ++i )
+        {
+            const Int eStart = rowOffsets[i];
+            const Int eStop = rowOffsets[i+1];
+            for( Int e=eStart; e<eStop; ++e )
+                for( Int k=0; k<numRHS; ++k )
+                    Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX];
         }
     }
 }
@@ -322,16 +483,30 @@ void MultiplyCSRInterX
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        for( Int kBeg=0; kBeg<numRHS; kBeg+=spmvFuseWidth )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int kSize = Min( numRHS-kBeg, spmvFuseWidth );
+            EL_PARALLEL_FOR
+            for( Int i=0; i<m; ++i )
             {
-                T sum = 0;
+                T sums[spmvFuseWidth];
+                for( Int kOff=0; kOff<kSize; ++kOff )
+                    sums[kOff] = 0;
                 const Int eStart = rowOffsets[i];
                 const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
+                {
+                    const T value = values[e];
+                    const T* XRow = &X[colIndices[e]*numRHS+kBeg];
+                    EL_SIMD
+                    for( Int kOff=0; kOff<kSize; ++kOff )
+                        sums[kOff] += value*XRow[kOff];
+                }
+                for( Int kOff=0; kOff<kSize; ++kOff )
+                {
+                    T& eta = Y[i+(kBeg+kOff)*ldY];
+                    eta = alpha*sums[kOff] + beta*eta;
+                }
             }
         }
     }
@@ -372,6 +547,45 @@ void MultiplyCSRInterX
     }
 }
 
+// Apply the NORMAL-orientation kernel of MultiplyCSRInterX to a subset of
+// the rows, accumulating Y(rows,:) += alpha A(rows,:) X.
+template<typename T>
+void MultiplyCSRInterXRows
+( Int numRows, const Int* rows, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   values,
+  const T*   X,
+        T*   Y, Int ldY )
+{
+    EL_DEBUG_CSE
+    for( Int kBeg=0; kBeg<numRHS; kBeg+=spmvFuseWidth )
+    {
+        const Int kSize = Min( numRHS-kBeg, spmvFuseWidth );
+        EL_PARALLEL_FOR
+        for( Int r=0; r<numRows; ++r )
+        {
+            const Int i = rows[r];
+            T sums[spmvFuseWidth];
+            for( Int kOff=0; kOff<kSize; ++kOff )
+                sums[kOff] = 0;
+            const Int eStart = rowOffsets[i];
+            const Int eStop = rowOffsets[i+1];
+            for( Int e=eStart; e<eStop; ++e )
+            {
+                const T value = values[e];
+                const T* XRow = &X[colIndices[e]*numRHS+kBeg];
+                EL_SIMD
+                for( Int kOff=0; kOff<kSize; ++kOff )
+                    sums[kOff] += value*XRow[kOff];
+            }
+            for( Int kOff=0; kOff<kSize; ++kOff )
+                Y[i+(kBeg+kOff)*ldY] += alpha*sums[kOff];
+        }
+    }
+}
+
 template<typename T>
 void MultiplyCSRInterY
 ( Orientation orientation,
@@ -395,16 +609,30 @@ void MultiplyCSRInterY
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        for( Int kBeg=0; kBeg<numRHS; kBeg+=spmvFuseWidth )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int kSize = Min( numRHS-kBeg, spmvFuseWidth );
+            EL_PARALLEL_FOR
+            for( Int i=0; i<m; ++i )
             {
-                T sum = 0;
+                T sums[spmvFuseWidth];
+                for( Int kOff=0; kOff<kSize; ++kOff )
+                    sums[kOff] = 0;
                 const Int eStart = rowOffsets[i];
                 const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
+                {
+                    const T value = values[e];
+                    const T* XRow = &X[colIndices[e]+kBeg*ldX];
+                    EL_SIMD
+                    for( Int kOff=0; kOff<kSize; ++kOff )
+                        sums[kOff] += value*XRow[kOff*ldX];
+                }
+                for( Int kOff=0; kOff<kSize; ++kOff )
+                {
+                    T& eta = Y[i*numRHS+kBeg+kOff];
+                    eta = alpha*sums[kOff] + beta*eta;
+                }
             }
         }
     }
@@ -468,16 +696,30 @@ void MultiplyCSRInter
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        for( Int kBeg=0; kBeg<numRHS; kBeg+=spmvFuseWidth )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int kSize = Min( numRHS-kBeg, spmvFuseWidth );
+            EL_PARALLEL_FOR
+            for( Int i=0; i<m; ++i )
             {
-                T sum = 0;
+                T sums[spmvFuseWidth];
+                for( Int kOff=0; kOff<kSize; ++kOff )
+                    sums[kOff] = 0;
                 const Int eStart = rowOffsets[i];
                 const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
+                {
+                    const T value = values[e];
+                    const T* XRow = &X[colIndices[e]*numRHS+kBeg];
+                    EL_SIMD
+                    for( Int kOff=0; kOff<kSize; ++kOff )
+                        sums[kOff] += value*XRow[kOff];
+                }
+                for( Int kOff=0; kOff<kSize; ++kOff )
+                {
+                    T& eta = Y[i*numRHS+kBeg+kOff];
+                    eta = alpha*sums[kOff] + beta*eta;
+                }
             }
         }
     }
@@ -559,6 +801,38 @@ void Multiply
       beta,  Y.Buffer(), Y.LDim());
 }
 
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const BandMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( X.Width() != Y.Width() )
+          LogicError("X and Y must have the same width");
+      if( orientation == NORMAL )
+      {
+          if( A.Width() != X.Height() || A.Height() != Y.Height() )
+              LogicError("A, X, and Y did not conform");
+      }
+      else
+      {
+          if( A.Height() != X.Height() || A.Width() != Y.Height() )
+              LogicError("A, X, and Y did not conform");
+      }
+    )
+    const char transChar = OrientationToChar( orientation );
+    const Int numRHS = X.Width();
+    for( Int j=0; j<numRHS; ++j )
+        blas::Gbmv
+        ( transChar, A.Height(), A.Width(),
+          A.LowerBandwidth(), A.UpperBandwidth(),
+          alpha, A.LockedBuffer(), A.LDim(),
+                 X.LockedBuffer(0,j), 1,
+          beta,  Y.Buffer(0,j), 1 );
+}
+
 
 template<typename T>
 void Multiply
@@ -630,22 +904,52 @@ void Multiply
                 sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
         }
 
-        // Now send them
+        // Satisfy our own requirements with a direct copy and begin a
+        // nonblocking exchange of the halo values with the (typically few)
+        // processes which we neighbor in the communication graph.
         vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), grid.Comm() );
+        if( sendSizes[commRank] != 0 )
+            MemCopy
+            ( recvVals.data()+recvOffs[commRank],
+              sendVals.data()+sendOffs[commRank],
+              sendSizes[commRank] );
+        vector<mpi::Request<T>> requests( 2*commSize );
+        int numRequests = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == commRank )
+                continue;
+            if( recvSizes[q] != 0 )
+                mpi::IRecv
+                ( recvVals.data()+recvOffs[q], recvSizes[q], q,
+                  grid.Comm(), requests[numRequests++] );
+            if( sendSizes[q] != 0 )
+                mpi::ISend
+                ( sendVals.data()+sendOffs[q], sendSizes[q], q,
+                  grid.Comm(), requests[numRequests++] );
+        }
 
-        // Perform the local multiply-accumulate, y := alpha A x + y
+        // Overlap the halo exchange with the multiplication of the rows
+        // which only touch locally-owned data, y := alpha A x + y
         if( time && commRank == 0 )
             timer.Start();
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
+        MultiplyCSRInterXRows
+        ( Int(meta.interiorRows.size()), meta.interiorRows.data(), b,
           alpha, A.LockedOffsetBuffer(),
                  meta.colOffs.data(),
                  A.LockedValueBuffer(),
                  recvVals.data(),
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
+          Y.Matrix().Buffer(), Y.Matrix().LDim() );
+
+        // Finish the exchange and fold in the rows which touch the halo
+        mpi::WaitAll( numRequests, requests.data() );
+        MultiplyCSRInterXRows
+        ( Int(meta.haloRows.size()), meta.haloRows.data(), b,
+          alpha, A.LockedOffsetBuffer(),
+                 meta.colOffs.data(),
+                 A.LockedValueBuffer(),
+                 recvVals.data(),
+          Y.Matrix().Buffer(), Y.Matrix().LDim() );
         if( time && commRank == 0 )
             Output("  MultiplyCSRInterX time: ",timer.Stop());
     }
@@ -694,6 +998,211 @@ void Multiply
         Output("Multiply total time: ",totalTimer.Stop());
 }
 
+template<typename T>
+void Multiply
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C,
+        DistSparseMultPlan& plan )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError("The inner dimensions of the product did not match");
+    if( A.Grid().Comm() != B.Grid().Comm() )
+        LogicError("A and B must have the same communicator");
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int localHeight = A.LocalHeight();
+
+    if( !plan.ready )
+    {
+        // Symbolic phase
+        // ==============
+
+        // The sorted union of the local columns of A; since the row
+        // distribution of B is contiguous, sorting the row indices also
+        // groups them by owning process
+        plan.neededRows.resize( numLocalEntries );
+        for( Int e=0; e<numLocalEntries; ++e )
+            plan.neededRows[e] = A.Col(e);
+        std::sort( plan.neededRows.begin(), plan.neededRows.end() );
+        plan.neededRows.erase
+        ( std::unique( plan.neededRows.begin(), plan.neededRows.end() ),
+          plan.neededRows.end() );
+        const Int numNeededRows = plan.neededRows.size();
+        plan.entryHaloRows.resize( numLocalEntries );
+        for( Int e=0; e<numLocalEntries; ++e )
+            plan.entryHaloRows[e] =
+              Int(std::lower_bound
+                  ( plan.neededRows.begin(), plan.neededRows.end(),
+                    A.Col(e) ) - plan.neededRows.begin());
+
+        // Exchange the row requests
+        plan.reqSendSizes.assign( commSize, 0 );
+        for( Int r=0; r<numNeededRows; ++r )
+            ++plan.reqSendSizes[ B.RowOwner(plan.neededRows[r]) ];
+        plan.reqRecvSizes.resize( commSize );
+        mpi::AllToAll
+        ( plan.reqSendSizes.data(), 1, plan.reqRecvSizes.data(), 1, comm );
+        Scan( plan.reqSendSizes, plan.reqSendOffs );
+        const Int numServedRows = Scan( plan.reqRecvSizes, plan.reqRecvOffs );
+        plan.servedRows.resize( numServedRows );
+        mpi::AllToAll
+        ( plan.neededRows.data(),
+          plan.reqSendSizes.data(), plan.reqSendOffs.data(),
+          plan.servedRows.data(),
+          plan.reqRecvSizes.data(), plan.reqRecvOffs.data(), comm );
+
+        // Exchange the entry counts of the served rows to form the
+        // entry-wise exchange plan and the CSR offsets of the halo
+        vector<Int> servedCounts( numServedRows ), neededCounts( numNeededRows );
+        plan.servSizes.assign( commSize, 0 );
+        for( int q=0; q<commSize; ++q )
+        {
+            const int tEnd = plan.reqRecvOffs[q] + plan.reqRecvSizes[q];
+            for( int t=plan.reqRecvOffs[q]; t<tEnd; ++t )
+            {
+                const Int numConn =
+                  B.NumConnections( B.LocalRow(plan.servedRows[t]) );
+                servedCounts[t] = numConn;
+                plan.servSizes[q] += int(numConn);
+            }
+        }
+        mpi::AllToAll
+        ( servedCounts.data(),
+          plan.reqRecvSizes.data(), plan.reqRecvOffs.data(),
+          neededCounts.data(),
+          plan.reqSendSizes.data(), plan.reqSendOffs.data(), comm );
+        const Int numServEntries = Scan( plan.servSizes, plan.servOffs );
+        plan.haloSizes.assign( commSize, 0 );
+        for( Int r=0; r<numNeededRows; ++r )
+            plan.haloSizes[ B.RowOwner(plan.neededRows[r]) ] +=
+              int(neededCounts[r]);
+        plan.numHaloEntries = Scan( plan.haloSizes, plan.haloOffs );
+        plan.haloRowOffs.resize( numNeededRows+1 );
+        plan.haloRowOffs[0] = 0;
+        for( Int r=0; r<numNeededRows; ++r )
+            plan.haloRowOffs[r+1] = plan.haloRowOffs[r] + neededCounts[r];
+
+        // Exchange the patterns of the served rows; both the packing and
+        // the arrivals follow the (sorted) request orders, so the received
+        // entries line up with the halo CSR offsets
+        vector<Int> servTargets( numServEntries );
+        Int packOff = 0;
+        for( Int t=0; t<numServedRows; ++t )
+        {
+            const Int localRow = B.LocalRow( plan.servedRows[t] );
+            const Int rowOff = B.RowOffset( localRow );
+            for( Int f=0; f<servedCounts[t]; ++f )
+                servTargets[packOff++] = B.Col( rowOff+f );
+        }
+        plan.haloTargets.resize( plan.numHaloEntries );
+        mpi::AllToAll
+        ( servTargets.data(), plan.servSizes.data(), plan.servOffs.data(),
+          plan.haloTargets.data(),
+          plan.haloSizes.data(), plan.haloOffs.data(), comm );
+
+        // Merge the fetched rows into the pattern of the product
+        const Int firstLocalRow = A.FirstLocalRow();
+        plan.sources.clear();
+        plan.targets.clear();
+        std::unordered_set<Int> merged;
+        vector<Int> rowCols;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            merged.clear();
+            rowCols.clear();
+            const Int aOff = A.RowOffset( iLoc );
+            const Int aConn = A.NumConnections( iLoc );
+            for( Int e=0; e<aConn; ++e )
+            {
+                const Int h = plan.entryHaloRows[aOff+e];
+                for( Int f=plan.haloRowOffs[h]; f<plan.haloRowOffs[h+1]; ++f )
+                    if( merged.insert( plan.haloTargets[f] ).second )
+                        rowCols.push_back( plan.haloTargets[f] );
+            }
+            std::sort( rowCols.begin(), rowCols.end() );
+            for( const Int& col : rowCols )
+            {
+                plan.sources.push_back( firstLocalRow+iLoc );
+                plan.targets.push_back( col );
+            }
+        }
+        plan.ready = true;
+    }
+
+    // Numeric phase
+    // =============
+
+    // Exchange the current values of the served rows
+    Int numServEntries = 0;
+    for( int q=0; q<commSize; ++q )
+        numServEntries += plan.servSizes[q];
+    vector<T> servVals( numServEntries ), haloVals( plan.numHaloEntries );
+    Int packOff = 0;
+    for( Int t=0; t<Int(plan.servedRows.size()); ++t )
+    {
+        const Int localRow = B.LocalRow( plan.servedRows[t] );
+        const Int rowOff = B.RowOffset( localRow );
+        const Int numConn = B.NumConnections( localRow );
+        for( Int f=0; f<numConn; ++f )
+            servVals[packOff++] = B.Value( rowOff+f );
+    }
+    mpi::AllToAll
+    ( servVals.data(), plan.servSizes.data(), plan.servOffs.data(),
+      haloVals.data(), plan.haloSizes.data(), plan.haloOffs.data(), comm );
+
+    // Construct the product's pattern directly from the plan
+    C.SetGrid( A.Grid() );
+    C.Resize( A.Height(), B.Width() );
+    const Int numProdEntries = plan.sources.size();
+    C.ForceNumLocalEntries( numProdEntries );
+    Int* sourceBuf = C.SourceBuffer();
+    Int* targetBuf = C.TargetBuffer();
+    T* valBuf = C.ValueBuffer();
+    for( Int s=0; s<numProdEntries; ++s )
+    {
+        sourceBuf[s] = plan.sources[s];
+        targetBuf[s] = plan.targets[s];
+        valBuf[s] = T(0);
+    }
+    C.DistGraph().ComputeSourceOffsets();
+    C.ForceConsistency( true );
+
+    // Accumulate each local row of the product through a hash map from the
+    // columns of its (known) pattern to their slots
+    std::unordered_map<Int,Int> colToSlot;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        colToSlot.clear();
+        const Int cOff = C.RowOffset( iLoc );
+        const Int cConn = C.NumConnections( iLoc );
+        for( Int s=0; s<cConn; ++s )
+            colToSlot[ targetBuf[cOff+s] ] = cOff+s;
+        const Int aOff = A.RowOffset( iLoc );
+        const Int aConn = A.NumConnections( iLoc );
+        for( Int e=0; e<aConn; ++e )
+        {
+            const T alpha = A.Value( aOff+e );
+            const Int h = plan.entryHaloRows[aOff+e];
+            for( Int f=plan.haloRowOffs[h]; f<plan.haloRowOffs[h+1]; ++f )
+                valBuf[ colToSlot[plan.haloTargets[f]] ] += alpha*haloVals[f];
+        }
+    }
+}
+
+template<typename T>
+void Multiply
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    DistSparseMultPlan plan;
+    Multiply( A, B, C, plan );
+}
+
 #define PROTO(T) \
     template void Multiply \
     ( Orientation orientation, \
@@ -710,12 +1219,28 @@ void Multiply
             T beta, \
             Matrix<T>& Y ); \
     template void Multiply \
+    ( Orientation orientation, \
+            T alpha, \
+      const BandMatrix<T>& A, \
+      const Matrix<T>& X, \
+            T beta, \
+            Matrix<T>& Y ); \
+    template void Multiply \
     ( Orientation orientation, \
             T alpha, \
       const DistSparseMatrix<T>& A, \
       const DistMultiVec<T>& X, \
             T beta, \
-            DistMultiVec<T>& Y );
+            DistMultiVec<T>& Y ); \
+    template void Multiply \
+    ( const DistSparseMatrix<T>& A, \
+      const DistSparseMatrix<T>& B, \
+            DistSparseMatrix<T>& C ); \
+    template void Multiply \
+    ( const DistSparseMatrix<T>& A, \
+      const DistSparseMatrix<T>& B, \
+            DistSparseMatrix<T>& C, \
+            DistSparseMultPlan& plan );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -10,6 +10,7 @@
 #include <El/blas_like/level2.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./QuasiTrsm/BlockStructure.hpp"
 #include "./QuasiTrsm/LLN.hpp"
 #include "./QuasiTrsm/LLT.hpp"
 #include "./QuasiTrsm/LUN.hpp"
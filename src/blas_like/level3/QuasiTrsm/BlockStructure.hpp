@@ -0,0 +1,63 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QUASITRSM_BLOCKSTRUCTURE_HPP
+#define EL_QUASITRSM_BLOCKSTRUCTURE_HPP
+
+namespace El {
+namespace quasitrsm {
+
+// A quasi-triangular matrix is a direct sum of 1x1 and 2x2 diagonal blocks,
+// and the solve kernels historically probed the couplings at every
+// elimination step of every solve. Scanning the structure once instead
+// yields maximal runs of 1x1 blocks separated by 2x2 blocks: the runs are
+// genuinely triangular (and so can be handed to the vectorized BLAS
+// kernels), while the 2x2 blocks retain their Givens-based treatment.
+struct QuasiBlockRun
+{
+    Int beg, end;  // the half-open index range of the run
+    bool twoByTwo; // whether the run is a single 2x2 block
+};
+
+template<typename F>
+vector<QuasiBlockRun> QuasiBlockRuns( UpperOrLower uplo, const Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const F* ABuf = A.LockedBuffer();
+    const Int lda = A.LDim();
+
+    vector<QuasiBlockRun> runs;
+    Int k=0;
+    while( k < m )
+    {
+        const bool in2x2 =
+          ( k+1<m &&
+            ( uplo == LOWER ? ABuf[k+(k+1)*lda]
+                            : ABuf[(k+1)+k*lda] ) != F(0) );
+        if( in2x2 )
+        {
+            runs.push_back( QuasiBlockRun{k,k+2,true} );
+            k += 2;
+        }
+        else
+        {
+            if( !runs.empty() && !runs.back().twoByTwo )
+                runs.back().end = k+1;
+            else
+                runs.push_back( QuasiBlockRun{k,k+1,false} );
+            k += 1;
+        }
+    }
+    return runs;
+}
+
+} // namespace quasitrsm
+} // namespace El
+
+#endif // ifndef EL_QUASITRSM_BLOCKSTRUCTURE_HPP
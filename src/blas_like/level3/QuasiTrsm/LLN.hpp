@@ -27,11 +27,12 @@ void LLNUnb( const Matrix<F>& L, Matrix<F>& X, bool checkIfSingular )
     const Int ldl = L.LDim();
     const Int ldx = X.LDim();
 
-    Int k=0;
-    while( k < m )
+    // Scan the block structure once rather than probing it at every step
+    const auto runs = QuasiBlockRuns( LOWER, L );
+    for( const auto& run : runs )
     {
-        const bool in2x2 = ( k+1<m && LBuf[k+(k+1)*ldl] != F(0) );
-        if( in2x2 ) 
+        const Int k = run.beg;
+        if( run.twoByTwo )
         {
             // Solve the 2x2 linear systems via a 2x2 LQ decomposition produced
             // by the Givens rotation
@@ -76,28 +77,31 @@ void LLNUnb( const Matrix<F>& L, Matrix<F>& X, bool checkIfSingular )
                 ( m-(k+2), -xBuf[k  ], 
                   &LBuf[(k+2)+ k   *ldl], 1, &xBuf[k+2], 1 );
                 blas::Axpy
-                ( m-(k+2), -xBuf[k+1], 
+                ( m-(k+2), -xBuf[k+1],
                   &LBuf[(k+2)+(k+1)*ldl], 1, &xBuf[k+2], 1 );
             }
-
-            k += 2;
         }
         else
         {
+            const Int nb = run.end - k;
             if( checkIfSingular )
             {
                 // TODO: Check if sufficiently small instead
-                if( LBuf[k+k*ldl] == F(0) )
-                    LogicError("Singular diagonal entry detected");
-            }
-            for( Int j=0; j<n; ++j )
-            {
-                F* xBuf = &XBuf[j*ldx];
-                xBuf[k] /= LBuf[k+k*ldl];
-                blas::Axpy
-                ( m-(k+1), -xBuf[k], &LBuf[(k+1)+k*ldl], 1, &xBuf[k+1], 1 );
+                for( Int i=k; i<run.end; ++i )
+                    if( LBuf[i+i*ldl] == F(0) )
+                        LogicError("Singular diagonal entry detected");
             }
-            k += 1;
+            // The run is genuinely triangular, so both the solve and the
+            // trailing update vectorize through the BLAS
+            blas::Trsm
+            ( 'L', 'L', 'N', 'N', nb, n,
+              F(1), &LBuf[k+k*ldl], ldl, &XBuf[k], ldx );
+            if( run.end < m )
+                blas::Gemm
+                ( 'N', 'N', m-run.end, n, nb,
+                  F(-1), &LBuf[run.end+k*ldl], ldl,
+                         &XBuf[k],             ldx,
+                  F(1),  &XBuf[run.end],       ldx );
         }
     }
 }
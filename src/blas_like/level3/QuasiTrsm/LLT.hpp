@@ -33,13 +33,14 @@ void LLTUnb
     if( conjugate )
         Conjugate( X );
 
-    Int k=m-1;
-    while( k >= 0 )
+    // Scan the block structure once rather than probing it at every step
+    const auto runs = QuasiBlockRuns( LOWER, L );
+    for( auto it=runs.rbegin(); it!=runs.rend(); ++it )
     {
-        const bool in2x2 = ( k>0 && LBuf[(k-1)+k*ldl] != F(0) );
-        if( in2x2 )
+        const auto& run = *it;
+        const Int k = run.beg;
+        if( run.twoByTwo )
         {
-            --k;
             // Solve the 2x2 linear systems via a 2x2 LQ decomposition produced
             // by the Givens rotation
             //    | L(k,k) L(k,k+1) | | c -conj(s) | = | gamma11 0 |
@@ -84,20 +85,23 @@ void LLTUnb
         }
         else
         {
+            const Int nb = run.end - k;
             if( checkIfSingular )
-                if( LBuf[k+k*ldl] == F(0) )
-                    LogicError("Singular diagonal entry detected");
-            for( Int j=0; j<n; ++j )
-            {
-                F* xBuf = &XBuf[j*ldx];
-                // Solve the 1x1 linear system
-                xBuf[k] /= LBuf[k+k*ldl];
-
-                // Update x0 := x0 - l10^T chi_1
-                blas::Axpy( k, -xBuf[k], &LBuf[k], ldl, xBuf, 1 );
-            }
+                for( Int i=k; i<run.end; ++i )
+                    if( LBuf[i+i*ldl] == F(0) )
+                        LogicError("Singular diagonal entry detected");
+            // The run is genuinely triangular, so both the solve and the
+            // leading update vectorize through the BLAS
+            blas::Trsm
+            ( 'L', 'L', 'T', 'N', nb, n,
+              F(1), &LBuf[k+k*ldl], ldl, &XBuf[k], ldx );
+            if( k > 0 )
+                blas::Gemm
+                ( 'T', 'N', k, n, nb,
+                  F(-1), &LBuf[k],  ldl,
+                         &XBuf[k],  ldx,
+                  F(1),  XBuf,      ldx );
         }
-        --k;
     }
     if( conjugate )
         Conjugate( X );
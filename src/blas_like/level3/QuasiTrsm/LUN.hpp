@@ -27,13 +27,14 @@ void LUNUnb( const Matrix<F>& U, Matrix<F>& X, bool checkIfSingular )
     const Int ldu = U.LDim();
     const Int ldx = X.LDim();
     
-    Int k=m-1;
-    while( k >= 0 )
+    // Scan the block structure once rather than probing it at every step
+    const auto runs = QuasiBlockRuns( UPPER, U );
+    for( auto it=runs.rbegin(); it!=runs.rend(); ++it )
     {
-        const bool in2x2 = ( k>0 && UBuf[k+(k-1)*ldu] != F(0) );
-        if( in2x2 )
+        const auto& run = *it;
+        const Int k = run.beg;
+        if( run.twoByTwo )
         {
-            --k;
             // Solve the 2x2 linear systems via a 2x2 QR decomposition produced
             // by the Givens rotation
             //    | c        s | | U(k,  k) | = | gamma11 | 
@@ -79,20 +80,23 @@ void LUNUnb( const Matrix<F>& U, Matrix<F>& X, bool checkIfSingular )
         }
         else
         {
+            const Int nb = run.end - k;
             if( checkIfSingular )
-                if( UBuf[k+k*ldu] == F(0) )
-                    LogicError("Singular diagonal entry detected");
-            for( Int j=0; j<n; ++j )
-            {
-                F* xBuf = &XBuf[j*ldx];
-                // Solve the 1x1 linear system
-                xBuf[k] /= UBuf[k+k*ldu];
-
-                // Update x0 := x0 - u01 chi_1
-                blas::Axpy( k, -xBuf[k], &UBuf[k*ldu], 1, xBuf, 1 );
-            }
+                for( Int i=k; i<run.end; ++i )
+                    if( UBuf[i+i*ldu] == F(0) )
+                        LogicError("Singular diagonal entry detected");
+            // The run is genuinely triangular, so both the solve and the
+            // leading update vectorize through the BLAS
+            blas::Trsm
+            ( 'L', 'U', 'N', 'N', nb, n,
+              F(1), &UBuf[k+k*ldu], ldu, &XBuf[k], ldx );
+            if( k > 0 )
+                blas::Gemm
+                ( 'N', 'N', k, n, nb,
+                  F(-1), &UBuf[k*ldu], ldu,
+                         &XBuf[k],     ldx,
+                  F(1),  XBuf,         ldx );
         }
-        --k;
     }
 }
 
@@ -35,11 +35,12 @@ void LUTUnb
     const Int ldu = U.LDim();
     const Int ldx = X.LDim();
 
-    Int k=0;
-    while( k < m )
+    // Scan the block structure once rather than probing it at every step
+    const auto runs = QuasiBlockRuns( UPPER, U );
+    for( const auto& run : runs )
     {
-        const bool in2x2 = ( k+1<m && UBuf[(k+1)+k*ldu] != F(0) );
-        if( in2x2 )
+        const Int k = run.beg;
+        if( run.twoByTwo )
         {
             // Solve the 2x2 linear systems via a 2x2 QR decomposition produced
             // by the Givens rotation
@@ -88,24 +89,28 @@ void LUTUnb
                 ( m-(k+2), -xBuf[k+1],
                   &UBuf[(k+1)+(k+2)*ldu], ldu, &xBuf[k+2], 1 );
             }
-            k += 2;
         }
         else
         {
+            const Int nb = run.end - k;
             if( checkIfSingular )
             {
                 // TODO: Check if sufficiently small instead
-                if( UBuf[k+k*ldu] == F(0) )
-                    LogicError("Singular diagonal entry detected");
+                for( Int i=k; i<run.end; ++i )
+                    if( UBuf[i+i*ldu] == F(0) )
+                        LogicError("Singular diagonal entry detected");
             }
-            for( Int j=0; j<n; ++j )
-            {
-                F* xBuf = &XBuf[j*ldx];
-                xBuf[k] /= UBuf[k+k*ldu];
-                blas::Axpy
-                ( m-(k+1), -xBuf[k], &UBuf[k+(k+1)*ldu], ldu, &xBuf[k+1], 1 );
-            }
-            k += 1;
+            // The run is genuinely triangular, so both the solve and the
+            // trailing update vectorize through the BLAS
+            blas::Trsm
+            ( 'L', 'U', 'T', 'N', nb, n,
+              F(1), &UBuf[k+k*ldu], ldu, &XBuf[k], ldx );
+            if( run.end < m )
+                blas::Gemm
+                ( 'T', 'N', m-run.end, n, nb,
+                  F(-1), &UBuf[k+run.end*ldu], ldu,
+                         &XBuf[k],             ldx,
+                  F(1),  &XBuf[run.end],       ldx );
         }
     }
     if( conjugate )
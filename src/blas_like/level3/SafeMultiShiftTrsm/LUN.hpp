@@ -12,9 +12,11 @@
 
 namespace El {
 
-// Forward declaration
+// Forward declarations
 template<typename T>
 Base<T> MaxNorm( const Matrix<T>& A );
+template<typename T>
+Base<T> MaxNorm( const AbstractDistMatrix<T>& A );
 
 namespace safemstrsm {
 
@@ -206,29 +208,19 @@ void LUNBlock
     SetDiagonal( U, diag );
 }
 
-/*   Note: See "Robust Triangular Solves for Use in Condition
- *   Estimation" by Edward Anderson for notation and bounds.
- *   Entries in U are assumed to be less (in magnitude) than 
- *   bigNum.
- */
+// Apply the fully guarded block substitution to every RHS/shift pair;
+// 'scales' should enter holding any scalings already applied and 'XMax'
+// the infinity norm of each (possibly prescaled) RHS
 template<typename F>
-void LUN
+void LUNGuarded
 (       Matrix<F>& U,
   const Matrix<F>& shifts,
         Matrix<F>& X,
-        Matrix<F>& scales ) 
+        Matrix<F>& scales,
+        Matrix<Base<F>>& XMax )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-
-    EL_DEBUG_ONLY(
-      if( U.Height() != U.Width() )
-          LogicError("Triangular matrix must be square");
-      if( U.Width() != X.Height() )
-          LogicError("Matrix dimensions do not match");
-      if( shifts.Height() != X.Width() )
-          LogicError("Incompatible number of shifts");
-    )
     const Int m = X.Height();
     const Int n = X.Width();
     const Int bsize = Blocksize();
@@ -237,36 +229,10 @@ void LUN
     const Real oneHalf = Real(1)/Real(2);
 
     auto overflowPair = OverflowParameters<Real>();
-    const Real smallNum = overflowPair.first;
     const Real bigNum = overflowPair.second;
 
-    EL_DEBUG_ONLY(
-      if( MaxNorm(U) >= bigNum )
-          LogicError("Entries in matrix are too large");
-    )
-    
-    scales.Resize( n, 1 );
-    Fill( scales, F(1) );
-
     Matrix<F> scalesUpdate( n, 1 );
 
-    // Determine largest entry of each RHS
-    Matrix<Real> XMax( n, 1 );
-    for( Int j=0; j<n; ++j )
-    {
-        auto xj = X( ALL, IR(j) );
-        Real xjMax = MaxNorm( xj );
-        if( xjMax >= bigNum )
-        {
-            const Real s = oneHalf*bigNum/xjMax;
-            xj *= s;
-            xjMax *= s;
-            scales(j) *= s;
-        }
-        xjMax = Max( xjMax, 2*smallNum );
-        XMax(j) = xjMax;
-    }
-        
     // Perform block triangular solve
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -347,9 +313,148 @@ void LUN
     }
 }
 
+/*   Note: See "Robust Triangular Solves for Use in Condition
+ *   Estimation" by Edward Anderson for notation and bounds.
+ *   Entries in U are assumed to be less (in magnitude) than
+ *   bigNum.
+ */
+template<typename F>
+void LUN
+(       Matrix<F>& U,
+  const Matrix<F>& shifts,
+        Matrix<F>& X,
+        Matrix<F>& scales )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+
+    EL_DEBUG_ONLY(
+      if( U.Height() != U.Width() )
+          LogicError("Triangular matrix must be square");
+      if( U.Width() != X.Height() )
+          LogicError("Matrix dimensions do not match");
+      if( shifts.Height() != X.Width() )
+          LogicError("Incompatible number of shifts");
+    )
+    const Int m = X.Height();
+    const Int n = X.Width();
+
+    const Real oneHalf = Real(1)/Real(2);
+
+    auto overflowPair = OverflowParameters<Real>();
+    const Real smallNum = overflowPair.first;
+    const Real bigNum = overflowPair.second;
+
+    EL_DEBUG_ONLY(
+      if( MaxNorm(U) >= bigNum )
+          LogicError("Entries in matrix are too large");
+    )
+
+    scales.Resize( n, 1 );
+    Fill( scales, F(1) );
+
+    // Determine largest entry of each RHS
+    Matrix<Real> XMax( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        auto xj = X( ALL, IR(j) );
+        Real xjMax = MaxNorm( xj );
+        if( xjMax >= bigNum )
+        {
+            const Real s = oneHalf*bigNum/xjMax;
+            xj *= s;
+            xjMax *= s;
+            scales(j) *= s;
+        }
+        xjMax = Max( xjMax, 2*smallNum );
+        XMax(j) = xjMax;
+    }
+
+    // Screen each RHS/shift pair once by evaluating Anderson's growth
+    // recurrence on the full factor: a pair whose bound shows that no
+    // intermediate quantity can approach the overflow threshold is solved
+    // with the unguarded multi-shift kernel, and the scaled substitution
+    // (and its per-block bookkeeping) is reserved for the remainder
+    Matrix<Real> cNorm( m, 1 );
+    cNorm(0) = 0;
+    for( Int i=1; i<m; ++i )
+    {
+        cNorm(i) = 0;
+        for( Int l=0; l<i; ++l )
+            cNorm(i) = Max( cNorm(i), Abs(U(l,i)) );
+    }
+    vector<Int> safeCols, riskyCols;
+    safeCols.reserve( n );
+    for( Int j=0; j<n; ++j )
+    {
+        const F shift = shifts.Get(j,0);
+        Real invGi = 1/XMax(j);
+        Real invMi = invGi;
+        for( Int i=m-1; i>=0; --i )
+        {
+            const Real absUii = SafeAbs( U(i,i)-shift );
+            if( invGi<=smallNum || invMi<=smallNum || absUii<=smallNum )
+            {
+                invGi = 0;
+                break;
+            }
+            invMi = Min( invMi, absUii*invGi );
+            if( i > 0 )
+                invGi *= absUii/(absUii+cNorm(i));
+        }
+        invGi = Min( invGi, invMi );
+        if( invGi > smallNum )
+            safeCols.push_back( j );
+        else
+            riskyCols.push_back( j );
+    }
+
+    if( riskyCols.empty() )
+    {
+        MultiShiftTrsm( LEFT, UPPER, NORMAL, F(1), U, shifts, X );
+        return;
+    }
+    if( safeCols.empty() )
+    {
+        LUNGuarded( U, shifts, X, scales, XMax );
+        return;
+    }
+
+    // Solve the certified-safe pairs with the unguarded kernel
+    const Int numSafe = safeCols.size();
+    Matrix<F> XSafe( m, numSafe ), shiftsSafe( numSafe, 1 );
+    for( Int t=0; t<numSafe; ++t )
+    {
+        MemCopy( XSafe.Buffer(0,t), X.LockedBuffer(0,safeCols[t]), m );
+        shiftsSafe(t) = shifts.Get(safeCols[t],0);
+    }
+    MultiShiftTrsm( LEFT, UPPER, NORMAL, F(1), U, shiftsSafe, XSafe );
+    for( Int t=0; t<numSafe; ++t )
+        MemCopy( X.Buffer(0,safeCols[t]), XSafe.LockedBuffer(0,t), m );
+
+    // Run the guarded solve on the remaining pairs
+    const Int numRisky = riskyCols.size();
+    Matrix<F> XRisky( m, numRisky ), shiftsRisky( numRisky, 1 ),
+              scalesRisky( numRisky, 1 );
+    Matrix<Real> XMaxRisky( numRisky, 1 );
+    for( Int t=0; t<numRisky; ++t )
+    {
+        MemCopy( XRisky.Buffer(0,t), X.LockedBuffer(0,riskyCols[t]), m );
+        shiftsRisky(t) = shifts.Get(riskyCols[t],0);
+        scalesRisky(t) = scales(riskyCols[t]);
+        XMaxRisky(t) = XMax(riskyCols[t]);
+    }
+    LUNGuarded( U, shiftsRisky, XRisky, scalesRisky, XMaxRisky );
+    for( Int t=0; t<numRisky; ++t )
+    {
+        MemCopy( X.Buffer(0,riskyCols[t]), XRisky.LockedBuffer(0,t), m );
+        scales(riskyCols[t]) = scalesRisky(t);
+    }
+}
+
 template<typename F>
 void LUN
-( const AbstractDistMatrix<F>& UPre, 
+( const AbstractDistMatrix<F>& UPre,
   const AbstractDistMatrix<F>& shiftsPre,
         AbstractDistMatrix<F>& XPre,
         AbstractDistMatrix<F>& scalesPre ) 
@@ -391,6 +496,59 @@ void LUN
     scales.Resize( n, 1 );
     Fill( scales, F(1) );
 
+    // Screen the whole solve once with Anderson's growth recurrence: when
+    // every locally owned RHS/shift pair is certified safe on every process,
+    // no scaling can occur and the unguarded multi-shift kernel applies.
+    // The screening is conservative (the column norms include the diagonal
+    // and the largest entry of X bounds every RHS), so any pair it cannot
+    // certify simply falls through to the guarded block substitution.
+    {
+        auto overflowPair = OverflowParameters<Real>();
+        const Real smallNum = overflowPair.first;
+        const Real bigNum = overflowPair.second;
+
+        DistMatrix<Real,MR,STAR> cNormPre(g);
+        ColumnMaxNorms( U, cNormPre );
+        DistMatrix<Real,STAR,STAR> cNorm(g);
+        cNorm = cNormPre;
+
+        DistMatrix<F,STAR,STAR> d(g);
+        GetDiagonal( U, d );
+
+        const Real XInfNorm = MaxNorm( X );
+        const Real xMax = Max( XInfNorm, 2*smallNum );
+
+        Int localSafe = ( XInfNorm < bigNum ? 1 : 0 );
+        const Int numLocalShifts = shifts.LocalHeight();
+        for( Int jLoc=0; jLoc<numLocalShifts && localSafe; ++jLoc )
+        {
+            const F shift = shifts.GetLocal(jLoc,0);
+            Real invGi = 1/xMax;
+            Real invMi = invGi;
+            for( Int i=m-1; i>=0; --i )
+            {
+                const Real absUii = SafeAbs( d.GetLocal(i,0)-shift );
+                if( invGi<=smallNum || invMi<=smallNum || absUii<=smallNum )
+                {
+                    invGi = 0;
+                    break;
+                }
+                invMi = Min( invMi, absUii*invGi );
+                if( i > 0 )
+                    invGi *= absUii/(absUii+cNorm.GetLocal(i,0));
+            }
+            invGi = Min( invGi, invMi );
+            if( invGi <= smallNum )
+                localSafe = 0;
+        }
+        const Int allSafe = mpi::AllReduce( localSafe, mpi::MIN, g.VCComm() );
+        if( allSafe )
+        {
+            MultiShiftTrsm( LEFT, UPPER, NORMAL, F(1), U, shifts, X );
+            return;
+        }
+    }
+
     scalesUpdate_VR_STAR.Resize( n, 1 );
 
     const Int XLocalWidth = X.LocalWidth();
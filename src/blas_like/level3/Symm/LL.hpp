@@ -213,6 +213,87 @@ void LLC
     }
 }
 
+// A symmetric-storage-aware variant which packs each panel of the stored
+// (lower) triangle exactly once: the received panel of A produces both its
+// direct contribution to the trailing rows of C and, after zeroing its
+// diagonal, its (conjugate-)transposed contribution via a local Gemm
+// against the trailing rows of B followed by a reduce-scatter. Relative to
+// LLC this halves the communication volume attributable to A, at the cost
+// of contracting an nb x n partial result per panel, and is therefore
+// preferred when B is narrow relative to A.
+template<typename T>
+void LLS
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre,
+  bool conjugate=false )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, BPre, CPre ))
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& C = CProx.Get();
+
+    // Force B to align with C so that its trailing rows can be contracted
+    // against the received panel without a separate redistribution
+    ElementalProxyCtrl BCtrl;
+    BCtrl.colConstrain = true;
+    BCtrl.rowConstrain = true;
+    BCtrl.colAlign = C.ColAlign();
+    BCtrl.rowAlign = C.RowAlign();
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, BCtrl );
+    auto& B = BProx.GetLocked();
+
+    // Temporary distributions
+    DistMatrix<T,MC,  STAR> AB1_MC_STAR(g);
+    DistMatrix<T,MR,  STAR> B1Trans_MR_STAR(g);
+    DistMatrix<T,STAR,MR  > Z1_STAR_MR(g);
+
+    B1Trans_MR_STAR.AlignWith( C );
+    Z1_STAR_MR.AlignWith( C );
+
+    for( Int k=0; k<m; k+=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+
+        const Range<Int> ind1( k, k+nb ),
+                         indB( k, m    );
+
+        auto AB1 = A( indB, ind1 );
+
+        auto B1 = B( ind1, ALL );
+        auto BB = B( indB, ALL );
+
+        auto C1 = C( ind1, ALL );
+        auto CB = C( indB, ALL );
+
+        // Pack the panel of the stored triangle once
+        AB1_MC_STAR.AlignWith( CB );
+        AB1_MC_STAR = AB1;
+        MakeTrapezoidal( LOWER, AB1_MC_STAR );
+
+        // Direct contribution: C(k:m,:) += alpha tril(A(k:m,k:k+nb)) B1
+        Transpose( B1, B1Trans_MR_STAR );
+        LocalGemm
+        ( NORMAL, TRANSPOSE, alpha, AB1_MC_STAR, B1Trans_MR_STAR, T(1), CB );
+
+        // (Conjugate-)transposed contribution from the same buffer:
+        // C1 += alpha tril(A(k:m,k:k+nb),-1)^[T/H] B(k:m,:)
+        FillDiagonal( AB1_MC_STAR, T(0) );
+        Z1_STAR_MR.Resize( nb, n );
+        LocalGemm( orientation, NORMAL, alpha, AB1_MC_STAR, BB, T(0), Z1_STAR_MR );
+        AxpyContract( T(1), Z1_STAR_MR, C1 );
+    }
+}
+
 template<typename T>
 void LL
 ( T alpha,
@@ -225,6 +306,8 @@ void LL
     // TODO: Come up with a better routing mechanism
     if( A.Height() > 5*B.Width() )
         symm::LLA( alpha, A, B, C, conjugate );
+    else if( A.Height() > 2*B.Width() )
+        symm::LLS( alpha, A, B, C, conjugate );
     else
         symm::LLC( alpha, A, B, C, conjugate );
 }
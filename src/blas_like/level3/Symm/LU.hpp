@@ -212,6 +212,84 @@ void LUC
     }
 }
 
+// The upper-storage analogue of symm::LLS: each panel of the stored
+// (upper) triangle is packed exactly once and yields both its direct
+// contribution and, with its diagonal zeroed, its (conjugate-)transposed
+// contribution through a local Gemm against the leading rows of B followed
+// by a reduce-scatter
+template<typename T>
+void LUS
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre,
+  bool conjugate=false )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, BPre, CPre ))
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& C = CProx.Get();
+
+    // Force B to align with C so that its leading rows can be contracted
+    // against the received panel without a separate redistribution
+    ElementalProxyCtrl BCtrl;
+    BCtrl.colConstrain = true;
+    BCtrl.rowConstrain = true;
+    BCtrl.colAlign = C.ColAlign();
+    BCtrl.rowAlign = C.RowAlign();
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, BCtrl );
+    auto& B = BProx.GetLocked();
+
+    // Temporary distributions
+    DistMatrix<T,MC,  STAR> AT1_MC_STAR(g);
+    DistMatrix<T,MR,  STAR> B1Trans_MR_STAR(g);
+    DistMatrix<T,STAR,MR  > Z1_STAR_MR(g);
+
+    B1Trans_MR_STAR.AlignWith( C );
+    Z1_STAR_MR.AlignWith( C );
+
+    for( Int k=0; k<m; k+=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+
+        const Range<Int> indT( 0, k+nb ),
+                         ind1( k, k+nb );
+
+        auto AT1 = A( indT, ind1 );
+
+        auto B1 = B( ind1, ALL );
+        auto BT = B( indT, ALL );
+
+        auto C1 = C( ind1, ALL );
+        auto CT = C( indT, ALL );
+
+        // Pack the panel of the stored triangle once
+        AT1_MC_STAR.AlignWith( CT );
+        AT1_MC_STAR = AT1;
+        MakeTrapezoidal( UPPER, AT1_MC_STAR, -k );
+
+        // Direct contribution: C(0:k+nb,:) += alpha triu(A(0:k+nb,k:k+nb)) B1
+        Transpose( B1, B1Trans_MR_STAR );
+        LocalGemm
+        ( NORMAL, TRANSPOSE, alpha, AT1_MC_STAR, B1Trans_MR_STAR, T(1), CT );
+
+        // (Conjugate-)transposed contribution from the same buffer:
+        // C1 += alpha triu(A(0:k+nb,k:k+nb),1)^[T/H] B(0:k+nb,:)
+        FillDiagonal( AT1_MC_STAR, T(0), -k );
+        Z1_STAR_MR.Resize( nb, n );
+        LocalGemm( orientation, NORMAL, alpha, AT1_MC_STAR, BT, T(0), Z1_STAR_MR );
+        AxpyContract( T(1), Z1_STAR_MR, C1 );
+    }
+}
+
 template<typename T>
 void LU
 ( T alpha,
@@ -224,6 +302,8 @@ void LU
     // TODO: Come up with a better routing mechanism
     if( A.Height() > 5*B.Width() )
         symm::LUA( alpha, A, B, C, conjugate );
+    else if( A.Height() > 2*B.Width() )
+        symm::LUS( alpha, A, B, C, conjugate );
     else
         symm::LUC( alpha, A, B, C, conjugate );
 }
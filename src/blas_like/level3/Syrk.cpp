@@ -14,6 +14,7 @@
 #include "./Syrk/LT.hpp"
 #include "./Syrk/UN.hpp"
 #include "./Syrk/UT.hpp"
+#include "./Syrk/TallSkinny.hpp"
 
 namespace El {
 
@@ -74,6 +75,17 @@ void Syrk
 {
     EL_DEBUG_CSE
     ScaleTrapezoid( beta, uplo, C );
+    const Int n = ( orientation==NORMAL ? A.Height() : A.Width() );
+    const Int r = ( orientation==NORMAL ? A.Width() : A.Height() );
+    const double weightAwayFromDot = 10.;
+    if( C.ColDist() == STAR && C.RowDist() == STAR &&
+        r > weightAwayFromDot*n )
+    {
+        // A redundantly stored result only requires a single local update
+        // and one AllReduce, with no redistribution of C
+        syrk::TallSkinny( uplo, orientation, alpha, A, C, conjugate );
+        return;
+    }
     if( uplo == LOWER && orientation == NORMAL )
         syrk::LN( alpha, A, C, conjugate );
     else if( uplo == LOWER )
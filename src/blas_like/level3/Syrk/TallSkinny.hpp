@@ -0,0 +1,56 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace syrk {
+
+// When the reduced dimension dwarfs the rank-k dimension and every process
+// wants a redundant copy of the (small) result, forming C = alpha op(A) op(A)'
+// reduces to one local rank-k update followed by a single AllReduce of the
+// n x n result: neither the 2D SUMMA communication pattern nor the blocked
+// dot-product algorithm's sequence of contractions is necessary. This is the
+// algorithm of choice for Gram matrices of tall-and-skinny [VC,STAR] data.
+template<typename T>
+void TallSkinny
+( UpperOrLower uplo,
+  Orientation orientation,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+        AbstractDistMatrix<T>& CPre,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Int n = ( orientation==NORMAL ? APre.Height() : APre.Width() );
+
+    DistMatrixReadWriteProxy<T,T,STAR,STAR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    // The local contribution is zeroed so that the strictly unreferenced
+    // triangle safely contributes nothing to the reduction
+    Matrix<T> Z( n, n );
+    Zero( Z );
+    if( orientation == NORMAL )
+    {
+        DistMatrixReadProxy<T,T,STAR,VC> AProx( APre );
+        auto& A = AProx.GetLocked();
+        Syrk( uplo, NORMAL, alpha, A.LockedMatrix(), T(0), Z, conjugate );
+        mpi::AllReduce( Z.Buffer(), n*n, mpi::SUM, A.RowComm() );
+    }
+    else
+    {
+        DistMatrixReadProxy<T,T,VC,STAR> AProx( APre );
+        auto& A = AProx.GetLocked();
+        Syrk( uplo, orientation, alpha, A.LockedMatrix(), T(0), Z, conjugate );
+        mpi::AllReduce( Z.Buffer(), n*n, mpi::SUM, A.ColComm() );
+    }
+    Axpy( T(1), Z, C.Matrix() );
+}
+
+} // namespace syrk
+} // namespace El
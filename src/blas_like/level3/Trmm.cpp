@@ -18,6 +18,15 @@
 #include "./Trmm/RUN.hpp"
 #include "./Trmm/RUT.hpp"
 
+namespace {
+
+// Minimum number of independent right-hand sides to assign to each thread
+// when splitting a local triangular multiplication into panels
+// TODO: Make this empirically tunable
+const El::Int localTrmmPanelWidth = 64;
+
+}
+
 namespace El {
 
 template<typename T>
@@ -45,8 +54,39 @@ void Trmm
     const char uploChar = UpperOrLowerToChar( uplo );
     const char transChar = OrientationToChar( orientation );
     const char diagChar = UnitOrNonUnitToChar( diag );
+    const Int m = B.Height();
+    const Int n = B.Width();
+#ifdef EL_HYBRID
+    // As in the local Trsm, the columns of a left-sided multiplication (and
+    // the rows of a right-sided one) are mutually independent, so wide local
+    // multiplications are split into panels processed across the threads
+    const Int numThreads = omp_get_max_threads();
+    const Int numIndep = ( side==LEFT ? n : m );
+    if( numThreads > 1 && numIndep >= 2*localTrmmPanelWidth )
+    {
+        const Int numPanels =
+          Min( Int(numThreads), numIndep/localTrmmPanelWidth );
+        EL_PARALLEL_FOR
+        for( Int panel=0; panel<numPanels; ++panel )
+        {
+            const Int start = (panel*numIndep) / numPanels;
+            const Int stop = ((panel+1)*numIndep) / numPanels;
+            if( side == LEFT )
+                blas::Trmm
+                ( sideChar, uploChar, transChar, diagChar, m, stop-start,
+                  alpha, A.LockedBuffer(), A.LDim(),
+                         B.Buffer(0,start), B.LDim() );
+            else
+                blas::Trmm
+                ( sideChar, uploChar, transChar, diagChar, stop-start, n,
+                  alpha, A.LockedBuffer(), A.LDim(),
+                         B.Buffer(start,0), B.LDim() );
+        }
+        return;
+    }
+#endif
     blas::Trmm
-    ( sideChar, uploChar, transChar, diagChar, B.Height(), B.Width(),
+    ( sideChar, uploChar, transChar, diagChar, m, n,
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
 }
 
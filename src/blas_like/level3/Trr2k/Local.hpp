@@ -34,115 +34,81 @@ void LocalTrr2kKernel
     // TODO: Stringent distribution and alignment checks
 
     typedef AbstractDistMatrix<T> ADM;
-    auto A0 = unique_ptr<ADM>( A.Construct(A.Grid(),A.Root()) );
     auto A1 = unique_ptr<ADM>( A.Construct(A.Grid(),A.Root()) );
-    auto B0 = unique_ptr<ADM>( B.Construct(B.Grid(),B.Root()) );
+    auto AOff = unique_ptr<ADM>( A.Construct(A.Grid(),A.Root()) );
     auto B1 = unique_ptr<ADM>( B.Construct(B.Grid(),B.Root()) );
-    auto C0 = unique_ptr<ADM>( C.Construct(C.Grid(),C.Root()) );
     auto C1 = unique_ptr<ADM>( C.Construct(C.Grid(),C.Root()) );
-    auto D0 = unique_ptr<ADM>( D.Construct(D.Grid(),D.Root()) );
+    auto COff = unique_ptr<ADM>( C.Construct(C.Grid(),C.Root()) );
     auto D1 = unique_ptr<ADM>( D.Construct(D.Grid(),D.Root()) );
-    auto ETL = unique_ptr<ADM>( E.Construct(E.Grid(),E.Root()) );
-    auto ETR = unique_ptr<ADM>( E.Construct(E.Grid(),E.Root()) );
-    auto EBL = unique_ptr<ADM>( E.Construct(E.Grid(),E.Root()) );
-    auto EBR = unique_ptr<ADM>( E.Construct(E.Grid(),E.Root()) );
-
-    const Int half = E.Height() / 2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END); 
-    if( transA )
-    {
-        LockedView( *A0, A, ALL, indTL );
-        LockedView( *A1, A, ALL, indBR );
-    }
-    else
-    {
-        LockedView( *A0, A, indTL, ALL );
-        LockedView( *A1, A, indBR, ALL );
-    }
-    if( transB )
-    {
-        LockedView( *B0, B, indTL, ALL );
-        LockedView( *B1, B, indBR, ALL );
-    }
-    else
-    {
-        LockedView( *B0, B, ALL, indTL );
-        LockedView( *B1, B, ALL, indBR );
-    }
-    if( transC )
+    auto E11 = unique_ptr<ADM>( E.Construct(E.Grid(),E.Root()) );
+    auto EOff = unique_ptr<ADM>( E.Construct(E.Grid(),E.Root()) );
+    auto F11 = unique_ptr<ADM>( E.Construct(E.Grid(),E.Root()) );
+
+    // The kernel is swept in narrow diagonal strips: each strip's
+    // off-diagonal block is formed directly in E with full Gemms and only
+    // the small strip corner is formed in a temporary before being trimmed
+    // to the stored triangle
+    const Int n = E.Height();
+    const Int stripSize = LocalTrr2kBlocksize<T>();
+    for( Int j=0; j<n; j+=stripSize )
     {
-        LockedView( *C0, C, ALL, indTL );
-        LockedView( *C1, C, ALL, indBR );
-    }
-    else
-    {
-        LockedView( *C0, C, indTL, ALL );
-        LockedView( *C1, C, indBR, ALL );
-    }
-    if( transD )
-    {
-        LockedView( *D0, D, indTL, ALL );
-        LockedView( *D1, D, indBR, ALL );
-    }
-    else
-    {
-        LockedView( *D0, D, ALL, indTL );
-        LockedView( *D1, D, ALL, indBR );
-    }
-    View( *ETL, E, indTL, indTL );
-    View( *EBR, E, indBR, indBR );
+        const Int nb = Min( stripSize, n-j );
+        const auto ind1 = IR(j,j+nb);
 
-    if( uplo == LOWER )
-    {
-        View( *EBL, E, indBR, indTL ); 
-        Gemm
-        ( orientA, orientB, 
-          alpha, A1->LockedMatrix(), B0->LockedMatrix(), 
-          T(1), EBL->Matrix() );
-        Gemm
-        ( orientC, orientD, 
-          beta, C1->LockedMatrix(), D0->LockedMatrix(), 
-          T(1), EBL->Matrix() );
-    }
-    else
-    {
-        View( *ETR, E, indTL, indBR );
+        if( transA )
+            LockedView( *A1, A, ALL, ind1 );
+        else
+            LockedView( *A1, A, ind1, ALL );
+        if( transB )
+            LockedView( *B1, B, ind1, ALL );
+        else
+            LockedView( *B1, B, ALL, ind1 );
+        if( transC )
+            LockedView( *C1, C, ALL, ind1 );
+        else
+            LockedView( *C1, C, ind1, ALL );
+        if( transD )
+            LockedView( *D1, D, ind1, ALL );
+        else
+            LockedView( *D1, D, ALL, ind1 );
+        View( *E11, E, ind1, ind1 );
+
+        const bool offDiag =
+          ( uplo == LOWER ? j+nb < n : j > 0 );
+        if( offDiag )
+        {
+            const auto indOff = ( uplo==LOWER ? IR(j+nb,n) : IR(0,j) );
+            if( transA )
+                LockedView( *AOff, A, ALL, indOff );
+            else
+                LockedView( *AOff, A, indOff, ALL );
+            if( transC )
+                LockedView( *COff, C, ALL, indOff );
+            else
+                LockedView( *COff, C, indOff, ALL );
+            View( *EOff, E, indOff, ind1 );
+            Gemm
+            ( orientA, orientB,
+              alpha, AOff->LockedMatrix(), B1->LockedMatrix(),
+              T(1), EOff->Matrix() );
+            Gemm
+            ( orientC, orientD,
+              beta, COff->LockedMatrix(), D1->LockedMatrix(),
+              T(1), EOff->Matrix() );
+        }
+
+        F11->AlignWith( *E11 );
+        F11->Resize( E11->Height(), E11->Width() );
         Gemm
-        ( orientA, orientB, 
-          alpha, A0->LockedMatrix(), B1->LockedMatrix(), 
-          T(1), ETR->Matrix() );
+        ( orientA, orientB,
+          alpha, A1->LockedMatrix(), B1->LockedMatrix(),
+          T(0), F11->Matrix() );
         Gemm
-        ( orientC, orientD, 
-          beta, C0->LockedMatrix(), D1->LockedMatrix(), 
-          T(1), ETR->Matrix() );
+        ( orientC, orientD,
+          beta, C1->LockedMatrix(), D1->LockedMatrix(),
+          T(1), F11->Matrix() );
+        LocalAxpyTrapezoid( uplo, T(1), *F11, *E11 );
     }
-
-    auto FTL = unique_ptr<ADM>( E.Construct(E.Grid(),E.Root()) );
-    FTL->AlignWith( *ETL );
-    FTL->Resize( ETL->Height(), ETL->Width() );
-    Gemm
-    ( orientA, orientB, 
-      alpha, A0->LockedMatrix(), B0->LockedMatrix(),
-      T(0), FTL->Matrix() );
-    Gemm
-    ( orientC, orientD,
-      beta, C0->LockedMatrix(), D0->LockedMatrix(),
-      T(1), FTL->Matrix() );
-    LocalAxpyTrapezoid( uplo, T(1), *FTL, *ETL );
-
-    auto FBR = unique_ptr<ADM>( E.Construct(E.Grid(),E.Root()) );
-    FBR->AlignWith( *EBR );
-    FBR->Resize( EBR->Height(), EBR->Width() );
-    Gemm
-    ( orientA, orientB, 
-      alpha, A1->LockedMatrix(), B1->LockedMatrix(),
-      T(0), FBR->Matrix() );
-    Gemm
-    ( orientC, orientD,
-      beta, C1->LockedMatrix(), D1->LockedMatrix(),
-      T(1), FBR->Matrix() );
-    LocalAxpyTrapezoid( uplo, T(1), *FBR, *EBR );
 }
 
 } // namespace trr2k
@@ -120,53 +120,59 @@ void CheckInputTT
 
 #endif // ifndef EL_RELEASE
 
+// The width of the diagonal strips used by the tile-aware kernels below:
+// each strip updates its off-diagonal block of C directly with a full Gemm
+// and only forms the small strip corner in a temporary before trimming it
+// to the stored triangle, so that the fraction of wasted flops is roughly
+// stripSize/(2 C.Height()) rather than one half
+const Int trrkStripSize = 16;
+
 // Local C := alpha A B + C
 template<typename T>
 void TrrkNNKernel
-( UpperOrLower uplo, 
+( UpperOrLower uplo,
   T alpha, const Matrix<T>& A, const Matrix<T>& B,
                  Matrix<T>& C )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(CheckInputNN( A, B, C ))
+    const Int n = C.Height();
 
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm( NORMAL, NORMAL, alpha, AB, BL, T(1), CBL );
-    }
-    else
+    for( Int j=0; j<n; j+=trrkStripSize )
     {
-        auto CTR = C(indTL,indBR);
-        Gemm( NORMAL, NORMAL, alpha, AT, BR, T(1), CTR );
-    }
+        const Int nb = Min( trrkStripSize, n-j );
+        const auto ind1 = IR(j,j+nb);
+
+        auto A1 = A( ind1, ALL );
+        auto B1 = B( ALL, ind1 );
+        auto C11 = C( ind1, ind1 );
 
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm( NORMAL, NORMAL, alpha, AT, BL, DTL );
-    AxpyTrapezoid( uplo, T(1), DTL, CTL );
+        if( uplo == LOWER && j+nb < n )
+        {
+            const auto ind2 = IR(j+nb,n);
+            auto A2 = A( ind2, ALL );
+            auto C21 = C( ind2, ind1 );
+            Gemm( NORMAL, NORMAL, alpha, A2, B1, T(1), C21 );
+        }
+        else if( uplo == UPPER && j > 0 )
+        {
+            const auto ind0 = IR(0,j);
+            auto A0 = A( ind0, ALL );
+            auto C01 = C( ind0, ind1 );
+            Gemm( NORMAL, NORMAL, alpha, A0, B1, T(1), C01 );
+        }
 
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm( NORMAL, NORMAL, alpha, AB, BR, DBR );
-    AxpyTrapezoid( uplo, T(1), DBR, CBR );
+        // Form the strip's diagonal corner and keep only its triangle
+        Matrix<T> D11;
+        Gemm( NORMAL, NORMAL, alpha, A1, B1, D11 );
+        AxpyTrapezoid( uplo, T(1), D11, C11 );
+    }
 }
 
 // Distributed C := alpha A B + C
 template<typename T>
 void LocalTrrkKernel
-( UpperOrLower uplo, 
+( UpperOrLower uplo,
   T alpha, const DistMatrix<T,MC,  STAR>& A,
            const DistMatrix<T,STAR,MR  >& B,
                  DistMatrix<T>& C )
@@ -174,40 +180,39 @@ void LocalTrrkKernel
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(CheckInput( A, B, C ))
     const Grid& g = C.Grid();
+    const Int n = C.Height();
+    const Int stripSize = LocalTrrkBlocksize<T>();
 
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
+    for( Int j=0; j<n; j+=stripSize )
+    {
+        const Int nb = Min( stripSize, n-j );
+        const auto ind1 = IR(j,j+nb);
 
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
+        auto A1 = A( ind1, ALL );
+        auto B1 = B( ALL, ind1 );
+        auto C11 = C( ind1, ind1 );
 
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        LocalGemm( NORMAL, NORMAL, alpha, AB, BL, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm( NORMAL, NORMAL, alpha, AT, BR, T(1), CTR );
-    }
+        if( uplo == LOWER && j+nb < n )
+        {
+            const auto ind2 = IR(j+nb,n);
+            auto A2 = A( ind2, ALL );
+            auto C21 = C( ind2, ind1 );
+            LocalGemm( NORMAL, NORMAL, alpha, A2, B1, T(1), C21 );
+        }
+        else if( uplo == UPPER && j > 0 )
+        {
+            const auto ind0 = IR(0,j);
+            auto A0 = A( ind0, ALL );
+            auto C01 = C( ind0, ind1 );
+            LocalGemm( NORMAL, NORMAL, alpha, A0, B1, T(1), C01 );
+        }
 
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith( CTL );
-    LocalGemm( NORMAL, NORMAL, alpha, AT, BL, DTL );
-    LocalAxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith( CBR );
-    LocalGemm( NORMAL, NORMAL, alpha, AB, BR, DBR );
-    LocalAxpyTrapezoid( uplo, T(1), DBR, CBR );
+        // Form the strip's diagonal corner and keep only its triangle
+        DistMatrix<T> D11(g);
+        D11.AlignWith( C11 );
+        LocalGemm( NORMAL, NORMAL, alpha, A1, B1, D11 );
+        LocalAxpyTrapezoid( uplo, T(1), D11, C11 );
+    }
 }
 
 // Local C := alpha A B^{T/H} + C
@@ -220,38 +225,37 @@ void TrrkNTKernel
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(CheckInputNT( orientationOfB, A, B, C ))
+    const Int n = C.Height();
 
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL );
-    }
-    else
+    for( Int j=0; j<n; j+=trrkStripSize )
     {
-        auto CTR = C(indTL,indBR);
-        Gemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR );
-    }
+        const Int nb = Min( trrkStripSize, n-j );
+        const auto ind1 = IR(j,j+nb);
+
+        auto A1 = A( ind1, ALL );
+        auto B1 = B( ind1, ALL );
+        auto C11 = C( ind1, ind1 );
 
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm( NORMAL, orientationOfB, alpha, AT, BT, DTL );
-    AxpyTrapezoid( uplo, T(1), DTL, CTL );
+        if( uplo == LOWER && j+nb < n )
+        {
+            const auto ind2 = IR(j+nb,n);
+            auto A2 = A( ind2, ALL );
+            auto C21 = C( ind2, ind1 );
+            Gemm( NORMAL, orientationOfB, alpha, A2, B1, T(1), C21 );
+        }
+        else if( uplo == UPPER && j > 0 )
+        {
+            const auto ind0 = IR(0,j);
+            auto A0 = A( ind0, ALL );
+            auto C01 = C( ind0, ind1 );
+            Gemm( NORMAL, orientationOfB, alpha, A0, B1, T(1), C01 );
+        }
 
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm( NORMAL, orientationOfB, alpha, AB, BB, DBR );
-    AxpyTrapezoid( uplo, T(1), DBR, CBR );
+        // Form the strip's diagonal corner and keep only its triangle
+        Matrix<T> D11;
+        Gemm( NORMAL, orientationOfB, alpha, A1, B1, D11 );
+        AxpyTrapezoid( uplo, T(1), D11, C11 );
+    }
 }
 
 // Distributed C := alpha A B^{T/H} + C
@@ -266,40 +270,39 @@ void LocalTrrkKernel
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(CheckInput( A, B, C ))
     const Grid& g = C.Grid();
+    const Int n = C.Height();
+    const Int stripSize = LocalTrrkBlocksize<T>();
 
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
+    for( Int j=0; j<n; j+=stripSize )
+    {
+        const Int nb = Min( stripSize, n-j );
+        const auto ind1 = IR(j,j+nb);
 
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
+        auto A1 = A( ind1, ALL );
+        auto B1 = B( ind1, ALL );
+        auto C11 = C( ind1, ind1 );
 
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        LocalGemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR );
-    }
+        if( uplo == LOWER && j+nb < n )
+        {
+            const auto ind2 = IR(j+nb,n);
+            auto A2 = A( ind2, ALL );
+            auto C21 = C( ind2, ind1 );
+            LocalGemm( NORMAL, orientationOfB, alpha, A2, B1, T(1), C21 );
+        }
+        else if( uplo == UPPER && j > 0 )
+        {
+            const auto ind0 = IR(0,j);
+            auto A0 = A( ind0, ALL );
+            auto C01 = C( ind0, ind1 );
+            LocalGemm( NORMAL, orientationOfB, alpha, A0, B1, T(1), C01 );
+        }
 
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith( CTL );
-    LocalGemm( NORMAL, orientationOfB, alpha, AT, BT, DTL );
-    LocalAxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith( CBR );
-    LocalGemm( NORMAL, orientationOfB, alpha, AB, BB, DBR );
-    LocalAxpyTrapezoid( uplo, T(1), DBR, CBR );
+        // Form the strip's diagonal corner and keep only its triangle
+        DistMatrix<T> D11(g);
+        D11.AlignWith( C11 );
+        LocalGemm( NORMAL, orientationOfB, alpha, A1, B1, D11 );
+        LocalAxpyTrapezoid( uplo, T(1), D11, C11 );
+    }
 }
 
 // Local C := alpha A^{T/H} B + C
@@ -312,38 +315,37 @@ void TrrkTNKernel
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(CheckInputTN( orientationOfA, A, B, C ))
+    const Int n = C.Height();
 
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL );
-    }
-    else
+    for( Int j=0; j<n; j+=trrkStripSize )
     {
-        auto CTR = C(indTL,indBR);
-        Gemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR );
-    }
+        const Int nb = Min( trrkStripSize, n-j );
+        const auto ind1 = IR(j,j+nb);
 
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm( orientationOfA, NORMAL, alpha, AL, BL, DTL );
-    AxpyTrapezoid( uplo, T(1), DTL, CTL );
+        auto A1 = A( ALL, ind1 );
+        auto B1 = B( ALL, ind1 );
+        auto C11 = C( ind1, ind1 );
 
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm( orientationOfA, NORMAL, alpha, AR, BR, DBR );
-    AxpyTrapezoid( uplo, T(1), DBR, CBR );
+        if( uplo == LOWER && j+nb < n )
+        {
+            const auto ind2 = IR(j+nb,n);
+            auto A2 = A( ALL, ind2 );
+            auto C21 = C( ind2, ind1 );
+            Gemm( orientationOfA, NORMAL, alpha, A2, B1, T(1), C21 );
+        }
+        else if( uplo == UPPER && j > 0 )
+        {
+            const auto ind0 = IR(0,j);
+            auto A0 = A( ALL, ind0 );
+            auto C01 = C( ind0, ind1 );
+            Gemm( orientationOfA, NORMAL, alpha, A0, B1, T(1), C01 );
+        }
+
+        // Form the strip's diagonal corner and keep only its triangle
+        Matrix<T> D11;
+        Gemm( orientationOfA, NORMAL, alpha, A1, B1, D11 );
+        AxpyTrapezoid( uplo, T(1), D11, C11 );
+    }
 }
 
 // Distributed C := alpha A^{T/H} B + C
@@ -358,40 +360,39 @@ void LocalTrrkKernel
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(CheckInput( A, B, C ))
     const Grid& g = C.Grid();
+    const Int n = C.Height();
+    const Int stripSize = LocalTrrkBlocksize<T>();
 
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
+    for( Int j=0; j<n; j+=stripSize )
+    {
+        const Int nb = Min( stripSize, n-j );
+        const auto ind1 = IR(j,j+nb);
 
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
+        auto A1 = A( ALL, ind1 );
+        auto B1 = B( ALL, ind1 );
+        auto C11 = C( ind1, ind1 );
 
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        LocalGemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR );
-    }
+        if( uplo == LOWER && j+nb < n )
+        {
+            const auto ind2 = IR(j+nb,n);
+            auto A2 = A( ALL, ind2 );
+            auto C21 = C( ind2, ind1 );
+            LocalGemm( orientationOfA, NORMAL, alpha, A2, B1, T(1), C21 );
+        }
+        else if( uplo == UPPER && j > 0 )
+        {
+            const auto ind0 = IR(0,j);
+            auto A0 = A( ALL, ind0 );
+            auto C01 = C( ind0, ind1 );
+            LocalGemm( orientationOfA, NORMAL, alpha, A0, B1, T(1), C01 );
+        }
 
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith( CTL );
-    LocalGemm( orientationOfA, NORMAL, alpha, AL, BL, DTL );
-    LocalAxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith( CBR );
-    LocalGemm( orientationOfA, NORMAL, alpha, AR, BR, DBR );
-    LocalAxpyTrapezoid( uplo, T(1), DBR, CBR );
+        // Form the strip's diagonal corner and keep only its triangle
+        DistMatrix<T> D11(g);
+        D11.AlignWith( C11 );
+        LocalGemm( orientationOfA, NORMAL, alpha, A1, B1, D11 );
+        LocalAxpyTrapezoid( uplo, T(1), D11, C11 );
+    }
 }
 
 // Local C := alpha A^{T/H} B^{T/H} + C
@@ -405,38 +406,37 @@ void TrrkTTKernel
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(CheckInputTT( orientationOfA, orientationOfB, A, B, C ))
+    const Int n = C.Height();
 
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm( orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL );
-    }
-    else
+    for( Int j=0; j<n; j+=trrkStripSize )
     {
-        auto CTR = C(indTL,indBR);
-        Gemm( orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR );
-    }
+        const Int nb = Min( trrkStripSize, n-j );
+        const auto ind1 = IR(j,j+nb);
+
+        auto A1 = A( ALL, ind1 );
+        auto B1 = B( ind1, ALL );
+        auto C11 = C( ind1, ind1 );
 
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm( orientationOfA, orientationOfB, alpha, AL, BT, DTL );
-    AxpyTrapezoid( uplo, T(1), DTL, CTL );
+        if( uplo == LOWER && j+nb < n )
+        {
+            const auto ind2 = IR(j+nb,n);
+            auto A2 = A( ALL, ind2 );
+            auto C21 = C( ind2, ind1 );
+            Gemm( orientationOfA, orientationOfB, alpha, A2, B1, T(1), C21 );
+        }
+        else if( uplo == UPPER && j > 0 )
+        {
+            const auto ind0 = IR(0,j);
+            auto A0 = A( ALL, ind0 );
+            auto C01 = C( ind0, ind1 );
+            Gemm( orientationOfA, orientationOfB, alpha, A0, B1, T(1), C01 );
+        }
 
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm( orientationOfA, orientationOfB, alpha, AR, BB, DBR );
-    AxpyTrapezoid( uplo, T(1), DBR, CBR );
+        // Form the strip's diagonal corner and keep only its triangle
+        Matrix<T> D11;
+        Gemm( orientationOfA, orientationOfB, alpha, A1, B1, D11 );
+        AxpyTrapezoid( uplo, T(1), D11, C11 );
+    }
 }
 
 // Distributed C := alpha A^{T/H} B^{T/H} + C
@@ -452,40 +452,41 @@ void LocalTrrkKernel
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(CheckInput( A, B, C ))
     const Grid& g = C.Grid();
+    const Int n = C.Height();
+    const Int stripSize = LocalTrrkBlocksize<T>();
+
+    for( Int j=0; j<n; j+=stripSize )
+    {
+        const Int nb = Min( stripSize, n-j );
+        const auto ind1 = IR(j,j+nb);
 
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
+        auto A1 = A( ALL, ind1 );
+        auto B1 = B( ind1, ALL );
+        auto C11 = C( ind1, ind1 );
 
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
+        if( uplo == LOWER && j+nb < n )
+        {
+            const auto ind2 = IR(j+nb,n);
+            auto A2 = A( ALL, ind2 );
+            auto C21 = C( ind2, ind1 );
+            LocalGemm
+            ( orientationOfA, orientationOfB, alpha, A2, B1, T(1), C21 );
+        }
+        else if( uplo == UPPER && j > 0 )
+        {
+            const auto ind0 = IR(0,j);
+            auto A0 = A( ALL, ind0 );
+            auto C01 = C( ind0, ind1 );
+            LocalGemm
+            ( orientationOfA, orientationOfB, alpha, A0, B1, T(1), C01 );
+        }
 
-    if( uplo == LOWER )
-    {
-        auto CBL = C(indBR,indTL);
-        LocalGemm( orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL );
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm( orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR );
+        // Form the strip's diagonal corner and keep only its triangle
+        DistMatrix<T> D11(g);
+        D11.AlignWith( C11 );
+        LocalGemm( orientationOfA, orientationOfB, alpha, A1, B1, D11 );
+        LocalAxpyTrapezoid( uplo, T(1), D11, C11 );
     }
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith( CTL );
-    LocalGemm( orientationOfA, orientationOfB, alpha, AL, BT, DTL );
-    LocalAxpyTrapezoid( uplo, T(1), DTL, CTL );
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith( CBR );
-    LocalGemm( orientationOfA, orientationOfB, alpha, AR, BB, DBR );
-    LocalAxpyTrapezoid( uplo, T(1), DBR, CBR );
 }
 
 // Local C := alpha A B + C
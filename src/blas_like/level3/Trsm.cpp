@@ -19,8 +19,116 @@
 #include "./Trsm/RUN.hpp"
 #include "./Trsm/RUT.hpp"
 
+namespace {
+
+// Minimum number of independent right-hand sides to assign to each thread
+// when splitting a local triangular solve into panels
+// TODO: Make this empirically tunable
+const El::Int localTrsmPanelWidth = 64;
+
+// Solves with every dimension at most this large bypass the vendor
+// interface in favor of a fully-inlined substitution
+const El::Int smallTrsmCutoff = 4;
+
+}
+
 namespace El {
 
+namespace trsm {
+
+// Perform the substitution directly; solves small enough for this routine
+// are dominated by the cost of reaching the vendor kernel rather than by
+// the arithmetic itself
+template<typename F>
+void SmallKernel
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const Matrix<F>& A,
+        Matrix<F>& B )
+{
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const F* ABuf = A.LockedBuffer();
+    F* BBuf = B.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    const bool trans = ( orientation != NORMAL );
+    const bool conj = ( orientation == ADJOINT );
+    const bool unit = ( diag == UNIT );
+    // The effective triangular structure of op(A)
+    const bool lower = ( (uplo == LOWER) != trans );
+    auto opA = [&]( Int i, Int j )
+    {
+        const F value = ( trans ? ABuf[j+i*ALDim] : ABuf[i+j*ALDim] );
+        return ( conj ? Conj(value) : value );
+    };
+    if( side == LEFT )
+    {
+        // Solve op(A) X = alpha B one column at a time
+        for( Int j=0; j<n; ++j )
+        {
+            F* b = &BBuf[j*BLDim];
+            if( lower )
+            {
+                for( Int i=0; i<m; ++i )
+                {
+                    F gamma = alpha*b[i];
+                    for( Int l=0; l<i; ++l )
+                        gamma -= opA(i,l)*b[l];
+                    b[i] = ( unit ? gamma : gamma/opA(i,i) );
+                }
+            }
+            else
+            {
+                for( Int i=m-1; i>=0; --i )
+                {
+                    F gamma = alpha*b[i];
+                    for( Int l=i+1; l<m; ++l )
+                        gamma -= opA(i,l)*b[l];
+                    b[i] = ( unit ? gamma : gamma/opA(i,i) );
+                }
+            }
+        }
+    }
+    else
+    {
+        // Solve X op(A) = alpha B one column of X at a time, noting that
+        // column j only involves the already-solved columns l > j when
+        // op(A) is lower triangular (and l < j when upper triangular)
+        if( lower )
+        {
+            for( Int j=n-1; j>=0; --j )
+            {
+                for( Int i=0; i<m; ++i )
+                {
+                    F gamma = alpha*BBuf[i+j*BLDim];
+                    for( Int l=j+1; l<n; ++l )
+                        gamma -= BBuf[i+l*BLDim]*opA(l,j);
+                    BBuf[i+j*BLDim] = ( unit ? gamma : gamma/opA(j,j) );
+                }
+            }
+        }
+        else
+        {
+            for( Int j=0; j<n; ++j )
+            {
+                for( Int i=0; i<m; ++i )
+                {
+                    F gamma = alpha*BBuf[i+j*BLDim];
+                    for( Int l=0; l<j; ++l )
+                        gamma -= BBuf[i+l*BLDim]*opA(l,j);
+                    BBuf[i+j*BLDim] = ( unit ? gamma : gamma/opA(j,j) );
+                }
+            }
+        }
+    }
+}
+
+} // namespace trsm
+
 template<typename F>
 void Trsm
 ( LeftOrRight side,
@@ -47,10 +155,6 @@ void Trsm
               LogicError("Nonconformal Trsm");
       }
     )
-    const char sideChar = LeftOrRightToChar( side );
-    const char uploChar = UpperOrLowerToChar( uplo );
-    const char transChar = OrientationToChar( orientation );
-    const char diagChar = UnitOrNonUnitToChar( diag );
     if( checkIfSingular && diag != UNIT )
     {
         const Int n = A.Height();
@@ -58,8 +162,50 @@ void Trsm
             if( A.Get(j,j) == F(0) )
                 throw SingularMatrixException();
     }
+    const Int m = B.Height();
+    const Int n = B.Width();
+    if( m <= ::smallTrsmCutoff && n <= ::smallTrsmCutoff )
+    {
+        trsm::SmallKernel( side, uplo, orientation, diag, alpha, A, B );
+        return;
+    }
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+#ifdef EL_HYBRID
+    // The columns of a left-sided solve (and, analogously, the rows of a
+    // right-sided solve) are mutually independent, so a sufficiently wide
+    // local solve is split into panels processed across the available
+    // threads, which would otherwise idle inside a single-threaded vendor
+    // kernel
+    const Int numThreads = omp_get_max_threads();
+    const Int numIndep = ( side==LEFT ? n : m );
+    if( numThreads > 1 && numIndep >= 2*localTrsmPanelWidth )
+    {
+        const Int numPanels =
+          Min( Int(numThreads), numIndep/localTrsmPanelWidth );
+        EL_PARALLEL_FOR
+        for( Int panel=0; panel<numPanels; ++panel )
+        {
+            const Int start = (panel*numIndep) / numPanels;
+            const Int stop = ((panel+1)*numIndep) / numPanels;
+            if( side == LEFT )
+                blas::Trsm
+                ( sideChar, uploChar, transChar, diagChar, m, stop-start,
+                  alpha, A.LockedBuffer(), A.LDim(),
+                         B.Buffer(0,start), B.LDim() );
+            else
+                blas::Trsm
+                ( sideChar, uploChar, transChar, diagChar, stop-start, n,
+                  alpha, A.LockedBuffer(), A.LDim(),
+                         B.Buffer(start,0), B.LDim() );
+        }
+        return;
+    }
+#endif
     blas::Trsm
-    ( sideChar, uploChar, transChar, diagChar, B.Height(), B.Width(),
+    ( sideChar, uploChar, transChar, diagChar, m, n,
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
 }
 
@@ -374,6 +520,65 @@ void Trsm
     }
 }
 
+namespace trsm {
+
+template<typename F,typename=EnableIf<IsBlasScalar<F>>>
+void ScaLAPACKHelper
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B )
+{
+    AssertScaLAPACKSupport();
+#ifdef EL_HAVE_SCALAPACK
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+
+    auto descA = FillDesc( A );
+    auto descB = FillDesc( B );
+    pblas::Trsm
+    ( sideChar, uploChar, transChar, diagChar, m, n,
+      alpha, A.LockedBuffer(), descA.data(),
+             B.Buffer(),       descB.data() );
+#endif
+}
+
+template<typename F,typename=DisableIf<IsBlasScalar<F>>,typename=void>
+void ScaLAPACKHelper
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B )
+{
+    LogicError("ScaLAPACK does not support this datatype");
+}
+
+} // namespace trsm
+
+template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B )
+{
+    EL_DEBUG_CSE
+    trsm::ScaLAPACKHelper( side, uplo, orientation, diag, alpha, A, B );
+}
+
 template<typename F>
 void LocalTrsm
 ( LeftOrRight side,
@@ -417,6 +622,14 @@ void LocalTrsm
           AbstractDistMatrix<F>& B, \
     bool checkIfSingular, \
     TrsmAlgorithm alg ); \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const DistMatrix<F,MC,MR,BLOCK>& A, \
+          DistMatrix<F,MC,MR,BLOCK>& B ); \
   template void LocalTrsm \
   ( LeftOrRight side, \
     UpperOrLower uplo, \
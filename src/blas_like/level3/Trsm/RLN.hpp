@@ -25,7 +25,7 @@ void RLN
 {
     EL_DEBUG_CSE
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = AlgorithmicBlocksize<F>( "Trsm", n );
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -29,7 +29,7 @@ void RLT
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = AlgorithmicBlocksize<F>( "Trsm", n );
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
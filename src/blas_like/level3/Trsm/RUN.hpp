@@ -22,7 +22,7 @@ void RUN
 {
     EL_DEBUG_CSE
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = AlgorithmicBlocksize<F>( "Trsm", n );
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -60,8 +60,37 @@ void LVar4( UnitOrNonUnit diag, Matrix<F>& A, const Matrix<F>& L )
         // A10 := A10 + 1/2 Y10
         Axpy( F(1)/F(2), Y10, A10 );
 
-        // A00 := A00 + (A10' L10 + L10' A10)
-        Her2k( LOWER, ADJOINT, F(1), A10, L10, Base<F>(1), A00 );
+        if( FusedTwoSidedUpdatesEnabled() )
+        {
+            // Sweep the leading columns once, applying both
+            //   A00 := A00 + (A10' L10 + L10' A10)  and
+            //   A20 := A20 + A21 L10
+            // to each column tile while it is cache-resident
+            for( Int j=0; j<k; j+=bsize )
+            {
+                const Int jb = Min( bsize, k-j );
+                const Range<Int> indT( j, j+jb ), indP( 0, j );
+                auto L10T = L10( ALL, indT );
+                auto A10T = A10( ALL, indT );
+                auto A20T = A20( ALL, indT );
+                Gemm( NORMAL, NORMAL, F(1), A21, L10T, F(1), A20T );
+                if( j > 0 )
+                {
+                    auto A10P = A10( ALL, indP );
+                    auto L10P = L10( ALL, indP );
+                    auto A00TP = A00( indT, indP );
+                    Gemm( ADJOINT, NORMAL, F(1), A10T, L10P, F(1), A00TP );
+                    Gemm( ADJOINT, NORMAL, F(1), L10T, A10P, F(1), A00TP );
+                }
+                auto A00TT = A00( indT, indT );
+                Her2k( LOWER, ADJOINT, F(1), A10T, L10T, Base<F>(1), A00TT );
+            }
+        }
+        else
+        {
+            // A00 := A00 + (A10' L10 + L10' A10)
+            Her2k( LOWER, ADJOINT, F(1), A10, L10, Base<F>(1), A00 );
+        }
 
         // A10 := A10 + 1/2 Y10
         Axpy( F(1)/F(2), Y10, A10 );
@@ -69,8 +98,11 @@ void LVar4( UnitOrNonUnit diag, Matrix<F>& A, const Matrix<F>& L )
         // A10 := L11' A10
         Trmm( LEFT, LOWER, ADJOINT, diag, F(1), L11, A10 );
 
-        // A20 := A20 + A21 L10
-        Gemm( NORMAL, NORMAL, F(1), A21, L10, F(1), A20 );
+        if( !FusedTwoSidedUpdatesEnabled() )
+        {
+            // A20 := A20 + A21 L10
+            Gemm( NORMAL, NORMAL, F(1), A21, L10, F(1), A20 );
+        }
 
         // A11 := L11' A11 L11
         twotrmm::LUnb( diag, A11, L11 );
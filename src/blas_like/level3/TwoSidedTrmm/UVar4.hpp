@@ -57,8 +57,37 @@ void UVar4( UnitOrNonUnit diag, Matrix<F>& A, const Matrix<F>& U )
         // A01 := A01 + 1/2 Y01
         Axpy( F(1)/F(2), Y01, A01 );
 
-        // A00 := A00 + (U01 A01' + A01 U01')
-        Her2k( UPPER, NORMAL, F(1), U01, A01, Base<F>(1), A00 );
+        if( FusedTwoSidedUpdatesEnabled() )
+        {
+            // Sweep the leading rows once, applying both
+            //   A00 := A00 + (U01 A01' + A01 U01')  and
+            //   A02 := A02 + U01 A12
+            // to each row tile while it is cache-resident
+            for( Int i=0; i<k; i+=bsize )
+            {
+                const Int ib = Min( bsize, k-i );
+                const Range<Int> indT( i, i+ib ), indQ( i+ib, k );
+                auto U01T = U01( indT, ALL );
+                auto A01T = A01( indT, ALL );
+                auto A02T = A02( indT, ALL );
+                Gemm( NORMAL, NORMAL, F(1), U01T, A12, F(1), A02T );
+                auto A00TT = A00( indT, indT );
+                Her2k( UPPER, NORMAL, F(1), U01T, A01T, Base<F>(1), A00TT );
+                if( i+ib < k )
+                {
+                    auto U01Q = U01( indQ, ALL );
+                    auto A01Q = A01( indQ, ALL );
+                    auto A00TQ = A00( indT, indQ );
+                    Gemm( NORMAL, ADJOINT, F(1), U01T, A01Q, F(1), A00TQ );
+                    Gemm( NORMAL, ADJOINT, F(1), A01T, U01Q, F(1), A00TQ );
+                }
+            }
+        }
+        else
+        {
+            // A00 := A00 + (U01 A01' + A01 U01')
+            Her2k( UPPER, NORMAL, F(1), U01, A01, Base<F>(1), A00 );
+        }
 
         // A01 := A01 + 1/2 Y01
         Axpy( F(1)/F(2), Y01, A01 );
@@ -66,8 +95,11 @@ void UVar4( UnitOrNonUnit diag, Matrix<F>& A, const Matrix<F>& U )
         // A01 := A01 U11'
         Trmm( RIGHT, UPPER, ADJOINT, diag, F(1), U11, A01 );
 
-        // A02 := A02 + U01 A12
-        Gemm( NORMAL, NORMAL, F(1), U01, A12, F(1), A02 );
+        if( !FusedTwoSidedUpdatesEnabled() )
+        {
+            // A02 := A02 + U01 A12
+            Gemm( NORMAL, NORMAL, F(1), U01, A12, F(1), A02 );
+        }
 
         // A11 := U11 A11 U11'
         twotrmm::UUnb( diag, A11, U11 );
@@ -13,9 +13,22 @@
 #include "./TwoSidedTrsm/LVar4.hpp"
 #include "./TwoSidedTrsm/UVar4.hpp"
 
+namespace {
+
+bool fusedTwoSidedUpdates = false;
+
+}
+
 namespace El {
 
-template<typename F> 
+void EnableFusedTwoSidedUpdates() EL_NO_EXCEPT
+{ ::fusedTwoSidedUpdates = true; }
+void DisableFusedTwoSidedUpdates() EL_NO_EXCEPT
+{ ::fusedTwoSidedUpdates = false; }
+bool FusedTwoSidedUpdatesEnabled() EL_NO_EXCEPT
+{ return ::fusedTwoSidedUpdates; }
+
+template<typename F>
 void TwoSidedTrsm
 ( UpperOrLower uplo, UnitOrNonUnit diag,
         Matrix<F>& A,
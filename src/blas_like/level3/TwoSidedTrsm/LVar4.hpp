@@ -53,8 +53,11 @@ void LVar4( UnitOrNonUnit diag, Matrix<F>& A, const Matrix<F>& L )
         // A11 := inv(L11) A11 inv(L11)'
         twotrsm::LUnb( diag, A11, L11 );
 
-        // A20 := A20 - L21 A10
-        Gemm( NORMAL, NORMAL, F(-1), L21, A10, F(1), A20 );
+        if( !FusedTwoSidedUpdatesEnabled() )
+        {
+            // A20 := A20 - L21 A10
+            Gemm( NORMAL, NORMAL, F(-1), L21, A10, F(1), A20 );
+        }
 
         // Y21 := L21 A11
         Y21.Resize( A21.Height(), A21.Width() );
@@ -67,8 +70,38 @@ void LVar4( UnitOrNonUnit diag, Matrix<F>& A, const Matrix<F>& L )
         // A21 := A21 - 1/2 Y21
         Axpy( F(-1)/F(2), Y21, A21 );
 
-        // A22 := A22 - (L21 A21' + A21 L21')
-        Her2k( LOWER, NORMAL, F(-1), L21, A21, Base<F>(1), A22 );
+        if( FusedTwoSidedUpdatesEnabled() )
+        {
+            // Sweep the trailing rows once, applying both
+            //   A20 := A20 - L21 A10  and
+            //   A22 := A22 - (L21 A21' + A21 L21')
+            // to each row tile while it is cache-resident
+            const Int mRem = n - (k+nb);
+            for( Int i=0; i<mRem; i+=bsize )
+            {
+                const Int ib = Min( bsize, mRem-i );
+                const Range<Int> indT( i, i+ib ), indP( 0, i );
+                auto L21T = L21( indT, ALL );
+                auto A21T = A21( indT, ALL );
+                auto A20T = A20( indT, ALL );
+                Gemm( NORMAL, NORMAL, F(-1), L21T, A10, F(1), A20T );
+                if( i > 0 )
+                {
+                    auto A21P = A21( indP, ALL );
+                    auto L21P = L21( indP, ALL );
+                    auto A22TP = A22( indT, indP );
+                    Gemm( NORMAL, ADJOINT, F(-1), L21T, A21P, F(1), A22TP );
+                    Gemm( NORMAL, ADJOINT, F(-1), A21T, L21P, F(1), A22TP );
+                }
+                auto A22TT = A22( indT, indT );
+                Her2k( LOWER, NORMAL, F(-1), L21T, A21T, Base<F>(1), A22TT );
+            }
+        }
+        else
+        {
+            // A22 := A22 - (L21 A21' + A21 L21')
+            Her2k( LOWER, NORMAL, F(-1), L21, A21, Base<F>(1), A22 );
+        }
 
         // A21 := A21 - 1/2 Y21
         Axpy( F(-1)/F(2), Y21, A21 );
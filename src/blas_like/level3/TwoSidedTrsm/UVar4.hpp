@@ -53,8 +53,11 @@ void UVar4( UnitOrNonUnit diag, Matrix<F>& A, const Matrix<F>& U )
         // A11 := inv(U11)' A11 inv(U11)
         twotrsm::UUnb( diag, A11, U11 );
 
-        // A02 := A02 - A01 U12
-        Gemm( NORMAL, NORMAL, F(-1), A01, U12, F(1), A02 );
+        if( !FusedTwoSidedUpdatesEnabled() )
+        {
+            // A02 := A02 - A01 U12
+            Gemm( NORMAL, NORMAL, F(-1), A01, U12, F(1), A02 );
+        }
 
         // Y12 := A11 U12
         Y12.Resize( A12.Height(), A12.Width() );
@@ -67,8 +70,38 @@ void UVar4( UnitOrNonUnit diag, Matrix<F>& A, const Matrix<F>& U )
         // A12 := A12 - 1/2 Y12
         Axpy( F(-1)/F(2), Y12, A12 );
 
-        // A22 := A22 - (A12' U12 + U12' A12)
-        Her2k( UPPER, ADJOINT, F(-1), A12, U12, Base<F>(1), A22 );
+        if( FusedTwoSidedUpdatesEnabled() )
+        {
+            // Sweep the trailing columns once, applying both
+            //   A02 := A02 - A01 U12  and
+            //   A22 := A22 - (A12' U12 + U12' A12)
+            // to each column tile while it is cache-resident
+            const Int nRem = n - (k+nb);
+            for( Int j=0; j<nRem; j+=bsize )
+            {
+                const Int jb = Min( bsize, nRem-j );
+                const Range<Int> indT( j, j+jb ), indP( 0, j );
+                auto U12T = U12( ALL, indT );
+                auto A12T = A12( ALL, indT );
+                auto A02T = A02( ALL, indT );
+                Gemm( NORMAL, NORMAL, F(-1), A01, U12T, F(1), A02T );
+                if( j > 0 )
+                {
+                    auto A12P = A12( ALL, indP );
+                    auto U12P = U12( ALL, indP );
+                    auto A22PT = A22( indP, indT );
+                    Gemm( ADJOINT, NORMAL, F(-1), A12P, U12T, F(1), A22PT );
+                    Gemm( ADJOINT, NORMAL, F(-1), U12P, A12T, F(1), A22PT );
+                }
+                auto A22TT = A22( indT, indT );
+                Her2k( UPPER, ADJOINT, F(-1), A12T, U12T, Base<F>(1), A22TT );
+            }
+        }
+        else
+        {
+            // A22 := A22 - (A12' U12 + U12' A12)
+            Her2k( UPPER, ADJOINT, F(-1), A12, U12, Base<F>(1), A22 );
+        }
 
         // A12 := A12 - 1/2 Y12
         Axpy( F(-1)/F(2), Y12, A12 );
@@ -72,6 +72,27 @@ void Lyapunov
     Sylvester( m, W, X, ctrl );
 }
 
+// When A is already upper triangular (e.g., a Schur factor), the solution
+// of A X + X A^H = C is instead computed through Bartels-Stewart
+// substitution, which avoids the Gemm-heavy sign-function iteration
+template<typename F>
+void TriangularLyapunov
+( const Matrix<F>& A, const Matrix<F>& C, Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    TriangularSylvester( NORMAL, ADJOINT, A, A, C, X );
+}
+
+template<typename F>
+void TriangularLyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X )
+{
+    EL_DEBUG_CSE
+    TriangularSylvester( NORMAL, ADJOINT, A, A, C, X );
+}
+
 #define PROTO(F) \
   template void Lyapunov \
   ( const Matrix<F>& A, \
@@ -82,7 +103,15 @@ void Lyapunov
   ( const ElementalMatrix<F>& A, \
     const ElementalMatrix<F>& C, \
           ElementalMatrix<F>& X, \
-    SignCtrl<Base<F>> ctrl );
+    SignCtrl<Base<F>> ctrl ); \
+  template void TriangularLyapunov \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& C, \
+          Matrix<F>& X ); \
+  template void TriangularLyapunov \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& X );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
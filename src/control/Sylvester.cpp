@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
 #include <El/lapack_like/funcs.hpp>
 #include <El/control.hpp>
 
@@ -155,6 +156,245 @@ void Sylvester
     Sylvester( m, W, X, ctrl );
 }
 
+namespace triang_sylv {
+
+// Entrywise substitution for op(A) X + X op(B) = C, with A and B upper
+// triangular and C having been preloaded into X
+template<typename F>
+void BaseCase
+( Orientation orientA,
+  Orientation orientB,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const bool conjA = ( orientA == ADJOINT );
+    const bool conjB = ( orientB == ADJOINT );
+    for( Int jCount=0; jCount<n; ++jCount )
+    {
+        const Int j = ( normalB ? jCount : n-1-jCount );
+        for( Int iCount=0; iCount<m; ++iCount )
+        {
+            const Int i = ( normalA ? m-1-iCount : iCount );
+            F sum = X(i,j);
+            if( normalA )
+            {
+                for( Int k=i+1; k<m; ++k )
+                    sum -= A(i,k)*X(k,j);
+            }
+            else
+            {
+                for( Int k=0; k<i; ++k )
+                    sum -= ( conjA ? Conj(A(k,i)) : A(k,i) )*X(k,j);
+            }
+            if( normalB )
+            {
+                for( Int l=0; l<j; ++l )
+                    sum -= X(i,l)*B(l,j);
+            }
+            else
+            {
+                for( Int l=j+1; l<n; ++l )
+                    sum -= X(i,l)*( conjB ? Conj(B(j,l)) : B(j,l) );
+            }
+            const F denom =
+              ( conjA ? Conj(A(i,i)) : A(i,i) ) +
+              ( conjB ? Conj(B(j,j)) : B(j,j) );
+            if( denom == F(0) )
+                throw SingularMatrixException();
+            X(i,j) = sum / denom;
+        }
+    }
+}
+
+// RECSY-style recursion: halve the larger dimension so that all but the
+// diagonal base cases are handled through level-3 updates
+template<typename F>
+void Recursive
+( Orientation orientA,
+  Orientation orientB,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int cutoff = Blocksize();
+    if( m <= cutoff && n <= cutoff )
+    {
+        BaseCase( orientA, orientB, A, B, X );
+        return;
+    }
+    if( m >= n )
+    {
+        const Int half = m/2;
+        const Range<Int> indT( 0, half ), indB( half, m );
+        auto ATL = A( indT, indT );
+        auto ATR = A( indT, indB );
+        auto ABR = A( indB, indB );
+        auto XT = X( indT, ALL );
+        auto XB = X( indB, ALL );
+        if( orientA == NORMAL )
+        {
+            Recursive( orientA, orientB, ABR, B, XB );
+            Gemm( NORMAL, NORMAL, F(-1), ATR, XB, F(1), XT );
+            Recursive( orientA, orientB, ATL, B, XT );
+        }
+        else
+        {
+            Recursive( orientA, orientB, ATL, B, XT );
+            Gemm( orientA, NORMAL, F(-1), ATR, XT, F(1), XB );
+            Recursive( orientA, orientB, ABR, B, XB );
+        }
+    }
+    else
+    {
+        const Int half = n/2;
+        const Range<Int> indL( 0, half ), indR( half, n );
+        auto BTL = B( indL, indL );
+        auto BTR = B( indL, indR );
+        auto BBR = B( indR, indR );
+        auto XL = X( ALL, indL );
+        auto XR = X( ALL, indR );
+        if( orientB == NORMAL )
+        {
+            Recursive( orientA, orientB, A, BTL, XL );
+            Gemm( NORMAL, NORMAL, F(-1), XL, BTR, F(1), XR );
+            Recursive( orientA, orientB, A, BBR, XR );
+        }
+        else
+        {
+            Recursive( orientA, orientB, A, BBR, XR );
+            Gemm( NORMAL, orientB, F(-1), XR, BTR, F(1), XL );
+            Recursive( orientA, orientB, A, BTL, XL );
+        }
+    }
+}
+
+} // namespace triang_sylv
+
+template<typename F>
+void TriangularSylvester
+( Orientation orientA,
+  Orientation orientB,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != B.Width() )
+          LogicError("B must be square");
+      if( C.Height() != A.Height() || C.Width() != B.Height() )
+          LogicError("C must conform with A and B");
+    )
+    X = C;
+    triang_sylv::Recursive( orientA, orientB, A, B, X );
+}
+
+template<typename F>
+void TriangularSylvester
+( Orientation orientA,
+  Orientation orientB,
+  const ElementalMatrix<F>& APre,
+  const ElementalMatrix<F>& BPre,
+  const ElementalMatrix<F>& CPre,
+        ElementalMatrix<F>& XPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( BPre.Height() != BPre.Width() )
+          LogicError("B must be square");
+      if( CPre.Height() != APre.Height() || CPre.Width() != BPre.Height() )
+          LogicError("C must conform with A and B");
+      AssertSameGrids( APre, BPre, CPre );
+    )
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& X = XProx.Get();
+    const Grid& g = A.Grid();
+
+    Copy( CPre, X );
+    const Int m = A.Height();
+    const Int n = B.Height();
+    const Int bsize = Blocksize();
+    const Int mb = ( m + bsize - 1 ) / bsize;
+    const Int nb = ( n + bsize - 1 ) / bsize;
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), B11_STAR_STAR(g),
+                            X11_STAR_STAR(g);
+
+    // Sweep a wavefront over the block anti-diagonals of X: all blocks of a
+    // given anti-diagonal are mutually independent, and each block's trailing
+    // dependencies are folded in through a pair of level-3 updates just
+    // before its diagonal solve
+    for( Int d=0; d<mb+nb-1; ++d )
+    {
+        for( Int bi=0; bi<mb; ++bi )
+        {
+            const Int fi = ( orientA == NORMAL ? mb-1-bi : bi );
+            const Int gj = d - fi;
+            if( gj < 0 || gj >= nb )
+                continue;
+            const Int bj = ( orientB == NORMAL ? gj : nb-1-gj );
+
+            const Int i = bi*bsize;
+            const Int j = bj*bsize;
+            const Int ib = Min( bsize, m-i );
+            const Int jb = Min( bsize, n-j );
+            const Range<Int> indI( i, i+ib ), indJ( j, j+jb );
+            auto XIJ = X( indI, indJ );
+
+            if( orientA == NORMAL && i+ib < m )
+            {
+                auto A1 = A( indI, Range<Int>(i+ib,m) );
+                auto X1 = X( Range<Int>(i+ib,m), indJ );
+                Gemm( NORMAL, NORMAL, F(-1), A1, X1, F(1), XIJ );
+            }
+            else if( orientA != NORMAL && i > 0 )
+            {
+                auto A1 = A( Range<Int>(0,i), indI );
+                auto X1 = X( Range<Int>(0,i), indJ );
+                Gemm( orientA, NORMAL, F(-1), A1, X1, F(1), XIJ );
+            }
+            if( orientB == NORMAL && j > 0 )
+            {
+                auto B1 = B( Range<Int>(0,j), indJ );
+                auto X1 = X( indI, Range<Int>(0,j) );
+                Gemm( NORMAL, NORMAL, F(-1), X1, B1, F(1), XIJ );
+            }
+            else if( orientB != NORMAL && j+jb < n )
+            {
+                auto B1 = B( indJ, Range<Int>(j+jb,n) );
+                auto X1 = X( indI, Range<Int>(j+jb,n) );
+                Gemm( NORMAL, orientB, F(-1), X1, B1, F(1), XIJ );
+            }
+
+            A11_STAR_STAR = A( indI, indI );
+            B11_STAR_STAR = B( indJ, indJ );
+            X11_STAR_STAR = XIJ;
+            triang_sylv::Recursive
+            ( orientA, orientB,
+              A11_STAR_STAR.LockedMatrix(), B11_STAR_STAR.LockedMatrix(),
+              X11_STAR_STAR.Matrix() );
+            XIJ = X11_STAR_STAR;
+        }
+    }
+}
+
 #define PROTO(F) \
   template void Sylvester \
   ( Int m, \
@@ -177,7 +417,21 @@ void Sylvester
     const ElementalMatrix<F>& B, \
     const ElementalMatrix<F>& C, \
           ElementalMatrix<F>& X, \
-    SignCtrl<Base<F>> ctrl );
+    SignCtrl<Base<F>> ctrl ); \
+  template void TriangularSylvester \
+  ( Orientation orientA, \
+    Orientation orientB, \
+    const Matrix<F>& A, \
+    const Matrix<F>& B, \
+    const Matrix<F>& C, \
+          Matrix<F>& X ); \
+  template void TriangularSylvester \
+  ( Orientation orientA, \
+    Orientation orientB, \
+    const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& X );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
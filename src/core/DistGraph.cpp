@@ -439,46 +439,32 @@ void DistGraph::ProcessLocalQueues()
     if( locallyConsistent_ )
         return;
 
-    const Int numLocalEdges = sources_.size();
-    Int numRemoved = 0;
-    vector<pair<Int,Int>> pairs( numLocalEdges );
+    // Filter out any edges marked for removal
+    // ---------------------------------------
     if( markedForRemoval_.size() != 0 )
     {
-        for( Int e=0; e<numLocalEdges; ++e )
+        const Int numQueued = sources_.size();
+        Int numKept = 0;
+        for( Int e=0; e<numQueued; ++e )
         {
             pair<Int,Int> candidate(sources_[e],targets_[e]);
             if( markedForRemoval_.find(candidate) == markedForRemoval_.end() )
-                pairs[e-numRemoved] = candidate;
-            else
-                ++numRemoved;
+            {
+                sources_[numKept] = sources_[e];
+                targets_[numKept] = targets_[e];
+                ++numKept;
+            }
         }
         SwapClear( markedForRemoval_ );
-        pairs.resize( numLocalEdges-numRemoved );
+        sources_.resize( numKept );
+        targets_.resize( numKept );
     }
-    else
-    {
-        for( Int e=0; e<numLocalEdges; ++e )
-            pairs[e] = pair<Int,Int>{sources_[e],targets_[e]};
-    }
-    std::sort( pairs.begin(), pairs.end() );
-    const Int numSorted = pairs.size();
-
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int e=1; e<numSorted; ++e )
-        if( pairs[e] != pairs[lastUnique] )
-            pairs[++lastUnique] = pairs[e];
-    const Int numUnique = lastUnique+1;
-    pairs.resize( numUnique );
-
-    sources_.resize( numUnique );
-    targets_.resize( numUnique );
-    for( Int e=0; e<numUnique; ++e )
-    {
-        sources_[e] = pairs[e].first;
-        targets_[e] = pairs[e].second;
-    }
-    ComputeSourceOffsets();
+
+    // Bucket the local edges by source, sort and deduplicate each source's
+    // targets in parallel, and recover the offsets from the bucket scan
+    sparse_assembly::SortAndCompress
+    ( blocksize_*grid_->Rank(), numLocalSources_,
+      sources_, targets_, localSourceOffsets_ );
     locallyConsistent_ = true;
 }
 
@@ -718,6 +704,35 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
         meta.recvSizes[commSize-1] = off - lastOff;
     }
 
+    // Partition the local sources by whether all of their edges reference
+    // locally-owned vector data, so that multiplies can overlap the exchange
+    // of the halo with the interior rows' work.
+    {
+        const int commRank = grid_->Rank();
+        const Int selfBeg = meta.recvOffs[commRank];
+        const Int selfEnd = selfBeg + meta.recvSizes[commRank];
+        meta.interiorRows.clear();
+        meta.haloRows.clear();
+        for( Int iLoc=0; iLoc<numLocalSources_; ++iLoc )
+        {
+            bool interior = true;
+            const Int eStart = localSourceOffsets_[iLoc];
+            const Int eStop = localSourceOffsets_[iLoc+1];
+            for( Int e=eStart; e<eStop; ++e )
+            {
+                if( meta.colOffs[e] < selfBeg || meta.colOffs[e] >= selfEnd )
+                {
+                    interior = false;
+                    break;
+                }
+            }
+            if( interior )
+                meta.interiorRows.push_back( iLoc );
+            else
+                meta.haloRows.push_back( iLoc );
+        }
+    }
+
     // Coordinate
     meta.sendSizes.resize( commSize );
     mpi::AllToAll( meta.recvSizes.data(), 1, meta.sendSizes.data(), 1, comm );
@@ -10,6 +10,23 @@
 */
 #include <El-lite.hpp>
 
+namespace {
+
+// FNV-1a over the index list, used to cheaply reject cache mismatches
+// before the exact comparison
+size_t HashIndices( const std::vector<El::Int>& inds )
+{
+    size_t hash = 14695981039346656037ULL;
+    for( const El::Int& i : inds )
+    {
+        hash ^= size_t(i);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+} // anonymous namespace
+
 namespace El {
 
 DistMap::DistMap( const El::Grid& grid )
@@ -56,6 +73,21 @@ void DistMap::Translate
     const int commSize = grid_->Size();
     const int commRank = grid_->Rank();
 
+    // Check whether the last translation can be reused; since Translate is
+    // collective, a process with a stale cache must force a fresh exchange
+    // everywhere, so the (cheap) verdict is agreed upon collectively
+    const size_t requestHash = HashIndices( localInds );
+    const int localHit =
+      ( cacheValid_ && requestHash == cachedHash_ &&
+        localInds == cachedRequest_ ? 1 : 0 );
+    const int globalHit = mpi::AllReduce( localHit, mpi::MIN, grid_->Comm() );
+    if( globalHit )
+    {
+        localInds = cachedTranslation_;
+        return;
+    }
+    cachedRequest_ = localInds;
+
     // Count how many indices we need each process to map
     // Avoid unncessary branching within the loop by avoiding RowToProcess
     vector<int> requestSizes( commSize, 0 );
@@ -120,6 +152,44 @@ void DistMap::Translate
         if( i < numSources_ )
             localInds[s] = requests[offs[origOwners[s]]++];
     }
+
+    cachedTranslation_ = localInds;
+    cachedHash_ = requestHash;
+    cacheValid_ = true;
+}
+
+void DistMap::QueueTranslation( vector<Int>& localInds ) const
+{
+    EL_DEBUG_CSE
+    translationQueue_.push_back( &localInds );
+}
+
+void DistMap::ProcessTranslationQueue() const
+{
+    EL_DEBUG_CSE
+    // Aggregate every deferred request into a single exchange (processes
+    // with empty queues still participate in the collective translation)
+    Int numCombinedInds = 0;
+    for( const auto* localInds : translationQueue_ )
+        numCombinedInds += localInds->size();
+    vector<Int> combinedInds;
+    combinedInds.reserve( numCombinedInds );
+    for( const auto* localInds : translationQueue_ )
+        combinedInds.insert
+        ( combinedInds.end(), localInds->begin(), localInds->end() );
+
+    Translate( combinedInds );
+
+    // Scatter the translations back into the queued vectors
+    Int off = 0;
+    for( auto* localInds : translationQueue_ )
+    {
+        const Int numInds = localInds->size();
+        for( Int s=0; s<numInds; ++s )
+            (*localInds)[s] = combinedInds[off+s];
+        off += numInds;
+    }
+    SwapClear( translationQueue_ );
 }
 
 void DistMap::Extend( DistMap& firstMap ) const
@@ -128,6 +198,7 @@ void DistMap::Extend( DistMap& firstMap ) const
     // TODO(poulson): Ensure that the communicators are congruent and that the
     // maps are compatible sizes.
     Translate( firstMap.map_ );
+    firstMap.InvalidateTranslationCache();
 }
 
 void DistMap::Extend( const DistMap& firstMap, DistMap& compositeMap ) const
@@ -161,6 +232,7 @@ void DistMap::SetGrid( const El::Grid& grid )
         return;
     grid_ = &grid;
     InitializeLocalData();
+    InvalidateTranslationCache();
 }
 
 const El::Grid& DistMap::Grid() const { return *grid_; }
@@ -191,12 +263,23 @@ void DistMap::SetLocal( Int localSource, Int target )
           LogicError("local source is out of bounds");
     )
     map_[localSource] = target;
+    InvalidateTranslationCache();
 }
 
-      vector<Int>& DistMap::Map()       { return map_; }
+vector<Int>& DistMap::Map()
+{
+    // The handed-out reference may be used to modify the map
+    InvalidateTranslationCache();
+    return map_;
+}
 const vector<Int>& DistMap::Map() const { return map_; }
 
-      Int* DistMap::Buffer()       { return map_.data(); }
+Int* DistMap::Buffer()
+{
+    // The handed-out pointer may be used to modify the map
+    InvalidateTranslationCache();
+    return map_.data();
+}
 const Int* DistMap::Buffer() const { return map_.data(); }
 
 void DistMap::Empty()
@@ -205,6 +288,8 @@ void DistMap::Empty()
     numSources_ = 0;
     blocksize_ = 1;
     SwapClear( map_ );
+    InvalidateTranslationCache();
+    SwapClear( translationQueue_ );
 }
 
 void DistMap::Resize( Int numSources )
@@ -221,6 +306,7 @@ void DistMap::Resize( Int numSources )
     const Int numLocalSources =
       Min(blocksize_,Max(numSources_-blocksize_*commRank,0));
     map_.resize( numLocalSources );
+    InvalidateTranslationCache();
 }
 
 const DistMap& DistMap::operator=( const DistMap& map )
@@ -229,9 +315,19 @@ const DistMap& DistMap::operator=( const DistMap& map )
     numSources_ = map.numSources_;
     SetGrid( map.Grid() );
     map_ = map.map_;
+    InvalidateTranslationCache();
     return *this;
 }
 
+void DistMap::InvalidateTranslationCache()
+{
+    EL_DEBUG_CSE
+    cacheValid_ = false;
+    cachedHash_ = 0;
+    SwapClear( cachedRequest_ );
+    SwapClear( cachedTranslation_ );
+}
+
 void InvertMap( const vector<Int>& map, vector<Int>& inverseMap )
 {
     EL_DEBUG_CSE
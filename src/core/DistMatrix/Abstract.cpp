@@ -41,7 +41,7 @@ EL_NO_EXCEPT
 { matrix_.ShallowSwap( A.matrix_ ); }
 
 template<typename T>
-AbstractDistMatrix<T>::~AbstractDistMatrix() { }
+AbstractDistMatrix<T>::~AbstractDistMatrix() { InvalidateProxyCache(); }
 
 // Assignment and reconfiguration
 // ==============================
@@ -49,6 +49,8 @@ template<typename T>
 void
 AbstractDistMatrix<T>::Empty( bool freeMemory )
 {
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
     matrix_.Empty_( freeMemory );
     viewType_ = OWNER;
     height_ = 0;
@@ -61,17 +63,21 @@ AbstractDistMatrix<T>::Empty( bool freeMemory )
     SetShifts();
 
     SwapClear( remoteUpdates );
+    accumulating_ = false;
 }
 
 template<typename T>
 void
 AbstractDistMatrix<T>::EmptyData( bool freeMemory )
 {
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
     matrix_.Empty_( freeMemory );
     viewType_ = OWNER;
     height_ = 0;
     width_ = 0;
     SwapClear( remoteUpdates );
+    accumulating_ = false;
 }
 
 template<typename T>
@@ -148,6 +154,66 @@ AbstractDistMatrix<T>::SetRoot( int root, bool constrain )
     SetShifts();
 }
 
+// Proxy caching
+// =============
+
+template<typename T>
+void
+AbstractDistMatrix<T>::EnableProxyCache() const EL_NO_EXCEPT
+{ proxyCacheEnabled_ = true; }
+
+template<typename T>
+void
+AbstractDistMatrix<T>::DisableProxyCache() const EL_NO_EXCEPT
+{
+    proxyCacheEnabled_ = false;
+    InvalidateProxyCache();
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::InvalidateProxyCache() const EL_NO_EXCEPT
+{
+    for( auto* replica : proxyCache_ )
+        delete replica;
+    SwapClear( proxyCache_ );
+}
+
+template<typename T>
+bool
+AbstractDistMatrix<T>::ProxyCacheEnabled() const EL_NO_EXCEPT
+{ return proxyCacheEnabled_; }
+
+template<typename T>
+AbstractDistMatrix<T>*
+AbstractDistMatrix<T>::SearchProxyCache
+( Dist colDist, Dist rowDist, DistWrap wrap,
+  bool colConstrain, int colAlign,
+  bool rowConstrain, int rowAlign,
+  bool rootConstrain, int root ) const
+{
+    EL_DEBUG_CSE
+    for( auto* replica : proxyCache_ )
+    {
+        if( replica->ColDist() == colDist &&
+            replica->RowDist() == rowDist &&
+            replica->Wrap() == wrap &&
+            (!colConstrain || replica->ColAlign() == colAlign) &&
+            (!rowConstrain || replica->RowAlign() == rowAlign) &&
+            (!rootConstrain || replica->Root() == root) )
+            return replica;
+    }
+    return nullptr;
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::DonateToProxyCache( type* replica ) const
+{
+    EL_DEBUG_CSE
+    proxyCache_.push_back( replica );
+}
+
 // Operator overloading
 // ====================
 
@@ -158,6 +224,10 @@ AbstractDistMatrix<T>&
 AbstractDistMatrix<T>::operator=( AbstractDistMatrix<T>&& A )
 {
     EL_DEBUG_CSE
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    if( A.proxyCacheEnabled_ )
+        A.InvalidateProxyCache();
     if( Viewing() || A.Viewing() )
     {
         El::Copy( A, *this );
@@ -229,7 +299,12 @@ Int AbstractDistMatrix<T>::LDim() const EL_NO_EXCEPT
 
 template<typename T>
 El::Matrix<T>&
-AbstractDistMatrix<T>::Matrix() EL_NO_EXCEPT { return matrix_; }
+AbstractDistMatrix<T>::Matrix() EL_NO_EXCEPT
+{
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    return matrix_;
+}
 template<typename T>
 const El::Matrix<T>&
 AbstractDistMatrix<T>::LockedMatrix() const EL_NO_EXCEPT { return matrix_; }
@@ -242,12 +317,20 @@ AbstractDistMatrix<T>::AllocatedMemory() const EL_NO_EXCEPT
 template<typename T>
 T*
 AbstractDistMatrix<T>::Buffer() EL_NO_RELEASE_EXCEPT
-{ return matrix_.Buffer(); }
+{
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    return matrix_.Buffer();
+}
 
 template<typename T>
 T*
 AbstractDistMatrix<T>::Buffer( Int iLoc, Int jLoc ) EL_NO_RELEASE_EXCEPT
-{ return matrix_.Buffer(iLoc,jLoc); }
+{
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    return matrix_.Buffer(iLoc,jLoc);
+}
 
 template<typename T>
 const T*
@@ -490,7 +573,9 @@ AbstractDistMatrix<T>::Update( Int i, Int j, T value )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    if( IsLocal(i,j) )
+    if( accumulating_ )
+        QueueUpdate( i, j, value );
+    else if( IsLocal(i,j) )
         UpdateLocal( LocalRow(i), LocalCol(j), value );
 }
 
@@ -579,6 +664,20 @@ void AbstractDistMatrix<T>::QueueUpdate( Int i, Int j, T value )
 EL_NO_RELEASE_EXCEPT
 { QueueUpdate( Entry<T>{i,j,value} ); }
 
+template<typename T>
+void AbstractDistMatrix<T>::QueueUpdateSubmatrix
+( Int iBeg, Int jBeg, T alpha, const El::Matrix<T>& ASub )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int mSub = ASub.Height();
+    const Int nSub = ASub.Width();
+    Reserve( mSub*nSub );
+    for( Int jSub=0; jSub<nSub; ++jSub )
+        for( Int iSub=0; iSub<mSub; ++iSub )
+            QueueUpdate( iBeg+iSub, jBeg+jSub, alpha*ASub(iSub,jSub) );
+}
+
 template<typename T>
 void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
 {
@@ -645,11 +744,53 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
     recvBuf.resize( recvBufSize );
     mpi::Broadcast
     ( recvBuf.data(), recvBufSize, redundantRoot, RedundantComm() );
-    // TODO: Make this loop faster
-    for( const auto& entry : recvBuf )
-        UpdateLocal( LocalRow(entry.i), LocalCol(entry.j), entry.value );
+    // Sort the received contributions into column-major order and merge
+    // duplicate indices so that each local entry is only touched once
+    std::sort
+    ( recvBuf.begin(), recvBuf.end(),
+      []( const Entry<T>& a, const Entry<T>& b )
+      { return a.j < b.j || (a.j == b.j && a.i < b.i); } );
+    for( Int k=0; k<recvBufSize; )
+    {
+        const Int i = recvBuf[k].i;
+        const Int j = recvBuf[k].j;
+        T value = recvBuf[k].value;
+        for( ++k; k<recvBufSize && recvBuf[k].i == i && recvBuf[k].j == j;
+             ++k )
+            value += recvBuf[k].value;
+        UpdateLocal( LocalRow(i), LocalCol(j), value );
+    }
+}
+
+template<typename T>
+void AbstractDistMatrix<T>::BeginAccumulation( Int numRemoteEntries )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( accumulating_ )
+          LogicError("An accumulation epoch was already open");
+    )
+    accumulating_ = true;
+    if( numRemoteEntries > 0 )
+        Reserve( numRemoteEntries );
 }
 
+template<typename T>
+void AbstractDistMatrix<T>::EndAccumulation( bool includeViewers )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !accumulating_ )
+          LogicError("No accumulation epoch was open");
+    )
+    accumulating_ = false;
+    ProcessQueues( includeViewers );
+}
+
+template<typename T>
+bool AbstractDistMatrix<T>::Accumulating() const EL_NO_EXCEPT
+{ return accumulating_; }
+
 template<typename T>
 void AbstractDistMatrix<T>::ReservePulls( Int numPulls ) const
 {
@@ -783,7 +924,11 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AbstractDistMatrix<T>::SetLocal( Int iLoc, Int jLoc, T alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.Set(iLoc,jLoc,alpha); }
+{
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    matrix_.Set(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void AbstractDistMatrix<T>::SetLocal( const Entry<T>& localEntry )
@@ -794,7 +939,11 @@ template<typename T>
 void
 AbstractDistMatrix<T>::SetLocalRealPart( Int iLoc, Int jLoc, Base<T> alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.SetRealPart(iLoc,jLoc,alpha); }
+{
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    matrix_.SetRealPart(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void
@@ -806,7 +955,11 @@ template<typename T>
 void AbstractDistMatrix<T>::SetLocalImagPart
 ( Int iLoc, Int jLoc, Base<T> alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.SetImagPart(iLoc,jLoc,alpha); }
+{
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    matrix_.SetImagPart(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void AbstractDistMatrix<T>::SetLocalImagPart
@@ -818,7 +971,11 @@ template<typename T>
 void
 AbstractDistMatrix<T>::UpdateLocal( Int iLoc, Int jLoc, T alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.Update(iLoc,jLoc,alpha); }
+{
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    matrix_.Update(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void
@@ -831,7 +988,11 @@ void
 AbstractDistMatrix<T>::UpdateLocalRealPart
 ( Int iLoc, Int jLoc, Base<T> alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.UpdateRealPart(iLoc,jLoc,alpha); }
+{
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    matrix_.UpdateRealPart(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void
@@ -843,7 +1004,11 @@ template<typename T>
 void AbstractDistMatrix<T>::UpdateLocalImagPart
 ( Int iLoc, Int jLoc, Base<T> alpha )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.UpdateImagPart(iLoc,jLoc,alpha); }
+{
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    matrix_.UpdateImagPart(iLoc,jLoc,alpha);
+}
 
 template<typename T>
 void AbstractDistMatrix<T>::UpdateLocalImagPart
@@ -855,13 +1020,21 @@ template<typename T>
 void
 AbstractDistMatrix<T>::MakeLocalReal( Int iLoc, Int jLoc )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.MakeReal( iLoc, jLoc ); }
+{
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    matrix_.MakeReal( iLoc, jLoc );
+}
 
 template<typename T>
 void
 AbstractDistMatrix<T>::ConjugateLocal( Int iLoc, Int jLoc )
 EL_NO_RELEASE_EXCEPT
-{ matrix_.Conjugate( iLoc, jLoc ); }
+{
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    matrix_.Conjugate( iLoc, jLoc );
+}
 
 template<typename T>
 void
@@ -965,6 +1138,10 @@ template<typename T>
 void
 AbstractDistMatrix<T>::ShallowSwap( AbstractDistMatrix<T>& A )
 {
+    if( proxyCacheEnabled_ )
+        InvalidateProxyCache();
+    if( A.proxyCacheEnabled_ )
+        A.InvalidateProxyCache();
     matrix_.ShallowSwap( A.matrix_ );
     std::swap( viewType_, A.viewType_ );
     std::swap( height_ , A.height_ );
@@ -206,6 +206,9 @@ void BlockMatrix<T>::Resize( Int height, Int width )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(this->AssertNotLocked())
+    if( this->proxyCacheEnabled_ &&
+        (height != this->height_ || width != this->width_) )
+        this->InvalidateProxyCache();
     this->height_ = height;
     this->width_ = width;
     if( this->Participating() )
@@ -218,6 +221,9 @@ void BlockMatrix<T>::Resize( Int height, Int width, Int ldim )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(this->AssertNotLocked())
+    if( this->proxyCacheEnabled_ &&
+        (height != this->height_ || width != this->width_) )
+        this->InvalidateProxyCache();
     this->height_ = height;
     this->width_ = width;
     if( this->Participating() )
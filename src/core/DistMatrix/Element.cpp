@@ -45,6 +45,9 @@ ElementalMatrix<T>::Resize( Int height, Int width )
       if( this->Viewing() && (height > this->height_ || width > this->width_) )
           LogicError("Tried to increase the size of a view");
     )
+    if( this->proxyCacheEnabled_ &&
+        (height != this->height_ || width != this->width_) )
+        this->InvalidateProxyCache();
     this->height_ = height;
     this->width_ = width;
     if( this->Participating() )
@@ -65,6 +68,9 @@ ElementalMatrix<T>::Resize( Int height, Int width, Int ldim )
            ldim > this->matrix_.LDim()) )
           LogicError("Tried to increase the size of a view");
     )
+    if( this->proxyCacheEnabled_ &&
+        (height != this->height_ || width != this->width_) )
+        this->InvalidateProxyCache();
     this->height_ = height;
     this->width_ = width;
     if( this->Participating() )
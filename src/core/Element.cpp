@@ -1477,6 +1477,20 @@ template<> BigFloat Floor( const BigFloat& alpha )
 }
 #endif
 
+// Fused multiply-add
+// ==================
+#ifdef EL_HAVE_MPC
+void FusedMultiplyAdd
+( const BigFloat& alpha, const BigFloat& beta, BigFloat& gamma )
+{
+    // MPFR permits the output of mpfr_fma to alias its addend
+    mpfr_fma
+    ( gamma.Pointer(),
+      alpha.LockedPointer(), beta.LockedPointer(), gamma.LockedPointer(),
+      mpfr::RoundingMode() );
+}
+#endif
+
 // Pi
 // ==
 #ifdef EL_HAVE_QD
@@ -9,6 +9,19 @@
 */
 #include <El-lite.hpp>
 
+#include <map>
+#include <memory>
+#include <tuple>
+
+namespace {
+
+// Process-wide cache of grids keyed on (parent communicator, height, order).
+// Entries are retained until El::Grid::ClearCache (called from El::Finalize)
+typedef std::tuple<MPI_Comm,int,int> GridKey;
+std::map<GridKey,std::unique_ptr<El::Grid>> gridCache;
+
+}
+
 namespace El {
 
 Grid* Grid::defaultGrid = 0;
@@ -17,13 +30,15 @@ Grid* Grid::trivialGrid = 0;
 void Grid::InitializeDefault()
 {
     EL_DEBUG_CSE
-    defaultGrid = new Grid( mpi::COMM_WORLD );
+    if( defaultGrid == 0 )
+        defaultGrid = new Grid( mpi::COMM_WORLD );
 }
 
 void Grid::InitializeTrivial()
 {
     EL_DEBUG_CSE
-    trivialGrid = new Grid( mpi::COMM_SELF );
+    if( trivialGrid == 0 )
+        trivialGrid = new Grid( mpi::COMM_SELF );
 }
 
 void Grid::FinalizeDefault()
@@ -43,24 +58,41 @@ void Grid::FinalizeTrivial()
 const Grid& Grid::Default() EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      if( defaultGrid == 0 )
-          LogicError
-          ("Attempted to return a non-existant default grid. Please ensure "
-           "that Elemental is initialized before creating a DistMatrix.");
-    )
+    // Construct the default grid on first use so that minimal initializations
+    // (which skip the eager COMM_WORLD duplication) still behave correctly
+    if( defaultGrid == 0 )
+        InitializeDefault();
     return *defaultGrid;
 }
 
+const Grid& Grid::FindOrCreate( mpi::Comm comm, GridOrder order )
+{
+    EL_DEBUG_CSE
+    return FindOrCreate( comm, DefaultHeight(mpi::Size(comm)), order );
+}
+
+const Grid& Grid::FindOrCreate( mpi::Comm comm, int height, GridOrder order )
+{
+    EL_DEBUG_CSE
+    const GridKey key( comm.comm, height, int(order) );
+    auto it = ::gridCache.find( key );
+    if( it == ::gridCache.end() )
+        it = ::gridCache.emplace
+          ( key, std::unique_ptr<Grid>(new Grid(comm,height,order)) ).first;
+    return *it->second;
+}
+
+void Grid::ClearCache()
+{
+    EL_DEBUG_CSE
+    ::gridCache.clear();
+}
+
 const Grid& Grid::Trivial() EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      if( trivialGrid == 0 )
-          LogicError
-          ("Attempted to return a non-existant trivial grid. Please ensure "
-           "that Elemental is initialized before creating a DistMatrix.");
-    )
+    if( trivialGrid == 0 )
+        InitializeTrivial();
     return *trivialGrid;
 }
 
@@ -76,6 +108,9 @@ Grid::Grid( mpi::Comm comm, GridOrder order )
 : haveViewers_(false), order_(order)
 {
     EL_DEBUG_CSE
+    // Grids imply distributed usage, so ensure that the custom MPI datatypes
+    // and reduction operators exist (a no-op after the first call)
+    mpi::CreateCustom();
 
     // Extract our rank, the underlying group, and the number of processes
     mpi::Dup( comm, viewingComm_ );
@@ -94,6 +129,7 @@ Grid::Grid( mpi::Comm comm, int height, GridOrder order )
 : haveViewers_(false), order_(order)
 {
     EL_DEBUG_CSE
+    mpi::CreateCustom();
 
     // Extract our rank, the underlying group, and the number of processes
     mpi::Dup( comm, viewingComm_ );
@@ -127,115 +163,83 @@ void Grid::SetUpGrid()
     // Create the communicator for the owning group (mpi::COMM_NULL otherwise)
     mpi::Create( viewingComm_, owningGroup_, owningComm_ );
 
-    vcToViewing_.resize(size_);
-    diagsAndRanks_.resize(2*size_);
-    MemZero( diagsAndRanks_.data(), 2*size_ );
+    // The per-distribution communicators are expensive to construct and are
+    // not needed until the grid actually communicates, so defer them until
+    // first use (see SetUpCommunicators)
+    setUpComms_ = false;
+    cartComm_   = mpi::COMM_NULL;
+    mcComm_     = mpi::COMM_NULL;
+    mrComm_     = mpi::COMM_NULL;
+    mdComm_     = mpi::COMM_NULL;
+    mdPerpComm_ = mpi::COMM_NULL;
+    vcComm_     = mpi::COMM_NULL;
+    vrComm_     = mpi::COMM_NULL;
+
+    // Our position within each process row, column, and diagonal follows
+    // directly from our rank within the owning group (the deferred cartesian
+    // communicator is created without reordering)
     const bool colMajor = (order_==COLUMN_MAJOR);
     if( InGrid() )
     {
-        // Create a cartesian communicator
-        // TODO: Allow for reordering and non-periodicity
-        int dims[2];
         if( colMajor )
         {
-            dims[0] = width;
-            dims[1] = height_;
+            mcRank_ = owningRank_ % height_;
+            mrRank_ = owningRank_ / height_;
         }
         else
         {
-            dims[0] = height_;
-            dims[1] = width;
+            mcRank_ = owningRank_ / width;
+            mrRank_ = owningRank_ % width;
         }
-        int periods[2] = { true, true };
-        bool reorder = false;
-        mpi::CartCreate( owningComm_, 2, dims, periods, reorder, cartComm_ );
-
-        // Set up the MatrixCol and MatrixRow communicators
-        int remainingDims[2];
-        remainingDims[0] = ( colMajor ? false : true  );
-        remainingDims[1] = ( colMajor ? true  : false );
-        mpi::CartSub( cartComm_, remainingDims, mcComm_ );
-        remainingDims[0] = ( colMajor ? true  : false );
-        remainingDims[1] = ( colMajor ? false : true  );
-        mpi::CartSub( cartComm_, remainingDims, mrComm_ );
-        mcRank_ = mpi::Rank( mcComm_ );
-        mrRank_ = mpi::Rank( mrComm_ );
-
-        // Set up the VectorCol and VectorRow communicators
         vcRank_ = mcRank_ + height_*mrRank_;
         vrRank_ = mrRank_ + width*mcRank_;
-        mpi::Split( cartComm_, 0, vcRank_, vcComm_ );
-        mpi::Split( cartComm_, 0, vrRank_, vrComm_ );
-
-        // Set up the map from the VC group to the viewingGroup_ ranks.
-        vector<int> ranks(size_);
-        for( int i=0; i<size_; ++i )
-            ranks[i] = i;
-        mpi::Translate
-        ( vcComm_, size_, ranks.data(), viewingGroup_,  vcToViewing_.data() );
-
-        // Compute which diagonal we're in, and what our rank is, then
-        // perform AllGather world to store everyone's info
-        vector<int> myDiagAndRank(2);
-        myDiagAndRank[0] = mdPerpRank_ = Mod(mrRank_-mcRank_,gcd_);
-        int diagRank = 0;
-        int row = 0;
-        int col = myDiagAndRank[0];
-        for( int j=0; j<lcm; ++j )
-        {
-            if( row == mcRank_ && col == mrRank_ )
-            {
-                myDiagAndRank[1] = mdRank_ = diagRank;
-                break;
-            }
-            else
-            {
-                row = (row + 1) % height_;
-                col = (col + 1) % width;
-                ++diagRank;
-            }
-        }
-        mpi::AllGather
-        ( myDiagAndRank.data(),  2,
-          diagsAndRanks_.data(), 2, vcComm_ );
-
-        mpi::Split( cartComm_, mdPerpRank_, mdRank_,     mdComm_     );
-        mpi::Split( cartComm_, mdRank_,     mdPerpRank_, mdPerpComm_ );
-
-        EL_DEBUG_ONLY(
-          mpi::ErrorHandlerSet( mcComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( mrComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( vcComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( vrComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( mdComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( mdPerpComm_, mpi::ERRORS_RETURN );
-        )
+        mdPerpRank_ = Mod(mrRank_-mcRank_,gcd_);
     }
     else
     {
-        mcComm_     = mpi::COMM_NULL;
-        mrComm_     = mpi::COMM_NULL;
-        mdComm_     = mpi::COMM_NULL;
-        mdPerpComm_ = mpi::COMM_NULL;
-        vcComm_     = mpi::COMM_NULL;
-        vrComm_     = mpi::COMM_NULL;
-
         mcRank_     = mpi::UNDEFINED;
         mrRank_     = mpi::UNDEFINED;
         mdRank_     = mpi::UNDEFINED;
         mdPerpRank_ = mpi::UNDEFINED;
         vcRank_     = mpi::UNDEFINED;
         vrRank_     = mpi::UNDEFINED;
+    }
 
-        // diags and ranks are implicitly set to undefined
+    // Every process (viewers included) can compute the entire diagonal
+    // decomposition without communication by walking each diagonal in turn
+    diagsAndRanks_.resize(2*size_);
+    for( int diag=0; diag<gcd_; ++diag )
+    {
+        int row = 0;
+        int col = diag;
+        for( int diagRank=0; diagRank<lcm; ++diagRank )
+        {
+            const int vcRank = row + col*height_;
+            diagsAndRanks_[2*vcRank]   = diag;
+            diagsAndRanks_[2*vcRank+1] = diagRank;
+            row = (row + 1) % height_;
+            col = (col + 1) % width;
+        }
     }
-    // Translate the rank of the root process of the owningGroup so that we can
-    // broadcast data
-    int owningRoot = mpi::Translate( owningGroup_, 0, viewingGroup_ );
-    mpi::Broadcast( vcToViewing_.data(), size_, owningRoot, viewingComm_ );
-    mpi::Broadcast( diagsAndRanks_.data(), 2*size_, owningRoot, viewingComm_ );
+    if( InGrid() )
+        mdRank_ = diagsAndRanks_[2*vcRank_+1];
+
+    // Set up the map from the VC ranks to the viewingGroup_ ranks, which is
+    // likewise a purely local computation
+    vector<int> owningRanks(size_);
+    for( int vcRank=0; vcRank<size_; ++vcRank )
+        owningRanks[vcRank] =
+          ( colMajor ? vcRank
+                     : (vcRank % height_)*width + (vcRank / height_) );
+    vcToViewing_.resize(size_);
+    mpi::Translate
+    ( owningGroup_, size_, owningRanks.data(),
+      viewingGroup_, vcToViewing_.data() );
 
 #ifdef EL_HAVE_SCALAPACK
+    // BLACS requires concrete communicator handles, so eagerly construct the
+    // communicator fleet when ScaLAPACK support is enabled
+    SetUpCommunicators();
     blacsVCHandle_ = blacs::Handle( vcComm_.comm );
     blacsVRHandle_ = blacs::Handle( vrComm_.comm );
     blacsMCMRContext_ =
@@ -244,8 +248,82 @@ void Grid::SetUpGrid()
 #endif
 }
 
+// Construct the cartesian communicator and its row, column, diagonal, and
+// vector subcommunicators. Since building thousands of short-lived subgrids
+// otherwise spends the majority of its time in MPI_Comm_split, this is
+// deferred until a communicator is first requested. The underlying MPI calls
+// are collective over the owning communicator, but the first communicator
+// access is logically collective anywhere the grid is used to communicate
+void Grid::SetUpCommunicators() const
+{
+    EL_DEBUG_CSE
+    if( setUpComms_ )
+        return;
+    setUpComms_ = true;
+    if( !inGrid_ )
+        return;
+
+    const int width = size_ / height_;
+    const bool colMajor = (order_==COLUMN_MAJOR);
+
+    // Create a cartesian communicator
+    // TODO: Allow for reordering and non-periodicity
+    int dims[2];
+    if( colMajor )
+    {
+        dims[0] = width;
+        dims[1] = height_;
+    }
+    else
+    {
+        dims[0] = height_;
+        dims[1] = width;
+    }
+    int periods[2] = { true, true };
+    bool reorder = false;
+    mpi::CartCreate( owningComm_, 2, dims, periods, reorder, cartComm_ );
+
+    // Set up the MatrixCol and MatrixRow communicators
+    int remainingDims[2];
+    remainingDims[0] = ( colMajor ? false : true  );
+    remainingDims[1] = ( colMajor ? true  : false );
+    mpi::CartSub( cartComm_, remainingDims, mcComm_ );
+    remainingDims[0] = ( colMajor ? true  : false );
+    remainingDims[1] = ( colMajor ? false : true  );
+    mpi::CartSub( cartComm_, remainingDims, mrComm_ );
+    EL_DEBUG_ONLY(
+      if( mpi::Rank(mcComm_) != mcRank_ || mpi::Rank(mrComm_) != mrRank_ )
+          LogicError("Cartesian communicator ranks did not match the Grid's");
+    )
+
+    // Set up the VectorCol and VectorRow communicators
+    mpi::Split( cartComm_, 0, vcRank_, vcComm_ );
+    mpi::Split( cartComm_, 0, vrRank_, vrComm_ );
+
+    // Pre-split the full grid communicator into its intra-node and
+    // inter-node pieces so that large collectives over it may be staged
+    // shared-memory-first
+    if( mpi::HierarchicalCollectivesEnabled() )
+        mpi::RegisterNodeSplit( vcComm_ );
+
+    mpi::Split( cartComm_, mdPerpRank_, mdRank_,     mdComm_     );
+    mpi::Split( cartComm_, mdRank_,     mdPerpRank_, mdPerpComm_ );
+
+    EL_DEBUG_ONLY(
+      mpi::ErrorHandlerSet( mcComm_,     mpi::ERRORS_RETURN );
+      mpi::ErrorHandlerSet( mrComm_,     mpi::ERRORS_RETURN );
+      mpi::ErrorHandlerSet( vcComm_,     mpi::ERRORS_RETURN );
+      mpi::ErrorHandlerSet( vrComm_,     mpi::ERRORS_RETURN );
+      mpi::ErrorHandlerSet( mdComm_,     mpi::ERRORS_RETURN );
+      mpi::ErrorHandlerSet( mdPerpComm_, mpi::ERRORS_RETURN );
+    )
+}
+
 Grid::~Grid()
 {
+    // Return any distributed temporaries cached against this grid
+    workspace_arena::FlushGrid( this );
+
     if( !mpi::Finalized() )
     {
 #ifdef EL_HAVE_SCALAPACK
@@ -255,13 +333,17 @@ Grid::~Grid()
 #endif
         if( InGrid() )
         {
-            mpi::Free( mdComm_ );
-            mpi::Free( mdPerpComm_ );
-            mpi::Free( mcComm_ );
-            mpi::Free( mrComm_ );
-            mpi::Free( vcComm_ );
-            mpi::Free( vrComm_ );
-            mpi::Free( cartComm_ );
+            if( setUpComms_ )
+            {
+                mpi::Free( mdComm_ );
+                mpi::Free( mdPerpComm_ );
+                mpi::Free( mcComm_ );
+                mpi::Free( mrComm_ );
+                mpi::FreeNodeSplit( vcComm_ );
+                mpi::Free( vcComm_ );
+                mpi::Free( vrComm_ );
+                mpi::Free( cartComm_ );
+            }
             mpi::Free( owningComm_ );
         }
         mpi::Free( viewingComm_ );
@@ -285,12 +367,18 @@ int Grid::MDPerpSize() const EL_NO_EXCEPT { return gcd_;          }
 int Grid::VCSize()     const EL_NO_EXCEPT { return size_;         }
 int Grid::VRSize()     const EL_NO_EXCEPT { return size_;         }
 
-mpi::Comm Grid::MCComm()     const EL_NO_EXCEPT { return mcComm_;     }
-mpi::Comm Grid::MRComm()     const EL_NO_EXCEPT { return mrComm_;     }
-mpi::Comm Grid::MDComm()     const EL_NO_EXCEPT { return mdComm_;     }
-mpi::Comm Grid::MDPerpComm() const EL_NO_EXCEPT { return mdPerpComm_; }
-mpi::Comm Grid::VCComm()     const EL_NO_EXCEPT { return vcComm_;     }
-mpi::Comm Grid::VRComm()     const EL_NO_EXCEPT { return vrComm_;     }
+mpi::Comm Grid::MCComm() const EL_NO_RELEASE_EXCEPT
+{ SetUpCommunicators(); return mcComm_;     }
+mpi::Comm Grid::MRComm() const EL_NO_RELEASE_EXCEPT
+{ SetUpCommunicators(); return mrComm_;     }
+mpi::Comm Grid::MDComm() const EL_NO_RELEASE_EXCEPT
+{ SetUpCommunicators(); return mdComm_;     }
+mpi::Comm Grid::MDPerpComm() const EL_NO_RELEASE_EXCEPT
+{ SetUpCommunicators(); return mdPerpComm_; }
+mpi::Comm Grid::VCComm() const EL_NO_RELEASE_EXCEPT
+{ SetUpCommunicators(); return vcComm_;     }
+mpi::Comm Grid::VRComm() const EL_NO_RELEASE_EXCEPT
+{ SetUpCommunicators(); return vrComm_;     }
 
 // Provided for simplicity, but redundant
 // ======================================
@@ -303,9 +391,9 @@ GridOrder Grid::Order() const EL_NO_EXCEPT { return order_; }
 
 int Grid::Row() const EL_NO_RELEASE_EXCEPT { return MCRank(); }
 int Grid::Col() const EL_NO_RELEASE_EXCEPT { return MRRank(); }
-mpi::Comm Grid::ColComm() const EL_NO_EXCEPT { return MCComm(); }
-mpi::Comm Grid::RowComm() const EL_NO_EXCEPT { return MRComm(); }
-mpi::Comm Grid::Comm() const EL_NO_EXCEPT
+mpi::Comm Grid::ColComm() const EL_NO_RELEASE_EXCEPT { return MCComm(); }
+mpi::Comm Grid::RowComm() const EL_NO_RELEASE_EXCEPT { return MRComm(); }
+mpi::Comm Grid::Comm() const EL_NO_RELEASE_EXCEPT
 { return ( order_==COLUMN_MAJOR ? VCComm() : VRComm() ); }
 
 // Advanced routines
@@ -316,6 +404,7 @@ Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
 : haveViewers_(true), order_(order)
 {
     EL_DEBUG_CSE
+    mpi::CreateCustom();
 
     // Extract our rank and the underlying group from the viewing comm
     mpi::Dup( viewers, viewingComm_ );
@@ -0,0 +1,475 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#ifdef __linux__
+# include <sys/mman.h>
+#endif
+
+namespace {
+
+using El::MemoryPoolStats;
+using El::NumaStats;
+
+// The pool hands out power-of-two-sized raw buffers so that temporaries of
+// similar (but not identical) size map onto the same size class
+std::atomic<bool> poolEnabled( false );
+std::mutex poolMutex;
+std::map<size_t,std::vector<void*>> freeBuffers;
+MemoryPoolStats poolStats;
+
+size_t SizeClass( size_t numBytes )
+{
+    size_t rounded = 64;
+    while( rounded < numBytes )
+        rounded <<= 1;
+    return rounded;
+}
+
+// The custom allocation backend (both pointers null unless installed);
+// the outstanding-buffer count guards against swapping the backend while
+// buffers it allocated are still waiting to be returned to it
+std::mutex backendMutex;
+El::MemoryAllocFunction backendAlloc = nullptr;
+El::MemoryFreeFunction backendFree = nullptr;
+size_t backendOutstanding = 0;
+
+// The process-wide NUMA placement policy and diagnostics
+std::atomic<int> numaPolicy( int(El::NUMA_DEFAULT) );
+std::atomic<bool> numaDiagnostics( false );
+std::mutex numaStatsMutex;
+NumaStats numaStats;
+
+// A conservative lower bound on the system page size; touching one byte
+// per 4 KiB interval faults every page of any larger granularity as well
+const size_t numaPageSize = 4096;
+
+// Per-tag allocation accounting: the process-wide counters are atomics,
+// but the hot path only updates the calling thread's deltas, which are
+// folded in once the flush threshold of traffic accumulates (allocations
+// at least as large as the threshold are folded in immediately, so the
+// recorded peaks cannot miss a large buffer)
+std::atomic<long long> tagBytesInUse[El::MEM_NUM_TAGS];
+std::atomic<long long> tagPeakBytesInUse[El::MEM_NUM_TAGS];
+
+const long long tagFlushThreshold = 1 << 20;
+
+struct ThreadTagDeltas
+{
+    long long deltas[El::MEM_NUM_TAGS] = {};
+    long long pending = 0; // unflushed traffic, in absolute bytes
+
+    void Flush()
+    {
+        for( int t=0; t<El::MEM_NUM_TAGS; ++t )
+        {
+            if( deltas[t] == 0 )
+                continue;
+            const long long inUse =
+              ::tagBytesInUse[t].fetch_add( deltas[t] ) + deltas[t];
+            deltas[t] = 0;
+            long long peak = ::tagPeakBytesInUse[t].load();
+            while( inUse > peak &&
+                   !::tagPeakBytesInUse[t].compare_exchange_weak
+                    ( peak, inUse ) )
+            { }
+        }
+        pending = 0;
+    }
+
+    ~ThreadTagDeltas() { Flush(); }
+};
+
+thread_local El::MemoryTagNS::MemoryTag currentMemoryTag =
+  El::MEM_TAG_MATRIX;
+thread_local ThreadTagDeltas threadTagDeltas;
+
+// The process-wide huge-page policy, plus a record of the mapped length of
+// every live huge-page buffer (mmap lengths are rounded up to the page
+// granularity, so munmap cannot recompute them from the request size alone
+// once the policy may have changed)
+std::atomic<int> hugePagePolicy( int(El::HUGE_PAGES_OFF) );
+std::mutex hugeMutex;
+std::map<void*,size_t> hugeMappings;
+
+#ifdef __linux__
+// Older kernel headers may lack the page-size encodings for MAP_HUGETLB
+# ifndef MAP_HUGE_SHIFT
+#  define MAP_HUGE_SHIFT 26
+# endif
+# ifndef MAP_HUGE_2MB
+#  define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+# endif
+# ifndef MAP_HUGE_1GB
+#  define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+# endif
+
+const size_t twoMiB = size_t(1) << 21;
+const size_t oneGiB = size_t(1) << 30;
+
+void* MapHugeBuffer
+( size_t numBytes, El::HugePagePolicy policy,
+  size_t& mappedBytes, const char*& how )
+{
+    void* buffer = MAP_FAILED;
+
+    // Explicitly reserved pages first, largest granularity first; each
+    // failure (e.g., an empty hugetlb pool) degrades to the next option
+    if( policy == El::HUGE_PAGES_1GB )
+    {
+        mappedBytes = ((numBytes+oneGiB-1)/oneGiB)*oneGiB;
+        buffer = mmap
+          ( nullptr, mappedBytes, PROT_READ|PROT_WRITE,
+            MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB|MAP_HUGE_1GB, -1, 0 );
+        how = "1GB";
+    }
+    if( buffer == MAP_FAILED &&
+        ( policy == El::HUGE_PAGES_1GB || policy == El::HUGE_PAGES_2MB ) )
+    {
+        mappedBytes = ((numBytes+twoMiB-1)/twoMiB)*twoMiB;
+        buffer = mmap
+          ( nullptr, mappedBytes, PROT_READ|PROT_WRITE,
+            MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB|MAP_HUGE_2MB, -1, 0 );
+        how = "2MB";
+    }
+    if( buffer == MAP_FAILED )
+    {
+        // Transparent huge pages: map a 2 MiB multiple and advise the
+        // kernel to back it with huge pages when it can
+        mappedBytes = ((numBytes+twoMiB-1)/twoMiB)*twoMiB;
+        buffer = mmap
+          ( nullptr, mappedBytes, PROT_READ|PROT_WRITE,
+            MAP_PRIVATE|MAP_ANONYMOUS, -1, 0 );
+        how = "transparent";
+# ifdef MADV_HUGEPAGE
+        if( buffer != MAP_FAILED )
+            madvise( buffer, mappedBytes, MADV_HUGEPAGE );
+# endif
+    }
+    return ( buffer == MAP_FAILED ? nullptr : buffer );
+}
+#endif // __linux__
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableMemoryPool()
+{ poolEnabled = true; }
+
+void DisableMemoryPool()
+{
+    poolEnabled = false;
+    FlushMemoryPool();
+}
+
+bool MemoryPoolEnabled() EL_NO_EXCEPT
+{ return poolEnabled; }
+
+void FlushMemoryPool()
+{
+    std::lock_guard<std::mutex> lock( poolMutex );
+    for( auto& sizeClass : freeBuffers )
+        for( void* buffer : sizeClass.second )
+            ::operator delete( buffer );
+    freeBuffers.clear();
+    poolStats.bytesPooled = 0;
+}
+
+MemoryPoolStats PoolMemoryStats()
+{
+    std::lock_guard<std::mutex> lock( poolMutex );
+    return poolStats;
+}
+
+void* AcquirePooledBuffer( size_t numBytes )
+{
+    const size_t sizeClass = SizeClass( numBytes );
+    void* buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock( poolMutex );
+        ++poolStats.numAcquires;
+        auto it = freeBuffers.find( sizeClass );
+        if( it != freeBuffers.end() && !it->second.empty() )
+        {
+            buffer = it->second.back();
+            it->second.pop_back();
+            ++poolStats.numHits;
+            poolStats.bytesPooled -= sizeClass;
+        }
+        poolStats.bytesInUse += sizeClass;
+        poolStats.peakBytesInUse =
+          std::max( poolStats.peakBytesInUse, poolStats.bytesInUse );
+    }
+    if( buffer == nullptr )
+        buffer = ::operator new( sizeClass );
+    return buffer;
+}
+
+void ReleasePooledBuffer( void* buffer, size_t numBytes )
+{
+    const size_t sizeClass = SizeClass( numBytes );
+    std::lock_guard<std::mutex> lock( poolMutex );
+    poolStats.bytesInUse -= sizeClass;
+    if( poolEnabled )
+    {
+        freeBuffers[sizeClass].push_back( buffer );
+        poolStats.bytesPooled += sizeClass;
+    }
+    else
+        ::operator delete( buffer );
+}
+
+void SetMemoryBackend
+( MemoryAllocFunction allocFunc, MemoryFreeFunction freeFunc )
+{
+    if( (allocFunc == nullptr) != (freeFunc == nullptr) )
+        LogicError
+        ("The allocation and free routines of a memory backend must be "
+         "installed together");
+    std::lock_guard<std::mutex> lock( ::backendMutex );
+    if( ::backendOutstanding != 0 )
+        LogicError
+        ("Attempted to change the memory backend while ",
+         ::backendOutstanding," of its buffers were still alive");
+    ::backendAlloc = allocFunc;
+    ::backendFree = freeFunc;
+}
+
+void ClearMemoryBackend()
+{ SetMemoryBackend( nullptr, nullptr ); }
+
+bool MemoryBackendSet() EL_NO_EXCEPT
+{ return ::backendAlloc != nullptr; }
+
+void* AcquireBackendBuffer( size_t numBytes )
+{
+    std::lock_guard<std::mutex> lock( ::backendMutex );
+    if( ::backendAlloc == nullptr )
+        LogicError("No memory backend is installed");
+    void* buffer = ::backendAlloc( numBytes );
+    if( buffer == nullptr && numBytes != 0 )
+        throw std::bad_alloc();
+    ++::backendOutstanding;
+    return buffer;
+}
+
+void ReleaseBackendBuffer( void* buffer, size_t numBytes )
+{
+    std::lock_guard<std::mutex> lock( ::backendMutex );
+    ::backendFree( buffer, numBytes );
+    --::backendOutstanding;
+}
+
+void SetHugePagePolicy( HugePagePolicy policy ) EL_NO_EXCEPT
+{ ::hugePagePolicy = int(policy); }
+
+HugePagePolicy CurrentHugePagePolicy() EL_NO_EXCEPT
+{ return HugePagePolicy(int(::hugePagePolicy)); }
+
+void* AcquireHugeBuffer( size_t numBytes, HugePagePolicy policy )
+{
+    if( policy == HUGE_PAGES_INHERIT )
+        policy = CurrentHugePagePolicy();
+    if( policy == HUGE_PAGES_OFF || numBytes == 0 )
+        return nullptr;
+#ifdef __linux__
+    size_t mappedBytes = 0;
+    const char* how = "";
+    void* buffer = ::MapHugeBuffer( numBytes, policy, mappedBytes, how );
+    if( ShouldLog(1) )
+    {
+        if( buffer != nullptr )
+            Log
+            ("Huge pages: mapped ",numBytes," bytes (",mappedBytes,
+             " reserved) with ",how," pages");
+        else
+            Log
+            ("Huge pages: request for ",numBytes,
+             " bytes fell back to the standard allocator");
+    }
+    if( buffer != nullptr )
+    {
+        std::lock_guard<std::mutex> lock( ::hugeMutex );
+        ::hugeMappings[buffer] = mappedBytes;
+    }
+    return buffer;
+#else
+    // No huge-page support on this platform; fall back silently
+    return nullptr;
+#endif
+}
+
+void ReleaseHugeBuffer( void* buffer, size_t numBytes )
+{
+#ifdef __linux__
+    size_t mappedBytes = 0;
+    {
+        std::lock_guard<std::mutex> lock( ::hugeMutex );
+        auto it = ::hugeMappings.find( buffer );
+        if( it == ::hugeMappings.end() )
+            LogicError("Attempted to unmap an unknown huge-page buffer");
+        mappedBytes = it->second;
+        ::hugeMappings.erase( it );
+    }
+    munmap( buffer, mappedBytes );
+#else
+    LogicError("Huge-page buffers are not supported on this platform");
+#endif
+}
+
+MemoryTagScope::MemoryTagScope( MemoryTag tag )
+: previous_(::currentMemoryTag)
+{ ::currentMemoryTag = tag; }
+
+MemoryTagScope::~MemoryTagScope()
+{ ::currentMemoryTag = previous_; }
+
+MemoryTag CurrentMemoryTag() EL_NO_EXCEPT
+{ return ::currentMemoryTag; }
+
+const char* MemoryTagString( MemoryTag tag ) EL_NO_EXCEPT
+{
+    switch( tag )
+    {
+    case MEM_TAG_MATRIX:        return "matrix local storage";
+    case MEM_TAG_SPARSE_FACTOR: return "sparse factor storage";
+    case MEM_TAG_STAGING:       return "staging buffers";
+    default:                    return "unknown";
+    }
+}
+
+void RecordTaggedAllocation( MemoryTag tag, size_t numBytes )
+{
+    if( numBytes == 0 )
+        return;
+    auto& deltas = ::threadTagDeltas;
+    deltas.deltas[tag] += (long long)numBytes;
+    deltas.pending += (long long)numBytes;
+    if( deltas.pending >= ::tagFlushThreshold )
+        deltas.Flush();
+}
+
+void RecordTaggedRelease( MemoryTag tag, size_t numBytes )
+{
+    if( numBytes == 0 )
+        return;
+    auto& deltas = ::threadTagDeltas;
+    deltas.deltas[tag] -= (long long)numBytes;
+    deltas.pending += (long long)numBytes;
+    if( deltas.pending >= ::tagFlushThreshold )
+        deltas.Flush();
+}
+
+MemoryTagStats TaggedMemoryStats( MemoryTag tag )
+{
+    // Only the calling thread's deltas can be folded in safely, so the
+    // counters lag other threads by at most their unflushed traffic
+    ::threadTagDeltas.Flush();
+    MemoryTagStats stats;
+    const long long inUse = ::tagBytesInUse[tag].load();
+    const long long peak = ::tagPeakBytesInUse[tag].load();
+    stats.bytesInUse = size_t(Max( inUse, (long long)0 ));
+    stats.peakBytesInUse = size_t(Max( peak, (long long)0 ));
+    return stats;
+}
+
+void ReportMemoryHighWater()
+{
+    if( !ShouldLog(1) )
+        return;
+    ::threadTagDeltas.Flush();
+    ostringstream os;
+    os << "Memory high-water marks:";
+    for( int t=0; t<MEM_NUM_TAGS; ++t )
+    {
+        const MemoryTag tag = MemoryTag(t);
+        const auto stats = TaggedMemoryStats( tag );
+        os << "\n  " << MemoryTagString(tag) << ": peak="
+           << stats.peakBytesInUse << " bytes ("
+           << double(stats.peakBytesInUse)/double(1<<20) << " MiB)"
+           << ", still in use=" << stats.bytesInUse << " bytes";
+    }
+    WriteLog( os.str() );
+}
+
+void SetNumaPolicy( NumaPolicy policy ) EL_NO_EXCEPT
+{ ::numaPolicy = int(policy); }
+
+NumaPolicy CurrentNumaPolicy() EL_NO_EXCEPT
+{ return NumaPolicy(int(::numaPolicy)); }
+
+void EnableNumaDiagnostics()
+{ ::numaDiagnostics = true; }
+
+void DisableNumaDiagnostics()
+{ ::numaDiagnostics = false; }
+
+bool NumaDiagnosticsEnabled() EL_NO_EXCEPT
+{ return ::numaDiagnostics; }
+
+NumaStats NumaPlacementStats()
+{
+    std::lock_guard<std::mutex> lock( ::numaStatsMutex );
+    return ::numaStats;
+}
+
+void ApplyNumaPolicy( void* buffer, size_t numBytes, NumaPolicy policy )
+{
+    if( policy == NUMA_INHERIT )
+        policy = CurrentNumaPolicy();
+    if( policy == NUMA_DEFAULT || buffer == nullptr || numBytes == 0 )
+        return;
+
+    unsigned char* bytes = static_cast<unsigned char*>( buffer );
+    const size_t numPages = (numBytes+::numaPageSize-1) / ::numaPageSize;
+    if( policy == NUMA_FIRST_TOUCH )
+    {
+        // Each thread faults a contiguous chunk of pages onto its socket
+#ifdef EL_HYBRID
+        #pragma omp parallel for schedule(static)
+#endif
+        for( size_t page=0; page<numPages; ++page )
+            bytes[page*::numaPageSize] = 0;
+    }
+    else // policy == NUMA_INTERLEAVE
+    {
+        // Consecutive pages fault from alternating threads, spreading the
+        // buffer over the sockets' memory controllers
+#ifdef EL_HYBRID
+        #pragma omp parallel for schedule(static,1)
+#endif
+        for( size_t page=0; page<numPages; ++page )
+            bytes[page*::numaPageSize] = 0;
+    }
+
+    if( ::numaDiagnostics )
+    {
+        int numThreads = 1;
+#ifdef EL_HYBRID
+        numThreads = omp_get_max_threads();
+#endif
+        {
+            std::lock_guard<std::mutex> lock( ::numaStatsMutex );
+            ++::numaStats.numPlacements;
+            ::numaStats.numPagesTouched += numPages;
+            ::numaStats.bytesPlaced += numBytes;
+        }
+        Log
+        ("NUMA: placed ",numBytes," bytes (",numPages," pages) with ",
+         policy==NUMA_FIRST_TOUCH ? "first-touch" : "interleaved",
+         " policy over ",numThreads," threads");
+    }
+}
+
+} // namespace El
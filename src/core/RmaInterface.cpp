@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+template<typename T>
+RmaInterface<T>::RmaInterface() { }
+
+template<typename T>
+RmaInterface<T>::~RmaInterface()
+{
+    if( attached_ )
+        Detach();
+}
+
+template<typename T>
+void RmaInterface<T>::Attach( ElementalMatrix<T>& Z )
+{
+    EL_DEBUG_CSE
+    if( attached_ )
+        LogicError("Must detach before reattaching");
+    if( Z.RedundantSize() != 1 || Z.CrossSize() != 1 )
+        LogicError
+        ("One-sided access to redundantly stored matrices is not supported");
+    Z_ = &Z;
+
+    // Gather the leading dimension of every process's local buffer so that
+    // remote offsets can later be computed without communication
+    const int distSize = mpi::Size( Z.DistComm() );
+    const Int localLDim = Z.LDim();
+    localLDims_.resize( distSize );
+    mpi::AllGather( &localLDim, 1, localLDims_.data(), 1, Z.DistComm() );
+
+    const size_t numBytes =
+      size_t(Z.LDim())*size_t(Z.LocalWidth())*sizeof(T);
+    mpi::WindowCreate( Z.Buffer(), numBytes, Z.DistComm(), window_ );
+    attached_ = true;
+}
+
+template<typename T>
+void RmaInterface<T>::Detach()
+{
+    EL_DEBUG_CSE
+    if( !attached_ )
+        LogicError("Must attach before detaching");
+    // Complete any operations queued since the last explicit Flush
+    Flush();
+    mpi::WindowFree( window_ );
+    attached_ = false;
+    Z_ = nullptr;
+    SwapClear( localLDims_ );
+    SwapClear( getQueue_ );
+    SwapClear( accumulateQueue_ );
+}
+
+template<typename T>
+void RmaInterface<T>::QueueGet( Int i, Int j, T* value )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !attached_ )
+          LogicError("Must attach before queueing operations");
+      if( i < 0 || i >= Z_->Height() || j < 0 || j >= Z_->Width() )
+          LogicError("Queued read of out-of-bounds entry (",i,",",j,")");
+    )
+    const int target = Z_->Owner( i, j );
+    getQueue_.push_back( GetRequest{ target, Offset(i,j,target), value } );
+}
+
+template<typename T>
+void RmaInterface<T>::QueueAccumulate( Int i, Int j, T value )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !attached_ )
+          LogicError("Must attach before queueing operations");
+      if( i < 0 || i >= Z_->Height() || j < 0 || j >= Z_->Width() )
+          LogicError("Queued update of out-of-bounds entry (",i,",",j,")");
+    )
+    const int target = Z_->Owner( i, j );
+    accumulateQueue_.push_back
+    ( AccumulateRequest{ target, Offset(i,j,target), value } );
+}
+
+template<typename T>
+void RmaInterface<T>::Flush()
+{
+    EL_DEBUG_CSE
+    if( !attached_ )
+        LogicError("Must attach before flushing");
+
+    // Sort each queue by target so that all of the operations aimed at a
+    // given process can be issued within a single access epoch
+    auto targetLess =
+      []( const AccumulateRequest& a, const AccumulateRequest& b )
+      { return a.target < b.target; };
+    std::sort( accumulateQueue_.begin(), accumulateQueue_.end(), targetLess );
+    auto getTargetLess =
+      []( const GetRequest& a, const GetRequest& b )
+      { return a.target < b.target; };
+    std::sort( getQueue_.begin(), getQueue_.end(), getTargetLess );
+
+    const Int numAccum = accumulateQueue_.size();
+    Int k = 0;
+    while( k < numAccum )
+    {
+        const int target = accumulateQueue_[k].target;
+        mpi::WindowLock( target, window_ );
+        for( ; k<numAccum && accumulateQueue_[k].target==target; ++k )
+            mpi::Accumulate
+            ( &accumulateQueue_[k].value, 1,
+              target, accumulateQueue_[k].offset, window_ );
+        mpi::WindowUnlock( target, window_ );
+    }
+    accumulateQueue_.clear();
+
+    const Int numGets = getQueue_.size();
+    k = 0;
+    while( k < numGets )
+    {
+        const int target = getQueue_[k].target;
+        mpi::WindowLock( target, window_ );
+        for( ; k<numGets && getQueue_[k].target==target; ++k )
+            mpi::Get
+            ( getQueue_[k].value, 1,
+              target, getQueue_[k].offset, window_ );
+        mpi::WindowUnlock( target, window_ );
+    }
+    getQueue_.clear();
+}
+
+template<typename T>
+mpi::Aint RmaInterface<T>::Offset( Int i, Int j, int target ) const
+{
+    // The target's local indices follow from its column and row shifts
+    // being congruent to i and j modulo the respective strides
+    return mpi::Aint(i / Z_->ColStride()) +
+           mpi::Aint(j / Z_->RowStride())*mpi::Aint(localLDims_[target]);
+}
+
+#define PROTO(T) template class RmaInterface<T>;
+
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -19,10 +19,21 @@ bool elemInitializedMpi = false;
 
 El::Args* args = 0;
 
+bool matrixCopyOnWrite = false;
+
 }
 
 namespace El {
 
+void EnableMatrixCopyOnWrite() EL_NO_EXCEPT
+{ ::matrixCopyOnWrite = true; }
+
+void DisableMatrixCopyOnWrite() EL_NO_EXCEPT
+{ ::matrixCopyOnWrite = false; }
+
+bool MatrixCopyOnWriteEnabled() EL_NO_EXCEPT
+{ return ::matrixCopyOnWrite; }
+
 void PrintVersion( ostream& os )
 {
     os << "Elemental version information:\n"
@@ -174,17 +185,77 @@ void Initialize( int& argc, char**& argv )
 #endif
     }
 
+    // Opt into a minimal initialization for short-lived (typically
+    // sequential) processes: the default/trivial grids, the custom MPI
+    // datatypes and reduction operators, and the GPU probe are deferred
+    // until first use rather than paid at every launch
+    const char* minimalInit = std::getenv( "EL_MINIMAL_INIT" );
+    const bool minimal =
+      ( minimalInit != nullptr && std::atoi(minimalInit) != 0 );
+
 #ifdef EL_HAVE_QT5
     InitializeQt5( argc, argv );
 #endif
 
+#ifdef EL_HAVE_CUDA
+    // Probe for a CUDA device and honor the EL_GPU_FRONTS opt-in
+    if( !minimal )
+        gpu::Initialize();
+#endif
+
     // Queue a default algorithmic blocksize
     EmptyBlocksizeStack();
     PushBlocksizeStack( 128 );
 
-    // Build the default grid
-    Grid::InitializeDefault();
-    Grid::InitializeTrivial();
+    // Load any requested per-routine blocksize tuning profile
+    const char* tuningProfile = std::getenv( "EL_TUNING_PROFILE" );
+    if( tuningProfile != nullptr )
+        LoadTuningProfile( tuningProfile );
+
+    // Opt into the always-compiled communication/BLAS event tracer
+    const char* traceEnv = std::getenv( "EL_TRACE" );
+    if( traceEnv != nullptr && std::atoi(traceEnv) != 0 )
+    {
+        const char* traceCapacity = std::getenv( "EL_TRACE_CAPACITY" );
+        trace::Enable
+        ( traceCapacity != nullptr ? Int(std::atol(traceCapacity)) : Int(0) );
+    }
+
+    // Opt into the release-mode sampling profiler
+    const char* profileEnv = std::getenv( "EL_PROFILE" );
+    if( profileEnv != nullptr && std::atoi(profileEnv) != 0 )
+    {
+        const char* profileHz = std::getenv( "EL_PROFILE_HZ" );
+        prof::Enable
+        ( profileHz != nullptr ? Int(std::atoi(profileHz)) : Int(0) );
+    }
+
+    // Opt into huge-page backing for large local buffers
+    const char* hugePages = std::getenv( "EL_HUGE_PAGES" );
+    if( hugePages != nullptr )
+    {
+        const string pageChoice( hugePages );
+        if( pageChoice == "2MB" || pageChoice == "2mb" )
+            SetHugePagePolicy( HUGE_PAGES_2MB );
+        else if( pageChoice == "1GB" || pageChoice == "1gb" )
+            SetHugePagePolicy( HUGE_PAGES_1GB );
+        else if( std::atoi(hugePages) != 0 )
+            SetHugePagePolicy( HUGE_PAGES_TRANSPARENT );
+    }
+
+    // Opt into node-aware staging of large collectives (this must happen
+    // before the default grid is built so that its communicators are split)
+    const char* hierCollectives = std::getenv( "EL_HIERARCHICAL_COLLECTIVES" );
+    if( hierCollectives != nullptr && std::atoi(hierCollectives) != 0 )
+        mpi::EnableHierarchicalCollectives();
+
+    // Build the default grid (Grid::Default and Grid::Trivial construct
+    // these lazily when a minimal initialization deferred them)
+    if( !minimal )
+    {
+        Grid::InitializeDefault();
+        Grid::InitializeTrivial();
+    }
 
 #ifdef EL_HAVE_QD
     InitializeQD();
@@ -194,7 +265,10 @@ void Initialize( int& argc, char**& argv )
 
     // Create the types and ops.
     // mpfr::SetPrecision within InitializeRandom created the BigFloat types
-    mpi::CreateCustom();
+    // (a minimal initialization defers this to the first Grid construction,
+    // which happens after InitializeRandom and so preserves that ordering)
+    if( !minimal )
+        mpi::CreateCustom();
 }
 
 void Finalize()
@@ -214,6 +288,11 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        // The progress thread (should one exist) must be reaped before any
+        // of the MPI teardown below
+        mpi::StopProgressEngine();
+
+        Grid::ClearCache();
         Grid::FinalizeDefault();
         Grid::FinalizeTrivial();
 
@@ -223,6 +302,27 @@ void Finalize()
 #ifdef EL_HAVE_QT5
         FinalizeQt5();
 #endif
+#ifdef EL_HAVE_CUDA
+        gpu::Finalize();
+#endif
+        // Flush any recorded trace events while the rank is still queryable
+        if( trace::Enabled() )
+        {
+            trace::Dump();
+            trace::Disable();
+        }
+
+        // Likewise for the per-routine sampling histogram
+        if( prof::Enabled() )
+        {
+            prof::Disable();
+            prof::Dump();
+        }
+
+        // Report the per-tag allocation high-water marks while the logging
+        // layer can still query the rank
+        ReportMemoryHighWater();
+
         if( ::elemInitializedMpi )
             mpi::Finalize();
 
@@ -12,6 +12,9 @@ using El::BlasInt;
 using El::scomplex;
 using El::dcomplex;
 
+// Error-free-transformation kernels for double-double arithmetic
+#include "./blas/QDKernels.hpp"
+
 // Level 1
 #include "./blas/Axpy.hpp"
 #include "./blas/Copy.hpp"
@@ -23,6 +26,7 @@ using El::dcomplex;
 #include "./blas/Swap.hpp"
 
 // Level 2
+#include "./blas/Gbmv.hpp"
 #include "./blas/Gemv.hpp"
 #include "./blas/Ger.hpp"
 #include "./blas/Symv.hpp"
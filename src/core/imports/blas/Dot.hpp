@@ -58,10 +58,26 @@ template dcomplex Dot
   const dcomplex* x, BlasInt incx,
   const dcomplex* y, BlasInt incy );
 #ifdef EL_HAVE_QD
-template DoubleDouble Dot
-( BlasInt n,
-  const DoubleDouble* x, BlasInt incx, 
-  const DoubleDouble* y, BlasInt incy );
+// The double-double case routes through the error-free-transformation
+// kernels of QDKernels.hpp so that the unit-stride reduction is
+// straight-line double arithmetic which the compiler can vectorize
+template<>
+DoubleDouble Dot
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy )
+{
+    DoubleDouble alpha = 0;
+    if( incx == 1 && incy == 1 )
+        dd::DotKernel( n, x, y, alpha.x[0], alpha.x[1] );
+    else
+        for( BlasInt i=0; i<n; ++i )
+            dd::MultiplyAdd
+            ( x[i*incx].x[0], x[i*incx].x[1],
+              y[i*incy].x[0], y[i*incy].x[1],
+              alpha.x[0], alpha.x[1] );
+    return alpha;
+}
 template QuadDouble Dot
 ( BlasInt n,
   const QuadDouble* x, BlasInt incx, 
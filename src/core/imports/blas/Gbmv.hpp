@@ -0,0 +1,229 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+extern "C" {
+
+void EL_BLAS(sgbmv)
+( const char* trans, const BlasInt* m, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku,
+  const float* alpha, const float* AB, const BlasInt* ALDim,
+                      const float* x, const BlasInt* incx,
+  const float* beta,        float* y, const BlasInt* incy );
+void EL_BLAS(dgbmv)
+( const char* trans, const BlasInt* m, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku,
+  const double* alpha, const double* AB, const BlasInt* ALDim,
+                       const double* x, const BlasInt* incx,
+  const double* beta,        double* y, const BlasInt* incy );
+void EL_BLAS(cgbmv)
+( const char* trans, const BlasInt* m, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku,
+  const scomplex* alpha,
+  const scomplex* AB, const BlasInt* ALDim,
+  const scomplex* x, const BlasInt* incx,
+  const scomplex* beta,
+        scomplex* y, const BlasInt* incy );
+void EL_BLAS(zgbmv)
+( const char* trans, const BlasInt* m, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku,
+  const dcomplex* alpha,
+  const dcomplex* AB, const BlasInt* ALDim,
+  const dcomplex* x, const BlasInt* incx,
+  const dcomplex* beta,
+        dcomplex* y, const BlasInt* incy );
+
+} // extern "C"
+
+namespace El {
+namespace blas {
+
+// AB is stored in the standard LAPACK band layout: entry (i,j) of the
+// underlying m x n matrix resides in AB[ku+i-j+j*ALDim] whenever
+// j-ku <= i <= j+kl
+template<typename T>
+void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const T& alpha,
+  const T* AB, BlasInt ALDim,
+  const T* x, BlasInt incx,
+  const T& beta,
+        T* y, BlasInt incy )
+{
+    // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
+    //       involves a memory allocation
+    T gamma, delta;
+    if( std::toupper(trans) == 'N' )
+    {
+        Scal( m, beta, y, incy );
+        for( BlasInt j=0; j<n; ++j )
+        {
+            gamma = x[j*incx];
+            gamma *= alpha;
+            const BlasInt iBeg = Max( j-ku, BlasInt(0) );
+            const BlasInt iEnd = Min( j+kl+1, m );
+            for( BlasInt i=iBeg; i<iEnd; ++i )
+            {
+                // y[i*incy] += alpha*AB[ku+i-j+j*ALDim]*x[j*incx];
+                delta = AB[ku+i-j+j*ALDim];
+                delta *= gamma;
+                y[i*incy] += delta;
+            }
+        }
+    }
+    else
+    {
+        const bool conjugate = ( std::toupper(trans) == 'C' );
+        Scal( n, beta, y, incy );
+        for( BlasInt j=0; j<n; ++j )
+        {
+            const BlasInt iBeg = Max( j-ku, BlasInt(0) );
+            const BlasInt iEnd = Min( j+kl+1, m );
+            for( BlasInt i=iBeg; i<iEnd; ++i )
+            {
+                // y[j*incy] += alpha*op(AB[ku+i-j+j*ALDim])*x[i*incx];
+                if( conjugate )
+                    Conj( AB[ku+i-j+j*ALDim], gamma );
+                else
+                    gamma = AB[ku+i-j+j*ALDim];
+                gamma *= x[i*incx];
+                gamma *= alpha;
+                y[j*incy] += gamma;
+            }
+        }
+    }
+}
+template void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const Int& alpha,
+  const Int* AB, BlasInt ALDim,
+  const Int* x, BlasInt incx,
+  const Int& beta,
+        Int* y, BlasInt incy );
+#ifdef EL_HAVE_QD
+template void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const DoubleDouble& alpha,
+  const DoubleDouble* AB, BlasInt ALDim,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy );
+template void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const QuadDouble& alpha,
+  const QuadDouble* AB, BlasInt ALDim,
+  const QuadDouble* x, BlasInt incx,
+  const QuadDouble& beta,
+        QuadDouble* y, BlasInt incy );
+template void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const Complex<DoubleDouble>& alpha,
+  const Complex<DoubleDouble>* AB, BlasInt ALDim,
+  const Complex<DoubleDouble>* x, BlasInt incx,
+  const Complex<DoubleDouble>& beta,
+        Complex<DoubleDouble>* y, BlasInt incy );
+template void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const Complex<QuadDouble>& alpha,
+  const Complex<QuadDouble>* AB, BlasInt ALDim,
+  const Complex<QuadDouble>* x, BlasInt incx,
+  const Complex<QuadDouble>& beta,
+        Complex<QuadDouble>* y, BlasInt incy );
+#endif
+#ifdef EL_HAVE_QUAD
+template void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const Quad& alpha,
+  const Quad* AB, BlasInt ALDim,
+  const Quad* x, BlasInt incx,
+  const Quad& beta,
+        Quad* y, BlasInt incy );
+template void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* AB, BlasInt ALDim,
+  const Complex<Quad>* x, BlasInt incx,
+  const Complex<Quad>& beta,
+        Complex<Quad>* y, BlasInt incy );
+#endif
+#ifdef EL_HAVE_MPC
+template void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const BigInt& alpha,
+  const BigInt* AB, BlasInt ALDim,
+  const BigInt* x, BlasInt incx,
+  const BigInt& beta,
+        BigInt* y, BlasInt incy );
+template void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const BigFloat& alpha,
+  const BigFloat* AB, BlasInt ALDim,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat& beta,
+        BigFloat* y, BlasInt incy );
+template void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const Complex<BigFloat>& alpha,
+  const Complex<BigFloat>* AB, BlasInt ALDim,
+  const Complex<BigFloat>* x, BlasInt incx,
+  const Complex<BigFloat>& beta,
+        Complex<BigFloat>* y, BlasInt incy );
+#endif
+
+void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const float& alpha,
+  const float* AB, BlasInt ALDim,
+  const float* x, BlasInt incx,
+  const float& beta,
+        float* y, BlasInt incy )
+{
+    const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    EL_BLAS(sgbmv)
+    ( &fixedTrans, &m, &n, &kl, &ku,
+      &alpha, AB, &ALDim, x, &incx, &beta, y, &incy );
+}
+
+void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const double& alpha,
+  const double* AB, BlasInt ALDim,
+  const double* x, BlasInt incx,
+  const double& beta,
+        double* y, BlasInt incy )
+{
+    const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    EL_BLAS(dgbmv)
+    ( &fixedTrans, &m, &n, &kl, &ku,
+      &alpha, AB, &ALDim, x, &incx, &beta, y, &incy );
+}
+
+void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const scomplex& alpha,
+  const scomplex* AB, BlasInt ALDim,
+  const scomplex* x, BlasInt incx,
+  const scomplex& beta,
+        scomplex* y, BlasInt incy )
+{ EL_BLAS(cgbmv)
+  ( &trans, &m, &n, &kl, &ku,
+    &alpha, AB, &ALDim, x, &incx, &beta, y, &incy ); }
+
+void Gbmv
+( char trans, BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  const dcomplex& alpha,
+  const dcomplex* AB, BlasInt ALDim,
+  const dcomplex* x, BlasInt incx,
+  const dcomplex& beta,
+        dcomplex* y, BlasInt incy )
+{ EL_BLAS(zgbmv)
+  ( &trans, &m, &n, &kl, &ku,
+    &alpha, AB, &ALDim, x, &incx, &beta, y, &incy ); }
+
+} // namespace blas
+} // namespace El
@@ -262,21 +262,98 @@ void Gemm
 }
 template void Gemm
 ( char transA, char transB,
-  BlasInt m, BlasInt n, BlasInt k, 
+  BlasInt m, BlasInt n, BlasInt k,
   const Int& alpha,
   const Int* A, BlasInt ALDim,
   const Int* B, BlasInt BLDim,
   const Int& beta,
         Int* C, BlasInt CLDim );
 #ifdef EL_HAVE_QD
-template void Gemm
+// The double-double case routes through the error-free-transformation
+// kernels of QDKernels.hpp so that the inner loops are straight-line double
+// arithmetic which the compiler can vectorize rather than per-element
+// dd_real operator calls (the remaining extended-precision types stay on
+// the generic implementation above)
+template<>
+void Gemm
 ( char transA, char transB,
-  BlasInt m, BlasInt n, BlasInt k, 
+  BlasInt m, BlasInt n, BlasInt k,
   const DoubleDouble& alpha,
   const DoubleDouble* A, BlasInt ALDim,
   const DoubleDouble* B, BlasInt BLDim,
   const DoubleDouble& beta,
-        DoubleDouble* C, BlasInt CLDim );
+        DoubleDouble* C, BlasInt CLDim )
+{
+    // Scale C
+    if( beta == DoubleDouble(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != DoubleDouble(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+    if( m == 0 || n == 0 || k == 0 )
+        return;
+
+    // Since DoubleDouble is real, 'C' and 'T' requests coincide
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    DoubleDouble gamma;
+    if( normalA )
+    {
+        // C := alpha A op(B) + C via unit-stride column updates
+        for( BlasInt j=0; j<n; ++j )
+        {
+            for( BlasInt l=0; l<k; ++l )
+            {
+                gamma = alpha;
+                gamma *= ( normalB ? B[l+j*BLDim] : B[j+l*BLDim] );
+                dd::AxpyKernel
+                ( m, gamma.x[0], gamma.x[1], &A[l*ALDim], &C[j*CLDim] );
+            }
+        }
+    }
+    else if( normalB )
+    {
+        // C := alpha A^T B + C via unit-stride dot products
+        for( BlasInt j=0; j<n; ++j )
+        {
+            for( BlasInt i=0; i<m; ++i )
+            {
+                double sumHi=0, sumLo=0;
+                dd::DotKernel( k, &A[i*ALDim], &B[j*BLDim], sumHi, sumLo );
+                dd::MultiplyAdd
+                ( alpha.x[0], alpha.x[1], sumHi, sumLo,
+                  C[i+j*CLDim].x[0], C[i+j*CLDim].x[1] );
+            }
+        }
+    }
+    else
+    {
+        // C := alpha A^T B^T + C; the rows of B are traversed with stride
+        // BLDim, so only the straight-line scalar updates help here
+        for( BlasInt j=0; j<n; ++j )
+        {
+            for( BlasInt i=0; i<m; ++i )
+            {
+                double sumHi=0, sumLo=0;
+                for( BlasInt l=0; l<k; ++l )
+                    dd::MultiplyAdd
+                    ( A[l+i*ALDim].x[0], A[l+i*ALDim].x[1],
+                      B[j+l*BLDim].x[0], B[j+l*BLDim].x[1],
+                      sumHi, sumLo );
+                dd::MultiplyAdd
+                ( alpha.x[0], alpha.x[1], sumHi, sumLo,
+                  C[i+j*CLDim].x[0], C[i+j*CLDim].x[1] );
+            }
+        }
+    }
+}
 template void Gemm
 ( char transA, char transB,
   BlasInt m, BlasInt n, BlasInt k, 
@@ -385,6 +462,10 @@ void Gemm
     )
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "sgemm",
+      (long long)(sizeof(*C))*
+      ((long long)(m)*k+(long long)(k)*n+(long long)(m)*n) );
     EL_BLAS(sgemm)
     ( &fixedTransA, &fixedTransB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -428,6 +509,10 @@ void Gemm
     )
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "dgemm",
+      (long long)(sizeof(*C))*
+      ((long long)(m)*k+(long long)(k)*n+(long long)(m)*n) );
     EL_BLAS(dgemm)
     ( &fixedTransA, &fixedTransB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -468,6 +553,10 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "cgemm",
+      (long long)(sizeof(*C))*
+      ((long long)(m)*k+(long long)(k)*n+(long long)(m)*n) );
     EL_BLAS(cgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -508,6 +597,10 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "zgemm",
+      (long long)(sizeof(*C))*
+      ((long long)(m)*k+(long long)(k)*n+(long long)(m)*n) );
     EL_BLAS(zgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
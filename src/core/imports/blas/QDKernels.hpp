@@ -0,0 +1,89 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#ifdef EL_HAVE_QD
+
+namespace El {
+namespace blas {
+
+// Branch-free error-free transformations over the raw double pairs of a
+// double-double number. Keeping the arithmetic as straight-line double
+// operations (with the product error recovered through std::fma) allows
+// the compiler to vectorize the unit-stride Gemm and Dot loops which call
+// into these kernels, whereas routing each element through the dd_real
+// operator overloads defeats vectorization entirely.
+namespace dd {
+
+inline void TwoSum( double a, double b, double& s, double& err )
+{
+    s = a + b;
+    const double bVirtual = s - a;
+    err = (a - (s-bVirtual)) + (b - bVirtual);
+}
+
+// Requires |a| >= |b|
+inline void QuickTwoSum( double a, double b, double& s, double& err )
+{
+    s = a + b;
+    err = b - (s - a);
+}
+
+inline void TwoProd( double a, double b, double& p, double& err )
+{
+    p = a*b;
+    err = std::fma( a, b, -p );
+}
+
+// (cHi,cLo) += (aHi,aLo)*(bHi,bLo)
+inline void MultiplyAdd
+( double aHi, double aLo, double bHi, double bLo,
+  double& cHi, double& cLo )
+{
+    double p, e;
+    TwoProd( aHi, bHi, p, e );
+    e += aHi*bLo + aLo*bHi;
+    QuickTwoSum( p, e, p, e );
+
+    double s1, s2, t1, t2;
+    TwoSum( cHi, p, s1, s2 );
+    TwoSum( cLo, e, t1, t2 );
+    s2 += t1;
+    QuickTwoSum( s1, s2, s1, s2 );
+    s2 += t2;
+    QuickTwoSum( s1, s2, cHi, cLo );
+}
+
+// y(0:m) += (gammaHi,gammaLo) x(0:m) over unit-stride double-double vectors
+inline void AxpyKernel
+( BlasInt m, double gammaHi, double gammaLo,
+  const DoubleDouble* x, DoubleDouble* y )
+{
+    EL_SIMD
+    for( BlasInt i=0; i<m; ++i )
+        MultiplyAdd
+        ( x[i].x[0], x[i].x[1], gammaHi, gammaLo, y[i].x[0], y[i].x[1] );
+}
+
+// (sumHi,sumLo) += x(0:m)^T y(0:m) over unit-stride double-double vectors
+inline void DotKernel
+( BlasInt m, const DoubleDouble* x, const DoubleDouble* y,
+  double& sumHi, double& sumLo )
+{
+    EL_SIMD
+    for( BlasInt i=0; i<m; ++i )
+        MultiplyAdd
+        ( x[i].x[0], x[i].x[1], y[i].x[0], y[i].x[1], sumHi, sumLo );
+}
+
+} // namespace dd
+
+} // namespace blas
+} // namespace El
+
+#endif // ifdef EL_HAVE_QD
@@ -324,6 +324,11 @@ void Hemm
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "ssymm",
+      (long long)(sizeof(*C))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       2*(long long)(m)*n) );
     EL_BLAS(ssymm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -337,6 +342,11 @@ void Hemm
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "dsymm",
+      (long long)(sizeof(*C))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       2*(long long)(m)*n) );
     EL_BLAS(dsymm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -350,6 +360,11 @@ void Hemm
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "chemm",
+      (long long)(sizeof(*C))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       2*(long long)(m)*n) );
     EL_BLAS(chemm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -363,6 +378,11 @@ void Hemm
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "zhemm",
+      (long long)(sizeof(*C))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       2*(long long)(m)*n) );
     EL_BLAS(zhemm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -632,6 +652,11 @@ void Symm
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "ssymm",
+      (long long)(sizeof(*C))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       2*(long long)(m)*n) );
     EL_BLAS(ssymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -644,6 +669,11 @@ void Symm
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "dsymm",
+      (long long)(sizeof(*C))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       2*(long long)(m)*n) );
     EL_BLAS(dsymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -656,6 +686,11 @@ void Symm
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "csymm",
+      (long long)(sizeof(*C))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       2*(long long)(m)*n) );
     EL_BLAS(csymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -668,6 +703,11 @@ void Symm
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "zsymm",
+      (long long)(sizeof(*C))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       2*(long long)(m)*n) );
     EL_BLAS(zsymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -296,6 +296,9 @@ void Her2k
         float* C, BlasInt CLDim )
 {
     const char transFixed = ( trans == 'C' ? 'T' : trans );
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "ssyr2k",
+      (long long)(sizeof(*C))*(2*(long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(ssyr2k)
     ( &uplo, &transFixed, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -311,6 +314,9 @@ void Her2k
         double* C, BlasInt CLDim )
 {
     const char transFixed = ( trans == 'C' ? 'T' : trans );
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "dsyr2k",
+      (long long)(sizeof(*C))*(2*(long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(dsyr2k)
     ( &uplo, &transFixed, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -325,6 +331,9 @@ void Her2k
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "cher2k",
+      (long long)(sizeof(*C))*(2*(long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(cher2k)
     ( &uplo, &trans, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -339,6 +348,9 @@ void Her2k
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "zher2k",
+      (long long)(sizeof(*C))*(2*(long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(zher2k)
     ( &uplo, &trans, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -566,6 +578,9 @@ void Syr2k
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "ssyr2k",
+      (long long)(sizeof(*C))*(2*(long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(ssyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -579,6 +594,9 @@ void Syr2k
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "dsyr2k",
+      (long long)(sizeof(*C))*(2*(long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(dsyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -592,6 +610,9 @@ void Syr2k
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "csyr2k",
+      (long long)(sizeof(*C))*(2*(long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(csyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -605,6 +626,9 @@ void Syr2k
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "zsyr2k",
+      (long long)(sizeof(*C))*(2*(long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(zsyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -249,6 +249,9 @@ void Herk
         float* C, BlasInt CLDim )
 {
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "ssyrk",
+      (long long)(sizeof(*C))*((long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(ssyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -262,6 +265,9 @@ void Herk
         double* C, BlasInt CLDim )
 {
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "dsyrk",
+      (long long)(sizeof(*C))*((long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(dsyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -274,6 +280,9 @@ void Herk
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "cherk",
+      (long long)(sizeof(*C))*((long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(cherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -286,6 +295,9 @@ void Herk
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "zherk",
+      (long long)(sizeof(*C))*((long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(zherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -483,6 +495,9 @@ void Syrk
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "ssyrk",
+      (long long)(sizeof(*C))*((long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(ssyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -494,6 +509,9 @@ void Syrk
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "dsyrk",
+      (long long)(sizeof(*C))*((long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(dsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -505,6 +523,9 @@ void Syrk
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "csyrk",
+      (long long)(sizeof(*C))*((long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(csyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -516,6 +537,9 @@ void Syrk
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "zsyrk",
+      (long long)(sizeof(*C))*((long long)(n)*k+(long long)(n)*n) );
     EL_BLAS(zsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
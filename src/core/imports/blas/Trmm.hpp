@@ -152,6 +152,11 @@ void Trmm
         float* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );    
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "strmm",
+      (long long)(sizeof(*B))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       (long long)(m)*n) );
     EL_BLAS(strmm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -163,6 +168,11 @@ void Trmm
         double* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );    
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "dtrmm",
+      (long long)(sizeof(*B))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       (long long)(m)*n) );
     EL_BLAS(dtrmm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -173,6 +183,11 @@ void Trmm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "ctrmm",
+      (long long)(sizeof(*B))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       (long long)(m)*n) );
     EL_BLAS(ctrmm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -183,6 +198,11 @@ void Trmm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "ztrmm",
+      (long long)(sizeof(*B))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       (long long)(m)*n) );
     EL_BLAS(ztrmm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -356,6 +356,11 @@ void Trsm
         float* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "strsm",
+      (long long)(sizeof(*B))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       (long long)(m)*n) );
     EL_BLAS(strsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -368,6 +373,11 @@ void Trsm
         double* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "dtrsm",
+      (long long)(sizeof(*B))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       (long long)(m)*n) );
     EL_BLAS(dtrsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -379,6 +389,11 @@ void Trsm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "ctrsm",
+      (long long)(sizeof(*B))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       (long long)(m)*n) );
     EL_BLAS(ctrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -390,6 +405,11 @@ void Trsm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+    trace::Region traceRegion
+    ( trace::BLAS_EVENT, "ztrsm",
+      (long long)(sizeof(*B))*
+      ((std::toupper(side)=='L' ? (long long)(m)*m : (long long)(n)*n)+
+       (long long)(m)*n) );
     EL_BLAS(ztrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
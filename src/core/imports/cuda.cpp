@@ -0,0 +1,274 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#ifdef EL_HAVE_CUDA
+
+#include <cuda_runtime.h>
+#include <cublas_v2.h>
+
+namespace {
+
+bool cudaAvailable = false;
+bool frontOffloadEnabled = false;
+El::Int frontOffloadThreshold = 4096;
+
+cublasHandle_t cublasHandle;
+
+// A grow-only pinned staging buffer for the diagonal panel roundtrips
+void* pinnedBuf = nullptr;
+size_t pinnedSize = 0;
+
+bool EnsurePinned( size_t numBytes )
+{
+    if( numBytes <= pinnedSize )
+        return true;
+    if( pinnedBuf != nullptr )
+    {
+        cudaFreeHost( pinnedBuf );
+        pinnedBuf = nullptr;
+        pinnedSize = 0;
+    }
+    if( cudaMallocHost( &pinnedBuf, numBytes ) != cudaSuccess )
+        return false;
+    pinnedSize = numBytes;
+    return true;
+}
+
+// Overloaded shims around the type-suffixed cuBLAS interface
+cublasStatus_t Trsm
+( cublasHandle_t handle, int m, int n,
+  const float* alpha, const float* A, int ldA, float* B, int ldB )
+{
+    return cublasStrsm
+    ( handle, CUBLAS_SIDE_RIGHT, CUBLAS_FILL_MODE_LOWER,
+      CUBLAS_OP_T, CUBLAS_DIAG_UNIT, m, n, alpha, A, ldA, B, ldB );
+}
+cublasStatus_t Trsm
+( cublasHandle_t handle, int m, int n,
+  const double* alpha, const double* A, int ldA, double* B, int ldB )
+{
+    return cublasDtrsm
+    ( handle, CUBLAS_SIDE_RIGHT, CUBLAS_FILL_MODE_LOWER,
+      CUBLAS_OP_T, CUBLAS_DIAG_UNIT, m, n, alpha, A, ldA, B, ldB );
+}
+
+cublasStatus_t Dgmm
+( cublasHandle_t handle, int m, int n,
+  const float* A, int ldA, const float* x, float* C, int ldC )
+{ return cublasSdgmm
+  ( handle, CUBLAS_SIDE_RIGHT, m, n, A, ldA, x, 1, C, ldC ); }
+cublasStatus_t Dgmm
+( cublasHandle_t handle, int m, int n,
+  const double* A, int ldA, const double* x, double* C, int ldC )
+{ return cublasDdgmm
+  ( handle, CUBLAS_SIDE_RIGHT, m, n, A, ldA, x, 1, C, ldC ); }
+
+cublasStatus_t Gemm
+( cublasHandle_t handle, int m, int n, int k,
+  const float* alpha, const float* A, int ldA, const float* B, int ldB,
+  const float* beta, float* C, int ldC )
+{ return cublasSgemm
+  ( handle, CUBLAS_OP_N, CUBLAS_OP_T, m, n, k,
+    alpha, A, ldA, B, ldB, beta, C, ldC ); }
+cublasStatus_t Gemm
+( cublasHandle_t handle, int m, int n, int k,
+  const double* alpha, const double* A, int ldA, const double* B, int ldB,
+  const double* beta, double* C, int ldC )
+{ return cublasDgemm
+  ( handle, CUBLAS_OP_N, CUBLAS_OP_T, m, n, k,
+    alpha, A, ldA, B, ldB, beta, C, ldC ); }
+
+} // anonymous namespace
+
+namespace El {
+namespace gpu {
+
+void Initialize()
+{
+    int numDevices = 0;
+    if( cudaGetDeviceCount( &numDevices ) != cudaSuccess || numDevices == 0 )
+        return;
+    if( cublasCreate( &cublasHandle ) != CUBLAS_STATUS_SUCCESS )
+        return;
+    cudaAvailable = true;
+
+    const char* gpuFronts = std::getenv( "EL_GPU_FRONTS" );
+    if( gpuFronts != nullptr && std::atoi(gpuFronts) != 0 )
+        frontOffloadEnabled = true;
+}
+
+void Finalize()
+{
+    if( cudaAvailable )
+    {
+        cublasDestroy( cublasHandle );
+        cudaAvailable = false;
+    }
+    if( pinnedBuf != nullptr )
+    {
+        cudaFreeHost( pinnedBuf );
+        pinnedBuf = nullptr;
+        pinnedSize = 0;
+    }
+}
+
+bool Available() { return cudaAvailable; }
+
+void EnableFrontOffload() { frontOffloadEnabled = true; }
+void DisableFrontOffload() { frontOffloadEnabled = false; }
+bool FrontOffloadEnabled() { return frontOffloadEnabled; }
+
+Int FrontOffloadThreshold() { return frontOffloadThreshold; }
+void SetFrontOffloadThreshold( Int thresh )
+{ frontOffloadThreshold = thresh; }
+
+namespace {
+
+template<typename F>
+bool TryProcessFrontVanillaImpl( Matrix<F>& AL, Matrix<F>& ABR )
+{
+    EL_DEBUG_CSE
+    if( !cudaAvailable || !frontOffloadEnabled )
+        return false;
+    const Int m = AL.Height();
+    const Int n = AL.Width();
+    const Int p = ABR.Height();
+    if( m < frontOffloadThreshold )
+        return false;
+    const Int bsize = Blocksize();
+    if( !EnsurePinned( (bsize*bsize+bsize)*sizeof(F) ) )
+        return false;
+    F* panelBuf = static_cast<F*>(pinnedBuf);
+    F* dInvBuf = panelBuf + bsize*bsize;
+
+    F* dAL = nullptr;
+    F* dABR = nullptr;
+    F* dS21 = nullptr;
+    F* dDInv = nullptr;
+    auto cleanup = [&]()
+    {
+        if( dAL != nullptr ) cudaFree( dAL );
+        if( dABR != nullptr ) cudaFree( dABR );
+        if( dS21 != nullptr ) cudaFree( dS21 );
+        if( dDInv != nullptr ) cudaFree( dDInv );
+    };
+
+    if( cudaMalloc( (void**)&dAL, m*n*sizeof(F) ) != cudaSuccess ||
+        cudaMalloc( (void**)&dABR, p*p*sizeof(F) ) != cudaSuccess ||
+        cudaMalloc( (void**)&dS21, m*bsize*sizeof(F) ) != cudaSuccess ||
+        cudaMalloc( (void**)&dDInv, bsize*sizeof(F) ) != cudaSuccess )
+    {
+        cleanup();
+        return false;
+    }
+    if( cublasSetMatrix
+        ( m, n, sizeof(F), AL.LockedBuffer(), AL.LDim(), dAL, m ) !=
+        CUBLAS_STATUS_SUCCESS ||
+        cublasSetMatrix
+        ( p, p, sizeof(F), ABR.LockedBuffer(), ABR.LDim(), dABR, p ) !=
+        CUBLAS_STATUS_SUCCESS )
+    {
+        cleanup();
+        return false;
+    }
+
+    const F one(1), negOne(-1);
+    bool failed = false;
+    for( Int k=0; k<n && !failed; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int mk2 = m - (k+nb);
+        const Int ind2Size = n - (k+nb);
+        F* dAL11 = &dAL[k+k*m];
+        F* dAL21 = &dAL[(k+nb)+k*m];
+
+        // Factor the diagonal panel on the host
+        if( cublasGetMatrix( nb, nb, sizeof(F), dAL11, m, panelBuf, nb ) !=
+            CUBLAS_STATUS_SUCCESS )
+        { failed = true; break; }
+        Matrix<F> AL11Host;
+        AL11Host.Attach( nb, nb, panelBuf, nb );
+        MakeTrapezoidal( LOWER, AL11Host );
+        LDL( AL11Host, false );
+        for( Int j=0; j<nb; ++j )
+            dInvBuf[j] = one / AL11Host(j,j);
+        if( cublasSetMatrix( nb, nb, sizeof(F), panelBuf, nb, dAL11, m ) !=
+            CUBLAS_STATUS_SUCCESS ||
+            cublasSetVector( nb, sizeof(F), dInvBuf, 1, dDInv, 1 ) !=
+            CUBLAS_STATUS_SUCCESS )
+        { failed = true; break; }
+        if( mk2 == 0 )
+            continue;
+
+        // AL21 := AL21 tril(AL11)^-T, then stash S21 := AL21 and
+        // AL21 := AL21 D^-1
+        if( Trsm( cublasHandle, mk2, nb, &one, dAL11, m, dAL21, m ) !=
+            CUBLAS_STATUS_SUCCESS )
+        { failed = true; break; }
+        if( cudaMemcpy2D
+            ( dS21, mk2*sizeof(F), dAL21, m*sizeof(F),
+              mk2*sizeof(F), nb, cudaMemcpyDeviceToDevice ) != cudaSuccess )
+        { failed = true; break; }
+        if( Dgmm( cublasHandle, mk2, nb, dS21, mk2, dDInv, dAL21, m ) !=
+            CUBLAS_STATUS_SUCCESS )
+        { failed = true; break; }
+
+        // Rank-nb updates of the trailing quadrant and of ABR. Full GEMM's
+        // are used in place of Trrk; the spurious upper triangles are
+        // zeroed after the front is brought back to the host.
+        if( ind2Size > 0 )
+        {
+            F* dAL22 = &dAL[(k+nb)+(k+nb)*m];
+            if( Gemm
+                ( cublasHandle, mk2, ind2Size, nb,
+                  &negOne, dS21, mk2, dAL21, m, &one, dAL22, m ) !=
+                CUBLAS_STATUS_SUCCESS )
+            { failed = true; break; }
+        }
+        if( p > 0 )
+        {
+            if( Gemm
+                ( cublasHandle, p, p, nb,
+                  &negOne, &dS21[ind2Size], mk2, &dAL21[ind2Size], m,
+                  &one, dABR, p ) != CUBLAS_STATUS_SUCCESS )
+            { failed = true; break; }
+        }
+    }
+
+    if( !failed )
+    {
+        if( cublasGetMatrix( m, n, sizeof(F), dAL, m, AL.Buffer(), AL.LDim() )
+            != CUBLAS_STATUS_SUCCESS ||
+            cublasGetMatrix( p, p, sizeof(F), dABR, p,
+              ABR.Buffer(), ABR.LDim() ) != CUBLAS_STATUS_SUCCESS )
+            failed = true;
+    }
+    cleanup();
+    if( failed )
+        return false;
+
+    // Restore the lower-triangular structure that the full GEMM updates
+    // overwrote (the CPU algorithm maintains it via MakeTrapezoidal/Trrk)
+    auto ALT = AL( IR(0,n), ALL );
+    MakeTrapezoidal( LOWER, ALT );
+    MakeTrapezoidal( LOWER, ABR );
+    return true;
+}
+
+} // anonymous namespace
+
+bool TryProcessFrontVanilla( Matrix<float>& AL, Matrix<float>& ABR )
+{ return TryProcessFrontVanillaImpl( AL, ABR ); }
+bool TryProcessFrontVanilla( Matrix<double>& AL, Matrix<double>& ABR )
+{ return TryProcessFrontVanillaImpl( AL, ABR ); }
+
+} // namespace gpu
+} // namespace El
+
+#endif // ifdef EL_HAVE_CUDA
@@ -4615,5 +4615,6 @@ void Schur
 } // namespace lapack
 } // namespace El
 
+#include "./lapack/Band.hpp"
 #include "./lapack/TriangEig.hpp"
 #include "./lapack/Schur.hpp"
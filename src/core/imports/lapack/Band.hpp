@@ -0,0 +1,294 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+extern "C" {
+
+// Factor a Hermitian positive-definite band matrix
+void EL_LAPACK(spbtrf)
+( const char* uplo, const BlasInt* n, const BlasInt* kd,
+  float* AB, const BlasInt* ldAB, BlasInt* info );
+void EL_LAPACK(dpbtrf)
+( const char* uplo, const BlasInt* n, const BlasInt* kd,
+  double* AB, const BlasInt* ldAB, BlasInt* info );
+void EL_LAPACK(cpbtrf)
+( const char* uplo, const BlasInt* n, const BlasInt* kd,
+  scomplex* AB, const BlasInt* ldAB, BlasInt* info );
+void EL_LAPACK(zpbtrf)
+( const char* uplo, const BlasInt* n, const BlasInt* kd,
+  dcomplex* AB, const BlasInt* ldAB, BlasInt* info );
+
+// Solve against a band Cholesky factorization
+void EL_LAPACK(spbtrs)
+( const char* uplo, const BlasInt* n, const BlasInt* kd,
+  const BlasInt* numRHS, const float* AB, const BlasInt* ldAB,
+  float* B, const BlasInt* ldB, BlasInt* info );
+void EL_LAPACK(dpbtrs)
+( const char* uplo, const BlasInt* n, const BlasInt* kd,
+  const BlasInt* numRHS, const double* AB, const BlasInt* ldAB,
+  double* B, const BlasInt* ldB, BlasInt* info );
+void EL_LAPACK(cpbtrs)
+( const char* uplo, const BlasInt* n, const BlasInt* kd,
+  const BlasInt* numRHS, const scomplex* AB, const BlasInt* ldAB,
+  scomplex* B, const BlasInt* ldB, BlasInt* info );
+void EL_LAPACK(zpbtrs)
+( const char* uplo, const BlasInt* n, const BlasInt* kd,
+  const BlasInt* numRHS, const dcomplex* AB, const BlasInt* ldAB,
+  dcomplex* B, const BlasInt* ldB, BlasInt* info );
+
+// Factor a general band matrix with partial pivoting
+void EL_LAPACK(sgbtrf)
+( const BlasInt* m, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku,
+  float* AB, const BlasInt* ldAB, BlasInt* ipiv, BlasInt* info );
+void EL_LAPACK(dgbtrf)
+( const BlasInt* m, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku,
+  double* AB, const BlasInt* ldAB, BlasInt* ipiv, BlasInt* info );
+void EL_LAPACK(cgbtrf)
+( const BlasInt* m, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku,
+  scomplex* AB, const BlasInt* ldAB, BlasInt* ipiv, BlasInt* info );
+void EL_LAPACK(zgbtrf)
+( const BlasInt* m, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku,
+  dcomplex* AB, const BlasInt* ldAB, BlasInt* ipiv, BlasInt* info );
+
+// Solve against a band LU factorization
+void EL_LAPACK(sgbtrs)
+( const char* trans, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku, const BlasInt* numRHS,
+  const float* AB, const BlasInt* ldAB, const BlasInt* ipiv,
+  float* B, const BlasInt* ldB, BlasInt* info );
+void EL_LAPACK(dgbtrs)
+( const char* trans, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku, const BlasInt* numRHS,
+  const double* AB, const BlasInt* ldAB, const BlasInt* ipiv,
+  double* B, const BlasInt* ldB, BlasInt* info );
+void EL_LAPACK(cgbtrs)
+( const char* trans, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku, const BlasInt* numRHS,
+  const scomplex* AB, const BlasInt* ldAB, const BlasInt* ipiv,
+  scomplex* B, const BlasInt* ldB, BlasInt* info );
+void EL_LAPACK(zgbtrs)
+( const char* trans, const BlasInt* n,
+  const BlasInt* kl, const BlasInt* ku, const BlasInt* numRHS,
+  const dcomplex* AB, const BlasInt* ldAB, const BlasInt* ipiv,
+  dcomplex* B, const BlasInt* ldB, BlasInt* info );
+
+} // extern "C"
+
+namespace El {
+namespace lapack {
+
+// Band Cholesky
+// =============
+
+void BandCholesky( char uplo, BlasInt n, BlasInt kd, float* AB, BlasInt ldAB )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(spbtrf)( &uplo, &n, &kd, AB, &ldAB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of pbtrf had an illegal value");
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+}
+
+void BandCholesky( char uplo, BlasInt n, BlasInt kd, double* AB, BlasInt ldAB )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(dpbtrf)( &uplo, &n, &kd, AB, &ldAB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of pbtrf had an illegal value");
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+}
+
+void BandCholesky
+( char uplo, BlasInt n, BlasInt kd, scomplex* AB, BlasInt ldAB )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(cpbtrf)( &uplo, &n, &kd, AB, &ldAB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of pbtrf had an illegal value");
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+}
+
+void BandCholesky
+( char uplo, BlasInt n, BlasInt kd, dcomplex* AB, BlasInt ldAB )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(zpbtrf)( &uplo, &n, &kd, AB, &ldAB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of pbtrf had an illegal value");
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+}
+
+void BandCholeskySolve
+( char uplo, BlasInt n, BlasInt kd, BlasInt numRHS,
+  const float* AB, BlasInt ldAB, float* B, BlasInt ldB )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(spbtrs)( &uplo, &n, &kd, &numRHS, AB, &ldAB, B, &ldB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of pbtrs had an illegal value");
+}
+
+void BandCholeskySolve
+( char uplo, BlasInt n, BlasInt kd, BlasInt numRHS,
+  const double* AB, BlasInt ldAB, double* B, BlasInt ldB )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(dpbtrs)( &uplo, &n, &kd, &numRHS, AB, &ldAB, B, &ldB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of pbtrs had an illegal value");
+}
+
+void BandCholeskySolve
+( char uplo, BlasInt n, BlasInt kd, BlasInt numRHS,
+  const scomplex* AB, BlasInt ldAB, scomplex* B, BlasInt ldB )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(cpbtrs)( &uplo, &n, &kd, &numRHS, AB, &ldAB, B, &ldB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of pbtrs had an illegal value");
+}
+
+void BandCholeskySolve
+( char uplo, BlasInt n, BlasInt kd, BlasInt numRHS,
+  const dcomplex* AB, BlasInt ldAB, dcomplex* B, BlasInt ldB )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(zpbtrs)( &uplo, &n, &kd, &numRHS, AB, &ldAB, B, &ldB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of pbtrs had an illegal value");
+}
+
+// Band LU with partial pivoting
+// =============================
+// NOTE: AB must be stored with ldAB >= 2*kl+ku+1, with the matrix beginning
+//       in row kl (zero-based), in order to leave room for the fill-in
+
+void BandLU
+( BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  float* AB, BlasInt ldAB, BlasInt* ipiv )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(sgbtrf)( &m, &n, &kl, &ku, AB, &ldAB, ipiv, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of gbtrf had an illegal value");
+    else if( info > 0 )
+        throw SingularMatrixException();
+}
+
+void BandLU
+( BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  double* AB, BlasInt ldAB, BlasInt* ipiv )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(dgbtrf)( &m, &n, &kl, &ku, AB, &ldAB, ipiv, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of gbtrf had an illegal value");
+    else if( info > 0 )
+        throw SingularMatrixException();
+}
+
+void BandLU
+( BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  scomplex* AB, BlasInt ldAB, BlasInt* ipiv )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(cgbtrf)( &m, &n, &kl, &ku, AB, &ldAB, ipiv, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of gbtrf had an illegal value");
+    else if( info > 0 )
+        throw SingularMatrixException();
+}
+
+void BandLU
+( BlasInt m, BlasInt n, BlasInt kl, BlasInt ku,
+  dcomplex* AB, BlasInt ldAB, BlasInt* ipiv )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(zgbtrf)( &m, &n, &kl, &ku, AB, &ldAB, ipiv, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of gbtrf had an illegal value");
+    else if( info > 0 )
+        throw SingularMatrixException();
+}
+
+void BandLUSolve
+( char trans, BlasInt n, BlasInt kl, BlasInt ku, BlasInt numRHS,
+  const float* AB, BlasInt ldAB, const BlasInt* ipiv,
+  float* B, BlasInt ldB )
+{
+    EL_DEBUG_CSE
+    const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    BlasInt info;
+    EL_LAPACK(sgbtrs)
+    ( &fixedTrans, &n, &kl, &ku, &numRHS, AB, &ldAB, ipiv, B, &ldB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of gbtrs had an illegal value");
+}
+
+void BandLUSolve
+( char trans, BlasInt n, BlasInt kl, BlasInt ku, BlasInt numRHS,
+  const double* AB, BlasInt ldAB, const BlasInt* ipiv,
+  double* B, BlasInt ldB )
+{
+    EL_DEBUG_CSE
+    const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    BlasInt info;
+    EL_LAPACK(dgbtrs)
+    ( &fixedTrans, &n, &kl, &ku, &numRHS, AB, &ldAB, ipiv, B, &ldB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of gbtrs had an illegal value");
+}
+
+void BandLUSolve
+( char trans, BlasInt n, BlasInt kl, BlasInt ku, BlasInt numRHS,
+  const scomplex* AB, BlasInt ldAB, const BlasInt* ipiv,
+  scomplex* B, BlasInt ldB )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(cgbtrs)
+    ( &trans, &n, &kl, &ku, &numRHS, AB, &ldAB, ipiv, B, &ldB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of gbtrs had an illegal value");
+}
+
+void BandLUSolve
+( char trans, BlasInt n, BlasInt kl, BlasInt ku, BlasInt numRHS,
+  const dcomplex* AB, BlasInt ldAB, const BlasInt* ipiv,
+  dcomplex* B, BlasInt ldB )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(zgbtrs)
+    ( &trans, &n, &kl, &ku, &numRHS, AB, &ldAB, ipiv, B, &ldB, &info );
+    if( info < 0 )
+        RuntimeError("Argument ",-info," of gbtrs had an illegal value");
+}
+
+} // namespace lapack
+} // namespace El
@@ -25,6 +25,9 @@ typedef struct _MKL_Complex16 {
   double imag;
 } MKL_Complex16;
 
+void mkl_set_num_threads( int numThreads );
+int mkl_get_max_threads( void );
+
 void mkl_scsrmv
 ( const char* transA, const BlasInt* m, const BlasInt* k, 
   const float* alpha, const char* matDescrA,
@@ -50,8 +53,149 @@ void mkl_zcsrmv
   const BlasInt* pntrb, const BlasInt* pntre,
   const MKL_Complex16* x, const MKL_Complex16* beta, MKL_Complex16* y );
 
+// Inspector-executor sparse BLAS
+// (the enumeration values must match those of mkl_spblas.h)
+typedef enum
+{
+    SPARSE_STATUS_SUCCESS=0,
+    SPARSE_STATUS_NOT_INITIALIZED=1,
+    SPARSE_STATUS_ALLOC_FAILED=2,
+    SPARSE_STATUS_INVALID_VALUE=3,
+    SPARSE_STATUS_EXECUTION_FAILED=4,
+    SPARSE_STATUS_INTERNAL_ERROR=5,
+    SPARSE_STATUS_NOT_SUPPORTED=6
+} sparse_status_t;
+
+typedef enum
+{
+    SPARSE_OPERATION_NON_TRANSPOSE=10,
+    SPARSE_OPERATION_TRANSPOSE=11,
+    SPARSE_OPERATION_CONJUGATE_TRANSPOSE=12
+} sparse_operation_t;
+
+typedef enum
+{
+    SPARSE_MATRIX_TYPE_GENERAL=20,
+    SPARSE_MATRIX_TYPE_SYMMETRIC=21,
+    SPARSE_MATRIX_TYPE_HERMITIAN=22,
+    SPARSE_MATRIX_TYPE_TRIANGULAR=23,
+    SPARSE_MATRIX_TYPE_DIAGONAL=24,
+    SPARSE_MATRIX_TYPE_BLOCK_TRIANGULAR=25,
+    SPARSE_MATRIX_TYPE_BLOCK_DIAGONAL=26
+} sparse_matrix_type_t;
+
+typedef enum
+{
+    SPARSE_INDEX_BASE_ZERO=0,
+    SPARSE_INDEX_BASE_ONE=1
+} sparse_index_base_t;
+
+typedef enum
+{
+    SPARSE_FILL_MODE_LOWER=40,
+    SPARSE_FILL_MODE_UPPER=41,
+    SPARSE_FILL_MODE_FULL=42
+} sparse_fill_mode_t;
+
+typedef enum
+{
+    SPARSE_DIAG_NON_UNIT=50,
+    SPARSE_DIAG_UNIT=51
+} sparse_diag_type_t;
+
+typedef enum
+{
+    SPARSE_LAYOUT_ROW_MAJOR=101,
+    SPARSE_LAYOUT_COLUMN_MAJOR=102
+} sparse_layout_t;
+
+typedef enum
+{
+    SPARSE_MEMORY_NONE=80,
+    SPARSE_MEMORY_AGGRESSIVE=81
+} sparse_memory_usage_t;
+
+struct sparse_matrix;
+typedef struct sparse_matrix* sparse_matrix_t;
+
+struct matrix_descr
+{
+    sparse_matrix_type_t type;
+    sparse_fill_mode_t mode;
+    sparse_diag_type_t diag;
+};
+
+sparse_status_t mkl_sparse_s_create_csr
+( sparse_matrix_t* A, sparse_index_base_t indexing,
+  BlasInt rows, BlasInt cols,
+  BlasInt* rows_start, BlasInt* rows_end, BlasInt* col_indx, float* values );
+sparse_status_t mkl_sparse_d_create_csr
+( sparse_matrix_t* A, sparse_index_base_t indexing,
+  BlasInt rows, BlasInt cols,
+  BlasInt* rows_start, BlasInt* rows_end, BlasInt* col_indx, double* values );
+sparse_status_t mkl_sparse_c_create_csr
+( sparse_matrix_t* A, sparse_index_base_t indexing,
+  BlasInt rows, BlasInt cols,
+  BlasInt* rows_start, BlasInt* rows_end, BlasInt* col_indx,
+  MKL_Complex8* values );
+sparse_status_t mkl_sparse_z_create_csr
+( sparse_matrix_t* A, sparse_index_base_t indexing,
+  BlasInt rows, BlasInt cols,
+  BlasInt* rows_start, BlasInt* rows_end, BlasInt* col_indx,
+  MKL_Complex16* values );
+
+sparse_status_t mkl_sparse_set_mv_hint
+( sparse_matrix_t A, sparse_operation_t operation,
+  struct matrix_descr descr, BlasInt expected_calls );
+sparse_status_t mkl_sparse_set_memory_hint
+( sparse_matrix_t A, sparse_memory_usage_t policy );
+sparse_status_t mkl_sparse_optimize( sparse_matrix_t A );
+sparse_status_t mkl_sparse_destroy( sparse_matrix_t A );
+
+sparse_status_t mkl_sparse_s_mv
+( sparse_operation_t operation, float alpha,
+  const sparse_matrix_t A, struct matrix_descr descr,
+  const float* x, float beta, float* y );
+sparse_status_t mkl_sparse_d_mv
+( sparse_operation_t operation, double alpha,
+  const sparse_matrix_t A, struct matrix_descr descr,
+  const double* x, double beta, double* y );
+sparse_status_t mkl_sparse_c_mv
+( sparse_operation_t operation, MKL_Complex8 alpha,
+  const sparse_matrix_t A, struct matrix_descr descr,
+  const MKL_Complex8* x, MKL_Complex8 beta, MKL_Complex8* y );
+sparse_status_t mkl_sparse_z_mv
+( sparse_operation_t operation, MKL_Complex16 alpha,
+  const sparse_matrix_t A, struct matrix_descr descr,
+  const MKL_Complex16* x, MKL_Complex16 beta, MKL_Complex16* y );
+
+sparse_status_t mkl_sparse_s_mm
+( sparse_operation_t operation, float alpha,
+  const sparse_matrix_t A, struct matrix_descr descr,
+  sparse_layout_t layout,
+  const float* x, BlasInt columns, BlasInt ldx,
+  float beta, float* y, BlasInt ldy );
+sparse_status_t mkl_sparse_d_mm
+( sparse_operation_t operation, double alpha,
+  const sparse_matrix_t A, struct matrix_descr descr,
+  sparse_layout_t layout,
+  const double* x, BlasInt columns, BlasInt ldx,
+  double beta, double* y, BlasInt ldy );
+sparse_status_t mkl_sparse_c_mm
+( sparse_operation_t operation, MKL_Complex8 alpha,
+  const sparse_matrix_t A, struct matrix_descr descr,
+  sparse_layout_t layout,
+  const MKL_Complex8* x, BlasInt columns, BlasInt ldx,
+  MKL_Complex8 beta, MKL_Complex8* y, BlasInt ldy );
+sparse_status_t mkl_sparse_z_mm
+( sparse_operation_t operation, MKL_Complex16 alpha,
+  const sparse_matrix_t A, struct matrix_descr descr,
+  sparse_layout_t layout,
+  const MKL_Complex16* x, BlasInt columns, BlasInt ldx,
+  MKL_Complex16 beta, MKL_Complex16* y, BlasInt ldy );
+
 void MKL_Somatcopy
-( char ordering, char trans, size_t rows, size_t cols, 
+( char ordering, char trans, size_t rows, size_t cols,
   float alpha,
   const float* A, size_t ALDim,
         float* B, size_t BLDim );
@@ -154,11 +298,62 @@ void EL_BLAS(zgemmt)
         dcomplex* C, const BlasInt* CLDim );
 #endif
 
+#ifdef EL_HAVE_MKL_GEMM_BATCH
+void EL_BLAS(sgemm_batch)
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const float* alphaList,
+  const float** AList, const BlasInt* ALDimList,
+  const float** BList, const BlasInt* BLDimList,
+  const float* betaList,
+        float** CList, const BlasInt* CLDimList,
+  const BlasInt* groupCount, const BlasInt* groupSizeList );
+void EL_BLAS(dgemm_batch)
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const double* alphaList,
+  const double** AList, const BlasInt* ALDimList,
+  const double** BList, const BlasInt* BLDimList,
+  const double* betaList,
+        double** CList, const BlasInt* CLDimList,
+  const BlasInt* groupCount, const BlasInt* groupSizeList );
+void EL_BLAS(cgemm_batch)
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const MKL_Complex8* alphaList,
+  const MKL_Complex8** AList, const BlasInt* ALDimList,
+  const MKL_Complex8** BList, const BlasInt* BLDimList,
+  const MKL_Complex8* betaList,
+        MKL_Complex8** CList, const BlasInt* CLDimList,
+  const BlasInt* groupCount, const BlasInt* groupSizeList );
+void EL_BLAS(zgemm_batch)
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const MKL_Complex16* alphaList,
+  const MKL_Complex16** AList, const BlasInt* ALDimList,
+  const MKL_Complex16** BList, const BlasInt* BLDimList,
+  const MKL_Complex16* betaList,
+        MKL_Complex16** CList, const BlasInt* CLDimList,
+  const BlasInt* groupCount, const BlasInt* groupSizeList );
+#endif
+
 } // extern "C"
 
 namespace El {
 namespace mkl {
 
+void SetNumThreads( int numThreads )
+{
+    EL_DEBUG_CSE
+    mkl_set_num_threads( numThreads );
+}
+
+int NumThreads()
+{
+    EL_DEBUG_CSE
+    return mkl_get_max_threads();
+}
+
 // TODO: Ensure that BlasInt is compatible with MKL_INT in the following
 //       routines
 
@@ -239,6 +434,224 @@ void csrmv
       reinterpret_cast<      MKL_Complex16*>(y) );
 }
 
+namespace {
+
+sparse_operation_t SparseOperation( Orientation orientation )
+{
+    if( orientation == NORMAL )
+        return SPARSE_OPERATION_NON_TRANSPOSE;
+    else if( orientation == TRANSPOSE )
+        return SPARSE_OPERATION_TRANSPOSE;
+    else
+        return SPARSE_OPERATION_CONJUGATE_TRANSPOSE;
+}
+
+struct matrix_descr GeneralDescr()
+{
+    struct matrix_descr descr;
+    descr.type = SPARSE_MATRIX_TYPE_GENERAL;
+    descr.mode = SPARSE_FILL_MODE_FULL;
+    descr.diag = SPARSE_DIAG_NON_UNIT;
+    return descr;
+}
+
+void OptimizeSparseCSR( sparse_matrix_t A, BlasInt expectedCalls )
+{
+    struct matrix_descr descr = GeneralDescr();
+    mkl_sparse_set_mv_hint
+    ( A, SPARSE_OPERATION_NON_TRANSPOSE, descr, expectedCalls );
+    mkl_sparse_set_memory_hint( A, SPARSE_MEMORY_AGGRESSIVE );
+    mkl_sparse_optimize( A );
+}
+
+} // anonymous namespace
+
+SparseCSRHandle CreateSparseCSR
+( BlasInt m, BlasInt n,
+  const BlasInt* rowOffsets, const BlasInt* colIndices,
+  const float* values, BlasInt expectedCalls )
+{
+    EL_DEBUG_CSE
+    sparse_matrix_t A;
+    const sparse_status_t status =
+      mkl_sparse_s_create_csr
+      ( &A, SPARSE_INDEX_BASE_ZERO, m, n,
+        const_cast<BlasInt*>(rowOffsets),
+        const_cast<BlasInt*>(rowOffsets+1),
+        const_cast<BlasInt*>(colIndices),
+        const_cast<float*>(values) );
+    if( status != SPARSE_STATUS_SUCCESS )
+        RuntimeError("mkl_sparse_s_create_csr returned ",status);
+    OptimizeSparseCSR( A, expectedCalls );
+    return reinterpret_cast<SparseCSRHandle>(A);
+}
+
+SparseCSRHandle CreateSparseCSR
+( BlasInt m, BlasInt n,
+  const BlasInt* rowOffsets, const BlasInt* colIndices,
+  const double* values, BlasInt expectedCalls )
+{
+    EL_DEBUG_CSE
+    sparse_matrix_t A;
+    const sparse_status_t status =
+      mkl_sparse_d_create_csr
+      ( &A, SPARSE_INDEX_BASE_ZERO, m, n,
+        const_cast<BlasInt*>(rowOffsets),
+        const_cast<BlasInt*>(rowOffsets+1),
+        const_cast<BlasInt*>(colIndices),
+        const_cast<double*>(values) );
+    if( status != SPARSE_STATUS_SUCCESS )
+        RuntimeError("mkl_sparse_d_create_csr returned ",status);
+    OptimizeSparseCSR( A, expectedCalls );
+    return reinterpret_cast<SparseCSRHandle>(A);
+}
+
+SparseCSRHandle CreateSparseCSR
+( BlasInt m, BlasInt n,
+  const BlasInt* rowOffsets, const BlasInt* colIndices,
+  const Complex<float>* values, BlasInt expectedCalls )
+{
+    EL_DEBUG_CSE
+    sparse_matrix_t A;
+    const sparse_status_t status =
+      mkl_sparse_c_create_csr
+      ( &A, SPARSE_INDEX_BASE_ZERO, m, n,
+        const_cast<BlasInt*>(rowOffsets),
+        const_cast<BlasInt*>(rowOffsets+1),
+        const_cast<BlasInt*>(colIndices),
+        reinterpret_cast<MKL_Complex8*>
+        (const_cast<Complex<float>*>(values)) );
+    if( status != SPARSE_STATUS_SUCCESS )
+        RuntimeError("mkl_sparse_c_create_csr returned ",status);
+    OptimizeSparseCSR( A, expectedCalls );
+    return reinterpret_cast<SparseCSRHandle>(A);
+}
+
+SparseCSRHandle CreateSparseCSR
+( BlasInt m, BlasInt n,
+  const BlasInt* rowOffsets, const BlasInt* colIndices,
+  const Complex<double>* values, BlasInt expectedCalls )
+{
+    EL_DEBUG_CSE
+    sparse_matrix_t A;
+    const sparse_status_t status =
+      mkl_sparse_z_create_csr
+      ( &A, SPARSE_INDEX_BASE_ZERO, m, n,
+        const_cast<BlasInt*>(rowOffsets),
+        const_cast<BlasInt*>(rowOffsets+1),
+        const_cast<BlasInt*>(colIndices),
+        reinterpret_cast<MKL_Complex16*>
+        (const_cast<Complex<double>*>(values)) );
+    if( status != SPARSE_STATUS_SUCCESS )
+        RuntimeError("mkl_sparse_z_create_csr returned ",status);
+    OptimizeSparseCSR( A, expectedCalls );
+    return reinterpret_cast<SparseCSRHandle>(A);
+}
+
+void DestroySparseCSR( SparseCSRHandle handle )
+{
+    EL_DEBUG_CSE
+    mkl_sparse_destroy( reinterpret_cast<sparse_matrix_t>(handle) );
+}
+
+void SparseCSRMultiply
+( Orientation orientation, BlasInt numRHS,
+  float alpha, SparseCSRHandle handle,
+  const float* X, BlasInt ldX,
+  float beta, float* Y, BlasInt ldY )
+{
+    EL_DEBUG_CSE
+    sparse_matrix_t A = reinterpret_cast<sparse_matrix_t>(handle);
+    struct matrix_descr descr = GeneralDescr();
+    sparse_status_t status;
+    if( numRHS == 1 )
+        status = mkl_sparse_s_mv
+          ( SparseOperation(orientation), alpha, A, descr, X, beta, Y );
+    else
+        status = mkl_sparse_s_mm
+          ( SparseOperation(orientation), alpha, A, descr,
+            SPARSE_LAYOUT_COLUMN_MAJOR, X, numRHS, ldX, beta, Y, ldY );
+    if( status != SPARSE_STATUS_SUCCESS )
+        RuntimeError("MKL sparse multiply returned ",status);
+}
+
+void SparseCSRMultiply
+( Orientation orientation, BlasInt numRHS,
+  double alpha, SparseCSRHandle handle,
+  const double* X, BlasInt ldX,
+  double beta, double* Y, BlasInt ldY )
+{
+    EL_DEBUG_CSE
+    sparse_matrix_t A = reinterpret_cast<sparse_matrix_t>(handle);
+    struct matrix_descr descr = GeneralDescr();
+    sparse_status_t status;
+    if( numRHS == 1 )
+        status = mkl_sparse_d_mv
+          ( SparseOperation(orientation), alpha, A, descr, X, beta, Y );
+    else
+        status = mkl_sparse_d_mm
+          ( SparseOperation(orientation), alpha, A, descr,
+            SPARSE_LAYOUT_COLUMN_MAJOR, X, numRHS, ldX, beta, Y, ldY );
+    if( status != SPARSE_STATUS_SUCCESS )
+        RuntimeError("MKL sparse multiply returned ",status);
+}
+
+void SparseCSRMultiply
+( Orientation orientation, BlasInt numRHS,
+  Complex<float> alpha, SparseCSRHandle handle,
+  const Complex<float>* X, BlasInt ldX,
+  Complex<float> beta, Complex<float>* Y, BlasInt ldY )
+{
+    EL_DEBUG_CSE
+    sparse_matrix_t A = reinterpret_cast<sparse_matrix_t>(handle);
+    struct matrix_descr descr = GeneralDescr();
+    MKL_Complex8 alphaMKL, betaMKL;
+    alphaMKL.real = alpha.real(); alphaMKL.imag = alpha.imag();
+    betaMKL.real = beta.real(); betaMKL.imag = beta.imag();
+    sparse_status_t status;
+    if( numRHS == 1 )
+        status = mkl_sparse_c_mv
+          ( SparseOperation(orientation), alphaMKL, A, descr,
+            reinterpret_cast<const MKL_Complex8*>(X), betaMKL,
+            reinterpret_cast<MKL_Complex8*>(Y) );
+    else
+        status = mkl_sparse_c_mm
+          ( SparseOperation(orientation), alphaMKL, A, descr,
+            SPARSE_LAYOUT_COLUMN_MAJOR,
+            reinterpret_cast<const MKL_Complex8*>(X), numRHS, ldX, betaMKL,
+            reinterpret_cast<MKL_Complex8*>(Y), ldY );
+    if( status != SPARSE_STATUS_SUCCESS )
+        RuntimeError("MKL sparse multiply returned ",status);
+}
+
+void SparseCSRMultiply
+( Orientation orientation, BlasInt numRHS,
+  Complex<double> alpha, SparseCSRHandle handle,
+  const Complex<double>* X, BlasInt ldX,
+  Complex<double> beta, Complex<double>* Y, BlasInt ldY )
+{
+    EL_DEBUG_CSE
+    sparse_matrix_t A = reinterpret_cast<sparse_matrix_t>(handle);
+    struct matrix_descr descr = GeneralDescr();
+    MKL_Complex16 alphaMKL, betaMKL;
+    alphaMKL.real = alpha.real(); alphaMKL.imag = alpha.imag();
+    betaMKL.real = beta.real(); betaMKL.imag = beta.imag();
+    sparse_status_t status;
+    if( numRHS == 1 )
+        status = mkl_sparse_z_mv
+          ( SparseOperation(orientation), alphaMKL, A, descr,
+            reinterpret_cast<const MKL_Complex16*>(X), betaMKL,
+            reinterpret_cast<MKL_Complex16*>(Y) );
+    else
+        status = mkl_sparse_z_mm
+          ( SparseOperation(orientation), alphaMKL, A, descr,
+            SPARSE_LAYOUT_COLUMN_MAJOR,
+            reinterpret_cast<const MKL_Complex16*>(X), numRHS, ldX, betaMKL,
+            reinterpret_cast<MKL_Complex16*>(Y), ldY );
+    if( status != SPARSE_STATUS_SUCCESS )
+        RuntimeError("MKL sparse multiply returned ",status);
+}
+
 void omatcopy
 ( Orientation orientation, BlasInt m, BlasInt n,
   float alpha, const float* A, BlasInt ALDim,
@@ -458,6 +871,77 @@ void Trrk
 }
 #endif
 
+#ifdef EL_HAVE_MKL_GEMM_BATCH
+void GemmBatch
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const float* alphaList,
+  const float** AList, const BlasInt* ALDimList,
+  const float** BList, const BlasInt* BLDimList,
+  const float* betaList,
+        float** CList, const BlasInt* CLDimList,
+  BlasInt groupCount, const BlasInt* groupSizeList )
+{
+    EL_BLAS(sgemm_batch)
+    ( transAList, transBList, mList, nList, kList,
+      alphaList, AList, ALDimList, BList, BLDimList,
+      betaList,  CList, CLDimList, &groupCount, groupSizeList );
+}
+void GemmBatch
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const double* alphaList,
+  const double** AList, const BlasInt* ALDimList,
+  const double** BList, const BlasInt* BLDimList,
+  const double* betaList,
+        double** CList, const BlasInt* CLDimList,
+  BlasInt groupCount, const BlasInt* groupSizeList )
+{
+    EL_BLAS(dgemm_batch)
+    ( transAList, transBList, mList, nList, kList,
+      alphaList, AList, ALDimList, BList, BLDimList,
+      betaList,  CList, CLDimList, &groupCount, groupSizeList );
+}
+void GemmBatch
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const scomplex* alphaList,
+  const scomplex** AList, const BlasInt* ALDimList,
+  const scomplex** BList, const BlasInt* BLDimList,
+  const scomplex* betaList,
+        scomplex** CList, const BlasInt* CLDimList,
+  BlasInt groupCount, const BlasInt* groupSizeList )
+{
+    EL_BLAS(cgemm_batch)
+    ( transAList, transBList, mList, nList, kList,
+      reinterpret_cast<const MKL_Complex8*>(alphaList),
+      reinterpret_cast<const MKL_Complex8**>(AList), ALDimList,
+      reinterpret_cast<const MKL_Complex8**>(BList), BLDimList,
+      reinterpret_cast<const MKL_Complex8*>(betaList),
+      reinterpret_cast<MKL_Complex8**>(CList), CLDimList,
+      &groupCount, groupSizeList );
+}
+void GemmBatch
+( const char* transAList, const char* transBList,
+  const BlasInt* mList, const BlasInt* nList, const BlasInt* kList,
+  const dcomplex* alphaList,
+  const dcomplex** AList, const BlasInt* ALDimList,
+  const dcomplex** BList, const BlasInt* BLDimList,
+  const dcomplex* betaList,
+        dcomplex** CList, const BlasInt* CLDimList,
+  BlasInt groupCount, const BlasInt* groupSizeList )
+{
+    EL_BLAS(zgemm_batch)
+    ( transAList, transBList, mList, nList, kList,
+      reinterpret_cast<const MKL_Complex16*>(alphaList),
+      reinterpret_cast<const MKL_Complex16**>(AList), ALDimList,
+      reinterpret_cast<const MKL_Complex16**>(BList), BLDimList,
+      reinterpret_cast<const MKL_Complex16*>(betaList),
+      reinterpret_cast<MKL_Complex16**>(CList), CLDimList,
+      &groupCount, groupSizeList );
+}
+#endif
+
 } // namespace mkl
 } // namespace El
 
@@ -11,6 +11,43 @@
 
 namespace El {
 
+namespace {
+
+// A substantial fraction of the runtime of BigFloat-heavy kernels (e.g.,
+// lattice enumeration) can disappear into the allocator behind mpfr_init2
+// and mpfr_clear, as every temporary pays for a fresh limb buffer. We
+// therefore recycle the mpfr structures of destructed BigFloat's through a
+// small thread-local pool. The pool holds a single precision at a time and
+// follows the stream of destructed precisions, so a global precision change
+// simply drains it.
+const int bigFloatPoolCapacity = 256;
+thread_local __mpfr_struct bigFloatPool[bigFloatPoolCapacity];
+thread_local int bigFloatPoolSize = 0;
+thread_local mpfr_prec_t bigFloatPoolPrec = 0;
+// The activity flag is trivially destructible and therefore outlives the
+// guard below, so BigFloat's with static storage duration safely fall back
+// to mpfr_clear after thread-local destruction has drained the pool
+thread_local bool bigFloatPoolActive = false;
+
+struct BigFloatPoolGuard
+{
+    BigFloatPoolGuard() { bigFloatPoolActive = true; }
+    ~BigFloatPoolGuard()
+    {
+        bigFloatPoolActive = false;
+        while( bigFloatPoolSize > 0 )
+            mpfr_clear( &bigFloatPool[--bigFloatPoolSize] );
+    }
+};
+
+void ActivateBigFloatPool()
+{
+    static thread_local BigFloatPoolGuard guard;
+    (void)guard;
+}
+
+} // anonymous namespace
+
 void BigFloat::SetNumLimbs( mpfr_prec_t prec )
 {
     numLimbs_ = (prec-1) / GMP_NUMB_BITS + 1;
@@ -18,7 +55,14 @@ void BigFloat::SetNumLimbs( mpfr_prec_t prec )
 
 void BigFloat::Init( mpfr_prec_t prec )
 {
-    mpfr_init2( mpfrFloat_, prec );
+    if( bigFloatPoolSize > 0 && bigFloatPoolPrec == prec )
+    {
+        mpfrFloat_[0] = bigFloatPool[--bigFloatPoolSize];
+        // Match the state which mpfr_init2 would have produced
+        mpfr_set_nan( mpfrFloat_ );
+    }
+    else
+        mpfr_init2( mpfrFloat_, prec );
     SetNumLimbs( prec );
 }
 
@@ -232,7 +276,22 @@ BigFloat::~BigFloat()
 {
     EL_DEBUG_CSE
     if( Pointer()->_mpfr_d != 0 )
+    {
+        ActivateBigFloatPool();
+        if( bigFloatPoolActive )
+        {
+            const mpfr_prec_t prec = mpfrFloat_->_mpfr_prec;
+            while( bigFloatPoolSize > 0 && bigFloatPoolPrec != prec )
+                mpfr_clear( &bigFloatPool[--bigFloatPoolSize] );
+            if( bigFloatPoolSize < bigFloatPoolCapacity )
+            {
+                bigFloatPoolPrec = prec;
+                bigFloatPool[bigFloatPoolSize++] = mpfrFloat_[0];
+                return;
+            }
+        }
         mpfr_clear( Pointer() );
+    }
 }
 
 void BigFloat::Zero()
@@ -13,9 +13,19 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 typedef unsigned char* UCP;
 
+// Instrument a communication wrapper with the event tracer; this costs a
+// single branch when tracing is disabled, and the communicator-size query is
+// deferred until tracing is known to be enabled
+#define EL_TRACE_MPI(name,bytes,comm) \
+  El::trace::Region traceRegion \
+  ( El::trace::MPI_EVENT, name, (long long)(bytes), comm )
+
 namespace {
 
 inline void
@@ -32,6 +42,21 @@ SafeMpi( int mpiError ) EL_NO_RELEASE_EXCEPT
     )
 }
 
+// The cached intra-node/inter-node decompositions of registered
+// communicators, keyed on the raw MPI handle
+struct NodeSplit
+{
+    El::mpi::Comm nodeComm, crossNodeComm;
+};
+std::map<MPI_Comm,NodeSplit> nodeSplits;
+bool hierarchicalCollectives = false;
+int hierarchicalCollectiveThreshold = 16384;
+
+// Progress engine state (see StartProgressEngine)
+std::atomic<bool> progressEnabled( false );
+std::thread progressThread;
+MPI_Comm progressComm = MPI_COMM_NULL;
+
 template<typename T>
 MPI_Op NativeOp( const El::mpi::Op& op )
 {
@@ -111,6 +136,51 @@ void Abort( Comm comm, int errCode ) EL_NO_EXCEPT
 
 double Time() EL_NO_EXCEPT { return MPI_Wtime(); }
 
+void StartProgressEngine( Comm comm, int pollMicroseconds )
+{
+    EL_DEBUG_CSE
+    if( ::progressEnabled )
+        return;
+    if( QueryThread() != THREAD_MULTIPLE )
+        RuntimeError
+        ("The progress engine polls MPI from a separate thread and so "
+         "requires MPI to have been initialized with THREAD_MULTIPLE "
+         "support (e.g., via a hybrid build of Elemental)");
+    SafeMpi( MPI_Comm_dup( comm.comm, &::progressComm ) );
+    ::progressEnabled = true;
+    ::progressThread = std::thread
+      ( [pollMicroseconds]()
+        {
+          while( ::progressEnabled )
+          {
+              // Any MPI call enters the library's progress engine and
+              // advances all outstanding nonblocking operations; probing a
+              // private duplicate communicator cannot match (or consume)
+              // application traffic
+              int flag;
+              MPI_Status status;
+              MPI_Iprobe
+              ( MPI_ANY_SOURCE, MPI_ANY_TAG, ::progressComm, &flag, &status );
+              std::this_thread::sleep_for
+              ( std::chrono::microseconds(pollMicroseconds) );
+          }
+        } );
+}
+
+void StopProgressEngine()
+{
+    EL_DEBUG_CSE
+    if( !::progressEnabled )
+        return;
+    ::progressEnabled = false;
+    ::progressThread.join();
+    SafeMpi( MPI_Comm_free( &::progressComm ) );
+    ::progressComm = MPI_COMM_NULL;
+}
+
+bool ProgressEngineEnabled() EL_NO_EXCEPT
+{ return ::progressEnabled; }
+
 void Create( UserFunction* func, bool commutes, Op& op ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -401,6 +471,163 @@ void Barrier( Comm comm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Barrier( comm.comm ) );
 }
 
+// One-sided communication
+// =======================
+
+void WindowCreate
+( void* buffer, size_t numBytes, Comm comm, Window& window )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Win_create
+      ( buffer, Aint(numBytes), 1, MPI_INFO_NULL, comm.comm, &window.win ) );
+}
+
+void WindowFree( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Win_free( &window.win ) );
+}
+
+bool SharedMemoryWindowsSupported() EL_NO_EXCEPT
+{
+#if defined(MPI_VERSION) && MPI_VERSION >= 3
+    return true;
+#else
+    return false;
+#endif
+}
+
+void WindowAllocateShared
+( size_t numBytes, Comm comm, Window& window, void*& baseBuf )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#if defined(MPI_VERSION) && MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Win_allocate_shared
+      ( Aint(numBytes), 1, MPI_INFO_NULL, comm.comm, &baseBuf,
+        &window.win ) );
+#else
+    LogicError("Shared-memory windows require MPI-3");
+#endif
+}
+
+void* WindowSharedQuery( int rank, Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    void* baseBuf = nullptr;
+#if defined(MPI_VERSION) && MPI_VERSION >= 3
+    Aint numBytes;
+    int dispUnit;
+    SafeMpi
+    ( MPI_Win_shared_query
+      ( window.win, rank, &numBytes, &dispUnit, &baseBuf ) );
+#else
+    LogicError("Shared-memory windows require MPI-3");
+#endif
+    return baseBuf;
+}
+
+void WindowLock( int rank, Window& window, bool shared )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const int lockType = ( shared ? MPI_LOCK_SHARED : MPI_LOCK_EXCLUSIVE );
+    SafeMpi( MPI_Win_lock( lockType, rank, 0, window.win ) );
+}
+
+void WindowUnlock( int rank, Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Win_unlock( rank, window.win ) );
+}
+
+template<typename Real,typename>
+void Get
+( Real* buf, int count, int target, Aint targetOffset, Window& window )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Get
+      ( buf, count, TypeMap<Real>(),
+        target, targetOffset*Aint(sizeof(Real)), count, TypeMap<Real>(),
+        window.win ) );
+}
+
+template<typename Real,typename>
+void Get
+( Complex<Real>* buf, int count, int target, Aint targetOffset,
+  Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    // Treat the complex entries as pairs of reals so that the operation
+    // remains valid even when the complex MPI datatypes are avoided
+    Get
+    ( reinterpret_cast<Real*>(buf), 2*count, target, 2*targetOffset, window );
+}
+
+template<typename Real,typename>
+void Accumulate
+( const Real* buf, int count, int target, Aint targetOffset, Window& window )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Accumulate
+      ( const_cast<Real*>(buf), count, TypeMap<Real>(),
+        target, targetOffset*Aint(sizeof(Real)), count, TypeMap<Real>(),
+        MPI_SUM, window.win ) );
+}
+
+template<typename Real,typename>
+void Accumulate
+( const Complex<Real>* buf, int count, int target, Aint targetOffset,
+  Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    // A complex sum is an independent sum of the real and imaginary parts
+    Accumulate
+    ( reinterpret_cast<const Real*>(buf), 2*count,
+      target, 2*targetOffset, window );
+}
+
+Int FetchAndAdd( Int value, int target, Aint targetOffset, Window& window )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    Int previous = 0;
+#if defined(MPI_VERSION) && MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Fetch_and_op
+      ( &value, &previous, TypeMap<Int>(),
+        target, targetOffset*Aint(sizeof(Int)), MPI_SUM, window.win ) );
+#else
+    LogicError("FetchAndAdd requires MPI-3");
+#endif
+    return previous;
+}
+
+#define MPI_RMA_PROTO(T) \
+  template void Get \
+  ( T* buf, int count, int target, Aint targetOffset, Window& window ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void Accumulate \
+  ( const T* buf, int count, int target, Aint targetOffset, Window& window ) \
+  EL_NO_RELEASE_EXCEPT;
+
+MPI_RMA_PROTO(int)
+MPI_RMA_PROTO(long int)
+MPI_RMA_PROTO(long long int)
+MPI_RMA_PROTO(float)
+MPI_RMA_PROTO(double)
+MPI_RMA_PROTO(Complex<float>)
+MPI_RMA_PROTO(Complex<double>)
+
+#undef MPI_RMA_PROTO
+
 // Test for completion
 template<typename T>
 bool Test( Request<T>& request ) EL_NO_RELEASE_EXCEPT
@@ -923,6 +1150,8 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    trace::Region traceRegion
+    ( trace::MPI_EVENT, "SendRecv", (long long)(sizeof(Real))*(sc+rc), 2 );
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -939,6 +1168,9 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    trace::Region traceRegion
+    ( trace::MPI_EVENT, "SendRecv",
+      (long long)(sizeof(Complex<Real>))*(sc+rc), 2 );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -983,6 +1215,57 @@ void SendRecv
 EL_NO_RELEASE_EXCEPT
 { TaggedSendRecv( sbuf, sc, to, 0, rbuf, rc, from, ANY_TAG, comm ); }
 
+template<typename T,
+         typename/*=EnableIf<IsPacked<T>>*/>
+void StridedSendRecv
+( const T* sbuf, int sendHeight, int sendWidth, int sendLDim, int to,
+        T* rbuf, int recvHeight, int recvWidth, int recvLDim, int from,
+  Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    Status status;
+    // NOTE: The native datatype is used for complex entries even when
+    //       EL_AVOID_COMPLEX_MPI is defined, as that workaround targets
+    //       reduction operations
+    Datatype sendType =
+      StridedMatrixType<T>( sendHeight, sendWidth, sendLDim );
+    Datatype recvType =
+      StridedMatrixType<T>( recvHeight, recvWidth, recvLDim );
+    SafeMpi
+    ( MPI_Sendrecv
+      ( const_cast<T*>(sbuf), 1, sendType, to,   0,
+        rbuf,                 1, recvType, from, ANY_TAG,
+        comm.comm, &status ) );
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void StridedSendRecv
+( const T* sbuf, int sendHeight, int sendWidth, int sendLDim, int to,
+        T* rbuf, int recvHeight, int recvWidth, int recvLDim, int from,
+  Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    // The serialization into intermediate buffers already requires copies,
+    // so there is nothing to gain from a derived datatype
+    std::vector<T> sendBuf( sendHeight*sendWidth ),
+                   recvBuf( recvHeight*recvWidth );
+    for( int j=0; j<sendWidth; ++j )
+        std::copy
+        ( &sbuf[j*sendLDim], &sbuf[j*sendLDim]+sendHeight,
+          &sendBuf[j*sendHeight] );
+    SendRecv
+    ( sendBuf.data(), sendHeight*sendWidth, to,
+      recvBuf.data(), recvHeight*recvWidth, from, comm );
+    for( int j=0; j<recvWidth; ++j )
+        std::copy
+        ( &recvBuf[j*recvHeight], &recvBuf[j*recvHeight]+recvHeight,
+          &rbuf[j*recvLDim] );
+}
+
 template<typename T>
 T TaggedSendRecv( T sb, int to, int stag, int from, int rtag, Comm comm )
 EL_NO_RELEASE_EXCEPT
@@ -1065,6 +1348,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( Size(comm) == 1 || count == 0 )
         return;
+    EL_TRACE_MPI( "Broadcast", (long long)(sizeof(Real))*count, comm );
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
 }
 
@@ -1076,6 +1360,8 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( Size(comm) == 1 )
         return;
+    EL_TRACE_MPI
+    ( "Broadcast", (long long)(sizeof(Complex<Real>))*count, comm );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
 #else
@@ -1175,6 +1461,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Gather", (long long)(sizeof(Real))*sc, comm );
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1189,6 +1476,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Gather", (long long)(sizeof(Complex<Real>))*sc, comm );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -1416,6 +1704,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllGather", (long long)(sizeof(Real))*sc, comm );
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1440,6 +1729,8 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "AllGather", (long long)(sizeof(Complex<Real>))*sc, comm );
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1496,6 +1787,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllGather", (long long)(sizeof(Real))*sc, comm );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1533,6 +1825,8 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "AllGather", (long long)(sizeof(Complex<Real>))*sc, comm );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1605,6 +1899,46 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename T,
+         typename/*=EnableIf<IsPacked<T>>*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+    // NOTE: Unlike the blocking AllGather, the native datatype is used for
+    //       complex entries even when EL_AVOID_COMPLEX_MPI is defined, as
+    //       that workaround targets reduction operations
+    SafeMpi
+    ( MPI_Iallgatherv
+      ( const_cast<T*>(sbuf), sc, TypeMap<T>(),
+        rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), TypeMap<T>(),
+        comm.comm, &request.backend ) );
+#else
+    AllGather( sbuf, sc, rbuf, rcs, rds, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    // The serialization into intermediate buffers prevents a true
+    // nonblocking variant, so the gather is performed immediately
+    AllGather( sbuf, sc, rbuf, rcs, rds, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Scatter
@@ -1613,6 +1947,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Scatter", (long long)(sizeof(Real))*rc, comm );
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1627,6 +1962,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "Scatter", (long long)(sizeof(Complex<Real>))*rc, comm );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1760,6 +2096,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI( "AllToAll", (long long)(sizeof(Real))*sc, comm );
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1774,6 +2111,8 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_TRACE_MPI
+    ( "AllToAll", (long long)(sizeof(Complex<Real>))*sc, comm );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1930,6 +2269,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( count == 0 )
         return;
+    EL_TRACE_MPI( "Reduce", (long long)(sizeof(Real))*count, comm );
 
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
@@ -1948,6 +2288,8 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( count == 0 )
         return;
+    EL_TRACE_MPI
+    ( "Reduce", (long long)(sizeof(Complex<Real>))*count, comm );
 
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
@@ -2153,6 +2495,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( count != 0 )
     {
+        EL_TRACE_MPI( "AllReduce", (long long)(sizeof(Real))*count, comm );
         MPI_Op opC = NativeOp<Real>( op );
         SafeMpi
         ( MPI_Allreduce
@@ -2170,6 +2513,8 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( count != 0 )
     {
+        EL_TRACE_MPI
+        ( "AllReduce", (long long)(sizeof(Complex<Real>))*count, comm );
 #ifdef EL_AVOID_COMPLEX_MPI
         if( op == SUM )
         {
@@ -2235,6 +2580,86 @@ T AllReduce( T sb, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { return AllReduce( sb, SUM, comm ); }
 
+void EnableHierarchicalCollectives() EL_NO_EXCEPT
+{ ::hierarchicalCollectives = true; }
+void DisableHierarchicalCollectives() EL_NO_EXCEPT
+{ ::hierarchicalCollectives = false; }
+bool HierarchicalCollectivesEnabled() EL_NO_EXCEPT
+{ return ::hierarchicalCollectives; }
+
+int HierarchicalCollectiveThreshold() EL_NO_EXCEPT
+{ return ::hierarchicalCollectiveThreshold; }
+void SetHierarchicalCollectiveThreshold( int numEntries ) EL_NO_EXCEPT
+{ ::hierarchicalCollectiveThreshold = numEntries; }
+
+void SplitIntoNodes
+( Comm comm, Comm& nodeComm, Comm& crossNodeComm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#if defined(MPI_VERSION) && MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, Rank(comm), MPI_INFO_NULL,
+        &nodeComm.comm ) );
+#else
+    // Without MPI_Comm_split_type every process is treated as its own node,
+    // which degrades the staged algorithms to their flat counterparts
+    Split( comm, Rank(comm), 0, nodeComm );
+#endif
+    Split( comm, Rank(nodeComm), Rank(comm), crossNodeComm );
+}
+
+void RegisterNodeSplit( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( ::nodeSplits.count(comm.comm) > 0 )
+        return;
+    NodeSplit split;
+    SplitIntoNodes( comm, split.nodeComm, split.crossNodeComm );
+    ::nodeSplits.emplace( comm.comm, split );
+}
+
+void FreeNodeSplit( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    auto it = ::nodeSplits.find( comm.comm );
+    if( it == ::nodeSplits.end() )
+        return;
+    Free( it->second.nodeComm );
+    Free( it->second.crossNodeComm );
+    ::nodeSplits.erase( it );
+}
+
+namespace {
+
+// Stage an in-place AllReduce shared-memory-first when the routing is
+// enabled, the message is large enough to be bandwidth-bound, and the node
+// decomposition of the communicator was registered (and is nontrivial)
+template<typename T>
+bool TryHierarchicalAllReduce( T* buf, int count, El::mpi::Op op,
+                               El::mpi::Comm comm )
+{
+    using namespace El::mpi;
+    if( !::hierarchicalCollectives ||
+        count < ::hierarchicalCollectiveThreshold )
+        return false;
+    auto it = ::nodeSplits.find( comm.comm );
+    if( it == ::nodeSplits.end() )
+        return false;
+    Comm nodeComm = it->second.nodeComm;
+    Comm crossNodeComm = it->second.crossNodeComm;
+    const int nodeSize = Size( nodeComm );
+    if( nodeSize == 1 || nodeSize == Size(comm) )
+        return false;
+    Reduce( buf, count, op, 0, nodeComm );
+    if( Rank(nodeComm) == 0 )
+        AllReduce( buf, count, op, crossNodeComm );
+    Broadcast( buf, count, 0, nodeComm );
+    return true;
+}
+
+} // anonymous namespace
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllReduce( Real* buf, int count, Op op, Comm comm )
@@ -2243,6 +2668,8 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( count == 0 || Size(comm) == 1 )
         return;
+    if( TryHierarchicalAllReduce( buf, count, op, comm ) )
+        return;
 
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
@@ -2258,6 +2685,8 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( count == 0 || Size(comm) == 1 )
         return;
+    if( TryHierarchicalAllReduce( buf, count, op, comm ) )
+        return;
 
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
@@ -2311,6 +2740,151 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce( Real* buf, int count, Op op, Comm comm,
+  Request<Real>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    AllReduce( buf, count, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        SafeMpi
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
+            comm.comm, &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, comm.comm,
+        &request.backend ) );
+#endif
+#else
+    AllReduce( buf, count, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce( T* buf, int count, Op op, Comm comm,
+  Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    // The serialization into intermediate buffers prevents a true
+    // nonblocking variant, so the reduction is performed immediately
+    AllReduce( buf, count, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
+template<typename T>
+void PersistentAllReduce<T>::Initialize
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    Free();
+    sbuf_ = sbuf;
+    rbuf_ = rbuf;
+    count_ = count;
+    op_ = op;
+    comm_ = comm;
+    initialized_ = true;
+#ifdef EL_HAVE_MPI_PERSISTENT_COLLECTIVES
+    // Only packed datatypes avoid the pack/unpack performed by the
+    // one-shot wrappers and may therefore bind their buffers up front
+    if( IsPacked<T>::value && count != 0 )
+    {
+        MPI_Op opC = NativeOp<T>( op );
+        SafeMpi
+        ( MPI_Allreduce_init
+          ( const_cast<T*>(sbuf), rbuf, count, TypeMap<T>(), opC,
+            comm.comm, MPI_INFO_NULL, &request_ ) );
+        persistent_ = true;
+    }
+#endif
+}
+
+template<typename T>
+void PersistentAllReduce<T>::Free()
+EL_NO_RELEASE_EXCEPT
+{
+    if( persistent_ )
+    {
+        SafeMpi( MPI_Request_free( &request_ ) );
+        persistent_ = false;
+    }
+    initialized_ = false;
+}
+
+template<typename T>
+PersistentAllReduce<T>::~PersistentAllReduce()
+EL_NO_RELEASE_EXCEPT
+{ Free(); }
+
+template<typename T>
+void PersistentAllReduce<T>::Start()
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Persistent AllReduce was not initialized");
+    if( persistent_ )
+    {
+#ifdef EL_HAVE_MPI_PERSISTENT_COLLECTIVES
+        SafeMpi( MPI_Start( &request_ ) );
+#endif
+    }
+    else
+        AllReduce( sbuf_, rbuf_, count_, op_, comm_ );
+}
+
+template<typename T>
+void PersistentAllReduce<T>::Wait()
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( persistent_ )
+    {
+        Status status;
+        SafeMpi( MPI_Wait( &request_, &status ) );
+    }
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
@@ -2319,6 +2893,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( rc == 0 )
         return;
+    EL_TRACE_MPI( "ReduceScatter", (long long)(sizeof(Real))*rc, comm );
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2345,6 +2920,8 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( rc == 0 )
         return;
+    EL_TRACE_MPI
+    ( "ReduceScatter", (long long)(sizeof(Complex<Real>))*rc, comm );
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -2620,6 +3197,97 @@ void VerifySendsAndRecvs
              " but recv'd ",actualRecvCounts[q]," from process ",q);
 }
 
+void FileOpen
+( Comm comm, const char* filename, int accessMode, MPI_File& file )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_File_open
+      ( comm.comm, const_cast<char*>(filename), accessMode,
+        MPI_INFO_NULL, &file ) );
+}
+
+void FileClose( MPI_File& file ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_File_close( &file ) );
+}
+
+MPI_Offset FileGetSize( MPI_File& file ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    MPI_Offset numBytes;
+    SafeMpi( MPI_File_get_size( file, &numBytes ) );
+    return numBytes;
+}
+
+void FileSetSize( MPI_File& file, MPI_Offset numBytes ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_File_set_size( file, numBytes ) );
+}
+
+template<typename T,typename/*=EnableIf<IsPacked<T>>*/>
+void FileSetStridedView( MPI_File& file, MPI_Offset offset, int stride )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    MPI_Aint lowerBound, extent;
+    SafeMpi( MPI_Type_get_extent( TypeMap<T>(), &lowerBound, &extent ) );
+    MPI_Datatype stridedType;
+    SafeMpi
+    ( MPI_Type_create_resized
+      ( TypeMap<T>(), 0, stride*extent, &stridedType ) );
+    SafeMpi( MPI_Type_commit( &stridedType ) );
+    SafeMpi
+    ( MPI_File_set_view
+      ( file, offset, TypeMap<T>(), stridedType,
+        const_cast<char*>("native"), MPI_INFO_NULL ) );
+    SafeMpi( MPI_Type_free( &stridedType ) );
+}
+
+template<typename T,typename/*=EnableIf<IsPacked<T>>*/>
+void FileRead( MPI_File& file, T* buf, int count ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_File_read( file, buf, count, TypeMap<T>(), MPI_STATUS_IGNORE ) );
+}
+
+template<typename T,typename/*=EnableIf<IsPacked<T>>*/>
+void FileWrite( MPI_File& file, const T* buf, int count )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_File_write
+      ( file, const_cast<T*>(buf), count, TypeMap<T>(),
+        MPI_STATUS_IGNORE ) );
+}
+
+template<typename T,typename/*=EnableIf<IsPacked<T>>*/>
+void FileReadAt( MPI_File& file, MPI_Offset offset, T* buf, int count )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_File_read_at
+      ( file, offset, buf, count, TypeMap<T>(), MPI_STATUS_IGNORE ) );
+}
+
+template<typename T,typename/*=EnableIf<IsPacked<T>>*/>
+void FileWriteAt
+( MPI_File& file, MPI_Offset offset, const T* buf, int count )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_File_write_at
+      ( file, offset, const_cast<T*>(buf), count, TypeMap<T>(),
+        MPI_STATUS_IGNORE ) );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Scan( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
@@ -2845,6 +3513,193 @@ EL_NO_RELEASE_EXCEPT
 #endif
 }
 
+// Large-count interface
+// =====================
+// When the MPI-4 large-count routines are unavailable, the transfers are
+// split into pieces small enough for the classical interface; the pieces
+// are dispatched through the 32-bit wrappers above so that serialization
+// and the complex-datatype workarounds are inherited
+namespace {
+
+const long long largeCountChunk = 1ll<<30;
+
+} // anonymous namespace
+
+template<typename T>
+void Send( const T* buf, long long count, int to, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI_LARGE_COUNT
+    if( IsPacked<T>::value )
+    {
+        EL_TRACE_MPI( "Send", (long long)(sizeof(T))*count, comm );
+        SafeMpi
+        ( MPI_Send_c
+          ( buf, MPI_Count(count), TypeMap<T>(), to, 0, comm.comm ) );
+        return;
+    }
+#endif
+    long long off = 0;
+    while( off < count )
+    {
+        const int chunk = int(Min(count-off,largeCountChunk));
+        Send( buf+off, chunk, to, comm );
+        off += chunk;
+    }
+}
+
+template<typename T>
+void Recv( T* buf, long long count, int from, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI_LARGE_COUNT
+    if( IsPacked<T>::value )
+    {
+        EL_TRACE_MPI( "Recv", (long long)(sizeof(T))*count, comm );
+        Status status;
+        SafeMpi
+        ( MPI_Recv_c
+          ( buf, MPI_Count(count), TypeMap<T>(), from, ANY_TAG, comm.comm,
+            &status ) );
+        return;
+    }
+#endif
+    long long off = 0;
+    while( off < count )
+    {
+        const int chunk = int(Min(count-off,largeCountChunk));
+        Recv( buf+off, chunk, from, comm );
+        off += chunk;
+    }
+}
+
+template<typename T>
+void Broadcast( T* buf, long long count, int root, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI_LARGE_COUNT
+    if( IsPacked<T>::value )
+    {
+        if( Size(comm) == 1 || count == 0 )
+            return;
+        EL_TRACE_MPI( "Broadcast", (long long)(sizeof(T))*count, comm );
+        SafeMpi
+        ( MPI_Bcast_c
+          ( buf, MPI_Count(count), TypeMap<T>(), root, comm.comm ) );
+        return;
+    }
+#endif
+    long long off = 0;
+    while( off < count )
+    {
+        const int chunk = int(Min(count-off,largeCountChunk));
+        Broadcast( buf+off, chunk, root, comm );
+        off += chunk;
+    }
+}
+
+template<typename T>
+void AllGather
+( const T* sbuf, long long sc,
+        T* rbuf, long long rc, Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( sc != rc )
+          LogicError("Expected matching send and recv counts");
+    )
+#ifdef EL_HAVE_MPI_LARGE_COUNT
+    if( IsPacked<T>::value )
+    {
+        EL_TRACE_MPI( "AllGather", (long long)(sizeof(T))*sc, comm );
+        SafeMpi
+        ( MPI_Allgather_c
+          ( const_cast<T*>(sbuf), MPI_Count(sc), TypeMap<T>(),
+            rbuf,                 MPI_Count(rc), TypeMap<T>(), comm.comm ) );
+        return;
+    }
+#endif
+    if( sc <= largeCountChunk )
+    {
+        AllGather( sbuf, int(sc), rbuf, int(rc), comm );
+        return;
+    }
+    // Gather the pieces through a contiguous staging buffer and scatter
+    // them into their strided destinations
+    const int commSize = Size(comm);
+    const long long chunkBound =
+      Max( largeCountChunk/commSize, (long long)1 );
+    std::vector<T> staged;
+    long long off = 0;
+    while( off < rc )
+    {
+        const int chunk = int(Min(rc-off,chunkBound));
+        staged.resize( (long long)chunk*commSize );
+        AllGather( sbuf+off, chunk, staged.data(), chunk, comm );
+        for( int q=0; q<commSize; ++q )
+            MemCopy( rbuf+q*rc+off, staged.data()+(long long)q*chunk, chunk );
+        off += chunk;
+    }
+}
+
+template<typename T>
+void AllReduce
+( const T* sbuf, T* rbuf, long long count, Op op, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI_LARGE_COUNT
+    if( IsPacked<T>::value )
+    {
+        if( count == 0 )
+            return;
+        EL_TRACE_MPI( "AllReduce", (long long)(sizeof(T))*count, comm );
+        SafeMpi
+        ( MPI_Allreduce_c
+          ( const_cast<T*>(sbuf), rbuf, MPI_Count(count), TypeMap<T>(),
+            NativeOp<T>( op ), comm.comm ) );
+        return;
+    }
+#endif
+    long long off = 0;
+    while( off < count )
+    {
+        const int chunk = int(Min(count-off,largeCountChunk));
+        AllReduce( sbuf+off, rbuf+off, chunk, op, comm );
+        off += chunk;
+    }
+}
+
+template<typename T>
+void AllReduce( T* buf, long long count, Op op, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI_LARGE_COUNT
+    if( IsPacked<T>::value )
+    {
+        if( count == 0 || Size(comm) == 1 )
+            return;
+        EL_TRACE_MPI( "AllReduce", (long long)(sizeof(T))*count, comm );
+        SafeMpi
+        ( MPI_Allreduce_c
+          ( MPI_IN_PLACE, buf, MPI_Count(count), TypeMap<T>(),
+            NativeOp<T>( op ), comm.comm ) );
+        return;
+    }
+#endif
+    long long off = 0;
+    while( off < count )
+    {
+        const int chunk = int(Min(count-off,largeCountChunk));
+        AllReduce( buf+off, chunk, op, comm );
+        off += chunk;
+    }
+}
+
 #define MPI_PROTO(T) \
   template bool Test( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
   template void Wait( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
@@ -2991,6 +3846,7 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce( T* buf, int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template class PersistentAllReduce<T>; \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm ) \
@@ -3020,6 +3876,20 @@ EL_NO_RELEASE_EXCEPT
   template void Scan( T* buf, int count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void Scan( T* buf, int count, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void Send( const T* buf, long long count, int to, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void Recv( T* buf, long long count, int from, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void Broadcast( T* buf, long long count, int root, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void AllGather \
+  ( const T* sbuf, long long sc, \
+          T* rbuf, long long rc, Comm comm ) EL_NO_RELEASE_EXCEPT; \
+  template void AllReduce \
+  ( const T* sbuf, T* rbuf, long long count, Op op, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void AllReduce( T* buf, long long count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT;
 
 MPI_PROTO(byte)
@@ -3079,6 +3949,151 @@ MPI_PROTO(Entry<BigFloat>)
 MPI_PROTO(Entry<Complex<BigFloat>>)
 #endif
 
+// The nonblocking allgather falls back to an immediate blocking gather for
+// datatypes which require serialization
+#define MPI_IALLGATHER_PROTO(T) \
+  template void IAllGather \
+  ( const T* sbuf, int sc, \
+          T* rbuf, const int* rcs, const int* rds, Comm comm, \
+    Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+MPI_IALLGATHER_PROTO(byte)
+MPI_IALLGATHER_PROTO(int)
+MPI_IALLGATHER_PROTO(unsigned)
+MPI_IALLGATHER_PROTO(long int)
+MPI_IALLGATHER_PROTO(unsigned long)
+#ifdef EL_HAVE_MPI_LONG_LONG
+MPI_IALLGATHER_PROTO(long long int)
+MPI_IALLGATHER_PROTO(unsigned long long)
+#endif
+MPI_IALLGATHER_PROTO(float)
+MPI_IALLGATHER_PROTO(Complex<float>)
+MPI_IALLGATHER_PROTO(double)
+MPI_IALLGATHER_PROTO(Complex<double>)
+#ifdef EL_HAVE_QD
+MPI_IALLGATHER_PROTO(DoubleDouble)
+MPI_IALLGATHER_PROTO(QuadDouble)
+MPI_IALLGATHER_PROTO(Complex<DoubleDouble>)
+MPI_IALLGATHER_PROTO(Complex<QuadDouble>)
+#endif
+#ifdef EL_HAVE_QUAD
+MPI_IALLGATHER_PROTO(Quad)
+MPI_IALLGATHER_PROTO(Complex<Quad>)
+#endif
+#ifdef EL_HAVE_MPC
+MPI_IALLGATHER_PROTO(BigInt)
+MPI_IALLGATHER_PROTO(BigFloat)
+MPI_IALLGATHER_PROTO(Complex<BigFloat>)
+#endif
+
+// The nonblocking allreduce likewise falls back to an immediate blocking
+// reduction for datatypes which require serialization
+#define MPI_IALLREDUCE_PROTO(T) \
+  template void IAllReduce \
+  ( T* buf, int count, Op op, Comm comm, Request<T>& request ) \
+    EL_NO_RELEASE_EXCEPT;
+MPI_IALLREDUCE_PROTO(byte)
+MPI_IALLREDUCE_PROTO(int)
+MPI_IALLREDUCE_PROTO(unsigned)
+MPI_IALLREDUCE_PROTO(long int)
+MPI_IALLREDUCE_PROTO(unsigned long)
+#ifdef EL_HAVE_MPI_LONG_LONG
+MPI_IALLREDUCE_PROTO(long long int)
+MPI_IALLREDUCE_PROTO(unsigned long long)
+#endif
+MPI_IALLREDUCE_PROTO(float)
+MPI_IALLREDUCE_PROTO(Complex<float>)
+MPI_IALLREDUCE_PROTO(double)
+MPI_IALLREDUCE_PROTO(Complex<double>)
+#ifdef EL_HAVE_QD
+MPI_IALLREDUCE_PROTO(DoubleDouble)
+MPI_IALLREDUCE_PROTO(QuadDouble)
+MPI_IALLREDUCE_PROTO(Complex<DoubleDouble>)
+MPI_IALLREDUCE_PROTO(Complex<QuadDouble>)
+#endif
+#ifdef EL_HAVE_QUAD
+MPI_IALLREDUCE_PROTO(Quad)
+MPI_IALLREDUCE_PROTO(Complex<Quad>)
+#endif
+#ifdef EL_HAVE_MPC
+MPI_IALLREDUCE_PROTO(BigInt)
+MPI_IALLREDUCE_PROTO(BigFloat)
+MPI_IALLREDUCE_PROTO(Complex<BigFloat>)
+#endif
+
+// The strided exchange routes through cached derived datatypes for packed
+// datatypes and packs into intermediate buffers otherwise
+#define MPI_STRIDED_SENDRECV_PROTO(T) \
+  template void StridedSendRecv \
+  ( const T* sbuf, int sendHeight, int sendWidth, int sendLDim, int to, \
+          T* rbuf, int recvHeight, int recvWidth, int recvLDim, int from, \
+    Comm comm ) EL_NO_RELEASE_EXCEPT;
+MPI_STRIDED_SENDRECV_PROTO(byte)
+MPI_STRIDED_SENDRECV_PROTO(int)
+MPI_STRIDED_SENDRECV_PROTO(unsigned)
+MPI_STRIDED_SENDRECV_PROTO(long int)
+MPI_STRIDED_SENDRECV_PROTO(unsigned long)
+#ifdef EL_HAVE_MPI_LONG_LONG
+MPI_STRIDED_SENDRECV_PROTO(long long int)
+MPI_STRIDED_SENDRECV_PROTO(unsigned long long)
+#endif
+MPI_STRIDED_SENDRECV_PROTO(float)
+MPI_STRIDED_SENDRECV_PROTO(Complex<float>)
+MPI_STRIDED_SENDRECV_PROTO(double)
+MPI_STRIDED_SENDRECV_PROTO(Complex<double>)
+#ifdef EL_HAVE_QD
+MPI_STRIDED_SENDRECV_PROTO(DoubleDouble)
+MPI_STRIDED_SENDRECV_PROTO(QuadDouble)
+MPI_STRIDED_SENDRECV_PROTO(Complex<DoubleDouble>)
+MPI_STRIDED_SENDRECV_PROTO(Complex<QuadDouble>)
+#endif
+#ifdef EL_HAVE_QUAD
+MPI_STRIDED_SENDRECV_PROTO(Quad)
+MPI_STRIDED_SENDRECV_PROTO(Complex<Quad>)
+#endif
+#ifdef EL_HAVE_MPC
+MPI_STRIDED_SENDRECV_PROTO(BigInt)
+MPI_STRIDED_SENDRECV_PROTO(BigFloat)
+MPI_STRIDED_SENDRECV_PROTO(Complex<BigFloat>)
+#endif
+
+// The MPI-IO wrappers are only defined for packed datatypes
+#define MPI_FILE_PROTO(T) \
+  template void FileSetStridedView<T> \
+  ( MPI_File& file, MPI_Offset offset, int stride ) EL_NO_RELEASE_EXCEPT; \
+  template void FileRead \
+  ( MPI_File& file, T* buf, int count ) EL_NO_RELEASE_EXCEPT; \
+  template void FileWrite \
+  ( MPI_File& file, const T* buf, int count ) EL_NO_RELEASE_EXCEPT; \
+  template void FileReadAt \
+  ( MPI_File& file, MPI_Offset offset, T* buf, int count ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void FileWriteAt \
+  ( MPI_File& file, MPI_Offset offset, const T* buf, int count ) \
+  EL_NO_RELEASE_EXCEPT;
+MPI_FILE_PROTO(byte)
+MPI_FILE_PROTO(int)
+MPI_FILE_PROTO(unsigned)
+MPI_FILE_PROTO(long int)
+MPI_FILE_PROTO(unsigned long)
+#ifdef EL_HAVE_MPI_LONG_LONG
+MPI_FILE_PROTO(long long int)
+MPI_FILE_PROTO(unsigned long long)
+#endif
+MPI_FILE_PROTO(float)
+MPI_FILE_PROTO(Complex<float>)
+MPI_FILE_PROTO(double)
+MPI_FILE_PROTO(Complex<double>)
+#ifdef EL_HAVE_QD
+MPI_FILE_PROTO(DoubleDouble)
+MPI_FILE_PROTO(QuadDouble)
+MPI_FILE_PROTO(Complex<DoubleDouble>)
+MPI_FILE_PROTO(Complex<QuadDouble>)
+#endif
+#ifdef EL_HAVE_QUAD
+MPI_FILE_PROTO(Quad)
+MPI_FILE_PROTO(Complex<Quad>)
+#endif
+
 #define PROTO(T) \
   template void SparseAllToAll \
   ( const vector<T>& sendBuffer, \
@@ -32,17 +32,61 @@ int pmrrr
 
 } // extern "C"
 
+namespace {
+
+int pmrrrNumThreads = -1;
+
+} // anonymous namespace
+
 namespace El {
 namespace herm_tridiag_eig {
 
+void SetNumThreads( int numThreads )
+{ ::pmrrrNumThreads = numThreads; }
+
+int NumThreads()
+{
+    if( ::pmrrrNumThreads > 0 )
+        return ::pmrrrNumThreads;
+    const char* pmrVar = std::getenv( "PMR_NUM_THREADS" );
+    if( pmrVar != nullptr )
+        return Max( atoi(pmrVar), 1 );
+#ifdef EL_HYBRID
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+namespace {
+
+// PMRRR contains a pthread layer which executes the tasks of its
+// representation tree with multiple worker threads per rank, but it only
+// engages when PMR_NUM_THREADS is set in the environment (and MPI was
+// initialized with at least MPI_THREAD_FUNNELED, which hybrid builds of
+// Elemental request). Since PMRRR re-reads the variable on every call and
+// spawns its workers lazily, publishing the requested count just-in-time
+// is sufficient. The worker threads call PMRRR's internal (sequential)
+// tridiagonal kernels rather than the BLAS, so they do not contend with
+// the BLAS thread pool.
+void ConfigureThreading()
+{
+    const int numThreads = NumThreads();
+    if( numThreads > 1 )
+        setenv( "PMR_NUM_THREADS", std::to_string(numThreads).c_str(), 1 );
+}
+
+} // anonymous namespace
+
 // Return upper bounds on the number of (local) eigenvalues in the given range,
 // (lowerBound,upperBound]
 Estimate EigEstimate
-( int n, double* d, double* e, double* w, mpi::Comm comm, 
+( int n, double* d, double* e, double* w, mpi::Comm comm,
   double lowerBound, double upperBound )
 {
     EL_DEBUG_CSE
     Estimate estimate;
+    ConfigureThreading();
     char jobz='C';
     char range='V';
     int il, iu;
@@ -66,6 +110,7 @@ Info Eig( int n, double* d, double* e, double* w, mpi::Comm comm )
 {
     EL_DEBUG_CSE
     Info info;
+    ConfigureThreading();
     char jobz='N';
     char range='A';
     double vl, vu;
@@ -92,6 +137,7 @@ Info Eig
 {
     EL_DEBUG_CSE
     Info info;
+    ConfigureThreading();
     char jobz='V';
     char range='A';
     double vl, vu;
@@ -118,6 +164,7 @@ Info Eig
 {
     EL_DEBUG_CSE
     Info info;
+    ConfigureThreading();
     char jobz='N';
     char range='V';
     int il, iu;
@@ -144,6 +191,7 @@ Info Eig
 {
     EL_DEBUG_CSE
     Info info;
+    ConfigureThreading();
     char jobz='V';
     char range='V';
     int il, iu;
@@ -169,6 +217,7 @@ Info Eig
 {
     EL_DEBUG_CSE
     Info info;
+    ConfigureThreading();
     ++lowerBound;
     ++upperBound;
     char jobz='N';
@@ -198,6 +247,7 @@ Info Eig
 {
     EL_DEBUG_CSE
     Info info;
+    ConfigureThreading();
     ++lowerBound;
     ++upperBound;
     char jobz='V';
@@ -23,9 +23,12 @@ int argcSave;
 char** argvSave;
 
 bool guiDisabled;
+bool asyncGui = false;
 bool elemInitializedQt = false;
+bool elemCopiedArguments = false;
 bool elemOpenedWindow = false;
 QCoreApplication* coreApp;
+std::function<void()> asyncGuiCleanup;
 bool haveMinRealWindowVal=false, haveMaxRealWindowVal=false,
      haveMinImagWindowVal=false, haveMaxImagWindowVal=false;
 double minRealWindowVal, maxRealWindowVal,
@@ -39,6 +42,18 @@ namespace El {
 bool GuiDisabled()
 { return ::guiDisabled; }
 
+bool AsyncGui()
+{ return ::asyncGui; }
+
+int& QtArgc()
+{ return ::argcSave; }
+
+char**& QtArgv()
+{ return ::argvSave; }
+
+void RegisterAsyncGuiCleanup( std::function<void()> cleanup )
+{ ::asyncGuiCleanup = cleanup; }
+
 void OpenedWindow()
 { ::elemOpenedWindow = true; }
 
@@ -115,11 +130,18 @@ void InitializeQt5( int& argc, char**& argv )
     ::coreApp = QCoreApplication::instance();
     if( ::coreApp == 0 )
     {
-        // Test for whether the GUI should be disabled
+        // Test for whether the GUI should be disabled or rendered off-thread
         ::guiDisabled = false;
+        ::asyncGui = false;
         for( int i=1; i<argc; ++i )
+        {
             if( !qstrcmp(argv[i],"-no-gui") )
                 ::guiDisabled = true;
+            else if( !qstrcmp(argv[i],"-async-gui") )
+                ::asyncGui = true;
+        }
+        if( ::guiDisabled )
+            ::asyncGui = false;
 
         ::argcSave = argc;
         ::argvSave = new char*[argc+1];
@@ -129,17 +151,35 @@ void InitializeQt5( int& argc, char**& argv )
             std::strcpy( ::argvSave[i], argv[i] );
         }
        ::argvSave[argc] = nullptr;
+        ::elemCopiedArguments = true;
 
-        if( ::guiDisabled )
+        if( ::asyncGui )
+        {
+            // The render thread must own the application object, so its
+            // construction is deferred until the thread is started by the
+            // first published frame
+        }
+        else if( ::guiDisabled )
+        {
             ::coreApp = new QCoreApplication( ::argcSave, ::argvSave );
+            ::elemInitializedQt = true;
+        }
         else
+        {
             ::coreApp = new QApplication( ::argcSave, ::argvSave );
-        ::elemInitializedQt = true;
+            ::elemInitializedQt = true;
+        }
     }
 }
 
 void FinalizeQt5()
 {
+    // Shut down the render thread (and its application object) first
+    if( ::asyncGuiCleanup )
+    {
+        ::asyncGuiCleanup();
+        ::asyncGuiCleanup = function<void()>();
+    }
     if( ::elemInitializedQt )
     {
         if( ::elemOpenedWindow )
@@ -147,10 +187,12 @@ void FinalizeQt5()
         else
             ::coreApp->exit();
         delete ::coreApp;
-
+    }
+    if( ::elemCopiedArguments )
+    {
         // Delete the copies of argc and argv
         for( int i=0; i< ::argcSave; ++i )
-            delete[] ::argvSave[i]; 
+            delete[] ::argvSave[i];
         delete[] ::argvSave;
     }
 }
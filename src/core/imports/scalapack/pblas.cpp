@@ -190,6 +190,33 @@ void EL_SCALAPACK(pzgemm)
   const dcomplex* beta,
   const dcomplex* C, const int* iC, const int* jC, const int* descC );
 
+// Herk
+// ----
+void EL_SCALAPACK(pssyrk)
+( const char* uplo, const char* trans, const int* n, const int* k,
+  const float* alpha,
+  const float* A, const int* iA, const int* jA, const int* descA,
+  const float* beta,
+  const float* C, const int* iC, const int* jC, const int* descC );
+void EL_SCALAPACK(pdsyrk)
+( const char* uplo, const char* trans, const int* n, const int* k,
+  const double* alpha,
+  const double* A, const int* iA, const int* jA, const int* descA,
+  const double* beta,
+  const double* C, const int* iC, const int* jC, const int* descC );
+void EL_SCALAPACK(pcherk)
+( const char* uplo, const char* trans, const int* n, const int* k,
+  const float* alpha,
+  const scomplex* A, const int* iA, const int* jA, const int* descA,
+  const float* beta,
+  const scomplex* C, const int* iC, const int* jC, const int* descC );
+void EL_SCALAPACK(pzherk)
+( const char* uplo, const char* trans, const int* n, const int* k,
+  const double* alpha,
+  const dcomplex* A, const int* iA, const int* jA, const int* descA,
+  const double* beta,
+  const dcomplex* C, const int* iC, const int* jC, const int* descC );
+
 // Trmm
 // ----
 void EL_SCALAPACK(pstrmm)
@@ -506,11 +533,61 @@ void Gemm
       &beta,  C, &iC, &jC, descC );
 }
 
+// Herk
+// ----
+void Herk
+( char uplo, char trans, int n, int k,
+  float alpha, const float* A, const int* descA,
+  float beta,        float* C, const int* descC )
+{
+    int iA=1, jA=1, iC=1, jC=1;
+    EL_SCALAPACK(pssyrk)
+    ( &uplo, &trans, &n, &k,
+      &alpha, A, &iA, &jA, descA,
+      &beta,  C, &iC, &jC, descC );
+}
+
+void Herk
+( char uplo, char trans, int n, int k,
+  double alpha, const double* A, const int* descA,
+  double beta,        double* C, const int* descC )
+{
+    int iA=1, jA=1, iC=1, jC=1;
+    EL_SCALAPACK(pdsyrk)
+    ( &uplo, &trans, &n, &k,
+      &alpha, A, &iA, &jA, descA,
+      &beta,  C, &iC, &jC, descC );
+}
+
+void Herk
+( char uplo, char trans, int n, int k,
+  float alpha, const scomplex* A, const int* descA,
+  float beta,        scomplex* C, const int* descC )
+{
+    int iA=1, jA=1, iC=1, jC=1;
+    EL_SCALAPACK(pcherk)
+    ( &uplo, &trans, &n, &k,
+      &alpha, A, &iA, &jA, descA,
+      &beta,  C, &iC, &jC, descC );
+}
+
+void Herk
+( char uplo, char trans, int n, int k,
+  double alpha, const dcomplex* A, const int* descA,
+  double beta,        dcomplex* C, const int* descC )
+{
+    int iA=1, jA=1, iC=1, jC=1;
+    EL_SCALAPACK(pzherk)
+    ( &uplo, &trans, &n, &k,
+      &alpha, A, &iA, &jA, descA,
+      &beta,  C, &iC, &jC, descC );
+}
+
 // Trmm
 // ----
 void Trmm
-( char side, char uplo, char trans, char diag, int m, int n, 
-  float alpha, const float* A, const int* descA, 
+( char side, char uplo, char trans, char diag, int m, int n,
+  float alpha, const float* A, const int* descA,
                      float* B, const int* descB )
 { 
     int iA=1, jA=1, iB=1, jB=1;
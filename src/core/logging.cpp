@@ -2,18 +2,99 @@
    Copyright (c) 2009-2016, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <chrono>
+#include <condition_variable>
 #include <iomanip>
+#include <mutex>
+#include <thread>
 
 namespace {
 
 // A (per-process) output file for logging
 std::ofstream logFile;
 
+// Which ranks log, and how verbosely. Records are dropped before any
+// formatting occurs, so filtered-out instrumentation costs a single branch.
+El::Int logVerbosity = 0;
+std::function<bool(int)> logRankFilter;
+
+// The asynchronous double-buffered backend: producers timestamp their
+// records and append them to the front buffer under a brief lock, and a
+// dedicated writer thread swaps the buffers and performs the actual I/O so
+// that file-system stalls never block the solver
+struct LogRecord
+{
+    double time;
+    std::string msg;
+};
+std::vector<LogRecord> logFrontBuf, logDrainBuf;
+std::mutex logMutex;
+std::condition_variable logCondVar;
+std::thread logWriter;
+bool logAsync = false;
+bool logShutdown = false;
+double logStartTime = 0;
+
+double LogTime()
+{
+    using namespace std::chrono;
+    return duration<double>( steady_clock::now().time_since_epoch() ).count();
+}
+
+// Assumes that the drain buffer is owned by the calling thread
+void DrainLogBuffer( std::ostream& os )
+{
+    for( const auto& record : logDrainBuf )
+        os << "[" << std::fixed << std::setprecision(6)
+           << record.time-logStartTime << "] " << record.msg << "\n";
+    os.flush();
+    logDrainBuf.clear();
+}
+
+void LogWriterLoop()
+{
+    std::unique_lock<std::mutex> lock( logMutex );
+    while( !logShutdown || !logFrontBuf.empty() )
+    {
+        if( logFrontBuf.empty() )
+        {
+            logCondVar.wait( lock );
+            continue;
+        }
+        std::swap( logFrontBuf, logDrainBuf );
+        lock.unlock();
+        DrainLogBuffer( El::LogOS() );
+        lock.lock();
+    }
+}
+
+void StopLogWriter()
+{
+    if( !logWriter.joinable() )
+        return;
+    {
+        std::lock_guard<std::mutex> lock( logMutex );
+        logShutdown = true;
+    }
+    logCondVar.notify_one();
+    logWriter.join();
+    logShutdown = false;
+    logAsync = false;
+}
+
+// Ensure that any remaining records are flushed even if the user neither
+// disabled asynchronous logging nor called CloseLog
+struct LogWriterGuard
+{
+    ~LogWriterGuard() { StopLogWriter(); }
+};
+LogWriterGuard logWriterGuard;
+
 }
 
 namespace El {
@@ -34,9 +115,59 @@ std::ostream& LogOS()
                << mpi::Rank() << ".log";
         ::logFile.open( fileOS.str().c_str() );
     }
-    return ::logFile; 
+    return ::logFile;
+}
+
+void CloseLog()
+{
+    ::StopLogWriter();
+    ::logFile.close();
+}
+
+void EnableAsynchronousLogging( bool async )
+{
+    if( async == ::logAsync )
+        return;
+    if( async )
+    {
+        ::logStartTime = ::LogTime();
+        ::logAsync = true;
+        ::logWriter = std::thread( ::LogWriterLoop );
+    }
+    else
+        ::StopLogWriter();
+}
+
+bool AsynchronousLogging() { return ::logAsync; }
+
+void SetLogVerbosity( Int verbosity ) { ::logVerbosity = verbosity; }
+
+Int LogVerbosity() { return ::logVerbosity; }
+
+void SetLogRankFilter( std::function<bool(int)> filter )
+{ ::logRankFilter = std::move(filter); }
+
+bool ShouldLog( Int level )
+{
+    if( level > ::logVerbosity )
+        return false;
+    if( ::logRankFilter && !::logRankFilter(mpi::Rank()) )
+        return false;
+    return true;
 }
 
-void CloseLog() { ::logFile.close(); }
+void WriteLog( const std::string& msg )
+{
+    if( ::logAsync )
+    {
+        {
+            std::lock_guard<std::mutex> lock( ::logMutex );
+            ::logFrontBuf.push_back( ::LogRecord{::LogTime(),msg} );
+        }
+        ::logCondVar.notify_one();
+    }
+    else
+        LogOS() << msg << std::endl;
+}
 
 } // namespace El
@@ -410,11 +410,10 @@ EL_NO_EXCEPT
     auto inData  = static_cast<const T*>(inVoid);
     auto outData = static_cast<      T*>(outVoid);
     const int length = *lengthPtr;
+    // A branch-free select compiles down to (vectorizable) conditional
+    // moves rather than data-dependent branches
     for( int j=0; j<length; ++j )
-    {
-        if( inData[j] > outData[j] )
-            outData[j] = inData[j];
-    }
+        outData[j] = ( inData[j] > outData[j] ? inData[j] : outData[j] );
 }
 template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
 static void
@@ -445,10 +444,7 @@ EL_NO_EXCEPT
     auto outData = static_cast<      T*>(outVoid);
     const int length = *lengthPtr;
     for( int j=0; j<length; ++j )
-    {
-        if( inData[j] < outData[j] )
-            outData[j] = inData[j];
-    }
+        outData[j] = ( inData[j] < outData[j] ? inData[j] : outData[j] );
 }
 template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
 static void
@@ -470,6 +466,30 @@ EL_NO_EXCEPT
     }
 }
 
+template<typename T,typename=EnableIf<IsPacked<T>>>
+static void
+SumKernel( const T* inData, T* outData, int length ) EL_NO_EXCEPT
+{
+    EL_SIMD
+    for( int j=0; j<length; ++j )
+        outData[j] += inData[j];
+}
+// Complex sums are componentwise, so reinterpreting the buffers as twice
+// as many reals exposes a contiguous loop the compiler can vectorize
+// (std::complex guarantees the array-compatible layout)
+template<typename Real,
+         typename=EnableIf<IsBlasScalar<Complex<Real>>>>
+static void
+SumKernel( const Complex<Real>* inData, Complex<Real>* outData, int length )
+EL_NO_EXCEPT
+{
+    auto in  = reinterpret_cast<const Real*>(inData);
+    auto out = reinterpret_cast<      Real*>(outData);
+    EL_SIMD
+    for( int j=0; j<2*length; ++j )
+        out[j] += in[j];
+}
+
 template<typename T,typename=EnableIf<IsPacked<T>>>
 static void
 SumFunc( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
@@ -477,9 +497,7 @@ EL_NO_EXCEPT
 {
     auto inData  = static_cast<const T*>(inVoid);
     auto outData = static_cast<      T*>(outVoid);
-    const int length = *lengthPtr;
-    for( int j=0; j<length; ++j )
-        outData[j] += inData[j];
+    SumKernel( inData, outData, *lengthPtr );
 }
 template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
 static void
@@ -508,6 +526,7 @@ EL_NO_EXCEPT
     auto inData  = static_cast<const T*>(inVoid);
     auto outData = static_cast<      T*>(outVoid);
     const int length = *lengthPtr;
+    EL_SIMD
     for( int j=0; j<length; ++j )
         outData[j] *= inData[j];
 }
@@ -538,14 +557,19 @@ EL_NO_EXCEPT
     auto inData  = static_cast<const ValueInt<T>*>(inVoid);
     auto outData = static_cast<      ValueInt<T>*>(outVoid);
     const int length = *lengthPtr;
+    // Select both fields in a single branch-free pass: the pivot searches
+    // reduce long runs of these pairs, where a data-dependent branch would
+    // be frequently mispredicted
     for( int j=0; j<length; ++j )
     {
         const T inVal = inData[j].value;
         const T outVal = outData[j].value;
         const Int inInd = inData[j].index;
         const Int outInd = outData[j].index;
-        if( inVal > outVal || (inVal == outVal && inInd < outInd) )
-            outData[j] = inData[j];
+        const bool take =
+          inVal > outVal || (inVal == outVal && inInd < outInd);
+        outData[j].value = ( take ? inVal : outVal );
+        outData[j].index = ( take ? inInd : outInd );
     }
 }
 template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
@@ -583,8 +607,10 @@ EL_NO_EXCEPT
         const T outVal = outData[j].value;
         const Int inInd = inData[j].index;
         const Int outInd = outData[j].index;
-        if( inVal < outVal || (inVal == outVal && inInd < outInd) )
-            outData[j] = inData[j];
+        const bool take =
+          inVal < outVal || (inVal == outVal && inInd < outInd);
+        outData[j].value = ( take ? inVal : outVal );
+        outData[j].index = ( take ? inInd : outInd );
     }
 }
 template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
@@ -621,9 +647,13 @@ EL_NO_EXCEPT
     {
         const Entry<T>& in  = inData[k];
               Entry<T>& out = outData[k];
-        bool inIndLess = ( in.i < out.i || (in.i == out.i && in.j < out.j) );
-        if( in.value > out.value || (in.value == out.value && inIndLess) )
-            out = in;
+        const bool inIndLess =
+          ( in.i < out.i || (in.i == out.i && in.j < out.j) );
+        const bool take =
+          in.value > out.value || (in.value == out.value && inIndLess);
+        out.value = ( take ? in.value : out.value );
+        out.i = ( take ? in.i : out.i );
+        out.j = ( take ? in.j : out.j );
     }
 }
 template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
@@ -662,9 +692,13 @@ EL_NO_EXCEPT
     {
         const Entry<T>& in  = inData[k];
               Entry<T>& out = outData[k];
-        bool inIndLess = ( in.i < out.i || (in.i == out.i && in.j < out.j) );
-        if( in.value < out.value || (in.value == out.value && inIndLess) )
-            out = in;
+        const bool inIndLess =
+          ( in.i < out.i || (in.i == out.i && in.j < out.j) );
+        const bool take =
+          in.value < out.value || (in.value == out.value && inIndLess);
+        out.value = ( take ? in.value : out.value );
+        out.i = ( take ? in.i : out.i );
+        out.j = ( take ? in.j : out.j );
     }
 }
 template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
@@ -897,8 +931,101 @@ void CreateMinLocPairOp()
     Types<Entry<T>>::createdMinOp = true;
 }
 
+namespace {
+
+// The per-process cache of committed strided-matrix datatypes, keyed on
+// (element type, height, width, ldim)
+std::map<std::tuple<Datatype,int,int,int>,Datatype>
+  stridedMatrixTypes;
+// The minimum column length, in bytes, before the datatype path is
+// preferred over an explicit pack
+int stridedMatrixTypeThreshold = 4096;
+
+} // anonymous namespace
+
+template<typename T,typename/*=EnableIf<IsPacked<T>>*/>
+Datatype StridedMatrixType( int height, int width, int ldim )
+EL_NO_RELEASE_EXCEPT
+{
+    auto key = std::make_tuple( TypeMap<T>(), height, width, ldim );
+    auto it = stridedMatrixTypes.find( key );
+    if( it != stridedMatrixTypes.end() )
+        return it->second;
+
+    Datatype type;
+    int err = MPI_Type_vector( width, height, ldim, TypeMap<T>(), &type );
+    if( err != MPI_SUCCESS )
+        RuntimeError("MPI_Type_vector returned with err=",err);
+    err = MPI_Type_commit( &type );
+    if( err != MPI_SUCCESS )
+        RuntimeError("MPI_Type_commit returned with err=",err);
+    stridedMatrixTypes.emplace( key, type );
+    return type;
+}
+
+bool UseStridedMatrixType
+( int height, int width, int ldim, size_t elemSize ) EL_NO_EXCEPT
+{
+    // A single column (or a fully-packed matrix) is already contiguous
+    if( height == ldim || width == 1 )
+        return true;
+    return height*elemSize >= size_t(stridedMatrixTypeThreshold);
+}
+
+int StridedMatrixTypeThreshold() EL_NO_EXCEPT
+{ return stridedMatrixTypeThreshold; }
+void SetStridedMatrixTypeThreshold( int numBytes ) EL_NO_EXCEPT
+{ stridedMatrixTypeThreshold = numBytes; }
+
+void DestroyStridedMatrixTypes() EL_NO_RELEASE_EXCEPT
+{
+    for( auto& entry : stridedMatrixTypes )
+        Free( entry.second );
+    stridedMatrixTypes.clear();
+}
+
+#define STRIDED_MATRIX_TYPE_PROTO(T) \
+  template Datatype StridedMatrixType<T> \
+  ( int height, int width, int ldim ) EL_NO_RELEASE_EXCEPT;
+STRIDED_MATRIX_TYPE_PROTO(byte)
+STRIDED_MATRIX_TYPE_PROTO(int)
+STRIDED_MATRIX_TYPE_PROTO(unsigned)
+STRIDED_MATRIX_TYPE_PROTO(long int)
+STRIDED_MATRIX_TYPE_PROTO(unsigned long)
+#ifdef EL_HAVE_MPI_LONG_LONG
+STRIDED_MATRIX_TYPE_PROTO(long long int)
+STRIDED_MATRIX_TYPE_PROTO(unsigned long long)
+#endif
+STRIDED_MATRIX_TYPE_PROTO(float)
+STRIDED_MATRIX_TYPE_PROTO(Complex<float>)
+STRIDED_MATRIX_TYPE_PROTO(double)
+STRIDED_MATRIX_TYPE_PROTO(Complex<double>)
+#ifdef EL_HAVE_QD
+STRIDED_MATRIX_TYPE_PROTO(DoubleDouble)
+STRIDED_MATRIX_TYPE_PROTO(QuadDouble)
+STRIDED_MATRIX_TYPE_PROTO(Complex<DoubleDouble>)
+STRIDED_MATRIX_TYPE_PROTO(Complex<QuadDouble>)
+#endif
+#ifdef EL_HAVE_QUAD
+STRIDED_MATRIX_TYPE_PROTO(Quad)
+STRIDED_MATRIX_TYPE_PROTO(Complex<Quad>)
+#endif
+
+namespace {
+
+// Whether CreateCustom has already registered the custom datatypes and
+// reduction operators (so that lazy initialization can safely call it from
+// multiple entry points)
+bool createdCustom = false;
+
+}
+
 void CreateCustom() EL_NO_RELEASE_EXCEPT
 {
+    if( createdCustom )
+        return;
+    createdCustom = true;
+
     // Int
     // ===
     CreateValueIntType<Int>();
@@ -1069,6 +1196,8 @@ void DestroyScalarFamily()
 
 void DestroyCustom() EL_NO_RELEASE_EXCEPT
 {
+    createdCustom = false;
+    DestroyStridedMatrixTypes();
     DestroyFamily<Int>();
     DestroyScalarFamily<float>();
     DestroyScalarFamily<double>();
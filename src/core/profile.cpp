@@ -0,0 +1,198 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+#ifndef _WIN32
+# include <csignal>
+# include <sys/time.h>
+#endif
+
+namespace {
+
+// The (per-process) sample table: open addressing keyed on the routine-tag
+// pointer (the string literals planted by EL_DEBUG_CSE have stable
+// addresses), sized as a power of two so that probing can mask rather than
+// divide. Lock-free so that the signal handler may update it from whichever
+// thread the profiling timer interrupts.
+const size_t tableSize = 1u<<13;
+struct TableEntry
+{
+    std::atomic<const char*> tag;
+    std::atomic<long long> count;
+};
+TableEntry sampleTable[tableSize];
+std::atomic<long long> numSamples, numUntracked, numDropped;
+El::Int sampleRate = 0;
+
+void RecordSample( const char* tag )
+{
+    size_t hash = (reinterpret_cast<size_t>(tag) >> 3)*2654435761UL;
+    for( size_t probe=0; probe<tableSize; ++probe )
+    {
+        const size_t slot = (hash+probe) & (tableSize-1);
+        const char* cur =
+          sampleTable[slot].tag.load( std::memory_order_relaxed );
+        if( cur == nullptr )
+        {
+            const char* expected = nullptr;
+            if( !sampleTable[slot].tag.compare_exchange_strong
+                 ( expected, tag, std::memory_order_relaxed ) &&
+                expected != tag )
+                continue;
+            cur = tag;
+        }
+        if( cur == tag )
+        {
+            sampleTable[slot].count.fetch_add( 1, std::memory_order_relaxed );
+            return;
+        }
+    }
+    numDropped.fetch_add( 1, std::memory_order_relaxed );
+}
+
+#ifndef _WIN32
+extern "C" void SamplingHandler( int )
+{
+    const El::prof::Frame* head = El::prof::currentFrame;
+    numSamples.fetch_add( 1, std::memory_order_relaxed );
+    if( head == nullptr )
+    {
+        numUntracked.fetch_add( 1, std::memory_order_relaxed );
+        return;
+    }
+    // Attribute the sample to every distinct routine on the chain (skipping
+    // recursive repetitions) so that the counts are inclusive
+    for( const El::prof::Frame* f=head; f!=nullptr; f=f->Parent() )
+    {
+        bool alreadySeen = false;
+        for( const El::prof::Frame* g=head; g!=f; g=g->Parent() )
+        {
+            if( g->Tag() == f->Tag() )
+            {
+                alreadySeen = true;
+                break;
+            }
+        }
+        if( !alreadySeen )
+            RecordSample( f->Tag() );
+    }
+}
+#endif
+
+}
+
+namespace El {
+namespace prof {
+
+volatile bool samplingActive = false;
+thread_local Frame* volatile currentFrame = nullptr;
+
+bool Enabled() EL_NO_EXCEPT { return samplingActive; }
+
+void Enable( Int samplesPerSec )
+{
+#ifdef _WIN32
+    LogicError("The sampling profiler requires POSIX profiling timers");
+#else
+    if( samplingActive )
+        return;
+    ::sampleRate = ( samplesPerSec > 0 ? samplesPerSec : 997 );
+    for( size_t slot=0; slot<::tableSize; ++slot )
+    {
+        ::sampleTable[slot].tag.store( nullptr, std::memory_order_relaxed );
+        ::sampleTable[slot].count.store( 0, std::memory_order_relaxed );
+    }
+    ::numSamples = 0;
+    ::numUntracked = 0;
+    ::numDropped = 0;
+
+    struct sigaction action;
+    std::memset( &action, 0, sizeof(action) );
+    action.sa_handler = ::SamplingHandler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset( &action.sa_mask );
+    sigaction( SIGPROF, &action, nullptr );
+
+    samplingActive = true;
+
+    itimerval timer;
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = 1000000 / ::sampleRate;
+    timer.it_value = timer.it_interval;
+    setitimer( ITIMER_PROF, &timer, nullptr );
+#endif
+}
+
+void Disable()
+{
+#ifndef _WIN32
+    if( !samplingActive )
+        return;
+    itimerval timer;
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = 0;
+    timer.it_value = timer.it_interval;
+    setitimer( ITIMER_PROF, &timer, nullptr );
+    signal( SIGPROF, SIG_IGN );
+    samplingActive = false;
+#endif
+}
+
+void Dump( const string& filename )
+{
+    const long long samples = ::numSamples.load();
+    if( samples == 0 )
+        return;
+
+    struct Row { const char* tag; long long count; };
+    vector<Row> rows;
+    for( size_t slot=0; slot<::tableSize; ++slot )
+    {
+        const char* tag = ::sampleTable[slot].tag.load();
+        if( tag != nullptr )
+            rows.push_back( Row{tag,::sampleTable[slot].count.load()} );
+    }
+    std::sort
+    ( rows.begin(), rows.end(),
+      []( const Row& a, const Row& b ) { return a.count > b.count; } );
+
+    std::ofstream file( filename.c_str() );
+    file << "Sampling profile: " << samples << " samples at "
+         << ::sampleRate << " Hz ("
+         << ::numUntracked.load() << " outside instrumented routines";
+    if( ::numDropped.load() != 0 )
+        file << ", " << ::numDropped.load() << " dropped";
+    file << ")\n\n";
+    file << std::setw(10) << "samples" << "  "
+         << std::setw(12) << "inclusive s" << "  "
+         << std::setw(7) << "percent" << "  routine\n";
+    for( const auto& row : rows )
+        file << std::setw(10) << row.count << "  "
+             << std::setw(12) << std::fixed << std::setprecision(3)
+             << double(row.count)/double(::sampleRate) << "  "
+             << std::setw(6) << std::setprecision(2)
+             << 100.*double(row.count)/double(samples) << "%  "
+             << row.tag << "\n";
+}
+
+void Dump()
+{
+    std::ostringstream fileOS;
+    fileOS << "El-Profile-Proc" << std::setfill('0') << std::setw(3)
+           << mpi::Rank() << ".txt";
+    Dump( fileOS.str() );
+}
+
+} // namespace prof
+} // namespace El
@@ -13,6 +13,11 @@ namespace {
 // A common Mersenne twister configuration
 std::mt19937 generator;
 
+// The (rank-independent) seed of the counter-based samplers and the stream
+// index distinguishing successive counter-based fills
+uint64_t counterSeed = 21;
+uint64_t counterStream = 0;
+
 #ifdef EL_HAVE_MPC
 gmp_randstate_t gmpRandState;
 #endif
@@ -31,6 +36,14 @@ void InitializeRandom( bool deterministic )
 
     srand( seed );
 
+    // The counter-based samplers must share a rank-independent seed for
+    // their fills to be identical on every process grid; broadcast from the
+    // root since, when non-deterministic, the ranks may disagree on the time
+    uint64_t counterSeed = uint64_t(secs);
+    mpi::Broadcast( counterSeed, 0, mpi::COMM_WORLD );
+    ::counterSeed = counterSeed;
+    ::counterStream = 0;
+
 #ifdef EL_HAVE_MPC
     mpfr::SetMinIntBits( 256 );
     mpfr::SetPrecision( 256 );
@@ -49,6 +62,58 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+// The ten-round Philox-4x32 keyed bijection of Salmon et al.
+void Philox4x32
+( const uint32_t key[2], const uint32_t ctr[4], uint32_t out[4] )
+{
+    uint32_t k0 = key[0];
+    uint32_t k1 = key[1];
+    out[0] = ctr[0];
+    out[1] = ctr[1];
+    out[2] = ctr[2];
+    out[3] = ctr[3];
+    for( int round=0; round<10; ++round )
+    {
+        const uint64_t prod0 = uint64_t(0xD2511F53u)*out[0];
+        const uint64_t prod1 = uint64_t(0xCD9E8D57u)*out[2];
+        const uint32_t next0 = uint32_t(prod1>>32) ^ out[1] ^ k0;
+        const uint32_t next1 = uint32_t(prod1);
+        const uint32_t next2 = uint32_t(prod0>>32) ^ out[3] ^ k1;
+        const uint32_t next3 = uint32_t(prod0);
+        out[0] = next0;
+        out[1] = next1;
+        out[2] = next2;
+        out[3] = next3;
+        k0 += 0x9E3779B9u;
+        k1 += 0xBB67AE85u;
+    }
+}
+
+void CounterBits
+( uint64_t seed, uint64_t stream, uint64_t index, uint32_t out[4] )
+{
+    uint32_t key[2], ctr[4];
+    key[0] = uint32_t(seed);
+    key[1] = uint32_t(seed>>32);
+    ctr[0] = uint32_t(index);
+    ctr[1] = uint32_t(index>>32);
+    ctr[2] = uint32_t(stream);
+    ctr[3] = uint32_t(stream>>32);
+    Philox4x32( key, ctr, out );
+}
+
+uint64_t CounterSeed()
+{ return ::counterSeed; }
+
+void SetCounterSeed( uint64_t seed )
+{
+    ::counterSeed = seed;
+    ::counterStream = 0;
+}
+
+uint64_t NextCounterStream()
+{ return ::counterStream++; }
+
 #ifdef EL_HAVE_MPC
 namespace mpfr {
 
@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <stack>
+
+namespace {
+using namespace El;
+
+std::stack<Int> numThreadsStack;
+
+Int DefaultNumThreads()
+{
+#ifdef EL_HYBRID
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+// Propagate a new thread count to every runtime which consumes it: the
+// OpenMP runtime (which Elemental's internal parallel regions consult) and
+// any threaded BLAS implementation, so that the two no longer need to be
+// configured separately (and inconsistently)
+void ApplyNumThreads( Int numThreads )
+{
+#ifdef EL_HYBRID
+    omp_set_num_threads( int(numThreads) );
+#endif
+#if defined(EL_HAVE_MKL)
+    mkl::SetNumThreads( int(numThreads) );
+#elif defined(EL_HAVE_OPENBLAS)
+    openblas::SetNumThreads( int(numThreads) );
+#endif
+}
+
+} // anonymous namespace
+
+namespace El {
+
+Int NumThreads()
+{
+    Int numThreads =
+      ( ::numThreadsStack.empty() ? DefaultNumThreads()
+                                  : ::numThreadsStack.top() );
+#ifdef EL_HYBRID
+    // Hand each member of an enclosing parallel region a fair share of the
+    // configured count so that nested parallelism (e.g., a threaded BLAS
+    // call issued from within an application-level region) subdivides the
+    // machine rather than oversubscribing it
+    if( omp_in_parallel() )
+        numThreads = Max( numThreads/omp_get_num_threads(), Int(1) );
+#endif
+    return numThreads;
+}
+
+void SetNumThreads( Int numThreads )
+{
+    if( ::numThreadsStack.empty() )
+        ::numThreadsStack.push( numThreads );
+    else
+        ::numThreadsStack.top() = numThreads;
+    ApplyNumThreads( numThreads );
+}
+
+void PushNumThreadsStack( Int numThreads )
+{
+    ::numThreadsStack.push( numThreads );
+    ApplyNumThreads( numThreads );
+}
+
+void PopNumThreadsStack()
+{
+    EL_DEBUG_ONLY(
+      if( ::numThreadsStack.empty() )
+          LogicError("Attempted to pop an empty thread count stack");
+    )
+    ::numThreadsStack.pop();
+    ApplyNumThreads
+    ( ::numThreadsStack.empty() ? DefaultNumThreads()
+                                : ::numThreadsStack.top() );
+}
+
+void EmptyNumThreadsStack()
+{
+    while( ! ::numThreadsStack.empty() )
+        ::numThreadsStack.pop();
+    ApplyNumThreads( DefaultNumThreads() );
+}
+
+} // namespace El
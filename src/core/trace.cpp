@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+namespace {
+
+// The (per-process) event ring buffer. The atomic event counter both claims
+// slots for concurrent writers and records how many events were seen in
+// total, so that overflow can be reported rather than silently hidden.
+bool tracingEnabled = false;
+El::Int traceCapacity = 1u<<20;
+std::vector<El::trace::Event> events;
+std::atomic<long long> numEvents;
+std::atomic<long long> mpiVolume;
+El::Clock::time_point traceOrigin;
+
+}
+
+namespace El {
+namespace trace {
+
+bool Enabled() EL_NO_EXCEPT { return ::tracingEnabled; }
+
+void Enable( Int capacity )
+{
+    if( capacity > 0 )
+        ::traceCapacity = capacity;
+    ::events.resize( ::traceCapacity );
+    ::numEvents = 0;
+    ::mpiVolume = 0;
+    ::traceOrigin = Clock::now();
+    ::tracingEnabled = true;
+}
+
+void Disable() { ::tracingEnabled = false; }
+
+long long NumRecordedEvents() { return ::numEvents.load(); }
+long long MPIVolume() { return ::mpiVolume.load(); }
+
+double LocalTime()
+{
+    auto now = Clock::now();
+    auto timeSpan = duration_cast<duration<double>>(now-::traceOrigin);
+    return timeSpan.count();
+}
+
+void RecordEvent
+( EventCategory category, const char* name,
+  double start, double stop, long long bytes, int commSize )
+{
+    if( !::tracingEnabled )
+        return;
+    // Claim a slot; the buffer is treated as a ring so that the most recent
+    // events survive overflow
+    const long long index = ::numEvents++;
+    if( category == MPI_EVENT )
+        ::mpiVolume += bytes;
+    Event& event = ::events[index % ::traceCapacity];
+    event.start = start;
+    event.stop = stop;
+    event.bytes = bytes;
+    event.commSize = commSize;
+    event.category = category;
+    std::strncpy( event.name, name, sizeof(event.name)-1 );
+    event.name[sizeof(event.name)-1] = '\0';
+}
+
+void Dump( const string& filename )
+{
+    const long long numRecorded = ::numEvents.load();
+    if( ::events.empty() || numRecorded == 0 )
+        return;
+    const long long capacity = ::traceCapacity;
+    const long long numStored = Min( numRecorded, capacity );
+
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    if( !file )
+    {
+        cerr << "Could not open trace dump file " << filename << endl;
+        return;
+    }
+
+    const char magic[8] = { 'E','L','T','R','A','C','E','\0' };
+    const int version = 1;
+    const int rank =
+      ( mpi::Initialized() && !mpi::Finalized() ?
+        mpi::Rank(mpi::COMM_WORLD) : 0 );
+    const int eventSize = sizeof(Event);
+    file.write( magic, sizeof(magic) );
+    file.write( reinterpret_cast<const char*>(&version), sizeof(int) );
+    file.write( reinterpret_cast<const char*>(&rank), sizeof(int) );
+    file.write( reinterpret_cast<const char*>(&eventSize), sizeof(int) );
+    file.write
+    ( reinterpret_cast<const char*>(&numStored), sizeof(long long) );
+    file.write
+    ( reinterpret_cast<const char*>(&numRecorded), sizeof(long long) );
+
+    // Write the records in chronological order (on overflow, the slot after
+    // the most recently claimed one holds the oldest surviving event)
+    const long long first =
+      ( numRecorded > capacity ? numRecorded % capacity : 0 );
+    for( long long e=0; e<numStored; ++e )
+    {
+        const Event& event = ::events[(first+e) % capacity];
+        file.write( reinterpret_cast<const char*>(&event), sizeof(Event) );
+    }
+}
+
+void Dump()
+{
+    const int rank =
+      ( mpi::Initialized() && !mpi::Finalized() ?
+        mpi::Rank(mpi::COMM_WORLD) : 0 );
+    std::ostringstream fileOS;
+    fileOS << "El-Trace-Proc" << std::setfill('0') << std::setw(3)
+           << rank << ".bin";
+    Dump( fileOS.str() );
+}
+
+} // namespace trace
+} // namespace El
@@ -0,0 +1,258 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#ifdef EL_HAVE_QT5
+# include "El/io/DisplayWindow-premoc.hpp"
+# include "El/io/ComplexDisplayWindow-premoc.hpp"
+# include "El/io/SpyWindow.hpp"
+# include <QApplication>
+# include <QTimer>
+# include <atomic>
+# include <map>
+# include <mutex>
+# include <thread>
+#endif
+
+namespace {
+
+#ifdef EL_HAVE_QT5
+using namespace El;
+
+Int asyncDisplayResolution = 1024;
+
+enum FrameType { REAL_FRAME, COMPLEX_FRAME, SPY_FRAME };
+struct Frame
+{
+    FrameType type;
+    Matrix<double> real;
+    Matrix<Complex<double>> cpx;
+    Matrix<Int> spy;
+};
+
+// Each title owns a single-slot mailbox: a producer atomically exchanges
+// its freshly downsampled frame into the slot (deleting whatever the render
+// thread had not yet consumed), so, after the downsample, publication is a
+// wait-free pointer swap and the render thread always paints the freshest
+// snapshot. The registry mutex only guards the creation and enumeration of
+// the mailboxes themselves.
+struct Mailbox
+{
+    std::atomic<Frame*> slot;
+    Mailbox() : slot(nullptr) { }
+    ~Mailbox() { delete slot.load(); }
+};
+std::mutex registryMutex;
+std::map<string,Mailbox>& Mailboxes()
+{
+    static std::map<string,Mailbox> mailboxes;
+    return mailboxes;
+}
+
+std::thread renderThread;
+bool renderThreadStarted = false;
+std::mutex renderThreadMutex;
+std::atomic<QCoreApplication*> renderApp(nullptr);
+
+void DrainMailboxes( std::map<string,QWidget*>& windows )
+{
+    vector<std::pair<string,Frame*>> pending;
+    {
+        std::lock_guard<std::mutex> lock( ::registryMutex );
+        for( auto& entry : Mailboxes() )
+        {
+            Frame* frame = entry.second.slot.exchange( nullptr );
+            if( frame != nullptr )
+                pending.emplace_back( entry.first, frame );
+        }
+    }
+    for( auto& item : pending )
+    {
+        const string& title = item.first;
+        Frame* frame = item.second;
+        QString qTitle = QString::fromStdString( title );
+        QWidget*& window = windows[title];
+        switch( frame->type )
+        {
+        case REAL_FRAME:
+        {
+            if( window == nullptr )
+            {
+                auto displayWindow = new DisplayWindow;
+                window = displayWindow;
+                // The windows delete themselves when closed
+                QObject::connect
+                ( displayWindow, &QObject::destroyed,
+                  [&windows,title]() { windows.erase(title); } );
+                displayWindow->show();
+            }
+            auto displayWindow = static_cast<DisplayWindow*>(window);
+            displayWindow->Display
+            ( new Matrix<double>(std::move(frame->real)), qTitle );
+            break;
+        }
+        case COMPLEX_FRAME:
+        {
+            if( window == nullptr )
+            {
+                auto displayWindow = new ComplexDisplayWindow;
+                window = displayWindow;
+                QObject::connect
+                ( displayWindow, &QObject::destroyed,
+                  [&windows,title]() { windows.erase(title); } );
+                displayWindow->show();
+            }
+            auto displayWindow = static_cast<ComplexDisplayWindow*>(window);
+            displayWindow->Display
+            ( new Matrix<Complex<double>>(std::move(frame->cpx)), qTitle );
+            break;
+        }
+        case SPY_FRAME:
+        {
+            if( window == nullptr )
+            {
+                auto spyWindow = new SpyWindow;
+                window = spyWindow;
+                QObject::connect
+                ( spyWindow, &QObject::destroyed,
+                  [&windows,title]() { windows.erase(title); } );
+                spyWindow->show();
+            }
+            auto spyWindow = static_cast<SpyWindow*>(window);
+            spyWindow->Spy
+            ( new Matrix<Int>(std::move(frame->spy)), qTitle );
+            break;
+        }
+        }
+        delete frame;
+    }
+}
+
+void RenderLoop()
+{
+    // The render thread owns the (deferred) application object and drives
+    // the event loop, repainting from the mailboxes a few dozen times per
+    // second; the solver threads never touch a widget
+    QApplication app( QtArgc(), QtArgv() );
+    std::map<string,QWidget*> windows;
+    QTimer timer;
+    QObject::connect
+    ( &timer, &QTimer::timeout, [&windows]() { DrainMailboxes(windows); } );
+    timer.start( 33 );
+    ::renderApp = &app;
+    app.exec();
+    ::renderApp = nullptr;
+    // Any windows which were not closed interactively are deleted here
+    // (deletion erases them from the original map, so iterate over a copy)
+    auto remaining = windows;
+    for( auto& entry : remaining )
+        delete entry.second;
+}
+
+void EnsureRenderThread()
+{
+    std::lock_guard<std::mutex> lock( ::renderThreadMutex );
+    if( !::renderThreadStarted )
+    {
+        RegisterAsyncGuiCleanup( StopAsyncDisplay );
+        ::renderThread = std::thread( RenderLoop );
+        ::renderThreadStarted = true;
+    }
+}
+
+void PushFrame( const string& title, Frame* frame )
+{
+    EnsureRenderThread();
+    Mailbox* mailbox;
+    {
+        std::lock_guard<std::mutex> lock( ::registryMutex );
+        mailbox = &Mailboxes()[title];
+    }
+    Frame* old = mailbox->slot.exchange( frame );
+    delete old;
+}
+#endif // ifdef EL_HAVE_QT5
+
+} // anonymous namespace
+
+namespace El {
+
+void SetAsyncDisplayResolution( Int resolution )
+{
+#ifdef EL_HAVE_QT5
+    if( resolution <= 0 )
+        LogicError("Frames must have a positive resolution");
+    ::asyncDisplayResolution = resolution;
+#endif
+}
+
+Int AsyncDisplayResolution()
+{
+#ifdef EL_HAVE_QT5
+    return ::asyncDisplayResolution;
+#else
+    return 0;
+#endif
+}
+
+void PushDisplayFrame( string title, Matrix<double>&& frame )
+{
+#ifdef EL_HAVE_QT5
+    auto frameNode = new ::Frame;
+    frameNode->type = ::REAL_FRAME;
+    frameNode->real = std::move(frame);
+    ::PushFrame( title, frameNode );
+#else
+    LogicError("Qt5 not available");
+#endif
+}
+
+void PushDisplayFrame( string title, Matrix<Complex<double>>&& frame )
+{
+#ifdef EL_HAVE_QT5
+    auto frameNode = new ::Frame;
+    frameNode->type = ::COMPLEX_FRAME;
+    frameNode->cpx = std::move(frame);
+    ::PushFrame( title, frameNode );
+#else
+    LogicError("Qt5 not available");
+#endif
+}
+
+void PushSpyFrame( string title, Matrix<Int>&& frame )
+{
+#ifdef EL_HAVE_QT5
+    auto frameNode = new ::Frame;
+    frameNode->type = ::SPY_FRAME;
+    frameNode->spy = std::move(frame);
+    ::PushFrame( title, frameNode );
+#else
+    LogicError("Qt5 not available");
+#endif
+}
+
+void StopAsyncDisplay()
+{
+#ifdef EL_HAVE_QT5
+    std::lock_guard<std::mutex> lock( ::renderThreadMutex );
+    if( ::renderThreadStarted )
+    {
+        // Wait for the deferred application to come up before asking its
+        // event loop to quit
+        QCoreApplication* app;
+        while( (app=::renderApp.load()) == nullptr )
+            std::this_thread::yield();
+        QMetaObject::invokeMethod( app, "quit", Qt::QueuedConnection );
+        ::renderThread.join();
+        ::renderThreadStarted = false;
+    }
+#endif
+}
+
+} // namespace El
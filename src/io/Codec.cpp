@@ -0,0 +1,278 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <cstring>
+
+#ifdef EL_HAVE_LZ4
+#include <lz4.h>
+#endif
+#ifdef EL_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace {
+
+using El::byte;
+
+El::Compression binaryCompression = El::COMPRESSION_SHUFFLE_RLE;
+// Four MiB of uncompressed entries per chunk keeps the per-chunk overhead
+// negligible while leaving enough chunks for the compression threads
+El::Int compressionChunkSize = 4*1024*1024;
+
+// The built-in codec: transpose the bytes of each entry so that byte k of
+// every entry is stored contiguously (smooth fields then yield long runs of
+// equal sign/exponent bytes), and run-length encode the result. A control
+// byte c < 128 precedes c+1 literal bytes, while c >= 128 precedes a single
+// byte repeated c-125 (i.e., 3 through 130) times.
+void Shuffle
+( const byte* src, size_t numBytes, size_t elementSize, byte* dst )
+{
+    const size_t numElem = numBytes / elementSize;
+    for( size_t k=0; k<elementSize; ++k )
+        for( size_t e=0; e<numElem; ++e )
+            dst[k*numElem+e] = src[e*elementSize+k];
+}
+
+void Unshuffle
+( const byte* src, size_t numBytes, size_t elementSize, byte* dst )
+{
+    const size_t numElem = numBytes / elementSize;
+    for( size_t k=0; k<elementSize; ++k )
+        for( size_t e=0; e<numElem; ++e )
+            dst[e*elementSize+k] = src[k*numElem+e];
+}
+
+void RunLengthEncode
+( const byte* src, size_t numBytes, std::vector<byte>& dst )
+{
+    dst.clear();
+    dst.reserve( numBytes + numBytes/128 + 1 );
+    size_t i = 0;
+    size_t literalStart = 0;
+    auto flushLiterals = [&]( size_t literalEnd )
+    {
+        while( literalStart < literalEnd )
+        {
+            const size_t numLit =
+              std::min( literalEnd-literalStart, size_t(128) );
+            dst.push_back( byte(numLit-1) );
+            dst.insert
+            ( dst.end(), src+literalStart, src+literalStart+numLit );
+            literalStart += numLit;
+        }
+    };
+    while( i < numBytes )
+    {
+        size_t run = 1;
+        while( i+run < numBytes && src[i+run] == src[i] && run < 130 )
+            ++run;
+        if( run >= 3 )
+        {
+            flushLiterals( i );
+            dst.push_back( byte(128 + (run-3)) );
+            dst.push_back( src[i] );
+            i += run;
+            literalStart = i;
+        }
+        else
+            i += run;
+    }
+    flushLiterals( numBytes );
+}
+
+void RunLengthDecode
+( const byte* src, size_t numBytes, byte* dst, size_t dstNumBytes )
+{
+    size_t i=0, o=0;
+    while( i < numBytes )
+    {
+        const byte control = src[i++];
+        if( control < 128 )
+        {
+            const size_t numLit = size_t(control) + 1;
+            if( i+numLit > numBytes || o+numLit > dstNumBytes )
+                El::RuntimeError("Corrupt run-length encoded chunk");
+            std::memcpy( dst+o, src+i, numLit );
+            i += numLit;
+            o += numLit;
+        }
+        else
+        {
+            const size_t run = size_t(control) - 125;
+            if( i >= numBytes || o+run > dstNumBytes )
+                El::RuntimeError("Corrupt run-length encoded chunk");
+            std::memset( dst+o, src[i++], run );
+            o += run;
+        }
+    }
+    if( o != dstNumBytes )
+        El::RuntimeError
+        ("Run-length encoded chunk decoded to ",o," bytes rather than ",
+         dstNumBytes);
+}
+
+} // anonymous namespace
+
+namespace El {
+
+bool HaveCompression( Compression codec )
+{
+    switch( codec )
+    {
+    case COMPRESSION_NONE:
+    case COMPRESSION_SHUFFLE_RLE:
+        return true;
+    case COMPRESSION_LZ4:
+#ifdef EL_HAVE_LZ4
+        return true;
+#else
+        return false;
+#endif
+    case COMPRESSION_ZSTD:
+#ifdef EL_HAVE_ZSTD
+        return true;
+#else
+        return false;
+#endif
+    default:
+        return false;
+    }
+}
+
+void SetBinaryCompression( Compression codec )
+{
+    if( !HaveCompression(codec) )
+        RuntimeError("Elemental was not configured with the requested codec");
+    ::binaryCompression = codec;
+}
+
+Compression BinaryCompression()
+{ return ::binaryCompression; }
+
+void SetCompressionChunkSize( Int numBytes )
+{
+    if( numBytes <= 0 )
+        LogicError("Compression chunks must be at least one byte");
+    ::compressionChunkSize = numBytes;
+}
+
+Int CompressionChunkSize()
+{ return ::compressionChunkSize; }
+
+void Compress
+( Compression codec, size_t elementSize,
+  const byte* src, size_t numBytes, vector<byte>& dst )
+{
+    EL_DEBUG_CSE
+    switch( codec )
+    {
+    case COMPRESSION_NONE:
+        dst.assign( src, src+numBytes );
+        break;
+    case COMPRESSION_SHUFFLE_RLE:
+    {
+        vector<byte> shuffled( numBytes );
+        Shuffle( src, numBytes, elementSize, shuffled.data() );
+        RunLengthEncode( shuffled.data(), numBytes, dst );
+        break;
+    }
+    case COMPRESSION_LZ4:
+    {
+#ifdef EL_HAVE_LZ4
+        // The chunking keeps each buffer well below LZ4's 2 GiB input limit
+        dst.resize( LZ4_compressBound(int(numBytes)) );
+        const int compressedBytes =
+          LZ4_compress_default
+          ( reinterpret_cast<const char*>(src),
+            reinterpret_cast<char*>(dst.data()),
+            int(numBytes), int(dst.size()) );
+        if( compressedBytes <= 0 )
+            RuntimeError("LZ4 compression failed");
+        dst.resize( compressedBytes );
+#else
+        RuntimeError("Elemental was not configured with LZ4 support");
+#endif
+        break;
+    }
+    case COMPRESSION_ZSTD:
+    {
+#ifdef EL_HAVE_ZSTD
+        dst.resize( ZSTD_compressBound(numBytes) );
+        const size_t compressedBytes =
+          ZSTD_compress( dst.data(), dst.size(), src, numBytes, 3 );
+        if( ZSTD_isError(compressedBytes) )
+            RuntimeError
+            ("Zstd compression failed: ",
+             ZSTD_getErrorName(compressedBytes));
+        dst.resize( compressedBytes );
+#else
+        RuntimeError("Elemental was not configured with Zstd support");
+#endif
+        break;
+    }
+    default:
+        LogicError("Invalid compression codec");
+    }
+}
+
+void Decompress
+( Compression codec, size_t elementSize,
+  const byte* src, size_t numBytes, byte* dst, size_t dstNumBytes )
+{
+    EL_DEBUG_CSE
+    switch( codec )
+    {
+    case COMPRESSION_NONE:
+        if( numBytes != dstNumBytes )
+            RuntimeError("Uncompressed chunk had an unexpected length");
+        std::memcpy( dst, src, numBytes );
+        break;
+    case COMPRESSION_SHUFFLE_RLE:
+    {
+        vector<byte> shuffled( dstNumBytes );
+        RunLengthDecode( src, numBytes, shuffled.data(), dstNumBytes );
+        Unshuffle( shuffled.data(), dstNumBytes, elementSize, dst );
+        break;
+    }
+    case COMPRESSION_LZ4:
+    {
+#ifdef EL_HAVE_LZ4
+        const int decompressedBytes =
+          LZ4_decompress_safe
+          ( reinterpret_cast<const char*>(src),
+            reinterpret_cast<char*>(dst),
+            int(numBytes), int(dstNumBytes) );
+        if( decompressedBytes < 0 ||
+            size_t(decompressedBytes) != dstNumBytes )
+            RuntimeError("LZ4 decompression failed");
+#else
+        RuntimeError("Elemental was not configured with LZ4 support");
+#endif
+        break;
+    }
+    case COMPRESSION_ZSTD:
+    {
+#ifdef EL_HAVE_ZSTD
+        const size_t decompressedBytes =
+          ZSTD_decompress( dst, dstNumBytes, src, numBytes );
+        if( ZSTD_isError(decompressedBytes) ||
+            decompressedBytes != dstNumBytes )
+            RuntimeError("Zstd decompression failed");
+#else
+        RuntimeError("Elemental was not configured with Zstd support");
+#endif
+        break;
+    }
+    default:
+        LogicError("Invalid compression codec");
+    }
+}
+
+} // namespace El
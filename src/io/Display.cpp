@@ -14,11 +14,70 @@
 # include <QApplication>
 #endif
 
+namespace {
+
+#ifdef EL_HAVE_QT5
+using namespace El;
+
+// Bin the matrix down to at most the async frame resolution, keeping the
+// entry of largest magnitude within each bin so that localized features
+// survive the downsampling
+template<typename Real>
+void DownsampleFrame( const Matrix<Real>& A, Matrix<double>& frame )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int gridHeight = Min( AsyncDisplayResolution(), m );
+    const Int gridWidth = Min( AsyncDisplayResolution(), n );
+    Zeros( frame, gridHeight, gridWidth );
+    for( Int j=0; j<n; ++j )
+    {
+        const Int bj = Int( ((long long)j*gridWidth)/n );
+        for( Int i=0; i<m; ++i )
+        {
+            const Int bi = Int( ((long long)i*gridHeight)/m );
+            const double alpha = double(A.Get(i,j));
+            if( Abs(alpha) >= Abs(frame.Get(bi,bj)) )
+                frame.Set( bi, bj, alpha );
+        }
+    }
+}
+
+template<typename Real>
+void DownsampleFrame
+( const Matrix<Complex<Real>>& A, Matrix<Complex<double>>& frame )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int gridHeight = Min( AsyncDisplayResolution(), m );
+    const Int gridWidth = Min( AsyncDisplayResolution(), n );
+    Zeros( frame, gridHeight, gridWidth );
+    for( Int j=0; j<n; ++j )
+    {
+        const Int bj = Int( ((long long)j*gridWidth)/n );
+        for( Int i=0; i<m; ++i )
+        {
+            const Int bi = Int( ((long long)i*gridHeight)/m );
+            const Complex<Real> alpha = A.Get(i,j);
+            const Complex<double> alphaDouble =
+              Complex<double>(alpha.real(),alpha.imag());
+            if( Abs(alphaDouble) >= Abs(frame.Get(bi,bj)) )
+                frame.Set( bi, bj, alphaDouble );
+        }
+    }
+}
+#endif // ifdef EL_HAVE_QT5
+
+} // anonymous namespace
+
 namespace El {
 
 void ProcessEvents( int numMsecs )
 {
 #ifdef EL_HAVE_QT5
+    // The render thread drives its own event loop
+    if( AsyncGui() )
+        return;
     QCoreApplication::instance()->processEvents
     ( QEventLoop::AllEvents, numMsecs );
 #endif
@@ -34,6 +93,14 @@ void Display( const Matrix<Real>& A, string title )
         Print( A, title );
         return;
     }
+    if( AsyncGui() )
+    {
+        // Publish a downsampled snapshot and let the render thread paint
+        Matrix<double> frame;
+        DownsampleFrame( A, frame );
+        PushDisplayFrame( title, std::move(frame) );
+        return;
+    }
 
     // Convert A to double-precision since Qt's MOC does not support templates
     const Int m = A.Height();
@@ -65,6 +132,14 @@ void Display( const Matrix<Complex<Real>>& A, string title )
         Print( A, title );
         return;
     }
+    if( AsyncGui() )
+    {
+        // Publish a downsampled snapshot and let the render thread paint
+        Matrix<Complex<double>> frame;
+        DownsampleFrame( A, frame );
+        PushDisplayFrame( title, std::move(frame) );
+        return;
+    }
 
     // Convert A to double-precision since Qt's MOC does not support templates
     const Int m = A.Height();
@@ -157,6 +232,33 @@ void Display( const Graph& graph, string title )
 void Display( const DistGraph& graph, string title )
 {
     EL_DEBUG_CSE
+    // Gathering a production-scale graph onto a single rank can easily
+    // exhaust its memory, so beyond a modest size threshold we instead
+    // reduce a fixed-resolution edge-density grid onto the root
+    const Int maxGatherDim = 2048;
+    const Int m = graph.NumTargets();
+    const Int n = graph.NumSources();
+    if( m > maxGatherDim || n > maxGatherDim )
+    {
+        const Int gridHeight = Min( maxGatherDim, m );
+        const Int gridWidth = Min( maxGatherDim, n );
+        Matrix<Int> density;
+        Zeros( density, gridHeight, gridWidth );
+        Int* densBuf = density.Buffer();
+        const Int numLocalEdges = graph.NumLocalEdges();
+        for( Int e=0; e<numLocalEdges; ++e )
+        {
+            const Int bi = Int( ((long long)graph.Target(e)*gridHeight)/m );
+            const Int bj = Int( ((long long)graph.Source(e)*gridWidth)/n );
+            densBuf[bi+bj*gridHeight] += 1;
+        }
+        mpi::Reduce
+        ( density.Buffer(), gridHeight*gridWidth, mpi::SUM, 0,
+          graph.Grid().Comm() );
+        if( graph.Grid().Rank() == 0 )
+            Display( density, title );
+        return;
+    }
     if( graph.Grid().Rank() == 0 )
     {
         Graph seqGraph;
@@ -238,6 +340,35 @@ void Display( const DistSparseMatrix<T>& A, string title )
 {
     EL_DEBUG_CSE
     A.AssertLocallyConsistent();
+    // Gathering a production-scale operator onto a single rank can easily
+    // exhaust its memory, so beyond a modest size threshold we instead
+    // reduce a fixed-resolution grid of the largest entry magnitudes onto
+    // the root
+    const Int maxGatherDim = 2048;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m > maxGatherDim || n > maxGatherDim )
+    {
+        const Int gridHeight = Min( maxGatherDim, m );
+        const Int gridWidth = Min( maxGatherDim, n );
+        Matrix<double> density;
+        Zeros( density, gridHeight, gridWidth );
+        double* densBuf = density.Buffer();
+        const Int numLocalEntries = A.NumLocalEntries();
+        for( Int e=0; e<numLocalEntries; ++e )
+        {
+            const Int bi = Int( ((long long)A.Row(e)*gridHeight)/m );
+            const Int bj = Int( ((long long)A.Col(e)*gridWidth)/n );
+            densBuf[bi+bj*gridHeight] =
+              Max( densBuf[bi+bj*gridHeight], double(Abs(A.Value(e))) );
+        }
+        mpi::Reduce
+        ( density.Buffer(), gridHeight*gridWidth, mpi::MAX, 0,
+          A.Grid().Comm() );
+        if( A.Grid().Rank() == 0 )
+            Display( density, title );
+        return;
+    }
     if( A.Grid().Rank() == 0 )
     {
         SparseMatrix<T> ASeq;
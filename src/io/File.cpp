@@ -8,8 +8,46 @@
 */
 #include <El.hpp>
 
+#include <map>
+#include <mutex>
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+struct MemoryMapInfo
+{
+    void* baseAddress;
+    size_t numBytes;
+};
+
+std::mutex memoryMapMutex;
+std::map<const void*,MemoryMapInfo> memoryMaps;
+
+}
+
 namespace El {
 
+void RegisterMemoryMap
+( const void* buffer, void* baseAddress, size_t numBytes )
+{
+    std::lock_guard<std::mutex> lock( ::memoryMapMutex );
+    ::memoryMaps[buffer] = MemoryMapInfo{ baseAddress, numBytes };
+}
+
+void FreeMemoryMap( const void* buffer )
+{
+    std::lock_guard<std::mutex> lock( ::memoryMapMutex );
+    auto it = ::memoryMaps.find( buffer );
+    if( it == ::memoryMaps.end() )
+        RuntimeError("Buffer was not registered as a memory map");
+#ifndef _WIN32
+    munmap( it->second.baseAddress, it->second.numBytes );
+#endif
+    ::memoryMaps.erase( it );
+}
+
 const char* QtImageFormat( FileFormat format )
 {
     switch( format )
@@ -29,18 +67,20 @@ string FileExtension( FileFormat format )
 {
     switch( format )
     {
-    case ASCII:            return "txt";  break;
-    case ASCII_MATLAB:     return "m";    break;
-    case BINARY:           return "bin";  break;
-    case BINARY_FLAT:      return "dat";  break;
-    case BMP:              return "bmp";  break;
-    case JPG:              return "jpg";  break;
-    case JPEG:             return "jpeg"; break;
-    case MATRIX_MARKET:    return "mm";   break;
-    case PNG:              return "png";  break;
-    case PPM:              return "ppm";  break;
-    case XBM:              return "xbm";  break;
-    case XPM:              return "xpm";  break;
+    case ASCII:             return "txt";  break;
+    case ASCII_MATLAB:      return "m";    break;
+    case BINARY:            return "bin";  break;
+    case BINARY_COMPRESSED: return "elbz"; break;
+    case BINARY_FLAT:       return "dat";  break;
+    case BINARY_MMAP:       return "elbm"; break;
+    case BMP:               return "bmp";  break;
+    case JPG:               return "jpg";  break;
+    case JPEG:              return "jpeg"; break;
+    case MATRIX_MARKET:     return "mm";   break;
+    case PNG:               return "png";  break;
+    case PPM:               return "ppm";  break;
+    case XBM:               return "xbm";  break;
+    case XPM:               return "xpm";  break;
     default: LogicError("Format not found"); return "N/A"; break;
     }
 }
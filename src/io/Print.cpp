@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <cstdio>
 
 namespace El {
 
@@ -19,18 +20,125 @@ void ConfigurePrecision( ostream& os )
     os.precision( numDecimals );
 }
 
-// Dense
-// =====
+namespace {
 
-template<typename T>
-void Print( const Matrix<T>& A, string title, ostream& os )
+// Streaming one ostream insertion per element costs a sentry, a locale
+// lookup, and a virtual streambuf call each time, which dominates the cost
+// of large diagnostic dumps. The helpers below instead format into a fixed
+// chunk with snprintf (whose "C" numeric conventions match what we emit
+// through ostreams anyway) and hand the chunk to the stream in large writes.
+
+const size_t printChunkSize = 1u<<16;
+// No single formatted item (e.g., a 17-digit double) approaches this bound
+const size_t printMaxItemChars = 64;
+
+class ChunkedWriter
 {
-    EL_DEBUG_CSE
-    if( title != "" )
-        os << title << endl;
+public:
+    ChunkedWriter( ostream& os ) : os_(os) { }
+    ~ChunkedWriter() { Flush(); }
 
-    ConfigurePrecision<T>( os );
+    void Flush()
+    {
+        if( used_ != 0 )
+        {
+            os_.write( buf_, used_ );
+            used_ = 0;
+        }
+    }
+
+    // Return a head pointer guaranteed to have printMaxItemChars of room
+    char* Head()
+    {
+        if( used_+printMaxItemChars > printChunkSize )
+            Flush();
+        return buf_+used_;
+    }
+    void Advance( int numChars )
+    {
+        if( numChars > 0 )
+            used_ += size_t(numChars);
+    }
+
+    void Put( char c ) { *Head() = c; Advance( 1 ); }
+
+private:
+    ostream& os_;
+    char buf_[printChunkSize];
+    size_t used_=0;
+};
+
+// The elements types with a direct snprintf rendering; the formats are
+// chosen so that the output is identical to the ostream path
+template<typename T> struct CanFastPrint
+{ static const bool value=false; };
+template<> struct CanFastPrint<Int>
+{ static const bool value=true; };
+template<> struct CanFastPrint<float>
+{ static const bool value=true; };
+template<> struct CanFastPrint<double>
+{ static const bool value=true; };
+template<typename Real> struct CanFastPrint<Complex<Real>>
+{ static const bool value=CanFastPrint<Real>::value; };
+
+// Mirror the stream's floatfield flags (the Ascii writers, for instance,
+// force scientific notation)
+inline const char* RealFormat( const ostream& os )
+{
+    const std::ios::fmtflags field = os.flags() & std::ios::floatfield;
+    if( field == std::ios::scientific )
+        return "%.*e";
+    else if( field == std::ios::fixed )
+        return "%.*f";
+    else
+        return "%.*g";
+}
+
+inline void AppendItem
+( ChunkedWriter& w, const char* fmt, int prec, float alpha )
+{ w.Advance
+  ( snprintf( w.Head(), printMaxItemChars, fmt, prec, double(alpha) ) ); }
+inline void AppendItem
+( ChunkedWriter& w, const char* fmt, int prec, double alpha )
+{ w.Advance( snprintf( w.Head(), printMaxItemChars, fmt, prec, alpha ) ); }
+inline void AppendItem( ChunkedWriter& w, const char*, int, Int alpha )
+{ w.Advance
+  ( snprintf( w.Head(), printMaxItemChars, "%lld", (long long)alpha ) ); }
+template<typename Real>
+inline void AppendItem
+( ChunkedWriter& w, const char* fmt, int prec, Complex<Real> alpha )
+{
+    AppendItem( w, fmt, prec, alpha.real() );
+    w.Put( '+' );
+    AppendItem( w, fmt, prec, alpha.imag() );
+    w.Put( 'i' );
+}
+
+template<typename T,typename=EnableIf<CanFastPrint<T>>>
+void PrintBody( const Matrix<T>& A, ostream& os )
+{
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const char* fmt = RealFormat( os );
+    const int prec = int(os.precision());
+    ChunkedWriter writer( os );
+    for( Int i=0; i<height; ++i )
+    {
+        for( Int j=0; j<width; ++j )
+        {
+            AppendItem( writer, fmt, prec, A.Get(i,j) );
+            writer.Put( ' ' );
+        }
+        writer.Put( '\n' );
+    }
+    writer.Put( '\n' );
+    writer.Flush();
+    os.flush();
+}
 
+template<typename T,typename=DisableIf<CanFastPrint<T>>,typename=void>
+void PrintBody( const Matrix<T>& A, ostream& os )
+{
     const Int height = A.Height();
     const Int width = A.Width();
     for( Int i=0; i<height; ++i )
@@ -42,6 +150,55 @@ void Print( const Matrix<T>& A, string title, ostream& os )
     os << endl;
 }
 
+template<typename T,typename=EnableIf<CanFastPrint<T>>>
+void PrintTriplets
+( Int numEntries, const Int* srcBuf, const Int* tgtBuf, const T* valBuf,
+  ostream& os )
+{
+    const char* fmt = RealFormat( os );
+    const int prec = int(os.precision());
+    ChunkedWriter writer( os );
+    for( Int s=0; s<numEntries; ++s )
+    {
+        AppendItem( writer, fmt, prec, srcBuf[s] );
+        writer.Put( ' ' );
+        AppendItem( writer, fmt, prec, tgtBuf[s] );
+        writer.Put( ' ' );
+        AppendItem( writer, fmt, prec, valBuf[s] );
+        writer.Put( '\n' );
+    }
+    writer.Put( '\n' );
+    writer.Flush();
+    os.flush();
+}
+
+template<typename T,typename=DisableIf<CanFastPrint<T>>,typename=void>
+void PrintTriplets
+( Int numEntries, const Int* srcBuf, const Int* tgtBuf, const T* valBuf,
+  ostream& os )
+{
+    for( Int s=0; s<numEntries; ++s )
+        os << srcBuf[s] << " " << tgtBuf[s] << " " << valBuf[s] << "\n";
+    os << endl;
+}
+
+} // anonymous namespace
+
+// Dense
+// =====
+
+template<typename T>
+void Print( const Matrix<T>& A, string title, ostream& os )
+{
+    EL_DEBUG_CSE
+    if( title != "" )
+        os << title << endl;
+
+    ConfigurePrecision<T>( os );
+
+    PrintBody( A, os );
+}
+
 template<typename T>
 void Print
 ( const AbstractDistMatrix<T>& A, string title, ostream& os )
@@ -86,9 +243,17 @@ void Print( const Graph& graph, string msg, ostream& os )
     const Int numEdges = graph.NumEdges();
     const Int* srcBuf = graph.LockedSourceBuffer();
     const Int* tgtBuf = graph.LockedTargetBuffer();
+    ChunkedWriter writer( os );
     for( Int e=0; e<numEdges; ++e )
-        os << srcBuf[e] << " " << tgtBuf[e] << "\n";
-    os << endl;
+    {
+        AppendItem( writer, "", 0, srcBuf[e] );
+        writer.Put( ' ' );
+        AppendItem( writer, "", 0, tgtBuf[e] );
+        writer.Put( '\n' );
+    }
+    writer.Put( '\n' );
+    writer.Flush();
+    os.flush();
 }
 
 void Print( const DistGraph& graph, string msg, ostream& os )
@@ -117,13 +282,9 @@ void Print( const SparseMatrix<T>& A, string msg, ostream& os )
 
     ConfigurePrecision<T>( os );
 
-    const Int numEntries = A.NumEntries();
-    const Int* srcBuf = A.LockedSourceBuffer();
-    const Int* tgtBuf = A.LockedTargetBuffer();
-    const T* valBuf = A.LockedValueBuffer();
-    for( Int s=0; s<numEntries; ++s )
-        os << srcBuf[s] << " " << tgtBuf[s] << " " << valBuf[s] << "\n";
-    os << endl;
+    PrintTriplets
+    ( A.NumEntries(), A.LockedSourceBuffer(), A.LockedTargetBuffer(),
+      A.LockedValueBuffer(), os );
 }
 
 template<typename T>
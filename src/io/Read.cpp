@@ -11,8 +11,13 @@
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
+#include "./Read/BinaryCompressed.hpp"
+#include "./Read/BinaryMmap.hpp"
 #include "./Read/BinaryFlat.hpp"
 #include "./Read/MatrixMarket.hpp"
+#include "./Read/ParallelBinary.hpp"
+#include "./Read/ParallelBinaryCompressed.hpp"
+#include "./Read/ParallelMatrixMarket.hpp"
 
 namespace El {
 
@@ -34,9 +39,15 @@ void Read( Matrix<T>& A, const string filename, FileFormat format )
     case BINARY:
         read::Binary( A, filename );
         break;
+    case BINARY_COMPRESSED:
+        read::BinaryCompressed( A, filename );
+        break;
     case BINARY_FLAT:
         read::BinaryFlat( A, A.Height(), A.Width(), filename );
         break;
+    case BINARY_MMAP:
+        read::BinaryMmap( A, filename );
+        break;
     case MATRIX_MARKET:
         read::MatrixMarket( A, filename );
         break;
@@ -90,9 +101,15 @@ void Read
         case BINARY:
             read::Binary( A, filename );
             break;
+        case BINARY_COMPRESSED:
+            read::BinaryCompressed( A, filename );
+            break;
         case BINARY_FLAT:
             read::BinaryFlat( A, A.Height(), A.Width(), filename );
             break;
+        case BINARY_MMAP:
+            read::BinaryMmap( A, filename );
+            break;
         case MATRIX_MARKET:
             read::MatrixMarket( A, filename );
             break;
@@ -136,6 +153,47 @@ void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
     }
 }
 
+template<typename T>
+void ParallelRead
+( AbstractDistMatrix<T>& A, const string filename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    switch( format )
+    {
+    case BINARY:
+    case BINARY_MMAP:
+        read::ParallelBinary( A, filename, format );
+        break;
+    case BINARY_COMPRESSED:
+        read::ParallelBinaryCompressed( A, filename );
+        break;
+    default:
+        LogicError("Format unsupported for parallel reads of a DistMatrix");
+    }
+}
+
+template<typename T>
+void ParallelRead
+( DistSparseMatrix<T>& A, const string filename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    switch( format )
+    {
+    case MATRIX_MARKET:
+        read::ParallelMatrixMarket( A, filename );
+        break;
+    default:
+        LogicError
+        ("Format unsupported for parallel reads of a DistSparseMatrix");
+    }
+}
+
 #define PROTO(T) \
   template void Read \
   ( Matrix<T>& A, const string filename, FileFormat format ); \
@@ -145,6 +203,10 @@ void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
   template void Read \
   ( SparseMatrix<T>& A, const string filename, FileFormat format ); \
   template void Read \
+  ( DistSparseMatrix<T>& A, const string filename, FileFormat format ); \
+  template void ParallelRead \
+  ( AbstractDistMatrix<T>& A, const string filename, FileFormat format ); \
+  template void ParallelRead \
   ( DistSparseMatrix<T>& A, const string filename, FileFormat format );
 
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,206 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_BINARYCOMPRESSED_HPP
+#define EL_READ_BINARYCOMPRESSED_HPP
+
+namespace El {
+namespace read {
+
+inline void
+BinaryCompressedMeta
+( std::ifstream& file,
+  const string& filename,
+  BinaryCompressedHeader& header,
+  vector<BinaryCompressedChunk>& table )
+{
+    file.read( (char*)&header, sizeof(header) );
+    if( !file )
+        RuntimeError("Could not read the header of ",filename);
+    if( !std::equal( header.magic, header.magic+8, BINARY_COMPRESSED_MAGIC ) )
+        RuntimeError(filename," did not begin with the expected magic string");
+    if( header.version != BINARY_COMPRESSED_VERSION )
+        RuntimeError
+        (filename," was written with an unsupported format version");
+    table.resize( header.numChunks );
+    file.read
+    ( (char*)table.data(), header.numChunks*sizeof(BinaryCompressedChunk) );
+    if( !file )
+        RuntimeError("Could not read the chunk table of ",filename);
+}
+
+// Whether the strided index sets {shiftA + s*strideA} and {shiftB + t*strideB}
+// overlap, which allows a distributed restore to skip (and avoid ever
+// decompressing) the chunks which cannot contribute to its local matrix
+inline bool
+StridedSetsIntersect
+( unsigned long long shiftA, unsigned long long strideA,
+  Int shiftB, Int strideB )
+{
+    const Int gcd = GCD( Int(strideA), strideB );
+    return Mod( Int(shiftA)-shiftB, gcd ) == 0;
+}
+
+template<typename T>
+inline void
+BinaryCompressed( Matrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    BinaryCompressedHeader header;
+    vector<BinaryCompressedChunk> table;
+    BinaryCompressedMeta( file, filename, header, table );
+    if( header.elementSize != sizeof(T) )
+        RuntimeError(filename," stores entries of a different size");
+    const Compression codec = static_cast<Compression>(header.codec);
+    if( !HaveCompression(codec) )
+        RuntimeError
+        (filename," requires a codec Elemental was not configured with");
+
+    A.Resize( header.height, header.width );
+    const Int numChunks = header.numChunks;
+    vector<vector<byte>> compressed( numChunks );
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        compressed[chunk].resize( table[chunk].compressedBytes );
+        file.seekg( std::streamoff(table[chunk].offset) );
+        file.read
+        ( (char*)compressed[chunk].data(), compressed[chunk].size() );
+    }
+
+    // The chunks cover disjoint entries, so they may be decompressed and
+    // scattered concurrently
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const auto& entry = table[chunk];
+        const Int rowShift = entry.rowShift;
+        const Int rowStride = entry.rowStride;
+        const Int localHeight = entry.localHeight;
+        const Int colShift = entry.colShift;
+        const Int colStride = entry.colStride;
+        const Int localWidth = entry.localWidth;
+        if( localHeight == 0 || localWidth == 0 )
+            continue;
+        vector<T> entries( size_t(localHeight)*localWidth );
+        Decompress
+        ( codec, sizeof(T),
+          compressed[chunk].data(), compressed[chunk].size(),
+          reinterpret_cast<byte*>(entries.data()),
+          entries.size()*sizeof(T) );
+        if( rowStride == 1 && colStride == 1 )
+        {
+            for( Int t=0; t<localWidth; ++t )
+                MemCopy
+                ( A.Buffer(rowShift,colShift+t),
+                  &entries[t*localHeight], localHeight );
+        }
+        else
+        {
+            for( Int t=0; t<localWidth; ++t )
+            {
+                const Int j = colShift + t*colStride;
+                for( Int s=0; s<localHeight; ++s )
+                {
+                    const Int i = rowShift + s*rowStride;
+                    A(i,j) = entries[s+t*localHeight];
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+inline void
+BinaryCompressed( AbstractDistMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    BinaryCompressedHeader header;
+    vector<BinaryCompressedChunk> table;
+    BinaryCompressedMeta( file, filename, header, table );
+    if( header.elementSize != sizeof(T) )
+        RuntimeError(filename," stores entries of a different size");
+    const Compression codec = static_cast<Compression>(header.codec);
+    if( !HaveCompression(codec) )
+        RuntimeError
+        (filename," requires a codec Elemental was not configured with");
+
+    A.Resize( header.height, header.width );
+    if( A.CrossRank() != A.Root() )
+        return;
+
+    // Each rank only reads and decompresses the chunks whose strided row and
+    // column sets intersect its own
+    vector<Int> needed;
+    const Int numChunks = header.numChunks;
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const auto& entry = table[chunk];
+        if( entry.localHeight == 0 || entry.localWidth == 0 )
+            continue;
+        if( StridedSetsIntersect
+            ( entry.rowShift, entry.rowStride, A.ColShift(), A.ColStride() )
+            &&
+            StridedSetsIntersect
+            ( entry.colShift, entry.colStride, A.RowShift(), A.RowStride() ) )
+            needed.push_back( chunk );
+    }
+    const Int numNeeded = needed.size();
+    vector<vector<byte>> compressed( numNeeded );
+    for( Int k=0; k<numNeeded; ++k )
+    {
+        const auto& entry = table[needed[k]];
+        compressed[k].resize( entry.compressedBytes );
+        file.seekg( std::streamoff(entry.offset) );
+        file.read( (char*)compressed[k].data(), compressed[k].size() );
+    }
+
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numNeeded; ++k )
+    {
+        const auto& entry = table[needed[k]];
+        const Int rowShift = entry.rowShift;
+        const Int rowStride = entry.rowStride;
+        const Int localHeight = entry.localHeight;
+        const Int colShift = entry.colShift;
+        const Int colStride = entry.colStride;
+        const Int localWidth = entry.localWidth;
+        vector<T> entries( size_t(localHeight)*localWidth );
+        Decompress
+        ( codec, sizeof(T),
+          compressed[k].data(), compressed[k].size(),
+          reinterpret_cast<byte*>(entries.data()),
+          entries.size()*sizeof(T) );
+        for( Int t=0; t<localWidth; ++t )
+        {
+            const Int j = colShift + t*colStride;
+            if( !A.IsLocalCol(j) )
+                continue;
+            const Int jLoc = A.LocalCol(j);
+            for( Int s=0; s<localHeight; ++s )
+            {
+                const Int i = rowShift + s*rowStride;
+                if( A.IsLocalRow(i) )
+                    A.SetLocal
+                    ( A.LocalRow(i), jLoc, entries[s+t*localHeight] );
+            }
+        }
+    }
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_BINARYCOMPRESSED_HPP
@@ -0,0 +1,166 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_BINARYMMAP_HPP
+#define EL_READ_BINARYMMAP_HPP
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace El {
+namespace read {
+
+#ifndef _WIN32
+inline void* BinaryMmapFile
+( const string& filename,
+  size_t elementSize,
+  BinaryMmapHeader& header,
+  size_t& numBytes,
+  bool writable )
+{
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd == -1 )
+        RuntimeError("Could not open ",filename);
+    struct stat fileStat;
+    if( fstat( fd, &fileStat ) == -1 )
+    {
+        close( fd );
+        RuntimeError("Could not stat ",filename);
+    }
+    numBytes = fileStat.st_size;
+    if( numBytes < sizeof(BinaryMmapHeader) )
+    {
+        close( fd );
+        RuntimeError(filename," is too small to hold a header");
+    }
+    // A private mapping makes any modification of the buffer copy-on-write
+    // rather than flushing it back into the file
+    const int protection = ( writable ? PROT_READ|PROT_WRITE : PROT_READ );
+    void* baseAddress =
+      mmap( nullptr, numBytes, protection, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if( baseAddress == MAP_FAILED )
+        RuntimeError("Could not memory-map ",filename);
+
+    header = *static_cast<const BinaryMmapHeader*>(baseAddress);
+    string error;
+    if( !std::equal( header.magic, header.magic+8, BINARY_MMAP_MAGIC ) )
+        error = "did not begin with the expected magic string";
+    else if( header.version != BINARY_MMAP_VERSION )
+        error = "was written with an unsupported format version";
+    else if( header.elementSize != elementSize )
+        error = "stores entries of a different size";
+    else if( header.dataOffset % elementSize != 0 )
+        error = "has a misaligned data offset";
+    else if( numBytes <
+             header.dataOffset + header.height*header.width*elementSize )
+        error = "is too small to hold its data";
+    if( error != "" )
+    {
+        munmap( baseAddress, numBytes );
+        RuntimeError(filename," ",error);
+    }
+    return baseAddress;
+}
+#endif // ifndef _WIN32
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+inline void
+BinaryMmap( Matrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+#ifdef _WIN32
+    RuntimeError("Memory-mapped reads are not supported on this platform");
+#else
+    BinaryMmapHeader header;
+    size_t numBytes;
+    void* baseAddress =
+      BinaryMmapFile( filename, sizeof(T), header, numBytes, true );
+    T* buffer =
+      reinterpret_cast<T*>
+      ( static_cast<char*>(baseAddress) + header.dataOffset );
+    // The mapping must remain valid as long as A observes it; it can be
+    // released with FreeMemoryMap( A.LockedBuffer() )
+    RegisterMemoryMap( buffer, baseAddress, numBytes );
+    A.Attach( Int(header.height), Int(header.width), buffer,
+              Int(header.height) );
+#endif
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+inline void
+BinaryMmap( Matrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    RuntimeError("BINARY_MMAP requires a packed datatype");
+}
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+inline void
+BinaryMmap( AbstractDistMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+#ifdef _WIN32
+    RuntimeError("Memory-mapped reads are not supported on this platform");
+#else
+    BinaryMmapHeader header;
+    size_t numBytes;
+    void* baseAddress =
+      BinaryMmapFile( filename, sizeof(T), header, numBytes, false );
+    const Int height = Int(header.height);
+    const Int width = Int(header.width);
+    A.Resize( height, width );
+    if( A.CrossRank() != A.Root() )
+    {
+        munmap( baseAddress, numBytes );
+        return;
+    }
+    // Each process only touches (and therefore only pages in) its local
+    // strided section of the mapping
+    const T* data =
+      reinterpret_cast<const T*>
+      ( static_cast<const char*>(baseAddress) + header.dataOffset );
+    Matrix<T>& ALoc = A.Matrix();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    if( A.ColStride() == 1 )
+    {
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            MemCopy( ALoc.Buffer(0,jLoc), &data[j*height], height );
+        }
+    }
+    else
+    {
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const T* col = &data[j*height];
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                ALoc(iLoc,jLoc) = col[A.GlobalRow(iLoc)];
+        }
+    }
+    munmap( baseAddress, numBytes );
+#endif
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+inline void
+BinaryMmap( AbstractDistMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    RuntimeError("BINARY_MMAP requires a packed datatype");
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_BINARYMMAP_HPP
@@ -9,6 +9,8 @@
 #ifndef EL_READ_MATRIXMARKET_HPP
 #define EL_READ_MATRIXMARKET_HPP
 
+#include "./MatrixMarketScan.hpp"
+
 namespace El {
 namespace read {
 
@@ -338,6 +340,25 @@ void MatrixMarket( SparseMatrix<T>& A, const string filename )
 
     // Fill in the nonzero entries
     // ===========================
+#ifndef _WIN32
+    // Memory-map the coordinate section and scan it across the available
+    // threads with character-level parsers, expanding any declared
+    // symmetry during the parse itself rather than in a second pass
+    const std::streamoff dataStart = file.tellg();
+    file.close();
+    mm_scan::MappedFile map( filename );
+    const Int estimated = ( isGeneral ? numNonzero : 2*numNonzero );
+    vector<Entry<T>> entries;
+    mm_scan::ScanRange
+    ( map.Data()+dataStart, map.Data()+map.NumBytes(),
+      isMatrix, isComplex, isPattern,
+      isSymmetric, isSkewSymmetric, isHermitian,
+      0, m, estimated, entries );
+    A.Reserve( entries.size() );
+    for( const auto& entry : entries )
+        A.QueueUpdate( entry );
+    A.ProcessQueues();
+#else
     int i, j;
     Real realPart, imagPart;
     T value;
@@ -401,6 +422,7 @@ void MatrixMarket( SparseMatrix<T>& A, const string filename )
         MakeSymmetric( LOWER, A, conjugateSkew );
         ScaleTrapezoid( T(-1), UPPER, A, 1 );
     }
+#endif // ifndef _WIN32
 }
 
 template<typename T>
@@ -509,6 +531,29 @@ void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
 
     // Fill in the local nonzero entries by passively calling QueueUpdate
     // ==================================================================
+#ifndef _WIN32
+    // Memory-map the coordinate section and scan it across the available
+    // threads with character-level parsers, keeping only the locally-owned
+    // rows and expanding any declared symmetry during the parse itself
+    const std::streamoff dataStart = file.tellg();
+    file.close();
+    mm_scan::MappedFile map( filename );
+    const Int estimated =
+      ( isGeneral ? numNonzero : 2*numNonzero ) / A.Grid().Size();
+    const Int rowBeg = A.FirstLocalRow();
+    const Int rowEnd = rowBeg + A.LocalHeight();
+    vector<Entry<T>> entries;
+    mm_scan::ScanRange
+    ( map.Data()+dataStart, map.Data()+map.NumBytes(),
+      isMatrix, isComplex, isPattern,
+      isSymmetric, isSkewSymmetric, isHermitian,
+      rowBeg, rowEnd, estimated, entries );
+    A.Reserve( entries.size() );
+    const bool passive = true;
+    for( const auto& entry : entries )
+        A.QueueUpdate( entry, passive );
+    A.ProcessLocalQueues();
+#else
     int i, j;
     Real realPart, imagPart;
     T value;
@@ -579,6 +624,7 @@ void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
         MakeSymmetric( LOWER, A, conjugateSkew );
         ScaleTrapezoid( T(-1), UPPER, A, 1 );
     }
+#endif // ifndef _WIN32
 }
 
 } // namespace read
@@ -0,0 +1,331 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_MATRIXMARKETSCAN_HPP
+#define EL_READ_MATRIXMARKETSCAN_HPP
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace El {
+namespace read {
+namespace mm_scan {
+
+// A fast scanner for the coordinate section of a Matrix Market file: the
+// input is memory-mapped, split at line boundaries across the available
+// threads, and converted with character-level parsers rather than one
+// istringstream per line, with any symmetric couplings expanded as they
+// are encountered rather than in a second pass over the assembled matrix.
+
+#ifndef _WIN32
+
+// An RAII read-only private mapping of an input file
+class MappedFile
+{
+public:
+    MappedFile( const string& filename )
+    {
+        const int fd = open( filename.c_str(), O_RDONLY );
+        if( fd == -1 )
+            RuntimeError("Could not open ",filename);
+        struct stat fileStat;
+        if( fstat( fd, &fileStat ) == -1 )
+        {
+            close( fd );
+            RuntimeError("Could not stat ",filename);
+        }
+        numBytes_ = fileStat.st_size;
+        if( numBytes_ > 0 )
+        {
+            baseAddress_ =
+              mmap( nullptr, numBytes_, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if( baseAddress_ == MAP_FAILED )
+            {
+                close( fd );
+                RuntimeError("Could not memory-map ",filename);
+            }
+        }
+        close( fd );
+    }
+    ~MappedFile()
+    {
+        if( baseAddress_ != nullptr )
+            munmap( baseAddress_, numBytes_ );
+    }
+    const char* Data() const
+    { return static_cast<const char*>(baseAddress_); }
+    size_t NumBytes() const { return numBytes_; }
+private:
+    void* baseAddress_=nullptr;
+    size_t numBytes_=0;
+};
+
+inline void SkipSpace( const char*& p, const char* end )
+{
+    while( p != end && (*p==' ' || *p=='\t' || *p=='\r' || *p=='\n') )
+        ++p;
+}
+
+inline const char* NextLineStart( const char* p, const char* end )
+{
+    while( p != end && *p != '\n' )
+        ++p;
+    return ( p == end ? end : p+1 );
+}
+
+// Round an arbitrary split point up to the nearest line start so that
+// independently computed ranges agree on the ownership of a straddling
+// line (the line belongs to whichever range contains its first character)
+inline const char* LineStartAtOrAfter
+( const char* dataBeg, const char* p, const char* end )
+{
+    if( p == dataBeg || p[-1] == '\n' )
+        return p;
+    return NextLineStart( p, end );
+}
+
+inline bool ParseInt( const char*& p, const char* end, Int& value )
+{
+    SkipSpace( p, end );
+    bool negative = false;
+    if( p != end && (*p=='+' || *p=='-') )
+        negative = ( *p++ == '-' );
+    long long magnitude = 0;
+    const char* digitsBeg = p;
+    while( p != end && *p >= '0' && *p <= '9' )
+        magnitude = 10*magnitude + (*p++ - '0');
+    if( p == digitsBeg )
+        return false;
+    value = Int(negative ? -magnitude : magnitude);
+    return true;
+}
+
+// Parse a decimal floating-point token. Up to eighteen significant digits
+// are accumulated exactly in integer arithmetic and the decimal exponent is
+// applied with a single scaling, which is faithful to within an ulp or so
+// for the native types (and exact for the extended-precision types whenever
+// the mantissa and scale are representable)
+template<typename Real>
+bool ParseReal( const char*& p, const char* end, Real& value )
+{
+    SkipSpace( p, end );
+    bool negative = false;
+    if( p != end && (*p=='+' || *p=='-') )
+        negative = ( *p++ == '-' );
+    long long mantissa = 0;
+    Int numDigits = 0;
+    Int exponent = 0;
+    bool sawDigit = false;
+    while( p != end && *p >= '0' && *p <= '9' )
+    {
+        sawDigit = true;
+        if( numDigits < 18 )
+        {
+            mantissa = 10*mantissa + (*p - '0');
+            ++numDigits;
+        }
+        else
+            ++exponent;
+        ++p;
+    }
+    if( p != end && *p == '.' )
+    {
+        ++p;
+        while( p != end && *p >= '0' && *p <= '9' )
+        {
+            sawDigit = true;
+            if( numDigits < 18 )
+            {
+                mantissa = 10*mantissa + (*p - '0');
+                ++numDigits;
+                --exponent;
+            }
+            ++p;
+        }
+    }
+    if( !sawDigit )
+        return false;
+    if( p != end && (*p=='e' || *p=='E' || *p=='d' || *p=='D') )
+    {
+        ++p;
+        bool expNegative = false;
+        if( p != end && (*p=='+' || *p=='-') )
+            expNegative = ( *p++ == '-' );
+        Int expMagnitude = 0;
+        while( p != end && *p >= '0' && *p <= '9' )
+            expMagnitude = 10*expMagnitude + (*p++ - '0');
+        exponent += ( expNegative ? -expMagnitude : expMagnitude );
+    }
+    if( negative )
+        mantissa = -mantissa;
+    // Split the mantissa so that each half converts to double exactly
+    const long long hi = mantissa / 1000000000;
+    const long long lo = mantissa - 1000000000*hi;
+    value = Real(double(hi))*Real(1.e9) + Real(double(lo));
+    if( exponent > 0 )
+        value *= Pow( Real(10), Real(exponent) );
+    else if( exponent < 0 )
+        value /= Pow( Real(10), Real(-exponent) );
+    return true;
+}
+
+// Parse the coordinate lines in [beg,end) into (i,j,value) triples,
+// mirroring each off-diagonal coupling during the parse when the header
+// declared a symmetry. Entries whose rows fall outside [rowBeg,rowEnd) are
+// dropped, which allows a distributed caller to retain only the rows it
+// owns (the mirrored couplings are filtered independently, since their
+// owners generally differ)
+template<typename T>
+void ScanTriples
+( const char* beg,
+  const char* end,
+  bool isMatrix,
+  bool isComplex,
+  bool isPattern,
+  bool isSymmetric,
+  bool isSkewSymmetric,
+  bool isHermitian,
+  Int rowBeg,
+  Int rowEnd,
+  vector<Entry<T>>& entries )
+{
+    typedef Base<T> Real;
+    const bool mirror = ( isSymmetric || isSkewSymmetric || isHermitian );
+    const char* p = beg;
+    while( p != end )
+    {
+        Entry<T> entry;
+        if( !ParseInt( p, end, entry.i ) )
+            break;
+        --entry.i; // convert from Fortran to C indexing
+        if( isMatrix )
+        {
+            if( !ParseInt( p, end, entry.j ) )
+                RuntimeError("Missing column coordinate for row ",entry.i);
+            --entry.j;
+        }
+        else
+            entry.j = 0;
+
+        if( isPattern )
+            entry.value = T(1);
+        else
+        {
+            Real realPart, imagPart;
+            if( !ParseReal( p, end, realPart ) )
+                RuntimeError
+                ("Could not extract entry (",entry.i,",",entry.j,")");
+            if( isComplex )
+            {
+                if( !ParseReal( p, end, imagPart ) )
+                    RuntimeError
+                    ("Could not extract complex entry (",
+                     entry.i,",",entry.j,")");
+                SetRealPart( entry.value, realPart );
+                SetImagPart( entry.value, imagPart );
+            }
+            else
+                entry.value = T(realPart);
+        }
+
+        if( entry.i >= rowBeg && entry.i < rowEnd )
+            entries.push_back( entry );
+        if( mirror && entry.i != entry.j &&
+            entry.j >= rowBeg && entry.j < rowEnd )
+        {
+            Entry<T> twin;
+            twin.i = entry.j;
+            twin.j = entry.i;
+            if( isHermitian )
+                twin.value = Conj(entry.value);
+            else if( isSkewSymmetric )
+                twin.value = -entry.value;
+            else
+                twin.value = entry.value;
+            entries.push_back( twin );
+        }
+    }
+}
+
+// Scan the line-aligned byte range [rangeBeg,rangeEnd) of a mapped
+// coordinate section across the available threads, splitting at line
+// boundaries (see LineStartAtOrAfter for aligning an arbitrary split)
+template<typename T>
+void ScanRange
+( const char* rangeBeg,
+  const char* rangeEnd,
+  bool isMatrix,
+  bool isComplex,
+  bool isPattern,
+  bool isSymmetric,
+  bool isSkewSymmetric,
+  bool isHermitian,
+  Int rowBeg,
+  Int rowEnd,
+  Int estimatedEntries,
+  vector<Entry<T>>& entries )
+{
+    const char* beg = rangeBeg;
+#ifdef EL_HYBRID
+    const Int numThreads = omp_get_max_threads();
+    // Avoid spawning threads over trivially small inputs
+    const long long minBytesPerChunk = 1<<20;
+    const Int numChunks =
+      Max( Min( Int(numThreads),
+                Int((rangeEnd-beg)/minBytesPerChunk) ), Int(1) );
+    if( numChunks > 1 )
+    {
+        // Provisional splits are pushed forward to the next line start
+        // (NextLineStart is monotone, so the bounds remain ordered even
+        // when a single line spans several provisional splits)
+        vector<const char*> bounds( numChunks+1 );
+        bounds[0] = beg;
+        bounds[numChunks] = rangeEnd;
+        const long long span = rangeEnd - beg;
+        for( Int c=1; c<numChunks; ++c )
+            bounds[c] =
+              NextLineStart( beg + (span*c)/numChunks, rangeEnd );
+        vector<vector<Entry<T>>> chunkEntries( numChunks );
+        EL_PARALLEL_FOR
+        for( Int c=0; c<numChunks; ++c )
+        {
+            chunkEntries[c].reserve( estimatedEntries/numChunks + 1 );
+            ScanTriples
+            ( bounds[c], bounds[c+1],
+              isMatrix, isComplex, isPattern,
+              isSymmetric, isSkewSymmetric, isHermitian,
+              rowBeg, rowEnd, chunkEntries[c] );
+        }
+        size_t total = entries.size();
+        for( Int c=0; c<numChunks; ++c )
+            total += chunkEntries[c].size();
+        entries.reserve( total );
+        for( Int c=0; c<numChunks; ++c )
+            entries.insert
+            ( entries.end(), chunkEntries[c].begin(), chunkEntries[c].end() );
+        return;
+    }
+#endif
+    entries.reserve( entries.size() + estimatedEntries );
+    ScanTriples
+    ( beg, rangeEnd, isMatrix, isComplex, isPattern,
+      isSymmetric, isSkewSymmetric, isHermitian,
+      rowBeg, rowEnd, entries );
+}
+
+#endif // ifndef _WIN32
+
+} // namespace mm_scan
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_MATRIXMARKETSCAN_HPP
@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_PARALLELBINARY_HPP
+#define EL_READ_PARALLELBINARY_HPP
+
+namespace El {
+namespace read {
+
+// Every rank concurrently reads its own local strided section through
+// MPI-IO file views rather than funneling the file through a single rank
+template<typename T,typename=EnableIf<IsPacked<T>>>
+inline void
+ParallelBinary
+( AbstractDistMatrix<T>& A, const string filename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    MPI_File file;
+    mpi::FileOpen
+    ( A.Grid().ViewingComm(), filename.c_str(), MPI_MODE_RDONLY, file );
+
+    Int height, width;
+    MPI_Offset dataOffset;
+    if( format == BINARY_MMAP )
+    {
+        BinaryMmapHeader header;
+        mpi::FileReadAt
+        ( file, 0, reinterpret_cast<byte*>(&header), sizeof(header) );
+        if( !std::equal( header.magic, header.magic+8, BINARY_MMAP_MAGIC ) )
+            RuntimeError
+            (filename," did not begin with the expected magic string");
+        if( header.version != BINARY_MMAP_VERSION )
+            RuntimeError
+            (filename," was written with an unsupported format version");
+        if( header.elementSize != sizeof(T) )
+            RuntimeError(filename," stores entries of a different size");
+        height = Int(header.height);
+        width = Int(header.width);
+        dataOffset = header.dataOffset;
+    }
+    else
+    {
+        Int dims[2];
+        mpi::FileReadAt( file, 0, dims, 2 );
+        height = dims[0];
+        width = dims[1];
+        dataOffset = 2*sizeof(Int);
+    }
+
+    A.Resize( height, width );
+    if( A.Participating() )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const Int colShift = A.ColShift();
+        const int colStride = A.ColStride();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const MPI_Offset offset =
+              dataOffset + (MPI_Offset(j)*height+colShift)*sizeof(T);
+            mpi::FileSetStridedView<T>( file, offset, colStride );
+            mpi::FileRead( file, A.Buffer(0,jLoc), localHeight );
+        }
+    }
+    mpi::FileClose( file );
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+inline void
+ParallelBinary
+( AbstractDistMatrix<T>& A, const string filename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    RuntimeError("Parallel reads require a packed datatype");
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_PARALLELBINARY_HPP
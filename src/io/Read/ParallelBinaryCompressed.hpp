@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_PARALLELBINARYCOMPRESSED_HPP
+#define EL_READ_PARALLELBINARYCOMPRESSED_HPP
+
+#include "./BinaryCompressed.hpp"
+
+namespace El {
+namespace read {
+
+// Every rank reads the chunk table and then only reads and decompresses the
+// chunks whose strided row and column sets intersect its own portion of the
+// matrix, so a parallel restore never performs a global decompression
+template<typename T,typename=EnableIf<IsPacked<T>>>
+inline void
+ParallelBinaryCompressed( AbstractDistMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    MPI_File file;
+    mpi::FileOpen
+    ( A.Grid().ViewingComm(), filename.c_str(), MPI_MODE_RDONLY, file );
+
+    BinaryCompressedHeader header;
+    mpi::FileReadAt
+    ( file, 0, reinterpret_cast<byte*>(&header), sizeof(header) );
+    if( !std::equal( header.magic, header.magic+8, BINARY_COMPRESSED_MAGIC ) )
+        RuntimeError(filename," did not begin with the expected magic string");
+    if( header.version != BINARY_COMPRESSED_VERSION )
+        RuntimeError
+        (filename," was written with an unsupported format version");
+    if( header.elementSize != sizeof(T) )
+        RuntimeError(filename," stores entries of a different size");
+    const Compression codec = static_cast<Compression>(header.codec);
+    if( !HaveCompression(codec) )
+        RuntimeError
+        (filename," requires a codec Elemental was not configured with");
+
+    const Int numChunks = header.numChunks;
+    vector<BinaryCompressedChunk> table( numChunks );
+    mpi::FileReadAt
+    ( file, sizeof(header),
+      reinterpret_cast<byte*>(table.data()),
+      numChunks*sizeof(BinaryCompressedChunk) );
+
+    A.Resize( header.height, header.width );
+    if( A.Participating() )
+    {
+        vector<Int> needed;
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            const auto& entry = table[chunk];
+            if( entry.localHeight == 0 || entry.localWidth == 0 )
+                continue;
+            if( StridedSetsIntersect
+                ( entry.rowShift, entry.rowStride,
+                  A.ColShift(), A.ColStride() )
+                &&
+                StridedSetsIntersect
+                ( entry.colShift, entry.colStride,
+                  A.RowShift(), A.RowStride() ) )
+                needed.push_back( chunk );
+        }
+        const Int numNeeded = needed.size();
+        vector<vector<byte>> compressed( numNeeded );
+        for( Int k=0; k<numNeeded; ++k )
+        {
+            const auto& entry = table[needed[k]];
+            compressed[k].resize( entry.compressedBytes );
+            mpi::FileReadAt
+            ( file, MPI_Offset(entry.offset),
+              compressed[k].data(), compressed[k].size() );
+        }
+
+        EL_PARALLEL_FOR
+        for( Int k=0; k<numNeeded; ++k )
+        {
+            const auto& entry = table[needed[k]];
+            const Int rowShift = entry.rowShift;
+            const Int rowStride = entry.rowStride;
+            const Int localHeight = entry.localHeight;
+            const Int colShift = entry.colShift;
+            const Int colStride = entry.colStride;
+            const Int localWidth = entry.localWidth;
+            vector<T> entries( size_t(localHeight)*localWidth );
+            Decompress
+            ( codec, sizeof(T),
+              compressed[k].data(), compressed[k].size(),
+              reinterpret_cast<byte*>(entries.data()),
+              entries.size()*sizeof(T) );
+            for( Int t=0; t<localWidth; ++t )
+            {
+                const Int j = colShift + t*colStride;
+                if( !A.IsLocalCol(j) )
+                    continue;
+                const Int jLoc = A.LocalCol(j);
+                for( Int s=0; s<localHeight; ++s )
+                {
+                    const Int i = rowShift + s*rowStride;
+                    if( A.IsLocalRow(i) )
+                        A.SetLocal
+                        ( A.LocalRow(i), jLoc, entries[s+t*localHeight] );
+                }
+            }
+        }
+    }
+    mpi::FileClose( file );
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+inline void
+ParallelBinaryCompressed( AbstractDistMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    RuntimeError("Parallel reads require a packed datatype");
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_PARALLELBINARYCOMPRESSED_HPP
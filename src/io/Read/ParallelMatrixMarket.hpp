@@ -0,0 +1,211 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_PARALLELMATRIXMARKET_HPP
+#define EL_READ_PARALLELMATRIXMARKET_HPP
+
+#include "./MatrixMarketScan.hpp"
+
+namespace El {
+namespace read {
+
+// A chunked parallel parse of a coordinate Matrix Market file: the root
+// parses and broadcasts the header, after which each rank parses only its
+// own byte range of the nonzero triples (extending past the end of its
+// range to finish the final line) and queues the updates for exchange
+template<typename T>
+inline void
+ParallelMatrixMarket( DistSparseMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Parse and broadcast the header
+    // ==============================
+    // [height, width, numNonzero, dataStart, numBytes,
+    //  isComplex, isPattern, isSymmetric, isSkewSymmetric, isHermitian]
+    long long header[10];
+    if( commRank == 0 )
+    {
+        std::ifstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+
+        string line, stamp, object, format, field, symmetry;
+        if( !std::getline( file, line ) )
+            RuntimeError("Could not extract header line");
+        {
+            std::stringstream lineStream( line );
+            lineStream >> stamp;
+            if( stamp != string("%%MatrixMarket") )
+                RuntimeError("Invalid Matrix Market stamp: ",stamp);
+            if( !(lineStream >> object >> format >> field >> symmetry) )
+                RuntimeError("Malformed Matrix Market header line");
+        }
+        if( object != string("matrix") )
+            RuntimeError("Invalid Matrix Market object: ",object);
+        if( format != string("coordinate") )
+            RuntimeError
+            ("Parallel parses require the coordinate format, not ",format);
+        const bool isComplex = ( field == string("complex") );
+        const bool isPattern = ( field == string("pattern") );
+        if( !isComplex && !isPattern &&
+            field != string("real") &&
+            field != string("double") &&
+            field != string("integer") )
+            RuntimeError("Invalid Matrix Market field: ",field);
+        const bool isSymmetric = ( symmetry == string("symmetric") );
+        const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
+        const bool isHermitian = ( symmetry == string("hermitian") );
+        if( symmetry != string("general") &&
+            !isSymmetric && !isSkewSymmetric && !isHermitian )
+            RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
+
+        // Skip the comment lines
+        while( file.peek() == '%' )
+            std::getline( file, line );
+
+        if( !std::getline( file, line ) )
+            RuntimeError("Could not extract the size line");
+        long long m, n, numNonzero;
+        {
+            std::stringstream lineStream( line );
+            if( !(lineStream >> m >> n >> numNonzero) )
+                RuntimeError("Malformed size line: ",line);
+        }
+        const std::streamoff dataStart = file.tellg();
+        file.seekg( 0, std::ios::end );
+        const std::streamoff numBytes = file.tellg();
+
+        header[0] = m;
+        header[1] = n;
+        header[2] = numNonzero;
+        header[3] = dataStart;
+        header[4] = numBytes;
+        header[5] = isComplex;
+        header[6] = isPattern;
+        header[7] = isSymmetric;
+        header[8] = isSkewSymmetric;
+        header[9] = isHermitian;
+    }
+    mpi::Broadcast( header, 10, 0, comm );
+    const Int m = header[0];
+    const Int n = header[1];
+    const Int numNonzero = header[2];
+    const std::streamoff dataStart = header[3];
+    const std::streamoff numBytes = header[4];
+    const bool isComplex = header[5];
+    const bool isPattern = header[6];
+    const bool isSymmetric = header[7];
+    const bool isSkewSymmetric = header[8];
+    const bool isHermitian = header[9];
+
+    Zeros( A, m, n );
+
+    // Parse this rank's chunk of the nonzero triples
+    // ==============================================
+    const std::streamoff span = numBytes - dataStart;
+    const std::streamoff chunkStart = dataStart + (span*commRank)/commSize;
+    const std::streamoff chunkEnd = dataStart + (span*(commRank+1))/commSize;
+
+#ifndef _WIN32
+    // Memory-map the file and scan this rank's byte range across the
+    // available threads with character-level parsers. Every rank rounds
+    // both of its split points up to the nearest line start, so each line
+    // is parsed (in full) by exactly one rank; any declared symmetry is
+    // expanded during the parse itself and exchanged along with the rest
+    // of the triples
+    mm_scan::MappedFile map( filename );
+    const char* dataBeg = map.Data() + dataStart;
+    const char* dataEnd = map.Data() + numBytes;
+    const char* rankBeg =
+      mm_scan::LineStartAtOrAfter( dataBeg, map.Data()+chunkStart, dataEnd );
+    const char* rankEnd =
+      mm_scan::LineStartAtOrAfter( dataBeg, map.Data()+chunkEnd, dataEnd );
+    const Int estimated =
+      ( isSymmetric || isSkewSymmetric || isHermitian ?
+        2*numNonzero : numNonzero ) / commSize;
+    vector<Entry<T>> entries;
+    mm_scan::ScanRange
+    ( rankBeg, rankEnd,
+      true, isComplex, isPattern,
+      isSymmetric, isSkewSymmetric, isHermitian,
+      0, m, estimated, entries );
+    A.Reserve( entries.size(), entries.size() );
+    for( const auto& entry : entries )
+        A.QueueUpdate( entry );
+    A.ProcessQueues();
+#else
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.seekg( chunkStart );
+    string line;
+    // A line straddling the chunk boundary belongs to the rank whose chunk
+    // contains its first character
+    if( commRank != 0 )
+        std::getline( file, line );
+
+    A.Reserve( numNonzero/commSize, numNonzero/commSize );
+    Int i, j;
+    Real realPart, imagPart;
+    T value;
+    while( file.tellg() < chunkEnd && std::getline( file, line ) )
+    {
+        std::stringstream lineStream( line );
+        if( !(lineStream >> i) )
+            continue;
+        --i; // convert from Fortran to C indexing
+        if( !(lineStream >> j) )
+            RuntimeError("Could not extract column coordinate: ",line);
+        --j;
+
+        if( isPattern )
+        {
+            A.QueueUpdate( i, j, T(1) );
+        }
+        else if( isComplex )
+        {
+            if( !(lineStream >> realPart >> imagPart) )
+                RuntimeError
+                ("Could not extract complex entry (",i,",",j,")");
+            SetRealPart( value, realPart );
+            SetImagPart( value, imagPart );
+            A.QueueUpdate( i, j, value );
+        }
+        else
+        {
+            if( !(lineStream >> realPart) )
+                RuntimeError("Could not extract real entry (",i,",",j,")");
+            A.QueueUpdate( i, j, T(realPart) );
+        }
+    }
+    A.ProcessQueues();
+
+    if( isSymmetric )
+        MakeSymmetric( LOWER, A );
+    if( isHermitian )
+        MakeHermitian( LOWER, A );
+    // As in the sequential reader, assume no conjugation for complex
+    // skew-symmetry
+    if( isSkewSymmetric )
+    {
+        const bool conjugateSkew = false;
+        MakeSymmetric( LOWER, A, conjugateSkew );
+        ScaleTrapezoid( T(-1), UPPER, A, 1 );
+    }
+#endif // ifndef _WIN32
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_PARALLELMATRIXMARKET_HPP
@@ -22,6 +22,26 @@ void Spy( const Matrix<T>& A, string title, Base<T> tol )
 #ifdef EL_HAVE_QT5
     if( GuiDisabled() )
         LogicError("GUI was disabled");
+    if( AsyncGui() )
+    {
+        // Publish a downsampled sparsity snapshot and let the render
+        // thread paint
+        const Int mA = A.Height();
+        const Int nA = A.Width();
+        const Int gridHeight = Min( AsyncDisplayResolution(), mA );
+        const Int gridWidth = Min( AsyncDisplayResolution(), nA );
+        Matrix<Int> frame;
+        Zeros( frame, gridHeight, gridWidth );
+        for( Int j=0; j<nA; ++j )
+        {
+            const Int bj = Int( ((long long)j*gridWidth)/nA );
+            for( Int i=0; i<mA; ++i )
+                if( Abs(A.Get(i,j)) > tol )
+                    frame.Set( Int(((long long)i*gridHeight)/mA), bj, 1 );
+        }
+        PushSpyFrame( title, std::move(frame) );
+        return;
+    }
 
     const Int m = A.Height();
     const Int n = A.Width();
@@ -65,10 +85,66 @@ void Spy( const AbstractDistMatrix<T>& A, string title, Base<T> tol )
 #endif // ifdef EL_HAVE_QT5
 }
 
+void Spy( const DistGraph& graph, string title, Int resolution )
+{
+    EL_DEBUG_CSE
+    const Int m = graph.NumTargets();
+    const Int n = graph.NumSources();
+    const Int gridHeight = Min( resolution, m );
+    const Int gridWidth = Min( resolution, n );
+    Matrix<Int> density;
+    Zeros( density, gridHeight, gridWidth );
+    Int* densBuf = density.Buffer();
+    const Int numLocalEdges = graph.NumLocalEdges();
+    for( Int e=0; e<numLocalEdges; ++e )
+    {
+        // The products can overflow Int for production-scale dimensions
+        const Int bi = Int( ((long long)graph.Target(e)*gridHeight) / m );
+        const Int bj = Int( ((long long)graph.Source(e)*gridWidth) / n );
+        densBuf[bi+bj*gridHeight] += 1;
+    }
+    mpi::Reduce
+    ( density.Buffer(), gridHeight*gridWidth, mpi::SUM, 0,
+      graph.Grid().Comm() );
+    if( graph.Grid().Rank() == 0 )
+        Spy( density, title, Int(0) );
+}
+
+template<typename T>
+void Spy
+( const DistSparseMatrix<T>& A, string title, Base<T> tol, Int resolution )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int gridHeight = Min( resolution, m );
+    const Int gridWidth = Min( resolution, n );
+    Matrix<Int> density;
+    Zeros( density, gridHeight, gridWidth );
+    Int* densBuf = density.Buffer();
+    const Int numLocalEntries = A.NumLocalEntries();
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        if( Abs(A.Value(e)) <= tol )
+            continue;
+        // The products can overflow Int for production-scale dimensions
+        const Int bi = Int( ((long long)A.Row(e)*gridHeight) / m );
+        const Int bj = Int( ((long long)A.Col(e)*gridWidth) / n );
+        densBuf[bi+bj*gridHeight] += 1;
+    }
+    mpi::Reduce
+    ( density.Buffer(), gridHeight*gridWidth, mpi::SUM, 0, A.Grid().Comm() );
+    if( A.Grid().Rank() == 0 )
+        Spy( density, title, Int(0) );
+}
+
 #define PROTO(T) \
   template void Spy ( const Matrix<T>& A, string title, Base<T> tol ); \
   template void Spy \
-  ( const AbstractDistMatrix<T>& A, string title, Base<T> tol );
+  ( const AbstractDistMatrix<T>& A, string title, Base<T> tol ); \
+  template void Spy \
+  ( const DistSparseMatrix<T>& A, string title, Base<T> tol, \
+    Int resolution );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -11,9 +11,13 @@
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
+#include "./Write/BinaryCompressed.hpp"
+#include "./Write/BinaryMmap.hpp"
 #include "./Write/BinaryFlat.hpp"
 #include "./Write/Image.hpp"
 #include "./Write/MatrixMarket.hpp"
+#include "./Write/ParallelBinary.hpp"
+#include "./Write/ParallelBinaryCompressed.hpp"
 
 namespace El {
 
@@ -28,7 +32,10 @@ void Write
     case ASCII:         write::Ascii( A, basename, title );       break;
     case ASCII_MATLAB:  write::AsciiMatlab( A, basename, title ); break;
     case BINARY:        write::Binary( A, basename );             break;
+    case BINARY_COMPRESSED:
+                        write::BinaryCompressed( A, basename );   break;
     case BINARY_FLAT:   write::BinaryFlat( A, basename );         break;
+    case BINARY_MMAP:   write::BinaryMmap( A, basename );         break;
     case MATRIX_MARKET: write::MatrixMarket( A, basename );       break;
     case BMP:
     case JPG:
@@ -62,13 +69,34 @@ void Write
     }
 }
 
+template<typename T>
+void ParallelWrite
+( const AbstractDistMatrix<T>& A, string basename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    switch( format )
+    {
+    case BINARY:
+    case BINARY_MMAP:
+        write::ParallelBinary( A, basename, format );
+        break;
+    case BINARY_COMPRESSED:
+        write::ParallelBinaryCompressed( A, basename );
+        break;
+    default:
+        LogicError("Format unsupported for parallel writes of a DistMatrix");
+    }
+}
+
 #define PROTO(T) \
   template void Write \
   ( const Matrix<T>& A, \
     string basename, FileFormat format, string title ); \
   template void Write \
   ( const AbstractDistMatrix<T>& A, \
-    string basename, FileFormat format, string title );
+    string basename, FileFormat format, string title ); \
+  template void ParallelWrite \
+  ( const AbstractDistMatrix<T>& A, string basename, FileFormat format );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
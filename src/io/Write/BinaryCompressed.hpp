@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_BINARYCOMPRESSED_HPP
+#define EL_WRITE_BINARYCOMPRESSED_HPP
+
+namespace El {
+namespace write {
+
+// Chunk the matrix into contiguous column panels of roughly the target
+// uncompressed size and compress the chunks independently (and hence in
+// parallel) with the currently selected codec before writing the header,
+// the chunk table, and the chunks
+template<typename T>
+inline void
+BinaryCompressed( const Matrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Compression codec = BinaryCompression();
+
+    const Int colBytes = height*sizeof(T);
+    const Int chunkCols =
+      ( colBytes == 0 ? Max(width,Int(1))
+                      : Max(CompressionChunkSize()/colBytes,Int(1)) );
+    const Int numChunks = (width+chunkCols-1) / chunkCols;
+
+    vector<vector<byte>> compressed( numChunks );
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int firstCol = chunk*chunkCols;
+        const Int numCols = Min( chunkCols, width-firstCol );
+        const size_t chunkBytes = size_t(height)*numCols*sizeof(T);
+        if( A.LDim() == height )
+        {
+            Compress
+            ( codec, sizeof(T),
+              reinterpret_cast<const byte*>(A.LockedBuffer(0,firstCol)),
+              chunkBytes, compressed[chunk] );
+        }
+        else
+        {
+            vector<T> packed( size_t(height)*numCols );
+            for( Int t=0; t<numCols; ++t )
+                MemCopy
+                ( &packed[t*height], A.LockedBuffer(0,firstCol+t), height );
+            Compress
+            ( codec, sizeof(T),
+              reinterpret_cast<const byte*>(packed.data()),
+              chunkBytes, compressed[chunk] );
+        }
+    }
+
+    string filename = basename + "." + FileExtension(BINARY_COMPRESSED);
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    BinaryCompressedHeader header;
+    std::copy
+    ( BINARY_COMPRESSED_MAGIC, BINARY_COMPRESSED_MAGIC+8, header.magic );
+    header.version = BINARY_COMPRESSED_VERSION;
+    header.height = height;
+    header.width = width;
+    header.elementSize = sizeof(T);
+    header.codec = codec;
+    header.numChunks = numChunks;
+    file.write( (char*)&header, sizeof(header) );
+
+    vector<BinaryCompressedChunk> table( numChunks );
+    unsigned long long offset =
+      sizeof(header) + numChunks*sizeof(BinaryCompressedChunk);
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int firstCol = chunk*chunkCols;
+        table[chunk].offset = offset;
+        table[chunk].compressedBytes = compressed[chunk].size();
+        table[chunk].rowShift = 0;
+        table[chunk].rowStride = 1;
+        table[chunk].localHeight = height;
+        table[chunk].colShift = firstCol;
+        table[chunk].colStride = 1;
+        table[chunk].localWidth = Min( chunkCols, width-firstCol );
+        offset += table[chunk].compressedBytes;
+    }
+    file.write( (char*)table.data(), numChunks*sizeof(BinaryCompressedChunk) );
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+        file.write
+        ( (char*)compressed[chunk].data(), compressed[chunk].size() );
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_BINARYCOMPRESSED_HPP
@@ -0,0 +1,57 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_BINARYMMAP_HPP
+#define EL_WRITE_BINARYMMAP_HPP
+
+namespace El {
+namespace write {
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+inline void
+BinaryMmap( const Matrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+
+    string filename = basename + "." + FileExtension(BINARY_MMAP);
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    BinaryMmapHeader header;
+    std::copy( BINARY_MMAP_MAGIC, BINARY_MMAP_MAGIC+8, header.magic );
+    header.version = BINARY_MMAP_VERSION;
+    header.height = A.Height();
+    header.width = A.Width();
+    header.elementSize = sizeof(T);
+    header.dataOffset = BINARY_MMAP_DATA_OFFSET;
+    file.write( (char*)&header, sizeof(BinaryMmapHeader) );
+
+    // Pad the header up to the page-aligned data offset
+    const vector<char> padding
+    ( BINARY_MMAP_DATA_OFFSET-sizeof(BinaryMmapHeader), 0 );
+    file.write( padding.data(), padding.size() );
+
+    if( A.Height() == A.LDim() )
+        file.write( (char*)A.LockedBuffer(), A.Height()*A.Width()*sizeof(T) );
+    else
+        for( Int j=0; j<A.Width(); ++j )
+            file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+inline void
+BinaryMmap( const Matrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    RuntimeError("BINARY_MMAP requires a packed datatype");
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_BINARYMMAP_HPP
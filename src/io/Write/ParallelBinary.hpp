@@ -0,0 +1,94 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_PARALLELBINARY_HPP
+#define EL_WRITE_PARALLELBINARY_HPP
+
+namespace El {
+namespace write {
+
+// Every rank concurrently writes its own local strided section through
+// MPI-IO file views; the result is identical to a sequential BINARY or
+// BINARY_MMAP write
+template<typename T,typename=EnableIf<IsPacked<T>>>
+inline void
+ParallelBinary
+( const AbstractDistMatrix<T>& A, string basename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(format);
+    mpi::Comm viewingComm = A.Grid().ViewingComm();
+    MPI_File file;
+    mpi::FileOpen
+    ( viewingComm, filename.c_str(), MPI_MODE_CREATE|MPI_MODE_WRONLY,
+      file );
+
+    const Int height = A.Height();
+    const Int width = A.Width();
+    MPI_Offset dataOffset;
+    if( format == BINARY_MMAP )
+        dataOffset = BINARY_MMAP_DATA_OFFSET;
+    else
+        dataOffset = 2*sizeof(Int);
+    mpi::FileSetSize
+    ( file, dataOffset + MPI_Offset(height)*width*sizeof(T) );
+
+    if( mpi::Rank(viewingComm) == 0 )
+    {
+        if( format == BINARY_MMAP )
+        {
+            BinaryMmapHeader header;
+            std::copy( BINARY_MMAP_MAGIC, BINARY_MMAP_MAGIC+8, header.magic );
+            header.version = BINARY_MMAP_VERSION;
+            header.height = height;
+            header.width = width;
+            header.elementSize = sizeof(T);
+            header.dataOffset = BINARY_MMAP_DATA_OFFSET;
+            mpi::FileWriteAt
+            ( file, 0, reinterpret_cast<const byte*>(&header),
+              sizeof(header) );
+        }
+        else
+        {
+            Int dims[2];
+            dims[0] = height;
+            dims[1] = width;
+            mpi::FileWriteAt( file, 0, dims, 2 );
+        }
+    }
+
+    if( A.Participating() && A.RedundantRank() == 0 )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const Int colShift = A.ColShift();
+        const int colStride = A.ColStride();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const MPI_Offset offset =
+              dataOffset + (MPI_Offset(j)*height+colShift)*sizeof(T);
+            mpi::FileSetStridedView<T>( file, offset, colStride );
+            mpi::FileWrite( file, A.LockedBuffer(0,jLoc), localHeight );
+        }
+    }
+    mpi::FileClose( file );
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+inline void
+ParallelBinary
+( const AbstractDistMatrix<T>& A, string basename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    RuntimeError("Parallel writes require a packed datatype");
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_PARALLELBINARY_HPP
@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_PARALLELBINARYCOMPRESSED_HPP
+#define EL_WRITE_PARALLELBINARYCOMPRESSED_HPP
+
+namespace El {
+namespace write {
+
+// Every rank compresses its packed local matrix into its own chunk, the
+// compressed lengths are allgathered so that all ranks agree on the chunk
+// table, and each rank then concurrently writes its chunk through MPI-IO.
+// Since the chunks are independent, a parallel restore never needs a global
+// decompression. The selected codec must agree across the ranks.
+template<typename T,typename=EnableIf<IsPacked<T>>>
+inline void
+ParallelBinaryCompressed( const AbstractDistMatrix<T>& A, string basename )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY_COMPRESSED);
+    mpi::Comm viewingComm = A.Grid().ViewingComm();
+    const int commSize = mpi::Size( viewingComm );
+    const int commRank = mpi::Rank( viewingComm );
+    const Compression codec = BinaryCompression();
+
+    const bool writing =
+      A.Participating() && A.RedundantRank() == 0 &&
+      A.LocalHeight() != 0 && A.LocalWidth() != 0;
+    vector<byte> compressed;
+    unsigned long long meta[7] = {0,0,1,0,0,1,0};
+    if( writing )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const size_t chunkBytes = size_t(localHeight)*localWidth*sizeof(T);
+        if( A.LDim() == localHeight )
+        {
+            Compress
+            ( codec, sizeof(T),
+              reinterpret_cast<const byte*>(A.LockedBuffer()),
+              chunkBytes, compressed );
+        }
+        else
+        {
+            vector<T> packed( size_t(localHeight)*localWidth );
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                MemCopy
+                ( &packed[jLoc*localHeight],
+                  A.LockedBuffer(0,jLoc), localHeight );
+            Compress
+            ( codec, sizeof(T),
+              reinterpret_cast<const byte*>(packed.data()),
+              chunkBytes, compressed );
+        }
+        meta[0] = compressed.size();
+        meta[1] = A.ColShift();
+        meta[2] = A.ColStride();
+        meta[3] = localHeight;
+        meta[4] = A.RowShift();
+        meta[5] = A.RowStride();
+        meta[6] = localWidth;
+    }
+    vector<unsigned long long> allMeta( 7*commSize );
+    mpi::AllGather( meta, 7, allMeta.data(), 7, viewingComm );
+
+    BinaryCompressedHeader header;
+    std::copy
+    ( BINARY_COMPRESSED_MAGIC, BINARY_COMPRESSED_MAGIC+8, header.magic );
+    header.version = BINARY_COMPRESSED_VERSION;
+    header.height = A.Height();
+    header.width = A.Width();
+    header.elementSize = sizeof(T);
+    header.codec = codec;
+    header.numChunks = commSize;
+
+    vector<BinaryCompressedChunk> table( commSize );
+    unsigned long long offset =
+      sizeof(header) + commSize*sizeof(BinaryCompressedChunk);
+    for( int q=0; q<commSize; ++q )
+    {
+        table[q].offset = offset;
+        table[q].compressedBytes = allMeta[7*q+0];
+        table[q].rowShift = allMeta[7*q+1];
+        table[q].rowStride = allMeta[7*q+2];
+        table[q].localHeight = allMeta[7*q+3];
+        table[q].colShift = allMeta[7*q+4];
+        table[q].colStride = allMeta[7*q+5];
+        table[q].localWidth = allMeta[7*q+6];
+        offset += table[q].compressedBytes;
+    }
+
+    MPI_File file;
+    mpi::FileOpen
+    ( viewingComm, filename.c_str(), MPI_MODE_CREATE|MPI_MODE_WRONLY,
+      file );
+    mpi::FileSetSize( file, offset );
+    if( commRank == 0 )
+    {
+        mpi::FileWriteAt
+        ( file, 0, reinterpret_cast<const byte*>(&header), sizeof(header) );
+        mpi::FileWriteAt
+        ( file, sizeof(header),
+          reinterpret_cast<const byte*>(table.data()),
+          commSize*sizeof(BinaryCompressedChunk) );
+    }
+    if( !compressed.empty() )
+        mpi::FileWriteAt
+        ( file, table[commRank].offset, compressed.data(),
+          compressed.size() );
+    mpi::FileClose( file );
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+inline void
+ParallelBinaryCompressed( const AbstractDistMatrix<T>& A, string basename )
+{
+    EL_DEBUG_CSE
+    RuntimeError("Parallel writes require a packed datatype");
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_PARALLELBINARYCOMPRESSED_HPP
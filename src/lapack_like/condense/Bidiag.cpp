@@ -11,6 +11,7 @@
 #include "./Bidiag/Apply.hpp"
 #include "./Bidiag/LowerBlocked.hpp"
 #include "./Bidiag/UpperBlocked.hpp"
+#include "./Bidiag/TwoStageUpper.hpp"
 
 namespace El {
 
@@ -18,9 +19,21 @@ template<typename F>
 void Bidiag
 ( Matrix<F>& A,
   Matrix<F>& householderScalarsP,
-  Matrix<F>& householderScalarsQ )
+  Matrix<F>& householderScalarsQ,
+  const BidiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.twoStageBandwidth > 0 )
+    {
+        if( A.Height() < A.Width() )
+            LogicError
+            ("Two-stage bidiagonalization is not yet supported for matrices "
+             "with fewer rows than columns");
+        bidiag::TwoStageUpper
+        ( A, householderScalarsP, householderScalarsQ,
+          ctrl.twoStageBandwidth );
+        return;
+    }
     if( A.Height() >= A.Width() )
         bidiag::UpperBlocked( A, householderScalarsP, householderScalarsQ );
     else
@@ -171,7 +184,8 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
   template void Bidiag \
   ( Matrix<F>& A, \
     Matrix<F>& householderScalarsP, \
-    Matrix<F>& householderScalarsQ ); \
+    Matrix<F>& householderScalarsQ, \
+    const BidiagCtrl<F>& ctrl ); \
   template void Bidiag \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& householderScalarsP, \
@@ -0,0 +1,309 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_TWOSTAGEUPPER_HPP
+#define EL_BIDIAG_TWOSTAGEUPPER_HPP
+
+namespace El {
+namespace bidiag {
+
+namespace two_stage {
+
+// Reduce A (with at least as many rows as columns) to an upper band matrix
+// with the given number of superdiagonals. Each step QR-factors a panel of
+// columns and then LQ-factors the corresponding panel of rows so that row r
+// keeps nonzeros only in columns [r,r+b]; both trailing updates are applied
+// through compact WY accumulations, Q = I - V T V^H from the left and
+// P = I - W^H T W from the right (with W the conjugated unit rows of the LQ
+// panel), so that the dominant work runs through Gemm and Trmm. The column
+// reflectors overwrite the entries below the diagonal and the row reflectors
+// overwrite the entries to the right of the band, as in the one-stage
+// algorithm.
+template<typename F>
+void UpperToBand
+( Matrix<F>& A,
+  Matrix<F>& householderScalarsP,
+  Matrix<F>& householderScalarsQ,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int b = bandwidth;
+
+    Int numP = 0;
+    for( Int k=0; k+b<n; k+=b )
+        numP += Min( b, n-k-b-1 );
+    householderScalarsP.Resize( numP, 1 );
+    householderScalarsQ.Resize( n, 1 );
+
+    Matrix<F> VUnit, WUnit, T, Z, ZTrail, z;
+    Int qOff = 0, pOff = 0;
+    for( Int k=0; k<n; k+=b )
+    {
+        const Int mPanel = m-k;
+        const Int w = Min( b, n-k );
+        auto V = A( IR(k,m), IR(k,k+w) );
+
+        // Unblocked QR of the column panel: the annihilating reflector
+        // H_j = I - tau_j v_j v_j^H is applied to the remaining columns
+        for( Int j=0; j<w; ++j )
+        {
+            auto alpha = V( IR(j), IR(j) );
+            auto vB = V( IR(j+1,mPanel), IR(j) );
+            const F tauQ = LeftReflector( alpha, vB );
+            householderScalarsQ(qOff+j) = tauQ;
+            const F beta = alpha(0);
+            alpha(0) = F(1);
+            auto v = V( IR(j,mPanel), IR(j) );
+            auto VRight = V( IR(j,mPanel), IR(j+1,w) );
+            Gemv( ADJOINT, F(1), VRight, v, z );
+            Ger( -tauQ, v, z, VRight );
+            alpha(0) = beta;
+        }
+
+        if( k+w < n )
+        {
+            // Explicitly form the unit lower-trapezoidal reflector block
+            VUnit = V;
+            MakeTrapezoidal( LOWER, VUnit, -1 );
+            FillDiagonal( VUnit, F(1) );
+
+            // The triangular factor of Q = H_0^H ... H_{w-1}^H = I - V T V^H
+            // via the usual recurrence, with the scalars conjugated so that
+            // Q^H V reproduces the computed R
+            Gemm( ADJOINT, NORMAL, F(1), VUnit, VUnit, Z );
+            Zeros( T, w, w );
+            for( Int j=0; j<w; ++j )
+            {
+                const F tauQ = householderScalarsQ(qOff+j);
+                auto T00 = T( IR(0,j), IR(0,j) );
+                auto t01 = T( IR(0,j), IR(j) );
+                auto z01 = Z( IR(0,j), IR(j) );
+                Gemv( NORMAL, -Conj(tauQ), T00, z01, F(0), t01 );
+                T(j,j) = Conj(tauQ);
+            }
+
+            // The left update of the trailing columns,
+            // Q^H = I - V T^H V^H
+            auto ATrail = A( IR(k,m), IR(k+w,n) );
+            Gemm( ADJOINT, NORMAL, F(1), VUnit, ATrail, ZTrail );
+            Trmm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), T, ZTrail );
+            Gemm( NORMAL, NORMAL, F(-1), VUnit, ZTrail, F(1), ATrail );
+        }
+        qOff += w;
+
+        // LQ-factor the panel of rows so that row k+i keeps nonzeros only
+        // through column k+b+i; the rows of the preceding panels already end
+        // before column k+b, so the right transformation leaves them alone.
+        // The final rows of the panel may already terminate within the band
+        // and then need no reflector.
+        const Int nR = n-k-b;
+        const Int pCount = ( nR >= 1 ? Min( b, nR-1 ) : 0 );
+        if( pCount == 0 )
+            continue;
+        auto R = A( IR(k,k+b), IR(k+b,n) );
+        for( Int i=0; i<pCount; ++i )
+        {
+            auto alpha = R( IR(i), IR(i) );
+            auto rRight = R( IR(i), IR(i+1,nR) );
+            const F tauP = RightReflector( alpha, rRight );
+            householderScalarsP(pOff+i) = tauP;
+            const F beta = alpha(0);
+            alpha(0) = F(1);
+            auto vRow = R( IR(i), IR(i,nR) );
+            auto RB = R( IR(i+1,b), IR(i,nR) );
+            Gemv( NORMAL, F(1), RB, vRow, z );
+            Ger( -tauP, z, vRow, RB );
+            alpha(0) = beta;
+        }
+
+        // Explicitly form the conjugated unit upper-trapezoidal rows, so
+        // that each row reflector is H_i = I - tau_i w_i^H w_i
+        WUnit = R( IR(0,pCount), IR(0,nR) );
+        MakeTrapezoidal( UPPER, WUnit );
+        FillDiagonal( WUnit, F(1) );
+        Conjugate( WUnit );
+
+        // The triangular factor of P = H_0 ... H_{pCount-1} = I - W^H T W
+        Gemm( NORMAL, ADJOINT, F(1), WUnit, WUnit, Z );
+        Zeros( T, pCount, pCount );
+        for( Int i=0; i<pCount; ++i )
+        {
+            const F tauP = householderScalarsP(pOff+i);
+            auto T00 = T( IR(0,i), IR(0,i) );
+            auto t01 = T( IR(0,i), IR(i) );
+            auto z01 = Z( IR(0,i), IR(i) );
+            Gemv( NORMAL, -tauP, T00, z01, F(0), t01 );
+            T(i,i) = tauP;
+        }
+        pOff += pCount;
+
+        // The right update of the trailing rows
+        auto A22 = A( IR(k+b,m), IR(k+b,n) );
+        Gemm( NORMAL, ADJOINT, F(1), A22, WUnit, ZTrail );
+        Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), T, ZTrail );
+        Gemm( NORMAL, NORMAL, F(-1), ZTrail, WUnit, F(1), A22 );
+    }
+}
+
+// Chase the upper band matrix (with the given number of superdiagonals)
+// stored in the top rows of A down to a real upper bidiagonal matrix with
+// Givens rotations applied alternately from the right and from the left.
+// The band is first copied into a compact layout, with column j of the band
+// stored contiguously in column j of the workspace (plus one scratch row on
+// either side for the bulges), so that every rotation touches a handful of
+// short contiguous column segments.
+template<typename F>
+void UpperBandChase( Matrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Width();
+    const Int b = bandwidth;
+    if( n == 0 )
+        return;
+
+    // B(i-j+b+1,j) stores the (i,j) entry of the band, with storage row 0
+    // holding the right-rotation bulges (superdiagonal b+1) and storage row
+    // b+2 the left-rotation bulges (the subdiagonal)
+    Matrix<F> B;
+    Zeros( B, b+3, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=Max(j-b,Int(0)); i<=j; ++i )
+            B(i-j+b+1,j) = A(i,j);
+
+    // Combine columns q-1 and q to zero B(r0,q) against B(r0,q-1)
+    auto rotateRight = [&]( Int r0, Int q )
+    {
+        Real c; F s;
+        const F rho = Givens( B(r0-q+b+2,q-1), B(r0-q+b+1,q), c, s );
+        const Int rBeg = Max( Int(0), q-b-1 );
+        for( Int r=rBeg; r<=q; ++r )
+        {
+            if( r == r0 )
+                continue;
+            const F x = B(r-q+b+2,q-1), y = B(r-q+b+1,q);
+            B(r-q+b+2,q-1) = c*x + s*y;
+            B(r-q+b+1,q  ) = -Conj(s)*x + c*y;
+        }
+        B(r0-q+b+2,q-1) = rho;
+        B(r0-q+b+1,q  ) = F(0);
+    };
+
+    // Combine rows p-1 and p to zero the subdiagonal bulge B(p,p-1)
+    auto rotateLeft = [&]( Int p )
+    {
+        Real c; F s;
+        const F rho = Givens( B(b+1,p-1), B(b+2,p-1), c, s );
+        const Int tEnd = Min( n-1, p+b );
+        for( Int t=p; t<=tEnd; ++t )
+        {
+            const F x = B(p-t+b,t), y = B(p-t+b+1,t);
+            B(p-t+b,  t) = c*x + s*y;
+            B(p-t+b+1,t) = -Conj(s)*x + c*y;
+        }
+        B(b+1,p-1) = rho;
+        B(b+2,p-1) = F(0);
+    };
+
+    if( b >= 2 )
+    {
+        for( Int j=0; j<=n-3; ++j )
+        {
+            const Int iLast = Min( j+b, n-1 );
+            for( Int i=iLast; i>=j+2; --i )
+            {
+                // Zero B(j,i) from the right, which leaves a bulge on the
+                // subdiagonal, and push said bulge back over the band from
+                // the left, which leaves the next one b columns further on
+                rotateRight( j, i );
+                rotateLeft( i );
+                Int p0 = i-1, p = i+b;
+                while( p <= n-1 )
+                {
+                    rotateRight( p0, p );
+                    rotateLeft( p );
+                    p0 = p-1;
+                    p += b;
+                }
+            }
+        }
+    }
+
+    // Rotate the diagonal and superdiagonal onto the real axis
+    for( Int j=0; j<n; ++j )
+    {
+        const F delta = B(b+1,j);
+        const Real deltaAbs = Abs( delta );
+        if( deltaAbs != Real(0) )
+        {
+            B(b+1,j) = deltaAbs;
+            if( j+1 < n )
+                B(b,j+1) *= Conj(delta)/deltaAbs;
+        }
+        if( j+1 < n )
+        {
+            const F eps = B(b,j+1);
+            const Real epsAbs = Abs( eps );
+            if( epsAbs != Real(0) )
+            {
+                B(b,j+1) = epsAbs;
+                B(b+1,j+1) *= Conj(eps)/epsAbs;
+            }
+        }
+    }
+
+    // Write the bidiagonal matrix back over the band entries of A
+    for( Int j=0; j<n; ++j )
+    {
+        A(j,j) = B(b+1,j);
+        const Int iBeg = Max( j-b, Int(0) );
+        for( Int i=iBeg; i<j; ++i )
+            A(i,j) = ( i == j-1 ? B(b,j) : F(0) );
+    }
+}
+
+} // namespace two_stage
+
+// The two-stage reduction: first to an upper band matrix via blocked
+// level-3 kernels, and then from band to bidiagonal form via bulge chasing.
+// Roughly all but O(mnb) of the flops run at level-3 speed, in contrast to
+// the one-stage algorithm, where half of the work lies in memory-bound Gemv
+// calls. Only the first stage's reflectors are returned in the scalar
+// vectors (stored outside the band in A): the rotations of the second stage
+// are not accumulated, so ApplyQ and ApplyP are not supported after a
+// two-stage reduction.
+template<typename F>
+void TwoStageUpper
+( Matrix<F>& A,
+  Matrix<F>& householderScalarsP,
+  Matrix<F>& householderScalarsQ,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    EL_DEBUG_ONLY(
+      if( A.Height() < n )
+          LogicError("A must be at least as tall as it is wide");
+    )
+    if( n == 0 )
+    {
+        householderScalarsP.Resize( 0, 1 );
+        householderScalarsQ.Resize( 0, 1 );
+        return;
+    }
+    const Int b = Min( Max( bandwidth, Int(1) ), Max( n-1, Int(1) ) );
+    two_stage::UpperToBand( A, householderScalarsP, householderScalarsQ, b );
+    two_stage::UpperBandChase( A, b );
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_TWOSTAGEUPPER_HPP
@@ -42,6 +42,7 @@ void Ger2Sub
 } // namespace El
 
 #include "./HermitianTridiag/LowerBlocked.hpp"
+#include "./HermitianTridiag/TwoStageLower.hpp"
 #include "./HermitianTridiag/LowerBlockedSquare.hpp"
 #include "./HermitianTridiag/UpperBlocked.hpp"
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
@@ -52,9 +53,22 @@ namespace El {
 
 template<typename F>
 void HermitianTridiag
-( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& householderScalars )
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.twoStageBandwidth > 0 )
+    {
+        if( uplo != LOWER )
+            LogicError
+            ("Two-stage tridiagonalization is not yet supported for upper "
+             "storage");
+        herm_tridiag::TwoStageLower
+        ( A, householderScalars, ctrl.twoStageBandwidth );
+        return;
+    }
     if( uplo == LOWER )
         herm_tridiag::LowerBlocked( A, householderScalars );
     else
@@ -193,7 +207,8 @@ void ExplicitCondensed
   template void HermitianTridiag \
   ( UpperOrLower uplo, \
     Matrix<F>& A, \
-    Matrix<F>& householderScalars ); \
+    Matrix<F>& householderScalars, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void HermitianTridiag \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
@@ -0,0 +1,245 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGELOWER_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGELOWER_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+namespace two_stage {
+
+// Reduce the Hermitian matrix stored in the lower triangle of A to a
+// Hermitian band matrix with the given (lower) bandwidth. Each panel of
+// columns is QR-factored with Householder reflectors which are immediately
+// aggregated into compact WY form, Q = I - V T V^H, so that the dominant
+// two-sided trailing update
+//
+//   A22 := Q^H A22 Q = A22 - V W^H - W V^H,
+//   W = (A22 V) T - (1/2) V [T^H (V^H A22 V) T],
+//
+// runs entirely at level-3 speed (one Hemm, one Her2k, and a handful of
+// small Gemm/Trmm calls per panel). The reflectors overwrite the entries
+// below the band, as in the one-stage algorithm.
+template<typename F>
+void LowerToBand( Matrix<F>& A, Matrix<F>& householderScalars, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = bandwidth;
+
+    Int numRefl = 0;
+    for( Int k=0; n-k-b >= 2; k+=b )
+        numRefl += Min( b, n-k-b );
+    householderScalars.Resize( numRefl, 1 );
+
+    Matrix<F> VUnit, T, Z, Y, S, ZGap, z;
+    Int reflOff = 0;
+    for( Int k=0; n-k-b >= 2; k+=b )
+    {
+        const Int m = n-k-b;
+        const Int w = Min( b, m );
+        auto V = A( IR(k+b,n), IR(k,k+w) );
+
+        // Unblocked QR of the panel: the annihilating reflector
+        // H_j = I - tau_j v_j v_j^H is applied to the remaining columns
+        for( Int j=0; j<w; ++j )
+        {
+            auto alpha = V( IR(j), IR(j) );
+            auto vB = V( IR(j+1,m), IR(j) );
+            const F tau = LeftReflector( alpha, vB );
+            householderScalars(reflOff+j) = tau;
+            const F beta = alpha(0);
+            alpha(0) = F(1);
+            auto v = V( IR(j,m), IR(j) );
+            auto VRight = V( IR(j,m), IR(j+1,w) );
+            Gemv( ADJOINT, F(1), VRight, v, z );
+            Ger( -tau, v, z, VRight );
+            alpha(0) = beta;
+        }
+
+        // Explicitly form the unit lower-trapezoidal reflector block
+        VUnit = V;
+        MakeTrapezoidal( LOWER, VUnit, -1 );
+        FillDiagonal( VUnit, F(1) );
+
+        // The triangular factor of Q = H_0^H ... H_{w-1}^H = I - V T V^H
+        // via the usual recurrence, with the scalars conjugated so that
+        // Q^H V reproduces the computed R
+        Gemm( ADJOINT, NORMAL, F(1), VUnit, VUnit, Z );
+        Zeros( T, w, w );
+        for( Int j=0; j<w; ++j )
+        {
+            const F tau = householderScalars(reflOff+j);
+            auto T00 = T( IR(0,j), IR(0,j) );
+            auto t01 = T( IR(0,j), IR(j) );
+            auto z01 = Z( IR(0,j), IR(j) );
+            Gemv( NORMAL, -Conj(tau), T00, z01, F(0), t01 );
+            T(j,j) = Conj(tau);
+        }
+        reflOff += w;
+
+        // If the (final) panel is narrower than the bandwidth, the columns
+        // [k+w, k+b) still have entries in the transformed rows, which
+        // receive the left update Q^H = I - V T^H V^H on their own
+        if( w < b )
+        {
+            auto AGap = A( IR(k+b,n), IR(k+w,k+b) );
+            Gemm( ADJOINT, NORMAL, F(1), VUnit, AGap, ZGap );
+            Trmm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), T, ZGap );
+            Gemm( NORMAL, NORMAL, F(-1), VUnit, ZGap, F(1), AGap );
+        }
+
+        // The two-sided trailing update
+        auto A22 = A( IR(k+b,n), IR(k+b,n) );
+        Hemm( LEFT, LOWER, F(1), A22, VUnit, F(0), Y );
+        Gemm( ADJOINT, NORMAL, F(1), VUnit, Y, S );
+        Trmm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), T, S );
+        Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), T, S );
+        Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), T, Y );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), VUnit, S, F(1), Y );
+        Her2k( LOWER, NORMAL, F(-1), VUnit, Y, Base<F>(1), A22 );
+    }
+}
+
+// Chase the Hermitian band matrix (with the given lower bandwidth) stored
+// in the lower triangle of A down to real symmetric tridiagonal form with
+// Givens rotations. The band is first copied into a compact layout, with
+// column j of the band stored contiguously in column j of the workspace
+// (plus one scratch row for the bulge), so that every rotation touches a
+// handful of short contiguous column segments.
+template<typename F>
+void LowerBandChase( Matrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    if( n == 0 )
+        return;
+
+    Matrix<F> B;
+    Zeros( B, b+2, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<=Min(j+b,n-1); ++i )
+            B(i-j,j) = A(i,j);
+
+    // Apply the Hermitian similarity rotation in the (q-1,q) plane
+    auto rotate = [&]( Int q, const Real& c, const F& s )
+    {
+        // Rows q-1 and q over the columns [max(0,q-1-b), q-2]
+        const Int jBeg = Max( Int(0), q-1-b );
+        for( Int j=jBeg; j<=q-2; ++j )
+        {
+            const F x = B(q-1-j,j), y = B(q-j,j);
+            B(q-1-j,j) = c*x + s*y;
+            B(q-j,  j) = -Conj(s)*x + c*y;
+        }
+        // The 2x2 diagonal block
+        {
+            const F a = B(0,q-1), e = B(1,q-1), d = B(0,q);
+            const F g00 = c*a + s*e,        g01 = c*Conj(e) + s*d,
+                    g10 = -Conj(s)*a + c*e, g11 = -Conj(s)*Conj(e) + c*d;
+            B(0,q-1) = RealPart( g00*c + g01*Conj(s) );
+            B(1,q-1) = g10*c + g11*Conj(s);
+            B(0,q)   = RealPart( g11*c - g10*s );
+        }
+        // Columns q-1 and q over the rows [q+1, min(n-1,q+b)]
+        const Int iEnd = Min( n-1, q+b );
+        for( Int i=q+1; i<=iEnd; ++i )
+        {
+            const F x = B(i-(q-1),q-1), y = B(i-q,q);
+            B(i-(q-1),q-1) = c*x + Conj(s)*y;
+            B(i-q,    q  ) = -s*x + c*y;
+        }
+    };
+
+    if( b >= 2 )
+    {
+        for( Int j=0; j<=n-3; ++j )
+        {
+            const Int iLast = Min( j+b, n-1 );
+            for( Int i=iLast; i>=j+2; --i )
+            {
+                // Zero A(i,j) with a rotation in the (i-1,i) plane
+                Real c; F s;
+                const F rho = Givens( B(i-1-j,j), B(i-j,j), c, s );
+                rotate( i, c, s );
+                B(i-1-j,j) = rho;
+                B(i-j,  j) = F(0);
+                // Chase the resulting bulge (at distance b+1) off the band
+                Int p0 = i-1, p = i+b;
+                while( p <= n-1 )
+                {
+                    Real cChase; F sChase;
+                    const F rhoChase =
+                      Givens( B(p-1-p0,p0), B(p-p0,p0), cChase, sChase );
+                    rotate( p, cChase, sChase );
+                    B(p-1-p0,p0) = rhoChase;
+                    B(p-p0,  p0) = F(0);
+                    p0 = p-1;
+                    p += b;
+                }
+            }
+        }
+    }
+
+    // Rotate the subdiagonal onto the real axis
+    for( Int j=0; j<n-1; ++j )
+    {
+        const F e = B(1,j);
+        const Real eAbs = Abs( e );
+        if( eAbs != Real(0) )
+        {
+            const F phase = Conj(e)/eAbs;
+            B(1,j) = eAbs;
+            if( j+2 < n )
+                B(1,j+1) *= Conj(phase);
+        }
+    }
+
+    // Write the tridiagonal matrix back over the band entries of A
+    for( Int j=0; j<n; ++j )
+    {
+        A(j,j) = RealPart( B(0,j) );
+        const Int iEnd = Min( j+b, n-1 );
+        for( Int i=j+1; i<=iEnd; ++i )
+            A(i,j) = ( i == j+1 ? B(1,j) : F(0) );
+    }
+}
+
+} // namespace two_stage
+
+// The two-stage reduction: first to a Hermitian band matrix via blocked
+// level-3 kernels, and then from band to tridiagonal form via bulge
+// chasing. Roughly all but O(n^2 b) of the flops run at level-3 speed,
+// in contrast to the one-stage algorithm, where half of the work lies in
+// memory-bound Hemv calls. Only the first stage's reflectors are returned
+// in householderScalars (stored below the band in A): the rotations of the
+// second stage are not accumulated, so ApplyQ is not supported after a
+// two-stage reduction.
+template<typename F>
+void TwoStageLower
+( Matrix<F>& A, Matrix<F>& householderScalars, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n == 0 )
+    {
+        householderScalars.Resize( 0, 1 );
+        return;
+    }
+    const Int b = Min( Max( bandwidth, Int(1) ), Max( n-1, Int(1) ) );
+    two_stage::LowerToBand( A, householderScalars, b );
+    two_stage::LowerBandChase( A, b );
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGELOWER_HPP
@@ -10,6 +10,7 @@
 
 #include "./Hessenberg/LowerBlocked.hpp"
 #include "./Hessenberg/UpperBlocked.hpp"
+#include "./Hessenberg/TwoStageUpper.hpp"
 #include "./Hessenberg/ApplyQ.hpp"
 #include "./Hessenberg/FormQ.hpp"
 
@@ -19,9 +20,20 @@ template<typename F>
 void Hessenberg
 ( UpperOrLower uplo,
   Matrix<F>& A,
-  Matrix<F>& householderScalars )
+  Matrix<F>& householderScalars,
+  const HessenbergCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.twoStageBandwidth > 1 )
+    {
+        if( uplo != UPPER )
+            LogicError
+            ("Two-stage Hessenberg reduction is not yet supported for the "
+             "lower Hessenberg form");
+        hessenberg::TwoStageUpper
+        ( A, householderScalars, ctrl.twoStageBandwidth );
+        return;
+    }
     if( uplo == UPPER )
         hessenberg::UpperBlocked( A, householderScalars );
     else
@@ -73,7 +85,8 @@ void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A )
   template void Hessenberg \
   ( UpperOrLower uplo, \
     Matrix<F>& A, \
-    Matrix<F>& householderScalars ); \
+    Matrix<F>& householderScalars, \
+    const HessenbergCtrl<F>& ctrl ); \
   template void Hessenberg \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
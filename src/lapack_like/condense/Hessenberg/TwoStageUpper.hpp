@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESSENBERG_TWOSTAGEUPPER_HPP
+#define EL_HESSENBERG_TWOSTAGEUPPER_HPP
+
+namespace El {
+namespace hessenberg {
+
+namespace two_stage {
+
+// Reduce A to a "block Hessenberg" matrix with the given number of
+// subdiagonals: each step QR-factors the panel of columns restricted to the
+// rows below the band, so that column c keeps nonzeros only through row c+b,
+// and then applies the accumulated similarity transformation through compact
+// WY updates, Q^H = I - V T^H V^H from the left of the trailing columns and
+// Q = I - V T V^H from the right of every row. The dominant work therefore
+// runs through Gemm and Trmm, in contrast to the one-stage algorithm, where
+// half of the flops lie in memory-bound Gemv calls. The reflectors overwrite
+// the entries below the band, as in the one-stage algorithm.
+template<typename F>
+void UpperToBand( Matrix<F>& A, Matrix<F>& householderScalars, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    householderScalars.Resize( Max(n-b-1,Int(0)), 1 );
+
+    Matrix<F> VUnit, T, Z, ZTrail, z;
+    Int off = 0;
+    for( Int k=0; k+b+1<n; k+=b )
+    {
+        const Int mPanel = n-(k+b);
+        const Int w = Min( b, n-b-1-k );
+        auto V = A( IR(k+b,n), IR(k,k+w) );
+
+        // Unblocked QR of the column panel: the annihilating reflector
+        // H_j = I - tau_j v_j v_j^H is applied to the remaining columns
+        for( Int j=0; j<w; ++j )
+        {
+            auto alpha = V( IR(j), IR(j) );
+            auto vB = V( IR(j+1,mPanel), IR(j) );
+            const F tau = LeftReflector( alpha, vB );
+            householderScalars(off+j) = tau;
+            const F beta = alpha(0);
+            alpha(0) = F(1);
+            auto v = V( IR(j,mPanel), IR(j) );
+            auto VRight = V( IR(j,mPanel), IR(j+1,w) );
+            Gemv( ADJOINT, F(1), VRight, v, z );
+            Ger( -tau, v, z, VRight );
+            alpha(0) = beta;
+        }
+
+        // Explicitly form the unit lower-trapezoidal reflector block
+        VUnit = V;
+        MakeTrapezoidal( LOWER, VUnit, -1 );
+        FillDiagonal( VUnit, F(1) );
+
+        // The triangular factor of Q = H_0 H_1 ... H_{w-1} = I - V T V^H
+        // via the usual recurrence, with the scalars conjugated since each
+        // H_j was applied (rather than its adjoint) during the panel
+        // factorization
+        Gemm( ADJOINT, NORMAL, F(1), VUnit, VUnit, Z );
+        Zeros( T, w, w );
+        for( Int j=0; j<w; ++j )
+        {
+            const F tau = householderScalars(off+j);
+            auto T00 = T( IR(0,j), IR(0,j) );
+            auto t01 = T( IR(0,j), IR(j) );
+            auto z01 = Z( IR(0,j), IR(j) );
+            Gemv( NORMAL, -Conj(tau), T00, z01, F(0), t01 );
+            T(j,j) = Conj(tau);
+        }
+        off += w;
+
+        // The left half of the similarity transformation,
+        // Q^H = I - V T^H V^H, applied to the trailing columns
+        auto ATrailL = A( IR(k+b,n), IR(k+w,n) );
+        Gemm( ADJOINT, NORMAL, F(1), VUnit, ATrailL, ZTrail );
+        Trmm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), T, ZTrail );
+        Gemm( NORMAL, NORMAL, F(-1), VUnit, ZTrail, F(1), ATrailL );
+
+        // The right half, applied to every row of the touched columns (the
+        // preceding columns are already banded and live entirely above the
+        // affected rows)
+        auto ATrailR = A( IR(0,n), IR(k+b,n) );
+        Gemm( NORMAL, NORMAL, F(1), ATrailR, VUnit, ZTrail );
+        Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), T, ZTrail );
+        Gemm( NORMAL, ADJOINT, F(-1), ZTrail, VUnit, F(1), ATrailR );
+    }
+}
+
+// Chase the block Hessenberg matrix (with the given number of subdiagonals)
+// down to Hessenberg form with Givens rotations. Each in-band entry is
+// annihilated with a rotation of an adjacent pair of rows, whose adjoint is
+// then applied from the right to preserve the similarity; the right-hand
+// rotation leaves a single bulge one row below the band, which is chased off
+// the bottom in strides of the bandwidth. Because the upper triangle is
+// dense, the rotations necessarily sweep entire row and column segments, so
+// this stage runs at level-1 speed; accumulating bundles of rotations into
+// blocked updates of the remote rows and columns is a natural refinement.
+template<typename F>
+void UpperBandChase( Matrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int b = bandwidth;
+
+    // Combine rows (p-1,p) to zero A(p,colBeg), then apply the adjoint
+    // rotation to columns (p-1,p); the right-hand update extends one row
+    // past the band and thereby writes the bulge of the next chase step
+    auto rotate = [&]( Int p, Int colBeg )
+    {
+        Real c; F s;
+        const F rho = Givens( A(p-1,colBeg), A(p,colBeg), c, s );
+        for( Int t=colBeg+1; t<n; ++t )
+        {
+            const F x = A(p-1,t), y = A(p,t);
+            A(p-1,t) = c*x + s*y;
+            A(p,  t) = -Conj(s)*x + c*y;
+        }
+        A(p-1,colBeg) = rho;
+        A(p,  colBeg) = F(0);
+        const Int rowEnd = Min( p+b, n-1 );
+        for( Int t=0; t<=rowEnd; ++t )
+        {
+            const F x = A(t,p-1), y = A(t,p);
+            A(t,p-1) = c*x + Conj(s)*y;
+            A(t,p  ) = -s*x + c*y;
+        }
+    };
+
+    for( Int j=0; j<n-2; ++j )
+    {
+        const Int iLast = Min( j+b, n-1 );
+        for( Int i=iLast; i>=j+2; --i )
+        {
+            rotate( i, j );
+            for( Int p=i+b; p<n; p+=b )
+                rotate( p, p-b-1 );
+        }
+    }
+}
+
+} // namespace two_stage
+
+// The two-stage reduction to upper Hessenberg form: first to a block
+// Hessenberg matrix via blocked level-3 kernels, and then from block
+// Hessenberg to Hessenberg form via bulge chasing. Only the first stage's
+// reflectors are returned (stored below the band in A, with the bulge-chase
+// region saved and restored around the second stage): the rotations of the
+// second stage are not accumulated, so ApplyQ and FormQ are not supported
+// after a two-stage reduction, which is therefore only appropriate when the
+// similarity transformation itself is not needed (e.g., for eigenvalues via
+// the Hessenberg QR algorithm without Schur vectors).
+template<typename F>
+void TwoStageUpper( Matrix<F>& A, Matrix<F>& householderScalars, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = Min( bandwidth, Max(n-2,Int(1)) );
+    if( b <= 1 )
+    {
+        UpperBlocked( A, householderScalars );
+        return;
+    }
+    two_stage::UpperToBand( A, householderScalars, b );
+
+    // Save the packed reflectors and zero their storage so that the chase
+    // can temporarily overwrite the first subdiagonal below the band with
+    // its bulges
+    Matrix<F> VStore( A );
+    for( Int j=0; j+b+1<n; ++j )
+        for( Int i=j+b+1; i<n; ++i )
+            A(i,j) = F(0);
+
+    two_stage::UpperBandChase( A, b );
+
+    // The chased entries below the band are now exact zeros, so the packed
+    // reflectors can safely reoccupy them
+    for( Int j=0; j+b+1<n; ++j )
+        for( Int i=j+b+1; i<n; ++i )
+            A(i,j) = VStore(i,j);
+}
+
+} // namespace hessenberg
+} // namespace El
+
+#endif // ifndef EL_HESSENBERG_TWOSTAGEUPPER_HPP
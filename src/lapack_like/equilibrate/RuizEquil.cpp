@@ -20,6 +20,386 @@ Real DampScaling( const Real& alpha )
         return Max(alpha,tol);
 }
 
+namespace ruiz {
+
+// Each Ruiz iteration would naively traverse the matrix four times: once
+// for the column statistics, once to rescale the columns, once for the row
+// statistics, and once to rescale the rows. The following kernels instead
+// fold the (deferred) row scaling of the previous iteration, the column
+// statistics and scaling, and the row statistics of the rescaled matrix
+// into a single traversal; the resulting row scaling is deferred to the
+// next sweep (or applied once after the final iteration), which cuts the
+// memory traffic of each iteration roughly in four for matrices which do
+// not fit in cache.
+
+template<typename Field>
+void FusedSweep
+(       Matrix<Field>& A,
+  const Matrix<Base<Field>>& rowScalePrev,
+        Matrix<Base<Field>>& colScale,
+        Matrix<Base<Field>>& rowScale )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    colScale.Resize( n, 1 );
+    Zeros( rowScale, m, 1 );
+    const Real* rowScalePrevBuf = rowScalePrev.LockedBuffer();
+    Real* rowScaleBuf = rowScale.Buffer();
+    for( Int j=0; j<n; ++j )
+    {
+        Field* aBuf = A.Buffer(0,j);
+
+        // Fold the deferred row scaling into the column statistics
+        Real colMax = 0;
+        for( Int i=0; i<m; ++i )
+        {
+            aBuf[i] /= rowScalePrevBuf[i];
+            colMax = Max( colMax, Abs(aBuf[i]) );
+        }
+        const Real scale = DampScaling<Real>(colMax);
+        colScale(j) = scale;
+
+        // Rescale the column (while it is still cache-resident) and fold in
+        // the row statistics of the rescaled matrix
+        for( Int i=0; i<m; ++i )
+        {
+            aBuf[i] /= scale;
+            rowScaleBuf[i] = Max( rowScaleBuf[i], Abs(aBuf[i]) );
+        }
+    }
+    EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
+}
+
+template<typename Field>
+void FusedSweep
+(       DistMatrix<Field>& A,
+  const DistMatrix<Base<Field>,MC,STAR>& rowScalePrev,
+        DistMatrix<Base<Field>,MR,STAR>& colScale,
+        DistMatrix<Base<Field>,MC,STAR>& rowScale )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int mLocal = A.LocalHeight();
+    const Int nLocal = A.LocalWidth();
+    colScale.AlignWith( A );
+    colScale.Resize( A.Width(), 1 );
+    rowScale.AlignWith( A );
+    rowScale.Resize( A.Height(), 1 );
+    auto& ALoc = A.Matrix();
+    auto& colScaleLoc = colScale.Matrix();
+    auto& rowScaleLoc = rowScale.Matrix();
+    auto& rowScalePrevLoc = rowScalePrev.LockedMatrix();
+
+    // Fold the deferred row scaling into the column statistics
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        Real colMax = 0;
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+        {
+            ALoc(iLoc,jLoc) /= rowScalePrevLoc(iLoc);
+            colMax = Max( colMax, Abs(ALoc(iLoc,jLoc)) );
+        }
+        colScaleLoc(jLoc) = colMax;
+    }
+    AllReduce( colScale.Matrix(), A.ColComm(), mpi::MAX );
+    EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+
+    // Fold the column scaling into the row statistics
+    Zero( rowScaleLoc );
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Real scale = colScaleLoc(jLoc);
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+        {
+            ALoc(iLoc,jLoc) /= scale;
+            rowScaleLoc(iLoc) = Max( rowScaleLoc(iLoc), Abs(ALoc(iLoc,jLoc)) );
+        }
+    }
+    AllReduce( rowScale.Matrix(), A.RowComm(), mpi::MAX );
+    EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
+}
+
+template<typename Field>
+void FusedSweep
+(       SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& rowScalePrev,
+        Matrix<Base<Field>>& colScale,
+        Matrix<Base<Field>>& rowScale )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Field* vBuf = A.ValueBuffer();
+    Zeros( colScale, n, 1 );
+    rowScale.Resize( m, 1 );
+
+    // Fold the deferred row scaling into the column statistics
+    for( Int i=0; i<m; ++i )
+    {
+        const Int off = A.RowOffset(i);
+        const Int numConn = A.NumConnections(i);
+        const Real rowScalePrevVal = rowScalePrev(i);
+        for( Int e=off; e<off+numConn; ++e )
+        {
+            vBuf[e] /= rowScalePrevVal;
+            const Int j = A.Col(e);
+            colScale(j) = Max( colScale(j), Abs(vBuf[e]) );
+        }
+    }
+    EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+
+    // Fold the column scaling into the row statistics and damping
+    for( Int i=0; i<m; ++i )
+    {
+        const Int off = A.RowOffset(i);
+        const Int numConn = A.NumConnections(i);
+        Real rowMax = 0;
+        for( Int e=off; e<off+numConn; ++e )
+        {
+            vBuf[e] /= colScale(A.Col(e));
+            rowMax = Max( rowMax, Abs(vBuf[e]) );
+        }
+        rowScale(i) = DampScaling<Real>(rowMax);
+    }
+}
+
+// For the distributed sparse matrices the column statistics and scalings
+// involve communication and are left to ColumnMaxNorms and DiagonalSolve,
+// but the row statistics, damping, equilibration update, and rescaling are
+// all local to each row and can be folded into a single traversal
+template<typename Field>
+void FusedRowSweep
+( DistSparseMatrix<Field>& A,
+  DistMultiVec<Base<Field>>& dRow )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int localHeight = A.LocalHeight();
+    Field* vBuf = A.ValueBuffer();
+    auto& dRowLoc = dRow.Matrix();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int off = A.RowOffset(iLoc);
+        const Int numConn = A.NumConnections(iLoc);
+        Real rowMax = 0;
+        for( Int e=off; e<off+numConn; ++e )
+            rowMax = Max( rowMax, Abs(vBuf[e]) );
+        const Real scale = DampScaling<Real>(rowMax);
+        dRowLoc(iLoc) *= scale;
+        for( Int e=off; e<off+numConn; ++e )
+            vBuf[e] /= scale;
+    }
+}
+
+template<typename Field>
+void StackedFusedSweep
+(       Matrix<Field>& A,
+        Matrix<Field>& B,
+  const Matrix<Base<Field>>& rowScaleAPrev,
+  const Matrix<Base<Field>>& rowScaleBPrev,
+        Matrix<Base<Field>>& colScale,
+        Matrix<Base<Field>>& rowScaleA,
+        Matrix<Base<Field>>& rowScaleB )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int mA = A.Height();
+    const Int mB = B.Height();
+    const Int n = A.Width();
+    colScale.Resize( n, 1 );
+    Zeros( rowScaleA, mA, 1 );
+    Zeros( rowScaleB, mB, 1 );
+    const Real* rowScaleAPrevBuf = rowScaleAPrev.LockedBuffer();
+    const Real* rowScaleBPrevBuf = rowScaleBPrev.LockedBuffer();
+    Real* rowScaleABuf = rowScaleA.Buffer();
+    Real* rowScaleBBuf = rowScaleB.Buffer();
+    for( Int j=0; j<n; ++j )
+    {
+        Field* aBuf = A.Buffer(0,j);
+        Field* bBuf = B.Buffer(0,j);
+
+        // Fold the deferred row scalings into the joint column statistics
+        Real colMax = 0;
+        for( Int i=0; i<mA; ++i )
+        {
+            aBuf[i] /= rowScaleAPrevBuf[i];
+            colMax = Max( colMax, Abs(aBuf[i]) );
+        }
+        for( Int i=0; i<mB; ++i )
+        {
+            bBuf[i] /= rowScaleBPrevBuf[i];
+            colMax = Max( colMax, Abs(bBuf[i]) );
+        }
+        const Real scale = DampScaling<Real>(colMax);
+        colScale(j) = scale;
+
+        // Rescale the columns and fold in the row statistics
+        for( Int i=0; i<mA; ++i )
+        {
+            aBuf[i] /= scale;
+            rowScaleABuf[i] = Max( rowScaleABuf[i], Abs(aBuf[i]) );
+        }
+        for( Int i=0; i<mB; ++i )
+        {
+            bBuf[i] /= scale;
+            rowScaleBBuf[i] = Max( rowScaleBBuf[i], Abs(bBuf[i]) );
+        }
+    }
+    EntrywiseMap( rowScaleA, MakeFunction(DampScaling<Real>) );
+    EntrywiseMap( rowScaleB, MakeFunction(DampScaling<Real>) );
+}
+
+template<typename Field>
+void StackedFusedSweep
+(       DistMatrix<Field>& A,
+        DistMatrix<Field>& B,
+  const DistMatrix<Base<Field>,MC,STAR>& rowScaleAPrev,
+  const DistMatrix<Base<Field>,MC,STAR>& rowScaleBPrev,
+        DistMatrix<Base<Field>,MR,STAR>& colScale,
+        DistMatrix<Base<Field>,MC,STAR>& rowScaleA,
+        DistMatrix<Base<Field>,MC,STAR>& rowScaleB )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int mLocalA = A.LocalHeight();
+    const Int mLocalB = B.LocalHeight();
+    const Int nLocal = A.LocalWidth();
+    colScale.AlignWith( A );
+    colScale.Resize( A.Width(), 1 );
+    rowScaleA.AlignWith( A );
+    rowScaleA.Resize( A.Height(), 1 );
+    rowScaleB.AlignWith( B );
+    rowScaleB.Resize( B.Height(), 1 );
+    auto& ALoc = A.Matrix();
+    auto& BLoc = B.Matrix();
+    auto& colScaleLoc = colScale.Matrix();
+    auto& rowScaleALoc = rowScaleA.Matrix();
+    auto& rowScaleBLoc = rowScaleB.Matrix();
+    auto& rowScaleAPrevLoc = rowScaleAPrev.LockedMatrix();
+    auto& rowScaleBPrevLoc = rowScaleBPrev.LockedMatrix();
+
+    // Fold the deferred row scalings into the joint column statistics
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        Real colMax = 0;
+        for( Int iLoc=0; iLoc<mLocalA; ++iLoc )
+        {
+            ALoc(iLoc,jLoc) /= rowScaleAPrevLoc(iLoc);
+            colMax = Max( colMax, Abs(ALoc(iLoc,jLoc)) );
+        }
+        for( Int iLoc=0; iLoc<mLocalB; ++iLoc )
+        {
+            BLoc(iLoc,jLoc) /= rowScaleBPrevLoc(iLoc);
+            colMax = Max( colMax, Abs(BLoc(iLoc,jLoc)) );
+        }
+        colScaleLoc(jLoc) = colMax;
+    }
+    AllReduce( colScale.Matrix(), A.ColComm(), mpi::MAX );
+    EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+
+    // Fold the column scaling into the row statistics
+    Zero( rowScaleALoc );
+    Zero( rowScaleBLoc );
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Real scale = colScaleLoc(jLoc);
+        for( Int iLoc=0; iLoc<mLocalA; ++iLoc )
+        {
+            ALoc(iLoc,jLoc) /= scale;
+            rowScaleALoc(iLoc) = Max( rowScaleALoc(iLoc), Abs(ALoc(iLoc,jLoc)) );
+        }
+        for( Int iLoc=0; iLoc<mLocalB; ++iLoc )
+        {
+            BLoc(iLoc,jLoc) /= scale;
+            rowScaleBLoc(iLoc) = Max( rowScaleBLoc(iLoc), Abs(BLoc(iLoc,jLoc)) );
+        }
+    }
+    AllReduce( rowScaleA.Matrix(), A.RowComm(), mpi::MAX );
+    AllReduce( rowScaleB.Matrix(), B.RowComm(), mpi::MAX );
+    EntrywiseMap( rowScaleA, MakeFunction(DampScaling<Real>) );
+    EntrywiseMap( rowScaleB, MakeFunction(DampScaling<Real>) );
+}
+
+template<typename Field>
+void StackedFusedSweep
+(       SparseMatrix<Field>& A,
+        SparseMatrix<Field>& B,
+  const Matrix<Base<Field>>& rowScaleAPrev,
+  const Matrix<Base<Field>>& rowScaleBPrev,
+        Matrix<Base<Field>>& colScale,
+        Matrix<Base<Field>>& rowScaleA,
+        Matrix<Base<Field>>& rowScaleB )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int mA = A.Height();
+    const Int mB = B.Height();
+    const Int n = A.Width();
+    Field* vBufA = A.ValueBuffer();
+    Field* vBufB = B.ValueBuffer();
+    Zeros( colScale, n, 1 );
+    rowScaleA.Resize( mA, 1 );
+    rowScaleB.Resize( mB, 1 );
+
+    // Fold the deferred row scalings into the joint column statistics
+    for( Int i=0; i<mA; ++i )
+    {
+        const Int off = A.RowOffset(i);
+        const Int numConn = A.NumConnections(i);
+        const Real rowScalePrevVal = rowScaleAPrev(i);
+        for( Int e=off; e<off+numConn; ++e )
+        {
+            vBufA[e] /= rowScalePrevVal;
+            const Int j = A.Col(e);
+            colScale(j) = Max( colScale(j), Abs(vBufA[e]) );
+        }
+    }
+    for( Int i=0; i<mB; ++i )
+    {
+        const Int off = B.RowOffset(i);
+        const Int numConn = B.NumConnections(i);
+        const Real rowScalePrevVal = rowScaleBPrev(i);
+        for( Int e=off; e<off+numConn; ++e )
+        {
+            vBufB[e] /= rowScalePrevVal;
+            const Int j = B.Col(e);
+            colScale(j) = Max( colScale(j), Abs(vBufB[e]) );
+        }
+    }
+    EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+
+    // Fold the column scaling into the row statistics and damping
+    for( Int i=0; i<mA; ++i )
+    {
+        const Int off = A.RowOffset(i);
+        const Int numConn = A.NumConnections(i);
+        Real rowMax = 0;
+        for( Int e=off; e<off+numConn; ++e )
+        {
+            vBufA[e] /= colScale(A.Col(e));
+            rowMax = Max( rowMax, Abs(vBufA[e]) );
+        }
+        rowScaleA(i) = DampScaling<Real>(rowMax);
+    }
+    for( Int i=0; i<mB; ++i )
+    {
+        const Int off = B.RowOffset(i);
+        const Int numConn = B.NumConnections(i);
+        Real rowMax = 0;
+        for( Int e=off; e<off+numConn; ++e )
+        {
+            vBufB[e] /= colScale(B.Col(e));
+            rowMax = Max( rowMax, Abs(vBufB[e]) );
+        }
+        rowScaleB(i) = DampScaling<Real>(rowMax);
+    }
+}
+
+} // namespace ruiz
+
 template<typename Field>
 void RuizEquil
 ( Matrix<Field>& A,
@@ -38,24 +418,18 @@ void RuizEquil
     // For now, simply hard-code the number of iterations
     const Int maxIter = 4;
 
-    Matrix<Real> rowScale, colScale;
+    Matrix<Real> rowScale, rowScalePrev, colScale;
+    Ones( rowScalePrev, m, 1 );
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, colScale );
-        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        ruiz::FusedSweep( A, rowScalePrev, colScale, rowScale );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
+        rowScalePrev = rowScale;
     }
+    // Apply the final (deferred) row scaling
+    DiagonalSolve( LEFT, NORMAL, rowScalePrev, A );
     SetIndent( indent );
 }
 
@@ -91,25 +465,20 @@ void RuizEquil
     // For now, simply hard-code the number of iterations
     const Int maxIter = 4;
 
-    DistMatrix<Real,MC,STAR> rowScale(A.Grid());
+    DistMatrix<Real,MC,STAR> rowScale(A.Grid()), rowScalePrev(A.Grid());
     DistMatrix<Real,MR,STAR> colScale(A.Grid());
+    rowScalePrev.AlignWith( A );
+    Ones( rowScalePrev, m, 1 );
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, colScale );
-        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        ruiz::FusedSweep( A, rowScalePrev, colScale, rowScale );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
+        rowScalePrev = rowScale;
     }
+    // Apply the final (deferred) row scaling
+    DiagonalSolve( LEFT, NORMAL, rowScalePrev, A );
     SetIndent( indent );
 }
 
@@ -131,24 +500,18 @@ void RuizEquil
     // For now, simply hard-code the number of iterations
     const Int maxIter = 4;
 
-    Matrix<Real> scales;
+    Matrix<Real> rowScale, rowScalePrev, colScale;
+    Ones( rowScalePrev, m, 1 );
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRow );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
+        ruiz::FusedSweep( A, rowScalePrev, colScale, rowScale );
+        DiagonalScale( LEFT, NORMAL, colScale, dCol );
+        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
+        rowScalePrev = rowScale;
     }
+    // Apply the final (deferred) row scaling
+    DiagonalSolve( LEFT, NORMAL, rowScalePrev, A );
     SetIndent( indent );
 }
 
@@ -184,12 +547,9 @@ void RuizEquil
         DiagonalScale( LEFT, NORMAL, scales, dCol );
         DiagonalSolve( RIGHT, NORMAL, scales, A );
 
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRow );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
+        // Rescale the rows in a single fused traversal
+        // --------------------------------------------
+        ruiz::FusedRowSweep( A, dRow );
     }
     SetIndent( indent );
 }
@@ -216,33 +576,23 @@ void StackedRuizEquil
     // For now, simply hard-code the number of iterations
     const Int maxIter = 4;
 
-    Matrix<Real> rowScale, colScale, colScaleB;
+    Matrix<Real> rowScaleA, rowScaleB, rowScaleAPrev, rowScaleBPrev, colScale;
+    Ones( rowScaleAPrev, mA, 1 );
+    Ones( rowScaleBPrev, mB, 1 );
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, colScale );
-        ColumnMaxNorms( B, colScaleB );
-        for( Int j=0; j<n; ++j )
-            colScale(j) = Max(colScale(j),colScaleB(j));
-        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        ruiz::StackedFusedSweep
+        ( A, B, rowScaleAPrev, rowScaleBPrev, colScale, rowScaleA, rowScaleB );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
-        DiagonalSolve( RIGHT, NORMAL, colScale, B );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, rowScale, dRowA );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
-
-        RowMaxNorms( B, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, rowScale, dRowB );
-        DiagonalSolve( LEFT, NORMAL, rowScale, B );
+        DiagonalScale( LEFT, NORMAL, rowScaleA, dRowA );
+        DiagonalScale( LEFT, NORMAL, rowScaleB, dRowB );
+        rowScaleAPrev = rowScaleA;
+        rowScaleBPrev = rowScaleB;
     }
+    // Apply the final (deferred) row scalings
+    DiagonalSolve( LEFT, NORMAL, rowScaleAPrev, A );
+    DiagonalSolve( LEFT, NORMAL, rowScaleBPrev, B );
     SetIndent( indent );
 }
 
@@ -278,7 +628,6 @@ void StackedRuizEquil
     const Int mA = A.Height();
     const Int mB = B.Height();
     const Int n = A.Width();
-    const Int nLocal = A.LocalWidth();
     Ones( dRowA, mA, 1 );
     Ones( dRowB, mB, 1 );
     Ones( dCol, n, 1 );
@@ -287,37 +636,27 @@ void StackedRuizEquil
     // For now, simply hard-code the number of iterations
     const Int maxIter = 4;
 
-    DistMatrix<Real,MC,STAR> rowScale(A.Grid());
-    DistMatrix<Real,MR,STAR> colScale(A.Grid()), colScaleB(B.Grid());
-    auto& colScaleLoc = colScale.Matrix();
-    auto& colScaleBLoc = colScaleB.Matrix();
+    DistMatrix<Real,MC,STAR> rowScaleA(A.Grid()), rowScaleAPrev(A.Grid()),
+                             rowScaleB(B.Grid()), rowScaleBPrev(B.Grid());
+    DistMatrix<Real,MR,STAR> colScale(A.Grid());
+    rowScaleAPrev.AlignWith( A );
+    rowScaleBPrev.AlignWith( B );
+    Ones( rowScaleAPrev, mA, 1 );
+    Ones( rowScaleBPrev, mB, 1 );
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, colScale );
-        ColumnMaxNorms( B, colScaleB );
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-            colScaleLoc(jLoc) =
-              Max(colScaleLoc(jLoc),colScaleBLoc(jLoc));
-        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        ruiz::StackedFusedSweep
+        ( A, B, rowScaleAPrev, rowScaleBPrev, colScale, rowScaleA, rowScaleB );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
-        DiagonalSolve( RIGHT, NORMAL, colScale, B );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, rowScale, dRowA );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
-
-        RowMaxNorms( B, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, rowScale, dRowB );
-        DiagonalSolve( LEFT, NORMAL, rowScale, B );
+        DiagonalScale( LEFT, NORMAL, rowScaleA, dRowA );
+        DiagonalScale( LEFT, NORMAL, rowScaleB, dRowB );
+        rowScaleAPrev = rowScaleA;
+        rowScaleBPrev = rowScaleB;
     }
+    // Apply the final (deferred) row scalings
+    DiagonalSolve( LEFT, NORMAL, rowScaleAPrev, A );
+    DiagonalSolve( LEFT, NORMAL, rowScaleBPrev, B );
     SetIndent( indent );
 }
 
@@ -343,33 +682,23 @@ void StackedRuizEquil
     // For now, simply hard-code the number of iterations
     const Int maxIter = 4;
 
-    Matrix<Real> scales, maxAbsValsB;
+    Matrix<Real> rowScaleA, rowScaleB, rowScaleAPrev, rowScaleBPrev, colScale;
+    Ones( rowScaleAPrev, mA, 1 );
+    Ones( rowScaleBPrev, mB, 1 );
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, scales );
-        ColumnMaxNorms( B, maxAbsValsB );
-        for( Int j=0; j<n; ++j )
-            scales(j) = Max(scales(j),maxAbsValsB(j));
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-        DiagonalSolve( RIGHT, NORMAL, scales, B );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRowA );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
-
-        RowMaxNorms( B, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRowB );
-        DiagonalSolve( LEFT, NORMAL, scales, B );
+        ruiz::StackedFusedSweep
+        ( A, B, rowScaleAPrev, rowScaleBPrev, colScale, rowScaleA, rowScaleB );
+        DiagonalScale( LEFT, NORMAL, colScale, dCol );
+        DiagonalScale( LEFT, NORMAL, rowScaleA, dRowA );
+        DiagonalScale( LEFT, NORMAL, rowScaleB, dRowB );
+        rowScaleAPrev = rowScaleA;
+        rowScaleBPrev = rowScaleB;
     }
+    // Apply the final (deferred) row scalings
+    DiagonalSolve( LEFT, NORMAL, rowScaleAPrev, A );
+    DiagonalSolve( LEFT, NORMAL, rowScaleBPrev, B );
     SetIndent( indent );
 }
 
@@ -417,17 +746,10 @@ void StackedRuizEquil
         DiagonalSolve( RIGHT, NORMAL, scales, A );
         DiagonalSolve( RIGHT, NORMAL, scales, B );
 
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRowA );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
-
-        RowMaxNorms( B, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRowB );
-        DiagonalSolve( LEFT, NORMAL, scales, B );
+        // Rescale the rows in a single fused traversal per matrix
+        // -------------------------------------------------------
+        ruiz::FusedRowSweep( A, dRowA );
+        ruiz::FusedRowSweep( B, dRowB );
     }
     SetIndent( indent );
 }
@@ -81,6 +81,137 @@ MinAbsNonzero( const DistSparseMatrix<Field>& A, Base<Field> upperBound )
     return mpi::AllReduce( minLocAbs, mpi::MIN, A.Grid().Comm() );
 }
 
+// Compute the maximum and minimum nonzero absolute values of each column
+// (or row) in a single traversal rather than paying for the matrix's memory
+// traffic once per statistic
+template<typename Field>
+void ColumnMaxMinAbsNonzero
+( const Matrix<Field>& A,
+        Matrix<Base<Field>>& maxScaling,
+        Matrix<Base<Field>>& minScaling )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    maxScaling.Resize( n, 1 );
+    minScaling.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        Real maxAbs = 0;
+        Real minAbs = limits::Max<Real>();
+        for( Int i=0; i<m; ++i )
+        {
+            const Real absVal = Abs(A(i,j));
+            maxAbs = Max( maxAbs, absVal );
+            if( absVal > Real(0) )
+                minAbs = Min( minAbs, absVal );
+        }
+        maxScaling(j) = maxAbs;
+        minScaling(j) = Min( minAbs, maxAbs );
+    }
+}
+
+template<typename Field,Dist U,Dist V>
+void ColumnMaxMinAbsNonzero
+( const DistMatrix<Field,      U,V   >& A,
+        DistMatrix<Base<Field>,V,STAR>& maxScaling,
+        DistMatrix<Base<Field>,V,STAR>& minScaling )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int mLocal = A.LocalHeight();
+    const Int nLocal = A.LocalWidth();
+    maxScaling.AlignWith( A );
+    maxScaling.Resize( A.Width(), 1 );
+    minScaling.AlignWith( A );
+    minScaling.Resize( A.Width(), 1 );
+    auto& ALoc = A.LockedMatrix();
+    auto& maxScalingLoc = maxScaling.Matrix();
+    auto& minScalingLoc = minScaling.Matrix();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        Real maxAbs = 0;
+        Real minAbs = limits::Max<Real>();
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+        {
+            const Real absVal = Abs(ALoc(iLoc,jLoc));
+            maxAbs = Max( maxAbs, absVal );
+            if( absVal > Real(0) )
+                minAbs = Min( minAbs, absVal );
+        }
+        maxScalingLoc(jLoc) = maxAbs;
+        minScalingLoc(jLoc) = minAbs;
+    }
+    mpi::AllReduce( maxScaling.Buffer(), nLocal, mpi::MAX, A.ColComm() );
+    mpi::AllReduce( minScaling.Buffer(), nLocal, mpi::MIN, A.ColComm() );
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        minScalingLoc(jLoc) = Min( minScalingLoc(jLoc), maxScalingLoc(jLoc) );
+}
+
+template<typename Field>
+void RowMaxMinAbsNonzero
+( const Matrix<Field>& A,
+        Matrix<Base<Field>>& maxScaling,
+        Matrix<Base<Field>>& minScaling )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    maxScaling.Resize( m, 1 );
+    minScaling.Resize( m, 1 );
+    Fill( maxScaling, Real(0) );
+    Fill( minScaling, limits::Max<Real>() );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            const Real absVal = Abs(A(i,j));
+            maxScaling(i) = Max( maxScaling(i), absVal );
+            if( absVal > Real(0) )
+                minScaling(i) = Min( minScaling(i), absVal );
+        }
+    }
+    for( Int i=0; i<m; ++i )
+        minScaling(i) = Min( minScaling(i), maxScaling(i) );
+}
+
+template<typename Field,Dist U,Dist V>
+void RowMaxMinAbsNonzero
+( const DistMatrix<Field,      U,V   >& A,
+        DistMatrix<Base<Field>,U,STAR>& maxScaling,
+        DistMatrix<Base<Field>,U,STAR>& minScaling )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int mLocal = A.LocalHeight();
+    const Int nLocal = A.LocalWidth();
+    maxScaling.AlignWith( A );
+    maxScaling.Resize( A.Height(), 1 );
+    minScaling.AlignWith( A );
+    minScaling.Resize( A.Height(), 1 );
+    auto& ALoc = A.LockedMatrix();
+    auto& maxScalingLoc = maxScaling.Matrix();
+    auto& minScalingLoc = minScaling.Matrix();
+    Fill( maxScalingLoc, Real(0) );
+    Fill( minScalingLoc, limits::Max<Real>() );
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+        {
+            const Real absVal = Abs(ALoc(iLoc,jLoc));
+            maxScalingLoc(iLoc) = Max( maxScalingLoc(iLoc), absVal );
+            if( absVal > Real(0) )
+                minScalingLoc(iLoc) = Min( minScalingLoc(iLoc), absVal );
+        }
+    }
+    mpi::AllReduce( maxScaling.Buffer(), mLocal, mpi::MAX, A.RowComm() );
+    mpi::AllReduce( minScaling.Buffer(), mLocal, mpi::MIN, A.RowComm() );
+    for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+        minScalingLoc(iLoc) = Min( minScalingLoc(iLoc), maxScalingLoc(iLoc) );
+}
+
 template<typename Field,Dist U,Dist V>
 void GeometricColumnScaling
 ( const DistMatrix<Field,      U,V   >& A,
@@ -89,8 +220,7 @@ void GeometricColumnScaling
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     DistMatrix<Real,V,STAR> maxScaling(A.Grid());
-    ColumnMaxNorms( A, maxScaling );
-    ColumnMinAbsNonzero( A, maxScaling, geomScaling );
+    ColumnMaxMinAbsNonzero( A, maxScaling, geomScaling );
     const Int nLocal = A.LocalWidth();
     auto& maxScalingLoc = maxScaling.Matrix();
     auto& geomScalingLoc = geomScaling.Matrix();
@@ -210,8 +340,7 @@ void GeometricRowScaling
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     Matrix<Real> maxScaling;
-    RowMaxNorms( A, maxScaling );
-    RowMinAbsNonzero( A, maxScaling, geomScaling );
+    RowMaxMinAbsNonzero( A, maxScaling, geomScaling );
     const Int m = A.Height();
     for( Int i=0; i<m; ++i )
     {
@@ -229,8 +358,7 @@ void GeometricRowScaling
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     DistMatrix<Real,U,STAR> maxScaling(A.Grid());
-    RowMaxNorms( A, maxScaling );
-    RowMinAbsNonzero( A, maxScaling, geomScaling );
+    RowMaxMinAbsNonzero( A, maxScaling, geomScaling );
     const Int mLocal = A.LocalHeight();
     auto& maxScalingLoc = maxScaling.Matrix();
     auto& geomScalingLoc = geomScaling.Matrix();
@@ -38,6 +38,70 @@ void Overwrite
     }
 }
 
+// For sufficiently tall-skinny matrices, a TSQR-based solve performs a
+// single binary-tree reduction of local R factors rather than paying an
+// O(n) number of reduction latencies in the blocked Householder path
+template<typename F>
+void TSQROverwrite
+( Orientation orientation,
+  const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& B,
+        AbstractDistMatrix<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Grid& g = APre.Grid();
+
+    DistMatrix<F,VC,STAR> A(g);
+    A = APre;
+    DistMatrix<F,STAR,STAR> R(g);
+    qr::ExplicitTS( A, R );
+
+    if( orientation == NORMAL )
+    {
+        if( m != B.Height() )
+            LogicError("A and B do not conform");
+
+        // Z := Q^H B
+        DistMatrix<F,VC,STAR> BVC(g);
+        BVC.AlignWith( A );
+        BVC = B;
+        DistMatrix<F,STAR,STAR> Z(g);
+        Zeros( Z, n, B.Width() );
+        LocalGemm( ADJOINT, NORMAL, F(1), A, BVC, F(0), Z );
+        AllReduce( Z, A.ColComm() );
+
+        // Solve against R (checking for singularities)
+        LocalTrsm
+        ( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R, Z, true );
+
+        Copy( Z, X );
+    }
+    else // orientation in {TRANSPOSE,ADJOINT}
+    {
+        if( n != B.Height() )
+            LogicError("A and B do not conform");
+
+        // Z := R^-H B
+        DistMatrix<F,STAR,STAR> Z(g);
+        Z = B;
+        if( orientation == TRANSPOSE )
+            Conjugate( Z );
+        LocalTrsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), R, Z, true );
+
+        // X := Q Z
+        DistMatrix<F,VC,STAR> XVC(g);
+        XVC.AlignWith( A );
+        Zeros( XVC, m, B.Width() );
+        LocalGemm( NORMAL, NORMAL, F(1), A, Z, F(0), XVC );
+        if( orientation == TRANSPOSE )
+            Conjugate( XVC );
+        Copy( XVC, X );
+    }
+}
+
 template<typename F>
 void Overwrite
 ( Orientation orientation,
@@ -47,14 +111,26 @@ void Overwrite
 {
     EL_DEBUG_CSE
 
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+
+    // Route sufficiently tall-skinny problems through TSQR, but only when
+    // every process owns at least as many rows as columns so that each
+    // local QR produces a full n x n upper-triangular factor
+    const Int tsqrRatio = 16;
+    const Int p = APre.Grid().Size();
+    if( m >= tsqrRatio*n && p > 1 && m/p >= n )
+    {
+        TSQROverwrite( orientation, APre, B, X );
+        return;
+    }
+
     DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
     DistMatrix<F,MD,STAR> phase(A.Grid());
     DistMatrix<Base<F>,MD,STAR> signature(A.Grid());
 
-    const Int m = A.Height();
-    const Int n = A.Width();
     if( m >= n )
     {
         QR( A, phase, signature );
@@ -151,6 +227,106 @@ void LeastSquares
 
 namespace ls {
 
+namespace {
+
+// Attempt to solve min_X || A X - B ||_F through the corrected seminormal
+// equations when A is very overdetermined (or the minimum-norm analogue,
+// built from A A^H, when very underdetermined): the Gram matrix of the
+// smaller dimension is formed sparsely and factored, and a single step of
+// seminormal refinement compensates for the squared conditioning. A return
+// value of 'false' (which leaves X untouched) signals that the caller
+// should fall back to the augmented formulation, either because the
+// factorization broke down or because an inverse-power estimate of cond(A)
+// suggests that even the corrected solve would be unreliable.
+template<typename F>
+bool AttemptSemiNormal
+( const SparseMatrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = Min(m,n);
+    const Int numRHS = B.Width();
+
+    // Form the Gram matrix of the smaller dimension
+    // =============================================
+    SparseMatrix<F> G;
+    if( m >= n )
+        Herk( LOWER, ADJOINT, Base<F>(1), A, G );
+    else
+        Herk( LOWER, NORMAL, Base<F>(1), A, G );
+    MakeHermitian( LOWER, G );
+
+    SparseLDLFactorization<F> ldlFact;
+    try
+    {
+        ldlFact.Initialize( G, true );
+        ldlFact.Factor();
+    }
+    catch( ... ) { return false; }
+
+    // Estimate cond(A) = sqrt(cond(G)) via a two-norm estimate of G and a
+    // few steps of inverse power iteration with the factorization
+    // ===================================================================
+    const Real normG = TwoNormEstimate( G, ctrl.basisSize );
+    Real invNormG = 1;
+    {
+        Matrix<F> v;
+        Uniform( v, k, 1 );
+        v *= F(1)/F(FrobeniusNorm(v));
+        for( Int iter=0; iter<3; ++iter )
+        {
+            ldlFact.Solve( v );
+            invNormG = FrobeniusNorm( v );
+            v *= F(1)/F(invNormG);
+        }
+    }
+    const Real condEst = Sqrt( normG*invNormG );
+    if( ctrl.progress )
+        Output("Estimated cond(A) ~= ",condEst);
+    if( condEst > ctrl.normalEqCondLimit )
+        return false;
+
+    // Solve the (corrected semi)normal equations
+    // ==========================================
+    if( m >= n )
+    {
+        // X := (A^H A)^{-1} A^H B, then one step of seminormal refinement
+        Zeros( X, n, numRHS );
+        Multiply( ADJOINT, F(1), A, B, F(0), X );
+        ldlFact.Solve( X );
+        Matrix<F> R( B );
+        Multiply( NORMAL, F(-1), A, X, F(1), R );
+        Matrix<F> dX;
+        Zeros( dX, n, numRHS );
+        Multiply( ADJOINT, F(1), A, R, F(0), dX );
+        ldlFact.Solve( dX );
+        Axpy( F(1), dX, X );
+    }
+    else
+    {
+        // X := A^H (A A^H)^{-1} B, then refine the constraint residual
+        Matrix<F> Y( B );
+        ldlFact.Solve( Y );
+        Zeros( X, n, numRHS );
+        Multiply( ADJOINT, F(1), A, Y, F(0), X );
+        Matrix<F> R( B );
+        Multiply( NORMAL, F(-1), A, X, F(1), R );
+        ldlFact.Solve( R );
+        Matrix<F> dX;
+        Zeros( dX, n, numRHS );
+        Multiply( ADJOINT, F(1), A, R, F(0), dX );
+        Axpy( F(1), dX, X );
+    }
+    return true;
+}
+
+} // anonymous namespace
+
 template<typename F>
 void Equilibrated
 ( const SparseMatrix<F>& A,
@@ -169,6 +345,17 @@ void Equilibrated
     const Int numRHS = B.Width();
     const Int numEntriesA = A.NumEntries();
 
+    // Solve very rectangular problems through the corrected seminormal
+    // equations when they appear sufficiently well-conditioned
+    // ================================================================
+    if( ctrl.allowNormalEq && Max(m,n) >= ctrl.normalEqRatio*Min(m,n) )
+    {
+        if( AttemptSemiNormal( A, B, X, ctrl ) )
+            return;
+        if( ctrl.progress )
+            Output("Falling back to the augmented formulation");
+    }
+
     SparseMatrix<F> J;
     Zeros( J, m+n, m+n );
     J.Reserve( 2*numEntriesA + Max(m,n) );
@@ -312,6 +499,98 @@ void LeastSquares
 
 namespace ls {
 
+namespace {
+
+template<typename F>
+bool AttemptSemiNormal
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<F>& B,
+        DistMultiVec<F>& X,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& grid = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = Min(m,n);
+    const Int numRHS = B.Width();
+
+    // Form the Gram matrix of the smaller dimension
+    // =============================================
+    DistSparseMatrix<F> G(grid);
+    if( m >= n )
+        Herk( LOWER, ADJOINT, Base<F>(1), A, G );
+    else
+        Herk( LOWER, NORMAL, Base<F>(1), A, G );
+    MakeHermitian( LOWER, G );
+
+    DistSparseLDLFactorization<F> ldlFact;
+    try
+    {
+        ldlFact.Initialize( G, true );
+        ldlFact.Factor();
+    }
+    catch( ... ) { return false; }
+
+    // Estimate cond(A) = sqrt(cond(G)) via a two-norm estimate of G and a
+    // few steps of inverse power iteration with the factorization
+    // ===================================================================
+    const Real normG = TwoNormEstimate( G, ctrl.basisSize );
+    Real invNormG = 1;
+    {
+        DistMultiVec<F> v(grid);
+        Uniform( v, k, 1 );
+        v *= F(1)/F(FrobeniusNorm(v));
+        for( Int iter=0; iter<3; ++iter )
+        {
+            ldlFact.Solve( v );
+            invNormG = FrobeniusNorm( v );
+            v *= F(1)/F(invNormG);
+        }
+    }
+    const Real condEst = Sqrt( normG*invNormG );
+    if( ctrl.progress && grid.Rank() == 0 )
+        Output("Estimated cond(A) ~= ",condEst);
+    if( condEst > ctrl.normalEqCondLimit )
+        return false;
+
+    // Solve the (corrected semi)normal equations
+    // ==========================================
+    if( m >= n )
+    {
+        // X := (A^H A)^{-1} A^H B, then one step of seminormal refinement
+        Zeros( X, n, numRHS );
+        Multiply( ADJOINT, F(1), A, B, F(0), X );
+        ldlFact.Solve( X );
+        DistMultiVec<F> R( B );
+        Multiply( NORMAL, F(-1), A, X, F(1), R );
+        DistMultiVec<F> dX(grid);
+        Zeros( dX, n, numRHS );
+        Multiply( ADJOINT, F(1), A, R, F(0), dX );
+        ldlFact.Solve( dX );
+        Axpy( F(1), dX, X );
+    }
+    else
+    {
+        // X := A^H (A A^H)^{-1} B, then refine the constraint residual
+        DistMultiVec<F> Y( B );
+        ldlFact.Solve( Y );
+        Zeros( X, n, numRHS );
+        Multiply( ADJOINT, F(1), A, Y, F(0), X );
+        DistMultiVec<F> R( B );
+        Multiply( NORMAL, F(-1), A, X, F(1), R );
+        ldlFact.Solve( R );
+        DistMultiVec<F> dX(grid);
+        Zeros( dX, n, numRHS );
+        Multiply( ADJOINT, F(1), A, R, F(0), dX );
+        Axpy( F(1), dX, X );
+    }
+    return true;
+}
+
+} // anonymous namespace
+
 template<typename F>
 void Equilibrated
 ( const DistSparseMatrix<F>& A,
@@ -330,6 +609,17 @@ void Equilibrated
     const Int n = A.Width();
     const Int numRHS = B.Width();
 
+    // Solve very rectangular problems through the corrected seminormal
+    // equations when they appear sufficiently well-conditioned
+    // ================================================================
+    if( ctrl.allowNormalEq && Max(m,n) >= ctrl.normalEqRatio*Min(m,n) )
+    {
+        if( AttemptSemiNormal( A, B, X, ctrl ) )
+            return;
+        if( ctrl.progress && grid.Rank() == 0 )
+            Output("Falling back to the augmented formulation");
+    }
+
     // J := [alpha*I,A;A^H,0] or [alpha*I,A^H;A,0]
     // ===========================================
     DistSparseMatrix<F> J(grid);
@@ -196,6 +196,132 @@ void Ridge
     }
 }
 
+template<typename Field>
+void RidgeSweep
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const vector<Base<Field>>& gammas,
+        vector<Matrix<Field>>& XList )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    const bool normal = ( orientation==NORMAL );
+    const Int m = ( normal ? A.Height() : A.Width()  );
+    const Int n = ( normal ? A.Width()  : A.Height() );
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Transpose version of complex RidgeSweep not yet supported");
+    if( m < n )
+        LogicError("This case not yet supported");
+
+    // A single (thin) SVD of A is shared by every value of gamma: each
+    // regularized solution is V diag(s/(s^2+gamma^2)) (U^H B), so only the
+    // diagonal reweighting and two small GEMM's need to be repeated.
+    Matrix<Field> U, V;
+    Matrix<Real> s;
+    if( orientation == NORMAL )
+    {
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = false;
+        SVD( A, U, s, V, ctrl );
+    }
+    else
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = true;
+        SVD( AAdj, U, s, V, ctrl );
+    }
+
+    Matrix<Field> UHB;
+    Gemm( ADJOINT, NORMAL, Field(1), U, B, UHB );
+
+    const Int numGammas = gammas.size();
+    XList.resize( numGammas );
+    Matrix<Field> Z;
+    Matrix<Real> sScaled;
+    for( Int j=0; j<numGammas; ++j )
+    {
+        const Real gamma = gammas[j];
+        auto sigmaMap =
+          [=]( const Real& sigma )
+          { return sigma / (sigma*sigma + gamma*gamma); };
+        sScaled = s;
+        EntrywiseMap( sScaled, MakeFunction(sigmaMap) );
+        Z = UHB;
+        DiagonalScale( LEFT, NORMAL, sScaled, Z );
+        Gemm( NORMAL, NORMAL, Field(1), V, Z, XList[j] );
+    }
+}
+
+template<typename Field>
+void RidgeSweep
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Field>& BPre,
+  const vector<Base<Field>>& gammas,
+        vector<DistMatrix<Field>>& XList )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadProxy<Field,Field,MC,MR>
+      AProx( APre ),
+      BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    const bool normal = ( orientation==NORMAL );
+    const Int m = ( normal ? A.Height() : A.Width()  );
+    const Int n = ( normal ? A.Width()  : A.Height() );
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Transpose version of complex RidgeSweep not yet supported");
+    if( m < n )
+        LogicError("This case not yet supported");
+
+    DistMatrix<Field> U(A.Grid()), V(A.Grid());
+    DistMatrix<Real,VR,STAR> s(A.Grid());
+    if( orientation == NORMAL )
+    {
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = false;
+        SVD( A, U, s, V, ctrl );
+    }
+    else
+    {
+        DistMatrix<Field> AAdj(A.Grid());
+        Adjoint( A, AAdj );
+
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = true;
+        SVD( AAdj, U, s, V, ctrl );
+    }
+
+    DistMatrix<Field> UHB(A.Grid());
+    Gemm( ADJOINT, NORMAL, Field(1), U, B, UHB );
+
+    const Int numGammas = gammas.size();
+    XList.clear();
+    XList.resize( numGammas, DistMatrix<Field>(A.Grid()) );
+    DistMatrix<Field> Z(A.Grid());
+    DistMatrix<Real,VR,STAR> sScaled(A.Grid());
+    for( Int j=0; j<numGammas; ++j )
+    {
+        const Real gamma = gammas[j];
+        auto sigmaMap =
+          [=]( const Real& sigma )
+          { return sigma / (sigma*sigma + gamma*gamma); };
+        sScaled = s;
+        EntrywiseMap( sScaled, MakeFunction(sigmaMap) );
+        Z = UHB;
+        DiagonalScale( LEFT, NORMAL, sScaled, Z );
+        Gemm( NORMAL, NORMAL, Field(1), V, Z, XList[j] );
+    }
+}
+
 template<typename Field>
 void Ridge
 ( Orientation orientation,
@@ -257,6 +383,18 @@ void Ridge
           Base<Field> gamma, \
           AbstractDistMatrix<Field>& X, \
           RidgeAlg alg ); \
+  template void RidgeSweep \
+  ( Orientation orientation, \
+    const Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+    const vector<Base<Field>>& gammas, \
+          vector<Matrix<Field>>& XList ); \
+  template void RidgeSweep \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+    const vector<Base<Field>>& gammas, \
+          vector<DistMatrix<Field>>& XList ); \
   template void Ridge \
   ( Orientation orientation, \
     const SparseMatrix<Field>& A, \
@@ -0,0 +1,163 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Banded factorization kernels which dispatch directly to the imported
+// pbtrf/pbtrs and gbtrf/gbtrs routines. Since the BandMatrix storage is
+// precisely the LAPACK band layout, the UPPER Cholesky factorization can
+// consume the storage in place, while the LOWER case merely offsets past
+// the (unused) superdiagonal rows. The LU factorization requires the
+// upper bandwidth to be expanded from ku to kl+ku in order to accommodate
+// the fill-in generated by the row swaps, so the band is copied into the
+// expanded layout before factoring and the result is swapped back into A.
+
+namespace El {
+
+template<typename F>
+void Cholesky( UpperOrLower uplo, BandMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    const Int n = A.Height();
+    const char uploChar = UpperOrLowerToChar( uplo );
+    if( uplo == UPPER )
+    {
+        const Int kd = A.UpperBandwidth();
+        lapack::BandCholesky( uploChar, n, kd, A.Buffer(), A.LDim() );
+    }
+    else
+    {
+        const Int kd = A.LowerBandwidth();
+        lapack::BandCholesky
+        ( uploChar, n, kd, A.Buffer()+A.UpperBandwidth(), A.LDim() );
+    }
+}
+
+namespace cholesky {
+
+template<typename F>
+void SolveAfter
+( UpperOrLower uplo,
+  const BandMatrix<F>& A,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Height() != B.Height() )
+          LogicError("A and B must be the same height");
+    )
+    const Int n = A.Height();
+    const char uploChar = UpperOrLowerToChar( uplo );
+    if( uplo == UPPER )
+    {
+        const Int kd = A.UpperBandwidth();
+        lapack::BandCholeskySolve
+        ( uploChar, n, kd, B.Width(),
+          A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+    }
+    else
+    {
+        const Int kd = A.LowerBandwidth();
+        lapack::BandCholeskySolve
+        ( uploChar, n, kd, B.Width(),
+          A.LockedBuffer()+A.UpperBandwidth(), A.LDim(),
+          B.Buffer(), B.LDim() );
+    }
+}
+
+} // namespace cholesky
+
+template<typename F>
+void LU( BandMatrix<F>& A, Matrix<Int>& p )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int kl = A.LowerBandwidth();
+    const Int ku = A.UpperBandwidth();
+    const Int minDim = Min( m, n );
+
+    // Copy the band into a layout whose upper bandwidth is expanded to
+    // kl+ku, so that gbtrf has room for the fill-in from the row swaps
+    BandMatrix<F> AFact( m, n, kl, ku+kl );
+    const Int ldA = A.LDim();
+    const Int ldAFact = AFact.LDim();
+    const F* ABuf = A.LockedBuffer();
+    F* AFactBuf = AFact.Buffer();
+    for( Int j=0; j<n; ++j )
+        MemCopy( &AFactBuf[kl+j*ldAFact], &ABuf[j*ldA], kl+ku+1 );
+
+    vector<BlasInt> ipiv( minDim );
+    lapack::BandLU( m, n, kl, ku, AFactBuf, ldAFact, ipiv.data() );
+
+    // Convert the one-based swap indices into our zero-based convention
+    p.Resize( minDim, 1 );
+    for( Int i=0; i<minDim; ++i )
+        p.Set( i, 0, Int(ipiv[i])-1 );
+
+    A = std::move( AFact );
+}
+
+namespace lu {
+
+template<typename F>
+void SolveAfter
+( Orientation orientation,
+  const BandMatrix<F>& A,
+  const Matrix<Int>& p,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Height() != B.Height() )
+          LogicError("A and B must be the same height");
+      if( A.UpperBandwidth() < A.LowerBandwidth() )
+          LogicError("A does not store a band LU factorization");
+    )
+    const Int n = A.Height();
+    const Int kl = A.LowerBandwidth();
+    // The factored upper bandwidth is kl+ku; recover the original ku
+    const Int ku = A.UpperBandwidth() - kl;
+    const char transChar = OrientationToChar( orientation );
+
+    vector<BlasInt> ipiv( n );
+    for( Int i=0; i<n; ++i )
+        ipiv[i] = BlasInt(p.Get(i,0)) + 1;
+
+    lapack::BandLUSolve
+    ( transChar, n, kl, ku, B.Width(),
+      A.LockedBuffer(), A.LDim(), ipiv.data(), B.Buffer(), B.LDim() );
+}
+
+} // namespace lu
+
+#define PROTO(F) \
+  template void Cholesky( UpperOrLower uplo, BandMatrix<F>& A ); \
+  template void cholesky::SolveAfter \
+  ( UpperOrLower uplo, \
+    const BandMatrix<F>& A, \
+          Matrix<F>& B ); \
+  template void LU( BandMatrix<F>& A, Matrix<Int>& p ); \
+  template void lu::SolveAfter \
+  ( Orientation orientation, \
+    const BandMatrix<F>& A, \
+    const Matrix<Int>& p, \
+          Matrix<F>& B );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
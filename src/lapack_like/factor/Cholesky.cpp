@@ -10,6 +10,7 @@
 
 #include "./Cholesky/LowerVariant3.hpp"
 #include "./Cholesky/UpperVariant3.hpp"
+#include "./Cholesky/Variant3Tiled.hpp"
 #include "./Cholesky/ReverseLowerVariant3.hpp"
 #include "./Cholesky/ReverseUpperVariant3.hpp"
 #include "./Cholesky/PivotedLowerVariant3.hpp"
@@ -19,10 +20,51 @@
 #include "./Cholesky/LowerMod.hpp"
 #include "./Cholesky/UpperMod.hpp"
 
+#include "./Cholesky/LowRank.hpp"
+
 namespace El {
 
 // TODO: Pivoted Reverse Cholesky?
 
+namespace cholesky {
+
+// For matrices this small (e.g., the leaves of a frontal tree), the blocked
+// algorithm's dispatch machinery -- the blocksize lookup, the subview
+// construction, and the nested level-3 calls -- costs more than the
+// arithmetic, so jump straight to an unblocked kernel (a fully-unrolled one
+// when the dimension is tiny)
+const Int unblockedCutoff = 64;
+
+template<typename F>
+void SmallLower( Matrix<F>& A )
+{
+    switch( A.Height() )
+    {
+    case 0: break;
+    case 1: LowerVariant3Fixed<1>( A ); break;
+    case 2: LowerVariant3Fixed<2>( A ); break;
+    case 3: LowerVariant3Fixed<3>( A ); break;
+    case 4: LowerVariant3Fixed<4>( A ); break;
+    default: LowerVariant3Unblocked( A );
+    }
+}
+
+template<typename F>
+void SmallUpper( Matrix<F>& A )
+{
+    switch( A.Height() )
+    {
+    case 0: break;
+    case 1: UpperVariant3Fixed<1>( A ); break;
+    case 2: UpperVariant3Fixed<2>( A ); break;
+    case 3: UpperVariant3Fixed<3>( A ); break;
+    case 4: UpperVariant3Fixed<4>( A ); break;
+    default: UpperVariant3Unblocked( A );
+    }
+}
+
+} // namespace cholesky
+
 template<typename F>
 void Cholesky( UpperOrLower uplo, Matrix<F>& A )
 {
@@ -31,12 +73,33 @@ void Cholesky( UpperOrLower uplo, Matrix<F>& A )
       if( A.Height() != A.Width() )
           LogicError("A must be square");
     )
-    if( uplo == LOWER )
+    if( A.Height() <= cholesky::unblockedCutoff )
+    {
+        if( uplo == LOWER )
+            cholesky::SmallLower( A );
+        else
+            cholesky::SmallUpper( A );
+    }
+    else if( uplo == LOWER )
         cholesky::LowerVariant3Blocked( A );
     else
         cholesky::UpperVariant3Blocked( A );
 }
 
+template<typename F>
+void Cholesky( UpperOrLower uplo, Matrix<F>& A, const CholeskyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    if( ctrl.variant == CHOLESKY_TILED )
+        cholesky::Variant3Tiled( uplo, A, ctrl.tileSize, ctrl.numThreads );
+    else
+        Cholesky( uplo, A );
+}
+
 template<typename F>
 void Cholesky( UpperOrLower uplo, Matrix<F>& A, Permutation& p )
 {
@@ -172,6 +235,32 @@ void CholeskyMod
         cholesky::UpperMod( T, alpha, V );
 }
 
+template<typename F>
+Int LowRankCholesky
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+        Matrix<F>& L,
+        Permutation& P,
+  Base<F> relTol,
+  Int maxRank )
+{
+    EL_DEBUG_CSE
+    return cholesky::LowRank( uplo, A, L, P, relTol, maxRank );
+}
+
+template<typename F>
+Int LowRankCholesky
+( UpperOrLower uplo,
+  const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& L,
+        DistPermutation& P,
+  Base<F> relTol,
+  Int maxRank )
+{
+    EL_DEBUG_CSE
+    return cholesky::LowRank( uplo, A, L, P, relTol, maxRank );
+}
+
 template<typename F>
 void HPSDCholesky( UpperOrLower uplo, Matrix<F>& A )
 {
@@ -206,6 +295,8 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
 #define PROTO_BASE(F) \
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void Cholesky \
+  ( UpperOrLower uplo, Matrix<F>& A, const CholeskyCtrl& ctrl ); \
+  template void Cholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack ); \
   template void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
@@ -225,6 +316,20 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
     AbstractDistMatrix<F>& T, \
     Base<F> alpha, \
     AbstractDistMatrix<F>& V ); \
+  template Int LowRankCholesky \
+  ( UpperOrLower uplo, \
+    const Matrix<F>& A, \
+          Matrix<F>& L, \
+          Permutation& P, \
+    Base<F> relTol, \
+    Int maxRank ); \
+  template Int LowRankCholesky \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<F>& L, \
+          DistPermutation& P, \
+    Base<F> relTol, \
+    Int maxRank ); \
   template void cholesky::SolveAfter \
   ( UpperOrLower uplo, Orientation orientation, \
     const Matrix<F>& A, \
@@ -0,0 +1,284 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_LOWRANK_HPP
+#define EL_CHOLESKY_LOWRANK_HPP
+
+namespace El {
+namespace cholesky {
+
+namespace low_rank {
+
+// Return the (i,j) entry of the Hermitian matrix whose 'uplo' triangle is
+// stored in A
+template<typename F>
+F HermitianEntry( UpperOrLower uplo, const Matrix<F>& A, Int i, Int j )
+{
+    if( uplo == LOWER )
+        return ( i >= j ? A(i,j) : Conj(A(j,i)) );
+    else
+        return ( i <= j ? A(i,j) : Conj(A(j,i)) );
+}
+
+// Record the selected pivots (in elimination order) as sequential swaps,
+// following the displacement of each pivot through the earlier swaps
+template<typename PermType>
+void FormPermutation( const vector<Int>& pivList, Int n, PermType& P )
+{
+    const Int rank = pivList.size();
+    P.MakeIdentity( n );
+    P.ReserveSwaps( rank );
+    vector<Int> pivots( rank );
+    for( Int j=0; j<rank; ++j )
+    {
+        Int pos = pivList[j];
+        for( Int i=0; i<j; ++i )
+        {
+            if( pos == i )
+                pos = pivots[i];
+            else if( pos == pivots[i] )
+                pos = i;
+        }
+        pivots[j] = pos;
+        P.Swap( j, pos );
+    }
+}
+
+} // namespace low_rank
+
+template<typename F>
+Int LowRank
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+        Matrix<F>& L,
+        Permutation& P,
+  Base<F> relTol,
+  Int maxRank )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    if( maxRank <= 0 || maxRank > n )
+        maxRank = n;
+
+    // The diagonal of the (implicit) Schur complement
+    Matrix<Real> d( n, 1 );
+    Real trace = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        d(i) = RealPart(A(i,i));
+        trace += d(i);
+    }
+
+    // The factor is grown geometrically, since the achieved rank is
+    // typically far smaller than maxRank (and Matrix::Resize does not
+    // preserve the contents over a reallocation)
+    Int cap = Min( maxRank, Int(32) );
+    Zeros( L, n, cap );
+
+    Matrix<F> col( n, 1 );
+    vector<Int> pivList;
+    vector<bool> used( n, false );
+    Real remaining = trace;
+    Int k = 0;
+    while( k < maxRank && remaining > relTol*trace )
+    {
+        // Select the largest remaining diagonal entry
+        Int p = -1;
+        Real pivVal = -1;
+        for( Int i=0; i<n; ++i )
+            if( !used[i] && d(i) > pivVal )
+            {
+                pivVal = d(i);
+                p = i;
+            }
+        if( pivVal <= Real(0) )
+            break; // The numerically semi-definite part is exhausted
+
+        if( k == cap )
+        {
+            cap = Min( maxRank, 2*cap );
+            Matrix<F> LNew;
+            Zeros( LNew, n, cap );
+            auto LNewL = LNew( ALL, IR(0,k) );
+            Copy( L, LNewL );
+            L = std::move( LNew );
+        }
+
+        // Lazily form column p of the Schur complement from the stored
+        // factor: col := A(:,p) - L(:,0:k) L(p,0:k)'
+        for( Int i=0; i<n; ++i )
+            col(i) = low_rank::HermitianEntry( uplo, A, i, p );
+        F* colBuf = col.Buffer();
+        F* LBuf = L.Buffer();
+        const Int LLDim = L.LDim();
+        for( Int t=0; t<k; ++t )
+            blas::Axpy
+            ( n, -Conj(LBuf[p+t*LLDim]), &LBuf[t*LLDim], 1, colBuf, 1 );
+
+        const Real delta = Sqrt( pivVal );
+        const Real deltaInv = Real(1)/delta;
+        L(p,k) = delta;
+        used[p] = true;
+        pivList.push_back( p );
+        for( Int i=0; i<n; ++i )
+        {
+            if( used[i] )
+                continue;
+            const F lambda = col(i)*deltaInv;
+            L(i,k) = lambda;
+            d(i) -= RealPart(lambda*Conj(lambda));
+        }
+        ++k;
+
+        remaining = 0;
+        for( Int i=0; i<n; ++i )
+            if( !used[i] )
+                remaining += d(i);
+    }
+    L.Resize( n, k );
+
+    low_rank::FormPermutation( pivList, n, P );
+    return k;
+}
+
+template<typename F>
+Int LowRank
+( UpperOrLower uplo,
+  const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& LPre,
+        DistPermutation& P,
+  Base<F> relTol,
+  Int maxRank )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = APre.Height();
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+    if( maxRank <= 0 || maxRank > n )
+        maxRank = n;
+
+    // A one-dimensional row distribution leaves every column access local
+    DistMatrixReadProxy<F,F,VC,STAR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    DistMatrixWriteProxy<F,F,VC,STAR> LProx( LPre );
+    auto& L = LProx.Get();
+    const Int localHeight = A.LocalHeight();
+    const Matrix<F>& ALoc = A.LockedMatrix();
+    mpi::Comm colComm = A.ColComm();
+
+    // The local rows of the diagonal of the (implicit) Schur complement
+    Matrix<Real> d( localHeight, 1 );
+    Real localTrace = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        d(iLoc) = RealPart(ALoc(iLoc,i));
+        localTrace += d(iLoc);
+    }
+    const Real trace = mpi::AllReduce( localTrace, colComm );
+
+    Int cap = Min( maxRank, Int(32) );
+    L.AlignWith( A );
+    Zeros( L, n, cap );
+
+    // Workspace for broadcasting the pivot row of A (n entries) followed by
+    // the pivot row of the factor (up to maxRank entries)
+    vector<F> rowBuf( n+cap );
+    vector<Int> pivList;
+    vector<bool> used( localHeight, false );
+    Real remaining = trace;
+    Int k = 0;
+    while( k < maxRank && remaining > relTol*trace )
+    {
+        // Select the largest remaining diagonal entry
+        ValueInt<Real> localPivot;
+        localPivot.value = -1;
+        localPivot.index = 0;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            if( !used[iLoc] && d(iLoc) > localPivot.value )
+            {
+                localPivot.value = d(iLoc);
+                localPivot.index = A.GlobalRow(iLoc);
+            }
+        const auto pivot =
+          mpi::AllReduce( localPivot, mpi::MaxLocOp<Real>(), colComm );
+        if( pivot.value <= Real(0) )
+            break; // The numerically semi-definite part is exhausted
+        const Int p = pivot.index;
+
+        if( k == cap )
+        {
+            cap = Min( maxRank, 2*cap );
+            DistMatrix<F,VC,STAR> LNew( A.Grid() );
+            LNew.AlignWith( A );
+            Zeros( LNew, n, cap );
+            auto LNewL = LNew( ALL, IR(0,k) );
+            Copy( L, LNewL );
+            L = std::move( LNew );
+            rowBuf.resize( n+cap );
+        }
+
+        // Ship row p of A and of the factor from its owner (the former is
+        // only meaningful over the stored triangle)
+        Matrix<F>& LLoc = L.Matrix();
+        const int owner = A.RowOwner(p);
+        if( mpi::Rank(colComm) == owner )
+        {
+            const Int pLoc = A.LocalRow(p);
+            for( Int j=0; j<n; ++j )
+                rowBuf[j] = ALoc(pLoc,j);
+            for( Int t=0; t<k; ++t )
+                rowBuf[n+t] = LLoc(pLoc,t);
+        }
+        mpi::Broadcast( rowBuf.data(), n+k, owner, colComm );
+
+        const Real delta = Sqrt( pivot.value );
+        const Real deltaInv = Real(1)/delta;
+        pivList.push_back( p );
+        Real localRemaining = 0;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i == p )
+            {
+                LLoc(iLoc,k) = delta;
+                used[iLoc] = true;
+                continue;
+            }
+            if( used[iLoc] )
+                continue;
+            const bool stored = ( uplo==LOWER ? i >= p : i <= p );
+            F lambda = ( stored ? ALoc(iLoc,p) : Conj(rowBuf[i]) );
+            for( Int t=0; t<k; ++t )
+                lambda -= LLoc(iLoc,t)*Conj(rowBuf[n+t]);
+            lambda *= deltaInv;
+            LLoc(iLoc,k) = lambda;
+            d(iLoc) -= RealPart(lambda*Conj(lambda));
+            localRemaining += d(iLoc);
+        }
+        ++k;
+        remaining = mpi::AllReduce( localRemaining, colComm );
+    }
+    L.Resize( n, k );
+
+    low_rank::FormPermutation( pivList, n, P );
+    return k;
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_LOWRANK_HPP
@@ -40,6 +40,34 @@ void LowerVariant3Unblocked( Matrix<F>& A )
     }
 }
 
+// A fully-unrolled analogue of the unblocked algorithm for compile-time
+// (tiny) matrix sizes, meant to be reached through a runtime size switch
+template<Int n,typename F>
+void LowerVariant3Fixed( Matrix<F>& A )
+{
+    typedef Base<F> Real;
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        Real alpha11 = RealPart(ABuf[j+j*ALDim]);
+        if( alpha11 <= Real(0) )
+            throw NonHPDMatrixException("A was not numerically HPD");
+        alpha11 = Sqrt( alpha11 );
+        ABuf[j+j*ALDim] = alpha11;
+
+        const Real delta11Inv = Real(1)/alpha11;
+        for( Int i=j+1; i<n; ++i )
+            ABuf[i+j*ALDim] *= delta11Inv;
+        for( Int k=j+1; k<n; ++k )
+        {
+            const F gamma21 = Conj(ABuf[k+j*ALDim]);
+            for( Int i=k; i<n; ++i )
+                ABuf[i+k*ALDim] -= ABuf[i+j*ALDim]*gamma21;
+        }
+    }
+}
+
 template<typename F>
 void LowerVariant3Blocked( Matrix<F>& A )
 {
@@ -49,17 +77,17 @@ void LowerVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
-    for( Int k=0; k<n; k+=bsize )
-    {
-        const Int nb = Min(bsize,n-k);
-
-        const Range<Int> ind1( k,    k+nb ),
-                         ind2( k+nb, n    );
+    const Int bsize = AlgorithmicBlocksize<F>( "Cholesky", n );
 
-        auto A11 = A( ind1, ind1 );
-        auto A21 = A( ind2, ind1 );
-        auto A22 = A( ind2, ind2 );
+    // Traverse the diagonal with POD spans, reattaching a fixed set of
+    // views rather than constructing new Matrix objects each iteration
+    Matrix<F> A11, A21, A22;
+    for( auto cursor=BeginDiagonalTraversal( FullSpan(A), bsize );
+         !cursor.Done(); cursor.Slide(bsize) )
+    {
+        cursor.Block11().View( A11 );
+        cursor.Block21().View( A21 );
+        cursor.Block22().View( A22 );
 
         cholesky::LowerVariant3Unblocked( A11 );
         Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
@@ -87,7 +115,7 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = AlgorithmicBlocksize<F>( "Cholesky", n );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_OOC_VARIANT3_HPP
+#define EL_CHOLESKY_OOC_VARIANT3_HPP
+
+// An out-of-core right-looking tile Cholesky factorization layered on the
+// TileStore: the loop structure is the tile analogue of Variant3, with the
+// next tile of each sweep prefetched on the I/O thread while the current
+// tile's POTRF/TRSM/HERK/GEMM executes, so that (whenever a tile's update
+// costs more than its transfer) the disk traffic hides behind computation.
+
+namespace El {
+namespace cholesky {
+
+template<typename F>
+void OOCVariant3( UpperOrLower uplo, TileStore<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    const Int nt = A.NumRowTiles();
+    for( Int k=0; k<nt; ++k )
+    {
+        auto& Akk = A.Tile(k,k);
+        if( k+1 < nt )
+        {
+            if( uplo == LOWER )
+                A.Prefetch( k+1, k );
+            else
+                A.Prefetch( k, k+1 );
+        }
+        Cholesky( uplo, Akk );
+
+        if( uplo == LOWER )
+        {
+            // Solve the panel below the diagonal tile against L(k,k)
+            for( Int i=k+1; i<nt; ++i )
+            {
+                auto& Aik = A.Tile(i,k);
+                if( i+1 < nt )
+                    A.Prefetch( i+1, k );
+                Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), Akk, Aik );
+                A.Release( i, k );
+            }
+            A.Release( k, k );
+
+            // Rank-b update of the trailing tiles, prefetching the next
+            // tile of the sweep while the current product executes
+            for( Int j=k+1; j<nt; ++j )
+            {
+                const auto& Ajk = A.LockedTile(j,k);
+                auto& Ajj = A.Tile(j,j);
+                if( j+1 < nt )
+                    A.Prefetch( j+1, j );
+                else if( k+1 < nt )
+                    A.Prefetch( k+1, k+1 );
+                Herk( LOWER, NORMAL, Base<F>(-1), Ajk, Base<F>(1), Ajj );
+                A.Release( j, j );
+                for( Int i=j+1; i<nt; ++i )
+                {
+                    const auto& Aik = A.LockedTile(i,k);
+                    auto& Aij = A.Tile(i,j);
+                    if( i+1 < nt )
+                        A.Prefetch( i+1, j );
+                    Gemm( NORMAL, ADJOINT, F(-1), Aik, Ajk, F(1), Aij );
+                    A.Release( i, j );
+                    A.Release( i, k );
+                }
+                A.Release( j, k );
+            }
+        }
+        else
+        {
+            // Solve the panel to the right of the diagonal tile against
+            // U(k,k)
+            for( Int j=k+1; j<nt; ++j )
+            {
+                auto& Akj = A.Tile(k,j);
+                if( j+1 < nt )
+                    A.Prefetch( k, j+1 );
+                Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), Akk, Akj );
+                A.Release( k, j );
+            }
+            A.Release( k, k );
+
+            for( Int j=k+1; j<nt; ++j )
+            {
+                const auto& Akj = A.LockedTile(k,j);
+                auto& Ajj = A.Tile(j,j);
+                if( j+1 < nt )
+                    A.Prefetch( k, j+1 );
+                else if( k+1 < nt )
+                    A.Prefetch( k+1, k+1 );
+                Herk( UPPER, ADJOINT, Base<F>(-1), Akj, Base<F>(1), Ajj );
+                A.Release( j, j );
+                for( Int i=k+1; i<j; ++i )
+                {
+                    const auto& Aki = A.LockedTile(k,i);
+                    auto& Aij = A.Tile(i,j);
+                    Gemm( ADJOINT, NORMAL, F(-1), Aki, Akj, F(1), Aij );
+                    A.Release( i, j );
+                    A.Release( k, i );
+                }
+                A.Release( k, j );
+            }
+        }
+    }
+    A.Flush();
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_OOC_VARIANT3_HPP
@@ -45,6 +45,34 @@ void UpperVariant3Unblocked( Matrix<F>& A )
     }
 }
 
+// A fully-unrolled analogue of the unblocked algorithm for compile-time
+// (tiny) matrix sizes, meant to be reached through a runtime size switch
+template<Int n,typename F>
+void UpperVariant3Fixed( Matrix<F>& A )
+{
+    typedef Base<F> Real;
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        Real alpha11 = RealPart(ABuf[j+j*ALDim]);
+        if( alpha11 <= Real(0) )
+            throw NonHPDMatrixException("A was not numerically HPD");
+        alpha11 = Sqrt( alpha11 );
+        ABuf[j+j*ALDim] = alpha11;
+
+        const Real delta11Inv = Real(1)/alpha11;
+        for( Int k=j+1; k<n; ++k )
+            ABuf[j+k*ALDim] *= delta11Inv;
+        for( Int k=j+1; k<n; ++k )
+        {
+            const F gamma12 = ABuf[j+k*ALDim];
+            for( Int i=j+1; i<=k; ++i )
+                ABuf[i+k*ALDim] -= Conj(ABuf[j+i*ALDim])*gamma12;
+        }
+    }
+}
+
 template<typename F>
 void UpperVariant3Blocked( Matrix<F>& A )
 {
@@ -54,17 +82,17 @@ void UpperVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
-    for( Int k=0; k<n; k+=bsize )
-    {
-        const Int nb = Min(bsize,n-k);
-
-        const Range<Int> ind1( k,    k+nb ),
-                         ind2( k+nb, n    );
+    const Int bsize = AlgorithmicBlocksize<F>( "Cholesky", n );
 
-        auto A11 = A( ind1, ind1 );
-        auto A12 = A( ind1, ind2 );
-        auto A22 = A( ind2, ind2 );
+    // Traverse the diagonal with POD spans, reattaching a fixed set of
+    // views rather than constructing new Matrix objects each iteration
+    Matrix<F> A11, A12, A22;
+    for( auto cursor=BeginDiagonalTraversal( FullSpan(A), bsize );
+         !cursor.Done(); cursor.Slide(bsize) )
+    {
+        cursor.Block11().View( A11 );
+        cursor.Block12().View( A12 );
+        cursor.Block22().View( A22 );
 
         cholesky::UpperVariant3Unblocked( A11 );
         Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12 );
@@ -91,7 +119,7 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A12_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = AlgorithmicBlocksize<F>( "Cholesky", n );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
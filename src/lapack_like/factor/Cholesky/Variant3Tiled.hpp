@@ -0,0 +1,359 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_VARIANT3_TILED_HPP
+#define EL_CHOLESKY_VARIANT3_TILED_HPP
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// A tile-based sequential Cholesky factorization: the matrix is decomposed
+// into square tiles and the resulting POTRF/TRSM/HERK/GEMM task DAG is
+// executed through a lightweight work-stealing thread pool so that the
+// trailing-matrix updates of several iterations may proceed concurrently
+// with the panel work. Dependencies are tracked with one atomic counter per
+// task; updates to the same tile are chained across iterations so that no
+// two tasks ever write to the same tile simultaneously.
+
+namespace El {
+namespace cholesky {
+namespace tiled {
+
+// An unblocked factorization of a diagonal tile which avoids the Matrix
+// interface (and its debug-mode call-stack manipulation, which is not
+// thread-safe) by operating directly on the tile's buffer
+template<typename F>
+void FactorDiagonalTile( UpperOrLower uplo, Int m, F* A, Int ALDim )
+{
+    typedef Base<F> Real;
+    for( Int j=0; j<m; ++j )
+    {
+        Real alpha11 = RealPart(A[j+j*ALDim]);
+        if( alpha11 <= Real(0) )
+            throw NonHPDMatrixException("A was not numerically HPD");
+        alpha11 = Sqrt( alpha11 );
+        A[j+j*ALDim] = alpha11;
+
+        const Int a21Height = m-(j+1);
+        if( uplo == LOWER )
+        {
+            F* a21 = &A[(j+1)+j*ALDim];
+            blas::Scal( a21Height, Real(1)/alpha11, a21, 1 );
+            blas::Her
+            ( 'L', a21Height, -Real(1), a21, 1,
+              &A[(j+1)+(j+1)*ALDim], ALDim );
+        }
+        else
+        {
+            F* a12 = &A[j+(j+1)*ALDim];
+            blas::Scal( a21Height, Real(1)/alpha11, a12, ALDim );
+            for( Int l=0; l<a21Height; ++l )
+                a12[l*ALDim] = Conj(a12[l*ALDim]);
+            blas::Her
+            ( 'U', a21Height, -Real(1), a12, ALDim,
+              &A[(j+1)+(j+1)*ALDim], ALDim );
+            for( Int l=0; l<a21Height; ++l )
+                a12[l*ALDim] = Conj(a12[l*ALDim]);
+        }
+    }
+}
+
+enum TaskType
+{
+  FACTOR_TASK, // Factor diagonal tile k
+  SOLVE_TASK,  // Solve for off-diagonal tile (i,k) against diagonal tile k
+  UPDATE_TASK  // Apply rank-b update from iteration k to tile (i,j)
+};
+
+struct Task
+{
+    TaskType type;
+    Int i, j, k;
+};
+
+template<typename F>
+class Scheduler
+{
+public:
+    Scheduler( UpperOrLower uplo, Matrix<F>& A, Int tileSize, Int numThreads )
+    : uplo_(uplo), buf_(A.Buffer()), n_(A.Height()), ldim_(A.LDim()),
+      b_(tileSize)
+    {
+        nt_ = (n_+b_-1) / b_;
+        const Int maxThreads = Int(std::thread::hardware_concurrency());
+        numWorkers_ = Max( Min( numThreads, maxThreads ), Int(1) );
+
+        BuildGraph();
+        queues_.resize( numWorkers_ );
+        queueMutexes_.reset( new std::mutex[numWorkers_] );
+    }
+
+    void Run()
+    {
+        // Seed the DAG with the only dependency-free task, FACTOR(0), and
+        // use the calling thread as worker 0
+        Push( 0, FactorID(0) );
+        std::vector<std::thread> workers;
+        workers.reserve( numWorkers_-1 );
+        for( Int w=1; w<numWorkers_; ++w )
+            workers.emplace_back( &Scheduler<F>::Work, this, w );
+        Work( 0 );
+        for( auto& worker : workers )
+            worker.join();
+        if( error_ )
+            std::rethrow_exception( error_ );
+    }
+
+private:
+    UpperOrLower uplo_;
+    F* buf_;
+    Int n_, ldim_, b_, nt_, numWorkers_;
+
+    std::vector<Task> tasks_;
+    std::unique_ptr<std::atomic<Int>[]> deps_;
+    std::atomic<Int> numRemaining_;
+
+    std::vector<std::deque<Int>> queues_;
+    std::unique_ptr<std::mutex[]> queueMutexes_;
+
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+
+    // The tasks are stored as [factors, solves, updates], with the solves
+    // and updates for iteration k packed contiguously
+    std::vector<Int> solveOffs_, updateOffs_, updateInner_;
+
+    Int FactorID( Int k ) const { return k; }
+    Int SolveID( Int i, Int k ) const
+    { return nt_ + solveOffs_[k] + (i-k-1); }
+    Int UpdateID( Int i, Int j, Int k ) const
+    { return nt_ + solveOffs_[nt_] + updateOffs_[k] +
+             updateInner_[k*nt_+j] + (i-j); }
+
+    void BuildGraph()
+    {
+        solveOffs_.resize( nt_+1 );
+        updateOffs_.resize( nt_+1 );
+        updateInner_.resize( nt_*nt_, 0 );
+        solveOffs_[0] = updateOffs_[0] = 0;
+        for( Int k=0; k<nt_; ++k )
+        {
+            solveOffs_[k+1] = solveOffs_[k] + (nt_-k-1);
+            Int numUpdates = 0;
+            for( Int j=k+1; j<nt_; ++j )
+            {
+                updateInner_[k*nt_+j] = numUpdates;
+                numUpdates += nt_-j;
+            }
+            updateOffs_[k+1] = updateOffs_[k] + numUpdates;
+        }
+        const Int numTasks = nt_ + solveOffs_[nt_] + updateOffs_[nt_];
+
+        tasks_.resize( numTasks );
+        deps_.reset( new std::atomic<Int>[numTasks] );
+        numRemaining_.store( numTasks );
+        for( Int k=0; k<nt_; ++k )
+        {
+            tasks_[FactorID(k)] = Task{ FACTOR_TASK, k, k, k };
+            deps_[FactorID(k)].store( k>0 ? 1 : 0 );
+            for( Int i=k+1; i<nt_; ++i )
+            {
+                tasks_[SolveID(i,k)] = Task{ SOLVE_TASK, i, k, k };
+                deps_[SolveID(i,k)].store( k>0 ? 2 : 1 );
+            }
+            for( Int j=k+1; j<nt_; ++j )
+            {
+                for( Int i=j; i<nt_; ++i )
+                {
+                    tasks_[UpdateID(i,j,k)] = Task{ UPDATE_TASK, i, j, k };
+                    // SOLVE(i,k) and SOLVE(j,k) (twice SOLVE(i,k) if i=j),
+                    // plus the preceding update of this tile when k > 0
+                    deps_[UpdateID(i,j,k)].store( k>0 ? 3 : 2 );
+                }
+            }
+        }
+    }
+
+    Int TileSize( Int t ) const { return Min( b_, n_-t*b_ ); }
+    F* Tile( Int i, Int j ) const
+    {
+        // For the upper factorization, DAG tile (i,j) with i >= j refers to
+        // the stored block A(j,i)
+        if( uplo_ == LOWER )
+            return &buf_[(i*b_)+(j*b_)*ldim_];
+        else
+            return &buf_[(j*b_)+(i*b_)*ldim_];
+    }
+
+    void Push( Int w, Int task )
+    {
+        std::lock_guard<std::mutex> lock( queueMutexes_[w] );
+        queues_[w].push_back( task );
+    }
+
+    Int Pop( Int w )
+    {
+        std::lock_guard<std::mutex> lock( queueMutexes_[w] );
+        if( queues_[w].empty() )
+            return -1;
+        const Int task = queues_[w].back();
+        queues_[w].pop_back();
+        return task;
+    }
+
+    Int Steal( Int w )
+    {
+        for( Int shift=1; shift<numWorkers_; ++shift )
+        {
+            const Int victim = (w+shift) % numWorkers_;
+            std::lock_guard<std::mutex> lock( queueMutexes_[victim] );
+            if( !queues_[victim].empty() )
+            {
+                const Int task = queues_[victim].front();
+                queues_[victim].pop_front();
+                return task;
+            }
+        }
+        return -1;
+    }
+
+    void Satisfy( Int task, Int w )
+    {
+        if( deps_[task].fetch_sub(1) == 1 )
+            Push( w, task );
+    }
+
+    void Execute( const Task& task )
+    {
+        const Int i=task.i, j=task.j, k=task.k;
+        const Int bi=TileSize(i), bj=TileSize(j), bk=TileSize(k);
+        switch( task.type )
+        {
+        case FACTOR_TASK:
+            FactorDiagonalTile( uplo_, bk, Tile(k,k), ldim_ );
+            break;
+        case SOLVE_TASK:
+            if( uplo_ == LOWER )
+                blas::Trsm
+                ( 'R', 'L', 'C', 'N', bi, bk,
+                  F(1), Tile(k,k), ldim_, Tile(i,k), ldim_ );
+            else
+                blas::Trsm
+                ( 'L', 'U', 'C', 'N', bk, bi,
+                  F(1), Tile(k,k), ldim_, Tile(i,k), ldim_ );
+            break;
+        case UPDATE_TASK:
+            if( i == j )
+            {
+                if( uplo_ == LOWER )
+                    blas::Herk
+                    ( 'L', 'N', bi, bk, -Base<F>(1), Tile(i,k), ldim_,
+                      Base<F>(1), Tile(i,i), ldim_ );
+                else
+                    blas::Herk
+                    ( 'U', 'C', bi, bk, -Base<F>(1), Tile(i,k), ldim_,
+                      Base<F>(1), Tile(i,i), ldim_ );
+            }
+            else
+            {
+                if( uplo_ == LOWER )
+                    blas::Gemm
+                    ( 'N', 'C', bi, bj, bk,
+                      F(-1), Tile(i,k), ldim_, Tile(j,k), ldim_,
+                      F(1), Tile(i,j), ldim_ );
+                else
+                    blas::Gemm
+                    ( 'C', 'N', bj, bi, bk,
+                      F(-1), Tile(j,k), ldim_, Tile(i,k), ldim_,
+                      F(1), Tile(i,j), ldim_ );
+            }
+            break;
+        }
+    }
+
+    void Finish( const Task& task, Int w )
+    {
+        const Int i=task.i, j=task.j, k=task.k;
+        switch( task.type )
+        {
+        case FACTOR_TASK:
+            for( Int iNew=k+1; iNew<nt_; ++iNew )
+                Satisfy( SolveID(iNew,k), w );
+            break;
+        case SOLVE_TASK:
+            for( Int jNew=k+1; jNew<=i; ++jNew )
+                Satisfy( UpdateID(i,jNew,k), w );
+            for( Int iNew=i; iNew<nt_; ++iNew )
+                Satisfy( UpdateID(iNew,i,k), w );
+            break;
+        case UPDATE_TASK:
+            if( k+1 < j )
+                Satisfy( UpdateID(i,j,k+1), w );
+            else if( i == j )
+                Satisfy( FactorID(j), w );
+            else
+                Satisfy( SolveID(i,j), w );
+            break;
+        }
+    }
+
+    void Work( Int w )
+    {
+        while( numRemaining_.load() > 0 )
+        {
+            Int task = Pop( w );
+            if( task < 0 )
+                task = Steal( w );
+            if( task < 0 )
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            try { Execute( tasks_[task] ); }
+            catch( ... )
+            {
+                std::lock_guard<std::mutex> lock( errorMutex_ );
+                if( !error_ )
+                    error_ = std::current_exception();
+                numRemaining_.store( 0 );
+                return;
+            }
+            Finish( tasks_[task], w );
+            numRemaining_.fetch_sub( 1 );
+        }
+    }
+};
+
+} // namespace tiled
+
+template<typename F>
+void Variant3Tiled
+( UpperOrLower uplo, Matrix<F>& A, Int tileSize, Int numThreads )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    if( tileSize <= 0 )
+        tileSize = Blocksize();
+    if( numThreads <= 0 )
+        numThreads = Int(std::thread::hardware_concurrency());
+    if( A.Height() == 0 )
+        return;
+    tiled::Scheduler<F> scheduler( uplo, A, tileSize, numThreads );
+    scheduler.Run();
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_VARIANT3_TILED_HPP
@@ -103,6 +103,218 @@ BusingerGolub
     Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RL, Z );
 }
 
+// Estimate || A - Q(:,0:rank) BAdj(:,0:rank)^H ||_2 by applying the error to
+// a handful of Gaussian probe vectors; the returned value exceeds the true
+// norm with probability 1 - 10^{-numProbes} [HMT, Sec. 4.3]
+template<typename F>
+inline Base<F>
+ProbeEstimate
+( const Matrix<F>& A,
+  const Matrix<F>& Q,
+  const Matrix<F>& BAdj,
+  Int rank,
+  Int numProbes )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Width();
+    Matrix<F> W, R;
+    Gaussian( W, n, numProbes );
+    Gemm( NORMAL, NORMAL, F(1), A, W, R );
+    if( rank > 0 )
+    {
+        auto QL = Q( ALL, IR(0,rank) );
+        auto BAdjL = BAdj( ALL, IR(0,rank) );
+        Matrix<F> T;
+        Gemm( ADJOINT, NORMAL, F(1), BAdjL, W, T );
+        Gemm( NORMAL, NORMAL, F(-1), QL, T, F(1), R );
+    }
+    Real maxNorm = 0;
+    for( Int j=0; j<numProbes; ++j )
+        maxNorm = Max( maxNorm, Nrm2( R( ALL, IR(j,j+1) ) ) );
+    return Real(10)*Sqrt(Real(2)/Pi<Real>())*maxNorm;
+}
+
+template<typename F>
+inline Base<F>
+ProbeEstimate
+( const DistMatrix<F>& A,
+  const DistMatrix<F>& Q,
+  const DistMatrix<F>& BAdj,
+  Int rank,
+  Int numProbes )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Width();
+    DistMatrix<F> W(g), R(g);
+    Gaussian( W, n, numProbes );
+    Gemm( NORMAL, NORMAL, F(1), A, W, R );
+    if( rank > 0 )
+    {
+        auto QL = Q( ALL, IR(0,rank) );
+        auto BAdjL = BAdj( ALL, IR(0,rank) );
+        DistMatrix<F> T(g);
+        Gemm( ADJOINT, NORMAL, F(1), BAdjL, W, T );
+        Gemm( NORMAL, NORMAL, F(-1), QL, T, F(1), R );
+    }
+    Real maxNorm = 0;
+    for( Int j=0; j<numProbes; ++j )
+        maxNorm = Max( maxNorm, Nrm2( R( ALL, IR(j,j+1) ) ) );
+    return Real(10)*Sqrt(Real(2)/Pi<Real>())*maxNorm;
+}
+
+template<typename F>
+inline Int
+RandomizedBlocked
+( const Matrix<F>& A,
+  Permutation& Omega,
+  Matrix<F>& Z,
+  const RandomizedIDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Int maxRank = ctrl.maxRank;
+    if( maxRank <= 0 || maxRank > Min(m,n) )
+        maxRank = Min(m,n);
+    const Int blockSize = Max( ctrl.blockSize, Int(1) );
+
+    // The basis and (the adjoint of) its coefficients are grown
+    // geometrically, since Matrix::Resize does not preserve the contents
+    // over a reallocation
+    Int cap = Min( maxRank, blockSize );
+    Matrix<F> Q( m, cap ), BAdj( n, cap );
+
+    Matrix<F> G, Y, T;
+    Int k = 0;
+    Real est = ProbeEstimate( A, Q, BAdj, k, ctrl.numProbes );
+    while( k < maxRank && est > ctrl.tol )
+    {
+        const Int bsize = Min( blockSize, maxRank-k );
+        if( k+bsize > cap )
+        {
+            cap = Min( maxRank, Max(2*cap,k+bsize) );
+            Matrix<F> QNew( m, cap ), BAdjNew( n, cap );
+            auto QNewL = QNew( ALL, IR(0,k) );
+            auto BAdjNewL = BAdjNew( ALL, IR(0,k) );
+            Copy( Q( ALL, IR(0,k) ), QNewL );
+            Copy( BAdj( ALL, IR(0,k) ), BAdjNewL );
+            Q = std::move( QNew );
+            BAdj = std::move( BAdjNew );
+        }
+
+        // Sample a new block of the range of the residual: rather than
+        // restarting the factorization, the fresh Gaussian block is merely
+        // projected against the basis accumulated so far (two passes of
+        // block Gram-Schmidt, for the sake of orthogonality)
+        Gaussian( G, n, bsize );
+        Gemm( NORMAL, NORMAL, F(1), A, G, Y );
+        if( k > 0 )
+        {
+            auto QL = Q( ALL, IR(0,k) );
+            Gemm( ADJOINT, NORMAL, F(1), QL, Y, T );
+            Gemm( NORMAL, NORMAL, F(-1), QL, T, F(1), Y );
+            Gemm( ADJOINT, NORMAL, F(1), QL, Y, T );
+            Gemm( NORMAL, NORMAL, F(-1), QL, T, F(1), Y );
+        }
+        qr::ExplicitUnitary( Y );
+
+        auto Q1 = Q( ALL, IR(k,k+bsize) );
+        auto BAdj1 = BAdj( ALL, IR(k,k+bsize) );
+        Copy( Y, Q1 );
+        Gemm( ADJOINT, NORMAL, F(1), A, Y, BAdj1 );
+        k += bsize;
+
+        est = ProbeEstimate( A, Q, BAdj, k, ctrl.numProbes );
+    }
+
+    // Extract the interpolative decomposition from the small B = Q^H A
+    Matrix<F> B;
+    Adjoint( BAdj( ALL, IR(0,k) ), B );
+    QRCtrl<Real> qrCtrl;
+    BusingerGolub( B, Omega, Z, qrCtrl );
+    return k;
+}
+
+template<typename F>
+inline Int
+RandomizedBlocked
+( const AbstractDistMatrix<F>& APre,
+  DistPermutation& Omega,
+  AbstractDistMatrix<F>& Z,
+  const RandomizedIDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Int maxRank = ctrl.maxRank;
+    if( maxRank <= 0 || maxRank > Min(m,n) )
+        maxRank = Min(m,n);
+    const Int blockSize = Max( ctrl.blockSize, Int(1) );
+
+    Int cap = Min( maxRank, blockSize );
+    DistMatrix<F> Q(g), BAdj(g);
+    Q.Resize( m, cap );
+    BAdj.Resize( n, cap );
+
+    DistMatrix<F> G(g), Y(g), T(g);
+    Int k = 0;
+    Real est = ProbeEstimate( A, Q, BAdj, k, ctrl.numProbes );
+    while( k < maxRank && est > ctrl.tol )
+    {
+        const Int bsize = Min( blockSize, maxRank-k );
+        if( k+bsize > cap )
+        {
+            cap = Min( maxRank, Max(2*cap,k+bsize) );
+            DistMatrix<F> QNew(g), BAdjNew(g);
+            QNew.Resize( m, cap );
+            BAdjNew.Resize( n, cap );
+            auto QNewL = QNew( ALL, IR(0,k) );
+            auto BAdjNewL = BAdjNew( ALL, IR(0,k) );
+            Copy( Q( ALL, IR(0,k) ), QNewL );
+            Copy( BAdj( ALL, IR(0,k) ), BAdjNewL );
+            Q = std::move( QNew );
+            BAdj = std::move( BAdjNew );
+        }
+
+        Gaussian( G, n, bsize );
+        Gemm( NORMAL, NORMAL, F(1), A, G, Y );
+        if( k > 0 )
+        {
+            auto QL = Q( ALL, IR(0,k) );
+            Gemm( ADJOINT, NORMAL, F(1), QL, Y, T );
+            Gemm( NORMAL, NORMAL, F(-1), QL, T, F(1), Y );
+            Gemm( ADJOINT, NORMAL, F(1), QL, Y, T );
+            Gemm( NORMAL, NORMAL, F(-1), QL, T, F(1), Y );
+        }
+        qr::ExplicitUnitary( Y );
+
+        auto Q1 = Q( ALL, IR(k,k+bsize) );
+        auto BAdj1 = BAdj( ALL, IR(k,k+bsize) );
+        Copy( Y, Q1 );
+        Gemm( ADJOINT, NORMAL, F(1), A, Y, BAdj1 );
+        k += bsize;
+
+        est = ProbeEstimate( A, Q, BAdj, k, ctrl.numProbes );
+    }
+
+    // Extract the interpolative decomposition from the small B = Q^H A
+    DistMatrix<F> B(g);
+    Adjoint( BAdj( ALL, IR(0,k) ), B );
+    QRCtrl<Real> qrCtrl;
+    BusingerGolub( B, Omega, Z, qrCtrl );
+    return k;
+}
+
 } // namespace id
 
 template<typename F>
@@ -166,7 +378,39 @@ void ID
     }
 }
 
+template<typename F>
+Int RandomizedID
+( const Matrix<F>& A,
+        Permutation& Omega,
+        Matrix<F>& Z,
+  const RandomizedIDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return id::RandomizedBlocked( A, Omega, Z, ctrl );
+}
+
+template<typename F>
+Int RandomizedID
+( const AbstractDistMatrix<F>& A,
+        DistPermutation& Omega,
+        AbstractDistMatrix<F>& Z,
+  const RandomizedIDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return id::RandomizedBlocked( A, Omega, Z, ctrl );
+}
+
 #define PROTO(F) \
+  template Int RandomizedID \
+  ( const Matrix<F>& A, \
+          Permutation& Omega, \
+          Matrix<F>& Z, \
+    const RandomizedIDCtrl<Base<F>>& ctrl ); \
+  template Int RandomizedID \
+  ( const AbstractDistMatrix<F>& A, \
+          DistPermutation& Omega, \
+          AbstractDistMatrix<F>& Z, \
+    const RandomizedIDCtrl<Base<F>>& ctrl ); \
   template void ID \
   ( const Matrix<F>& A, \
           Permutation& Omega, \
@@ -67,23 +67,46 @@ void UnpackEntriesLocal
 {
     EL_DEBUG_CSE
 
-    // Delete any existing children
-    SwapClear( front.children );
+    // Freshly-constructed fronts inherit these members from their parent
+    // (or distributed duplicate), but reused fronts must be reset by hand
+    if( front.parent != nullptr )
+    {
+        front.type = front.parent->type;
+        front.isHermitian = front.parent->isHermitian;
+    }
+    else if( front.duplicate != nullptr )
+    {
+        front.type = front.duplicate->type;
+        front.isHermitian = front.duplicate->isHermitian;
+    }
 
+    // Only rebuild the children if the tree shape changed: the shape is
+    // fixed by the symbolic analysis, so refilling the numeric values
+    // (e.g., between the iterations of an Interior Point Method) can reuse
+    // the existing front storage
     const Int numChildren = sep.children.size();
-    front.children.resize( numChildren );
-    for( Int c=0; c<numChildren; ++c )
+    if( Int(front.children.size()) != numChildren )
     {
-        front.children[c].reset( new Front<Field>(&front) );
+        SwapClear( front.children );
+        front.children.resize( numChildren );
+        for( Int c=0; c<numChildren; ++c )
+            front.children[c].reset( new Front<Field>(&front) );
+    }
+    for( Int c=0; c<numChildren; ++c )
         UnpackEntriesLocal
         ( *sep.children[c], *node.children[c], *front.children[c],
           A, rRowLengths, rEntries, rTargets, offs, entryOffs );
-    }
     // Mark this node as a sparse leaf if it does not have any children
     // and is not a duplicate of a dense distributed node
     if( numChildren == 0 && !front.duplicate )
         front.sparseLeaf = true;
 
+    // Discard any compressed off-diagonal storage from a previous
+    // factorization
+    front.offDiagRank = -1;
+    front.UOffDiag.Empty();
+    front.VOffDiag.Empty();
+
     const Int size = node.size;
     const Int off = node.off;
     const Int lowerSize = node.lowerStruct.size();
@@ -205,9 +228,20 @@ void UnpackEntries
     EL_DEBUG_CSE
     const Grid& grid = node.Grid();
 
+    // Reused fronts inherit these members from their parent at the time of
+    // construction, but they must be reset by hand when refilling values;
+    // any 1D storage left over from a previous ChangeFrontType is discarded
+    if( front.parent != nullptr )
+    {
+        front.type = front.parent->type;
+        front.isHermitian = front.parent->isHermitian;
+    }
+    front.L1D.Empty();
+
     if( sep.child == nullptr )
     {
-        front.duplicate.reset( new Front<Field>(&front) );
+        if( front.duplicate == nullptr )
+            front.duplicate.reset( new Front<Field>(&front) );
         UnpackEntriesLocal
         ( *sep.duplicate, *node.duplicate, *front.duplicate,
           A, rRowLengths, rEntries, rTargets, offs, entryOffs );
@@ -216,7 +250,8 @@ void UnpackEntries
 
         return;
     }
-    front.child.reset( new DistFront<Field>(&front) );
+    if( front.child == nullptr )
+        front.child.reset( new DistFront<Field>(&front) );
     UnpackEntries
     ( *sep.child, *node.child, *front.child,
       A, rRowLengths, rEntries, rTargets, offs, entryOffs );
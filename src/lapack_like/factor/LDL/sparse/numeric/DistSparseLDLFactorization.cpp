@@ -56,6 +56,7 @@ void DistSparseLDLFactorization<Field>::Initialize
   const BisectCtrl& bisectCtrl )
 {
     EL_DEBUG_CSE
+    MemoryTagScope memScope( MEM_TAG_SPARSE_FACTOR );
     info_.reset( new ldl::DistNodeInfo(A.Grid()) );
     separator_.reset( new ldl::DistSeparator );
     ldl::NestedDissection
@@ -123,6 +124,7 @@ void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     // is sometimes useful to directly manipulate the fronts.
     if( !Unfactored(front_->type) )
         LogicError("Fronts are already marked as factored");
+    MemoryTagScope memScope( MEM_TAG_SPARSE_FACTOR );
 
     // Convert from 1D to 2D if necessary
     ChangeFrontType( SYMM_2D );
@@ -135,6 +137,21 @@ void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( frontType );
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Refactor
+( const DistSparseMatrix<Field>& ANew, LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Refactor()'");
+    // Reuse the reordering, separator and elimination trees, front
+    // structures, and pull metadata: pulling in the new values resets the
+    // fronts to an unfactored state, after which only the numeric
+    // processing remains
+    ChangeNonzeroValues( ANew );
+    Factor( frontType );
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::ChangeFrontType
 ( LDLFrontType frontType )
@@ -83,23 +83,64 @@ void Front<Field>::Pull
     for( Int j=0; j<n; ++j )
         invReorder[reordering[j]] = j;
 
+    // Size a single arena for the dense factor storage of the entire tree
+    // (the symbolic analysis already fixes every front's dimensions). The
+    // postorder traversal below assigns each front the same offset on every
+    // Pull, so refactorizations with an unchanged symbolic structure reuse
+    // the buffer outright.
+    function<Int(const NodeInfo&)> denseSize =
+      [&]( const NodeInfo& node )
+      {
+        Int size = 0;
+        for( const auto& child : node.children )
+            size += denseSize( *child );
+        const Int lowerSize = node.lowerStruct.size();
+        if( node.children.size() == 0 )
+            size += lowerSize*node.size;
+        else
+            size += (node.size+lowerSize)*node.size;
+        return size;
+      };
+    const Int arenaSize = denseSize( rootInfo );
+    if( Int(arena.size()) != arenaSize )
+    {
+        SwapClear( arena );
+        arena.resize( arenaSize );
+    }
+    Int arenaOff = 0;
+
     function<void(const NodeInfo&,Front<Field>&)> pull =
       [&]( const NodeInfo& node, Front<Field>& front )
       {
-        // Delete any existing children
-        SwapClear( front.children );
-
+        // Freshly-constructed children inherit these members from their
+        // parent, but reused fronts must have them reset by hand
+        front.type = SYMM_2D;
+        front.isHermitian = conjugate;
+
+        // Only rebuild the children if the tree shape changed: the shape is
+        // fixed by the symbolic analysis, so refilling the numeric values
+        // (e.g., between the iterations of an Interior Point Method) can
+        // reuse the existing front storage
         const Int numChildren = node.children.size();
-        front.children.resize( numChildren );
-        for( Int c=0; c<numChildren; ++c )
+        if( Int(front.children.size()) != numChildren )
         {
-            front.children[c].reset( new Front<Field>(&front) );
-            pull( *node.children[c], *front.children[c] );
+            SwapClear( front.children );
+            front.children.resize( numChildren );
+            for( Int c=0; c<numChildren; ++c )
+                front.children[c].reset( new Front<Field>(&front) );
         }
+        for( Int c=0; c<numChildren; ++c )
+            pull( *node.children[c], *front.children[c] );
         // Mark this node as a sparse leaf if it does not have any children
         if( numChildren == 0 )
             front.sparseLeaf = true;
 
+        // Discard any compressed off-diagonal storage from a previous
+        // factorization
+        front.offDiagRank = -1;
+        front.UOffDiag.Empty();
+        front.VOffDiag.Empty();
+
         const Int lowerSize = node.lowerStruct.size();
         const Field* AValBuf = A.LockedValueBuffer();
         const Int* AColBuf = A.LockedTargetBuffer();
@@ -108,7 +149,11 @@ void Front<Field>::Pull
         {
             front.workSparse.Empty();
             Zeros( front.workSparse, node.size, node.size );
-            Zeros( front.LDense, lowerSize, node.size );
+            front.LDense.Attach
+            ( lowerSize, node.size, arena.data()+arenaOff,
+              Max(lowerSize,Int(1)) );
+            arenaOff += lowerSize*node.size;
+            Zero( front.LDense );
 
             // Count the number of sparse entries to queue into the top-left
             Int numEntriesTopLeft = 0;
@@ -169,7 +214,11 @@ void Front<Field>::Pull
         }
         else
         {
-            Zeros( front.LDense, node.size+lowerSize, node.size );
+            front.LDense.Attach
+            ( node.size+lowerSize, node.size, arena.data()+arenaOff,
+              Max(node.size+lowerSize,Int(1)) );
+            arenaOff += (node.size+lowerSize)*node.size;
+            Zero( front.LDense );
             for( Int t=0; t<node.size; ++t )
             {
                 const Int j = invReorder[node.off+t];
@@ -519,6 +568,66 @@ void Front<Field>::Unpack
     A.ProcessQueues();
 }
 
+template<typename Field>
+void Front<Field>::CompressOffDiagonals( const Base<Field>& relTol )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    function<void(Front<Field>&)> compress =
+      [&]( Front<Field>& front )
+      {
+        for( auto& child : front.children )
+            compress( *child );
+
+        // Sparse leaves store their connectivity in LDense, duplicates of
+        // distributed fronts have their storage attached elsewhere, and the
+        // block/pivoted solves do not (yet) support compressed storage
+        if( front.sparseLeaf || front.duplicate != nullptr ||
+            front.offDiagRank >= 0 ||
+            BlockFactorization(front.type) ||
+            PivotedFactorization(front.type) ||
+            SelInvFactorization(front.type) )
+            return;
+
+        const Int m = front.LDense.Height();
+        const Int n = front.LDense.Width();
+        if( m <= n )
+            return;
+
+        Matrix<Field> LB( front.LDense( IR(n,END), ALL ) );
+        Matrix<Field> U, V;
+        Matrix<Real> s;
+        SVD( LB, U, s, V );
+        const Int numVals = s.Height();
+        if( numVals == 0 )
+            return;
+
+        const Real twoNorm = s(0);
+        Int rank = numVals;
+        while( rank > 0 && s(rank-1) <= relTol*twoNorm )
+            --rank;
+
+        // Only compress when the outer product is strictly smaller
+        if( rank*( (m-n) + n ) >= (m-n)*n )
+            return;
+
+        front.UOffDiag = U( ALL, IR(0,rank) );
+        auto sTrunc = s( IR(0,rank), ALL );
+        DiagonalScale( RIGHT, NORMAL, sTrunc, front.UOffDiag );
+        front.VOffDiag = V( ALL, IR(0,rank) );
+        front.offDiagRank = rank;
+
+        // Shrink the dense storage down to the top-left block. LDense is
+        // typically a view into the tree's arena (see Front::Pull), so it
+        // must be released before it can own the shrunken copy.
+        Matrix<Field> LT( front.LDense( IR(0,n), ALL ) );
+        if( front.LDense.Viewing() )
+            front.LDense.Empty();
+        front.LDense = LT;
+      };
+    compress( *this );
+}
+
 template<typename Field>
 const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
 {
@@ -526,6 +635,11 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
     isHermitian = front.isHermitian;
     sparseLeaf = front.sparseLeaf;
     type = front.type;
+    // If this front was filled via Pull, its dense storage is a view into
+    // the tree's arena; release it so that the copy can own its buffer
+    if( LDense.Viewing() )
+        LDense.Empty();
+    SwapClear( arena );
     LDense = front.LDense;
     LSparse = front.LSparse;
     diag = front.diag;
@@ -533,6 +647,9 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
     p = front.p;
     workDense = front.workDense;
     workSparse = front.workSparse;
+    offDiagRank = front.offDiagRank;
+    UOffDiag = front.UOffDiag;
+    VOffDiag = front.VOffDiag;
     // Do not copy parent...
 
     // Delete any existing children
@@ -550,7 +667,14 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
 
 template<typename Field>
 Int Front<Field>::Height() const
-{ return sparseLeaf ? LDense.Height()+LDense.Width() : LDense.Height(); }
+{
+    if( sparseLeaf )
+        return LDense.Height()+LDense.Width();
+    else if( offDiagRank >= 0 )
+        return LDense.Height()+UOffDiag.Height();
+    else
+        return LDense.Height();
+}
 
 template<typename Field>
 Int Front<Field>::NumEntries() const
@@ -585,6 +709,9 @@ Int Front<Field>::NumEntries() const
         {
             // Add in L
             numEntries += front.LDense.Height() * front.LDense.Width();
+            // Add in any compressed off-diagonal outer product
+            numEntries += front.UOffDiag.Height()*front.UOffDiag.Width() +
+                          front.VOffDiag.Height()*front.VOffDiag.Width();
         }
         // Add in the workspace for the Schur complement
         numEntries += front.workDense.Height()*front.workDense.Width();
@@ -644,6 +771,11 @@ Int Front<Field>::NumBottomLeftEntries() const
         {
             numEntries += m*n;
         }
+        else if( front.offDiagRank >= 0 )
+        {
+            numEntries += front.UOffDiag.Height()*front.UOffDiag.Width() +
+                          front.VOffDiag.Height()*front.VOffDiag.Width();
+        }
         else
         {
             numEntries += (m-n)*n;
@@ -51,6 +51,8 @@ void FrontLowerBackwardMultiply
     auto type = front.type;
     if( Unfactored(type) )
         LogicError("Cannot multiply against an unfactored matrix");
+    if( front.offDiagRank >= 0 )
+        LogicError("Compressed fronts not supported in multiplication");
 
     if( front.sparseLeaf )
     {
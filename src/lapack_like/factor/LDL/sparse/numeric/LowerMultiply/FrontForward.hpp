@@ -49,6 +49,8 @@ void FrontLowerForwardMultiply( const Front<F>& front, Matrix<F>& W )
         LogicError("Cannot multiply against an unfactored front");
     if( BlockFactorization(front.type) || PivotedFactorization(front.type) )
         LogicError("Blocked and pivoted factorizations not supported");
+    if( front.offDiagRank >= 0 )
+        LogicError("Compressed fronts not supported in multiplication");
     if( front.sparseLeaf )
     {
         LogicError("Sparse leaves not supported in FrontLowerForwardMultiply");
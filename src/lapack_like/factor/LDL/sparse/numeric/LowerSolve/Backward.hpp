@@ -25,14 +25,29 @@
 namespace El {
 namespace ldl {
 
-template<typename F> 
+template<typename F>
 inline void LowerBackwardSolve
-( const NodeInfo& info, 
+( const NodeInfo& info,
   const Front<F>& front,
-        MatrixNode<F>& X, bool conjugate )
+        MatrixNode<F>& X, bool conjugate,
+        bool applyDiagonal=false,
+        bool topLevel=true )
 {
     EL_DEBUG_CSE
 
+    const Int numChildren = front.children.size();
+    if( topLevel && numChildren > 0 )
+    {
+        // As in the forward solve, the subtree solves are independent once
+        // this node's portion has been distributed, so establish a thread
+        // team here and let the recursion spawn OpenMP tasks
+        EL_TASK_REGION
+        {
+            LowerBackwardSolve( info, front, X, conjugate, applyDiagonal, false );
+        }
+        return;
+    }
+
     auto* dupMV = X.duplicateMV;
     auto* dupMat = X.duplicateMat;
     const bool haveParent = X.parent != nullptr;
@@ -45,13 +60,25 @@ inline void LowerBackwardSolve
                                      : (haveDupMatParent ? dupMat->work.Matrix()
                                                          : X.matrix)));
 
+    if( applyDiagonal )
+    {
+        // The top of the workspace still holds this node's portion of the
+        // forward solution, so the diagonal solve can be folded in here and
+        // a separate traversal of the tree avoided
+        auto WT = W( IR(0,info.size), ALL );
+        if( PivotedFactorization(front.type) )
+            QuasiDiagonalSolve
+            ( LEFT, LOWER, front.diag, front.subdiag, WT, front.isHermitian );
+        else
+            DiagonalSolve( LEFT, NORMAL, front.diag, WT, true );
+    }
+
     FrontLowerBackwardSolve( front, W, conjugate );
 
     const Int numRHS = X.matrix.Width();
     if( haveParent || haveDupMVParent || haveDupMatParent )
         X.matrix = W( IR(0,info.size), IR(0,numRHS) );
 
-    const Int numChildren = front.children.size();
     for( Int c=0; c<numChildren; ++c )
     {
         // Set up a workspace for the child
@@ -79,8 +106,15 @@ inline void LowerBackwardSolve
         dupMat->work.Empty();
 
     for( Int c=0; c<numChildren; ++c )
+    {
+#if defined(EL_HYBRID) && defined(EL_HAVE_OMP_TASK)
+        #pragma omp task default(shared) firstprivate(c)
+#endif
         LowerBackwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c], conjugate );
+        ( *info.children[c], *front.children[c], *X.children[c], conjugate,
+          applyDiagonal, false );
+    }
+    EL_TASKWAIT
 }
 
 template<typename F>
@@ -25,18 +25,37 @@
 namespace El {
 namespace ldl {
 
-template<typename F> 
+template<typename F>
 void LowerForwardSolve
-( const NodeInfo& info, 
+( const NodeInfo& info,
   const Front<F>& front,
-        MatrixNode<F>& X )
+        MatrixNode<F>& X,
+        bool topLevel=true )
 {
     EL_DEBUG_CSE
 
     const Int numChildren = info.children.size();
+    if( topLevel && numChildren > 0 )
+    {
+        // The subtree solves are independent, so establish a thread team at
+        // the root of the traversal and hand the subtrees to the OpenMP task
+        // scheduler (without task support this is the usual post-ordering)
+        EL_TASK_REGION
+        {
+            LowerForwardSolve( info, front, X, false );
+        }
+        return;
+    }
+
     for( Int c=0; c<numChildren; ++c )
+    {
+#if defined(EL_HYBRID) && defined(EL_HAVE_OMP_TASK)
+        #pragma omp task default(shared) firstprivate(c)
+#endif
         LowerForwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c] );
+        ( *info.children[c], *front.children[c], *X.children[c], false );
+    }
+    EL_TASKWAIT
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
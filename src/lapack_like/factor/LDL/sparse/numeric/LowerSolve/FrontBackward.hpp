@@ -100,8 +100,18 @@ void FrontVanillaLowerBackwardSolve
     auto XB = X( IR(n,END), ALL );
 
     const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
-    Gemm( orientation, NORMAL, F(-1), LB, XB, F(1), XT );
-    Trsm( LEFT, LOWER, orientation, UNIT, F(1), LT, XT, true );
+    if( X.Width() == 1 )
+    {
+        // A single right-hand side is latency-bound, so bypass the blocked
+        // Trsm/Gemm machinery in favor of the level-2 kernels
+        Gemv( orientation, F(-1), LB, XB, F(1), XT );
+        Trsv( LOWER, orientation, UNIT, LT, XT );
+    }
+    else
+    {
+        Gemm( orientation, NORMAL, F(-1), LB, XB, F(1), XT );
+        Trsm( LEFT, LOWER, orientation, UNIT, F(1), LT, XT, true );
+    }
 }
 
 template<typename F>
@@ -684,6 +694,34 @@ void FrontLowerBackwardSolve
         ( onLeft, WT.Height(), WT.Width(), WT.Buffer(), WT.LDim(), 
           LOffsetBuf, LColBuf, LValBuf );
     }
+    else if( front.offDiagRank >= 0 )
+    {
+        // The bottom-left block is stored as the truncated outer product
+        // LB ~= UOffDiag VOffDiag^H and LDense holds only the top-left block
+        const Int n = front.LDense.Width();
+        auto WT = W( IR(0,n),   ALL );
+        auto WB = W( IR(n,END), ALL );
+
+        Matrix<F> Z;
+        if( conjugate )
+        {
+            // WT -= LB^H WB = VOffDiag (UOffDiag^H WB)
+            Gemm( ADJOINT, NORMAL, F(1), front.UOffDiag, WB, Z );
+            Gemm( NORMAL, NORMAL, F(-1), front.VOffDiag, Z, F(1), WT );
+        }
+        else
+        {
+            // WT -= LB^T WB = conj(VOffDiag) (UOffDiag^T WB)
+            Gemm( TRANSPOSE, NORMAL, F(1), front.UOffDiag, WB, Z );
+            Conjugate( Z );
+            Matrix<F> Y;
+            Gemm( NORMAL, NORMAL, F(1), front.VOffDiag, Z, Y );
+            Conjugate( Y );
+            Axpy( F(-1), Y, WT );
+        }
+        const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+        Trsm( LEFT, LOWER, orientation, UNIT, F(1), front.LDense, WT, true );
+    }
     else
     {
         if( BlockFactorization(type) )
@@ -43,8 +43,18 @@ void FrontVanillaLowerForwardSolve
     auto XT = X( IR(0,n),   ALL );
     auto XB = X( IR(n,END), ALL );
 
-    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), LT, XT );
-    Gemm( NORMAL, NORMAL, F(-1), LB, XT, F(1), XB );
+    if( X.Width() == 1 )
+    {
+        // A single right-hand side is latency-bound, so bypass the blocked
+        // Trsm/Gemm machinery in favor of the level-2 kernels
+        Trsv( LOWER, NORMAL, UNIT, LT, XT );
+        Gemv( NORMAL, F(-1), LB, XT, F(1), XB );
+    }
+    else
+    {
+        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), LT, XT );
+        Gemm( NORMAL, NORMAL, F(-1), LB, XT, F(1), XB );
+    }
 }
 
 template<typename F>
@@ -113,6 +123,19 @@ void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
 
         Gemm( NORMAL, NORMAL, F(-1), front.LDense, WT, F(1), WB );
     }
+    else if( front.offDiagRank >= 0 )
+    {
+        // The bottom-left block is stored as the truncated outer product
+        // UOffDiag VOffDiag^H and LDense holds only the top-left block
+        const Int n = front.LDense.Width();
+        auto WT = W( IR(0,n),   ALL );
+        auto WB = W( IR(n,END), ALL );
+
+        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), front.LDense, WT );
+        Matrix<F> Z;
+        Gemm( ADJOINT, NORMAL, F(1), front.VOffDiag, WT, Z );
+        Gemm( NORMAL, NORMAL, F(-1), front.UOffDiag, Z, F(1), WB );
+    }
     else
     {
         if( BlockFactorization(type) )
@@ -36,6 +36,12 @@ void ProcessFrontVanilla( Matrix<F>& AL, Matrix<F>& ABR, bool conjugate )
       if( AL.Height() != AL.Width() + ABR.Width() )
           LogicError("AL and ABR don't have conformal dimensions");
     )
+#ifdef EL_HAVE_CUDA
+    // Real fronts above the offload threshold may be processed via cuBLAS
+    // (conjugation is irrelevant for the real types which are supported)
+    if( gpu::TryProcessFrontVanilla( AL, ABR ) )
+        return;
+#endif
     const Int n = AL.Width();
     const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
 
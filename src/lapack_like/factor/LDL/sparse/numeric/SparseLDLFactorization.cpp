@@ -46,6 +46,7 @@ void SparseLDLFactorization<Field>::Initialize
   const BisectCtrl& bisectCtrl )
 {
     EL_DEBUG_CSE
+    MemoryTagScope memScope( MEM_TAG_SPARSE_FACTOR );
     info_.reset( new ldl::NodeInfo );
     separator_.reset( new ldl::Separator );
     ldl::NestedDissection
@@ -110,7 +111,8 @@ void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     // is sometimes useful to directly manipulate the fronts.
     if( !Unfactored(front_->type) )
         LogicError("Fronts are already marked as factored");
-    
+    MemoryTagScope memScope( MEM_TAG_SPARSE_FACTOR );
+
     // Convert from 1D to 2D if necessary
     ChangeFrontType( SYMM_2D );
     
@@ -122,6 +124,20 @@ void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( frontType );
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::Refactor
+( const SparseMatrix<Field>& ANew, LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Refactor()'");
+    // Reuse the reordering, separator and elimination trees, and front
+    // structures: pulling in the new values resets the fronts to an
+    // unfactored state, after which only the numeric processing remains
+    ChangeNonzeroValues( ANew );
+    Factor( frontType );
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::ChangeFrontType( LDLFrontType frontType )
 {
@@ -131,6 +147,19 @@ void SparseLDLFactorization<Field>::ChangeFrontType( LDLFrontType frontType )
     ldl::ChangeFrontType( *front_, frontType );
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::CompressFronts( const Base<Field>& relTol )
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before CompressFronts()");
+    if( BlockFactorization(front_->type) ||
+        PivotedFactorization(front_->type) ||
+        SelInvFactorization(front_->type) )
+        LogicError("Compression requires a vanilla LDL factorization");
+    front_->CompressOffDiagonals( relTol );
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::ChangeNonzeroValues
 ( const SparseMatrix<Field>& ANew )
@@ -169,13 +198,13 @@ void SparseLDLFactorization<Field>::Solve( ldl::MatrixNode<Field>& B ) const
         SolveAgainstL( orientation, B );
     }
     else
-    {   
-        // Solve against unit diagonal L 
+    {
+        // Solve against unit diagonal L
         SolveAgainstL( NORMAL, B );
-        // Solve against diagonal
-        SolveAgainstD( NORMAL, B );
-        // Solve against the (conjugate-)transpose of the unit diagonal L
-        SolveAgainstL( orientation, B );
+        // Solve against the (conjugate-)transpose of the unit diagonal L,
+        // folding the diagonal solve into the backward traversal
+        ldl::LowerBackwardSolve
+        ( *info_, *front_, B, orientation==ADJOINT, true );
     }
 }
 
@@ -213,7 +213,7 @@ inline void ComputeStructAndRelInds
     )
 }
 
-Int Analysis( NodeInfo& node, Int myOff )
+Int Analysis( NodeInfo& node, Int myOff, double amalgFillFraction )
 {
     EL_DEBUG_CSE
 
@@ -224,7 +224,7 @@ Int Analysis( NodeInfo& node, Int myOff )
     {
         if( node.children[c] == nullptr )
             LogicError("Node child ",c," was nullptr");
-        myOff = Analysis( *node.children[c], myOff );
+        myOff = Analysis( *node.children[c], myOff, amalgFillFraction );
     }
 
     EL_DEBUG_ONLY(
@@ -239,46 +239,114 @@ Int Analysis( NodeInfo& node, Int myOff )
 
     if( numChildren > 0 )
     {
-        // Union the structures of the children with the original structure
-        auto fullStruct = node.origLowerStruct;
-        for( const auto& child : node.children )
+        auto computeStruct = [&node]()
         {
-            EL_DEBUG_ONLY(
-                if( !IsStrictlySorted(child->lowerStruct) )
+            // Union the structures of the children with the original structure
+            auto fullStruct = node.origLowerStruct;
+            for( const auto& child : node.children )
+            {
+                EL_DEBUG_ONLY(
+                    if( !IsStrictlySorted(child->lowerStruct) )
+                    {
+                        if( IsSorted(child->lowerStruct) )
+                            LogicError("Repeat in child lower struct");
+                        else
+                            LogicError("Child lower struct not sorted");
+                    }
+                )
+
+                // Combine the structures of the children
+                fullStruct = Union( fullStruct, child->lowerStruct );
+            }
+
+            // Now add in the node indices
+            vector<Int> nodeInds( node.size );
+            for( Int i=0; i<node.size; ++i )
+                nodeInds[i] = node.off+ i;
+            fullStruct = Union( fullStruct, nodeInds );
+
+            // Construct the relative indices of the original lower structure
+            node.origLowerRelInds =
+              RelativeIndices( node.origLowerStruct, fullStruct );
+
+            // Construct the relative indices of the children
+            const Int numActiveChildren = node.children.size();
+            node.childRelInds.resize( numActiveChildren );
+            for( Int c=0; c<numActiveChildren; ++c )
+                node.childRelInds[c] =
+                    RelativeIndices( node.children[c]->lowerStruct, fullStruct );
+
+            // Form lower struct of this node by removing node indices
+            // (which take up the first node.size indices of fullStruct)
+            const Int lowerStructSize = fullStruct.size()-node.size;
+            node.lowerStruct.resize( lowerStructSize );
+            for( Int i=0; i<lowerStructSize; ++i )
+                node.lowerStruct[i] = fullStruct[node.size+i];
+        };
+        computeStruct();
+
+        // Relaxed supernode amalgamation: absorb the child whose index range
+        // is adjacent to ours whenever the (exact) fill introduced by merging
+        // the two fronts is a sufficiently small fraction of the merged front.
+        // A node mirrored by a distributed duplicate must keep its shape, and
+        // a node must retain at least one child since childless fronts are
+        // processed with the sparse leaf data computed during dissection.
+        if( amalgFillFraction > 0 && node.duplicate == nullptr )
+        {
+            bool merged = true;
+            while( merged && node.children.size() > 1 )
+            {
+                merged = false;
+                const Int numActiveChildren = node.children.size();
+                for( Int c=0; c<numActiveChildren; ++c )
                 {
-                    if( IsSorted(child->lowerStruct) )
-                        LogicError("Repeat in child lower struct");
-                    else
-                        LogicError("Child lower struct not sorted");
+                    auto& child = *node.children[c];
+                    if( child.off + child.size != node.off )
+                        continue;
+
+                    // Since the child's lower structure (restricted to the
+                    // indices above our diagonal block) is contained in ours,
+                    // the merged front inherits our lower structure
+                    const double szC = child.size;
+                    const double szP = node.size;
+                    const double szM = szC + szP;
+                    const double structC = child.lowerStruct.size();
+                    const double structP = node.lowerStruct.size();
+                    const double mergedEntries =
+                      (szM*(szM+1))/2 + szM*structP;
+                    const double fill =
+                      mergedEntries -
+                      ( (szC*(szC+1))/2 + szC*structC +
+                        (szP*(szP+1))/2 + szP*structP );
+                    if( fill > amalgFillFraction*mergedEntries )
+                        break;
+
+                    // Absorb the child into this node
+                    node.off = child.off;
+                    node.size += child.size;
+                    auto mergedOrig =
+                      Union( node.origLowerStruct, child.origLowerStruct );
+                    const Int blockEnd = node.off + node.size;
+                    node.origLowerStruct.clear();
+                    for( const Int& i : mergedOrig )
+                        if( i >= blockEnd )
+                            node.origLowerStruct.push_back( i );
+
+                    // Adopt the grandchildren
+                    auto grandchildren = std::move( child.children );
+                    node.children.erase( node.children.begin()+c );
+                    for( auto& grandchild : grandchildren )
+                    {
+                        grandchild->parent = &node;
+                        node.children.push_back( std::move(grandchild) );
+                    }
+
+                    computeStruct();
+                    merged = true;
+                    break;
                 }
-            )
-
-            // Combine the structures of the children
-            fullStruct = Union( fullStruct, child->lowerStruct );
+            }
         }
-
-        // Now add in the node indices
-        vector<Int> nodeInds( node.size );
-        for( Int i=0; i<node.size; ++i )
-            nodeInds[i] = node.off+ i;
-        fullStruct = Union( fullStruct, nodeInds );
-
-        // Construct the relative indices of the original lower structure
-        node.origLowerRelInds =
-          RelativeIndices( node.origLowerStruct, fullStruct );
-
-        // Construct the relative indices of the children
-        node.childRelInds.resize( numChildren );
-        for( Int c=0; c<numChildren; ++c )
-            node.childRelInds[c] =
-                RelativeIndices( node.children[c]->lowerStruct, fullStruct );
-
-        // Form lower struct of this node by removing node indices
-        // (which take up the first node.size indices of fullStruct)
-        const Int lowerStructSize = fullStruct.size()-node.size;
-        node.lowerStruct.resize( lowerStructSize );
-        for( Int i=0; i<lowerStructSize; ++i )
-            node.lowerStruct[i] = fullStruct[node.size+i];
     }
     else
     {
@@ -300,14 +368,15 @@ Int Analysis( NodeInfo& node, Int myOff )
 // tree is binary.
 //
 
-void Analysis( DistNodeInfo& node, bool computeFactRecvInds )
+void Analysis
+( DistNodeInfo& node, bool computeFactRecvInds, double amalgFillFraction )
 {
     EL_DEBUG_CSE
     if( node.duplicate != nullptr )
     {
         Int myOff = 0;
         auto& dupNode = *node.duplicate;
-        Analysis( dupNode, myOff );
+        Analysis( dupNode, myOff, amalgFillFraction );
 
         // The bottom node was analyzed locally, so just copy its results over
         node.myOff = dupNode.myOff;
@@ -326,7 +395,7 @@ void Analysis( DistNodeInfo& node, bool computeFactRecvInds )
     if( node.child == nullptr )
         LogicError("Node child was nullptr");
     auto& childNode = *node.child;
-    Analysis( childNode, computeFactRecvInds );
+    Analysis( childNode, computeFactRecvInds, amalgFillFraction );
 
     node.myOff = childNode.myOff + childNode.size;
 
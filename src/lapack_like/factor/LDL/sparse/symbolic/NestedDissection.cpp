@@ -242,20 +242,26 @@ NestedDissectionRecursion
 
         sep.children.reserve( 2 );
         info.children.reserve( 2 );
-
         sep.children.emplace_back( new Separator(&sep) );
         info.children.emplace_back( new NodeInfo(&info) );
-        NestedDissectionRecursion
-        ( leftChild, leftPerm,
-          *sep.children.back(), *info.children.back(),
-          off, ctrl );
-
         sep.children.emplace_back( new Separator(&sep) );
         info.children.emplace_back( new NodeInfo(&info) );
+
+        // The two subtrees are independent, so dissect the left child in a
+        // task while this thread continues with the right child (the tasks
+        // degrade to an in-order traversal without OpenMP task support)
+        EL_TASK
+        {
+            NestedDissectionRecursion
+            ( leftChild, leftPerm,
+              *sep.children[0], *info.children[0],
+              off, ctrl );
+        }
         NestedDissectionRecursion
         ( rightChild, rightPerm,
-          *sep.children.back(), *info.children.back(),
+          *sep.children[1], *info.children[1],
           off+leftChildSize, ctrl );
+        EL_TASKWAIT
     }
 }
 
@@ -375,8 +381,12 @@ NestedDissectionRecursion
 
         sep.duplicate.reset( new Separator(&sep) );
         info.duplicate.reset( new NodeInfo(&info) );
-        NestedDissectionRecursion
-        ( seqGraph, perm.Map(), *sep.duplicate, *info.duplicate, off, ctrl );
+        EL_TASK_REGION
+        {
+            NestedDissectionRecursion
+            ( seqGraph, perm.Map(), *sep.duplicate, *info.duplicate,
+              off, ctrl );
+        }
 
         // Pull information up from the duplicates
         sep.off = sep.duplicate->off;
@@ -401,14 +411,19 @@ void NestedDissection
     for( Int s=0; s<numSources; ++s )
         perm[s] = s;
 
-    NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+    // Spawn the recursive dissection tasks from a single thread; the
+    // independent subtrees are then stolen by the idle threads in the team
+    EL_TASK_REGION
+    {
+        NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+    }
 
     // Construct the distributed reordering
     sep.BuildMap( map );
     EL_DEBUG_ONLY(EnsurePermutation(map))
 
     // Run the symbolic analysis
-    Analysis( info );
+    Analysis( info, 0, ctrl.amalgFillFraction );
 }
 
 void NestedDissection
@@ -434,7 +449,7 @@ void NestedDissection
     EL_DEBUG_ONLY(EnsurePermutation(map))
 
     // Run the symbolic analysis
-    Analysis( info, ctrl.storeFactRecvInds );
+    Analysis( info, ctrl.storeFactRecvInds, ctrl.amalgFillFraction );
 }
 
 } // namespace ldl
@@ -10,22 +10,68 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Lookahead.hpp"
+#include "./LU/Tournament.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
 
+namespace {
+
+template<typename F>
+struct LULookaheadDepthHelper { static El::Int value; };
+template<typename F>
+El::Int LULookaheadDepthHelper<F>::value = 1;
+
+template<typename F>
+struct LUTournamentHelper { static bool value; };
+template<typename F>
+bool LUTournamentHelper<F>::value = false;
+
+}
+
 namespace El {
 
+template<typename F>
+void SetLULookaheadDepth( Int depth )
+{ ::LULookaheadDepthHelper<F>::value = depth; }
+
+template<typename F>
+Int LULookaheadDepth()
+{ return ::LULookaheadDepthHelper<F>::value; }
+
+template<typename F>
+void SetLUTournamentPivoting( bool useTournament )
+{ ::LUTournamentHelper<F>::value = useTournament; }
+
+template<typename F>
+bool LUTournamentPivoting()
+{ return ::LUTournamentHelper<F>::value; }
+
 // Performs LU factorization without pivoting
 
+namespace lu {
+
+// Matrices this small (e.g., the leaves of a frontal tree) are factored by
+// lu::Small, which skips the blocked algorithm's blocksize lookup, subview
+// construction, and nested level-3 calls
+const Int unblockedCutoff = 64;
+
+} // namespace lu
+
 template<typename F>
 void LU( Matrix<F>& A )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
+    if( m <= lu::unblockedCutoff && n <= lu::unblockedCutoff )
+    {
+        lu::Small( A );
+        return;
+    }
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = AlgorithmicBlocksize<F>( "LU", minDim );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -60,7 +106,7 @@ void LU( AbstractDistMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = AlgorithmicBlocksize<F>( "LU", minDim );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -109,7 +155,7 @@ void LU( Matrix<F>& A, Permutation& P )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = AlgorithmicBlocksize<F>( "LU", minDim );
 
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
@@ -173,10 +219,16 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
 
+    if( LULookaheadDepth<F>() > 0 )
+    {
+        lu::PanelPivLookahead( A, P );
+        return;
+    }
+
     DistPermutation PB(g);
 
     vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    const Int bsize = AlgorithmicBlocksize<F>( "LU", minDim );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -199,9 +251,22 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
         ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
         A11_STAR_STAR = A11;
         A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
-
-        PB.PermuteRows( AB );
+        if( LUTournamentPivoting<F>() )
+        {
+            // Elect all of the panel pivots up front, exchange the rows of
+            // the trailing submatrix in one batch, and then refactor the
+            // (permuted) panel without any further communication
+            lu::PanelTournament( A11_STAR_STAR, A21_MC_STAR, P, PB, k );
+            PB.PermuteRows( AB );
+            A11_STAR_STAR = A11;
+            A21_MC_STAR = A21;
+            lu::PanelNoPiv( A11_STAR_STAR, A21_MC_STAR );
+        }
+        else
+        {
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+            PB.PermuteRows( AB );
+        }
 
         // Perhaps we should give up perfectly distributing this operation since
         // it's total contribution is only O(n^2)
@@ -231,6 +296,10 @@ void LU
 }
 
 #define PROTO(F) \
+  template void SetLULookaheadDepth<F>( Int depth ); \
+  template Int LULookaheadDepth<F>(); \
+  template void SetLUTournamentPivoting<F>( bool useTournament ); \
+  template bool LUTournamentPivoting<F>(); \
   template void LU( Matrix<F>& A ); \
   template void LU( AbstractDistMatrix<F>& A ); \
   template void LU( DistMatrix<F,STAR,STAR>& A ); \
@@ -60,6 +60,54 @@ Unb( Matrix<F>& A )
     }
 }
 
+// A fully-unrolled analogue of Unb for compile-time (tiny) square sizes,
+// meant to be reached through a runtime size switch
+template<Int n,typename F>
+inline void
+UnbFixed( Matrix<F>& A )
+{
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        const F alpha = ABuf[j+j*ALDim];
+        if( alpha == F(0) )
+            throw SingularMatrixException();
+
+        const F alphaInv = F(1)/alpha;
+        for( Int i=j+1; i<n; ++i )
+            ABuf[i+j*ALDim] *= alphaInv;
+        for( Int k=j+1; k<n; ++k )
+        {
+            const F gamma12 = ABuf[j+k*ALDim];
+            for( Int i=j+1; i<n; ++i )
+                ABuf[i+k*ALDim] -= ABuf[i+j*ALDim]*gamma12;
+        }
+    }
+}
+
+// Factor a matrix small enough (e.g., a frontal-tree leaf) that the blocked
+// algorithm's dispatch overhead would dominate the arithmetic
+template<typename F>
+inline void
+Small( Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() == A.Width() )
+    {
+        switch( A.Height() )
+        {
+        case 0: return;
+        case 1: UnbFixed<1>( A ); return;
+        case 2: UnbFixed<2>( A ); return;
+        case 3: UnbFixed<3>( A ); return;
+        case 4: UnbFixed<4>( A ); return;
+        default: break;
+        }
+    }
+    Unb( A );
+}
+
 } // namespace lu
 } // namespace El
 
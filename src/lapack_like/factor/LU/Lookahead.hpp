@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_LOOKAHEAD_HPP
+#define EL_LU_LOOKAHEAD_HPP
+
+namespace El {
+namespace lu {
+
+// A pipelined variant of the right-looking partially-pivoted factorization:
+// rather than factoring panel k+1 only after the entire rank-nb update of
+// panel k, the update is split so that only the next panel's block column is
+// updated before panel k+1 is immediately factored, and the (dominant) wide
+// remainder of the trailing update follows. The latency-bound panel
+// factorization is thereby scheduled alongside the compute-bound update
+// instead of being serialized after it, which is the standard HPL-style
+// depth-one lookahead. The reordering is exact: panel k+1 only reads its own
+// (already updated) block column, and its row swaps are deferred -- as in
+// the synchronous algorithm -- until the top of the next iteration, after
+// the wide update it logically follows has been applied.
+
+template<typename F>
+void PanelPivLookahead( DistMatrix<F>& A, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), A11Next_STAR_STAR(g);
+    DistMatrix<F,MC,  STAR> A21_MC_STAR(g), A21Next_MC_STAR(g);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+        return;
+    const Int bsize = AlgorithmicBlocksize<F>( "LU", minDim );
+
+    DistPermutation PB(g), PBNext(g);
+    vector<F> panelBuf, panelBufNext, pivotBuf;
+
+    // Prime the pipeline by factoring the first panel
+    {
+        const Int nb = Min(bsize,minDim);
+        auto A11 = A( IR(0,nb), IR(0,nb) );
+        auto A21 = A( IR(nb,END), IR(0,nb) );
+        const Int panelLDim = nb+A21.LocalHeight();
+        FastResize( panelBuf, panelLDim*nb );
+        A11_STAR_STAR.Attach
+        ( nb, nb, g, 0, 0, &panelBuf[0], panelLDim, 0 );
+        A21_MC_STAR.Attach
+        ( A21.Height(), nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
+        A11_STAR_STAR = A11;
+        A21_MC_STAR = A21;
+        Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, 0, pivotBuf );
+    }
+
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const IR ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        auto AB  = A( indB, ALL );
+
+        // Apply the current panel's (already computed) pivots and write the
+        // factored panel back
+        PB.PermuteRows( AB );
+        A11 = A11_STAR_STAR;
+        A21 = A21_MC_STAR;
+
+        // Perhaps we should give up perfectly distributing this operation since
+        // it's total contribution is only O(n^2)
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        A12_STAR_MR.AlignWith( A22 );
+        A12_STAR_MR = A12_STAR_VR;
+        A12 = A12_STAR_MR;
+
+        const Int kNext = k+nb;
+        if( kNext < minDim )
+        {
+            const Int nbNext = Min(bsize,minDim-kNext);
+            const IR indNext( kNext, kNext+nbNext ),
+                     indBehind( kNext+nbNext, END );
+
+            // Update only the next panel's block column
+            auto A22L = A( ind2, indNext );
+            auto A12L_STAR_MR = A12_STAR_MR( ALL, IR(0,nbNext) );
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12L_STAR_MR, F(1), A22L );
+
+            // Factor the next panel ahead of the wide update
+            auto A11N = A( indNext, indNext );
+            auto A21N = A( indBehind, indNext );
+            const Int panelNextLDim = nbNext+A21N.LocalHeight();
+            FastResize( panelBufNext, panelNextLDim*nbNext );
+            A11Next_STAR_STAR.Attach
+            ( nbNext, nbNext, g, 0, 0, &panelBufNext[0], panelNextLDim, 0 );
+            A21Next_MC_STAR.Attach
+            ( A21N.Height(), nbNext, g, A21N.ColAlign(), 0,
+              &panelBufNext[nbNext], panelNextLDim, 0 );
+            A11Next_STAR_STAR = A11N;
+            A21Next_MC_STAR = A21N;
+            Panel
+            ( A11Next_STAR_STAR, A21Next_MC_STAR, P, PBNext, kNext, pivotBuf );
+
+            // The wide remainder of the trailing update
+            auto A22R = A( ind2, indBehind );
+            auto A12R_STAR_MR = A12_STAR_MR( ALL, IR(nbNext,END) );
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12R_STAR_MR, F(1), A22R );
+
+            // Advance the pipeline: the freshly factored panel becomes the
+            // current one (the buffer swap preserves the attached views'
+            // memory, but the current panel must view the swapped storage)
+            panelBuf.swap( panelBufNext );
+            A11_STAR_STAR.Attach
+            ( nbNext, nbNext, g, 0, 0, &panelBuf[0], panelNextLDim, 0 );
+            A21_MC_STAR.Attach
+            ( A21N.Height(), nbNext, g, A21N.ColAlign(), 0,
+              &panelBuf[nbNext], panelNextLDim, 0 );
+            PB = PBNext;
+        }
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_LOOKAHEAD_HPP
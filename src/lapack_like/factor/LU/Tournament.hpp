@@ -0,0 +1,262 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+namespace El {
+namespace lu {
+
+namespace tournament {
+
+// Run partial-pivoting Gaussian elimination on the candidate block C,
+// reordering 'srcRows' alongside the row swaps so that the leading
+// Min(C.Height(),C.Width()) entries of 'srcRows' name the winning rows of
+// the original candidate block. C is overwritten.
+template<typename F>
+void SelectRows( Matrix<F>& C, vector<Int>& srcRows )
+{
+    EL_DEBUG_CSE
+    const Int height = C.Height();
+    const Int width = C.Width();
+    const Int numSteps = Min( height, width );
+    F* CBuf = C.Buffer();
+    const Int CLDim = C.LDim();
+    for( Int k=0; k<numSteps; ++k )
+    {
+        const Int maxInd = blas::MaxInd( height-k, &CBuf[k+k*CLDim], 1 ) + k;
+        if( maxInd != k )
+        {
+            blas::Swap( width, &CBuf[k], CLDim, &CBuf[maxInd], CLDim );
+            std::swap( srcRows[k], srcRows[maxInd] );
+        }
+        const F alpha = CBuf[k+k*CLDim];
+        if( alpha == F(0) )
+            break; // The remaining candidates are numerically irrelevant
+        const F alphaInv = F(1) / alpha;
+        blas::Scal( height-(k+1), alphaInv, &CBuf[(k+1)+k*CLDim], 1 );
+        blas::Geru
+        ( height-(k+1), width-(k+1),
+          F(-1), &CBuf[(k+1)+k*CLDim],     1,
+                 &CBuf[k+(k+1)*CLDim],     CLDim,
+                 &CBuf[(k+1)+(k+1)*CLDim], CLDim );
+    }
+}
+
+} // namespace tournament
+
+// Select the panel pivots of the stacked panel [A; B] through tournament
+// pivoting [CITATION]: each process row elects up to n local candidate rows
+// through partial-pivoting elimination, the survivors are merged up a
+// binomial tree over the process column (each round shipping only the
+// original rows of the current survivors), and the final pivot indices are
+// broadcast from the root. The pivots are recorded in P and PB but
+// deliberately *not* applied, so that the caller may apply PB to the full
+// trailing submatrix as a single batched row exchange. Only O(log p)
+// messages are required per panel, compared with the O(n) reductions and
+// broadcasts of lu::Panel, at the price of the weaker (but provably stable)
+// threshold-style growth guarantees of communication-avoiding LU.
+template<typename F>
+void PanelTournament
+( const DistMatrix<F,STAR,STAR>& A,
+  const DistMatrix<F,MC,STAR>& B,
+        DistPermutation& P,
+        DistPermutation& PB,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    const F* ABuf = A.LockedBuffer();
+    const F* BBuf = B.LockedBuffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    mpi::Comm colComm = B.ColComm();
+    const int colRank = mpi::Rank( colComm );
+    const int colSize = mpi::Size( colComm );
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+      if( A.Height() != n )
+          LogicError("The replicated panel block must be square");
+    )
+
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+
+    // Assemble the local candidate rows; the replicated top block is
+    // credited to the root so that it enters the tournament exactly once
+    const Int topSize = ( colRank==0 ? n : 0 );
+    const Int numLocal = BLocHeight + topSize;
+    Matrix<F> C( numLocal, n );
+    for( Int i=0; i<topSize; ++i )
+        for( Int j=0; j<n; ++j )
+            C(i,j) = ABuf[i+j*ALDim];
+    for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+        for( Int j=0; j<n; ++j )
+            C(topSize+iLoc,j) = BBuf[iLoc+j*BLDim];
+
+    // Elect the local survivors, keeping their original rows for the merges
+    vector<Int> srcRows( numLocal );
+    for( Int i=0; i<numLocal; ++i )
+        srcRows[i] = i;
+    Matrix<F> CElim( C );
+    tournament::SelectRows( CElim, srcRows );
+    Int numSel = Min( numLocal, n );
+    Matrix<F> W( numSel, n );
+    vector<Int> widx( numSel );
+    for( Int i=0; i<numSel; ++i )
+    {
+        const Int src = srcRows[i];
+        widx[i] = ( src < topSize ? src : n + B.GlobalRow(src-topSize) );
+        for( Int j=0; j<n; ++j )
+            W(i,j) = C(src,j);
+    }
+
+    // Merge the survivors up a binomial tree over the process column
+    Int mask = 1;
+    while( mask < colSize )
+    {
+        if( colRank & mask )
+        {
+            const int partner = colRank - mask;
+            mpi::Send( numSel, partner, colComm );
+            if( numSel > 0 )
+            {
+                mpi::Send( widx.data(), numSel, partner, colComm );
+                mpi::Send( W.Buffer(), numSel*n, partner, colComm );
+            }
+            break;
+        }
+        else if( colRank + mask < colSize )
+        {
+            const int partner = colRank + mask;
+            const Int numRecv = mpi::Recv<Int>( partner, colComm );
+            if( numRecv > 0 )
+            {
+                const Int numStacked = numSel + numRecv;
+                Matrix<F> WStacked( numStacked, n );
+                vector<Int> idxStacked( numStacked );
+                for( Int i=0; i<numSel; ++i )
+                {
+                    idxStacked[i] = widx[i];
+                    for( Int j=0; j<n; ++j )
+                        WStacked(i,j) = W(i,j);
+                }
+                vector<Int> idxRecv( numRecv );
+                Matrix<F> WRecv( numRecv, n );
+                mpi::Recv( idxRecv.data(), numRecv, partner, colComm );
+                mpi::Recv( WRecv.Buffer(), numRecv*n, partner, colComm );
+                for( Int i=0; i<numRecv; ++i )
+                {
+                    idxStacked[numSel+i] = idxRecv[i];
+                    for( Int j=0; j<n; ++j )
+                        WStacked(numSel+i,j) = WRecv(i,j);
+                }
+
+                vector<Int> srcStacked( numStacked );
+                for( Int i=0; i<numStacked; ++i )
+                    srcStacked[i] = i;
+                Matrix<F> WElim( WStacked );
+                tournament::SelectRows( WElim, srcStacked );
+                numSel = Min( numStacked, n );
+                Matrix<F> WNew( numSel, n );
+                vector<Int> idxNew( numSel );
+                for( Int i=0; i<numSel; ++i )
+                {
+                    const Int src = srcStacked[i];
+                    idxNew[i] = idxStacked[src];
+                    for( Int j=0; j<n; ++j )
+                        WNew(i,j) = WStacked(src,j);
+                }
+                W = WNew;
+                widx = idxNew;
+            }
+        }
+        mask <<= 1;
+    }
+
+    // Broadcast the winning indices from the root of the process column
+    vector<Int> winners( n );
+    if( colRank == 0 )
+    {
+        EL_DEBUG_ONLY(
+          if( numSel < n )
+              LogicError("Tournament did not produce enough pivots");
+        )
+        for( Int j=0; j<n; ++j )
+            winners[j] = widx[j];
+    }
+    mpi::Broadcast( winners.data(), n, 0, colComm );
+
+    // Record the pivots as sequential swaps, following the displacement of
+    // each winner through the earlier swaps
+    vector<Int> pivots( n );
+    for( Int j=0; j<n; ++j )
+    {
+        Int pos = winners[j];
+        for( Int i=0; i<j; ++i )
+        {
+            if( pos == i )
+                pos = pivots[i];
+            else if( pos == pivots[i] )
+                pos = i;
+        }
+        pivots[j] = pos;
+        P.Swap( j+offset, pos+offset );
+        PB.Swap( j, pos );
+    }
+}
+
+// Factor the stacked panel [A; B] without any further pivoting (the rows
+// having already been exchanged according to the tournament's selection):
+// every process redundantly eliminates the replicated top block and updates
+// its local rows of B, so no communication whatsoever is required.
+//
+// NOTE: As with lu::Panel, it is assumed that the local buffers of A[*,*]
+//       and B[MC,*] are vertically stacked.
+template<typename F>
+void PanelNoPiv
+( DistMatrix<F,STAR,STAR>& A,
+  DistMatrix<F,MC,STAR>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+      if( A.Buffer()+n != B.Buffer() )
+          LogicError("Buffers of A and B did not properly align");
+    )
+    for( Int k=0; k<n; ++k )
+    {
+        const Int ind2Size = n-k-1;
+        const F* a12Buf = &ABuf[ k    + (k+1)*ALDim];
+              F* a21Buf = &ABuf[(k+1) +  k   *ALDim];
+              F* A22Buf = &ABuf[(k+1) + (k+1)*ALDim];
+
+        const F alpha = ABuf[k+k*ALDim];
+        if( alpha == F(0) )
+            throw SingularMatrixException();
+        const F alpha11Inv = F(1) / alpha;
+        blas::Scal( ind2Size+BLocHeight, alpha11Inv, a21Buf, 1 );
+        blas::Geru
+        ( ind2Size+BLocHeight, ind2Size, F(-1),
+          a21Buf, 1, a12Buf, ALDim, A22Buf, ALDim );
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
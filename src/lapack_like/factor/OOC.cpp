@@ -0,0 +1,47 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./Cholesky/OOCVariant3.hpp"
+#include "./QR/OOC.hpp"
+
+// The out-of-core drivers target matrices which exceed aggregate memory,
+// so only the BLAS field types (whose tiles dispatch to vendor level-3
+// kernels) are instantiated.
+
+namespace El {
+
+template<typename F>
+void Cholesky( UpperOrLower uplo, TileStore<F>& A )
+{
+    EL_DEBUG_CSE
+    cholesky::OOCVariant3( uplo, A );
+}
+
+template<typename F>
+void QR
+( TileStore<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature )
+{
+    EL_DEBUG_CSE
+    qr::ooc::OOC( A, householderScalars, signature );
+}
+
+#define PROTO(F) \
+  template void Cholesky( UpperOrLower uplo, TileStore<F>& A ); \
+  template void QR \
+  ( TileStore<F>& A, \
+    Matrix<F>& householderScalars, \
+    Matrix<Base<F>>& signature );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
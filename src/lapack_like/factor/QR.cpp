@@ -9,6 +9,7 @@
 #include <El.hpp>
 
 #include "./QR/ApplyQ.hpp"
+#include "./QR/WY.hpp"
 #include "./QR/BusingerGolub.hpp"
 #include "./QR/Cholesky.hpp"
 #include "./QR/Householder.hpp"
@@ -16,6 +17,7 @@
 #include "./QR/Explicit.hpp"
 
 #include "./QR/ColSwap.hpp"
+#include "./QR/RowUpdate.hpp"
 
 #include "./QR/TS.hpp"
 
@@ -161,6 +163,12 @@ void QR
   (       Matrix<F>& Q, \
           Matrix<F>& R, \
     const Matrix<Int>& colSwaps ); \
+  template void qr::RowUpdate \
+  ( Matrix<F>& R, \
+    Matrix<F>& B ); \
+  template void qr::RowUpdate \
+  ( AbstractDistMatrix<F>& R, \
+    AbstractDistMatrix<F>& B ); \
   template void qr::ApplyQ \
   ( LeftOrRight side, \
     Orientation orientation, \
@@ -175,6 +183,30 @@ void QR
     const AbstractDistMatrix<F>& householderScalars, \
     const AbstractDistMatrix<Base<F>>& signature, \
           AbstractDistMatrix<F>& B ); \
+  template void qr::FormWYCache \
+  ( const Matrix<F>& A, \
+    qr::WYCache<F>& cache, \
+    Int blocksize ); \
+  template void qr::FormWYCache \
+  ( const AbstractDistMatrix<F>& A, \
+    qr::WYCache<F>& cache, \
+    Int blocksize ); \
+  template void qr::ApplyQ \
+  ( LeftOrRight side, \
+    Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const Matrix<Base<F>>& signature, \
+    const qr::WYCache<F>& cache, \
+          Matrix<F>& B ); \
+  template void qr::ApplyQ \
+  ( LeftOrRight side, \
+    Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const AbstractDistMatrix<Base<F>>& signature, \
+    const qr::WYCache<F>& cache, \
+          AbstractDistMatrix<F>& B ); \
   template void qr::SolveAfter \
   ( Orientation orientation, \
     const Matrix<F>& A, \
@@ -203,6 +203,88 @@ FindColPivot
                ( pivot, mpi::MaxLocOp<Real>(), A.Grid().RowComm() );
 }
 
+// Elect the next 'panelSize' column pivots from a single Gaussian sketch of
+// the trailing matrix [CITATION]: S := G A(k:end,k:end) is formed with one
+// summation over the process column (the counter-based Gaussian fill keeps
+// the redundant copies of G consistent without communication), the small
+// sketch is replicated, and every process runs an identical column-pivoted
+// Gram-Schmidt sweep over it to choose the panel's pivots locally.
+template<typename F>
+void SketchPivots
+( const DistMatrix<F>& A,
+        Int k,
+        Int panelSize,
+        Int oversample,
+        vector<Int>& pivotQueue,
+        vector<Base<F>>& pivotEstimates )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real zero(0), one(1);
+    const Grid& g = A.Grid();
+    const Int numTrailing = A.Width() - k;
+    const Int ell = Min( panelSize+oversample, A.Height()-k );
+
+    auto ATrail = A( IR(k,END), IR(k,END) );
+
+    DistMatrix<F,STAR,MC> G(g);
+    DistMatrix<F,STAR,MR> S(g);
+    G.AlignWith( ATrail );
+    S.AlignWith( ATrail );
+    Gaussian( G, ell, ATrail.Height() );
+    S.Resize( ell, numTrailing );
+    LocalGemm( NORMAL, NORMAL, F(1), G, ATrail, F(0), S );
+    El::AllReduce( S, ATrail.ColComm() );
+
+    // Replicate the (small) sketch
+    DistMatrix<F,STAR,STAR> SStar( S );
+    Matrix<F>& SLoc = SStar.Matrix();
+
+    vector<Real> sNorms;
+    ColNorms( SLoc, sNorms );
+    vector<Int> colMap( numTrailing );
+    for( Int j=0; j<numTrailing; ++j )
+        colMap[j] = k + j;
+
+    // E|| G v ||^2 = ell ||v||^2 for a standard Gaussian G
+    const Real estScale = one / Sqrt(Real(Max(ell,Int(1))));
+
+    pivotQueue.resize( panelSize );
+    pivotEstimates.resize( panelSize );
+    F* SBuf = SLoc.Buffer();
+    const Int sLDim = SLoc.LDim();
+    for( Int t=0; t<panelSize; ++t )
+    {
+        Int jMax = t;
+        for( Int j=t+1; j<numTrailing; ++j )
+            if( sNorms[j] > sNorms[jMax] )
+                jMax = j;
+        if( jMax != t )
+        {
+            blas::Swap( ell, &SBuf[t*sLDim], 1, &SBuf[jMax*sLDim], 1 );
+            std::swap( sNorms[t], sNorms[jMax] );
+            std::swap( colMap[t], colMap[jMax] );
+        }
+        pivotQueue[t] = colMap[t];
+        pivotEstimates[t] = sNorms[t]*estScale;
+        if( sNorms[t] == zero )
+            continue; // The remaining sketch columns are numerically null
+
+        // Orthogonalize the remaining sketch columns against the winner and
+        // recompute their (small) norms exactly
+        const Real colNormInvSq = one / (sNorms[t]*sNorms[t]);
+        for( Int j=t+1; j<numTrailing; ++j )
+        {
+            F inner = 0;
+            for( Int i=0; i<ell; ++i )
+                inner += Conj(SBuf[i+t*sLDim])*SBuf[i+j*sLDim];
+            inner *= colNormInvSq;
+            blas::Axpy( ell, -inner, &SBuf[t*sLDim], 1, &SBuf[j*sLDim], 1 );
+            sNorms[j] = blas::Nrm2( ell, &SBuf[j*sLDim], 1 );
+        }
+    }
+}
+
 template<typename F>
 Base<F> ColNorms( const DistMatrix<F>& A, vector<Base<F>>& norms )
 {
@@ -347,6 +429,12 @@ void BusingerGolub
     Omega.MakeIdentity( n );
     Omega.ReserveSwaps( n );
 
+    // State for the randomized-sketch pivot selection
+    const bool sketched = ctrl.randomizedPiv && !ctrl.smallestFirst;
+    vector<Int> pivotQueue;
+    vector<Real> pivotEstimates;
+    Int pivotQueueOffset = 0;
+
     const Grid& g = A.Grid();
     DistMatrix<F> z21(g);
     DistMatrix<F,MC,STAR> aB1_MC(g);
@@ -371,6 +459,22 @@ void BusingerGolub
             // Adaptivity does not make sense for "rank-obscuring" factorization
             pivot = FindColPivot( A, norms, k, true );
         }
+        else if( sketched )
+        {
+            if( pivotQueueOffset == Int(pivotQueue.size()) )
+            {
+                SketchPivots
+                ( A, k, Min(ctrl.sketchPanel,maxSteps-k), ctrl.sketchOversample,
+                  pivotQueue, pivotEstimates );
+                pivotQueueOffset = 0;
+            }
+            pivot.index = pivotQueue[pivotQueueOffset];
+            pivot.value = pivotEstimates[pivotQueueOffset];
+            ++pivotQueueOffset;
+            // The stopping test only sees the sketch-based estimate
+            if( ctrl.adaptive && pivot.value <= ctrl.tol*maxOrigNorm )
+                break;
+        }
         else
         {
             pivot = FindColPivot( A, norms, k, false );
@@ -381,6 +485,13 @@ void BusingerGolub
 
         // Perform the swap
         const Int jPiv = pivot.index;
+        if( sketched && jPiv != k )
+        {
+            // The column displaced to jPiv may itself be a future pivot
+            for( Int t=pivotQueueOffset; t<Int(pivotQueue.size()); ++t )
+                if( pivotQueue[t] == k )
+                    pivotQueue[t] = jPiv;
+        }
         const Int curOwner = A.ColOwner(k);
         const Int pivOwner = A.ColOwner(jPiv);
         const Int myCur = A.IsLocalCol(k);
@@ -393,15 +504,19 @@ void BusingerGolub
                 const Int jPivLoc = A.LocalCol(jPiv);
                 blas::Swap
                 ( mLocal, A.Buffer(0,kLoc), 1, A.Buffer(0,jPivLoc), 1 );
-                norms[jPivLoc] = norms[kLoc];
-                origNorms[jPivLoc] = origNorms[kLoc];
+                if( !sketched )
+                {
+                    norms[jPivLoc] = norms[kLoc];
+                    origNorms[jPivLoc] = origNorms[kLoc];
+                }
             }
             else if( myCur )
             {
                 const Int kLoc = A.LocalCol(k);
                 mpi::SendRecv
                 ( A.Buffer(0,kLoc), mLocal, pivOwner, pivOwner, g.RowComm() );
-                mpi::Send( norms[kLoc], pivOwner, g.RowComm() );
+                if( !sketched )
+                    mpi::Send( norms[kLoc], pivOwner, g.RowComm() );
             }
             else if( myPiv )
             {
@@ -409,7 +524,8 @@ void BusingerGolub
                 mpi::SendRecv
                 ( A.Buffer(0,jPivLoc), mLocal,
                   curOwner, curOwner, g.RowComm() );
-                norms[jPivLoc] = mpi::Recv<Real>( curOwner, g.RowComm() );
+                if( !sketched )
+                    norms[jPivLoc] = mpi::Recv<Real>( curOwner, g.RowComm() );
             }
         }
 
@@ -444,6 +560,11 @@ void BusingerGolub
         if( alpha11.IsLocal(0,0) )
             alpha11.SetLocal(0,0,alpha);
 
+        // With sketched pivoting the column norms are neither maintained
+        // nor needed, so the downdating pass (and its reductions) is skipped
+        if( sketched )
+            continue;
+
         // Update the column norm estimates in the same manner as LAWN 176.
         // However, we do so in two steps in order to lower the communication
         // latency:
@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_OOC_HPP
+#define EL_QR_OOC_HPP
+
+// An out-of-core blocked Householder QR layered on the TileStore: each
+// panel of tile columns is gathered into an in-core workspace, factored
+// with the standard (in-core) blocked algorithm, and its block reflector is
+// then applied to each trailing tile column in turn. The tiles of the next
+// trailing column are prefetched on the I/O thread while the current
+// column's applications execute, so the disk traffic of the sweep hides
+// behind the level-3 updates. The in-place representation written back to
+// the store (R in the upper triangle, the Householder vectors below it)
+// matches that of the in-core factorization, as do the returned scalars
+// and sign signature.
+
+namespace El {
+namespace qr {
+namespace ooc {
+
+// Gather the portion of tile column j at and below tile row iBeg into B
+template<typename F>
+void GatherTileCol( TileStore<F>& A, Int iBeg, Int j, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int b = A.TileSize();
+    const Int mt = A.NumRowTiles();
+    B.Resize( A.Height()-iBeg*b, A.TileWidth(j) );
+    for( Int i=iBeg; i<mt; ++i )
+    {
+        auto Bi = B( IR((i-iBeg)*b,(i-iBeg)*b+A.TileHeight(i)), ALL );
+        Bi = A.LockedTile( i, j );
+        A.Release( i, j );
+    }
+}
+
+// Scatter B back onto the portion of tile column j at and below tile row
+// iBeg
+template<typename F>
+void ScatterTileCol( TileStore<F>& A, Int iBeg, Int j, const Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int b = A.TileSize();
+    const Int mt = A.NumRowTiles();
+    for( Int i=iBeg; i<mt; ++i )
+    {
+        auto Bi = B( IR((i-iBeg)*b,(i-iBeg)*b+A.TileHeight(i)), ALL );
+        A.Tile( i, j ) = Bi;
+        A.Release( i, j );
+    }
+}
+
+template<typename F>
+void PrefetchTileCol( TileStore<F>& A, Int iBeg, Int j )
+{
+    EL_DEBUG_CSE
+    const Int mt = A.NumRowTiles();
+    for( Int i=iBeg; i<mt; ++i )
+        A.Prefetch( i, j );
+}
+
+template<typename F>
+void OOC
+( TileStore<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int b = A.TileSize();
+    const Int nt = A.NumColTiles();
+    const Int minDim = Min( m, n );
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    Matrix<F> panel, C, tPan;
+    Matrix<Real> dPan;
+    for( Int k=0; k<nt && k*b<minDim; ++k )
+    {
+        // Gather and factor the k'th panel of tile columns
+        GatherTileCol( A, k, k, panel );
+        if( k+1 < nt )
+            PrefetchTileCol( A, k, k+1 );
+        QR( panel, tPan, dPan );
+        const Int numReflect = tPan.Height();
+        auto t = householderScalars( IR(k*b,k*b+numReflect), ALL );
+        auto d = signature( IR(k*b,k*b+numReflect), ALL );
+        t = tPan;
+        d = dPan;
+        ScatterTileCol( A, k, k, panel );
+
+        // Apply the panel's block reflector to each trailing tile column,
+        // prefetching the tiles of the next column while the current
+        // column's update executes
+        for( Int j=k+1; j<nt; ++j )
+        {
+            GatherTileCol( A, k, j, C );
+            if( j+1 < nt )
+                PrefetchTileCol( A, k, j+1 );
+            ApplyQ( LEFT, ADJOINT, panel, tPan, dPan, C );
+            ScatterTileCol( A, k, j, C );
+        }
+    }
+    A.Flush();
+}
+
+} // namespace ooc
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_OOC_HPP
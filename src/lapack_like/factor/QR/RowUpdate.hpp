@@ -0,0 +1,141 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_ROWUPDATE_HPP
+#define EL_QR_ROWUPDATE_HPP
+
+// TODO: Blocked algorithms
+namespace El {
+namespace qr {
+
+// Update the triangular factor R of a QR factorization after appending the
+// rows B, exploiting the fact that the Householder vector eliminating the
+// appended entries of column k only involves R(k,k) and B(:,k), so that the
+// entire update costs O(n^2 k) rather than the O(n^3) of a refactorization.
+
+template<typename F>
+void RowUpdate( Matrix<F>& R, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( R.Height() != R.Width() )
+          LogicError("R must be square");
+      if( B.Width() != R.Width() )
+          LogicError("B must have the same width as R");
+    )
+    typedef Base<F> Real;
+    const Int n = R.Width();
+
+    Matrix<F> z1, z1Adj;
+
+    for( Int k=0; k<n; ++k )
+    {
+        const IR ind1( k ), ind2( k+1, END );
+
+        F& rho11 = R(k,k);
+        auto r12 = R( ind1, ind2 );
+
+        auto b1 = B( ALL, ind1 );
+        auto B2 = B( ALL, ind2 );
+
+        // Find tau and u such that
+        //  / I - tau | 1 | | 1, u^H | \ | rho11 | = | beta |
+        //  \         | u |            / |    b1 |   |    0 |
+        const F tau = LeftReflector( rho11, b1 );
+
+        // Apply the reflector to the remainder of row k of R and to B:
+        // | r12 | := | r12 | - tau | 1 | (r12 + u^H B2)
+        // | B2  |    | B2  |       | u |
+        Adjoint( r12, z1 );
+        Gemv( ADJOINT, F(1), B2, b1, F(1), z1 );
+        Adjoint( z1, z1Adj );
+        Axpy( -tau, z1Adj, r12 );
+        Ger( -tau, b1, z1, B2 );
+
+        // Maintain a non-negative diagonal by folding any sign flip into the
+        // (implicit) orthogonal factor
+        if( RealPart(R(k,k)) < Real(0) )
+        {
+            auto rRow = R( ind1, IR(k,END) );
+            rRow *= -1;
+        }
+    }
+}
+
+template<typename F>
+void RowUpdate
+( AbstractDistMatrix<F>& RPre,
+  AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( RPre.Height() != RPre.Width() )
+          LogicError("R must be square");
+      if( BPre.Width() != RPre.Width() )
+          LogicError("B must have the same width as R");
+      AssertSameGrids( RPre, BPre );
+    )
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> RProx( RPre ), BProx( BPre );
+    auto& R = RProx.Get();
+    auto& B = BProx.Get();
+
+    typedef Base<F> Real;
+    const Int n = R.Width();
+    const Grid& grid = R.Grid();
+    DistMatrix<F,MC,STAR> b1_MC_STAR(grid);
+    DistMatrix<F,MR,STAR> z1_MR_STAR(grid), r12Adj_MR_STAR(grid);
+    DistMatrix<F,STAR,MR> z1Adj_STAR_MR(grid);
+
+    for( Int k=0; k<n; ++k )
+    {
+        const IR ind1( k ), ind2( k+1, END );
+
+        F rho11 = R.Get( k, k );
+        auto r12 = R( ind1, ind2 );
+
+        auto b1 = B( ALL, ind1 );
+        auto B2 = B( ALL, ind2 );
+
+        // Find tau and u such that
+        //  / I - tau | 1 | | 1, u^H | \ | rho11 | = | beta |
+        //  \         | u |            / |    b1 |   |    0 |
+        const F tau = LeftReflector( rho11, b1 );
+        R.Set( k, k, rho11 );
+
+        // Apply the reflector to the remainder of row k of R and to B:
+        // | r12 | := | r12 | - tau | 1 | (r12 + u^H B2)
+        // | B2  |    | B2  |       | u |
+        b1_MC_STAR.AlignWith( B2 );
+        b1_MC_STAR = b1;
+        z1_MR_STAR.AlignWith( B2 );
+        Zeros( z1_MR_STAR, B2.Width(), 1 );
+        LocalGemv( ADJOINT, F(1), B2, b1_MC_STAR, F(0), z1_MR_STAR );
+        El::AllReduce( z1_MR_STAR, B2.ColComm() );
+        r12Adj_MR_STAR.AlignWith( B2 );
+        Adjoint( r12, r12Adj_MR_STAR );
+        z1_MR_STAR += r12Adj_MR_STAR;
+        z1Adj_STAR_MR.AlignWith( B2 );
+        Adjoint( z1_MR_STAR, z1Adj_STAR_MR );
+        Axpy( -tau, z1Adj_STAR_MR, r12 );
+        LocalGer( -tau, b1_MC_STAR, z1_MR_STAR, B2 );
+
+        // Maintain a non-negative diagonal by folding any sign flip into the
+        // (implicit) orthogonal factor
+        if( RealPart(R.Get(k,k)) < Real(0) )
+        {
+            auto rRow = R( ind1, IR(k,END) );
+            rRow *= -1;
+        }
+    }
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_ROWUPDATE_HPP
@@ -0,0 +1,482 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_WY_HPP
+#define EL_QR_WY_HPP
+
+#include "../../reflect/ApplyPacked/Util.hpp"
+
+// Each blocked application of the packed Householder reflectors re-forms
+// the triangular factor of the compact WY representation of its panel with
+// a Herk of the (scaled) Householder vectors. When Q is applied many times
+// (e.g., when repeatedly forming Q^H B after a least-squares factorization),
+// that reconstruction can instead be performed once: the Gram matrix of
+// each panel is cached and only its diagonal (which depends upon the
+// conjugation of the application) is refreshed per call. Since the panel
+// decomposition of the cache is independent of the factorization's, a
+// wider block size may be requested so that bandwidth-bound application
+// sweeps make fewer passes over B.
+
+namespace El {
+namespace qr {
+namespace wy {
+
+// Load the triangular factor of a panel from its cached Gram matrix, which
+// stores tril(U^H U) (with zeros above the diagonal); the upper-triangular
+// variants follow from triu(U^H U) = tril(U^H U)^H
+template<typename F>
+void LoadSInv
+( UpperOrLower uplo,
+  Conjugation conjugation,
+  const Matrix<F>& gram,
+  const Matrix<F>& householderScalars1,
+        Matrix<F>& SInv )
+{
+    EL_DEBUG_CSE
+    if( uplo == LOWER )
+        SInv = gram;
+    else
+        Adjoint( gram, SInv );
+    FixDiagonal( conjugation, householderScalars1, SInv );
+}
+
+template<typename F>
+void ApplyLeft
+( ForwardOrBackward direction,
+  Conjugation conjugation,
+  const Matrix<F>& H,
+  const Matrix<F>& householderScalars,
+  const WYCache<F>& cache,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = H.Height();
+    const Int diagLength = H.DiagonalLength(0);
+    const Int bsize = cache.blocksize;
+    const Int numPanels = cache.gramList.size();
+    EL_DEBUG_ONLY(
+      if( bsize <= 0 || numPanels != (diagLength+bsize-1)/bsize )
+          LogicError("WY cache does not match this factorization");
+    )
+    const UpperOrLower uplo = ( direction==FORWARD ? LOWER : UPPER );
+
+    Matrix<F> HPanCopy, SInv, Z;
+    for( Int panel=0; panel<numPanels; ++panel )
+    {
+        const Int p = ( direction==FORWARD ? panel : numPanels-1-panel );
+        const Int k = p*bsize;
+        const Int nb = Min(bsize,diagLength-k);
+
+        auto HPan = H( IR(k,m), IR(k,k+nb) );
+        auto BBot = B( IR(k,m), ALL        );
+        auto householderScalars1 = householderScalars( IR(k,k+nb), ALL );
+
+        // Convert to an explicit matrix of (scaled) Householder vectors
+        HPanCopy = HPan;
+        MakeTrapezoidal( LOWER, HPanCopy );
+        FillDiagonal( HPanCopy, F(1) );
+
+        wy::LoadSInv
+        ( uplo, conjugation, cache.gramList[p], householderScalars1, SInv );
+
+        // Z := HPan' BBot
+        Gemm( ADJOINT, NORMAL, F(1), HPanCopy, BBot, Z );
+        // Z := inv(SInv) HPan' BBot
+        Trsm( LEFT, uplo, NORMAL, NON_UNIT, F(1), SInv, Z );
+        // BBot := (I - HPan inv(SInv) HPan') BBot
+        Gemm( NORMAL, NORMAL, F(-1), HPanCopy, Z, F(1), BBot );
+    }
+}
+
+template<typename F>
+void ApplyRight
+( ForwardOrBackward direction,
+  Conjugation conjugation,
+  const Matrix<F>& H,
+  const Matrix<F>& householderScalars,
+  const WYCache<F>& cache,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int nB = B.Width();
+    const Int diagLength = H.DiagonalLength(0);
+    const Int bsize = cache.blocksize;
+    const Int numPanels = cache.gramList.size();
+    EL_DEBUG_ONLY(
+      if( bsize <= 0 || numPanels != (diagLength+bsize-1)/bsize )
+          LogicError("WY cache does not match this factorization");
+    )
+    const UpperOrLower uplo = ( direction==FORWARD ? UPPER : LOWER );
+
+    Matrix<F> HPanCopy, SInv, Z;
+    for( Int panel=0; panel<numPanels; ++panel )
+    {
+        const Int p = ( direction==FORWARD ? panel : numPanels-1-panel );
+        const Int k = p*bsize;
+        const Int nb = Min(bsize,diagLength-k);
+
+        auto HPan = H( IR(k,nB), IR(k,k+nb) );
+        auto BRight = B( ALL, IR(k,nB) );
+        auto householderScalars1 = householderScalars( IR(k,k+nb), ALL );
+
+        // Convert to an explicit matrix of (scaled) Householder vectors
+        HPanCopy = HPan;
+        MakeTrapezoidal( LOWER, HPanCopy );
+        FillDiagonal( HPanCopy, F(1) );
+
+        wy::LoadSInv
+        ( uplo, conjugation, cache.gramList[p], householderScalars1, SInv );
+
+        // Z := BRight HPan
+        Gemm( NORMAL, NORMAL, F(1), BRight, HPanCopy, Z );
+        // Z := BRight HPan inv(SInv)
+        Trsm( RIGHT, uplo, NORMAL, NON_UNIT, F(1), SInv, Z );
+        // BRight := BRight (I - HPan inv(SInv) HPan')
+        Gemm( NORMAL, ADJOINT, F(-1), Z, HPanCopy, F(1), BRight );
+    }
+}
+
+template<typename F>
+void ApplyLeft
+( ForwardOrBackward direction,
+  Conjugation conjugation,
+  const DistMatrix<F>& H,
+  const Matrix<F>& householderScalarsLoc,
+  const WYCache<F>& cache,
+        DistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = H.Height();
+    const Int diagLength = H.DiagonalLength(0);
+    const Int bsize = cache.blocksize;
+    const Int numPanels = cache.gramList.size();
+    EL_DEBUG_ONLY(
+      if( bsize <= 0 || numPanels != (diagLength+bsize-1)/bsize )
+          LogicError("WY cache does not match this factorization");
+    )
+    const UpperOrLower uplo = ( direction==FORWARD ? LOWER : UPPER );
+    const Grid& g = H.Grid();
+
+    DistMatrix<F> HPanCopy(g);
+    DistMatrix<F,MC,  STAR> HPan_MC_STAR(g);
+    DistMatrix<F,STAR,STAR> SInv_STAR_STAR(g);
+    DistMatrix<F,STAR,MR  > Z_STAR_MR(g);
+    DistMatrix<F,STAR,VR  > Z_STAR_VR(g);
+
+    for( Int panel=0; panel<numPanels; ++panel )
+    {
+        const Int p = ( direction==FORWARD ? panel : numPanels-1-panel );
+        const Int k = p*bsize;
+        const Int nb = Min(bsize,diagLength-k);
+
+        auto HPan = H( IR(k,m), IR(k,k+nb) );
+        auto BBot = B( IR(k,m), ALL        );
+        auto householderScalars1 = householderScalarsLoc( IR(k,k+nb), ALL );
+
+        // Convert to an explicit matrix of (scaled) Householder vectors
+        HPanCopy = HPan;
+        MakeTrapezoidal( LOWER, HPanCopy );
+        FillDiagonal( HPanCopy, F(1) );
+
+        // The cached Gram matrices are replicated, so each process can
+        // locally load the panel's triangular factor
+        SInv_STAR_STAR.Resize( nb, nb );
+        wy::LoadSInv
+        ( uplo, conjugation, cache.gramList[p], householderScalars1,
+          SInv_STAR_STAR.Matrix() );
+
+        // Z := HPan' BBot
+        HPan_MC_STAR.AlignWith( BBot );
+        HPan_MC_STAR = HPanCopy;
+        Z_STAR_MR.AlignWith( BBot );
+        LocalGemm( ADJOINT, NORMAL, F(1), HPan_MC_STAR, BBot, Z_STAR_MR );
+        Z_STAR_VR.AlignWith( BBot );
+        Contract( Z_STAR_MR, Z_STAR_VR );
+
+        // Z := inv(SInv) HPan' BBot
+        LocalTrsm
+        ( LEFT, uplo, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR, Z_STAR_VR );
+
+        // BBot := (I - HPan inv(SInv) HPan') BBot
+        Z_STAR_MR = Z_STAR_VR;
+        LocalGemm( NORMAL, NORMAL, F(-1), HPan_MC_STAR, Z_STAR_MR, F(1), BBot );
+    }
+}
+
+template<typename F>
+void ApplyRight
+( ForwardOrBackward direction,
+  Conjugation conjugation,
+  const DistMatrix<F>& H,
+  const Matrix<F>& householderScalarsLoc,
+  const WYCache<F>& cache,
+        DistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int nB = B.Width();
+    const Int diagLength = H.DiagonalLength(0);
+    const Int bsize = cache.blocksize;
+    const Int numPanels = cache.gramList.size();
+    EL_DEBUG_ONLY(
+      if( bsize <= 0 || numPanels != (diagLength+bsize-1)/bsize )
+          LogicError("WY cache does not match this factorization");
+    )
+    const UpperOrLower uplo = ( direction==FORWARD ? UPPER : LOWER );
+    const Grid& g = H.Grid();
+
+    DistMatrix<F> HPanCopy(g);
+    DistMatrix<F,MR,  STAR> HPan_MR_STAR(g);
+    DistMatrix<F,STAR,STAR> SInv_STAR_STAR(g);
+    DistMatrix<F,STAR,MC  > ZAdj_STAR_MC(g);
+    DistMatrix<F,STAR,VC  > ZAdj_STAR_VC(g);
+
+    for( Int panel=0; panel<numPanels; ++panel )
+    {
+        const Int p = ( direction==FORWARD ? panel : numPanels-1-panel );
+        const Int k = p*bsize;
+        const Int nb = Min(bsize,diagLength-k);
+
+        auto HPan = H( IR(k,nB), IR(k,k+nb) );
+        auto BRight = B( ALL, IR(k,nB) );
+        auto householderScalars1 = householderScalarsLoc( IR(k,k+nb), ALL );
+
+        // Convert to an explicit matrix of (scaled) Householder vectors
+        HPanCopy = HPan;
+        MakeTrapezoidal( LOWER, HPanCopy );
+        FillDiagonal( HPanCopy, F(1) );
+
+        SInv_STAR_STAR.Resize( nb, nb );
+        wy::LoadSInv
+        ( uplo, conjugation, cache.gramList[p], householderScalars1,
+          SInv_STAR_STAR.Matrix() );
+
+        // Z := BRight HPan
+        HPan_MR_STAR.AlignWith( BRight );
+        HPan_MR_STAR = HPanCopy;
+        ZAdj_STAR_MC.AlignWith( BRight );
+        LocalGemm( ADJOINT, ADJOINT, F(1), HPan_MR_STAR, BRight, ZAdj_STAR_MC );
+        ZAdj_STAR_VC.AlignWith( BRight );
+        Contract( ZAdj_STAR_MC, ZAdj_STAR_VC );
+
+        // Z := BRight HPan inv(SInv)
+        LocalTrsm
+        ( LEFT, uplo, ADJOINT, NON_UNIT, F(1), SInv_STAR_STAR, ZAdj_STAR_VC );
+
+        // BRight := BRight (I - HPan inv(SInv) HPan')
+        ZAdj_STAR_MC = ZAdj_STAR_VC;
+        LocalGemm
+        ( ADJOINT, ADJOINT, F(-1), ZAdj_STAR_MC, HPan_MR_STAR, F(1), BRight );
+    }
+}
+
+} // namespace wy
+
+template<typename F>
+void FormWYCache
+( const Matrix<F>& A,
+        WYCache<F>& cache,
+  Int blocksize )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int diagLength = A.DiagonalLength(0);
+    const Int bsize = ( blocksize > 0 ? blocksize : Blocksize() );
+    cache.blocksize = bsize;
+    cache.gramList.resize( (diagLength+bsize-1)/bsize );
+
+    Matrix<F> HPanCopy;
+    for( Int k=0; k<diagLength; k+=bsize )
+    {
+        const Int nb = Min(bsize,diagLength-k);
+        auto HPan = A( IR(k,m), IR(k,k+nb) );
+
+        // Convert to an explicit matrix of (scaled) Householder vectors
+        HPanCopy = HPan;
+        MakeTrapezoidal( LOWER, HPanCopy );
+        FillDiagonal( HPanCopy, F(1) );
+
+        // Cache tril(HPan' HPan); the diagonal is refreshed at application
+        // time since it depends upon the conjugation
+        Herk( LOWER, ADJOINT, Base<F>(1), HPanCopy, cache.gramList[k/bsize] );
+    }
+}
+
+template<typename F>
+void FormWYCache
+( const AbstractDistMatrix<F>& APre,
+        WYCache<F>& cache,
+  Int blocksize )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    const Int m = A.Height();
+    const Int diagLength = A.DiagonalLength(0);
+    const Int bsize = ( blocksize > 0 ? blocksize : Blocksize() );
+    cache.blocksize = bsize;
+    cache.gramList.resize( (diagLength+bsize-1)/bsize );
+
+    const Grid& g = A.Grid();
+    DistMatrix<F> HPanCopy(g);
+    DistMatrix<F,VC,STAR> HPan_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> Gram_STAR_STAR(g);
+    for( Int k=0; k<diagLength; k+=bsize )
+    {
+        const Int nb = Min(bsize,diagLength-k);
+        auto HPan = A( IR(k,m), IR(k,k+nb) );
+
+        // Convert to an explicit matrix of (scaled) Householder vectors
+        HPanCopy = HPan;
+        MakeTrapezoidal( LOWER, HPanCopy );
+        FillDiagonal( HPanCopy, F(1) );
+
+        // Cache a replicated copy of tril(HPan' HPan)
+        HPan_VC_STAR = HPanCopy;
+        Zeros( Gram_STAR_STAR, nb, nb );
+        Herk
+        ( LOWER, ADJOINT,
+          Base<F>(1), HPan_VC_STAR.LockedMatrix(),
+          Base<F>(0), Gram_STAR_STAR.Matrix() );
+        El::AllReduce( Gram_STAR_STAR, HPan_VC_STAR.ColComm() );
+        cache.gramList[k/bsize] = Gram_STAR_STAR.Matrix();
+    }
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature,
+  const WYCache<F>& cache,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const bool applyDFirst = normal==onLeft;
+    const Int minDim = Min(A.Height(),A.Width());
+
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+
+    const Int m = B.Height();
+    const Int n = B.Width();
+
+    if( applyDFirst )
+    {
+        if( onLeft )
+        {
+            auto BTop = B( IR(0,minDim), IR(0,n) );
+            DiagonalScale( side, orientation, signature, BTop );
+        }
+        else
+        {
+            auto BLeft = B( IR(0,m), IR(0,minDim) );
+            DiagonalScale( side, orientation, signature, BLeft );
+        }
+    }
+
+    if( onLeft )
+        wy::ApplyLeft( direction, conjugation, A, householderScalars, cache, B );
+    else
+        wy::ApplyRight
+        ( direction, conjugation, A, householderScalars, cache, B );
+
+    if( !applyDFirst )
+    {
+        if( onLeft )
+        {
+            auto BTop = B( IR(0,minDim), IR(0,n) );
+            DiagonalScale( side, orientation, signature, BTop );
+        }
+        else
+        {
+            auto BLeft = B( IR(0,m), IR(0,minDim) );
+            DiagonalScale( side, orientation, signature, BLeft );
+        }
+    }
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& householderScalarsPre,
+  const AbstractDistMatrix<Base<F>>& signature,
+  const WYCache<F>& cache,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const bool applyDFirst = normal==onLeft;
+    const Int minDim = Min(APre.Height(),APre.Width());
+
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+
+    // Gather the Householder scalars so that the triangular factors can be
+    // refreshed without communication
+    DistMatrixReadProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    auto& householderScalars = householderScalarsProx.GetLocked();
+
+    const Int m = B.Height();
+    const Int n = B.Width();
+
+    if( applyDFirst )
+    {
+        if( onLeft )
+        {
+            auto BTop = B( IR(0,minDim), IR(0,n) );
+            DiagonalScale( side, orientation, signature, BTop );
+        }
+        else
+        {
+            auto BLeft = B( IR(0,m), IR(0,minDim) );
+            DiagonalScale( side, orientation, signature, BLeft );
+        }
+    }
+
+    if( onLeft )
+        wy::ApplyLeft
+        ( direction, conjugation, A, householderScalars.LockedMatrix(),
+          cache, B );
+    else
+        wy::ApplyRight
+        ( direction, conjugation, A, householderScalars.LockedMatrix(),
+          cache, B );
+
+    if( !applyDFirst )
+    {
+        if( onLeft )
+        {
+            auto BTop = B( IR(0,minDim), IR(0,n) );
+            DiagonalScale( side, orientation, signature, BTop );
+        }
+        else
+        {
+            auto BLeft = B( IR(0,m), IR(0,minDim) );
+            DiagonalScale( side, orientation, signature, BLeft );
+        }
+    }
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_WY_HPP
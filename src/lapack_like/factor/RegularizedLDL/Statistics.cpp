@@ -0,0 +1,107 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace reg_ldl {
+
+template<typename Field>
+RegularizationInfo<Base<Field>> RegularizationStats
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    RegularizationInfo<Real> info;
+
+    Matrix<Field> diag;
+    function<Field(const Field&)> identity
+    ( []( const Field& alpha ) { return alpha; } );
+    GetMappedDiagonal( A, diag, identity );
+
+    const Int n = reg.Height();
+    Real minPerturbation = limits::Max<Real>();
+    for( Int i=0; i<n; ++i )
+    {
+        const Real rho = Abs(reg(i));
+        if( rho == Real(0) )
+            continue;
+        ++info.numPerturbed;
+        info.maxPerturbation = Max( info.maxPerturbation, rho );
+        minPerturbation = Min( minPerturbation, rho );
+        const Real diagAbs = Abs(diag(i));
+        if( diagAbs > Real(0) )
+            info.maxRelPerturbation =
+              Max( info.maxRelPerturbation, rho/diagAbs );
+    }
+    if( info.numPerturbed > 0 )
+        info.minPerturbation = minPerturbation;
+    return info;
+}
+
+template<typename Field>
+RegularizationInfo<Base<Field>> RegularizationStats
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    RegularizationInfo<Real> info;
+    mpi::Comm comm = reg.Grid().Comm();
+
+    DistMultiVec<Field> diag(A.Grid());
+    function<Field(const Field&)> identity
+    ( []( const Field& alpha ) { return alpha; } );
+    GetMappedDiagonal( A, diag, identity );
+
+    const Int localHeight = reg.LocalHeight();
+    Int numPerturbedLoc = 0;
+    Real maxPerturbationLoc = 0;
+    Real minPerturbationLoc = limits::Max<Real>();
+    Real maxRelPerturbationLoc = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real rho = Abs(reg.GetLocal(iLoc,0));
+        if( rho == Real(0) )
+            continue;
+        ++numPerturbedLoc;
+        maxPerturbationLoc = Max( maxPerturbationLoc, rho );
+        minPerturbationLoc = Min( minPerturbationLoc, rho );
+        const Real diagAbs = Abs(diag.GetLocal(iLoc,0));
+        if( diagAbs > Real(0) )
+            maxRelPerturbationLoc = Max( maxRelPerturbationLoc, rho/diagAbs );
+    }
+    info.numPerturbed = mpi::AllReduce( numPerturbedLoc, comm );
+    info.maxPerturbation =
+      mpi::AllReduce( maxPerturbationLoc, mpi::MAX, comm );
+    info.maxRelPerturbation =
+      mpi::AllReduce( maxRelPerturbationLoc, mpi::MAX, comm );
+    if( info.numPerturbed > 0 )
+        info.minPerturbation =
+          mpi::AllReduce( minPerturbationLoc, mpi::MIN, comm );
+    return info;
+}
+
+#define PROTO(Field) \
+  template RegularizationInfo<Base<Field>> RegularizationStats \
+  ( const SparseMatrix<Field>& A, \
+    const Matrix<Base<Field>>& reg ); \
+  template RegularizationInfo<Base<Field>> RegularizationStats \
+  ( const DistSparseMatrix<Field>& A, \
+    const DistMultiVec<Base<Field>>& reg );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace reg_ldl
+} // namespace El
@@ -21,6 +21,9 @@ ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl )
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
     ctrl->progress = false;
+    ctrl->newtonSchulzHybrid = false;
+    ctrl->newtonSchulzTestRatio = 0.1f;
+    ctrl->newtonSchulzSwitchBound = 0.5f;
     return EL_SUCCESS;
 }
 ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl )
@@ -30,6 +33,9 @@ ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl )
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
     ctrl->progress = false;
+    ctrl->newtonSchulzHybrid = false;
+    ctrl->newtonSchulzTestRatio = 0.1;
+    ctrl->newtonSchulzSwitchBound = 0.5;
     return EL_SUCCESS;
 }
 
@@ -10,6 +10,28 @@
 
 namespace El {
 
+namespace herm_func {
+
+// Return the indices of the mapped eigenvalues which survive truncation,
+// namely those whose magnitude exceeds relTol times the largest magnitude
+template<typename T>
+vector<Int> SignificantIndices( const Matrix<T>& fw, const Base<T>& relTol )
+{
+    typedef Base<T> Real;
+    const Int n = fw.Height();
+    Real maxAbs = 0;
+    for( Int i=0; i<n; ++i )
+        maxAbs = Max( maxAbs, Abs(fw(i)) );
+    vector<Int> indices;
+    indices.reserve( n );
+    for( Int i=0; i<n; ++i )
+        if( Abs(fw(i)) > relTol*maxAbs )
+            indices.push_back( i );
+    return indices;
+}
+
+} // namespace herm_func
+
 // Modify the eigenvalues of A with the real-valued function f, which will
 // therefore result in a Hermitian matrix, which we store in-place.
 
@@ -17,7 +39,8 @@ template<typename Field>
 void HermitianFunction
 ( UpperOrLower uplo,
   Matrix<Field>& A,
-  function<Base<Field>(const Base<Field>&)> func )
+  function<Base<Field>(const Base<Field>&)> func,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
     if( A.Height() != A.Width() )
@@ -32,6 +55,20 @@ void HermitianFunction
     // Replace w with f(w)
     EntrywiseMap( w, func );
 
+    if( ctrl.relTol > Real(0) )
+    {
+        auto indices = herm_func::SignificantIndices( w, ctrl.relTol );
+        if( Int(indices.size()) < w.Height() )
+        {
+            Matrix<Real> wSub;
+            Matrix<Field> ZSub;
+            GetSubmatrix( w, indices, IR(0,1), wSub );
+            GetSubmatrix( Z, IR(0,Z.Height()), indices, ZSub );
+            HermitianFromEVD( uplo, A, wSub, ZSub );
+            return;
+        }
+    }
+
     // A := Z f(Omega) Z^H
     HermitianFromEVD( uplo, A, w, Z );
 }
@@ -40,7 +77,8 @@ template<typename Field>
 void HermitianFunction
 ( UpperOrLower uplo,
   AbstractDistMatrix<Field>& APre,
-  function<Base<Field>(const Base<Field>&)> func )
+  function<Base<Field>(const Base<Field>&)> func,
+  const HermitianFunctionCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
 
@@ -60,6 +98,22 @@ void HermitianFunction
     // Replace w with f(w)
     EntrywiseMap( w, func );
 
+    if( ctrl.relTol > Real(0) )
+    {
+        DistMatrix<Real,STAR,STAR> w_STAR_STAR( w );
+        auto indices =
+          herm_func::SignificantIndices( w_STAR_STAR.Matrix(), ctrl.relTol );
+        if( Int(indices.size()) < w.Height() )
+        {
+            DistMatrix<Real,VR,STAR> wSub(g);
+            DistMatrix<Field> ZSub(g);
+            GetSubmatrix( w, indices, IR(0,1), wSub );
+            GetSubmatrix( Z, IR(0,Z.Height()), indices, ZSub );
+            HermitianFromEVD( uplo, A, wSub, ZSub );
+            return;
+        }
+    }
+
     // A := Z f(Omega) Z^H
     HermitianFromEVD( uplo, A, w, Z );
 }
@@ -73,7 +127,8 @@ template<typename Real>
 void HermitianFunction
 ( UpperOrLower uplo,
   Matrix<Complex<Real>>& A,
-  function<Complex<Real>(const Real&)> func )
+  function<Complex<Real>(const Real&)> func,
+  const HermitianFunctionCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
     if( A.Height() != A.Width() )
@@ -91,6 +146,19 @@ void HermitianFunction
     for( Int i=0; i<n; ++i )
         fw(i) = func(w(i));
 
+    if( ctrl.relTol > Real(0) )
+    {
+        auto indices = herm_func::SignificantIndices( fw, ctrl.relTol );
+        if( Int(indices.size()) < n )
+        {
+            Matrix<C> fwSub, ZSub;
+            GetSubmatrix( fw, indices, IR(0,1), fwSub );
+            GetSubmatrix( Z, IR(0,Z.Height()), indices, ZSub );
+            NormalFromEVD( A, fwSub, ZSub );
+            return;
+        }
+    }
+
     // A := Z f(Omega) Z^H
     NormalFromEVD( A, fw, Z );
 }
@@ -99,7 +167,8 @@ template<typename Real>
 void HermitianFunction
 ( UpperOrLower uplo,
   AbstractDistMatrix<Complex<Real>>& APre,
-  function<Complex<Real>(const Real&)> func )
+  function<Complex<Real>(const Real&)> func,
+  const HermitianFunctionCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
     typedef Complex<Real> C;
@@ -127,6 +196,22 @@ void HermitianFunction
         fw.SetLocal(iLoc,0,func(omega));
     }
 
+    if( ctrl.relTol > Real(0) )
+    {
+        DistMatrix<C,STAR,STAR> fw_STAR_STAR( fw );
+        auto indices =
+          herm_func::SignificantIndices( fw_STAR_STAR.Matrix(), ctrl.relTol );
+        if( Int(indices.size()) < fw.Height() )
+        {
+            DistMatrix<C,VR,STAR> fwSub(g);
+            DistMatrix<C> ZSub(g);
+            GetSubmatrix( fw, indices, IR(0,1), fwSub );
+            GetSubmatrix( Z, IR(0,Z.Height()), indices, ZSub );
+            NormalFromEVD( A, fwSub, ZSub );
+            return;
+        }
+    }
+
     // A := Z f(Omega) Z^H
     NormalFromEVD( A, fw, Z );
 }
@@ -135,22 +220,26 @@ void HermitianFunction
   template void HermitianFunction \
   ( UpperOrLower uplo, \
     Matrix<Field>& A, \
-    function<Base<Field>(const Base<Field>&)> func ); \
+    function<Base<Field>(const Base<Field>&)> func, \
+    const HermitianFunctionCtrl<Base<Field>>& ctrl ); \
   template void HermitianFunction \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<Field>& A, \
-    function<Base<Field>(const Base<Field>&)> func );
+    function<Base<Field>(const Base<Field>&)> func, \
+    const HermitianFunctionCtrl<Base<Field>>& ctrl );
 
 #define PROTO_REAL(Real) \
   PROTO_COMPLEX(Real) \
   template void HermitianFunction \
   ( UpperOrLower uplo, \
     Matrix<Complex<Real>>& A, \
-    function<Complex<Real>(const Real&)> func ); \
+    function<Complex<Real>(const Real&)> func, \
+    const HermitianFunctionCtrl<Real>& ctrl ); \
   template void HermitianFunction \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<Complex<Real>>& A, \
-    function<Complex<Real>(const Real&)> func );
+    function<Complex<Real>(const Real&)> func, \
+    const HermitianFunctionCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./HPD/Unblocked.hpp"
 #include "./HPD/CholeskyLVar2.hpp"
 #include "./HPD/CholeskyUVar2.hpp"
 
@@ -17,6 +18,17 @@ template<typename Field>
 void HPDInverse( UpperOrLower uplo, Matrix<Field>& A )
 {
     EL_DEBUG_CSE
+    // Matrices no larger than a single panel would otherwise be swept three
+    // times (Cholesky, TriangularInverse, and Trtrmm); use the fused
+    // unblocked algorithm instead
+    if( A.Height() <= Blocksize() )
+    {
+        if( uplo == LOWER )
+            hpd_inv::LUnb( A );
+        else
+            hpd_inv::UUnb( A );
+        return;
+    }
     if( uplo == LOWER )
         hpd_inv::CholeskyLVar2( A );
     else
@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_INVERSE_HPD_UNBLOCKED_HPP
+#define EL_INVERSE_HPD_UNBLOCKED_HPP
+
+namespace El {
+namespace hpd_inv {
+
+// The single-column limits of the blocked Variant 2 sweeps, with the
+// Cholesky, triangular-inversion, and triangular-multiplication stages all
+// folded into one traversal per column. For matrices which fit in cache
+// (e.g., batches of small covariance matrices) this avoids the three
+// separate sweeps that the blocked algorithm degenerates into when the
+// matrix is no larger than a single panel.
+
+template<typename Field>
+void LUnb( Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Nonsquare matrices cannot be triangular");
+    )
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    Field* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int k=0; k<n; ++k )
+    {
+        const Real delta2 = RealPart(ABuf[k+k*ALDim]);
+        if( delta2 <= Real(0) )
+            throw NonHPDMatrixException("A was not numerically HPD");
+        const Real delta = Sqrt( delta2 );
+
+        // a10 := a10 / delta, a21 := a21 / delta
+        for( Int j=0; j<k; ++j )
+            ABuf[k+j*ALDim] /= delta;
+        for( Int i=k+1; i<n; ++i )
+            ABuf[i+k*ALDim] /= delta;
+
+        // A00 := A00 + a10^H a10 and A20 := A20 - a21 a10, fused so that
+        // each leading column is traversed only once
+        for( Int j=0; j<k; ++j )
+        {
+            const Field gamma = ABuf[k+j*ALDim];
+            Field* EL_RESTRICT ACol = &ABuf[j*ALDim];
+            for( Int i=j; i<k; ++i )
+                ACol[i] += Conj(ABuf[k+i*ALDim])*gamma;
+            for( Int i=k+1; i<n; ++i )
+                ACol[i] -= ABuf[i+k*ALDim]*gamma;
+        }
+
+        // A22 := A22 - a21 a21^H
+        for( Int j=k+1; j<n; ++j )
+        {
+            const Field gamma = Conj(ABuf[j+k*ALDim]);
+            Field* EL_RESTRICT ACol = &ABuf[j*ALDim];
+            for( Int i=j; i<n; ++i )
+                ACol[i] -= ABuf[i+k*ALDim]*gamma;
+        }
+
+        // a10 := a10 / delta, a21 := -a21 / delta, and
+        // alpha11 := inv(delta)^H inv(delta)
+        for( Int j=0; j<k; ++j )
+            ABuf[k+j*ALDim] /= delta;
+        for( Int i=k+1; i<n; ++i )
+            ABuf[i+k*ALDim] = -ABuf[i+k*ALDim]/delta;
+        ABuf[k+k*ALDim] = Real(1)/delta2;
+    }
+}
+
+template<typename Field>
+void UUnb( Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Nonsquare matrices cannot be triangular");
+    )
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    Field* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int k=0; k<n; ++k )
+    {
+        const Real delta2 = RealPart(ABuf[k+k*ALDim]);
+        if( delta2 <= Real(0) )
+            throw NonHPDMatrixException("A was not numerically HPD");
+        const Real delta = Sqrt( delta2 );
+
+        // a01 := a01 / delta, a12 := a12 / delta
+        for( Int i=0; i<k; ++i )
+            ABuf[i+k*ALDim] /= delta;
+        for( Int j=k+1; j<n; ++j )
+            ABuf[k+j*ALDim] /= delta;
+
+        // A00 := A00 + a01 a01^H
+        for( Int j=0; j<k; ++j )
+        {
+            const Field gamma = Conj(ABuf[j+k*ALDim]);
+            Field* EL_RESTRICT ACol = &ABuf[j*ALDim];
+            for( Int i=0; i<=j; ++i )
+                ACol[i] += ABuf[i+k*ALDim]*gamma;
+        }
+
+        // A02 := A02 - a01 a12 and A22 := A22 - a12^H a12, fused so that
+        // each trailing column is traversed only once
+        for( Int j=k+1; j<n; ++j )
+        {
+            const Field gamma = ABuf[k+j*ALDim];
+            Field* EL_RESTRICT ACol = &ABuf[j*ALDim];
+            for( Int i=0; i<k; ++i )
+                ACol[i] -= ABuf[i+k*ALDim]*gamma;
+            for( Int i=k+1; i<=j; ++i )
+                ACol[i] -= Conj(ABuf[k+i*ALDim])*gamma;
+        }
+
+        // a01 := a01 / delta, a12 := -a12 / delta, and
+        // alpha11 := inv(delta) inv(delta)^H
+        for( Int i=0; i<k; ++i )
+            ABuf[i+k*ALDim] /= delta;
+        for( Int j=k+1; j<n; ++j )
+            ABuf[k+j*ALDim] = -ABuf[k+j*ALDim]/delta;
+        ABuf[k+k*ALDim] = Real(1)/delta2;
+    }
+}
+
+} // namespace hpd_inv
+} // namespace El
+
+#endif // ifndef EL_INVERSE_HPD_UNBLOCKED_HPP
@@ -40,6 +40,60 @@ void Pseudoinverse( Matrix<Field>& A, Base<Field> tolerance )
     Gemm( NORMAL, ADJOINT, Field(1), V, U, A );
 }
 
+template<typename Field>
+Int TruncatedPseudoinverse
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  Base<Field> tolerance )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( tolerance == Real(0) ? Max(m,n)*eps : tolerance );
+
+    // Detect the numerical rank with an adaptively truncated column-pivoted
+    // QR factorization, A Omega^T = Q R
+    Matrix<Field> B( A );
+    Matrix<Field> phase;
+    Matrix<Real> signature;
+    Permutation Omega;
+    QRCtrl<Real> qrCtrl;
+    qrCtrl.colPiv = true;
+    qrCtrl.adaptive = true;
+    qrCtrl.tol = tol;
+    QR( B, phase, signature, Omega, qrCtrl );
+    const Int rank = phase.Height();
+
+    // Compactly decompose the surviving rows of R, R1 = UR Sigma VR^H
+    Matrix<Field> R1( B( IR(0,rank), ALL ) );
+    MakeTrapezoidal( UPPER, R1 );
+    Matrix<Field> UR, VR;
+    SVDCtrl<Real> svdCtrl;
+    svdCtrl.overwrite = true;
+    svdCtrl.bidiagSVDCtrl.approach = COMPACT_SVD;
+    svdCtrl.bidiagSVDCtrl.tolType = RELATIVE_TO_MAX_SING_VAL_TOL;
+    svdCtrl.bidiagSVDCtrl.tol = tol;
+    SVD( R1, UR, s, VR, svdCtrl );
+    const Int numKept = s.Height();
+
+    // U := Q (UR padded out to height m)
+    U.Resize( m, numKept );
+    Zero( U );
+    auto UTop = U( IR(0,rank), ALL );
+    UTop = UR;
+    qr::ApplyQ( LEFT, NORMAL, B, phase, signature, U );
+
+    // V := Omega^T VR
+    V = VR;
+    Omega.InversePermuteRows( V );
+
+    return numKept;
+}
+
 template<typename Field>
 void HermitianPseudoinverse
 ( UpperOrLower uplo, Matrix<Field>& A, Base<Field> tolerance )
@@ -105,6 +159,70 @@ void Pseudoinverse( AbstractDistMatrix<Field>& APre, Base<Field> tolerance )
     Gemm( NORMAL, ADJOINT, Field(1), V, U, A );
 }
 
+template<typename Field>
+Int TruncatedPseudoinverse
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& UPre,
+        AbstractDistMatrix<Base<Field>>& sPre,
+        AbstractDistMatrix<Field>& VPre,
+  Base<Field> tolerance )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> UProx( UPre ), VProx( VPre );
+    DistMatrixWriteProxy<Real,Real,VR,STAR> sProx( sPre );
+    auto& A = AProx.GetLocked();
+    auto& U = UProx.Get();
+    auto& s = sProx.Get();
+    auto& V = VProx.Get();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Grid& g = A.Grid();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( tolerance == Real(0) ? Max(m,n)*eps : tolerance );
+
+    // Detect the numerical rank with an adaptively truncated column-pivoted
+    // QR factorization, A Omega^T = Q R
+    DistMatrix<Field> B( A );
+    DistMatrix<Field,MD,STAR> phase(g);
+    DistMatrix<Real,MD,STAR> signature(g);
+    DistPermutation Omega(g);
+    QRCtrl<Real> qrCtrl;
+    qrCtrl.colPiv = true;
+    qrCtrl.adaptive = true;
+    qrCtrl.tol = tol;
+    QR( B, phase, signature, Omega, qrCtrl );
+    const Int rank = phase.Height();
+
+    // Compactly decompose the surviving rows of R, R1 = UR Sigma VR^H
+    DistMatrix<Field> R1( B( IR(0,rank), ALL ) );
+    MakeTrapezoidal( UPPER, R1 );
+    DistMatrix<Field> UR(g), VR(g);
+    SVDCtrl<Real> svdCtrl;
+    svdCtrl.overwrite = true;
+    svdCtrl.bidiagSVDCtrl.approach = COMPACT_SVD;
+    svdCtrl.bidiagSVDCtrl.tolType = RELATIVE_TO_MAX_SING_VAL_TOL;
+    svdCtrl.bidiagSVDCtrl.tol = tol;
+    SVD( R1, UR, s, VR, svdCtrl );
+    const Int numKept = s.Height();
+
+    // U := Q (UR padded out to height m)
+    U.Resize( m, numKept );
+    Zero( U );
+    auto UTop = U( IR(0,rank), ALL );
+    UTop = UR;
+    qr::ApplyQ( LEFT, NORMAL, B, phase, signature, U );
+
+    // V := Omega^T VR
+    V = VR;
+    Omega.InversePermuteRows( V );
+
+    return numKept;
+}
+
 template<typename Field>
 void HermitianPseudoinverse
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& APre, Base<Field> tolerance )
@@ -144,6 +262,18 @@ void HermitianPseudoinverse
   template void Pseudoinverse( Matrix<Field>& A, Base<Field> tolerance ); \
   template void Pseudoinverse \
   ( AbstractDistMatrix<Field>& A, Base<Field> tolerance ); \
+  template Int TruncatedPseudoinverse \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& U, \
+          Matrix<Base<Field>>& s, \
+          Matrix<Field>& V, \
+    Base<Field> tolerance ); \
+  template Int TruncatedPseudoinverse \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& U, \
+          AbstractDistMatrix<Base<Field>>& s, \
+          AbstractDistMatrix<Field>& V, \
+    Base<Field> tolerance ); \
   template void HermitianPseudoinverse \
   ( UpperOrLower uplo, Matrix<Field>& A, Base<Field> tolerance ); \
   template void HermitianPseudoinverse \
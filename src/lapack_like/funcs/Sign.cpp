@@ -86,15 +86,14 @@ NewtonSchulzStep
         Matrix<Field>& XNew )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int n = X.Height();
 
     // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    Gemm( NORMAL, NORMAL, Field(-1), X, X, Field(3), XTmp );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), X, XTmp, XNew );
 }
 
 template<typename Field>
@@ -105,15 +104,14 @@ NewtonSchulzStep
         DistMatrix<Field>& XNew )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int n = X.Height();
 
     // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    Gemm( NORMAL, NORMAL, Field(-1), X, X, Field(3), XTmp );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), X, XTmp, XNew );
 }
 
 // Please see Chapter 5 of Higham's
@@ -197,7 +195,166 @@ Newton( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
     return numIts;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
+// Run the scaled Newton iteration until || X^2 - I ||_1 is small enough to
+// guarantee the convergence of the inverse-free (and entirely level-3)
+// Newton-Schulz iteration, which then finishes the computation without any
+// further triangular factorizations or explicit inversions. See Chapter 5 of
+// Higham's "Functions of Matrices" for the convergence criterion.
+template<typename Field>
+Int
+NewtonSchulzHybrid( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*limits::Epsilon<Real>();
+    const Real testRatio = ctrl.newtonSchulzTestRatio;
+    const Real switchBound = ctrl.newtonSchulzSwitchBound;
+
+    Int numIts=0;
+    bool converged = false;
+    Matrix<Field> B, Z;
+    Matrix<Field> *X=&A, *XNew=&B;
+    Real ratio = Real(1);
+    while( numIts < ctrl.maxIts )
+    {
+        if( ratio <= testRatio )
+        {
+            // Z := X^2 - I
+            Gemm( NORMAL, NORMAL, Field(1), *X, *X, Z );
+            ShiftDiagonal( Z, Field(-1) );
+            if( OneNorm(Z) <= switchBound )
+                break;
+        }
+
+        // Overwrite XNew with the new iterate
+        NewtonStep( *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+        ratio = oneDiff/oneNew;
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress )
+            cout << "after " << numIts << " Newton iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << ratio << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        {
+            converged = true;
+            break;
+        }
+    }
+    Matrix<Field> XTmp;
+    while( !converged && numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        NewtonSchulzStep( *X, XTmp, *XNew );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress )
+            cout << "after " << numIts << " Newton-Schulz iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            converged = true;
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+template<typename Field>
+Int
+NewtonSchulzHybrid( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = A.Height()*limits::Epsilon<Real>();
+    const Real testRatio = ctrl.newtonSchulzTestRatio;
+    const Real switchBound = ctrl.newtonSchulzSwitchBound;
+
+    Int numIts=0;
+    bool converged = false;
+    DistMatrix<Field> B( A.Grid() ), Z( A.Grid() );
+    DistMatrix<Field> *X=&A, *XNew=&B;
+    Real ratio = Real(1);
+    while( numIts < ctrl.maxIts )
+    {
+        if( ratio <= testRatio )
+        {
+            // Z := X^2 - I
+            Gemm( NORMAL, NORMAL, Field(1), *X, *X, Z );
+            ShiftDiagonal( Z, Field(-1) );
+            if( OneNorm(Z) <= switchBound )
+                break;
+        }
+
+        // Overwrite XNew with the new iterate
+        NewtonStep( *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+        ratio = oneDiff/oneNew;
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress && A.Grid().Rank() == 0 )
+            cout << "after " << numIts << " Newton iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << ratio << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        {
+            converged = true;
+            break;
+        }
+    }
+    DistMatrix<Field> XTmp( A.Grid() );
+    while( !converged && numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        NewtonSchulzStep( *X, XTmp, *XNew );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress && A.Grid().Rank() == 0 )
+            cout << "after " << numIts << " Newton-Schulz iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            converged = true;
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
 
 } // namespace sign
 
@@ -205,7 +362,10 @@ template<typename Field>
 void Sign( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl )
 {
     EL_DEBUG_CSE
-    sign::Newton( A, ctrl );
+    if( ctrl.newtonSchulzHybrid )
+        sign::NewtonSchulzHybrid( A, ctrl );
+    else
+        sign::Newton( A, ctrl );
 }
 
 template<typename Field>
@@ -214,7 +374,10 @@ void Sign
 {
     EL_DEBUG_CSE
     Matrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    if( ctrl.newtonSchulzHybrid )
+        sign::NewtonSchulzHybrid( A, ctrl );
+    else
+        sign::Newton( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
 }
 
@@ -226,7 +389,10 @@ void Sign( AbstractDistMatrix<Field>& APre, const SignCtrl<Base<Field>> ctrl )
     DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    sign::Newton( A, ctrl );
+    if( ctrl.newtonSchulzHybrid )
+        sign::NewtonSchulzHybrid( A, ctrl );
+    else
+        sign::Newton( A, ctrl );
 }
 
 template<typename Field>
@@ -243,7 +409,10 @@ void Sign
     auto& N = NProx.Get();
 
     DistMatrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    if( ctrl.newtonSchulzHybrid )
+        sign::NewtonSchulzHybrid( A, ctrl );
+    else
+        sign::Newton( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
 }
 
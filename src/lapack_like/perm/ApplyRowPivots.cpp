@@ -0,0 +1,174 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace apply_row_pivots {
+
+// Swap every pivot pair within a block of columns before advancing to the
+// next block (in the style of LAPACK's laswp) so that each pass through
+// memory applies the full sequence rather than streaming the entire row
+// length once per swap
+template<typename T>
+void LocalKernel
+( Matrix<T>& A, const Matrix<Int>& pivots, Int offset, bool inverse )
+{
+    EL_DEBUG_CSE
+    const Int numPivots = pivots.Height();
+    const Int n = A.Width();
+    if( numPivots == 0 || A.Height() == 0 || n == 0 )
+        return;
+
+    const Int* pivotsBuf = pivots.LockedBuffer();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+
+    const Int colBlockSize = 32;
+    for( Int jBeg=0; jBeg<n; jBeg+=colBlockSize )
+    {
+        const Int jEnd = Min( jBeg+colBlockSize, n );
+        for( Int pivot=0; pivot<numPivots; ++pivot )
+        {
+            const Int k = ( inverse ? numPivots-1-pivot : pivot );
+            const Int i1 = k + offset;
+            const Int i2 = pivotsBuf[k];
+            if( i1 == i2 )
+                continue;
+            for( Int j=jBeg; j<jEnd; ++j )
+            {
+                const T alpha = ABuf[i1+j*ALDim];
+                ABuf[i1+j*ALDim] = ABuf[i2+j*ALDim];
+                ABuf[i2+j*ALDim] = alpha;
+            }
+        }
+    }
+}
+
+} // namespace apply_row_pivots
+
+void PivotsToPermutation
+( const Matrix<Int>& pivots, Int size,
+        Permutation& P,
+        Int offset )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( pivots.Width() != 1 )
+          LogicError("pivots must be a column vector");
+    )
+    const Int numPivots = pivots.Height();
+    P.MakeIdentity( size );
+    P.ReserveSwaps( numPivots );
+    for( Int k=0; k<numPivots; ++k )
+        P.Swap( k+offset, pivots(k) );
+}
+
+void PivotsToPermutation
+( const AbstractDistMatrix<Int>& pivots, Int size,
+        DistPermutation& P,
+        Int offset )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( pivots.Width() != 1 )
+          LogicError("pivots must be a column vector");
+    )
+    DistMatrixReadProxy<Int,Int,STAR,STAR> pivotsProx( pivots );
+    auto& pivotsLoc = pivotsProx.GetLocked().LockedMatrix();
+
+    const Int numPivots = pivotsLoc.Height();
+    P.SetGrid( pivots.Grid() );
+    P.MakeIdentity( size );
+    P.ReserveSwaps( numPivots );
+    for( Int k=0; k<numPivots; ++k )
+        P.Swap( k+offset, pivotsLoc(k) );
+}
+
+template<typename T>
+void ApplyRowPivots( Matrix<T>& A, const Matrix<Int>& pivots, Int offset )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( pivots.Width() != 1 )
+          LogicError("pivots must be a column vector");
+      if( pivots.Height()+offset > A.Height() )
+          LogicError("pivot sequence was too long");
+    )
+    apply_row_pivots::LocalKernel( A, pivots, offset, false );
+}
+
+template<typename T>
+void ApplyInverseRowPivots
+( Matrix<T>& A, const Matrix<Int>& pivots, Int offset )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( pivots.Width() != 1 )
+          LogicError("pivots must be a column vector");
+      if( pivots.Height()+offset > A.Height() )
+          LogicError("pivot sequence was too long");
+    )
+    apply_row_pivots::LocalKernel( A, pivots, offset, true );
+}
+
+template<typename T>
+void ApplyRowPivots
+( AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<Int>& pivots,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    // Compose the swap sequence into a permutation so that every displaced
+    // row is exchanged exactly once (the composed plan is cached within P,
+    // but the permutation itself is local to this call; callers which apply
+    // the same pivots repeatedly should build it via PivotsToPermutation)
+    DistPermutation P( A.Grid() );
+    PivotsToPermutation( pivots, A.Height(), P, offset );
+    P.PermuteRows( A );
+}
+
+template<typename T>
+void ApplyInverseRowPivots
+( AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<Int>& pivots,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    DistPermutation P( A.Grid() );
+    PivotsToPermutation( pivots, A.Height(), P, offset );
+    P.InversePermuteRows( A );
+}
+
+#define PROTO(T) \
+  template void ApplyRowPivots \
+  ( Matrix<T>& A, \
+    const Matrix<Int>& pivots, \
+    Int offset ); \
+  template void ApplyInverseRowPivots \
+  ( Matrix<T>& A, \
+    const Matrix<Int>& pivots, \
+    Int offset ); \
+  template void ApplyRowPivots \
+  ( AbstractDistMatrix<T>& A, \
+    const AbstractDistMatrix<Int>& pivots, \
+    Int offset ); \
+  template void ApplyInverseRowPivots \
+  ( AbstractDistMatrix<T>& A, \
+    const AbstractDistMatrix<Int>& pivots, \
+    Int offset );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -212,6 +212,91 @@ void PermuteRows
     }
 }
 
+template<typename T>
+void PermuteRowsBatched
+( const vector<AbstractDistMatrix<T>*>& As,
+  const PermutationMeta& oldMeta,
+  bool inverse=false )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      for( auto* A : As )
+      {
+          if( A->ColComm() != oldMeta.comm )
+              LogicError("Invalid communicator in metadata");
+          if( A->ColAlign() != oldMeta.align )
+              LogicError("Invalid alignment in metadata");
+      }
+    )
+    if( As[0]->Height() == 0 || !As[0]->Participating() )
+        return;
+
+    Int totalWidth = 0;
+    for( auto* A : As )
+        totalWidth += A->LocalWidth();
+    if( totalWidth == 0 )
+        return;
+
+    PermutationMeta meta = oldMeta;
+    meta.ScaleUp( totalWidth );
+
+    // An inverse application runs the plan in the opposite direction
+    const auto& packIdx      = ( inverse ? meta.recvIdx    : meta.sendIdx    );
+    const auto& packRanks    = ( inverse ? meta.recvRanks  : meta.sendRanks  );
+    const auto& packCounts   = ( inverse ? meta.recvCounts : meta.sendCounts );
+    const auto& packDispls   = ( inverse ? meta.recvDispls : meta.sendDispls );
+    const auto& unpackIdx    = ( inverse ? meta.sendIdx    : meta.recvIdx    );
+    const auto& unpackRanks  = ( inverse ? meta.sendRanks  : meta.recvRanks  );
+    const auto& unpackCounts = ( inverse ? meta.sendCounts : meta.recvCounts );
+    const auto& unpackDispls = ( inverse ? meta.sendDispls : meta.recvDispls );
+
+    // Fill vectors with the send data of the entire group
+    const int totalSend = packCounts.back() + packDispls.back();
+    vector<T> sendData;
+    FastResize( sendData, mpi::Pad(totalSend) );
+    auto offsets = packDispls;
+    const int numSends = packIdx.size();
+    for( int send=0; send<numSends; ++send )
+    {
+        const int iLoc = packIdx[send];
+        const int rank = packRanks[send];
+        for( auto* A : As )
+        {
+            const Int localWidth = A->LocalWidth();
+            StridedMemCopy
+            ( &sendData[offsets[rank]], 1,
+              A->LockedBuffer(iLoc,0), A->LDim(), localWidth );
+            offsets[rank] += localWidth;
+        }
+    }
+
+    // Communicate the pivot rows of the entire group at once
+    const int totalRecv = unpackCounts.back() + unpackDispls.back();
+    vector<T> recvData;
+    FastResize( recvData, mpi::Pad(totalRecv) );
+    mpi::AllToAll
+    ( sendData.data(), packCounts.data(), packDispls.data(),
+      recvData.data(), unpackCounts.data(), unpackDispls.data(),
+      meta.comm );
+
+    // Unpack the recv data
+    offsets = unpackDispls;
+    const int numRecvs = unpackIdx.size();
+    for( int recv=0; recv<numRecvs; ++recv )
+    {
+        const int iLoc = unpackIdx[recv];
+        const int rank = unpackRanks[recv];
+        for( auto* A : As )
+        {
+            const Int localWidth = A->LocalWidth();
+            StridedMemCopy
+            ( A->Buffer(iLoc,0), A->LDim(),
+              &recvData[offsets[rank]], 1, localWidth );
+            offsets[rank] += localWidth;
+        }
+    }
+}
+
 void InvertPermutation
 ( const AbstractDistMatrix<Int>& pPre,
         AbstractDistMatrix<Int>& pInvPre )
@@ -329,6 +414,7 @@ void DistPermutation::Empty()
     implicitSwapOrigins_ = true;
     swapDests_.Empty();
     swapOrigins_.Empty();
+    staleComposition_ = true;
 
     // Only used if swapSequence_ = false
     // ----------------------------------
@@ -362,6 +448,7 @@ void DistPermutation::MakeIdentity( Int size )
 
     numSwaps_ = 0;
     implicitSwapOrigins_ = true;
+    staleComposition_ = true;
 }
 
 void DistPermutation::ReserveSwaps( Int maxSwaps )
@@ -400,6 +487,7 @@ void DistPermutation::Swap( Int origin, Int dest )
         staleMeta_ = true;
         return;
     }
+    staleComposition_ = true;
 
     if( !implicitSwapOrigins_ )
     {
@@ -566,24 +654,127 @@ void DistPermutation::MakeArbitrary() const
 
     // Compose the swaps into an explicit permutation vector
     // -----------------------------------------------------
+    ComposeSwaps();
+
+    // Clear the swap information
+    // --------------------------
+    swapSequence_ = false;
+    numSwaps_ = 0;
+    implicitSwapOrigins_ = true;
+    swapDests_.Empty();
+    swapOrigins_.Empty();
+    staleComposition_ = true;
+}
+
+void DistPermutation::ComposeSwaps() const
+{
+    EL_DEBUG_CSE
+    if( !swapSequence_ || !staleComposition_ )
+        return;
+
     perm_.Resize( size_, 1 );
     auto& permLoc = perm_.Matrix();
     const Int localHeight = perm_.LocalHeight();
     for( Int iLoc=0; iLoc<localHeight; ++iLoc )
         permLoc(iLoc) = perm_.GlobalRow(iLoc);
-    PermuteRows( perm_ );
+
+    auto activeInd = IR(0,numSwaps_);
+    DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
+    auto& destsLoc = dests_STAR_STAR.Matrix();
+    if( implicitSwapOrigins_ )
+    {
+        for( Int j=0; j<numSwaps_; ++j )
+            El::RowSwap( perm_, j, destsLoc(j) );
+    }
+    else
+    {
+        DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
+          swapOrigins_(activeInd,ALL);
+        auto& originsLoc = origins_STAR_STAR.Matrix();
+        for( Int j=0; j<numSwaps_; ++j )
+            El::RowSwap( perm_, originsLoc(j), destsLoc(j) );
+    }
 
     invPerm_.Resize( size_, 1 );
     staleInverse_ = true;
     staleMeta_ = true;
+    staleComposition_ = false;
+}
 
-    // Clear the swap information
-    // --------------------------
-    swapSequence_ = false;
-    numSwaps_ = 0;
-    implicitSwapOrigins_ = true;
-    swapDests_.Empty();
-    swapOrigins_.Empty();
+PermutationMeta& DistPermutation::RowPlan( Int align, mpi::Comm comm ) const
+{
+    EL_DEBUG_CSE
+    if( staleMeta_ )
+    {
+        rowMeta_.clear();
+        colMeta_.clear();
+        staleMeta_ = false;
+    }
+
+    // TODO(poulson): Move El::InversePermutation into this class
+    if( staleInverse_ )
+    {
+        InvertPermutation( perm_, invPerm_ );
+        staleInverse_ = false;
+    }
+
+    keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+    auto data = rowMeta_.find( key );
+    if( data == rowMeta_.end() )
+    {
+// TODO(poulson): Enable this branch; it apparently is not possible with
+// GCC 4.7.1
+#ifdef EL_HAVE_STD_EMPLACE
+        rowMeta_.emplace
+        ( std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(perm_,invPerm_,align,comm) );
+#else
+        auto newPair =
+          std::make_pair(key,PermutationMeta(perm_,invPerm_,align,comm));
+        rowMeta_.insert( newPair );
+#endif
+        data = rowMeta_.find( key );
+    }
+    return data->second;
+}
+
+PermutationMeta& DistPermutation::ColPlan( Int align, mpi::Comm comm ) const
+{
+    EL_DEBUG_CSE
+    if( staleMeta_ )
+    {
+        rowMeta_.clear();
+        colMeta_.clear();
+        staleMeta_ = false;
+    }
+
+    // TODO(poulson): Move El::InversePermutation into this class
+    if( staleInverse_ )
+    {
+        InvertPermutation( perm_, invPerm_ );
+        staleInverse_ = false;
+    }
+
+    keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+    auto data = colMeta_.find( key );
+    if( data == colMeta_.end() )
+    {
+// TODO(poulson): Enable this branch; it apparently is not possible with
+// GCC 4.7.1
+#ifdef EL_HAVE_STD_EMPLACE
+        colMeta_.emplace
+        ( std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(perm_,invPerm_,align,comm) );
+#else
+        auto newPair =
+          std::make_pair(key,PermutationMeta(perm_,invPerm_,align,comm));
+        colMeta_.insert( newPair );
+#endif
+        data = colMeta_.find( key );
+    }
+    return data->second;
 }
 
 const DistPermutation& DistPermutation::operator=( const Permutation& P )
@@ -615,6 +806,7 @@ const DistPermutation& DistPermutation::operator=( const Permutation& P )
     staleParity_ = P.staleParity_;
     staleInverse_ = P.staleInverse_;
     staleMeta_ = true;
+    staleComposition_ = true;
 
     return *this;
 }
@@ -642,6 +834,7 @@ const DistPermutation& DistPermutation::operator=( const DistPermutation& P )
     colMeta_ = P.colMeta_;
     rowMeta_ = P.rowMeta_;
     staleMeta_ = P.staleMeta_;
+    staleComposition_ = P.staleComposition_;
 
     return *this;
 }
@@ -725,7 +918,7 @@ void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
 {
     EL_DEBUG_CSE
     // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
+    if( swapSequence_ && offset != 0 )
     {
         const Int height = A.Height();
         const Int width = A.Width();
@@ -734,12 +927,6 @@ void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
 
         auto activeInd = IR(0,numSwaps_);
 
-        // TODO(poulson): Introduce an std::map for caching the pivots this
-        // process needs to care about to avoid redundant [STAR,STAR] formations
-        //
-        // TODO(poulson): Decide on the data structure; an std::vector of pivot
-        // origins and destinations?
-
         DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
         auto& destsLoc = dests_STAR_STAR.Matrix();
         if( implicitSwapOrigins_ )
@@ -763,51 +950,23 @@ void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
                 ColSwap( A, origin, dest );
             }
         }
+        return;
     }
-    else
-    {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
-
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
+    if( offset != 0 )
+        LogicError
+        ("General permutations are not supported with nonzero offsets");
 
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = colMeta_.find( key );
-        if( data == colMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-#ifdef EL_HAVE_STD_EMPLACE
-            colMeta_.emplace
-            ( std::piecewise_construct,
-              std::forward_as_tuple(key),
-              std::forward_as_tuple(perm_,invPerm_,align,comm) );
-#else
-            auto newPair =
-              std::make_pair(key,PermutationMeta(perm_,invPerm_,align,comm));
-            colMeta_.insert( newPair );
-#endif
-            data = colMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteCols into this class
-        El::PermuteCols( A, data->second );
+    if( swapSequence_ )
+    {
+        if( numSwaps_ == 0 )
+            return;
+        // Coalesce the per-swap exchanges into a single AllToAll by
+        // composing the swap sequence into an explicit permutation
+        ComposeSwaps();
     }
+
+    // TODO(poulson): Move El::PermuteCols into this class
+    El::PermuteCols( A, ColPlan(A.RowAlign(),A.RowComm()) );
 }
 
 template<typename T>
@@ -816,7 +975,7 @@ void DistPermutation::InversePermuteCols
 {
     EL_DEBUG_CSE
     // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
+    if( swapSequence_ && offset != 0 )
     {
         const Int height = A.Height();
         const Int width = A.Width();
@@ -848,51 +1007,23 @@ void DistPermutation::InversePermuteCols
                 ColSwap( A, origin, dest );
             }
         }
+        return;
     }
-    else
-    {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
-
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
+    if( offset != 0 )
+        LogicError
+        ("General permutations are not supported with nonzero offsets");
 
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = colMeta_.find( key );
-        if( data == colMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-#ifdef EL_HAVE_STD_EMPLACE
-            colMeta_.emplace
-            ( std::piecewise_construct,
-              std::forward_as_tuple(key),
-              std::forward_as_tuple(perm_,invPerm_,align,comm) );
-#else
-            auto newPair =
-              std::make_pair(key,PermutationMeta(perm_,invPerm_,align,comm));
-            colMeta_.insert( newPair );
-#endif
-            data = colMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteCols into this class
-        El::PermuteCols( A, data->second, true );
+    if( swapSequence_ )
+    {
+        if( numSwaps_ == 0 )
+            return;
+        // Coalesce the per-swap exchanges into a single AllToAll by
+        // composing the swap sequence into an explicit permutation
+        ComposeSwaps();
     }
+
+    // TODO(poulson): Move El::PermuteCols into this class
+    El::PermuteCols( A, ColPlan(A.RowAlign(),A.RowComm()), true );
 }
 
 template<typename T>
@@ -900,7 +1031,7 @@ void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
 {
     EL_DEBUG_CSE
     // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
+    if( swapSequence_ && offset != 0 )
     {
         const Int height = A.Height();
         const Int width = A.Width();
@@ -932,51 +1063,23 @@ void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
                 El::RowSwap( A, origin, dest );
             }
         }
+        return;
     }
-    else
-    {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
-
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
+    if( offset != 0 )
+        LogicError
+        ("General permutations are not supported with nonzero offsets");
 
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = rowMeta_.find( key );
-        if( data == rowMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-#ifdef EL_HAVE_STD_EMPLACE
-            rowMeta_.emplace
-            ( std::piecewise_construct,
-              std::forward_as_tuple(key),
-              std::forward_as_tuple(perm_,invPerm_,align,comm) );
-#else
-            auto newPair =
-              std::make_pair(key,PermutationMeta(perm_,invPerm_,align,comm));
-            rowMeta_.insert( newPair );
-#endif
-            data = rowMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteRows into this class
-        El::PermuteRows( A, data->second );
+    if( swapSequence_ )
+    {
+        if( numSwaps_ == 0 )
+            return;
+        // Coalesce the per-swap exchanges into a single AllToAll by
+        // composing the swap sequence into an explicit permutation
+        ComposeSwaps();
     }
+
+    // TODO(poulson): Move El::PermuteRows into this class
+    El::PermuteRows( A, RowPlan(A.ColAlign(),A.ColComm()) );
 }
 
 template<typename T>
@@ -985,7 +1088,7 @@ void DistPermutation::InversePermuteRows
 {
     EL_DEBUG_CSE
     // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
+    if( swapSequence_ && offset != 0 )
     {
         const Int height = A.Height();
         const Int width = A.Width();
@@ -1017,51 +1120,82 @@ void DistPermutation::InversePermuteRows
                 El::RowSwap( A, origin, dest );
             }
         }
+        return;
     }
-    else
+    if( offset != 0 )
+        LogicError
+        ("General permutations are not supported with nonzero offsets");
+
+    if( swapSequence_ )
     {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
+        if( numSwaps_ == 0 )
+            return;
+        // Coalesce the per-swap exchanges into a single AllToAll by
+        // composing the swap sequence into an explicit permutation
+        ComposeSwaps();
+    }
 
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
+    // TODO(poulson): Move El::PermuteRows into this class
+    El::PermuteRows( A, RowPlan(A.ColAlign(),A.ColComm()), true );
+}
 
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
+template<typename T>
+void DistPermutation::PermuteRows
+( const vector<AbstractDistMatrix<T>*>& As, Int offset ) const
+{
+    EL_DEBUG_CSE
+    if( As.empty() )
+        return;
+    bool batchable = ( offset == 0 );
+    for( size_t k=1; k<As.size(); ++k )
+        if( As[k]->ColAlign() != As[0]->ColAlign() ||
+            As[k]->ColComm() != As[0]->ColComm() ||
+            As[k]->Height() != As[0]->Height() )
+            batchable = false;
+    if( !batchable )
+    {
+        for( auto* A : As )
+            PermuteRows( *A, offset );
+        return;
+    }
 
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = rowMeta_.find( key );
-        if( data == rowMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-#ifdef EL_HAVE_STD_EMPLACE
-            rowMeta_.emplace
-            ( std::piecewise_construct,
-              std::forward_as_tuple(key),
-              std::forward_as_tuple(perm_,invPerm_,align,comm) );
-#else
-            auto newPair =
-              std::make_pair(key,PermutationMeta(perm_,invPerm_,align,comm));
-            rowMeta_.insert( newPair );
-#endif
-            data = rowMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteRows into this class
-        El::PermuteRows( A, data->second, true );
+    if( swapSequence_ )
+    {
+        if( numSwaps_ == 0 )
+            return;
+        ComposeSwaps();
     }
+    PermuteRowsBatched( As, RowPlan(As[0]->ColAlign(),As[0]->ColComm()) );
+}
+
+template<typename T>
+void DistPermutation::InversePermuteRows
+( const vector<AbstractDistMatrix<T>*>& As, Int offset ) const
+{
+    EL_DEBUG_CSE
+    if( As.empty() )
+        return;
+    bool batchable = ( offset == 0 );
+    for( size_t k=1; k<As.size(); ++k )
+        if( As[k]->ColAlign() != As[0]->ColAlign() ||
+            As[k]->ColComm() != As[0]->ColComm() ||
+            As[k]->Height() != As[0]->Height() )
+            batchable = false;
+    if( !batchable )
+    {
+        for( auto* A : As )
+            InversePermuteRows( *A, offset );
+        return;
+    }
+
+    if( swapSequence_ )
+    {
+        if( numSwaps_ == 0 )
+            return;
+        ComposeSwaps();
+    }
+    PermuteRowsBatched
+    ( As, RowPlan(As[0]->ColAlign(),As[0]->ColComm()), true );
 }
 
 template<typename T>
@@ -1241,6 +1375,12 @@ void DistPermutation::ExplicitMatrix( AbstractDistMatrix<Int>& P ) const
   template void DistPermutation::InversePermuteRows \
   ( AbstractDistMatrix<T>& A, \
     Int offset ) const; \
+  template void DistPermutation::PermuteRows \
+  ( const vector<AbstractDistMatrix<T>*>& As, \
+    Int offset ) const; \
+  template void DistPermutation::InversePermuteRows \
+  ( const vector<AbstractDistMatrix<T>*>& As, \
+    Int offset ) const; \
   template void DistPermutation::PermuteSymmetrically \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<T>& A, \
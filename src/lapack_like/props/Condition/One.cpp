@@ -38,9 +38,127 @@ Base<Field> OneCondition( const AbstractDistMatrix<Field>& A )
     return oneNorm*oneNormInv;
 }
 
+// Estimate || inv(A) ||_1 through the Hager-Higham iteration, with the
+// applications of inv(A) and inv(A)' performed through triangular solves
+// against an LU factorization rather than an explicit inverse
+template<typename Field>
+Base<Field> OneConditionEstimate( const Matrix<Field>& A, Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Cannot estimate condition number of nonsquare matrix");
+    if( n == 0 )
+        return 0;
+
+    const Real oneNorm = OneNorm( A );
+    Matrix<Field> B( A );
+    Permutation P;
+    try { LU( B, P ); }
+    catch( SingularMatrixException& e )
+    { return limits::Infinity<Real>(); }
+
+    auto signMap =
+      []( const Field& eta )
+      {
+          const Real absEta = Abs(eta);
+          return ( absEta == Real(0) ? Field(1) : eta/absEta );
+      };
+
+    Matrix<Field> x, y, z;
+    Ones( x, n, 1 );
+    Scale( Real(1)/Real(n), x );
+
+    Real invNormEst = 0;
+    Int lastIndex = -1;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        // y := inv(A) x
+        y = x;
+        lu::SolveAfter( NORMAL, B, P, y );
+        const Real newEst = OneNorm( y );
+        if( it > 0 && newEst <= invNormEst )
+            break;
+        invNormEst = newEst;
+
+        // z := inv(A)' sgn(y)
+        EntrywiseMap( y, function<Field(const Field&)>(signMap) );
+        z = y;
+        lu::SolveAfter( ADJOINT, B, P, z );
+        const auto maxLoc = VectorMaxAbsLoc( z );
+        if( maxLoc.value <= RealPart(Dot(x,z)) || maxLoc.index == lastIndex )
+            break;
+        lastIndex = maxLoc.index;
+        Zeros( x, n, 1 );
+        x.Set( maxLoc.index, 0, Field(1) );
+    }
+    return oneNorm*invNormEst;
+}
+
+template<typename Field>
+Base<Field> OneConditionEstimate( const AbstractDistMatrix<Field>& A, Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Cannot estimate condition number of nonsquare matrix");
+    if( n == 0 )
+        return 0;
+    const Grid& g = A.Grid();
+
+    const Real oneNorm = OneNorm( A );
+    DistMatrix<Field> B( A );
+    DistPermutation P( g );
+    try { LU( B, P ); }
+    catch( SingularMatrixException& e )
+    { return limits::Infinity<Real>(); }
+
+    auto signMap =
+      []( const Field& eta )
+      {
+          const Real absEta = Abs(eta);
+          return ( absEta == Real(0) ? Field(1) : eta/absEta );
+      };
+
+    DistMatrix<Field> x(g), y(g), z(g);
+    Ones( x, n, 1 );
+    Scale( Real(1)/Real(n), x );
+
+    Real invNormEst = 0;
+    Int lastIndex = -1;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        // y := inv(A) x
+        y = x;
+        lu::SolveAfter( NORMAL, B, P, y );
+        const Real newEst = OneNorm( y );
+        if( it > 0 && newEst <= invNormEst )
+            break;
+        invNormEst = newEst;
+
+        // z := inv(A)' sgn(y)
+        EntrywiseMap( y, function<Field(const Field&)>(signMap) );
+        z = y;
+        lu::SolveAfter( ADJOINT, B, P, z );
+        const auto maxLoc = VectorMaxAbsLoc( z );
+        if( maxLoc.value <= RealPart(Dot(x,z)) || maxLoc.index == lastIndex )
+            break;
+        lastIndex = maxLoc.index;
+        Zeros( x, n, 1 );
+        x.Set( maxLoc.index, 0, Field(1) );
+    }
+    return oneNorm*invNormEst;
+}
+
 #define PROTO(Field) \
   template Base<Field> OneCondition( const Matrix<Field>& A ); \
-  template Base<Field> OneCondition( const AbstractDistMatrix<Field>& A );
+  template Base<Field> OneCondition( const AbstractDistMatrix<Field>& A ); \
+  template Base<Field> OneConditionEstimate \
+  ( const Matrix<Field>& A, Int maxIts ); \
+  template Base<Field> OneConditionEstimate \
+  ( const AbstractDistMatrix<Field>& A, Int maxIts );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -180,6 +180,86 @@ Base<Field> HPDDeterminant
     return Exp(safeDet.kappa*safeDet.n);
 }
 
+// Monte Carlo workloads evaluate the determinants of thousands of modest
+// matrices per step, where the per-call dispatch overhead rivals the
+// factorization cost itself. Following BatchedGemm, the entire batch is
+// handed to the thread pool at once and the entries are factored
+// independently (det::LUPartialPiv and hpd_det::Cholesky already map
+// singular/indefinite pivots to rho=0 rather than throwing, so no
+// exceptions can escape the parallel region).
+
+template<typename Field>
+vector<SafeProduct<Field>> BatchedSafeDeterminant
+( vector<Matrix<Field>>& AList, bool canOverwrite )
+{
+    EL_DEBUG_CSE
+    const Int batchCount = AList.size();
+    // Malformed entries must be rejected before the parallel dispatch
+    for( Int b=0; b<batchCount; ++b )
+        if( AList[b].Height() != AList[b].Width() )
+            LogicError("Cannot compute determinant of nonsquare matrix");
+    vector<SafeProduct<Field>> dets( batchCount, SafeProduct<Field>(0) );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+    {
+        if( canOverwrite )
+        {
+            dets[b] = det::LUPartialPiv( AList[b] );
+        }
+        else
+        {
+            Matrix<Field> B( AList[b] );
+            dets[b] = det::LUPartialPiv( B );
+        }
+    }
+    return dets;
+}
+
+template<typename Field>
+vector<SafeProduct<Field>> BatchedSafeDeterminant
+( const vector<Matrix<Field>>& AList )
+{
+    EL_DEBUG_CSE
+    return BatchedSafeDeterminant
+           ( const_cast<vector<Matrix<Field>>&>(AList), false );
+}
+
+template<typename Field>
+vector<SafeProduct<Base<Field>>> BatchedSafeHPDDeterminant
+( UpperOrLower uplo, vector<Matrix<Field>>& AList, bool canOverwrite )
+{
+    EL_DEBUG_CSE
+    const Int batchCount = AList.size();
+    for( Int b=0; b<batchCount; ++b )
+        if( AList[b].Height() != AList[b].Width() )
+            LogicError("Cannot compute determinant of nonsquare matrix");
+    vector<SafeProduct<Base<Field>>> dets
+    ( batchCount, SafeProduct<Base<Field>>(0) );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+    {
+        if( canOverwrite )
+        {
+            dets[b] = hpd_det::Cholesky( uplo, AList[b] );
+        }
+        else
+        {
+            Matrix<Field> B( AList[b] );
+            dets[b] = hpd_det::Cholesky( uplo, B );
+        }
+    }
+    return dets;
+}
+
+template<typename Field>
+vector<SafeProduct<Base<Field>>> BatchedSafeHPDDeterminant
+( UpperOrLower uplo, const vector<Matrix<Field>>& AList )
+{
+    EL_DEBUG_CSE
+    return BatchedSafeHPDDeterminant
+           ( uplo, const_cast<vector<Matrix<Field>>&>(AList), false );
+}
+
 #define PROTO(Field) \
   template SafeProduct<Field> SafeDeterminant( const Matrix<Field>& A ); \
   template SafeProduct<Field> SafeDeterminant \
@@ -209,6 +289,14 @@ Base<Field> HPDDeterminant
   ( UpperOrLower uplo, Matrix<Field>& A, bool canOverwrite ); \
   template Base<Field> HPDDeterminant \
   ( UpperOrLower uplo, AbstractDistMatrix<Field>& A, bool canOverwrite ); \
+  template vector<SafeProduct<Field>> BatchedSafeDeterminant \
+  ( const vector<Matrix<Field>>& AList ); \
+  template vector<SafeProduct<Field>> BatchedSafeDeterminant \
+  ( vector<Matrix<Field>>& AList, bool canOverwrite ); \
+  template vector<SafeProduct<Base<Field>>> BatchedSafeHPDDeterminant \
+  ( UpperOrLower uplo, const vector<Matrix<Field>>& AList ); \
+  template vector<SafeProduct<Base<Field>>> BatchedSafeHPDDeterminant \
+  ( UpperOrLower uplo, vector<Matrix<Field>>& AList, bool canOverwrite ); \
   template SafeProduct<Base<Field>> hpd_det::AfterCholesky \
   ( UpperOrLower uplo, const Matrix<Field>& A ); \
   template SafeProduct<Base<Field>> hpd_det::AfterCholesky \
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "../factor/LDL/sparse/numeric/Process.hpp"
+
 namespace El {
 
 template<typename Field>
@@ -44,6 +46,88 @@ InertiaType Inertia
     return ldl::Inertia( GetRealPartOfDiagonal(A), dSub );
 }
 
+namespace multi_shift_inertia {
+
+template<typename Field>
+void Accumulate( const ldl::Front<Field>& front, InertiaType& inertia )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    for( const auto& child : front.children )
+        Accumulate( *child, inertia );
+    if( PivotedFactorization(front.type) )
+    {
+        // Two-by-two pivots never cross front boundaries, so the fronts
+        // may be counted independently
+        Matrix<Real> d;
+        RealPart( front.diag, d );
+        const InertiaType frontInertia = ldl::Inertia( d, front.subdiag );
+        inertia.numPositive += frontInertia.numPositive;
+        inertia.numNegative += frontInertia.numNegative;
+        inertia.numZero += frontInertia.numZero;
+    }
+    else
+    {
+        const Int numDiag = front.diag.Height();
+        for( Int i=0; i<numDiag; ++i )
+        {
+            const Real delta = RealPart(front.diag(i));
+            if( delta > Real(0) )
+                ++inertia.numPositive;
+            else if( delta < Real(0) )
+                ++inertia.numNegative;
+            else
+                ++inertia.numZero;
+        }
+    }
+}
+
+} // namespace multi_shift_inertia
+
+template<typename Field>
+vector<InertiaType> MultiShiftInertia
+( const SparseMatrix<Field>& A,
+  const vector<Base<Field>>& shifts,
+        LDLFrontType frontType,
+  const BisectCtrl& bisectCtrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int numShifts = shifts.size();
+    vector<InertiaType> inertias( numShifts, InertiaType{0,0,0} );
+    if( numShifts == 0 )
+        return inertias;
+
+    // Ensure that every diagonal entry is explicitly stored so that the
+    // nonzero pattern (and therefore the symbolic analysis) is
+    // shift-invariant
+    SparseMatrix<Field> ABase( A );
+    ShiftDiagonal( ABase, Field(0), 0, false );
+
+    // The symbolic analysis only depends upon the pattern and is shared by
+    // every shift
+    vector<Int> map;
+    ldl::Separator rootSep;
+    ldl::NodeInfo rootInfo;
+    ldl::NestedDissection
+    ( ABase.LockedGraph(), map, rootSep, rootInfo, bisectCtrl );
+
+    // The numeric factorizations are independent, so, as with BatchedGemm,
+    // the entire set of shifts is handed to the thread pool at once, with
+    // each worker pulling the shifted values into its own frontal tree
+    EL_PARALLEL_FOR
+    for( Int j=0; j<numShifts; ++j )
+    {
+        SparseMatrix<Field> AShifted( ABase );
+        ShiftDiagonal( AShifted, -shifts[j], 0, true );
+        ldl::Front<Field> front( AShifted, map, rootInfo, true );
+        ldl::Process( rootInfo, front, InitialFactorType(frontType) );
+        multi_shift_inertia::Accumulate( front, inertias[j] );
+    }
+    return inertias;
+}
+
 #define PROTO(Field) \
   template InertiaType Inertia \
   ( UpperOrLower uplo, \
@@ -52,7 +136,12 @@ InertiaType Inertia
   template InertiaType Inertia \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<Field>& A, \
-    const LDLPivotCtrl<Base<Field>>& ctrl );
+    const LDLPivotCtrl<Base<Field>>& ctrl ); \
+  template vector<InertiaType> MultiShiftInertia \
+  ( const SparseMatrix<Field>& A, \
+    const vector<Base<Field>>& shifts, \
+          LDLFrontType frontType, \
+    const BisectCtrl& bisectCtrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace one_est {
+
+// Overwrite each entry of y with y(i)/|y(i)| (with the convention that
+// vanishing entries are mapped to one)
+template<typename Field>
+void Signs( Matrix<Field>& y )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    auto signMap =
+      []( const Field& eta )
+      {
+          const Real absEta = Abs(eta);
+          return ( absEta == Real(0) ? Field(1) : eta/absEta );
+      };
+    EntrywiseMap( y, function<Field(const Field&)>(signMap) );
+}
+
+template<typename Field>
+void Signs( AbstractDistMatrix<Field>& y )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    auto signMap =
+      []( const Field& eta )
+      {
+          const Real absEta = Abs(eta);
+          return ( absEta == Real(0) ? Field(1) : eta/absEta );
+      };
+    EntrywiseMap( y, function<Field(const Field&)>(signMap) );
+}
+
+// Overwrite x with the oscillating probe vector of Higham and Tisseur,
+//   x(i) = (-1)^i (1 + i/(n-1)),
+// which guards the estimate against adversarial cancellation
+template<typename Field,class MatrixType>
+void OscillatingProbe( MatrixType& x, Int n )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real denom = Real(Max(n-1,Int(1)));
+    auto probe =
+      [denom]( Int i, Int )
+      {
+          const Real mag = Real(1) + Real(i)/denom;
+          return ( i % 2 == 0 ? Field(mag) : -Field(mag) );
+      };
+    x.Resize( n, 1 );
+    IndexDependentFill( x, function<Field(Int,Int)>(probe) );
+}
+
+} // namespace one_est
+
+template<typename Field>
+Base<Field> OneNormEstimate( const Matrix<Field>& A, Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m == 0 || n == 0 )
+        return 0;
+
+    // Begin with the uniform probe, whose image averages the column norms
+    Matrix<Field> x, y, z;
+    Ones( x, n, 1 );
+    Scale( Real(1)/Real(n), x );
+
+    Real estimate = 0;
+    Int lastIndex = -1;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        Gemv( NORMAL, Field(1), A, x, y );
+        const Real newEst = OneNorm( y );
+        if( it > 0 && newEst <= estimate )
+            break;
+        estimate = newEst;
+
+        one_est::Signs( y );
+        Gemv( ADJOINT, Field(1), A, y, z );
+        const auto maxLoc = VectorMaxAbsLoc( z );
+        // The lower bound cannot be improved if the subgradient condition
+        // || z ||_oo <= z' x already holds
+        if( maxLoc.value <= RealPart(Dot(x,z)) || maxLoc.index == lastIndex )
+            break;
+        lastIndex = maxLoc.index;
+        Zeros( x, n, 1 );
+        x.Set( maxLoc.index, 0, Field(1) );
+    }
+
+    // Guard against cancellation-prone counterexamples with the oscillating
+    // probe of Higham and Tisseur
+    one_est::OscillatingProbe<Field>( x, n );
+    Gemv( NORMAL, Field(1), A, x, y );
+    estimate = Max( estimate, 2*OneNorm(y)/Real(3*n) );
+
+    return estimate;
+}
+
+template<typename Field>
+Base<Field> OneNormEstimate( const AbstractDistMatrix<Field>& A, Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m == 0 || n == 0 )
+        return 0;
+    const Grid& g = A.Grid();
+
+    DistMatrix<Field> x(g), y(g), z(g);
+    Ones( x, n, 1 );
+    Scale( Real(1)/Real(n), x );
+
+    Real estimate = 0;
+    Int lastIndex = -1;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        Gemv( NORMAL, Field(1), A, x, y );
+        const Real newEst = OneNorm( y );
+        if( it > 0 && newEst <= estimate )
+            break;
+        estimate = newEst;
+
+        one_est::Signs( y );
+        Gemv( ADJOINT, Field(1), A, y, z );
+        const auto maxLoc = VectorMaxAbsLoc( z );
+        if( maxLoc.value <= RealPart(Dot(x,z)) || maxLoc.index == lastIndex )
+            break;
+        lastIndex = maxLoc.index;
+        Zeros( x, n, 1 );
+        x.Set( maxLoc.index, 0, Field(1) );
+    }
+
+    one_est::OscillatingProbe<Field>( x, n );
+    Gemv( NORMAL, Field(1), A, x, y );
+    estimate = Max( estimate, 2*OneNorm(y)/Real(3*n) );
+
+    return estimate;
+}
+
+#define PROTO(Field) \
+  template Base<Field> OneNormEstimate \
+  ( const Matrix<Field>& A, Int maxIts ); \
+  template Base<Field> OneNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, Int maxIts );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -74,9 +74,32 @@ SymmetricTwoNorm( UpperOrLower uplo, const AbstractDistMatrix<Field>& A )
     return MaxNorm( s );
 }
 
+template<typename Field>
+Base<Field> TwoNorm( const Matrix<Field>& A, const NormCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.estimate )
+        return TwoNormEstimate( A, ctrl.tol, ctrl.maxIts );
+    return TwoNorm( A );
+}
+
+template<typename Field>
+Base<Field> TwoNorm
+( const AbstractDistMatrix<Field>& A, const NormCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.estimate )
+        return TwoNormEstimate( A, ctrl.tol, ctrl.maxIts );
+    return TwoNorm( A );
+}
+
 #define PROTO(Field) \
   template Base<Field> TwoNorm( const Matrix<Field>& A ); \
   template Base<Field> TwoNorm( const AbstractDistMatrix<Field>& A ); \
+  template Base<Field> TwoNorm \
+  ( const Matrix<Field>& A, const NormCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> TwoNorm \
+  ( const AbstractDistMatrix<Field>& A, const NormCtrl<Base<Field>>& ctrl ); \
   template Base<Field> \
   HermitianTwoNorm( UpperOrLower uplo, const Matrix<Field>& A ); \
   template Base<Field> HermitianTwoNorm \
@@ -149,7 +149,11 @@ LV
     const Int m = H.Height();
     const Int n = Min(m,H.Width());
     const Int mRem = m-n;
-    const Int bsize = Blocksize();
+    // Since the compact-WY triangle is rebuilt directly from the Householder
+    // vectors, the group width is free to exceed the factorization
+    // blocksize; backward accumulation is Gemm-rich, so wider groups divide
+    // the number of latency-bound rounds at a negligible flop overhead
+    const Int bsize = 4*Blocksize();
     H.Resize( m, n );
     MakeTrapezoidal( LOWER, H, offset );
     FillDiagonal( H, F(1), offset );
@@ -164,7 +168,8 @@ LV
 
     DistMatrix<F,STAR,MR> Z_STAR_MR(g), ZNew_STAR_MR(g), ZOld_STAR_MR(g);
     DistMatrix<F,STAR,VR> Z_STAR_VR(g), ZNew_STAR_VR(g), ZOld_STAR_VR(g);
-    DistMatrix<F,STAR,STAR> householderScalars1_STAR_STAR(g), SInv_STAR_STAR(g);
+    DistMatrix<F,STAR,STAR> householderScalars1_STAR_STAR(g), SInv_STAR_STAR(g),
+                            HPanT_STAR_STAR(g);
 
     Int oldEffectedHeight=mRem;
 
@@ -195,21 +200,11 @@ LV
         auto householderScalars1 =
           householderScalars( IR(k-tOff,k-tOff+HPanWidth), ALL );
 
-        Z_STAR_MR.AlignWith( HEffected );
-        Z_STAR_MR.Resize( HPanWidth, effectedWidth );
-        PartitionLeft
-        ( Z_STAR_MR, ZNew_STAR_MR, ZOld_STAR_MR, oldEffectedWidth );
-
-        Z_STAR_VR.AlignWith( HEffected );
-        Z_STAR_VR.Resize( HPanWidth, effectedWidth );
-        PartitionLeft
-        ( Z_STAR_VR, ZNew_STAR_VR, ZOld_STAR_VR, oldEffectedWidth );
-
         HPan_VC_STAR = HPan;
         Zeros( SInv_STAR_STAR, HPanWidth, HPanWidth );
         Herk
-        ( UPPER, ADJOINT, 
-          Base<F>(1), HPan_VC_STAR.LockedMatrix(), 
+        ( UPPER, ADJOINT,
+          Base<F>(1), HPan_VC_STAR.LockedMatrix(),
           Base<F>(0), SInv_STAR_STAR.Matrix() );
         El::AllReduce( SInv_STAR_STAR, HPan_VC_STAR.ColComm() );
         householderScalars1_STAR_STAR = householderScalars1;
@@ -222,13 +217,46 @@ LV
         ( HPan_MC_STAR, HPanT_MC_STAR,
                         HPanB_MC_STAR, newEffectedWidth /* to match ZNew */ );
 
+        if( oldEffectedWidth == 0 && offset == 0 )
+        {
+            // The rightmost group: the effected portion of Q is still the
+            // identity, so its block column may be formed directly as
+            //   I - U inv(S) U_T^H,
+            // where the unit lower-triangular structure of U_T turns the
+            // general rank-HPanWidth update into a triangular multiply with
+            // half the flops (and no reduction is needed for the empty old
+            // portion)
+            HPanT_STAR_STAR = HPanT_MC_STAR;
+            LocalTrsm
+            ( RIGHT, UPPER, NORMAL, NON_UNIT,
+              F(1), SInv_STAR_STAR, HPan_MC_STAR );
+            LocalTrmm
+            ( RIGHT, LOWER, ADJOINT, UNIT,
+              F(-1), HPanT_STAR_STAR, HPan_MC_STAR );
+            Copy( HPan_MC_STAR, HEffected );
+            ShiftDiagonal( HEffected, F(1) );
+
+            oldEffectedHeight = effectedHeight;
+            continue;
+        }
+
+        Z_STAR_MR.AlignWith( HEffected );
+        Z_STAR_MR.Resize( HPanWidth, effectedWidth );
+        PartitionLeft
+        ( Z_STAR_MR, ZNew_STAR_MR, ZOld_STAR_MR, oldEffectedWidth );
+
+        Z_STAR_VR.AlignWith( HEffected );
+        Z_STAR_VR.Resize( HPanWidth, effectedWidth );
+        PartitionLeft
+        ( Z_STAR_VR, ZNew_STAR_VR, ZOld_STAR_VR, oldEffectedWidth );
+
         // Interleave the updates of the already effected portion of the matrix
-        // with the newly effected portion to lower latency and increase 
+        // with the newly effected portion to lower latency and increase
         // performance
         Adjoint( HPanT_MC_STAR, ZNew_STAR_VR );
         Zero( ZOld_STAR_MR );
         LocalGemm
-        ( ADJOINT, NORMAL, 
+        ( ADJOINT, NORMAL,
           F(1), HPanB_MC_STAR, HEffectedOldB, F(0), ZOld_STAR_MR );
         Contract( ZOld_STAR_MR, ZOld_STAR_VR );
         LocalTrsm
@@ -106,7 +106,172 @@ void HPDSolve
     sparseLDLFact.Solve( B );
 }
 
+template<typename Field>
+HPDSolver<Field>::HPDSolver()
+{ }
+
+template<typename Field>
+void HPDSolver<Field>::Factor( UpperOrLower uplo, const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    uplo_ = uplo;
+    chol_ = A;
+    Cholesky( uplo_, chol_ );
+    factored_ = true;
+}
+
+template<typename Field>
+void HPDSolver<Field>::Solve( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    Solve( NORMAL, B );
+}
+
+template<typename Field>
+void HPDSolver<Field>::Solve( Orientation orientation, Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    cholesky::SolveAfter( uplo_, orientation, chol_, B );
+}
+
+template<typename Field>
+Int HPDSolver<Field>::SolveWithIterativeRefinement
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  Base<Field> relTol,
+  Int maxRefineIts ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before SolveWithIterativeRefinement()");
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, X.Height(), X.Width() );
+          Hemm( LEFT, uplo_, Field(1), A, X, Field(0), Y );
+      };
+    auto applyAInv =
+      [&]( Matrix<Field>& Y )
+      { cholesky::SolveAfter( uplo_, NORMAL, chol_, Y ); };
+    const bool progress = false;
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+template<typename Field>
+bool HPDSolver<Field>::Factored() const
+{ return factored_; }
+
+template<typename Field>
+Int HPDSolver<Field>::Height() const
+{ return chol_.Height(); }
+
+template<typename Field>
+DistHPDSolver<Field>::DistHPDSolver()
+{ }
+
+template<typename Field>
+void DistHPDSolver<Field>::Factor
+( UpperOrLower uplo, const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    uplo_ = uplo;
+    chol_.SetGrid( A.Grid() );
+    Copy( A, chol_ );
+    Cholesky( uplo_, chol_ );
+    factored_ = true;
+}
+
+template<typename Field>
+void DistHPDSolver<Field>::Solve( AbstractDistMatrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    Solve( NORMAL, B );
+}
+
+template<typename Field>
+void DistHPDSolver<Field>::Solve
+( Orientation orientation, AbstractDistMatrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    cholesky::SolveAfter( uplo_, orientation, chol_, B );
+}
+
+template<typename Field>
+Int DistHPDSolver<Field>::SolveWithIterativeRefinement
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  Base<Field> relTol,
+  Int maxRefineIts ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before SolveWithIterativeRefinement()");
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.Get();
+    auto& B = BProx.Get();
+
+    auto BOrig( B );
+    const Base<Field> bNorm = FrobeniusNorm( B );
+
+    // Compute the initial guess and its residual, B := B - A X
+    DistMatrix<Field> X( B ), dX( A.Grid() ), Y( A.Grid() );
+    cholesky::SolveAfter( uplo_, NORMAL, chol_, X );
+    Zeros( Y, B.Height(), B.Width() );
+    Hemm( LEFT, uplo_, Field(1), A, X, Field(0), Y );
+    B -= Y;
+    Base<Field> errorNorm = FrobeniusNorm( B );
+
+    Int refineIt = 0;
+    while( refineIt < maxRefineIts && errorNorm > relTol*bNorm )
+    {
+        // Apply the correction and incrementally update the residual,
+        // periodically recomputing it from scratch to remove the
+        // accumulated roundoff
+        dX = B;
+        cholesky::SolveAfter( uplo_, NORMAL, chol_, dX );
+        X += dX;
+        ++refineIt;
+        if( refineIt % 4 == 0 )
+        {
+            Hemm( LEFT, uplo_, Field(1), A, X, Field(0), Y );
+            B = BOrig;
+            B -= Y;
+        }
+        else
+        {
+            Hemm( LEFT, uplo_, Field(1), A, dX, Field(0), Y );
+            B -= Y;
+        }
+        const Base<Field> newErrorNorm = FrobeniusNorm( B );
+        if( newErrorNorm >= errorNorm )
+        {
+            // The refinement stalled; undo the last update and stop
+            X -= dX;
+            break;
+        }
+        errorNorm = newErrorNorm;
+    }
+    B = X;
+    return refineIt;
+}
+
+template<typename Field>
+bool DistHPDSolver<Field>::Factored() const
+{ return factored_; }
+
+template<typename Field>
+Int DistHPDSolver<Field>::Height() const
+{ return chol_.Height(); }
+
 #define PROTO(Field) \
+  template class HPDSolver<Field>; \
+  template class DistHPDSolver<Field>; \
   template void hpd_solve::Overwrite \
   ( UpperOrLower uplo, Orientation orientation, \
     Matrix<Field>& A, Matrix<Field>& B ); \
@@ -74,7 +74,198 @@ void HermitianSolve
     SymmetricSolve( A, B, true, tryLDL, ctrl );
 }
 
+template<typename Field>
+HermitianSolver<Field>::HermitianSolver()
+{ }
+
+template<typename Field>
+void HermitianSolver<Field>::Factor
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  const LDLPivotCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( uplo == UPPER )
+        LogicError("Upper Bunch-Kaufman is not yet supported");
+    uplo_ = uplo;
+    LDL_ = A;
+    const bool hermitian = true;
+    LDL( LDL_, dSub_, P_, hermitian, ctrl );
+    factored_ = true;
+}
+
+template<typename Field>
+void HermitianSolver<Field>::Solve( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    Solve( NORMAL, B );
+}
+
+template<typename Field>
+void HermitianSolver<Field>::Solve
+( Orientation orientation, Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    const bool hermitian = true;
+    const bool conjFlip = ( orientation == TRANSPOSE );
+    if( conjFlip )
+        Conjugate( B );
+    ldl::SolveAfter( LDL_, dSub_, P_, B, hermitian );
+    if( conjFlip )
+        Conjugate( B );
+}
+
+template<typename Field>
+Int HermitianSolver<Field>::SolveWithIterativeRefinement
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  Base<Field> relTol,
+  Int maxRefineIts ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before SolveWithIterativeRefinement()");
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, X.Height(), X.Width() );
+          Hemm( LEFT, uplo_, Field(1), A, X, Field(0), Y );
+      };
+    auto applyAInv =
+      [&]( Matrix<Field>& Y )
+      { ldl::SolveAfter( LDL_, dSub_, P_, Y, true ); };
+    const bool progress = false;
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+template<typename Field>
+bool HermitianSolver<Field>::Factored() const
+{ return factored_; }
+
+template<typename Field>
+Int HermitianSolver<Field>::Height() const
+{ return LDL_.Height(); }
+
+template<typename Field>
+DistHermitianSolver<Field>::DistHermitianSolver()
+{ }
+
+template<typename Field>
+void DistHermitianSolver<Field>::Factor
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+  const LDLPivotCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( uplo == UPPER )
+        LogicError("Upper Bunch-Kaufman is not yet supported");
+    uplo_ = uplo;
+    LDL_.SetGrid( A.Grid() );
+    dSub_.SetGrid( A.Grid() );
+    P_.SetGrid( A.Grid() );
+    Copy( A, LDL_ );
+    const bool hermitian = true;
+    LDL( LDL_, dSub_, P_, hermitian, ctrl );
+    factored_ = true;
+}
+
+template<typename Field>
+void DistHermitianSolver<Field>::Solve( AbstractDistMatrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    Solve( NORMAL, B );
+}
+
+template<typename Field>
+void DistHermitianSolver<Field>::Solve
+( Orientation orientation, AbstractDistMatrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    const bool hermitian = true;
+    const bool conjFlip = ( orientation == TRANSPOSE );
+    if( conjFlip )
+        Conjugate( B );
+    ldl::SolveAfter( LDL_, dSub_, P_, B, hermitian );
+    if( conjFlip )
+        Conjugate( B );
+}
+
+template<typename Field>
+Int DistHermitianSolver<Field>::SolveWithIterativeRefinement
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  Base<Field> relTol,
+  Int maxRefineIts ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before SolveWithIterativeRefinement()");
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.Get();
+    auto& B = BProx.Get();
+
+    auto BOrig( B );
+    const Base<Field> bNorm = FrobeniusNorm( B );
+
+    // Compute the initial guess and its residual, B := B - A X
+    DistMatrix<Field> X( B ), dX( A.Grid() ), Y( A.Grid() );
+    ldl::SolveAfter( LDL_, dSub_, P_, X, true );
+    Zeros( Y, B.Height(), B.Width() );
+    Hemm( LEFT, uplo_, Field(1), A, X, Field(0), Y );
+    B -= Y;
+    Base<Field> errorNorm = FrobeniusNorm( B );
+
+    Int refineIt = 0;
+    while( refineIt < maxRefineIts && errorNorm > relTol*bNorm )
+    {
+        // Apply the correction and incrementally update the residual,
+        // periodically recomputing it from scratch to remove the
+        // accumulated roundoff
+        dX = B;
+        ldl::SolveAfter( LDL_, dSub_, P_, dX, true );
+        X += dX;
+        ++refineIt;
+        if( refineIt % 4 == 0 )
+        {
+            Hemm( LEFT, uplo_, Field(1), A, X, Field(0), Y );
+            B = BOrig;
+            B -= Y;
+        }
+        else
+        {
+            Hemm( LEFT, uplo_, Field(1), A, dX, Field(0), Y );
+            B -= Y;
+        }
+        const Base<Field> newErrorNorm = FrobeniusNorm( B );
+        if( newErrorNorm >= errorNorm )
+        {
+            // The refinement stalled; undo the last update and stop
+            X -= dX;
+            break;
+        }
+        errorNorm = newErrorNorm;
+    }
+    B = X;
+    return refineIt;
+}
+
+template<typename Field>
+bool DistHermitianSolver<Field>::Factored() const
+{ return factored_; }
+
+template<typename Field>
+Int DistHermitianSolver<Field>::Height() const
+{ return LDL_.Height(); }
+
 #define PROTO(Field) \
+  template class HermitianSolver<Field>; \
+  template class DistHermitianSolver<Field>; \
   template void herm_solve::Overwrite \
   ( UpperOrLower uplo, Orientation orientation, \
     Matrix<Field>& A, Matrix<Field>& B, \
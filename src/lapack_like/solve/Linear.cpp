@@ -267,6 +267,18 @@ void LinearSolve
     if( scalapack )
     {
 #ifdef EL_HAVE_SCALAPACK
+        // When the inputs are already block-cyclic over the (MC,MR) grid,
+        // bridge descriptors directly over their local buffers rather than
+        // redistributing into proxies with the default block size
+        if( A.Wrap() == BLOCK && B.Wrap() == BLOCK &&
+            ScaLAPACKCompatible( A ) && ScaLAPACKCompatible( B ) )
+        {
+            DistMatrix<Field,MC,MR,BLOCK> ABlock(A.Grid()), BBlock(B.Grid());
+            LockedAttachScaLAPACKView( A, ABlock );
+            AttachScaLAPACKView( B, BBlock );
+            lin_solve::ScaLAPACKHelper( ABlock, BBlock );
+            return;
+        }
         ProxyCtrl proxyCtrl;
         proxyCtrl.colConstrain = true;
         proxyCtrl.rowConstrain = true;
@@ -317,7 +329,169 @@ void LinearSolve
     B = X;
 }
 
+template<typename Field>
+LinearSolver<Field>::LinearSolver()
+{ }
+
+template<typename Field>
+void LinearSolver<Field>::Factor( const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Cannot factor a non-square matrix");
+    LU_ = A;
+    LU( LU_, P_ );
+    factored_ = true;
+}
+
+template<typename Field>
+void LinearSolver<Field>::Solve( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    Solve( NORMAL, B );
+}
+
+template<typename Field>
+void LinearSolver<Field>::Solve
+( Orientation orientation, Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    lu::SolveAfter( orientation, LU_, P_, B );
+}
+
+template<typename Field>
+Int LinearSolver<Field>::SolveWithIterativeRefinement
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  Base<Field> relTol,
+  Int maxRefineIts ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before SolveWithIterativeRefinement()");
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, Field(1), A, X, Y ); };
+    auto applyAInv =
+      [&]( Matrix<Field>& Y ) { lu::SolveAfter( NORMAL, LU_, P_, Y ); };
+    const bool progress = false;
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+template<typename Field>
+bool LinearSolver<Field>::Factored() const
+{ return factored_; }
+
+template<typename Field>
+Int LinearSolver<Field>::Height() const
+{ return LU_.Height(); }
+
+template<typename Field>
+DistLinearSolver<Field>::DistLinearSolver()
+{ }
+
+template<typename Field>
+void DistLinearSolver<Field>::Factor( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Cannot factor a non-square matrix");
+    LU_.SetGrid( A.Grid() );
+    P_.SetGrid( A.Grid() );
+    Copy( A, LU_ );
+    LU( LU_, P_ );
+    factored_ = true;
+}
+
+template<typename Field>
+void DistLinearSolver<Field>::Solve( AbstractDistMatrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    Solve( NORMAL, B );
+}
+
+template<typename Field>
+void DistLinearSolver<Field>::Solve
+( Orientation orientation, AbstractDistMatrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    lu::SolveAfter( orientation, LU_, P_, B );
+}
+
+template<typename Field>
+Int DistLinearSolver<Field>::SolveWithIterativeRefinement
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  Base<Field> relTol,
+  Int maxRefineIts ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before SolveWithIterativeRefinement()");
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.Get();
+    auto& B = BProx.Get();
+
+    auto BOrig( B );
+    const Base<Field> bNorm = FrobeniusNorm( B );
+
+    // Compute the initial guess and its residual, B := B - A X
+    DistMatrix<Field> X( B ), dX( A.Grid() ), Y( A.Grid() );
+    lu::SolveAfter( NORMAL, LU_, P_, X );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), B );
+    Base<Field> errorNorm = FrobeniusNorm( B );
+
+    Int refineIt = 0;
+    while( refineIt < maxRefineIts && errorNorm > relTol*bNorm )
+    {
+        // Apply the correction and incrementally update the residual,
+        // periodically recomputing it from scratch to remove the
+        // accumulated roundoff
+        dX = B;
+        lu::SolveAfter( NORMAL, LU_, P_, dX );
+        X += dX;
+        ++refineIt;
+        if( refineIt % 4 == 0 )
+        {
+            Gemm( NORMAL, NORMAL, Field(1), A, X, Y );
+            B = BOrig;
+            B -= Y;
+        }
+        else
+        {
+            Gemm( NORMAL, NORMAL, Field(1), A, dX, Y );
+            B -= Y;
+        }
+        const Base<Field> newErrorNorm = FrobeniusNorm( B );
+        if( newErrorNorm >= errorNorm )
+        {
+            // The refinement stalled; undo the last update and stop
+            X -= dX;
+            break;
+        }
+        errorNorm = newErrorNorm;
+    }
+    B = X;
+    return refineIt;
+}
+
+template<typename Field>
+bool DistLinearSolver<Field>::Factored() const
+{ return factored_; }
+
+template<typename Field>
+Int DistLinearSolver<Field>::Height() const
+{ return LU_.Height(); }
+
 #define PROTO(Field) \
+  template class LinearSolver<Field>; \
+  template class DistLinearSolver<Field>; \
   template void lin_solve::Overwrite( Matrix<Field>& A, Matrix<Field>& B ); \
   template void lin_solve::Overwrite \
   ( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B ); \
@@ -17,6 +17,14 @@
 // TODO(poulson): Expose interface which does not solve against Q, since that
 // step is not needed for two-norm pseudospectra
 
+// The shifted solves are advanced in lockstep: each column of H is streamed
+// through cache exactly once per step, and the updates of the solution and
+// workspace columns are fused into a single pass so that each of their
+// entries is loaded and stored only once per step. The distributed variants
+// gather an algorithmic-blocksize panel of H's columns at a time so that the
+// per-step broadcasts (both of the subdiagonal column and of the scalar
+// Hessenberg entries) are amortized over many steps.
+
 namespace El {
 namespace mshs {
 
@@ -52,7 +60,7 @@ LN
     // Simultaneously find the LQ factorization and solve against L
     for( Int k=0; k<m-1; ++k )
     {
-        auto hB = H( IR(k+2,m), IR(k+1) );
+        const Field* hBBuf = H.LockedBuffer(k+2,k+1);
         const Field etakkp1 = H(k,k+1);
         const Field etakp1kp1 = H(k+1,k+1);
         for( Int j=0; j<n; ++j )
@@ -80,20 +88,28 @@ LN
             const Field xc = X(k,j)*c;
             const Field xs  = X(k,j)*s;
             X(k+1,j) -= xc*W(k+1,j) + xs*(etakp1kp1-mu);
-            blas::Axpy
-            ( m-(k+2), -xc, W.LockedBuffer(k+2,j), 1, X.Buffer(k+2,j), 1 );
-            blas::Axpy
-            ( m-(k+2), -xs, hB.LockedBuffer(),     1, X.Buffer(k+2,j), 1 );
-
-            // Change the working vector, wB, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last
-            // to a fully-updated portion of the k+1'th column of this iteration
+
+            // Simultaneously change the working vector, wB, from representing
+            // a fully-updated portion of the k'th column of H from the end of
+            // the last iteration to a fully-updated portion of the k+1'th
+            // column of this iteration,
+            //
+            // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1),
             //
-            // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1)
+            // fused with the update of xB so that each entry of W and X is
+            // loaded and stored exactly once per step
             W(k+1,j) = -Conj(s)*W(k+1,j) + c*(etakp1kp1-mu);
-            blas::Scal( m-(k+2), -Conj(s), W.Buffer(k+2,j), 1 );
-            blas::Axpy
-            ( m-(k+2), Field(c), hB.LockedBuffer(), 1, W.Buffer(k+2,j), 1 );
+            const Field negConjs = -Conj(s);
+            Field* xBuf = X.Buffer(k+2,j);
+            Field* wBuf = W.Buffer(k+2,j);
+            const Int lengthB = m-(k+2);
+            for( Int i=0; i<lengthB; ++i )
+            {
+                const Field omega = wBuf[i];
+                const Field eta = hBBuf[i];
+                xBuf[i] -= xc*omega + xs*eta;
+                wBuf[i] = negConjs*omega + c*eta;
+            }
         }
     }
     // Divide x(end) by L(end,end)
@@ -149,7 +165,7 @@ UN
     // Simultaneously form the RQ factorization and solve against R
     for( Int k=m-1; k>0; --k )
     {
-        auto hT = H( IR(0,k-1), IR(k-1) );
+        const Field* hTBuf = H.LockedBuffer(0,k-1);
         const Field etakkm1 = H(k,k-1);
         const Field etakm1km1 = H(k-1,k-1);
         for( Int j=0; j<n; ++j )
@@ -173,21 +189,31 @@ UN
             // more concisely as xT -= x(k) * ( c wT + s hT ).
             // Note that we carefully handle updating the k-1'th entry since
             // it is shift-dependent.
+            //
+            // The change of the working vector, wT, from representing a
+            // fully-updated portion of the k'th column of H from the end of
+            // the last iteration to a fully-updated portion of the k-1'th
+            // column of this iteration,
+            //
+            // w(0:k-1) := -conj(s) H(0:k-1,k) + c H(0:k-1,k-1),
+            //
+            // is fused with the update of xT so that each entry of W and X
+            // is loaded and stored exactly once per step
             const Field mu = shifts(j);
             const Field xc = X(k,j)*c;
             const Field xs = X(k,j)*s;
-            blas::Axpy( k-1, -xc, W.LockedBuffer(0,j), 1, X.Buffer(0,j), 1 );
-            blas::Axpy( k-1, -xs, hT.LockedBuffer(),   1, X.Buffer(0,j), 1 );
+            const Field negConjs = -Conj(s);
+            Field* xBuf = X.Buffer(0,j);
+            Field* wBuf = W.Buffer(0,j);
+            for( Int i=0; i<k-1; ++i )
+            {
+                const Field omega = wBuf[i];
+                const Field eta = hTBuf[i];
+                xBuf[i] -= xc*omega + xs*eta;
+                wBuf[i] = negConjs*omega + c*eta;
+            }
             X(k-1,j) -= xc*W(k-1,j) + xs*(etakm1km1-mu);
-
-            // Change the working vector, wT, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last
-            // to a fully-updated portion of the k-1'th column of this iteration
-            //
-            // w(0:k-1) := -conj(s) H(0:k-1,k) + c H(0:k-1,k-1)
-            blas::Scal( k-1, -Conj(s), W.Buffer(0,j), 1 );
-            blas::Axpy( k-1, Field(c), hT.LockedBuffer(), 1, W.Buffer(0,j), 1 );
-            W(k-1,j) = -Conj(s)*W(k-1,j) + c*(etakm1km1-mu);
+            W(k-1,j) = negConjs*W(k-1,j) + c*(etakm1km1-mu);
         }
     }
     // Divide x(0) by R(0,0)
@@ -264,57 +290,75 @@ LN
         }
     }
 
-    // Simultaneously find the LQ factorization and solve against L
-    unique_ptr<AbstractDistMatrix<Field>> hB( H.Construct(H.Grid(),H.Root()) );
-    DistMatrix<Field,STAR,STAR> hB_STAR_STAR( H.Grid() );
-    for( Int k=0; k<m-1; ++k )
+    // Simultaneously find the LQ factorization and solve against L.
+    // The subdiagonal columns of H (including the scalar Hessenberg entries
+    // needed by each step) are gathered a panel at a time so that the
+    // broadcast cost is amortized over the steps of the panel rather than
+    // paid once per step.
+    const Int bsize = Blocksize();
+    unique_ptr<AbstractDistMatrix<Field>>
+      HPan( H.Construct(H.Grid(),H.Root()) );
+    DistMatrix<Field,STAR,STAR> HPan_STAR_STAR( H.Grid() );
+    for( Int kBeg=0; kBeg<m-1; kBeg+=bsize )
     {
-        LockedView( *hB, H, IR(k+2,m), IR(k+1) );
-        hB_STAR_STAR = *hB;
-        const Field etakkp1 = H.Get(k,k+1);
-        const Field etakp1kp1 = H.Get(k+1,k+1);
-        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        const Int kEnd = Min( kBeg+bsize, m-1 );
+        // Gather columns kBeg+1:kEnd of rows kBeg:m-1 of H
+        LockedView( *HPan, H, IR(kBeg,m), IR(kBeg+1,kEnd+1) );
+        HPan_STAR_STAR = *HPan;
+        auto& HPanLoc = HPan_STAR_STAR.LockedMatrix();
+        for( Int k=kBeg; k<kEnd; ++k )
         {
-            // Find the Givens rotation needed to zero H(k,k+1),
-            //   | c        s | | H(k,k)   | = | gamma |
-            //   | -conj(s) c | | H(k,k+1) |   | 0     |
-            Real c; Field s;
-            Givens( W(k,jLoc), etakkp1, c, s );
-            C(k,jLoc) = c;
-            S(k,jLoc) = s;
-
-            // The new diagonal value of L
-            const Field lambdakk = c*W(k,jLoc) + s*etakkp1;
-
-            // Divide our current entry of x by the diagonal value of L
-            XLoc(k,jLoc) /= lambdakk;
-
-            // x(k+1:end) -= x(k) * L(k+1:end,k), where
-            // L(k+1:end,k) = c H(k+1:end,k) + s H(k+1:end,k+1). We express this
-            // more concisely as xB -= x(k) * ( c wB + s hB ).
-            // Note that we carefully handle updating the k+1'th entry since
-            // it is shift-dependent.
-            const Field mu = shiftsLoc(jLoc);
-            const Field xc = XLoc(k,jLoc)*c;
-            const Field xs  = XLoc(k,jLoc)*s;
-            XLoc(k+1,jLoc) -= xc*W(k+1,jLoc) + xs*(etakp1kp1-mu);
-            blas::Axpy
-            ( m-(k+2), -xc, W.LockedBuffer(k+2,jLoc), 1,
-                            X.Buffer(k+2,jLoc),       1 );
-            blas::Axpy
-            ( m-(k+2), -xs, hB_STAR_STAR.LockedBuffer(), 1,
-                            X.Buffer(k+2,jLoc),          1 );
-
-            // Change the working vector, wB, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last
-            // to a fully-updated portion of the k+1'th column of this iteration
-            //
-            // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1)
-            W(k+1,jLoc) = -Conj(s)*W(k+1,jLoc) + c*(etakp1kp1-mu);
-            blas::Scal( m-(k+2), -Conj(s), W.Buffer(k+2,jLoc), 1 );
-            blas::Axpy
-            ( m-(k+2), Field(c), hB_STAR_STAR.LockedBuffer(), 1,
-                             W.Buffer(k+2,jLoc),          1 );
+            const Field* hBBuf = HPanLoc.LockedBuffer(k+2-kBeg,k-kBeg);
+            const Field etakkp1 = HPanLoc(k-kBeg,k-kBeg);
+            const Field etakp1kp1 = HPanLoc(k+1-kBeg,k-kBeg);
+            for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+            {
+                // Find the Givens rotation needed to zero H(k,k+1),
+                //   | c        s | | H(k,k)   | = | gamma |
+                //   | -conj(s) c | | H(k,k+1) |   | 0     |
+                Real c; Field s;
+                Givens( W(k,jLoc), etakkp1, c, s );
+                C(k,jLoc) = c;
+                S(k,jLoc) = s;
+
+                // The new diagonal value of L
+                const Field lambdakk = c*W(k,jLoc) + s*etakkp1;
+
+                // Divide our current entry of x by the diagonal value of L
+                XLoc(k,jLoc) /= lambdakk;
+
+                // x(k+1:end) -= x(k) * L(k+1:end,k), where
+                // L(k+1:end,k) = c H(k+1:end,k) + s H(k+1:end,k+1). We
+                // express this more concisely as xB -= x(k) * ( c wB + s hB ).
+                // Note that we carefully handle updating the k+1'th entry
+                // since it is shift-dependent.
+                const Field mu = shiftsLoc(jLoc);
+                const Field xc = XLoc(k,jLoc)*c;
+                const Field xs  = XLoc(k,jLoc)*s;
+                XLoc(k+1,jLoc) -= xc*W(k+1,jLoc) + xs*(etakp1kp1-mu);
+
+                // Simultaneously change the working vector, wB, from
+                // representing a fully-updated portion of the k'th column of
+                // H from the end of the last iteration to a fully-updated
+                // portion of the k+1'th column of this iteration,
+                //
+                // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1),
+                //
+                // fused with the update of xB so that each entry of W and X
+                // is loaded and stored exactly once per step
+                W(k+1,jLoc) = -Conj(s)*W(k+1,jLoc) + c*(etakp1kp1-mu);
+                const Field negConjs = -Conj(s);
+                Field* xBuf = X.Buffer(k+2,jLoc);
+                Field* wBuf = W.Buffer(k+2,jLoc);
+                const Int lengthB = m-(k+2);
+                for( Int i=0; i<lengthB; ++i )
+                {
+                    const Field omega = wBuf[i];
+                    const Field eta = hBBuf[i];
+                    xBuf[i] -= xc*omega + xs*eta;
+                    wBuf[i] = negConjs*omega + c*eta;
+                }
+            }
         }
     }
     // Divide x(end) by L(end,end)
@@ -386,54 +430,74 @@ UN
         }
     }
 
-    // Simultaneously form the RQ factorization and solve against R
-    unique_ptr<AbstractDistMatrix<Field>> hT( H.Construct(H.Grid(),H.Root()) );
-    DistMatrix<Field,STAR,STAR> hT_STAR_STAR( H.Grid() );
-    for( Int k=m-1; k>0; --k )
+    // Simultaneously form the RQ factorization and solve against R.
+    // The superdiagonal columns of H (including the scalar Hessenberg entries
+    // needed by each step) are gathered a panel at a time so that the
+    // broadcast cost is amortized over the steps of the panel rather than
+    // paid once per step.
+    const Int bsize = Blocksize();
+    unique_ptr<AbstractDistMatrix<Field>>
+      HPan( H.Construct(H.Grid(),H.Root()) );
+    DistMatrix<Field,STAR,STAR> HPan_STAR_STAR( H.Grid() );
+    for( Int kHi=m-1; kHi>0; kHi-=bsize )
     {
-        LockedView( *hT, H, IR(0,k-1), IR(k-1) );
-        hT_STAR_STAR = *hT;
-        const Field etakkm1 = H.Get(k,k-1);
-        const Field etakm1km1 = H.Get(k-1,k-1);
-        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        const Int kLo = Max( kHi-bsize+1, Int(1) );
+        // Gather columns kLo-1:kHi-1 of rows 0:kHi of H
+        LockedView( *HPan, H, IR(0,kHi+1), IR(kLo-1,kHi) );
+        HPan_STAR_STAR = *HPan;
+        auto& HPanLoc = HPan_STAR_STAR.LockedMatrix();
+        for( Int k=kHi; k>=kLo; --k )
         {
-            // Find the Givens rotation needed to zero H(k,k-1),
-            //   | c        s | | H(k,k)   | = | gamma |
-            //   | -conj(s) c | | H(k,k-1) |   | 0     |
-            Real c; Field s;
-            Givens( W(k,jLoc), etakkm1, c, s );
-            C(k,jLoc) = c;
-            S(k,jLoc) = s;
-
-            // The new diagonal value of R
-            const Field rhokk = c*W(k,jLoc) + s*etakkm1;
-
-            // Divide our current entry of x by the diagonal value of R
-            XLoc(k,jLoc) /= rhokk;
-
-            // x(0:k-1) -= x(k) * R(0:k-1,k), where
-            // R(0:k-1,k) = c H(0:k-1,k) + s H(0:k-1,k-1). We express this
-            // more concisely as xT -= x(k) * ( c wT + s hT ).
-            // Note that we carefully handle updating the k-1'th entry since
-            // it is shift-dependent.
-            const Field mu = shiftsLoc(jLoc);
-            const Field xc = XLoc(k,jLoc)*c;
-            const Field xs  = XLoc(k,jLoc)*s;
-            blas::Axpy
-            ( k-1, -xc, W.LockedBuffer(0,jLoc),      1, X.Buffer(0,jLoc), 1 );
-            blas::Axpy
-            ( k-1, -xs, hT_STAR_STAR.LockedBuffer(), 1, X.Buffer(0,jLoc), 1 );
-            XLoc(k-1,jLoc) -= xc*W(k-1,jLoc) + xs*(etakm1km1-mu);
-
-            // Change the working vector, wT, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last
-            // to a fully-updated portion of the k-1'th column of this iteration
-            //
-            // w(0:k-1) := -conj(s) H(0:k-1,k) + c H(0:k-1,k-1)
-            blas::Scal( k-1, -Conj(s), W.Buffer(0,jLoc), 1 );
-            blas::Axpy( k-1, Field(c), hT_STAR_STAR.LockedBuffer(), 1,
-                                   W.Buffer(0,jLoc),            1 );
-            W(k-1,jLoc) = -Conj(s)*W(k-1,jLoc) + c*(etakm1km1-mu);
+            const Field* hTBuf = HPanLoc.LockedBuffer(0,k-kLo);
+            const Field etakkm1 = HPanLoc(k,k-kLo);
+            const Field etakm1km1 = HPanLoc(k-1,k-kLo);
+            for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+            {
+                // Find the Givens rotation needed to zero H(k,k-1),
+                //   | c        s | | H(k,k)   | = | gamma |
+                //   | -conj(s) c | | H(k,k-1) |   | 0     |
+                Real c; Field s;
+                Givens( W(k,jLoc), etakkm1, c, s );
+                C(k,jLoc) = c;
+                S(k,jLoc) = s;
+
+                // The new diagonal value of R
+                const Field rhokk = c*W(k,jLoc) + s*etakkm1;
+
+                // Divide our current entry of x by the diagonal value of R
+                XLoc(k,jLoc) /= rhokk;
+
+                // x(0:k-1) -= x(k) * R(0:k-1,k), where
+                // R(0:k-1,k) = c H(0:k-1,k) + s H(0:k-1,k-1). We express this
+                // more concisely as xT -= x(k) * ( c wT + s hT ).
+                // Note that we carefully handle updating the k-1'th entry
+                // since it is shift-dependent.
+                //
+                // The change of the working vector, wT, from representing a
+                // fully-updated portion of the k'th column of H from the end
+                // of the last iteration to a fully-updated portion of the
+                // k-1'th column of this iteration,
+                //
+                // w(0:k-1) := -conj(s) H(0:k-1,k) + c H(0:k-1,k-1),
+                //
+                // is fused with the update of xT so that each entry of W and
+                // X is loaded and stored exactly once per step
+                const Field mu = shiftsLoc(jLoc);
+                const Field xc = XLoc(k,jLoc)*c;
+                const Field xs  = XLoc(k,jLoc)*s;
+                const Field negConjs = -Conj(s);
+                Field* xBuf = X.Buffer(0,jLoc);
+                Field* wBuf = W.Buffer(0,jLoc);
+                for( Int i=0; i<k-1; ++i )
+                {
+                    const Field omega = wBuf[i];
+                    const Field eta = hTBuf[i];
+                    xBuf[i] -= xc*omega + xs*eta;
+                    wBuf[i] = negConjs*omega + c*eta;
+                }
+                XLoc(k-1,jLoc) -= xc*W(k-1,jLoc) + xs*(etakm1km1-mu);
+                W(k-1,jLoc) = negConjs*W(k-1,jLoc) + c*(etakm1km1-mu);
+            }
         }
     }
     for( Int jLoc=0; jLoc<nLoc; ++jLoc )
@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Mixed-precision iterative refinement: the system matrix is demoted to the
+// next-lower precision (e.g., from double to float), factored there with
+// partial pivoting, and the factorization is used as a preconditioner for
+// refinement in the working precision. When no lower precision is available
+// for the given field, the factorization simply occurs in the working
+// precision and the refinement polishes the usual rounding errors.
+
+namespace El {
+
+template<typename Field>
+Int RefinedSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  Base<Field> relTol,
+  Int maxRefineIts,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    typedef Demote<Field> FieldLow;
+
+    Matrix<FieldLow> ALow;
+    Copy( A, ALow );
+    Permutation P;
+    LU( ALow, P );
+
+    Matrix<FieldLow> YLow;
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, Field(1), A, X, Y ); };
+    auto applyAInv =
+      [&]( Matrix<Field>& Y )
+      {
+          Copy( Y, YLow );
+          lu::SolveAfter( NORMAL, ALow, P, YLow );
+          Copy( YLow, Y );
+      };
+
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+template<typename Field>
+Int RefinedSolve
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  Base<Field> relTol,
+  Int maxRefineIts,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() != APre.Width() )
+        LogicError("A must be square");
+    typedef Demote<Field> FieldLow;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& grid = A.Grid();
+
+    DistMatrix<FieldLow> ALow(grid);
+    Copy( A, ALow );
+    DistPermutation P(grid);
+    LU( ALow, P );
+
+    DistMatrix<FieldLow> YLow(grid);
+    auto applyAInv =
+      [&]( DistMatrix<Field>& Y )
+      {
+          Copy( Y, YLow );
+          lu::SolveAfter( NORMAL, ALow, P, YLow );
+          Copy( YLow, Y );
+      };
+
+    // Compute the initial guess
+    // =========================
+    const Base<Field> bNorm = MaxNorm( B );
+    auto BOrig = B;
+    auto X = B;
+    applyAInv( X );
+
+    DistMatrix<Field> Y(grid);
+    Gemm( NORMAL, NORMAL, Field(1), A, X, Y );
+    B -= Y;
+
+    Int refineIt = 0;
+    auto errorNorm = MaxNorm( B );
+    if( progress && grid.Rank() == 0 )
+        Output("original rel error: ",errorNorm/bNorm);
+    while( errorNorm/bNorm > relTol && refineIt < maxRefineIts )
+    {
+        // Compute the proposed update to the solution
+        // -------------------------------------------
+        auto dX = B;
+        applyAInv( dX );
+        X += dX;
+        ++refineIt;
+
+        // Compute the new residual
+        // ------------------------
+        Gemm( NORMAL, NORMAL, Field(1), A, X, Y );
+        B = BOrig;
+        B -= Y;
+        errorNorm = MaxNorm( B );
+        if( progress && grid.Rank() == 0 )
+            Output("refined rel error: ",errorNorm/bNorm);
+    }
+    B = X;
+    return refineIt;
+}
+
+#define PROTO(Field) \
+  template Int RefinedSolve \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    Base<Field> relTol, \
+    Int maxRefineIts, \
+    bool progress ); \
+  template Int RefinedSolve \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    Base<Field> relTol, \
+    Int maxRefineIts, \
+    bool progress );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -592,8 +592,6 @@ Merge
 
     if( ctrl.progress )
         Output("Solving secular equation and correcting update vector");
-    Matrix<Real> rCorrected;
-    Ones( rCorrected, numUndeflated, 1 );
 
     // Ensure that there is sufficient space for storing the needed singular
     // vectors from the undeflated secular equation. Notice that we *always*
@@ -607,48 +605,61 @@ Merge
     else
         VSecular.Resize( numUndeflated, numUndeflated );
 
-    // For temporarily storing dUndeflated + d(j)
-    Matrix<Real> plusShift;
-    if( ctrl.wantU )
-        View( plusShift, USecular, ALL, IR(0) );
-    else
-        plusShift.Resize( numUndeflated, 1 );
-
+    // The roots of the secular equation are independent of each other, so we
+    // solve for them in parallel (with a per-root scratch vector for the
+    // shifted diagonal) and accumulate the iteration counts afterwards
+    vector<SecularSVDInfo> valueInfos(numUndeflated);
+    EL_PARALLEL_FOR
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto minusShift = VSecular( ALL, IR(j) );
+        // For temporarily storing dUndeflated + d(j)
+        Matrix<Real> plusShift;
 
-        auto valueInfo =
+        valueInfos[j] =
           SecularSingularValue
           ( j, dUndeflated, rho, rUndeflated, d(j), minusShift, plusShift,
             dcCtrl.secularCtrl );
         if( ctrl.progress )
             Output("Secular singular value ",j," is ",d(j));
 
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
         // minusShift currently holds dUndeflated-d(j) and plusShift
         // holds dUndeflated+d(j). Overwrite minusShift with their
         // element-wise product since that is all we require from here on
         // out.
         for( Int k=0; k<numUndeflated; ++k )
             minusShift(k) *= plusShift(k);
+    }
+    for( Int j=0; j<numUndeflated; ++j )
+    {
+        secularInfo.numIterations += valueInfos[j].numIterations;
+        secularInfo.numAlternations += valueInfos[j].numAlternations;
+        secularInfo.numCubicIterations += valueInfos[j].numCubicIterations;
+        secularInfo.numCubicFailures += valueInfos[j].numCubicFailures;
+    }
 
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
+    // Each entry of the corrected update vector is a product over all of the
+    // roots, so, rather than scattering each root's contribution into every
+    // entry as it is found, we gather the contributions of the (already
+    // computed) roots into each entry independently (preserving the order of
+    // the factors)
+    Matrix<Real> rCorrected;
+    rCorrected.Resize( numUndeflated, 1 );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        Real rProd = 1;
+        for( Int j=0; j<numUndeflated; ++j )
         {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) /
-              ((dUndeflated(j)+dUndeflated(k))*
-               (dUndeflated(j)-dUndeflated(k)));
+            if( j == k )
+                rProd *= VSecular(k,j);
+            else
+                rProd *= VSecular(k,j) /
+                  ((dUndeflated(j)+dUndeflated(k))*
+                   (dUndeflated(j)-dUndeflated(k)));
         }
+        rCorrected(k) = Sgn(rUndeflated(k),false) * Sqrt(Abs(rProd));
     }
-    for( Int j=0; j<numUndeflated; ++j )
-        rCorrected(j) = Sgn(rUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
     // Compute the unnormalized left and right singular vectors via Eqs. (3.4)
     // and (3.3), respectively, from Gu/Eisenstat [CITATION].
@@ -656,6 +667,7 @@ Merge
         Output("Computing unnormalized singular vectors");
     if( ctrl.wantU )
     {
+        EL_PARALLEL_FOR
         for( Int j=0; j<numUndeflated; ++j )
         {
             auto u = USecular(ALL,IR(j));
@@ -675,6 +687,7 @@ Merge
     }
     else
     {
+        EL_PARALLEL_FOR
         for( Int j=0; j<numUndeflated; ++j )
         {
             auto v = VSecular(ALL,IR(j));
@@ -697,9 +710,13 @@ Merge
     if( ctrl.progress )
         Output("Forming undeflated left singular vectors");
     Matrix<Real> Q;
+    // Force the permutation out of its lazy swap-sequence representation so
+    // that the preimage queries below are read-only
+    packingPerm.MakeArbitrary();
     if( ctrl.wantU )
     {
         Zeros( Q, numUndeflated, numUndeflated );
+        EL_PARALLEL_FOR
         for( Int j=0; j<numUndeflated; ++j )
         {
             auto u = USecular(ALL,IR(j));
@@ -767,6 +784,7 @@ Merge
     if( ctrl.progress )
         Output("Forming undeflated right singular vectors");
     Q.Resize( numUndeflated, numUndeflated );
+    EL_PARALLEL_FOR
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto v = VSecular(ALL,IR(j));
@@ -1726,7 +1744,8 @@ DivideAndConquer
         Matrix<Real>& U,
         Matrix<Real>& s,
         Matrix<Real>& V,
-  const BidiagSVDCtrl<Real>& ctrl )
+  const BidiagSVDCtrl<Real>& ctrl,
+  bool topLevel=true )
 {
     EL_DEBUG_CSE
     const Int m = mainDiag.Height();
@@ -1795,11 +1814,41 @@ DivideAndConquer
         Zeros( V1, 2, n-(split+1) );
     }
 
-    Matrix<Real> s0;
-    auto info0 = DivideAndConquer( mainDiag0, superDiag0, U0, s0, V0, ctrl );
-
-    Matrix<Real> s1;
-    auto info1 = DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, ctrl );
+    // The two subproblems are independent, so solve the left subtree in a
+    // task while this thread continues with the right (the tasks degrade to
+    // an in-order traversal without OpenMP task support). At the top level,
+    // the tasks are spawned from a single thread of a fresh team so that the
+    // idle threads can steal the subtrees; the region ends before the
+    // top-level merge so that the loop-level parallelism of the merge is not
+    // nested inside of it.
+    Matrix<Real> s0, s1;
+    DCInfo info0, info1;
+    if( topLevel )
+    {
+        EL_TASK_REGION
+        {
+            EL_TASK
+            {
+                info0 =
+                  DivideAndConquer
+                  ( mainDiag0, superDiag0, U0, s0, V0, ctrl, false );
+            }
+            info1 =
+              DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, ctrl, false );
+            EL_TASKWAIT
+        }
+    }
+    else
+    {
+        EL_TASK
+        {
+            info0 =
+              DivideAndConquer( mainDiag0, superDiag0, U0, s0, V0, ctrl, false );
+        }
+        info1 =
+          DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, ctrl, false );
+        EL_TASKWAIT
+    }
 
     if( !ctrl.wantV )
     {
@@ -0,0 +1,82 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+void BlockLanczos
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& T,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    Matrix<Field> V, W;
+    block_lanczos::Run( n, applyA, V, W, T, ctrl );
+}
+
+template<typename Field>
+void BlockLanczos
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Field>& TPre,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    const Grid& grid = A.Grid();
+
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+
+    DistMatrixWriteProxy<Field,Field,STAR,STAR> TProx( TPre );
+    auto& T = TProx.Get();
+
+    // Every update to the projection is formed from globally-reduced data,
+    // so it can be maintained redundantly on each rank
+    Matrix<Field> TRedundant;
+    DistMultiVec<Field> V(grid), W(grid);
+    block_lanczos::Run( n, applyA, V, W, TRedundant, ctrl );
+    T.Resize( TRedundant.Height(), TRedundant.Width() );
+    T.Matrix() = TRedundant;
+}
+
+#define PROTO(Field) \
+  template void BlockLanczos \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Field>& T, \
+    const BlockLanczosCtrl<Base<Field>>& ctrl ); \
+  template void BlockLanczos \
+  ( const DistSparseMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& T, \
+    const BlockLanczosCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
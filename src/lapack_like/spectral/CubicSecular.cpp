@@ -125,7 +125,7 @@ CubicSecular
 
     bool rescale = false;
     Real scaleInv(1);
-    Matrix<Real> zScaled(3,1), dScaled(3,1);
+    StaticMatrix<Real,3,1> zScaled, dScaled;
     Real maxDenomAbs;
     if( rightRoot )
     {
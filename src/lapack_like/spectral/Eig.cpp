@@ -12,11 +12,39 @@ namespace El {
 
 namespace eig {
 
+// The pipeline is planned so that each stage runs in place where possible
+// (the Schur reduction overwrites A, and the back-transformation is a
+// right-sided Trmm on X) and every full-size temporary is released as soon
+// as the following stage has absorbed it. The peak of the real-field
+// pipeline is reached during the triangular eigenvector solve, where the
+// complexified Schur factor and the triangular eigenvector matrix coexist;
+// with ctrl.destroyInput the caller's A has already been emptied by then.
+
+template<typename Field>
+size_t PeakExtraEntries( Int n )
+{
+    const size_t nSq = size_t(n)*size_t(n);
+    if( IsComplex<Field>::value )
+    {
+        // The triangular eigenvector matrix of TriangEig
+        return nSq;
+    }
+    else
+    {
+        // Maximum of the complexification stage (the real Schur vectors,
+        // at half a complex entry per entry, next to the complexified
+        // factor) and the eigenvector solve (the complexified factor next
+        // to the triangular eigenvector matrix)
+        return Max( nSq+nSq/2, 2*nSq );
+    }
+}
+
 template<typename Real>
 void Helper
 ( Matrix<Real>& A,
   Matrix<Complex<Real>>& w,
-  Matrix<Complex<Real>>& X )
+  Matrix<Complex<Real>>& X,
+  const EigCtrl& ctrl )
 {
     EL_DEBUG_CSE
     typedef Complex<Real> C;
@@ -26,9 +54,16 @@ void Helper
 
     Matrix<C> ACpx;
     schur::RealToComplex( A, Q, ACpx, X );
+    // The real Schur factor and its vectors have been absorbed into their
+    // complex counterparts; release them before the eigenvector solve
+    // allocates its triangular workspace
+    Q.Empty();
+    if( ctrl.destroyInput )
+        A.Empty();
 
     Matrix<C> R;
     TriangEig( ACpx, R );
+    ACpx.Empty();
 
     Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, C(1), R, X );
 }
@@ -37,7 +72,8 @@ template<typename Real>
 void Helper
 ( Matrix<Complex<Real>>& A,
   Matrix<Complex<Real>>& w,
-  Matrix<Complex<Real>>& X )
+  Matrix<Complex<Real>>& X,
+  const EigCtrl& ctrl )
 {
     EL_DEBUG_CSE
     typedef Complex<Real> C;
@@ -46,6 +82,8 @@ void Helper
 
     Matrix<C> R;
     TriangEig( A, R );
+    if( ctrl.destroyInput )
+        A.Empty();
 
     Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, C(1), R, X );
 }
@@ -54,7 +92,8 @@ template<typename Real>
 void Helper
 ( AbstractDistMatrix<Real>& APre,
   AbstractDistMatrix<Complex<Real>>& w,
-  AbstractDistMatrix<Complex<Real>>& XPre )
+  AbstractDistMatrix<Complex<Real>>& XPre,
+  const EigCtrl& ctrl )
 {
     EL_DEBUG_CSE
     typedef Complex<Real> C;
@@ -70,9 +109,16 @@ void Helper
 
     DistMatrix<C> ACpx(g);
     schur::RealToComplex( A, Q, ACpx, X );
+    // The real Schur factor and its vectors have been absorbed into their
+    // complex counterparts; release them before the eigenvector solve
+    // allocates its triangular workspace
+    Q.Empty();
+    if( ctrl.destroyInput )
+        A.Empty();
 
     DistMatrix<C> R(g);
     TriangEig( ACpx, R );
+    ACpx.Empty();
 
     Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, C(1), R, X );
 }
@@ -81,7 +127,8 @@ template<typename Real>
 void Helper
 ( AbstractDistMatrix<Complex<Real>>& APre,
   AbstractDistMatrix<Complex<Real>>& w,
-  AbstractDistMatrix<Complex<Real>>& XPre )
+  AbstractDistMatrix<Complex<Real>>& XPre,
+  const EigCtrl& ctrl )
 {
     EL_DEBUG_CSE
     typedef Complex<Real> C;
@@ -95,6 +142,8 @@ void Helper
 
     DistMatrix<C> R( A.Grid() );
     TriangEig( A, R );
+    if( ctrl.destroyInput )
+        A.Empty();
 
     Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, C(1), R, X );
 }
@@ -105,31 +154,36 @@ template<typename Field>
 void Eig
 ( Matrix<Field>& A,
   Matrix<Complex<Base<Field>>>& w,
-  Matrix<Complex<Base<Field>>>& X )
+  Matrix<Complex<Base<Field>>>& X,
+  const EigCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    eig::Helper( A, w, X );
+    eig::Helper( A, w, X, ctrl );
 }
 
 template<typename Field>
 void Eig
 ( AbstractDistMatrix<Field>& A,
   AbstractDistMatrix<Complex<Base<Field>>>& w,
-  AbstractDistMatrix<Complex<Base<Field>>>& X )
+  AbstractDistMatrix<Complex<Base<Field>>>& X,
+  const EigCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    eig::Helper( A, w, X );
+    eig::Helper( A, w, X, ctrl );
 }
 
 #define PROTO(Field) \
+  template size_t eig::PeakExtraEntries<Field>( Int n ); \
   template void Eig \
   ( Matrix<Field>& A, \
     Matrix<Complex<Base<Field>>>& w, \
-    Matrix<Complex<Base<Field>>>& X ); \
+    Matrix<Complex<Base<Field>>>& X, \
+    const EigCtrl& ctrl ); \
   template void Eig \
   ( AbstractDistMatrix<Field>& A, \
     AbstractDistMatrix<Complex<Base<Field>>>& w, \
-    AbstractDistMatrix<Complex<Base<Field>>>& X );
+    AbstractDistMatrix<Complex<Base<Field>>>& X, \
+    const EigCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #include <El/macros/Instantiate.h>
@@ -148,6 +148,190 @@ HermitianGenDefEig
     return info;
 }
 
+// Repeated solves against a fixed B
+// =================================
+
+template<typename Field>
+HermitianGenDefEigSolver<Field>::HermitianGenDefEigSolver()
+{ }
+
+template<typename Field>
+HermitianGenDefEigSolver<Field>::HermitianGenDefEigSolver
+( Pencil pencil, UpperOrLower uplo, const Matrix<Field>& B )
+{ Factor( pencil, uplo, B ); }
+
+template<typename Field>
+void HermitianGenDefEigSolver<Field>::Factor
+( Pencil pencil, UpperOrLower uplo, const Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.Height() != B.Width() )
+          LogicError("Hermitian matrices must be square.");
+    )
+    pencil_ = pencil;
+    uplo_ = uplo;
+    cholB_ = B;
+    Cholesky( uplo_, cholB_ );
+    factored_ = true;
+}
+
+template<typename Field>
+bool HermitianGenDefEigSolver<Field>::Factored() const
+{ return factored_; }
+
+template<typename Field>
+HermitianEigInfo
+HermitianGenDefEigSolver<Field>::Solve
+(       Matrix<Field>& A,
+        Matrix<Base<Field>>& w,
+  const HermitianEigCtrl<Field>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The fixed matrix of the pencil has not been factored");
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() || A.Height() != cholB_.Height() )
+          LogicError("A did not conform with the cached factor");
+    )
+    if( pencil_ == AXBX )
+        TwoSidedTrsm( uplo_, NON_UNIT, A, cholB_ );
+    else
+        TwoSidedTrmm( uplo_, NON_UNIT, A, cholB_ );
+    return HermitianEig( uplo_, A, w, ctrl );
+}
+
+template<typename Field>
+HermitianEigInfo
+HermitianGenDefEigSolver<Field>::Solve
+(       Matrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const HermitianEigCtrl<Field>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The fixed matrix of the pencil has not been factored");
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() || A.Height() != cholB_.Height() )
+          LogicError("A did not conform with the cached factor");
+    )
+    if( pencil_ == AXBX )
+        TwoSidedTrsm( uplo_, NON_UNIT, A, cholB_ );
+    else
+        TwoSidedTrmm( uplo_, NON_UNIT, A, cholB_ );
+    auto info = HermitianEig( uplo_, A, w, X, ctrl );
+    // The back-transformation only touches the extracted eigenvector panel
+    if( pencil_ == AXBX || pencil_ == ABX )
+    {
+        const Orientation orientation = ( uplo_==LOWER ? ADJOINT : NORMAL );
+        Trsm( LEFT, uplo_, orientation, NON_UNIT, Field(1), cholB_, X );
+    }
+    else /* pencil_ == BAX */
+    {
+        const Orientation orientation = ( uplo_==LOWER ? NORMAL : ADJOINT );
+        Trmm( LEFT, uplo_, orientation, NON_UNIT, Field(1), cholB_, X );
+    }
+    return info;
+}
+
+template<typename Field>
+DistHermitianGenDefEigSolver<Field>::DistHermitianGenDefEigSolver()
+{ }
+
+template<typename Field>
+DistHermitianGenDefEigSolver<Field>::DistHermitianGenDefEigSolver
+( Pencil pencil, UpperOrLower uplo, const AbstractDistMatrix<Field>& B )
+{ Factor( pencil, uplo, B ); }
+
+template<typename Field>
+void DistHermitianGenDefEigSolver<Field>::Factor
+( Pencil pencil, UpperOrLower uplo, const AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.Height() != B.Width() )
+          LogicError("Hermitian matrices must be square.");
+    )
+    pencil_ = pencil;
+    uplo_ = uplo;
+    cholB_.SetGrid( B.Grid() );
+    Copy( B, cholB_ );
+    Cholesky( uplo_, cholB_ );
+    factored_ = true;
+}
+
+template<typename Field>
+bool DistHermitianGenDefEigSolver<Field>::Factored() const
+{ return factored_; }
+
+template<typename Field>
+HermitianEigInfo
+DistHermitianGenDefEigSolver<Field>::Solve
+(       AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Base<Field>>& w,
+  const HermitianEigCtrl<Field>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The fixed matrix of the pencil has not been factored");
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, cholB_, w );
+      if( APre.Height() != APre.Width() || APre.Height() != cholB_.Height() )
+          LogicError("A did not conform with the cached factor");
+    )
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    if( pencil_ == AXBX )
+        TwoSidedTrsm( uplo_, NON_UNIT, A, cholB_ );
+    else
+        TwoSidedTrmm( uplo_, NON_UNIT, A, cholB_ );
+    return HermitianEig( uplo_, A, w, ctrl );
+}
+
+template<typename Field>
+HermitianEigInfo
+DistHermitianGenDefEigSolver<Field>::Solve
+(       AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Base<Field>>& w,
+        AbstractDistMatrix<Field>& XPre,
+  const HermitianEigCtrl<Field>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The fixed matrix of the pencil has not been factored");
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, cholB_, w, XPre );
+      if( APre.Height() != APre.Width() || APre.Height() != cholB_.Height() )
+          LogicError("A did not conform with the cached factor");
+    )
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> XProx( XPre );
+    auto& A = AProx.Get();
+    auto& X = XProx.Get();
+
+    if( pencil_ == AXBX )
+        TwoSidedTrsm( uplo_, NON_UNIT, A, cholB_ );
+    else
+        TwoSidedTrmm( uplo_, NON_UNIT, A, cholB_ );
+    auto info = HermitianEig( uplo_, A, w, X, ctrl );
+    // The back-transformation only touches the extracted eigenvector panel
+    if( pencil_ == AXBX || pencil_ == ABX )
+    {
+        const Orientation orientation = ( uplo_==LOWER ? ADJOINT : NORMAL );
+        Trsm( LEFT, uplo_, orientation, NON_UNIT, Field(1), cholB_, X );
+    }
+    else /* pencil_ == BAX */
+    {
+        const Orientation orientation = ( uplo_==LOWER ? NORMAL : ADJOINT );
+        Trmm( LEFT, uplo_, orientation, NON_UNIT, Field(1), cholB_, X );
+    }
+    return info;
+}
+
 #define PROTO(Field) \
   template HermitianEigInfo HermitianGenDefEig \
   ( Pencil pencil, \
@@ -178,7 +362,9 @@ HermitianGenDefEig
     AbstractDistMatrix<Field>& B, \
     AbstractDistMatrix<Base<Field>>& w, \
     AbstractDistMatrix<Field>& X, \
-    const HermitianEigCtrl<Field>& ctrl );
+    const HermitianEigCtrl<Field>& ctrl ); \
+  template class HermitianGenDefEigSolver<Field>; \
+  template class DistHermitianGenDefEigSolver<Field>;
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
@@ -458,6 +458,24 @@ HermitianTridiagEig
   const HermitianTridiagEigCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.alg == HERM_TRIDIAG_EIG_AUTO )
+    {
+        auto ctrlMod( ctrl );
+        double predictedSeconds;
+        ctrlMod.alg =
+          herm_tridiag_eig::ChooseAlg( d.Height(), ctrl, predictedSeconds );
+        if( ctrl.progress )
+        {
+            Timer timer;
+            timer.Start();
+            auto info = herm_tridiag_eig::Helper( d, dSub, w, ctrlMod );
+            Output
+            ("Chose tridiag eig algorithm ",Int(ctrlMod.alg),"; predicted ",
+             predictedSeconds," seconds, measured ",timer.Stop()," seconds");
+            return info;
+        }
+        return herm_tridiag_eig::Helper( d, dSub, w, ctrlMod );
+    }
     return herm_tridiag_eig::Helper( d, dSub, w, ctrl );
 }
 
@@ -782,6 +800,26 @@ HermitianTridiagEig
   const HermitianTridiagEigCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.alg == HERM_TRIDIAG_EIG_AUTO )
+    {
+        auto ctrlMod( ctrl );
+        double predictedSeconds;
+        ctrlMod.alg =
+          herm_tridiag_eig::ChooseAlg( d.Height(), ctrl, predictedSeconds );
+        if( ctrl.progress )
+        {
+            Timer timer;
+            timer.Start();
+            auto info = herm_tridiag_eig::Helper( d, dSub, w, ctrlMod );
+            if( d.Grid().Rank() == 0 )
+                Output
+                ("Chose tridiag eig algorithm ",Int(ctrlMod.alg),
+                 "; predicted ",predictedSeconds," seconds, measured ",
+                 timer.Stop()," seconds");
+            return info;
+        }
+        return herm_tridiag_eig::Helper( d, dSub, w, ctrlMod );
+    }
     return herm_tridiag_eig::Helper( d, dSub, w, ctrl );
 }
 
@@ -851,7 +889,16 @@ LAPACKHelper
     w.Resize( n, 1 );
     if( ctrl.subset.rangeSubset )
     {
-         Q.Resize( n, n );
+         // Count the eigenvalues in the interval with a values-only sweep
+         // (which is cheap relative to computing the eigenvectors) so that
+         // Q can be allocated at the subset width rather than at the width
+         // of the full spectrum
+         auto dCopy( d );
+         auto dSubCopy( dSub );
+         const Int kEst = lapack::SymmetricTridiagEig
+          ( BlasInt(n), dCopy.Buffer(), dSubCopy.Buffer(), w.Buffer(),
+            ctrl.subset.lowerBound, ctrl.subset.upperBound );
+         Q.Resize( n, kEst );
          const Int k = lapack::SymmetricTridiagEig
           ( BlasInt(n), d.Buffer(), dSub.Buffer(), w.Buffer(),
             Q.Buffer(), BlasInt(Q.LDim()),
@@ -877,8 +924,9 @@ LAPACKHelper
         ( BlasInt(n), d.Buffer(), dSub.Buffer(), w.Buffer(),
           Q.Buffer(), BlasInt(Q.LDim()) );
     }
+    const Int k = w.Height();
     auto sortPairs = TaggedSort( w, ctrl.sort );
-    for( Int j=0; j<n; ++j )
+    for( Int j=0; j<k; ++j )
         w(j) = sortPairs[j].value;
     ApplyTaggedSortToEachRow( sortPairs, Q );
 
@@ -982,6 +1030,24 @@ HermitianTridiagEig
   const HermitianTridiagEigCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.alg == HERM_TRIDIAG_EIG_AUTO )
+    {
+        auto ctrlMod( ctrl );
+        double predictedSeconds;
+        ctrlMod.alg =
+          herm_tridiag_eig::ChooseAlg( d.Height(), ctrl, predictedSeconds );
+        if( ctrl.progress )
+        {
+            Timer timer;
+            timer.Start();
+            auto info = herm_tridiag_eig::Helper( d, dSub, w, Q, ctrlMod );
+            Output
+            ("Chose tridiag eig algorithm ",Int(ctrlMod.alg),"; predicted ",
+             predictedSeconds," seconds, measured ",timer.Stop()," seconds");
+            return info;
+        }
+        return herm_tridiag_eig::Helper( d, dSub, w, Q, ctrlMod );
+    }
     return herm_tridiag_eig::Helper( d, dSub, w, Q, ctrl );
 }
 
@@ -1218,13 +1284,14 @@ MRRRHelper
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
             wVector.data(), Q.Buffer(), Q.LDim(), w.ColComm() );
-    w.Resize( rangeInfo.numGlobalEigenvalues, 1 );
-    Q.Resize( n, rangeInfo.numGlobalEigenvalues );
+    const Int numComputed = rangeInfo.numGlobalEigenvalues;
+    w.Resize( numComputed, 1 );
+    Q.Resize( n, numComputed );
     for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
         w.SetLocal( iLoc, 0, Real(wVector[iLoc]) );
 
     auto sortPairs = TaggedSort( w, ctrl.sort );
-    for( Int j=0; j<n; ++j )
+    for( Int j=0; j<numComputed; ++j )
         w.Set( j, 0, sortPairs[j].value );
     ApplyTaggedSortToEachRow( sortPairs, Q );
 
@@ -1307,15 +1374,16 @@ MRRRHelper
           ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
             wVector.data(), QReal.Buffer(), QReal.LDim(), w.ColComm() );
 
-    w.Resize( rangeInfo.numGlobalEigenvalues, 1 );
+    const Int numComputed = rangeInfo.numGlobalEigenvalues;
+    w.Resize( numComputed, 1 );
     auto& wLoc = w.Matrix();
     for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
         wLoc(iLoc) = wVector[iLoc];
 
-    QReal.Resize( n, rangeInfo.numGlobalEigenvalues );
+    QReal.Resize( n, numComputed );
 
     auto sortPairs = TaggedSort( w, ctrl.sort );
-    for( Int j=0; j<n; ++j )
+    for( Int j=0; j<numComputed; ++j )
         w.Set( j, 0, sortPairs[j].value );
     ApplyTaggedSortToEachRow( sortPairs, QReal );
 
@@ -1431,6 +1499,26 @@ HermitianTridiagEig
   const HermitianTridiagEigCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.alg == HERM_TRIDIAG_EIG_AUTO )
+    {
+        auto ctrlMod( ctrl );
+        double predictedSeconds;
+        ctrlMod.alg =
+          herm_tridiag_eig::ChooseAlg( d.Height(), ctrl, predictedSeconds );
+        if( ctrl.progress )
+        {
+            Timer timer;
+            timer.Start();
+            auto info = herm_tridiag_eig::Helper( d, dSub, w, Q, ctrlMod );
+            if( d.Grid().Rank() == 0 )
+                Output
+                ("Chose tridiag eig algorithm ",Int(ctrlMod.alg),
+                 "; predicted ",predictedSeconds," seconds, measured ",
+                 timer.Stop()," seconds");
+            return info;
+        }
+        return herm_tridiag_eig::Helper( d, dSub, w, Q, ctrlMod );
+    }
     return herm_tridiag_eig::Helper( d, dSub, w, Q, ctrl );
 }
 
@@ -1524,7 +1612,7 @@ MRRRPostEstimateHelper
     Q.Resize( n, k );
 
     auto sortPairs = TaggedSort( w, sort );
-    for( Int j=0; j<n; ++j )
+    for( Int j=0; j<k; ++j )
         w.Set( j, 0, sortPairs[j].value );
     ApplyTaggedSortToEachRow( sortPairs, Q );
 
@@ -1581,6 +1669,44 @@ MRRRPostEstimate
 
 } // namespace herm_tridiag_eig
 
+namespace herm_tridiag_eig {
+
+void Calibrate( Int n )
+{
+    EL_DEBUG_CSE
+    if( n < 3 )
+        LogicError("Calibration problems must have at least three entries");
+    Matrix<double> d, dSub, w, Q;
+    Timer timer;
+    HermitianTridiagEigCtrl<double> ctrl;
+    const HermitianTridiagEigAlg algs[] =
+      { HERM_TRIDIAG_EIG_QR, HERM_TRIDIAG_EIG_DC, HERM_TRIDIAG_EIG_MRRR };
+    const bool wantEigVecsChoices[] = { false, true };
+    for( bool wantEigVecs : wantEigVecsChoices )
+    {
+        ctrl.wantEigVecs = wantEigVecs;
+        for( auto alg : algs )
+        {
+            ctrl.alg = alg;
+            Uniform( d, n, 1 );
+            Uniform( dSub, n-1, 1 );
+            timer.Start();
+            if( wantEigVecs )
+                HermitianTridiagEig( d, dSub, w, Q, ctrl );
+            else
+                HermitianTridiagEig( d, dSub, w, ctrl );
+            const double seconds = Max( timer.Stop(), 1.e-6 );
+            const double rate =
+              AlgCost( alg, wantEigVecs, double(n), double(n) ) /
+              (seconds*1.e6);
+            SetTunedBlocksize
+            ( AlgRateKey(alg,wantEigVecs), 0, Max(Int(rate),Int(1)) );
+        }
+    }
+}
+
+} // namespace herm_tridiag_eig
+
 #define PROTO(F) \
   template void herm_eig::SortAndFilter \
   ( Matrix<Base<F>>& w, \
@@ -418,8 +418,6 @@ Merge
 
     if( ctrl.progress )
         Output("Solving secular equation and correcting update vector");
-    Matrix<Real> rCorrected;
-    Ones( rCorrected, numUndeflated, 1 );
 
     // Ensure that there is sufficient space for storing the needed
     // eigenvectors from the undeflated secular equation. Notice that we
@@ -431,36 +429,54 @@ Merge
     else
         QSecular.Resize( numUndeflated, numUndeflated );
 
+    // The roots of the secular equation are independent of each other, so we
+    // solve for them in parallel and accumulate the iteration counts
+    // afterwards
+    vector<SecularEVDInfo> valueInfos(numUndeflated);
+    EL_PARALLEL_FOR
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto minusShift = QSecular( ALL, IR(j) );
-
-        auto valueInfo =
+        valueInfos[j] =
           SecularEigenvalue
           ( j, dUndeflated, rho, zUndeflated, d(j), minusShift,
             dcCtrl.secularCtrl );
         if( ctrl.progress )
             Output("Secular eigenvalue ",j," is ",d(j));
+    }
+    for( Int j=0; j<numUndeflated; ++j )
+    {
+        secularInfo.numIterations += valueInfos[j].numIterations;
+        secularInfo.numAlternations += valueInfos[j].numAlternations;
+        secularInfo.numCubicIterations += valueInfos[j].numCubicIterations;
+        secularInfo.numCubicFailures += valueInfos[j].numCubicFailures;
+    }
 
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
+    // Each entry of the corrected update vector is a product over all of the
+    // roots, so, rather than scattering each root's contribution into every
+    // entry as it is found, we gather the contributions of the (already
+    // computed) roots into each entry independently (preserving the order of
+    // the factors)
+    Matrix<Real> rCorrected;
+    rCorrected.Resize( numUndeflated, 1 );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        Real rProd = 1;
+        for( Int j=0; j<numUndeflated; ++j )
         {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
+            if( j == k )
+                rProd *= QSecular(k,j);
+            else
+                rProd *= QSecular(k,j) / (dUndeflated(j)-dUndeflated(k));
         }
+        rCorrected(k) = Sgn(zUndeflated(k),false) * Sqrt(Abs(rProd));
     }
-    for( Int j=0; j<numUndeflated; ++j )
-        rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
     // Compute the unnormalized eigenvectors.
     if( ctrl.progress )
         Output("Computing unnormalized eigenvectors");
+    EL_PARALLEL_FOR
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto q = QSecular(ALL,IR(j));
@@ -476,6 +492,10 @@ Merge
     if( ctrl.progress )
         Output("Forming undeflated right singular vectors");
     U.Resize( numUndeflated, numUndeflated );
+    // Force the permutation out of its lazy swap-sequence representation so
+    // that the preimage queries below are read-only
+    packingPerm.MakeArbitrary();
+    EL_PARALLEL_FOR
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto q = QSecular(ALL,IR(j));
@@ -1121,7 +1141,8 @@ DivideAndConquer
         Matrix<Real>& superDiag,
         Matrix<Real>& w,
         Matrix<Real>& Q,
-  const HermitianTridiagEigCtrl<Real>& ctrl )
+  const HermitianTridiagEigCtrl<Real>& ctrl,
+  bool topLevel=true )
 {
     EL_DEBUG_CSE
     const Int n = mainDiag.Height();
@@ -1179,11 +1200,40 @@ DivideAndConquer
         Zeros( Q1, 2, n-split );
     }
 
-    Matrix<Real> w0;
-    auto info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl );
-
-    Matrix<Real> w1;
-    auto info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl );
+    // The two subproblems are independent, so solve the left subtree in a
+    // task while this thread continues with the right (the tasks degrade to
+    // an in-order traversal without OpenMP task support). At the top level,
+    // the tasks are spawned from a single thread of a fresh team so that the
+    // idle threads can steal the subtrees; the region ends before the
+    // top-level merge so that the loop-level parallelism of the merge is not
+    // nested inside of it.
+    Matrix<Real> w0, w1;
+    DCInfo info0, info1;
+    if( topLevel )
+    {
+        EL_TASK_REGION
+        {
+            EL_TASK
+            {
+                info0 =
+                  DivideAndConquer
+                  ( mainDiag0, superDiag0, w0, Q0, ctrl, false );
+            }
+            info1 =
+              DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl, false );
+            EL_TASKWAIT
+        }
+    }
+    else
+    {
+        EL_TASK
+        {
+            info0 =
+              DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl, false );
+        }
+        info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl, false );
+        EL_TASKWAIT
+    }
 
     if( !ctrl.wantEigVecs )
     {
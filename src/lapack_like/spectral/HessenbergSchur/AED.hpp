@@ -216,6 +216,17 @@ AED
     }
     Int deflationSize = deflationSizeRec;
 
+    // State for the (optional) online retuning of the bulge-packet spacing
+    // and the deflation-window size. The spacing may only be relaxed relative
+    // to the default of one packet per six rows, as the inter-block chase
+    // requires numBulgesPerBlock*6 + 1 <= blockSize; the hill climb therefore
+    // walks the spacing divisor within [6,12], moving toward whichever
+    // neighboring value last improved the measured sweep throughput.
+    Int deflationSizeBase = deflationSizeRec;
+    Int bulgeSpacing = 6;
+    Int bulgeSpacingStep = 1;
+    double lastSweepRate = 0;
+
     // For multibulge::Sweep
     auto ctrlSub( ctrl );
 
@@ -269,13 +280,16 @@ AED
 
         auto hSubIter = hSubWin( IR(iterBeg-winBeg,winEnd-1), ALL );
         aed::UpdateDeflationSize
-        ( deflationSize, decreaseLevel, deflationSizeRec, numIterSinceDeflation,
-          numStaleIterBeforeExceptional, hSubIter.Matrix() );
+        ( deflationSize, decreaseLevel, deflationSizeBase,
+          numIterSinceDeflation, numStaleIterBeforeExceptional,
+          hSubIter.Matrix() );
 
         // Run AED on the bottom-right window of size deflationSize
         ctrlSub.winBeg = iterBeg;
         ctrlSub.winEnd = winEnd;
+        const double nibbleStart = mpi::Time();
         auto deflateInfo = aed::Nibble( H, deflationSize, w, Z, ctrlSub );
+        const double nibbleTime = mpi::Time() - nibbleStart;
         const Int numDeflated = deflateInfo.numDeflated;
         winEnd -= numDeflated;
         Int shiftBeg = winEnd - deflateInfo.numShiftCandidates;
@@ -298,7 +312,48 @@ AED
             auto wSub = w(IR(shiftBeg,winEnd),ALL);
             ctrlSub.winBeg = iterBeg;
             ctrlSub.winEnd = winEnd;
+            if( ctrl.tuneAED )
+                ctrlSub.numBulgesPerBlock =
+                  [bulgeSpacing]( Int blockHeight )
+                  { return Max( (blockHeight-1)/bulgeSpacing, Int(1) ); };
+            const double sweepStart = mpi::Time();
             multibulge::Sweep( H, wSub, Z, ctrlSub );
+            const double sweepTime = mpi::Time() - sweepStart;
+            if( ctrl.tuneAED )
+            {
+                // Every process must make the same retuning decisions, so
+                // reduce the local timings to their maxima over the grid
+                const double sweepTimeMax =
+                  mpi::AllReduce( sweepTime, mpi::MAX, grid.Comm() );
+                const double nibbleTimeMax =
+                  mpi::AllReduce( nibbleTime, mpi::MAX, grid.Comm() );
+                const Int numSweepShifts = winEnd - shiftBeg;
+                const double sweepRate =
+                  double(numSweepShifts)*double(newIterWinSize)*
+                  double(newIterWinSize) / sweepTimeMax;
+                if( lastSweepRate > 0 && sweepRate < lastSweepRate )
+                    bulgeSpacingStep = -bulgeSpacingStep;
+                lastSweepRate = sweepRate;
+                bulgeSpacing =
+                  Min( Max( bulgeSpacing+bulgeSpacingStep, Int(6) ), Int(12) );
+
+                // Grow the deflation window when the sweeps dwarf the cost of
+                // the deflation attempts (a more aggressive nibble is then
+                // effectively free), and shrink it back toward the
+                // recommendation when the nibbles dominate
+                if( sweepTimeMax > 10*nibbleTimeMax )
+                    deflationSizeBase =
+                      Min( deflationSizeBase+deflationSizeRec/4,
+                           3*deflationSizeRec );
+                else if( nibbleTimeMax > sweepTimeMax )
+                    deflationSizeBase =
+                      Max( deflationSizeBase-deflationSizeRec/4,
+                           deflationSizeRec );
+                if( ctrl.progress && grid.Rank() == 0 )
+                    Output
+                    ("  Retuned bulge spacing to ",bulgeSpacing,
+                     " and deflation window base to ",deflationSizeBase);
+            }
         }
         else if( ctrl.progress && grid.Rank() == 0 )
             Output("  Skipping QR sweep");
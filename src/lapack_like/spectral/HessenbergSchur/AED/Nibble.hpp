@@ -15,61 +15,29 @@ namespace El {
 namespace hess_schur {
 namespace aed {
 
-// The spike value will be overwritten
+// Complete a deflation attempt given a Schur decomposition of the
+// deflation window: on entry, T = V' H V is quasi-triangular (with its
+// leading numUnconverged eigenvalues unconverged). On exit, H holds the
+// deflated window, w its eigenvalues and shift candidates, and V the
+// accumulated transformation (or is 0 x 0 if no transformation is
+// required). The spike value will be overwritten.
 template<typename Real>
-AEDInfo NibbleHelper
+AEDInfo NibbleFromSchur
 ( Matrix<Real>& H,
+  Matrix<Real>& T,
+  Matrix<Real>& V,
   Real& spikeValue,
+  Int numUnconverged,
   Matrix<Complex<Real>>& w,
-  Matrix<Real>& V,
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
     const Int n = H.Height();
     AEDInfo info;
-
     const Real zero(0);
-    const Real ulp = limits::Precision<Real>();
-    const Real safeMin = limits::SafeMin<Real>();
-    const Real smallNum = safeMin*(Real(n)/ulp);
-
-    Zeros( V, 0, 0 );
-    if( n == 1 )
-    {
-        w(0) = H(0,0);
-        if( Abs(spikeValue) <= Max( smallNum, ulp*Abs(w(0).real()) ) )
-        {
-            // The offdiagonal entry was small enough to deflate
-            info.numDeflated = 1;
-            spikeValue = zero;
-        }
-        else
-        {
-            // The offdiagonal entry was too large to deflate
-            info.numShiftCandidates = 1;
-        }
-        return info;
-    }
-
-    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
-    auto T( H ); // TODO(poulson): Reuse this matrix?
-    Identity( V, n, n );
-    auto ctrlSub( ctrl );
-    ctrlSub.winBeg = 0;
-    ctrlSub.winEnd = n;
-    ctrlSub.fullTriangle = true;
-    ctrlSub.wantSchurVecs = true;
-    ctrlSub.demandConverged = false;
-    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
-                                      : HESSENBERG_SCHUR_MULTIBULGE );
-    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
-    EL_DEBUG_ONLY(
-      if( infoSub.numUnconverged != 0 )
-          Output(infoSub.numUnconverged," eigenvalues did not converge");
-    )
 
     vector<Real> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -186,16 +154,16 @@ AEDInfo NibbleHelper
     return info;
 }
 
+// The spike value will be overwritten
 template<typename Real>
 AEDInfo NibbleHelper
-( Matrix<Complex<Real>>& H,
-  Complex<Real>& spikeValue,
+( Matrix<Real>& H,
+  Real& spikeValue,
   Matrix<Complex<Real>>& w,
-  Matrix<Complex<Real>>& V,
+  Matrix<Real>& V,
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Complex<Real> Field;
     const Int n = H.Height();
     AEDInfo info;
 
@@ -208,7 +176,7 @@ AEDInfo NibbleHelper
     if( n == 1 )
     {
         w(0) = H(0,0);
-        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
+        if( Abs(spikeValue) <= Max( smallNum, ulp*Abs(w(0).real()) ) )
         {
             // The offdiagonal entry was small enough to deflate
             info.numDeflated = 1;
@@ -239,8 +207,28 @@ AEDInfo NibbleHelper
           Output(infoSub.numUnconverged," eigenvalues did not converge");
     )
 
+    return NibbleFromSchur
+    ( H, T, V, spikeValue, infoSub.numUnconverged, w, ctrl );
+}
+
+template<typename Real>
+AEDInfo NibbleFromSchur
+( Matrix<Complex<Real>>& H,
+  Matrix<Complex<Real>>& T,
+  Matrix<Complex<Real>>& V,
+  Complex<Real>& spikeValue,
+  Int numUnconverged,
+  Matrix<Complex<Real>>& w,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> Field;
+    const Int n = H.Height();
+    AEDInfo info;
+    const Real zero(0);
+
     vector<Field> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -337,6 +325,63 @@ AEDInfo NibbleHelper
     return info;
 }
 
+template<typename Real>
+AEDInfo NibbleHelper
+( Matrix<Complex<Real>>& H,
+  Complex<Real>& spikeValue,
+  Matrix<Complex<Real>>& w,
+  Matrix<Complex<Real>>& V,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> Field;
+    const Int n = H.Height();
+    AEDInfo info;
+
+    const Real zero(0);
+    const Real ulp = limits::Precision<Real>();
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+
+    Zeros( V, 0, 0 );
+    if( n == 1 )
+    {
+        w(0) = H(0,0);
+        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
+        {
+            // The offdiagonal entry was small enough to deflate
+            info.numDeflated = 1;
+            spikeValue = zero;
+        }
+        else
+        {
+            // The offdiagonal entry was too large to deflate
+            info.numShiftCandidates = 1;
+        }
+        return info;
+    }
+
+    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
+    auto T( H ); // TODO(poulson): Reuse this matrix?
+    Identity( V, n, n );
+    auto ctrlSub( ctrl );
+    ctrlSub.winBeg = 0;
+    ctrlSub.winEnd = n;
+    ctrlSub.fullTriangle = true;
+    ctrlSub.wantSchurVecs = true;
+    ctrlSub.demandConverged = false;
+    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
+                                      : HESSENBERG_SCHUR_MULTIBULGE );
+    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
+    EL_DEBUG_ONLY(
+      if( infoSub.numUnconverged != 0 )
+          Output(infoSub.numUnconverged," eigenvalues did not converge");
+    )
+
+    return NibbleFromSchur
+    ( H, T, V, spikeValue, infoSub.numUnconverged, w, ctrl );
+}
+
 template<typename Field>
 AEDInfo Nibble
 ( Matrix<Field>& H,
@@ -430,7 +475,43 @@ AEDInfo Nibble
       ( deflateBeg==winBeg ? Field(0) : H.Get(deflateBeg,deflateBeg-1) );
     Int VSize = 0;
     Matrix<Field> V;
-    if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+    if( blockSize >= Max( ctrl.minParallelAEDSize, Int(2) ) )
+    {
+        // The Schur decomposition of the deflation window dominates the cost
+        // of the nibble for large windows, so compute it with the distributed
+        // multibulge algorithm over the owning grid rather than on the root
+        // process alone. The (much cheaper) spike deflation and Hessenberg
+        // restoration of the window are still performed sequentially at the
+        // root once the window's Schur factors have been gathered.
+        DistMatrix<Field,MC,MR,BLOCK> TDefl( grid ), VDefl( grid );
+        TDefl = HDefl;
+        auto ctrlSchur( ctrl );
+        ctrlSchur.winBeg = 0;
+        ctrlSchur.winEnd = END;
+        ctrlSchur.fullTriangle = true;
+        ctrlSchur.wantSchurVecs = true;
+        ctrlSchur.accumulateSchurVecs = false;
+        ctrlSchur.demandConverged = false;
+        ctrlSchur.alg =
+          ( ctrl.recursiveAED ?
+            HESSENBERG_SCHUR_AED :
+            HESSENBERG_SCHUR_MULTIBULGE );
+        auto infoSchur = HessenbergSchur( TDefl, wDefl, VDefl, ctrlSchur );
+        DistMatrix<Field,CIRC,CIRC> TDefl_CIRC_CIRC( grid, owner ),
+          VDefl_CIRC_CIRC( grid, owner );
+        TDefl_CIRC_CIRC = TDefl;
+        VDefl_CIRC_CIRC = VDefl;
+        if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+        {
+            V = VDefl_CIRC_CIRC.Matrix();
+            info =
+              NibbleFromSchur
+              ( HDefl_CIRC_CIRC.Matrix(), TDefl_CIRC_CIRC.Matrix(), V,
+                spikeValue, infoSchur.numUnconverged, wDefl.Matrix(), ctrl );
+            VSize = V.Height();
+        }
+    }
+    else if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
     {
         info =
           NibbleHelper
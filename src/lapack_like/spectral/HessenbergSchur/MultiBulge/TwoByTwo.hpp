@@ -129,7 +129,7 @@ void TwoByTwo
     // complex unitary matrix of Schur vectors, the fact that the columns can
     // have arbitrary phase implies that the top-left and bottom-right entries
     // can be rescaled to be real (and both equal to 'c').
-    Matrix<Field> HSub(2,2);
+    StaticMatrix<Field,2,2> HSub;
     HSub(0,0) = eta00;
     HSub(0,1) = eta01;
     HSub(1,0) = eta10;
@@ -0,0 +1,58 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+LOBPCGInfo LOBPCG
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const LOBPCGCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyPrec =
+      []( const Matrix<Field>& R, Matrix<Field>& W ) { W = R; };
+    return LOBPCG( A, applyPrec, w, X, ctrl );
+}
+
+template<typename Field>
+LOBPCGInfo LOBPCG
+( const DistSparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const LOBPCGCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyPrec =
+      []( const DistMultiVec<Field>& R, DistMultiVec<Field>& W ) { W = R; };
+    return LOBPCG( A, applyPrec, w, X, ctrl );
+}
+
+#define PROTO(Field) \
+  template LOBPCGInfo LOBPCG \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& X, \
+    const LOBPCGCtrl<Base<Field>>& ctrl ); \
+  template LOBPCGInfo LOBPCG \
+  ( const DistSparseMatrix<Field>& A, \
+          Matrix<Base<Field>>& w, \
+          DistMultiVec<Field>& X, \
+    const LOBPCGCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -21,6 +21,240 @@
 
 namespace El {
 
+namespace pspec {
+
+// Process the shifts in blocks of (at most) psCtrl.shiftBlockSize at a time:
+// the shifts within a block still share their MultiShiftTrsm sweeps and are
+// deflated out of the block as they converge, but the workspace of the
+// iteration (several n x numShifts matrices) is kept bounded for very large
+// spectral clouds.
+
+template<typename Real,class CloudFunction>
+Matrix<Int> BlockedCloud
+( const Matrix<Complex<Real>>& shifts,
+        Matrix<Real>& invNorms,
+  const PseudospecCtrl<Real>& psCtrl,
+  const CloudFunction& cloud )
+{
+    EL_DEBUG_CSE
+    const Int numShifts = shifts.Height();
+    const Int blockSize = psCtrl.shiftBlockSize;
+    auto psCtrlMod( psCtrl );
+    psCtrlMod.shiftBlockSize = 0;
+
+    Matrix<Int> itCounts;
+    Zeros( itCounts, numShifts, 1 );
+    Zeros( invNorms, numShifts, 1 );
+    for( Int shiftBeg=0; shiftBeg<numShifts; shiftBeg+=blockSize )
+    {
+        const Int shiftEnd = Min( shiftBeg+blockSize, numShifts );
+        auto shiftsBlock = shifts( IR(shiftBeg,shiftEnd), ALL );
+        Matrix<Real> invNormsBlock;
+        auto itCountsBlock = cloud( shiftsBlock, invNormsBlock, psCtrlMod );
+
+        auto invNormsSub = invNorms( IR(shiftBeg,shiftEnd), ALL );
+        auto itCountsSub = itCounts( IR(shiftBeg,shiftEnd), ALL );
+        invNormsSub = invNormsBlock;
+        itCountsSub = itCountsBlock;
+    }
+    return itCounts;
+}
+
+template<typename Real,class CloudFunction>
+DistMatrix<Int,VR,STAR> BlockedCloud
+( const AbstractDistMatrix<Complex<Real>>& shiftsPre,
+        AbstractDistMatrix<Real>& invNormsPre,
+  const PseudospecCtrl<Real>& psCtrl,
+  const CloudFunction& cloud )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int numShifts = shiftsPre.Height();
+    const Int blockSize = psCtrl.shiftBlockSize;
+    const Grid& g = shiftsPre.Grid();
+    auto psCtrlMod( psCtrl );
+    psCtrlMod.shiftBlockSize = 0;
+
+    DistMatrixReadProxy<C,C,VR,STAR> shiftsProx( shiftsPre );
+    auto& shifts = shiftsProx.GetLocked();
+
+    DistMatrixWriteProxy<Real,Real,VR,STAR> invNormsProx( invNormsPre );
+    auto& invNorms = invNormsProx.Get();
+
+    DistMatrix<Int,VR,STAR> itCounts(g);
+    Zeros( itCounts, numShifts, 1 );
+    Zeros( invNorms, numShifts, 1 );
+    for( Int shiftBeg=0; shiftBeg<numShifts; shiftBeg+=blockSize )
+    {
+        const Int shiftEnd = Min( shiftBeg+blockSize, numShifts );
+        auto shiftsBlock = shifts( IR(shiftBeg,shiftEnd), ALL );
+        DistMatrix<Real,VR,STAR> invNormsBlock(g);
+        auto itCountsBlock = cloud( shiftsBlock, invNormsBlock, psCtrlMod );
+
+        auto invNormsSub = invNorms( IR(shiftBeg,shiftEnd), ALL );
+        auto itCountsSub = itCounts( IR(shiftBeg,shiftEnd), ALL );
+        invNormsSub = invNormsBlock;
+        itCountsSub = itCountsBlock;
+    }
+    return itCounts;
+}
+
+// Partition the process grid into independent subgrid teams, each iterating
+// on its own queue of shifts. A static partition of the shifts would leave
+// most teams idling on the runtime of the worst bucket (shifts near the
+// spectrum can require orders of magnitude more iterations than distant
+// ones), so the teams instead work in rounds of a (doubling) iteration
+// quantum: shifts which converge within the quantum are retired, and the
+// survivors are pooled and re-dealt round-robin across all of the teams at
+// the round boundary, which both spreads adjacent (equally hard) shifts
+// across teams and reassigns the queues of overloaded teams to those whose
+// shifts converged early. Each team holds its own copy of the iteration
+// matrix over its subgrid, so the only full-grid synchronization is the
+// pair of reductions at each round boundary.
+
+template<typename CloudField,typename Real,class CloudFunction>
+DistMatrix<Int,VR,STAR> TeamCloud
+( const DistMatrix<CloudField>& U,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+        AbstractDistMatrix<Real>& invNormsPre,
+  const PseudospecCtrl<Real>& psCtrl,
+  const CloudFunction& cloud )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& g = U.Grid();
+    const Int numShifts = shifts.Height();
+    const int p = g.Size();
+    const int numTeams =
+      int(Min( Min( psCtrl.numTeams, Int(p) ), numShifts ));
+
+    DistMatrixWriteProxy<Real,Real,VR,STAR> invNormsProx( invNormsPre );
+    auto& invNorms = invNormsProx.Get();
+
+    // Construct the team grids over contiguous blocks of the owning group
+    // and push a copy of U onto each team (every process participates in
+    // each of the redistributions but only stores its own team's portion)
+    mpi::Group owningGroup = g.OwningGroup();
+    vector<unique_ptr<Grid>> teamGrids(numTeams);
+    vector<unique_ptr<DistMatrix<CloudField>>> UTeams(numTeams);
+    int myTeam = 0;
+    for( int team=0; team<numTeams; ++team )
+    {
+        const int teamBeg = (team*p) / numTeams;
+        const int teamEnd = ((team+1)*p) / numTeams;
+        const int teamSize = teamEnd - teamBeg;
+        vector<int> teamRanks(teamSize);
+        for( int q=0; q<teamSize; ++q )
+            teamRanks[q] = teamBeg + q;
+        mpi::Group teamGroup;
+        mpi::Incl( owningGroup, teamSize, teamRanks.data(), teamGroup );
+        teamGrids[team].reset
+        ( new Grid( g.VCComm(), teamGroup, Grid::DefaultHeight(teamSize) ) );
+        mpi::Free( teamGroup );
+        UTeams[team].reset( new DistMatrix<CloudField>(*teamGrids[team]) );
+        *UTeams[team] = U;
+        if( teamGrids[team]->InGrid() )
+            myTeam = team;
+    }
+
+    // Replicate the shift values so that the queues can be formed locally
+    DistMatrix<C,STAR,STAR> shiftsFull( shifts );
+
+    vector<Real> invNormEsts(numShifts, Real(0));
+    vector<Int> totalIts(numShifts, 0);
+    vector<Int> remaining(numShifts);
+    for( Int j=0; j<numShifts; ++j )
+        remaining[j] = j;
+
+    Int itsUsed = 0;
+    Int quantum = Min( Max( psCtrl.teamQuantum, Int(1) ), psCtrl.maxIts );
+    while( !remaining.empty() )
+    {
+        // Deal the unresolved shifts round-robin across the teams
+        vector<vector<Int>> queues(numTeams);
+        for( size_t e=0; e<remaining.size(); ++e )
+            queues[e%numTeams].push_back( remaining[e] );
+
+        vector<Real> roundInv(numShifts, Real(0));
+        vector<Int> roundIts(numShifts, 0);
+        const auto& queue = queues[myTeam];
+        const Grid& teamGrid = *teamGrids[myTeam];
+        if( teamGrid.InGrid() && !queue.empty() )
+        {
+            const Int queueSize = queue.size();
+            DistMatrix<C,VR,STAR> shiftsTeam(teamGrid);
+            shiftsTeam.Resize( queueSize, 1 );
+            for( Int iLoc=0; iLoc<shiftsTeam.LocalHeight(); ++iLoc )
+                shiftsTeam.SetLocal
+                ( iLoc, 0,
+                  shiftsFull.GetLocal(queue[shiftsTeam.GlobalRow(iLoc)],0) );
+
+            auto psCtrlTeam( psCtrl );
+            psCtrlTeam.numTeams = 1;
+            psCtrlTeam.maxIts = quantum;
+            // Snapshots and checkpoints of partial shift queues would
+            // collide across teams
+            psCtrlTeam.snapCtrl = SnapshotCtrl();
+            psCtrlTeam.checkpointCtrl = CheckpointCtrl();
+            psCtrlTeam.progress = psCtrl.progress && myTeam == 0;
+
+            DistMatrix<Real,VR,STAR> invNormsTeam(teamGrid);
+            auto itCountsTeam =
+              cloud( *UTeams[myTeam], shiftsTeam, invNormsTeam, psCtrlTeam );
+
+            DistMatrix<Real,STAR,STAR> invNormsTeamFull( invNormsTeam );
+            DistMatrix<Int,STAR,STAR> itCountsTeamFull( itCountsTeam );
+            if( teamGrid.Rank() == 0 )
+            {
+                for( Int e=0; e<queueSize; ++e )
+                {
+                    roundInv[queue[e]] = invNormsTeamFull.GetLocal(e,0);
+                    roundIts[queue[e]] = itCountsTeamFull.GetLocal(e,0);
+                }
+            }
+        }
+        // Combine the round's results (each shift was owned by exactly one
+        // team, and only its root contributed)
+        mpi::AllReduce( roundInv.data(), int(numShifts), g.VCComm() );
+        mpi::AllReduce( roundIts.data(), int(numShifts), g.VCComm() );
+        itsUsed += quantum;
+
+        vector<Int> survivors;
+        for( const Int j : remaining )
+        {
+            totalIts[j] += roundIts[j];
+            invNormEsts[j] = roundInv[j];
+            // A shift which exhausted its quantum is presumed unconverged
+            if( roundIts[j] >= quantum )
+                survivors.push_back( j );
+        }
+        if( psCtrl.progress && g.Rank() == 0 )
+            Output
+            (remaining.size()-survivors.size()," of ",remaining.size(),
+             " shifts converged within a quantum of ",quantum,
+             " iteration(s)");
+        remaining = survivors;
+        if( itsUsed >= psCtrl.maxIts )
+            break;
+        quantum = Min( 2*quantum, psCtrl.maxIts-itsUsed );
+    }
+
+    // Scatter the replicated results into the output distributions
+    invNorms.AlignWith( shifts );
+    invNorms.Resize( numShifts, 1 );
+    for( Int iLoc=0; iLoc<invNorms.LocalHeight(); ++iLoc )
+        invNorms.SetLocal( iLoc, 0, invNormEsts[invNorms.GlobalRow(iLoc)] );
+    DistMatrix<Int,VR,STAR> itCounts(g);
+    itCounts.AlignWith( shifts );
+    itCounts.Resize( numShifts, 1 );
+    for( Int iLoc=0; iLoc<itCounts.LocalHeight(); ++iLoc )
+        itCounts.SetLocal( iLoc, 0, totalIts[itCounts.GlobalRow(iLoc)] );
+
+    return itCounts;
+}
+
+} // namespace pspec
+
 template<typename Field>
 Matrix<Int> TriangularSpectralCloud
 ( const Matrix<Field>& UPre,
@@ -32,6 +266,17 @@ Matrix<Int> TriangularSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 && shifts.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shifts, invNorms, psCtrl,
+          [&UPre]
+          ( const Matrix<C>& shiftsBlock,
+            Matrix<Real>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return TriangularSpectralCloud
+            ( UPre, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     // Force U to be complex in as cheap of a manner as possible
     MatrixReadProxy<Field,C> UProx( UPre );
     auto& U = UProx.GetLocked();
@@ -85,6 +330,17 @@ Matrix<Int> TriangularSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 && shifts.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shifts, invNorms, psCtrl,
+          [&UPre,&QPre]
+          ( const Matrix<C>& shiftsBlock,
+            Matrix<Real>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return TriangularSpectralCloud
+            ( UPre, QPre, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     // Force U to be complex as cheaply as possible
     MatrixReadProxy<Field,C> UProx( UPre );
     auto& U = UProx.GetLocked();
@@ -139,6 +395,17 @@ Matrix<Int> QuasiTriangularSpectralCloud
 {
     EL_DEBUG_CSE
 
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 && shifts.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shifts, invNorms, psCtrl,
+          [&U]
+          ( const Matrix<Complex<Real>>& shiftsBlock,
+            Matrix<Real>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return QuasiTriangularSpectralCloud
+            ( U, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     // Check if the off-diagonal is sufficiently small; if so, compute the
     // pseudospectrum analytically from the eigenvalues. This also takes care
     // of the case where the matrix is a constant multiple of the identity
@@ -174,6 +441,17 @@ Matrix<Int> QuasiTriangularSpectralCloud
 {
     EL_DEBUG_CSE
 
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 && shifts.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shifts, invNorms, psCtrl,
+          [&U,&Q]
+          ( const Matrix<Complex<Real>>& shiftsBlock,
+            Matrix<Real>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return QuasiTriangularSpectralCloud
+            ( U, Q, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     // Check if the off-diagonal is sufficiently small; if so, compute the
     // pseudospectrum analytically from the eigenvalues. This also takes care
     // of the case where the matrix is a constant multiple of the identity
@@ -210,6 +488,17 @@ Matrix<Int> HessenbergSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 && shifts.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shifts, invNorms, psCtrl,
+          [&HPre]
+          ( const Matrix<C>& shiftsBlock,
+            Matrix<Real>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return HessenbergSpectralCloud
+            ( HPre, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     // Force H to be complex as cheaply as possible
     MatrixReadProxy<Field,C> HProx( HPre );
     auto& H = HProx.GetLocked();
@@ -246,6 +535,17 @@ Matrix<Int> HessenbergSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 && shifts.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shifts, invNorms, psCtrl,
+          [&HPre,&QPre]
+          ( const Matrix<C>& shiftsBlock,
+            Matrix<Real>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return HessenbergSpectralCloud
+            ( HPre, QPre, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     // Force H to be complex as cheaply as possible
     MatrixReadProxy<Field,C> HProx( HPre );
     auto& H = HProx.GetLocked();
@@ -284,6 +584,19 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     typedef Complex<Real> C;
+
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 &&
+        shiftsPre.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shiftsPre, invNorms, psCtrl,
+          [&UPre]
+          ( const DistMatrix<C,VR,STAR>& shiftsBlock,
+            DistMatrix<Real,VR,STAR>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return TriangularSpectralCloud
+            ( UPre, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     const Grid& g = UPre.Grid();
 
     // Force 'U' to be complex and in a [MC,MR] distribution
@@ -294,6 +607,17 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
     DistMatrixReadProxy<C,C,VR,STAR> shiftsProx( shiftsPre );
     auto& shifts = shiftsProx.GetLocked();
 
+    // Partition the grid into independent shift-queue teams if requested
+    if( psCtrl.numTeams > 1 && g.Size() > 1 && shifts.Height() > 1 )
+        return pspec::TeamCloud
+        ( U, shifts, invNorms, psCtrl,
+          []( const DistMatrix<C>& UTeam,
+              const DistMatrix<C,VR,STAR>& shiftsTeam,
+              DistMatrix<Real,VR,STAR>& invNormsTeam,
+              const PseudospecCtrl<Real>& teamCtrl )
+          { return TriangularSpectralCloud
+            ( UTeam, shiftsTeam, invNormsTeam, teamCtrl ); } );
+
     // Check if the off-diagonal is sufficiently small; if so, compute the
     // pseudospectrum analytically from the eigenvalues. This also takes care
     // of the case where the matrix is a constant multiple of the identity
@@ -342,6 +666,19 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     typedef Complex<Real> C;
+
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 &&
+        shiftsPre.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shiftsPre, invNorms, psCtrl,
+          [&UPre,&QPre]
+          ( const DistMatrix<C,VR,STAR>& shiftsBlock,
+            DistMatrix<Real,VR,STAR>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return TriangularSpectralCloud
+            ( UPre, QPre, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     const Grid& g = UPre.Grid();
 
     // Force 'U' to be complex and in a [MC,MR] distribution
@@ -404,6 +741,19 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
 {
     EL_DEBUG_CSE
     typedef Complex<Real> C;
+
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 &&
+        shiftsPre.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shiftsPre, invNorms, psCtrl,
+          [&UPre]
+          ( const DistMatrix<C,VR,STAR>& shiftsBlock,
+            DistMatrix<Real,VR,STAR>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return QuasiTriangularSpectralCloud
+            ( UPre, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     const Grid& g = UPre.Grid();
 
     // Force 'U' to be in a [MC,MR] distribution
@@ -414,6 +764,17 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     DistMatrixReadProxy<C,C,VR,STAR> shiftsProx( shiftsPre );
     auto& shifts = shiftsProx.GetLocked();
 
+    // Partition the grid into independent shift-queue teams if requested
+    if( psCtrl.numTeams > 1 && g.Size() > 1 && shifts.Height() > 1 )
+        return pspec::TeamCloud
+        ( U, shifts, invNorms, psCtrl,
+          []( const DistMatrix<Real>& UTeam,
+              const DistMatrix<C,VR,STAR>& shiftsTeam,
+              DistMatrix<Real,VR,STAR>& invNormsTeam,
+              const PseudospecCtrl<Real>& teamCtrl )
+          { return QuasiTriangularSpectralCloud
+            ( UTeam, shiftsTeam, invNormsTeam, teamCtrl ); } );
+
     // Check if the off-diagonal is sufficiently small; if so, compute the
     // pseudospectrum analytically from the eigenvalues. This also takes care
     // of the case where the matrix is a constant multiple of the identity
@@ -450,6 +811,19 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
 {
     EL_DEBUG_CSE
     typedef Complex<Real> C;
+
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 &&
+        shiftsPre.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shiftsPre, invNorms, psCtrl,
+          [&UPre,&QPre]
+          ( const DistMatrix<C,VR,STAR>& shiftsBlock,
+            DistMatrix<Real,VR,STAR>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return QuasiTriangularSpectralCloud
+            ( UPre, QPre, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     const Grid& g = UPre.Grid();
 
     // Force 'U' to be in a [MC,MR] distribution
@@ -497,6 +871,18 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 &&
+        shiftsPre.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shiftsPre, invNorms, psCtrl,
+          [&HPre]
+          ( const DistMatrix<C,VR,STAR>& shiftsBlock,
+            DistMatrix<Real,VR,STAR>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return HessenbergSpectralCloud
+            ( HPre, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     // Force 'H' to be complex in a [MC,MR] distribution
     DistMatrixReadProxy<Field,C,MC,MR> HProx( HPre );
     auto& H = HProx.GetLocked();
@@ -536,6 +922,18 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    // Process the shifts in bounded-size blocks if requested
+    if( psCtrl.shiftBlockSize > 0 &&
+        shiftsPre.Height() > psCtrl.shiftBlockSize )
+        return pspec::BlockedCloud
+        ( shiftsPre, invNorms, psCtrl,
+          [&HPre,&QPre]
+          ( const DistMatrix<C,VR,STAR>& shiftsBlock,
+            DistMatrix<Real,VR,STAR>& invNormsBlock,
+            const PseudospecCtrl<Real>& blockCtrl )
+          { return HessenbergSpectralCloud
+            ( HPre, QPre, shiftsBlock, invNormsBlock, blockCtrl ); } );
+
     // Force 'H' to be complex and in a [MC,MR] distribution
     DistMatrixReadProxy<Field,C,MC,MR> HProx( HPre );
     auto& H = HProx.GetLocked();
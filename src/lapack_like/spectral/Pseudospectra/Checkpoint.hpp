@@ -0,0 +1,268 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_CHECKPOINT_HPP
+#define EL_PSEUDOSPECTRA_CHECKPOINT_HPP
+
+#include <cstdio>
+#include <fstream>
+
+namespace El {
+namespace pspec {
+
+// Cooperative checkpoint/restart for the shift iterations. At ten-hour job
+// lengths the cost of losing a run to a node failure dwarfs the cost of
+// periodically spilling the iterate matrices and per-shift convergence
+// state to disk, so the drivers below serialize their state every
+// CheckpointCtrl::saveFreq iterations and can resume from the resulting
+// file instead of a random initial iterate. The checkpoint is written to a
+// scratch file and then renamed over the target so that a failure during
+// the write cannot corrupt the previous checkpoint. The matrix payloads
+// are streamed straight from the serialized spans of each buffer, so no
+// contiguous staging copy is formed.
+
+namespace checkpoint {
+
+const Int version = 1;
+const Int magic = 0x70735073; // 'psps'
+
+inline void WriteScalar( ofstream& os, Int alpha )
+{ os.write( reinterpret_cast<const char*>(&alpha), sizeof(Int) ); }
+
+inline bool ReadScalar( ifstream& is, Int& alpha )
+{
+    is.read( reinterpret_cast<char*>(&alpha), sizeof(Int) );
+    return bool(is);
+}
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void WriteMatrix( ofstream& os, const Matrix<T>& A )
+{
+    WriteScalar( os, A.Height() );
+    WriteScalar( os, A.Width() );
+    for( const auto& span : SerializedSpans(A) )
+        os.write( reinterpret_cast<const char*>(span.buf), span.numBytes );
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void WriteMatrix( ofstream& os, const Matrix<T>& A )
+{ LogicError("Checkpointing requires a packed datatype"); }
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+bool ReadMatrix( ifstream& is, Matrix<T>& A )
+{
+    Int height, width;
+    if( !ReadScalar( is, height ) || !ReadScalar( is, width ) )
+        return false;
+    if( height < 0 || width < 0 )
+        return false;
+    A.Resize( height, width );
+    for( auto& span : SerializedSpans(A) )
+        is.read( reinterpret_cast<char*>(span.buf), span.numBytes );
+    return bool(is);
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+bool ReadMatrix( ifstream& is, Matrix<T>& A )
+{ LogicError("Checkpointing requires a packed datatype"); return false; }
+
+template<typename T>
+void WriteMatrixList( ofstream& os, const vector<Matrix<T>>& AList )
+{
+    WriteScalar( os, Int(AList.size()) );
+    for( const auto& A : AList )
+        WriteMatrix( os, A );
+}
+
+template<typename T>
+bool ReadMatrixList( ifstream& is, vector<Matrix<T>>& AList )
+{
+    Int numMatrices;
+    if( !ReadScalar( is, numMatrices ) || numMatrices < 0 )
+        return false;
+    AList.resize( numMatrices );
+    for( auto& A : AList )
+        if( !ReadMatrix( is, A ) )
+            return false;
+    return true;
+}
+
+inline void WriteHeader( ofstream& os, Int scalarSize )
+{
+    WriteScalar( os, magic );
+    WriteScalar( os, version );
+    WriteScalar( os, scalarSize );
+}
+
+inline bool ReadHeader( ifstream& is, Int scalarSize )
+{
+    Int magicRead, versionRead, scalarSizeRead;
+    if( !ReadScalar( is, magicRead ) ||
+        !ReadScalar( is, versionRead ) ||
+        !ReadScalar( is, scalarSizeRead ) )
+        return false;
+    return magicRead == magic &&
+           versionRead == version &&
+           scalarSizeRead == scalarSize;
+}
+
+inline void Commit( ofstream& os, const string& filename )
+{
+    const string scratch = filename + ".tmp";
+    os.close();
+    if( !os )
+        RuntimeError("Could not write checkpoint file ",scratch);
+    if( std::rename( scratch.c_str(), filename.c_str() ) != 0 )
+        RuntimeError("Could not rename ",scratch," to ",filename);
+}
+
+} // namespace checkpoint
+
+// The state of the single-iterate drivers (inverse iteration and the
+// restarted Arnoldi driver at a restart boundary, where the rest of the
+// Krylov basis is about to be regenerated from its first column)
+template<typename Real>
+void SaveIterateCheckpoint
+( const string& filename,
+  Int numIts, Int numDone,
+  const Matrix<Int>& preimage,
+  const Matrix<Complex<Real>>& pivShifts,
+  const Matrix<Real>& estimates,
+  const Matrix<Real>& lastActiveEsts,
+  const Matrix<Int>& itCounts,
+  const Matrix<Complex<Real>>& X )
+{
+    EL_DEBUG_CSE
+    const string scratch = filename + ".tmp";
+    ofstream os( scratch.c_str(), std::ios::binary );
+    if( !os )
+        RuntimeError("Could not open checkpoint file ",scratch);
+    checkpoint::WriteHeader( os, Int(sizeof(Real)) );
+    checkpoint::WriteScalar( os, numIts );
+    checkpoint::WriteScalar( os, numDone );
+    checkpoint::WriteMatrix( os, preimage );
+    checkpoint::WriteMatrix( os, pivShifts );
+    checkpoint::WriteMatrix( os, estimates );
+    checkpoint::WriteMatrix( os, lastActiveEsts );
+    checkpoint::WriteMatrix( os, itCounts );
+    checkpoint::WriteMatrix( os, X );
+    checkpoint::Commit( os, filename );
+}
+
+// Returns false if no checkpoint file exists (a fresh start); throws if a
+// file exists but is corrupt or does not match the requested problem
+template<typename Real>
+bool LoadIterateCheckpoint
+( const string& filename,
+  Int n, Int numShifts,
+  Int& numIts, Int& numDone,
+  Matrix<Int>& preimage,
+  Matrix<Complex<Real>>& pivShifts,
+  Matrix<Real>& estimates,
+  Matrix<Real>& lastActiveEsts,
+  Matrix<Int>& itCounts,
+  Matrix<Complex<Real>>& X )
+{
+    EL_DEBUG_CSE
+    ifstream is( filename.c_str(), std::ios::binary );
+    if( !is )
+        return false;
+    if( !checkpoint::ReadHeader( is, Int(sizeof(Real)) ) ||
+        !checkpoint::ReadScalar( is, numIts ) ||
+        !checkpoint::ReadScalar( is, numDone ) ||
+        !checkpoint::ReadMatrix( is, preimage ) ||
+        !checkpoint::ReadMatrix( is, pivShifts ) ||
+        !checkpoint::ReadMatrix( is, estimates ) ||
+        !checkpoint::ReadMatrix( is, lastActiveEsts ) ||
+        !checkpoint::ReadMatrix( is, itCounts ) ||
+        !checkpoint::ReadMatrix( is, X ) )
+        RuntimeError("Checkpoint file ",filename," was invalid");
+    if( X.Height() != n || X.Width() != numShifts ||
+        pivShifts.Height() != numShifts )
+        RuntimeError
+        ("Checkpoint file ",filename," does not match the requested problem");
+    return true;
+}
+
+// The state of the Lanczos driver, whose three-term recurrence also
+// requires the previous iterate and the tridiagonal history of each shift
+template<typename Real>
+void SaveLanczosCheckpoint
+( const string& filename,
+  Int numIts, Int numDone,
+  const Matrix<Int>& preimage,
+  const Matrix<Complex<Real>>& pivShifts,
+  const Matrix<Real>& estimates,
+  const Matrix<Real>& lastActiveEsts,
+  const Matrix<Int>& itCounts,
+  const Matrix<Complex<Real>>& XOld,
+  const Matrix<Complex<Real>>& X,
+  const vector<Matrix<Real>>& HDiagList,
+  const vector<Matrix<Real>>& HSubdiagList )
+{
+    EL_DEBUG_CSE
+    const string scratch = filename + ".tmp";
+    ofstream os( scratch.c_str(), std::ios::binary );
+    if( !os )
+        RuntimeError("Could not open checkpoint file ",scratch);
+    checkpoint::WriteHeader( os, Int(sizeof(Real)) );
+    checkpoint::WriteScalar( os, numIts );
+    checkpoint::WriteScalar( os, numDone );
+    checkpoint::WriteMatrix( os, preimage );
+    checkpoint::WriteMatrix( os, pivShifts );
+    checkpoint::WriteMatrix( os, estimates );
+    checkpoint::WriteMatrix( os, lastActiveEsts );
+    checkpoint::WriteMatrix( os, itCounts );
+    checkpoint::WriteMatrix( os, XOld );
+    checkpoint::WriteMatrix( os, X );
+    checkpoint::WriteMatrixList( os, HDiagList );
+    checkpoint::WriteMatrixList( os, HSubdiagList );
+    checkpoint::Commit( os, filename );
+}
+
+template<typename Real>
+bool LoadLanczosCheckpoint
+( const string& filename,
+  Int n, Int numShifts,
+  Int& numIts, Int& numDone,
+  Matrix<Int>& preimage,
+  Matrix<Complex<Real>>& pivShifts,
+  Matrix<Real>& estimates,
+  Matrix<Real>& lastActiveEsts,
+  Matrix<Int>& itCounts,
+  Matrix<Complex<Real>>& XOld,
+  Matrix<Complex<Real>>& X,
+  vector<Matrix<Real>>& HDiagList,
+  vector<Matrix<Real>>& HSubdiagList )
+{
+    EL_DEBUG_CSE
+    ifstream is( filename.c_str(), std::ios::binary );
+    if( !is )
+        return false;
+    if( !checkpoint::ReadHeader( is, Int(sizeof(Real)) ) ||
+        !checkpoint::ReadScalar( is, numIts ) ||
+        !checkpoint::ReadScalar( is, numDone ) ||
+        !checkpoint::ReadMatrix( is, preimage ) ||
+        !checkpoint::ReadMatrix( is, pivShifts ) ||
+        !checkpoint::ReadMatrix( is, estimates ) ||
+        !checkpoint::ReadMatrix( is, lastActiveEsts ) ||
+        !checkpoint::ReadMatrix( is, itCounts ) ||
+        !checkpoint::ReadMatrix( is, XOld ) ||
+        !checkpoint::ReadMatrix( is, X ) ||
+        !checkpoint::ReadMatrixList( is, HDiagList ) ||
+        !checkpoint::ReadMatrixList( is, HSubdiagList ) )
+        RuntimeError("Checkpoint file ",filename," was invalid");
+    if( X.Height() != n || X.Width() != numShifts ||
+        pivShifts.Height() != numShifts )
+        RuntimeError
+        ("Checkpoint file ",filename," does not match the requested problem");
+    return true;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_CHECKPOINT_HPP
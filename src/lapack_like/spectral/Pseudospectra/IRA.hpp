@@ -273,6 +273,23 @@ Matrix<Int> IRA
     Zeros( estimates, numShifts, 1 );
     Matrix<Real> lastActiveEsts;
     Matrix<Int> activePreimage;
+    if( psCtrl.checkpointCtrl.resume )
+    {
+        // Resuming from a restart boundary only requires the first basis
+        // vector of each shift: the rest of the Krylov basis is regenerated
+        const bool found =
+          LoadIterateCheckpoint
+          ( psCtrl.checkpointCtrl.Filename(), n, numShifts,
+            numIts, numDone, preimage, pivShifts,
+            estimates, lastActiveEsts, itCounts, VList[0] );
+        if( progress )
+        {
+            if( found )
+                Output("Resumed from checkpoint at iteration ",numIts);
+            else
+                Output("No checkpoint found; starting from scratch");
+        }
+    }
     while( true )
     {
         const Int numActive = ( deflate ? numShifts-numDone : numShifts );
@@ -429,6 +446,12 @@ Matrix<Int> IRA
         // Save snapshots of the estimates at the requested rate
         Snapshot
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
+
+        if( psCtrl.checkpointCtrl.ShouldSave( numIts, basisSize ) )
+            SaveIterateCheckpoint
+            ( psCtrl.checkpointCtrl.Filename(), numIts, numDone,
+              preimage, pivShifts, estimates, lastActiveEsts, itCounts,
+              VList[0] );
     }
 
     invNorms = estimates;
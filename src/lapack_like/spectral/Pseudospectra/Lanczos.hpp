@@ -282,6 +282,23 @@ Lanczos
     Matrix<Int> activePreimage;
     Matrix<Real> components;
     Matrix<Real> colNorms;
+    if( psCtrl.checkpointCtrl.resume )
+    {
+        const bool found =
+          LoadLanczosCheckpoint
+          ( psCtrl.checkpointCtrl.Filename(), n, numShifts,
+            numIts, numDone, preimage, pivShifts,
+            estimates, lastActiveEsts, itCounts,
+            XOld, X, HDiagList, HSubdiagList );
+        if( progress )
+        {
+            if( found )
+                cout << "Resumed from checkpoint at iteration "
+                     << numIts << endl;
+            else
+                cout << "No checkpoint found; starting from scratch" << endl;
+        }
+    }
     while( true )
     {
         const Int numActive = ( deflate ? numShifts-numDone : numShifts );
@@ -395,6 +412,12 @@ Lanczos
         psCtrl.snapCtrl.Iterate();
         Snapshot
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
+
+        if( psCtrl.checkpointCtrl.ShouldSave( numIts ) )
+            SaveLanczosCheckpoint
+            ( psCtrl.checkpointCtrl.Filename(), numIts, numDone,
+              preimage, pivShifts, estimates, lastActiveEsts, itCounts,
+              XOld, X, HDiagList, HSubdiagList );
     }
 
     invNorms = estimates;
@@ -10,6 +10,7 @@
 #define EL_PSEUDOSPECTRA_POWER_HPP
 
 #include "./Util.hpp"
+#include "./Checkpoint.hpp"
 
 namespace El {
 namespace pspec {
@@ -252,6 +253,21 @@ Power
     Zeros( estimates, numShifts, 1 );
     auto lastActiveEsts = estimates;
     Matrix<Int> activePreimage;
+    if( psCtrl.checkpointCtrl.resume )
+    {
+        const bool found =
+          LoadIterateCheckpoint
+          ( psCtrl.checkpointCtrl.Filename(), n, numShifts,
+            numIts, numDone, preimage, pivShifts,
+            estimates, lastActiveEsts, itCounts, X );
+        if( progress )
+        {
+            if( found )
+                Output("Resumed from checkpoint at iteration ",numIts);
+            else
+                Output("No checkpoint found; starting from scratch");
+        }
+    }
     while( true )
     {
         const Int numActive = ( deflate ? numShifts-numDone : numShifts );
@@ -320,6 +336,11 @@ Power
         psCtrl.snapCtrl.Iterate();
         Snapshot
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
+
+        if( psCtrl.checkpointCtrl.ShouldSave( numIts ) )
+            SaveIterateCheckpoint
+            ( psCtrl.checkpointCtrl.Filename(), numIts, numDone,
+              preimage, pivShifts, estimates, lastActiveEsts, itCounts, X );
     }
 
     invNorms = estimates;
@@ -10,6 +10,7 @@
 
 #include "./SVD/Chan.hpp"
 #include "./SVD/Product.hpp"
+#include "./SVD/Randomized.hpp"
 
 namespace El {
 
@@ -766,7 +767,19 @@ SVDInfo TSQR
   ( const AbstractDistMatrix<Field>& A, \
           AbstractDistMatrix<Field>& U, \
           AbstractDistMatrix<Base<Field>>& s, \
-          AbstractDistMatrix<Field>& V );
+          AbstractDistMatrix<Field>& V ); \
+  template SVDInfo svd::Randomized \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& U, \
+          Matrix<Base<Field>>& s, \
+          Matrix<Field>& V, \
+    const SVDCtrl<Base<Field>>& ctrl ); \
+  template SVDInfo svd::Randomized \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& U, \
+          AbstractDistMatrix<Base<Field>>& s, \
+          AbstractDistMatrix<Field>& V, \
+    const SVDCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,286 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_RANDOMIZED_HPP
+#define EL_SVD_RANDOMIZED_HPP
+
+namespace El {
+namespace svd {
+
+// Approximate the truncated SVD of A through the randomized range finder
+// of Halko, Martinsson, and Tropp: a Gaussian sketch of the column space,
+// a few optional power iterations (each re-orthonormalized through QR so
+// that the sketch does not collapse onto the dominant singular subspace),
+// and a small dense SVD of the projection of A onto the range estimate.
+// The cost is dominated by a handful of products with A, as opposed to a
+// full bidiagonalization, which is the appropriate tradeoff when only a
+// modest number of dominant singular triplets of a very large matrix are
+// of interest.
+
+namespace randomized {
+
+template<typename Field>
+SVDInfo RangeFinder
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min( m, n );
+    const auto& randCtrl = ctrl.randomizedCtrl;
+    const Int k = Min( Max(randCtrl.rank,Int(1)), minDim );
+    const Int l = Min( k + Max(randCtrl.oversample,Int(0)), minDim );
+
+    // Sketch the column space of A
+    Matrix<Field> Omega, Q;
+    Gaussian( Omega, n, l );
+    Gemm( NORMAL, NORMAL, Field(1), A, Omega, Q );
+    qr::ExplicitUnitary( Q );
+
+    // Sharpen the range estimate with alternating applications of A^H
+    // and A
+    Matrix<Field> Z;
+    for( Int powerIt=0; powerIt<randCtrl.numPowerIts; ++powerIt )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), A, Q, Z );
+        qr::ExplicitUnitary( Z );
+        Gemm( NORMAL, NORMAL, Field(1), A, Z, Q );
+        qr::ExplicitUnitary( Q );
+    }
+
+    // Project A onto the range estimate and decompose the projection
+    Matrix<Field> B;
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+    auto subCtrl = ctrl;
+    subCtrl.overwrite = true;
+    subCtrl.bidiagSVDCtrl.approach = THIN_SVD;
+    Matrix<Field> UB, VB;
+    Matrix<Real> sB;
+    auto info = SVD( B, UB, sB, VB, subCtrl );
+
+    // Truncate to the target rank
+    auto UBL = UB( ALL, IR(0,k) );
+    Gemm( NORMAL, NORMAL, Field(1), Q, UBL, U );
+    s = sB( IR(0,k), ALL );
+    V = VB( ALL, IR(0,k) );
+    return info;
+}
+
+template<typename Field>
+SVDInfo RangeFinder
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min( m, n );
+    const auto& randCtrl = ctrl.randomizedCtrl;
+    const Int k = Min( Max(randCtrl.rank,Int(1)), minDim );
+    const Int l = Min( k + Max(randCtrl.oversample,Int(0)), minDim );
+
+    // Sketch the column space of A
+    DistMatrix<Field> Omega(g), Q(g);
+    Gaussian( Omega, n, l );
+    Gemm( NORMAL, NORMAL, Field(1), A, Omega, Q );
+    qr::ExplicitUnitary( Q );
+
+    // Sharpen the range estimate with alternating applications of A^H
+    // and A
+    DistMatrix<Field> Z(g);
+    for( Int powerIt=0; powerIt<randCtrl.numPowerIts; ++powerIt )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), A, Q, Z );
+        qr::ExplicitUnitary( Z );
+        Gemm( NORMAL, NORMAL, Field(1), A, Z, Q );
+        qr::ExplicitUnitary( Q );
+    }
+
+    // Project A onto the range estimate and decompose the projection
+    DistMatrix<Field> B(g);
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+    auto subCtrl = ctrl;
+    subCtrl.overwrite = true;
+    subCtrl.bidiagSVDCtrl.approach = THIN_SVD;
+    DistMatrix<Field> UB(g), VB(g);
+    DistMatrix<Real,STAR,STAR> sB(g);
+    auto info = SVD( B, UB, sB, VB, subCtrl );
+
+    // Truncate to the target rank
+    auto UBL = UB( ALL, IR(0,k) );
+    Gemm( NORMAL, NORMAL, Field(1), Q, UBL, U );
+    Copy( sB( IR(0,k), ALL ), s );
+    Copy( VB( ALL, IR(0,k) ), V );
+    return info;
+}
+
+// A streaming variant which only touches A through the two sketches
+// Y = A Omega and W = A^H Psi. The projected matrix B ~= Q^H A P cannot be
+// formed directly without revisiting A, but it satisfies
+// Q^H Y = B (P^H Omega) and is recovered in the least-squares sense
+// (cf. Section 5.5 of Halko et al.)
+
+template<typename Field>
+SVDInfo SinglePass
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min( m, n );
+    const auto& randCtrl = ctrl.randomizedCtrl;
+    const Int k = Min( Max(randCtrl.rank,Int(1)), minDim );
+    const Int l = Min( k + Max(randCtrl.oversample,Int(0)), minDim );
+
+    // Sketch the column and row spaces of A in a single pass
+    Matrix<Field> Omega, Psi, Q, P;
+    Gaussian( Omega, n, l );
+    Gaussian( Psi, m, l );
+    Gemm( NORMAL, NORMAL, Field(1), A, Omega, Q );
+    Gemm( ADJOINT, NORMAL, Field(1), A, Psi, P );
+    Matrix<Field> Y( Q );
+    qr::ExplicitUnitary( Q );
+    qr::ExplicitUnitary( P );
+
+    // Recover B from Q^H Y = B (P^H Omega)
+    Matrix<Field> C1, C2;
+    Gemm( ADJOINT, NORMAL, Field(1), Q, Y, C1 );
+    Gemm( ADJOINT, NORMAL, Field(1), P, Omega, C2 );
+    // Solve B (P^H Omega) = Q^H Y via its adjoint,
+    // (P^H Omega)^H B^H = (Q^H Y)^H
+    Matrix<Field> C1Adj, C2Adj, BAdj, B;
+    Adjoint( C1, C1Adj );
+    Adjoint( C2, C2Adj );
+    LeastSquares( NORMAL, C2Adj, C1Adj, BAdj );
+    Adjoint( BAdj, B );
+
+    // Decompose the recovered projection
+    auto subCtrl = ctrl;
+    subCtrl.overwrite = true;
+    subCtrl.bidiagSVDCtrl.approach = THIN_SVD;
+    Matrix<Field> UB, VB;
+    Matrix<Real> sB;
+    auto info = SVD( B, UB, sB, VB, subCtrl );
+
+    // Truncate to the target rank
+    auto UBL = UB( ALL, IR(0,k) );
+    auto VBL = VB( ALL, IR(0,k) );
+    Gemm( NORMAL, NORMAL, Field(1), Q, UBL, U );
+    Gemm( NORMAL, NORMAL, Field(1), P, VBL, V );
+    s = sB( IR(0,k), ALL );
+    return info;
+}
+
+template<typename Field>
+SVDInfo SinglePass
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min( m, n );
+    const auto& randCtrl = ctrl.randomizedCtrl;
+    const Int k = Min( Max(randCtrl.rank,Int(1)), minDim );
+    const Int l = Min( k + Max(randCtrl.oversample,Int(0)), minDim );
+
+    // Sketch the column and row spaces of A in a single pass
+    DistMatrix<Field> Omega(g), Psi(g), Q(g), P(g);
+    Gaussian( Omega, n, l );
+    Gaussian( Psi, m, l );
+    Gemm( NORMAL, NORMAL, Field(1), A, Omega, Q );
+    Gemm( ADJOINT, NORMAL, Field(1), A, Psi, P );
+    DistMatrix<Field> Y( Q );
+    qr::ExplicitUnitary( Q );
+    qr::ExplicitUnitary( P );
+
+    // Recover B from Q^H Y = B (P^H Omega)
+    DistMatrix<Field> C1(g), C2(g);
+    Gemm( ADJOINT, NORMAL, Field(1), Q, Y, C1 );
+    Gemm( ADJOINT, NORMAL, Field(1), P, Omega, C2 );
+    // Solve B (P^H Omega) = Q^H Y via its adjoint,
+    // (P^H Omega)^H B^H = (Q^H Y)^H
+    DistMatrix<Field> C1Adj(g), C2Adj(g), BAdj(g), B(g);
+    Adjoint( C1, C1Adj );
+    Adjoint( C2, C2Adj );
+    LeastSquares( NORMAL, C2Adj, C1Adj, BAdj );
+    Adjoint( BAdj, B );
+
+    // Decompose the recovered projection
+    auto subCtrl = ctrl;
+    subCtrl.overwrite = true;
+    subCtrl.bidiagSVDCtrl.approach = THIN_SVD;
+    DistMatrix<Field> UB(g), VB(g);
+    DistMatrix<Real,STAR,STAR> sB(g);
+    auto info = SVD( B, UB, sB, VB, subCtrl );
+
+    // Truncate to the target rank
+    auto UBL = UB( ALL, IR(0,k) );
+    auto VBL = VB( ALL, IR(0,k) );
+    Gemm( NORMAL, NORMAL, Field(1), Q, UBL, U );
+    Gemm( NORMAL, NORMAL, Field(1), P, VBL, V );
+    Copy( sB( IR(0,k), ALL ), s );
+    return info;
+}
+
+} // namespace randomized
+
+template<typename Field>
+SVDInfo Randomized
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.randomizedCtrl.singlePass )
+        return randomized::SinglePass( A, U, s, V, ctrl );
+    else
+        return randomized::RangeFinder( A, U, s, V, ctrl );
+}
+
+template<typename Field>
+SVDInfo Randomized
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.randomizedCtrl.singlePass )
+        return randomized::SinglePass( A, U, s, V, ctrl );
+    else
+        return randomized::RangeFinder( A, U, s, V, ctrl );
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_RANDOMIZED_HPP
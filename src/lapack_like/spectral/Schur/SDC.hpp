@@ -140,7 +140,11 @@ ValueInt<Base<F>> SignDivide
 
     // G := sgn(G)
     // G := 1/2 ( G + I )
-    Sign( G, ctrl.signCtrl );
+    // (with the Newton iteration finished by the level-3 Newton-Schulz
+    // iteration once its convergence is guaranteed)
+    auto signCtrl( ctrl.signCtrl );
+    signCtrl.newtonSchulzHybrid = true;
+    Sign( G, signCtrl );
     ShiftDiagonal( G, F(1) );
     G *= F(1)/F(2);
 
@@ -185,7 +189,11 @@ ValueInt<Base<F>> SignDivide
 
     // G := sgn(G)
     // G := 1/2 ( G + I )
-    Sign( G, ctrl.signCtrl );
+    // (with the Newton iteration finished by the level-3 Newton-Schulz
+    // iteration once its convergence is guaranteed)
+    auto signCtrl( ctrl.signCtrl );
+    signCtrl.newtonSchulzHybrid = true;
+    Sign( G, signCtrl );
     ShiftDiagonal( G, F(1) );
     G *= F(1)/F(2);
 
@@ -236,7 +244,9 @@ ValueInt<Base<F>> RandomizedSignDivide
     // S := sgn(G)
     // S := 1/2 ( S + I )
     auto S( G );
-    Sign( S, ctrl.signCtrl );
+    auto signCtrl( ctrl.signCtrl );
+    signCtrl.newtonSchulzHybrid = true;
+    Sign( S, signCtrl );
     ShiftDiagonal( S, F(1) );
     S *= F(1)/F(2);
 
@@ -301,7 +311,9 @@ ValueInt<Base<F>> RandomizedSignDivide
     // S := sgn(G)
     // S := 1/2 ( S + I )
     auto S( G );
-    Sign( S, ctrl.signCtrl );
+    auto signCtrl( ctrl.signCtrl );
+    signCtrl.newtonSchulzHybrid = true;
+    Sign( S, signCtrl );
     ShiftDiagonal( S, F(1) );
     S *= F(1)/F(2);
 
@@ -1028,8 +1040,9 @@ SDC
 // teams since it was found to lead to horrendously non-square process grids
 // in practice, even when the original number of processes was a large power
 // of two. Instead, the grid is either split in half, or not split at all.
-// The choice is made based upon whether or not one subproblem requires twice
-// as much work as the other. There is a complicated calculus here that would
+// The choice is made based upon whether or not one subproblem requires more
+// than splitFactor times as much work as the other (with a default factor of
+// two). There is a complicated calculus here that would
 // require a much more sophisticated (machine- and problem-specific) model to
 // make the 'best' splitting, but this approach should be a good compromise.
 inline bool SplitGrid
@@ -1038,12 +1051,13 @@ inline bool SplitGrid
   const Grid& grid,
   const Grid*& leftGrid,
   const Grid*& rightGrid,
+  double splitFactor=2,
   bool progress=false )
 {
     typedef double Real;
     const Real leftWork = Pow(Real(nLeft),Real(3));
     const Real rightWork = Pow(Real(nRight),Real(3));
-    if( Max(leftWork,rightWork) > 2*Min(leftWork,rightWork) )
+    if( Max(leftWork,rightWork) > splitFactor*Min(leftWork,rightWork) )
     {
         // Don't split the grid
         leftGrid = &grid;
@@ -1093,6 +1107,7 @@ bool PushSubproblems
   DistMatrix<EigType,VR,STAR>& wB,
   DistMatrix<EigType,VR,STAR>& wTSub,
   DistMatrix<EigType,VR,STAR>& wBSub,
+  double splitFactor=2,
   bool progress=false )
 {
     EL_DEBUG_CSE
@@ -1101,7 +1116,8 @@ bool PushSubproblems
     // Split based on the work estimates
     const Grid *leftGrid, *rightGrid;
     const bool splitGrid = SplitGrid
-      ( ATL.Height(), ABR.Height(), grid, leftGrid, rightGrid, progress );
+      ( ATL.Height(), ABR.Height(), grid, leftGrid, rightGrid,
+        splitFactor, progress );
     ATLSub.SetGrid( *leftGrid );
     ABRSub.SetGrid( *rightGrid );
     wTSub.SetGrid( *leftGrid );
@@ -1245,7 +1261,8 @@ SDC
         DistMatrix<F> ATLSub, ABRSub;
         DistMatrix<Complex<Base<F>>,VR,STAR> wTSub, wBSub;
         splitGrid = PushSubproblems
-          ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, ctrl.progress );
+          ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub,
+            double(ctrl.splitFactor), ctrl.progress );
         leftGrid = &wTSub.Grid();
         rightGrid = &wBSub.Grid();
         if( ATLSub.Participating() )
@@ -1277,6 +1294,7 @@ void PushSubproblems
   DistMatrix<EigType,VR,STAR>& wBSub,
   DistMatrix<F>& ZTSub,
   DistMatrix<F>& ZBSub,
+  double splitFactor=2,
   bool progress=false )
 {
     EL_DEBUG_CSE
@@ -1285,7 +1303,8 @@ void PushSubproblems
     // Split based on the work estimates
     const Grid *leftGrid, *rightGrid;
     SplitGrid
-    ( ATL.Height(), ABR.Height(), grid, leftGrid, rightGrid, progress );
+    ( ATL.Height(), ABR.Height(), grid, leftGrid, rightGrid,
+      splitFactor, progress );
     ATLSub.SetGrid( *leftGrid );
     ABRSub.SetGrid( *rightGrid );
     wTSub.SetGrid( *leftGrid );
@@ -1457,7 +1476,7 @@ SDC
         Output("Pushing subproblems");
     PushSubproblems
     ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, ZTSub, ZBSub,
-      ctrl.progress );
+      double(ctrl.splitFactor), ctrl.progress );
     if( ATLSub.Participating() )
         SDC( ATLSub, wTSub, ZTSub, fullTriangle, ctrl );
     if( ABRSub.Participating() )
@@ -488,7 +488,7 @@ void SecularUpdate
         const Real rightGap = state.dMinusShift(origin+1);
 
         Real a;
-        Matrix<Real> zCubic(3,1);
+        StaticMatrix<Real,3,1> zCubic;
         if( state.alternateStrategy )
         {
             a = state.secularMinus - leftGap*state.psiMinusDeriv -
@@ -597,7 +597,7 @@ void SecularUpdate
                 zCubic(2) = z(origin+1)*z(origin+1);
             }
         }
-        Matrix<Real> dCubic(3,1);
+        StaticMatrix<Real,3,1> dCubic;
         dCubic(0) = leftGap;
         dCubic(1) = state.dMinusShift(origin);
         dCubic(2) = rightGap;
@@ -1302,30 +1302,46 @@ SecularEVD
     // (Cf. LAPACK's {s,d}lasd8 [CITATION] for this approach).
     //
     Q.Resize( n, n );
-    Matrix<Real> r;
-    Ones( r, n, 1 );
+    // The roots of the secular equation are independent of each other, so we
+    // solve for them in parallel and accumulate the iteration counts
+    // afterwards
+    vector<SecularEVDInfo> valueInfos(n);
+    EL_PARALLEL_FOR
     for( Int j=0; j<n; ++j )
     {
         // While we will temporarily store dMinusShift in the j'th column of Q.
         auto q = Q(ALL,IR(j));
-        auto valueInfo = SecularEigenvalue( j, d, rho, z, w(j), q, ctrl );
-        
-        info.numIterations += valueInfo.numIterations;
-        info.numAlternations += valueInfo.numAlternations;
-        info.numCubicIterations += valueInfo.numCubicIterations;
-        info.numCubicFailures += valueInfo.numCubicFailures;
-
-        r(j) *= q(j);
-        for( Int k=0; k<n; ++k )
+        valueInfos[j] = SecularEigenvalue( j, d, rho, z, w(j), q, ctrl );
+    }
+    for( Int j=0; j<n; ++j )
+    {
+        info.numIterations += valueInfos[j].numIterations;
+        info.numAlternations += valueInfos[j].numAlternations;
+        info.numCubicIterations += valueInfos[j].numCubicIterations;
+        info.numCubicFailures += valueInfos[j].numCubicFailures;
+    }
+
+    // Each entry of r is a product over all of the roots, so, rather than
+    // scattering each root's contribution into every entry as it is found,
+    // we gather the contributions of the (already computed) roots into each
+    // entry independently (preserving the order of the factors)
+    Matrix<Real> r;
+    r.Resize( n, 1 );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<n; ++k )
+    {
+        Real rProd = 1;
+        for( Int j=0; j<n; ++j )
         {
-            if( k == j )
-                continue;
-            r(k) *= q(k) / (d(j)-d(k));
+            if( j == k )
+                rProd *= Q(k,j);
+            else
+                rProd *= Q(k,j) / (d(j)-d(k));
         }
+        r(k) = Sgn(z(k),false) * Sqrt(Abs(rProd));
     }
-    for( Int j=0; j<n; ++j )
-        r(j) = Sgn(z(j),false) * Sqrt(Abs(r(j)));
 
+    EL_PARALLEL_FOR
     for( Int j=0; j<n; ++j )
     {
         // Compute the j'th eigenvectors via Eqs. (3.4) and (3.3), respectively.
@@ -604,7 +604,7 @@ void SecularUpdate
           state.dPlusShift(origin+1)*state.dMinusShift(origin+1);
 
         Real a;
-        Matrix<Real> zCubic(3,1);
+        StaticMatrix<Real,3,1> zCubic;
         if( state.alternateStrategy )
         {
             a = state.secularMinus - leftGap*state.psiMinusDeriv -
@@ -715,7 +715,7 @@ void SecularUpdate
                 zCubic(2) = z(origin+1)*z(origin+1);
             }
         }
-        Matrix<Real> dCubic(3,1);
+        StaticMatrix<Real,3,1> dCubic;
         dCubic(0) = leftGap;
         dCubic(1) = state.dPlusShift(origin)*state.dMinusShift(origin);
         dCubic(2) = rightGap;
@@ -1490,40 +1490,57 @@ SecularSVD
     //
     U.Resize( n, n );
     V.Resize( n, n );
-    Matrix<Real> r;
-    Ones( r, n, 1 );
-    auto vScratch = V(ALL,IR(0));
+    // The roots of the secular equation are independent of each other, so we
+    // solve for them in parallel (with a per-root scratch vector for the
+    // shifted diagonal) and accumulate the iteration counts afterwards
+    vector<SecularSVDInfo> valueInfos(n);
+    EL_PARALLEL_FOR
     for( Int j=0; j<n; ++j )
     {
         // While we will temporarily store dMinusShift and dPlusShift in the
-        // j'th columns of U and V, respectively, it is worth noting that we 
-        // only require access to their Hadamard product after this loop ends.
+        // j'th column of U and a scratch vector, respectively, it is worth
+        // noting that we only require access to their Hadamard product after
+        // this loop ends.
         auto u = U(ALL,IR(j));
-        auto valueInfo =
+        Matrix<Real> vScratch;
+        valueInfos[j] =
           SecularSingularValue( j, d, rho, z, s(j), u, vScratch, ctrl );
-        
-        info.numIterations += valueInfo.numIterations;
-        info.numAlternations += valueInfo.numAlternations;
-        info.numCubicIterations += valueInfo.numCubicIterations;
-        info.numCubicFailures += valueInfo.numCubicFailures;
 
         // u currently hold d-s(j) and vScratch currently holds d+s(j).
-        // Overwrite u with their element-wise product since that is all we 
+        // Overwrite u with their element-wise product since that is all we
         // require from here on out.
         for( Int k=0; k<n; ++k )
             u(k) *= vScratch(k);
-      
-        r(j) *= u(j);
-        for( Int k=0; k<n; ++k )
+    }
+    for( Int j=0; j<n; ++j )
+    {
+        info.numIterations += valueInfos[j].numIterations;
+        info.numAlternations += valueInfos[j].numAlternations;
+        info.numCubicIterations += valueInfos[j].numCubicIterations;
+        info.numCubicFailures += valueInfos[j].numCubicFailures;
+    }
+
+    // Each entry of r is a product over all of the roots, so, rather than
+    // scattering each root's contribution into every entry as it is found,
+    // we gather the contributions of the (already computed) roots into each
+    // entry independently (preserving the order of the factors)
+    Matrix<Real> r;
+    r.Resize( n, 1 );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<n; ++k )
+    {
+        Real rProd = 1;
+        for( Int j=0; j<n; ++j )
         {
-            if( k == j )
-                continue;
-            r(k) *= u(k) / ((d(j)+d(k))*(d(j)-d(k)));
+            if( j == k )
+                rProd *= U(k,j);
+            else
+                rProd *= U(k,j) / ((d(j)+d(k))*(d(j)-d(k)));
         }
+        r(k) = Sgn(z(k),false) * Sqrt(Abs(rProd));
     }
-    for( Int j=0; j<n; ++j )
-        r(j) = Sgn(z(j),false) * Sqrt(Abs(r(j)));
 
+    EL_PARALLEL_FOR
     for( Int j=0; j<n; ++j )
     {
         // Compute the j'th left and right singular vectors via
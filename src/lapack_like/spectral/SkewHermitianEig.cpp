@@ -10,12 +10,113 @@
 
 namespace El {
 
+namespace skew_herm_eig {
+
+// Reduce the real skew-symmetric matrix A to skew-symmetric tridiagonal form
+// with Householder similarity transformations and return its subdiagonal
+// (the diagonal of a real skew-symmetric matrix is identically zero). Since
+// v^T A v = 0 for any skew-symmetric A, each two-sided update simplifies to
+// the skew rank-two correction A := A + tau v w^T - tau w v^T with w = A v.
+template<typename Real>
+void SkewTridiag( Matrix<Real>& A, Matrix<Real>& e )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    e.Resize( Max(n-1,Int(0)), 1 );
+    Matrix<Real> v, w;
+    for( Int k=0; k<n-1; ++k )
+    {
+        const Int nb = n-(k+1);
+        auto alpha21T = A( IR(k+1,k+2), IR(k,k+1) );
+        auto a21B = A( IR(k+2,n), IR(k,k+1) );
+        const Real tau = LeftReflector( alpha21T, a21B );
+        e(k) = alpha21T(0);
+
+        v.Resize( nb, 1 );
+        v(0) = Real(1);
+        for( Int i=1; i<nb; ++i )
+            v(i) = a21B(i-1);
+
+        auto A22 = A( IR(k+1,n), IR(k+1,n) );
+        w.Resize( nb, 1 );
+        Gemv( NORMAL, Real(1), A22, v, Real(0), w );
+        Ger(  tau, v, w, A22 );
+        Ger( -tau, w, v, A22 );
+    }
+}
+
+// Map the subdiagonal of the skew-symmetric tridiagonal form to the
+// imaginary parts of the eigenvalues: a perfect-shuffle similarity sends the
+// tridiagonal matrix to [0, B; -B^T, 0], where B is upper bidiagonal with
+// main diagonal e(0),e(2),... and off-diagonal e(1),e(3),..., so the
+// spectrum is +-i sigma_j(B), padded with a zero when n is odd.
+template<typename Real>
+void TridiagEig( Int n, const Matrix<Real>& e, Matrix<Real>& wImag )
+{
+    EL_DEBUG_CSE
+    const Int mainLen = n/2;
+    const Int offLen = ( n==0 ? 0 : (n-1)/2 );
+    Matrix<Real> mainDiag( mainLen, 1 ), offDiag( offLen, 1 ), s;
+    for( Int i=0; i<mainLen; ++i )
+        mainDiag(i) = e(2*i);
+    for( Int i=0; i<offLen; ++i )
+        offDiag(i) = e(2*i+1);
+    BidiagSVDCtrl<Real> bidiagSVDCtrl;
+    bidiagSVDCtrl.wantU = false;
+    bidiagSVDCtrl.wantV = false;
+    BidiagSVD( UPPER, mainDiag, offDiag, s, bidiagSVDCtrl );
+    const Int numPairs = s.Height();
+    wImag.Resize( n, 1 );
+    for( Int j=0; j<numPairs; ++j )
+    {
+        wImag(2*j) = s(j);
+        wImag(2*j+1) = -s(j);
+    }
+    for( Int j=2*numPairs; j<n; ++j )
+        wImag(j) = Real(0);
+}
+
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+HermitianEigInfo
+RealHelper
+( UpperOrLower uplo,
+  const Matrix<Real>& G,
+        Matrix<Real>& wImag,
+  const HermitianEigCtrl<Complex<Real>>& ctrl )
+{
+    EL_DEBUG_CSE
+    HermitianEigInfo info;
+    const Int n = G.Height();
+
+    // Expand the given triangle into a full skew-symmetric matrix
+    Matrix<Real> A( G );
+    if( uplo == LOWER )
+        MakeTrapezoidal( LOWER, A, -1 );
+    else
+        MakeTrapezoidal( UPPER, A, 1 );
+    Matrix<Real> ATrans;
+    Transpose( A, ATrans );
+    Axpy( Real(-1), ATrans, A );
+
+    Matrix<Real> e;
+    SkewTridiag( A, e );
+    TridiagEig( n, e, wImag );
+    Sort( wImag, ctrl.tridiagEigCtrl.sort );
+    return info;
+}
+
+} // namespace skew_herm_eig
+
 // Compute eigenvalues
 // ===================
 
-template<typename Field>
+namespace skew_herm_eig {
+
+template<typename Field,
+         typename=EnableIf<IsComplex<Field>>>
 HermitianEigInfo
-SkewHermitianEig
+Helper
 ( UpperOrLower uplo,
   const Matrix<Field>& G,
         Matrix<Base<Field>>& wImag,
@@ -28,6 +129,45 @@ SkewHermitianEig
     return HermitianEig( uplo, A, wImag, ctrl );
 }
 
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>,
+         typename=void>
+HermitianEigInfo
+Helper
+( UpperOrLower uplo,
+  const Matrix<Real>& G,
+        Matrix<Real>& wImag,
+  const HermitianEigCtrl<Complex<Real>>& ctrl )
+{
+    EL_DEBUG_CSE
+    // Real skew-symmetric matrices can be handled entirely in real
+    // arithmetic; fall back to the complex embedding when a spectral subset
+    // or an alternative driver was explicitly requested
+    if( !ctrl.useSDC && !ctrl.useScaLAPACK &&
+        !ctrl.tridiagEigCtrl.subset.indexSubset &&
+        !ctrl.tridiagEigCtrl.subset.rangeSubset )
+        return RealHelper( uplo, G, wImag, ctrl );
+
+    Matrix<Complex<Real>> A;
+    Copy( G, A );
+    ScaleTrapezoid( Complex<Real>(0,-1), uplo, A );
+    return HermitianEig( uplo, A, wImag, ctrl );
+}
+
+} // namespace skew_herm_eig
+
+template<typename Field>
+HermitianEigInfo
+SkewHermitianEig
+( UpperOrLower uplo,
+  const Matrix<Field>& G,
+        Matrix<Base<Field>>& wImag,
+  const HermitianEigCtrl<Complex<Base<Field>>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return skew_herm_eig::Helper( uplo, G, wImag, ctrl );
+}
+
 template<typename Field>
 HermitianEigInfo
 SkewHermitianEig
@@ -23,12 +23,17 @@ namespace triang_eig {
 // See "Robust Triangular Solves for Use in Condition
 // Estimation" by Edward Anderson for notation and bounds.
 // Entries in U are assumed to be less (in magnitude) than bigNum.
+// 'colOffset' is the number of eigenvector columns which precede the first
+// supplied right-hand side, so that column j of X extends over the top
+// Min(n,colOffset+j) rows of the diagonal block; it is zero whenever the
+// supplied window begins at the diagonal block itself.
 template<typename Field>
 void MultiShiftDiagonalBlockSolve
 (       Matrix<Field>& U,
   const Matrix<Field>& shifts,
         Matrix<Field>& X,
-        Matrix<Field>& scales )
+        Matrix<Field>& scales,
+        Int colOffset=0 )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
@@ -68,9 +73,9 @@ void MultiShiftDiagonalBlockSolve
     }
 
     // Iterate through RHS's
-    for( Int j=1; j<numShifts; ++j )
+    for( Int j=( colOffset==0 ? 1 : 0 ); j<numShifts; ++j )
     {
-        const Int xHeight = Min(n,j);
+        const Int xHeight = Min(n,colOffset+j);
 
         // Initialize triangular system
         // TODO(poulson): Only modify the first xHeight entries of the diagonal
@@ -425,28 +430,26 @@ void MultiShiftDiagonalBlockSolve
     SetDiagonal( ULoc, diag );
 }
 
+// Run the blocked backward substitution for the eigenvector columns
+// [colBeg,colEnd), where both endpoints lie on block boundaries (except
+// possibly colEnd=n). The columns of distinct ranges are independent, so
+// several ranges may be processed concurrently; the diagonal block is
+// copied before its diagonal is shifted so that U itself is only read.
 template<typename Field>
-void MultiShiftSolve
-(       Matrix<Field>& U,
+void MultiShiftSolveRange
+( const Matrix<Field>& U,
   const Matrix<Field>& shifts,
         Matrix<Field>& X,
-        Matrix<Field>& scales )
+        Matrix<Field>& scales,
+        Matrix<Base<Field>>& XMax,
+        Int colBeg,
+        Int colEnd )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-
-    EL_DEBUG_ONLY(
-      if( U.Height() != U.Width() )
-          LogicError("Triangular matrix must be square");
-      if( U.Width() != X.Height() )
-          LogicError("Matrix dimensions do not match");
-      if( shifts.Height() != X.Width() )
-          LogicError("Incompatible number of shifts");
-    )
     const Int m = X.Height();
-    const Int n = X.Width();
     const Int bsize = Blocksize();
-    const Int kLast = LastOffset( m, bsize );
+    const Int kLast = LastOffset( colEnd, bsize );
 
     const Real oneHalf = Real(1)/Real(2);
 
@@ -456,59 +459,38 @@ void MultiShiftSolve
     const Real smallNum = Max( underflow/ulp, Real(1)/(overflow*ulp) );
     const Real bigNum = Real(1)/smallNum;
 
-    EL_DEBUG_ONLY(
-      if( MaxNorm(U) >= bigNum )
-          LogicError("Entries in matrix are too large");
-    )
-
-    Ones( scales, n, 1 );
-    Matrix<Field> scalesUpdate( n, 1 );
-
-    // Determine largest entry of each RHS
-    Matrix<Real> XMax( n, 1 );
-    for( Int j=0; j<n; ++j )
-    {
-        auto xj = X( IR(0,j), IR(j) );
-        Real xjMax = MaxNorm( xj );
-        if( xjMax >= bigNum )
-        {
-            const Real s = oneHalf*bigNum/xjMax;
-            xj *= s;
-            xjMax *= s;
-            scales(j) *= s;
-        }
-        xjMax = Max( xjMax, 2*smallNum );
-        XMax(j) = xjMax;
-    }
+    Matrix<Field> U11Copy;
+    Matrix<Field> scalesUpdate( colEnd-colBeg, 1 );
 
     // Perform block triangular solve
     for( Int k=kLast; k>=0; k-=bsize )
     {
         const Int nb = Min(bsize,m-k);
+        const Int jBeg = Max( k, colBeg );
 
         const Range<Int> ind0( 0,    k    ),
-                         ind1( k,    k+nb ),
-                         ind2( k+nb, END  );
+                         ind1( k,    k+nb );
 
         auto U01 = U( ind0, ind1 );
         auto U11 = U( ind1, ind1 );
 
         // TODO(poulson): More descriptive names given exploiting
         // upper-triangular struct
-        auto X0 = X( ind0, IR(k,END) );
-        auto X1 = X( ind1, IR(k,END) );
-        auto X2 = X( ind2, IR(k,END) );
+        auto X0 = X( ind0, IR(jBeg,colEnd) );
+        auto X1 = X( ind1, IR(jBeg,colEnd) );
         const Int nActive = X0.Width();
 
-        auto shiftsActive = shifts( IR(k,END), ALL );
+        auto shiftsActive = shifts( IR(jBeg,colEnd), ALL );
 
         // Perform triangular solve on diagonal block
-        MultiShiftDiagonalBlockSolve( U11, shiftsActive, X1, scalesUpdate );
+        U11Copy = U11;
+        MultiShiftDiagonalBlockSolve
+        ( U11Copy, shiftsActive, X1, scalesUpdate, jBeg-k );
 
         // Apply scalings on RHS
         for( Int jActive=0; jActive<nActive; ++jActive )
         {
-            const Int j = jActive + k;
+            const Int j = jActive + jBeg;
             const Real sigma = RealPart( scalesUpdate(jActive) );
             if( sigma < Real(1) )
             {
@@ -536,7 +518,7 @@ void MultiShiftSolve
             // Note: G(i+1) <= G(i) + nb*cNorm*|| X1[:,j] ||_infty
             for( Int jActive=0; jActive<nActive; ++jActive )
             {
-                const Int j = jActive + k;
+                const Int j = jActive + jBeg;
                 // TODO(poulson): Skip first column?
                 auto xj = X( IR(0,j), IR(j) );
                 Real xjMax = XMax(j);
@@ -569,6 +551,90 @@ void MultiShiftSolve
     }
 }
 
+template<typename Field>
+void MultiShiftSolve
+(       Matrix<Field>& U,
+  const Matrix<Field>& shifts,
+        Matrix<Field>& X,
+        Matrix<Field>& scales )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    EL_DEBUG_ONLY(
+      if( U.Height() != U.Width() )
+          LogicError("Triangular matrix must be square");
+      if( U.Width() != X.Height() )
+          LogicError("Matrix dimensions do not match");
+      if( shifts.Height() != X.Width() )
+          LogicError("Incompatible number of shifts");
+    )
+    const Int n = X.Width();
+    const Int bsize = Blocksize();
+
+    const Real oneHalf = Real(1)/Real(2);
+
+    const Real underflow = limits::SafeMin<Real>();
+    const Real overflow = limits::Max<Real>();
+    const Real ulp = limits::Precision<Real>();
+    const Real smallNum = Max( underflow/ulp, Real(1)/(overflow*ulp) );
+    const Real bigNum = Real(1)/smallNum;
+
+    EL_DEBUG_ONLY(
+      if( MaxNorm(U) >= bigNum )
+          LogicError("Entries in matrix are too large");
+    )
+
+    Ones( scales, n, 1 );
+
+    // Determine largest entry of each RHS
+    Matrix<Real> XMax( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        auto xj = X( IR(0,j), IR(j) );
+        Real xjMax = MaxNorm( xj );
+        if( xjMax >= bigNum )
+        {
+            const Real s = oneHalf*bigNum/xjMax;
+            xj *= s;
+            xjMax *= s;
+            scales(j) *= s;
+        }
+        xjMax = Max( xjMax, 2*smallNum );
+        XMax(j) = xjMax;
+    }
+
+#ifdef EL_HYBRID
+    // The eigenvector columns are mutually independent, so block-aligned
+    // column ranges may be handed to the OpenMP task scheduler: while one
+    // range is inside its diagonal-block substitution, another is inside
+    // its Gemm back-transform. The later columns solve against more of the
+    // triangle, so the ranges are oversubscribed relative to the threads
+    // to let the scheduler balance the load.
+    const Int numThreads = omp_get_max_threads();
+    const Int numBlocks = (n+bsize-1) / bsize;
+    if( numThreads > 1 && numBlocks >= 2 )
+    {
+        const Int numTasks = Min( 4*Int(numThreads), numBlocks );
+        EL_TASK_REGION
+        {
+            for( Int t=0; t<numTasks; ++t )
+            {
+                Int colBeg = bsize*((t*numBlocks)/numTasks);
+                Int colEnd = Min( bsize*(((t+1)*numBlocks)/numTasks), n );
+#if defined(EL_HAVE_OMP_TASK)
+                #pragma omp task default(shared) firstprivate(colBeg,colEnd)
+#endif
+                MultiShiftSolveRange
+                ( U, shifts, X, scales, XMax, colBeg, colEnd );
+            }
+        }
+        return;
+    }
+#endif
+    MultiShiftSolveRange( U, shifts, X, scales, XMax, 0, n );
+}
+
 template<typename Field>
 void MultiShiftSolve
 ( const AbstractDistMatrix<Field>& UPre,
@@ -12,12 +12,84 @@
 
 #ifdef EL_HAVE_PARMETIS
 # include "parmetis.h"
-#else
+#elif defined(EL_HAVE_METIS)
 # include "metis.h"
 #endif
 
 namespace El {
 
+namespace {
+
+// Gather the graph onto the root, bisect it there with the native
+// multilevel engine, and scatter the resulting permutation
+Int NativeDistBisect
+( const DistGraph& graph,
+        unique_ptr<Grid>& childGrid,
+        DistGraph& child,
+        DistMap& perm,
+        bool& onLeft,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = graph.Grid();
+    const int commSize = grid.Size();
+    const int commRank = grid.Rank();
+    const Int numSources = graph.NumSources();
+    const Int blocksize = graph.Blocksize();
+    const Int numLocalSources = graph.NumLocalSources();
+
+    Graph seqGraph;
+    if( commRank == 0 )
+        CopyFromRoot( graph, seqGraph );
+    else
+        CopyFromNonRoot( graph, 0 );
+
+    Int sizes[3] = { 0, 0, 0 };
+    vector<Int> seqPerm;
+    if( commRank == 0 )
+    {
+        vector<Int> part;
+        MultilevelVertexSeparator( seqGraph, part, ctrl );
+        for( Int s=0; s<numSources; ++s )
+            ++sizes[part[s]];
+        Int offsets[3];
+        offsets[0] = 0;
+        offsets[1] = sizes[0];
+        offsets[2] = sizes[1] + offsets[1];
+        seqPerm.resize( numSources );
+        for( Int s=0; s<numSources; ++s )
+            seqPerm[s] = offsets[part[s]]++;
+    }
+    mpi::Broadcast( sizes, 3, 0, grid.Comm() );
+
+    // Set up space for the distributed permutation
+    perm.SetGrid( grid );
+    perm.Resize( numSources );
+
+    // For now, loop over the processes to send the data
+    if( commRank == 0 )
+        for( Int j=0; j<numLocalSources; ++j )
+            perm.SetLocal(j,seqPerm[j]);
+    for( int q=1; q<commSize; ++q )
+    {
+        const Int thisLocalSize = Min(blocksize,Max(numSources-q*blocksize,0));
+        if( thisLocalSize == 0 )
+            break;
+
+        if( commRank == 0 )
+            mpi::Send( &seqPerm[q*blocksize], thisLocalSize, q, grid.Comm() );
+        else if( commRank == q )
+            mpi::Recv( perm.Buffer(), thisLocalSize, 0, grid.Comm() );
+    }
+
+    EL_DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildFromPerm
+    ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child, ctrl );
+    return sizes[2];
+}
+
+} // anonymous namespace
+
 Int Bisect
 ( const Graph& graph,
   Graph& leftChild,
@@ -26,6 +98,8 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.useNativeBisect )
+        return MultilevelBisect( graph, leftChild, rightChild, perm, ctrl );
 #ifdef EL_HAVE_METIS
     // METIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
@@ -90,8 +164,7 @@ Int Bisect
     ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
     return sizes[2];
 #else
-    LogicError("METIS interface was not available");
-    return -1;
+    return MultilevelBisect( graph, leftChild, rightChild, perm, ctrl );
 #endif
 }
 
@@ -104,14 +177,16 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    if( graph.Grid().Size() == 1 )
+        LogicError
+        ("This routine assumes at least two processes are used, "
+         "otherwise one child will be lost");
+    if( ctrl.useNativeBisect )
+        return NativeDistBisect( graph, childGrid, child, perm, onLeft, ctrl );
 #ifdef EL_HAVE_METIS
     const Grid& grid = graph.Grid();
     const int commSize = grid.Size();
     const int commRank = grid.Rank();
-    if( commSize == 1 )
-        LogicError
-        ("This routine assumes at least two processes are used, "
-         "otherwise one child will be lost");
 
     // (Par)METIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
@@ -320,11 +395,10 @@ Int Bisect
     }
     EL_DEBUG_ONLY(EnsurePermutation( perm ))
     BuildChildFromPerm
-    ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child );
+    ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child, ctrl );
     return sizes[2];
 #else
-    LogicError("METIS was not available");
-    return -1;
+    return NativeDistBisect( graph, childGrid, child, perm, onLeft, ctrl );
 #endif
 }
 
@@ -445,7 +519,8 @@ void BuildChildFromPerm
         Int rightChildSize,
         bool& onLeft,
         unique_ptr<Grid>& childGrid,
-        DistGraph& child )
+        DistGraph& child,
+  const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
     const Int numTargets = graph.NumTargets();
@@ -459,16 +534,52 @@ void BuildChildFromPerm
     const int commRank = grid.Rank();
     const int commSize = grid.Size();
 
-    // Build the child graph from the partitioned parent
-    const int smallTeamSize = commSize/2;
-    const int largeTeamSize = commSize - smallTeamSize;
-    const bool inSmallTeam = ( commRank < smallTeamSize );
-    const bool smallOnLeft = ( leftChildSize <= rightChildSize );
-    const int leftTeamSize = ( smallOnLeft ? smallTeamSize : largeTeamSize );
-    const int rightTeamSize = ( smallOnLeft ? largeTeamSize : smallTeamSize );
-    const int leftTeamOff = ( smallOnLeft ? 0 : smallTeamSize );
-    const int rightTeamOff = ( smallOnLeft ? smallTeamSize : 0 );
-    onLeft = ( inSmallTeam == smallOnLeft );
+    // Build the child graph from the partitioned parent. Rather than
+    // splitting the process team evenly at every separator (which strands
+    // processes beneath the cheaper subtree of unbalanced elimination
+    // trees), assign each child a share of the team proportional to an
+    // estimate of its factorization work. The exact per-subtree flop counts
+    // are not yet available (the symbolic analysis runs after dissection),
+    // so the sum of the squared vertex degrees serves as a proxy, which
+    // tracks the eventual frontal work far better than the vertex counts.
+    int leftTeamSize = commSize - commSize/2;
+    if( ctrl.proportionalMapping )
+    {
+        double work[2] = { 0., 0. };
+        for( Int s=0; s<numLocalSources; ++s )
+        {
+            const Int i = perm.GetLocal(s);
+            const double numConn = double(graph.NumConnections(s));
+            if( i < leftChildSize )
+                work[0] += numConn*numConn;
+            else if( i < leftChildSize+rightChildSize )
+                work[1] += numConn*numConn;
+        }
+        mpi::AllReduce( work, 2, grid.Comm() );
+        if( work[0]+work[1] > 0. )
+            leftTeamSize = int((commSize*work[0])/(work[0]+work[1]) + 0.5);
+        else
+            leftTeamSize = ( leftChildSize >= rightChildSize ?
+                             commSize - commSize/2 : commSize/2 );
+        leftTeamSize = Min( Max( leftTeamSize, 1 ), commSize-1 );
+        if( ctrl.reportLoadBalance && commRank == 0 )
+        {
+            const double evenShare = (work[0]+work[1]) / commSize;
+            const double maxShare =
+              Max( work[0]/leftTeamSize, work[1]/(commSize-leftTeamSize) );
+            Output
+            ("Proportional mapping split ",commSize," processes into ",
+             leftTeamSize," | ",commSize-leftTeamSize,
+             " with estimated load-balance factor ",
+             evenShare > 0. ? maxShare/evenShare : 1.);
+        }
+    }
+    else if( leftChildSize <= rightChildSize )
+        leftTeamSize = commSize/2;
+    const int rightTeamSize = commSize - leftTeamSize;
+    const int leftTeamOff = 0;
+    const int rightTeamOff = leftTeamSize;
+    onLeft = ( commRank < leftTeamSize );
 
     // TODO(poulson): Generalize to 2D distributions?
     Int leftTeamBlocksize = leftChildSize / leftTeamSize;
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include <algorithm>
+
 namespace El {
 
 template<typename Real,
@@ -30,7 +32,9 @@ ValueInt<Real> Median( const Matrix<Real>& x )
         pairs[i].value = xBuffer[i*stride];
         pairs[i].index = i;
     }
-    std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
+    // A full sort is unnecessary; selection is linear-time
+    std::nth_element
+    ( pairs.begin(), pairs.begin()+k/2, pairs.end(), ValueInt<Real>::Lesser );
 
     return pairs[k/2];
 }
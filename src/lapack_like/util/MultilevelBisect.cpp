@@ -0,0 +1,450 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <queue>
+#include <random>
+
+// A native multilevel vertex-separator bisection in the style of Karypis
+// and Kumar: the graph is coarsened with heavy-edge matching, the coarsest
+// graph is bisected with greedy region growing, the bisection is refined
+// with boundary Fiduccia-Mattheyses passes during uncoarsening, and a
+// vertex separator is finally extracted from the refined edge cut with a
+// greedy cover. Since it operates directly on El::Graph, it avoids both
+// the external dependency and the graph copy of the (Par)METIS interfaces
+// in Bisect.cpp. As with those interfaces, the structure of the graph is
+// assumed to be symmetric.
+
+namespace El {
+
+namespace multilevel_bisect {
+
+struct WeightedGraph
+{
+    Int numVertices=0;
+    Int totalVertexWeight=0;
+    vector<Int> offsets, neighbors, edgeWeights, vertexWeights;
+    // The coarse vertex that each vertex of this level was merged into
+    vector<Int> coarseMap;
+};
+
+// Convert the finest level, ignoring self-connections and connections
+// outside of the sources (as with the METIS interfaces)
+void BuildFinestLevel( const Graph& graph, WeightedGraph& g )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int numEdges = graph.NumEdges();
+    const Int* sourceBuf = graph.LockedSourceBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    g.numVertices = numSources;
+    g.totalVertexWeight = numSources;
+    g.vertexWeights.assign( numSources, 1 );
+    g.offsets.assign( numSources+1, 0 );
+    for( Int e=0; e<numEdges; ++e )
+        if( sourceBuf[e] != targetBuf[e] && targetBuf[e] < numSources )
+            ++g.offsets[sourceBuf[e]+1];
+    for( Int v=0; v<numSources; ++v )
+        g.offsets[v+1] += g.offsets[v];
+    const Int numValidEdges = g.offsets[numSources];
+    g.neighbors.resize( numValidEdges );
+    g.edgeWeights.assign( numValidEdges, 1 );
+    auto cursors = g.offsets;
+    for( Int e=0; e<numEdges; ++e )
+        if( sourceBuf[e] != targetBuf[e] && targetBuf[e] < numSources )
+            g.neighbors[cursors[sourceBuf[e]]++] = targetBuf[e];
+}
+
+// Match each vertex with an unmatched neighbor of maximal edge weight
+// (or with itself if no unmatched neighbor remains) and enumerate the
+// resulting coarse vertices. Returns the number of coarse vertices.
+Int HeavyEdgeMatching
+( const WeightedGraph& g, std::mt19937& rng, vector<Int>& coarseMap )
+{
+    EL_DEBUG_CSE
+    const Int n = g.numVertices;
+    vector<Int> order(n);
+    for( Int v=0; v<n; ++v )
+        order[v] = v;
+    std::shuffle( order.begin(), order.end(), rng );
+
+    vector<Int> match(n,-1);
+    for( Int t=0; t<n; ++t )
+    {
+        const Int v = order[t];
+        if( match[v] != -1 )
+            continue;
+        Int heaviest = -1;
+        Int heaviestWeight = 0;
+        for( Int k=g.offsets[v]; k<g.offsets[v+1]; ++k )
+        {
+            const Int w = g.neighbors[k];
+            if( match[w] == -1 && g.edgeWeights[k] > heaviestWeight )
+            {
+                heaviest = w;
+                heaviestWeight = g.edgeWeights[k];
+            }
+        }
+        if( heaviest == -1 )
+        {
+            match[v] = v;
+        }
+        else
+        {
+            match[v] = heaviest;
+            match[heaviest] = v;
+        }
+    }
+
+    coarseMap.resize( n );
+    Int numCoarse = 0;
+    for( Int v=0; v<n; ++v )
+    {
+        if( match[v] < v )
+            continue;
+        coarseMap[v] = numCoarse;
+        coarseMap[match[v]] = numCoarse;
+        ++numCoarse;
+    }
+    return numCoarse;
+}
+
+// Contract the matched pairs, accumulating parallel edge weights with the
+// usual dense marker array
+void Coarsen
+( const WeightedGraph& fine, Int numCoarse, WeightedGraph& coarse )
+{
+    EL_DEBUG_CSE
+    const Int n = fine.numVertices;
+    const vector<Int>& coarseMap = fine.coarseMap;
+
+    coarse.numVertices = numCoarse;
+    coarse.totalVertexWeight = fine.totalVertexWeight;
+    coarse.vertexWeights.assign( numCoarse, 0 );
+    vector<Int> firstFine(numCoarse,-1), secondFine(numCoarse,-1);
+    for( Int v=0; v<n; ++v )
+    {
+        const Int c = coarseMap[v];
+        coarse.vertexWeights[c] += fine.vertexWeights[v];
+        if( firstFine[c] == -1 )
+            firstFine[c] = v;
+        else
+            secondFine[c] = v;
+    }
+
+    coarse.offsets.assign( numCoarse+1, 0 );
+    coarse.neighbors.clear();
+    coarse.edgeWeights.clear();
+    vector<Int> marker(numCoarse,-1);
+    for( Int c=0; c<numCoarse; ++c )
+    {
+        const Int adjBeg = coarse.neighbors.size();
+        for( Int pair=0; pair<2; ++pair )
+        {
+            const Int v = ( pair == 0 ? firstFine[c] : secondFine[c] );
+            if( v == -1 )
+                continue;
+            for( Int k=fine.offsets[v]; k<fine.offsets[v+1]; ++k )
+            {
+                const Int cw = coarseMap[fine.neighbors[k]];
+                if( cw == c )
+                    continue;
+                if( marker[cw] >= adjBeg )
+                {
+                    coarse.edgeWeights[marker[cw]] += fine.edgeWeights[k];
+                }
+                else
+                {
+                    marker[cw] = coarse.neighbors.size();
+                    coarse.neighbors.push_back( cw );
+                    coarse.edgeWeights.push_back( fine.edgeWeights[k] );
+                }
+            }
+        }
+        coarse.offsets[c+1] = coarse.neighbors.size();
+    }
+}
+
+// The weight of the edge cut (with each cut edge counted from both sides)
+Int CutWeight( const WeightedGraph& g, const vector<Int>& part )
+{
+    EL_DEBUG_CSE
+    Int cut = 0;
+    for( Int v=0; v<g.numVertices; ++v )
+        for( Int k=g.offsets[v]; k<g.offsets[v+1]; ++k )
+            if( part[g.neighbors[k]] != part[v] )
+                cut += g.edgeWeights[k];
+    return cut;
+}
+
+// Grow one side of the bisection outward from a random seed via
+// breadth-first search until it contains half of the total vertex weight,
+// keeping the attempt with the smallest edge cut
+void GrowBisection
+( const WeightedGraph& g, Int numTries, std::mt19937& rng,
+  vector<Int>& part )
+{
+    EL_DEBUG_CSE
+    const Int n = g.numVertices;
+    const Int target = g.totalVertexWeight / 2;
+    numTries = Max( numTries, Int(1) );
+
+    Int bestCut = -1;
+    vector<Int> tryPart(n);
+    for( Int t=0; t<numTries; ++t )
+    {
+        std::fill( tryPart.begin(), tryPart.end(), Int(1) );
+        Int growthWeight = 0;
+        std::queue<Int> frontier;
+        Int seed = rng() % n;
+        frontier.push( seed );
+        tryPart[seed] = 0;
+        growthWeight += g.vertexWeights[seed];
+        Int nextUnvisited = 0;
+        while( growthWeight < target )
+        {
+            if( frontier.empty() )
+            {
+                // The graph is disconnected; seed a new component
+                while( nextUnvisited < n && tryPart[nextUnvisited] == 0 )
+                    ++nextUnvisited;
+                if( nextUnvisited == n )
+                    break;
+                frontier.push( nextUnvisited );
+                tryPart[nextUnvisited] = 0;
+                growthWeight += g.vertexWeights[nextUnvisited];
+                continue;
+            }
+            const Int v = frontier.front();
+            frontier.pop();
+            for( Int k=g.offsets[v]; k<g.offsets[v+1]; ++k )
+            {
+                const Int w = g.neighbors[k];
+                if( tryPart[w] == 1 && growthWeight < target )
+                {
+                    tryPart[w] = 0;
+                    growthWeight += g.vertexWeights[w];
+                    frontier.push( w );
+                }
+            }
+        }
+        const Int cut = CutWeight( g, tryPart );
+        if( bestCut == -1 || cut < bestCut )
+        {
+            bestCut = cut;
+            part = tryPart;
+        }
+    }
+}
+
+// Greedy boundary Fiduccia-Mattheyses passes: the gains of all vertices
+// are recomputed in parallel, and the boundary vertices are then moved in
+// order of decreasing gain whenever the move does not spoil the balance.
+// (The classical hill-climbing sequence of tentative negative moves is
+// omitted; a pass which makes no move terminates the refinement.)
+void RefineBisection
+( const WeightedGraph& g, vector<Int>& part, Int maxPasses=8 )
+{
+    EL_DEBUG_CSE
+    const Int n = g.numVertices;
+    Int sideWeights[2] = { 0, 0 };
+    for( Int v=0; v<n; ++v )
+        sideWeights[part[v]] += g.vertexWeights[v];
+    // Allow ten percent imbalance
+    const Int maxSideWeight = (11*g.totalVertexWeight)/20 + 1;
+
+    vector<Int> gains(n), externals(n);
+    vector<Int> boundary;
+    for( Int pass=0; pass<maxPasses; ++pass )
+    {
+        EL_PARALLEL_FOR
+        for( Int v=0; v<n; ++v )
+        {
+            Int external=0, internal=0;
+            for( Int k=g.offsets[v]; k<g.offsets[v+1]; ++k )
+            {
+                if( part[g.neighbors[k]] != part[v] )
+                    external += g.edgeWeights[k];
+                else
+                    internal += g.edgeWeights[k];
+            }
+            gains[v] = external - internal;
+            externals[v] = external;
+        }
+        boundary.clear();
+        for( Int v=0; v<n; ++v )
+            if( externals[v] > 0 )
+                boundary.push_back( v );
+        std::sort
+        ( boundary.begin(), boundary.end(),
+          [&]( const Int& a, const Int& b )
+          { return gains[a] > gains[b] || (gains[a] == gains[b] && a < b); } );
+
+        bool moved = false;
+        for( const Int& v : boundary )
+        {
+            // Earlier moves in this pass may have stale gains
+            Int external=0, internal=0;
+            for( Int k=g.offsets[v]; k<g.offsets[v+1]; ++k )
+            {
+                if( part[g.neighbors[k]] != part[v] )
+                    external += g.edgeWeights[k];
+                else
+                    internal += g.edgeWeights[k];
+            }
+            const Int gain = external - internal;
+            const Int from = part[v];
+            const Int to = 1 - from;
+            const Int vWeight = g.vertexWeights[v];
+            const bool balanced =
+              sideWeights[to]+vWeight <= maxSideWeight &&
+              sideWeights[from] > vWeight;
+            const bool improves =
+              gain > 0 ||
+              (gain == 0 && sideWeights[from] > sideWeights[to]+vWeight);
+            if( balanced && improves )
+            {
+                part[v] = to;
+                sideWeights[from] -= vWeight;
+                sideWeights[to] += vWeight;
+                moved = true;
+            }
+        }
+        if( !moved )
+            break;
+    }
+}
+
+// Cover the cut edges of a two-way partition with a greedily chosen set of
+// boundary vertices and promote that set to the separator (label two)
+void ExtractSeparator( const WeightedGraph& g, vector<Int>& part )
+{
+    EL_DEBUG_CSE
+    const Int n = g.numVertices;
+    vector<Int> cutDegrees(n,0);
+    EL_PARALLEL_FOR
+    for( Int v=0; v<n; ++v )
+        for( Int k=g.offsets[v]; k<g.offsets[v+1]; ++k )
+            if( part[g.neighbors[k]] != part[v] )
+                ++cutDegrees[v];
+
+    // A lazily updated max-priority queue of (uncovered cut degree, vertex)
+    std::priority_queue<std::pair<Int,Int>> frontier;
+    for( Int v=0; v<n; ++v )
+        if( cutDegrees[v] > 0 )
+            frontier.emplace( cutDegrees[v], v );
+    while( !frontier.empty() )
+    {
+        const Int degree = frontier.top().first;
+        const Int v = frontier.top().second;
+        frontier.pop();
+        if( part[v] == 2 || degree != cutDegrees[v] )
+            continue;
+        // The edges from v to the opposite side are now covered
+        for( Int k=g.offsets[v]; k<g.offsets[v+1]; ++k )
+        {
+            const Int w = g.neighbors[k];
+            if( part[w] != 2 && part[w] != part[v] )
+            {
+                --cutDegrees[w];
+                if( cutDegrees[w] > 0 )
+                    frontier.emplace( cutDegrees[w], w );
+            }
+        }
+        part[v] = 2;
+        cutDegrees[v] = 0;
+    }
+}
+
+} // namespace multilevel_bisect
+
+Int MultilevelVertexSeparator
+( const Graph& graph, vector<Int>& part, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    using namespace multilevel_bisect;
+    const Int numSources = graph.NumSources();
+    part.assign( numSources, 0 );
+    if( numSources <= 1 )
+        return 0;
+
+    // Use a fixed seed so that repeated orderings are reproducible
+    std::mt19937 rng( 0x7fb1 );
+
+    // Coarsen until the graph is small or the matching stalls
+    const Int coarsenCutoff = 128;
+    vector<WeightedGraph> levels(1);
+    BuildFinestLevel( graph, levels[0] );
+    while( levels.back().numVertices > coarsenCutoff )
+    {
+        WeightedGraph& fine = levels.back();
+        const Int numCoarse = HeavyEdgeMatching( fine, rng, fine.coarseMap );
+        if( Int(20*numCoarse) > Int(19*fine.numVertices) )
+            break;
+        WeightedGraph coarse;
+        Coarsen( fine, numCoarse, coarse );
+        levels.push_back( std::move(coarse) );
+    }
+
+    // Bisect the coarsest graph and refine during the uncoarsening
+    const Int numLevels = levels.size();
+    vector<Int> curPart;
+    GrowBisection( levels.back(), ctrl.numSeqSeps, rng, curPart );
+    RefineBisection( levels.back(), curPart );
+    for( Int level=numLevels-2; level>=0; --level )
+    {
+        const WeightedGraph& fine = levels[level];
+        vector<Int> finePart( fine.numVertices );
+        EL_PARALLEL_FOR
+        for( Int v=0; v<fine.numVertices; ++v )
+            finePart[v] = curPart[fine.coarseMap[v]];
+        curPart = std::move(finePart);
+        RefineBisection( fine, curPart );
+    }
+
+    ExtractSeparator( levels.front(), curPart );
+    part = std::move(curPart);
+    Int sepSize = 0;
+    for( Int v=0; v<numSources; ++v )
+        if( part[v] == 2 )
+            ++sepSize;
+    return sepSize;
+}
+
+Int MultilevelBisect
+( const Graph& graph,
+  Graph& leftChild,
+  Graph& rightChild,
+  vector<Int>& perm,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    vector<Int> part;
+    MultilevelVertexSeparator( graph, part, ctrl );
+
+    Int sizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numSources; ++s )
+        ++sizes[part[s]];
+    Int offsets[3];
+    offsets[0] = 0;
+    offsets[1] = sizes[0];
+    offsets[2] = sizes[1] + offsets[1];
+    perm.resize( numSources );
+    for( Int s=0; s<numSources; ++s )
+        perm[s] = offsets[part[s]]++;
+
+    EL_DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildrenFromPerm
+    ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
+    return sizes[2];
+}
+
+} // namespace El
@@ -12,6 +12,125 @@
 
 namespace El {
 
+namespace sort {
+
+// Sort [buf,buf+n) with a chunked merge sort: in hybrid builds, each thread
+// sorts a contiguous chunk and the chunks are then pairwise merged over
+// ceil(log2(numChunks)) parallel rounds; otherwise this degrades to the
+// corresponding std::sort/std::stable_sort call
+template<typename T,typename Compare>
+void MergeSort( T* buf, Int n, Compare comp, bool stable )
+{
+#ifdef EL_HYBRID
+    const Int minParallelSortSize = 8192;
+    const Int maxThreads = omp_get_max_threads();
+    if( n >= minParallelSortSize && maxThreads > 1 )
+    {
+        const Int numChunks = Min( maxThreads, n/(minParallelSortSize/2) );
+        vector<Int> bounds(numChunks+1);
+        for( Int c=0; c<=numChunks; ++c )
+            bounds[c] = (n*c)/numChunks;
+        EL_PARALLEL_FOR
+        for( Int c=0; c<numChunks; ++c )
+        {
+            if( stable )
+                std::stable_sort( buf+bounds[c], buf+bounds[c+1], comp );
+            else
+                std::sort( buf+bounds[c], buf+bounds[c+1], comp );
+        }
+        for( Int width=1; width<numChunks; width*=2 )
+        {
+            EL_PARALLEL_FOR
+            for( Int c=0; c<numChunks; c+=2*width )
+            {
+                const Int mid = c + width;
+                const Int last = Min( c+2*width, numChunks );
+                if( mid < last )
+                    std::inplace_merge
+                    ( buf+bounds[c], buf+bounds[mid], buf+bounds[last],
+                      comp );
+            }
+        }
+        return;
+    }
+#endif
+    if( stable )
+        std::stable_sort( buf, buf+n, comp );
+    else
+        std::sort( buf, buf+n, comp );
+}
+
+// Sort the entries of the distributed column vector X in place with a
+// sample sort: the locally sorted entries are partitioned by splitters
+// chosen from a regular sample, exchanged with a single AllToAll, and the
+// resulting globally consecutive sorted runs are then scattered back into
+// X's distribution through its remote-update queue
+template<typename Real,typename Compare>
+void SampleSort( AbstractDistMatrix<Real>& X, Compare comp )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Real,VC,STAR> x_VC_STAR( X );
+    Zero( X );
+    if( x_VC_STAR.Participating() )
+    {
+        mpi::Comm comm = X.Grid().VCComm();
+        const int commSize = mpi::Size( comm );
+        const int commRank = mpi::Rank( comm );
+
+        Real* localBuf = x_VC_STAR.Buffer();
+        const Int localHeight = x_VC_STAR.LocalHeight();
+        MergeSort( localBuf, localHeight, comp, false );
+
+        // Select commSize-1 splitters from a regular sample of the
+        // locally sorted data
+        const int numLocalSamples = commSize-1;
+        vector<Real> localSamples(numLocalSamples),
+                     samples(numLocalSamples*commSize);
+        for( int s=0; s<numLocalSamples; ++s )
+            localSamples[s] = localBuf[((s+1)*localHeight)/commSize];
+        mpi::AllGather
+        ( localSamples.data(), numLocalSamples,
+          samples.data(), numLocalSamples, comm );
+        std::sort( samples.begin(), samples.end(), comp );
+        vector<Real> splitters(commSize-1);
+        for( int q=0; q<commSize-1; ++q )
+            splitters[q] = samples[(q+1)*numLocalSamples];
+
+        // Partition the sorted local data by the splitters and exchange
+        vector<int> sendCounts(commSize,0), sendOffs;
+        Int prev = 0;
+        for( int q=0; q<commSize-1; ++q )
+        {
+            const Int pos =
+              std::upper_bound
+              ( localBuf+prev, localBuf+localHeight, splitters[q], comp ) -
+              localBuf;
+            sendCounts[q] = pos - prev;
+            prev = pos;
+        }
+        sendCounts[commSize-1] = localHeight - prev;
+        Scan( sendCounts, sendOffs );
+        vector<Real> sendBuf( localBuf, localBuf+localHeight );
+        auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+
+        // Each process now owns a globally consecutive range
+        const Int myCount = recvBuf.size();
+        MergeSort( recvBuf.data(), myCount, comp, false );
+        vector<Int> counts(commSize);
+        mpi::AllGather( &myCount, 1, counts.data(), 1, comm );
+        Int globalOff = 0;
+        for( int q=0; q<commRank; ++q )
+            globalOff += counts[q];
+
+        X.Reserve( myCount );
+        for( Int t=0; t<myCount; ++t )
+            X.QueueUpdate( globalOff+t, 0, recvBuf[t] );
+    }
+    X.ProcessQueues();
+}
+
+} // namespace sort
+
 // Sort each column of the real matrix X
 
 template<typename Real,
@@ -27,19 +146,9 @@ void Sort( Matrix<Real>& X, SortType sort, bool stable )
     {
         Real* XCol = X.Buffer(0,j);
         if( sort == ASCENDING )
-        {
-            if( stable )
-                std::stable_sort( XCol, XCol+m );
-            else
-                std::sort( XCol, XCol+m );
-        }
+            El::sort::MergeSort( XCol, m, std::less<Real>(), stable );
         else
-        {
-            if( stable )
-                std::stable_sort( XCol, XCol+m, std::greater<Real>() );
-            else
-                std::sort( XCol, XCol+m, std::greater<Real>() );
-        }
+            El::sort::MergeSort( XCol, m, std::greater<Real>(), stable );
     }
 }
 
@@ -57,10 +166,20 @@ void Sort( AbstractDistMatrix<Real>& X, SortType sort, bool stable )
         if( X.Participating() )
             Sort( X.Matrix(), sort, stable );
     }
+    else if( X.Width() == 1 &&
+             X.Height() >= Int(X.Grid().Size())*Int(X.Grid().Size()) &&
+             X.Grid().Size() > 1 )
+    {
+        // The vector is long enough for every process to contribute a full
+        // complement of splitter samples, so sort it in place rather than
+        // gathering it onto a single process
+        if( sort == ASCENDING )
+            El::sort::SampleSort( X, std::less<Real>() );
+        else
+            El::sort::SampleSort( X, std::greater<Real>() );
+    }
     else
     {
-        // TODO(poulson): Distributed sort
-
         // Get a copy on a single process, sort, and then redistribute
         DistMatrix<Real,CIRC,CIRC> X_CIRC_CIRC( X );
         if( X_CIRC_CIRC.Participating() )
@@ -96,21 +215,9 @@ TaggedSort( const Matrix<Real>& x, SortType sort, bool stable )
     }
 
     if( sort == ASCENDING )
-    {
-        if( stable )
-            std::stable_sort
-            ( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
-        else
-            std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
-    }
+        El::sort::MergeSort( pairs.data(), k, ValueInt<Real>::Lesser, stable );
     else if( sort == DESCENDING )
-    {
-        if( stable )
-            std::stable_sort
-            ( pairs.begin(), pairs.end(), ValueInt<Real>::Greater );
-        else
-            std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Greater );
-    }
+        El::sort::MergeSort( pairs.data(), k, ValueInt<Real>::Greater, stable );
 
     return pairs;
 }
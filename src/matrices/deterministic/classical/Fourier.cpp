@@ -40,9 +40,23 @@ void Fourier( AbstractDistMatrix<Complex<Real>>& A, Int n )
     IndexDependentFill( A, function<Complex<Real>(Int,Int)>(fourierFill) );
 }
 
+template<typename Real>
+void Fourier( LazyMatrix<Complex<Real>>& A, Int n )
+{
+    EL_DEBUG_CSE
+    const Real pi = 4*Atan( Real(1) );
+    const Real nSqrt = Sqrt( Real(n) );
+    auto fourierFill =
+      [=]( Int i, Int j ) -> Complex<Real>
+      { const Real theta = -2*pi*i*j/n;
+        return Complex<Real>(Cos(theta),Sin(theta))/nSqrt; };
+    A.Reset( n, n, function<Complex<Real>(Int,Int)>(fourierFill) );
+}
+
 #define PROTO(Real) \
   template void Fourier( Matrix<Complex<Real>>& A, Int n ); \
-  template void Fourier( AbstractDistMatrix<Complex<Real>>& A, Int n );
+  template void Fourier( AbstractDistMatrix<Complex<Real>>& A, Int n ); \
+  template void Fourier( LazyMatrix<Complex<Real>>& A, Int n );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
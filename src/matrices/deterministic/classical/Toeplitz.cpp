@@ -36,12 +36,28 @@ void Toeplitz( AbstractDistMatrix<S>& A, Int m, Int n, const vector<T>& a )
     IndexDependentFill( A, function<S(Int,Int)>(toeplitzFill) );
 }
 
+template<typename S,typename T>
+void Toeplitz( LazyMatrix<S>& A, Int m, Int n, const vector<T>& a )
+{
+    EL_DEBUG_CSE
+    const Int length = m+n-1;
+    if( a.size() != Unsigned(length) )
+        LogicError("a was the wrong size");
+    // The diagonal values are captured by value so that the view remains
+    // valid after the caller's buffer goes out of scope
+    auto toeplitzFill = [a,n]( Int i, Int j ) -> S { return a[i-j+(n-1)]; };
+    A.Reset( m, n, function<S(Int,Int)>(toeplitzFill) );
+}
+
 #define PROTO_TYPES(T1,T2) \
   template void Toeplitz \
   ( Matrix<T1>& A, \
     const Int m, const Int n, const vector<T2>& a ); \
   template void Toeplitz \
   ( AbstractDistMatrix<T1>& A, \
+    const Int m, const Int n, const vector<T2>& a ); \
+  template void Toeplitz \
+  ( LazyMatrix<T1>& A, \
     const Int m, const Int n, const vector<T2>& a );
 
 #define PROTO_INT(T) PROTO_TYPES(T,T)
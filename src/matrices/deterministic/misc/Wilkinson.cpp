@@ -32,14 +32,16 @@ void Wilkinson( AbstractDistMatrix<T>& A, Int k )
 {
     EL_DEBUG_CSE
     const Int n = 2*k+1;
-    Zeros( A, n, n );
-    FillDiagonal( A, T(1), -1 );
-    FillDiagonal( A, T(1),  1 );
-    
-    for( Int j=0; j<=k; ++j )
-        A.Set( j, j, T(k-j) );
-    for( Int j=k+1; j<n; ++j )
-        A.Set( j, j, T(j-k) );
+    A.Resize( n, n );
+    auto wilkinsonFill =
+      [=]( Int i, Int j ) -> T
+      { if( i == j )
+            return ( j <= k ? T(k-j) : T(j-k) );
+        else if( i == j+1 || i == j-1 )
+            return T(1);
+        else
+            return T(0); };
+    IndexDependentFill( A, function<T(Int,Int)>(wilkinsonFill) );
 }
 
 #define PROTO(T) \
@@ -25,17 +25,50 @@ template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
-    if( A.RedundantRank() == 0 )
-        MakeGaussian( A.Matrix(), mean, stddev );
-    Broadcast( A, A.RedundantComm(), 0 );
+    // Key each entry's sample on its global index so that the fill is
+    // bitwise identical for every process grid, redundant copies agree
+    // without communication, and the local entries may be generated in
+    // parallel
+    const uint64_t seed = CounterSeed();
+    const uint64_t stream = NextCounterStream();
+    const uint64_t height = uint64_t(A.Height());
+    Matrix<F>& ALoc = A.Matrix();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    EL_PARALLEL_FOR_COLLAPSE2
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const uint64_t index =
+              uint64_t(A.GlobalRow(iLoc)) + uint64_t(A.GlobalCol(jLoc))*height;
+            ALoc(iLoc,jLoc) =
+              SampleNormalCounter( seed, stream, index, mean, stddev );
+        }
+    }
 }
 
 template<typename F>
 void MakeGaussian( DistMultiVec<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
-    auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
-    EntrywiseFill( A, function<F()>(sampleNormal) );
+    const uint64_t seed = CounterSeed();
+    const uint64_t stream = NextCounterStream();
+    const uint64_t height = uint64_t(A.Height());
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    const Int width = A.Width();
+    EL_PARALLEL_FOR_COLLAPSE2
+    for( Int j=0; j<width; ++j )
+    {
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const uint64_t index =
+              uint64_t(firstLocalRow+iLoc) + uint64_t(j)*height;
+            A.SetLocal
+            ( iLoc, j, SampleNormalCounter(seed,stream,index,mean,stddev) );
+        }
+    }
 }
 
 template<typename F>
@@ -34,9 +34,27 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
-    if( A.RedundantRank() == 0 )
-        MakeUniform( A.Matrix(), center, radius );
-    Broadcast( A, A.RedundantComm(), 0 );
+    // Key each entry's sample on its global index so that the fill is
+    // bitwise identical for every process grid, redundant copies agree
+    // without communication, and the local entries may be generated in
+    // parallel
+    const uint64_t seed = CounterSeed();
+    const uint64_t stream = NextCounterStream();
+    const uint64_t height = uint64_t(A.Height());
+    Matrix<T>& ALoc = A.Matrix();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    EL_PARALLEL_FOR_COLLAPSE2
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const uint64_t index =
+              uint64_t(A.GlobalRow(iLoc)) + uint64_t(A.GlobalCol(jLoc))*height;
+            ALoc(iLoc,jLoc) =
+              SampleBallCounter( seed, stream, index, center, radius );
+        }
+    }
 }
 
 template<typename T>
@@ -51,11 +69,23 @@ template<typename T>
 void MakeUniform( DistMultiVec<T>& X, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
-    const int localHeight = X.LocalHeight();
-    const int width = X.Width();
-    for( int j=0; j<width; ++j )
-        for( int iLocal=0; iLocal<localHeight; ++iLocal )
-            X.SetLocal( iLocal, j, SampleBall(center,radius) );
+    const uint64_t seed = CounterSeed();
+    const uint64_t stream = NextCounterStream();
+    const uint64_t height = uint64_t(X.Height());
+    const Int firstLocalRow = X.FirstLocalRow();
+    const Int localHeight = X.LocalHeight();
+    const Int width = X.Width();
+    EL_PARALLEL_FOR_COLLAPSE2
+    for( Int j=0; j<width; ++j )
+    {
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const uint64_t index =
+              uint64_t(firstLocalRow+iLoc) + uint64_t(j)*height;
+            X.SetLocal
+            ( iLoc, j, SampleBallCounter(seed,stream,index,center,radius) );
+        }
+    }
 }
 
 template<typename T>
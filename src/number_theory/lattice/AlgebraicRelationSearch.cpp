@@ -41,6 +41,49 @@ Int AlgebraicRelationSearch
     return info.nullity;
 }
 
+// The algebraic searches are Z-dependence searches over the powers of
+// alpha, so the laddered variants form said powers once at the input
+// precision (each rung of the ladder merely rounds them) and delegate
+
+template<typename Field>
+Int AlgebraicRelationLadderSearch
+( Field alpha,
+  Int n,
+  Base<Field> NSqrt,
+  Matrix<Field>& B,
+  Matrix<Field>& U,
+  const RelationLadderCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Matrix<Field> z( n, 1 );
+    for( Int j=0; j<n; ++j )
+        z(j) = Pow( alpha, Real(j) );
+    return ZDependenceLadderSearch( z, NSqrt, B, U, ctrl );
+}
+
+template<typename Field>
+void AlgebraicRelationSweep
+( const Matrix<Field>& alpha,
+  Int n,
+  Base<Field> NSqrt,
+  vector<Matrix<Field>>& B,
+  vector<Matrix<Field>>& U,
+  vector<Int>& numFound,
+  const RelationLadderCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( alpha.Width() != 1 )
+        LogicError("alpha was assumed to be a column vector");
+    const Int numCands = alpha.Height();
+    Matrix<Field> Z( n, numCands );
+    for( Int cand=0; cand<numCands; ++cand )
+        for( Int j=0; j<n; ++j )
+            Z(j,cand) = Pow( alpha(cand), Real(j) );
+    ZDependenceSweep( Z, NSqrt, B, U, numFound, ctrl );
+}
+
 #define PROTO(Field) \
   template Int AlgebraicRelationSearch \
   ( Field alpha, \
@@ -48,7 +91,22 @@ Int AlgebraicRelationSearch
     Base<Field> NSqrt, \
     Matrix<Field>& B, \
     Matrix<Field>& U, \
-    const LLLCtrl<Base<Field>>& ctrl );
+    const LLLCtrl<Base<Field>>& ctrl ); \
+  template Int AlgebraicRelationLadderSearch \
+  ( Field alpha, \
+    Int n, \
+    Base<Field> NSqrt, \
+    Matrix<Field>& B, \
+    Matrix<Field>& U, \
+    const RelationLadderCtrl<Base<Field>>& ctrl ); \
+  template void AlgebraicRelationSweep \
+  ( const Matrix<Field>& alpha, \
+    Int n, \
+    Base<Field> NSqrt, \
+    vector<Matrix<Field>>& B, \
+    vector<Matrix<Field>>& U, \
+    vector<Int>& numFound, \
+    const RelationLadderCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
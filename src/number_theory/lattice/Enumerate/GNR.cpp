@@ -94,7 +94,12 @@ Base<F> Helper
 
                 F* s = &partialSums(0,k);
                 for( Int i=sumIndices(k+1); i>=k+1; --i )
-                    s[i] = s[i+1] + N(k,i)*vBuf[i];
+                {
+                    // s[i] = s[i+1] + N(k,i)*vBuf[i], but with any product
+                    // and sum temporaries (expensive for BigFloat) fused away
+                    s[i] = s[i+1];
+                    FusedMultiplyAdd( N(k,i), vBuf[i], s[i] );
+                }
 
                 centers(k) = -partialSums(k+1,k);
                 vBuf[k] = Round(centers(k));
@@ -194,7 +199,11 @@ Base<F> TransposedHelper
                       F* s = &partialSums(0,k);
                 const F* nBuf = &NTrans(0,k);
                 for( Int i=sumIndices(k+1); i>=k+1; --i )
-                    s[i] = s[i+1] + nBuf[i]*vBuf[i];
+                {
+                    // As above, fuse away the product and sum temporaries
+                    s[i] = s[i+1];
+                    FusedMultiplyAdd( nBuf[i], vBuf[i], s[i] );
+                }
 
                 centers(k) = -partialSums(k+1,k);
                 vBuf[k] = Round(centers(k));
@@ -230,6 +239,200 @@ Base<F> TransposedHelper
     }
 }
 
+#ifdef EL_HYBRID
+
+// Bounded enumeration of the subtree of the GNR search tree in which the
+// top-most nonzero coordinate, v(r), is fixed to 'topCoord'. The logic
+// mirrors TransposedHelper restricted to the levels 0, ..., r: success is
+// still detected at level zero, but climbing back up to level r exhausts
+// the subtree, since the fixed coordinate cannot be stepped. The workspace
+// is passed in so that a thread may reuse it across many subtrees.
+template<typename F>
+Base<F> TransposedSubtreeHelper
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Int r,
+        F topCoord,
+        Matrix<F>& v,
+        Matrix<F>& partialSums,
+        Matrix<Int>& sumIndices,
+        Matrix<Base<F>>& partialNorms,
+        Matrix<F>& centers,
+        Matrix<F>& products,
+        vector<SpiralState<F>>& spiralStates )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+
+    // Re-initialize the workspace as if a fresh enumeration had begun
+    Zero( partialSums );
+    Zero( partialNorms );
+    Zero( centers );
+    Zero( v );
+    for( Int j=0; j<=n; ++j )
+        sumIndices(j) = j-1;
+    // Ensure that the first descent folds in the fixed top coordinate
+    sumIndices(r) = r;
+
+    Int k = r;
+    F* vBuf = &v(0);
+    vBuf[r] = topCoord;
+    while( true )
+    {
+        const F entry = d(k)*(vBuf[k] - centers(k));
+        const Real partialNorm = SafeNorm( partialNorms(k+1), entry );
+        partialNorms(k) = partialNorm;
+        if( partialNorm < upperBounds((n-1)-k) )
+        {
+            if( k == 0 )
+            {
+                // Success
+                return partialNorm;
+            }
+            else
+            {
+                // Move down the tree
+                --k;
+                sumIndices(k) = Max(sumIndices(k),sumIndices(k+1));
+
+                      F* s = &partialSums(0,k);
+                const F* nBuf = &NTrans(0,k);
+                      F* pBuf = &products(0);
+                const Int first = k+1;
+                const Int last = sumIndices(k+1);
+                // Split out the (vectorizable) products so that only the
+                // running sum is a sequential dependence
+                EL_SIMD
+                for( Int i=first; i<=last; ++i )
+                    pBuf[i] = nBuf[i]*vBuf[i];
+                for( Int i=last; i>=first; --i )
+                    s[i] = s[i+1] + pBuf[i];
+
+                centers(k) = -partialSums(k+1,k);
+                vBuf[k] = Round(centers(k));
+                spiralStates[k].Initialize( centers(k) );
+            }
+        }
+        else
+        {
+            // Move up the tree; reaching the fixed coordinate at level r
+            // again (or failing its bound) exhausts the subtree
+            ++k;
+            if( k >= r )
+                return 2*upperBounds(n-1)+1;
+            sumIndices(k) = k; // indicate that (i,j) are not synchronized
+            vBuf[k] = spiralStates[k].Step();
+        }
+    }
+}
+
+// Partition the top-level branches of the search tree -- the admissible
+// values of the top-most nonzero coordinate -- across the available OpenMP
+// threads. Each branch roots an independent bounded enumeration, and the
+// subtree sizes are highly nonuniform, so the branches are drawn from a
+// shared queue via dynamic scheduling rather than partitioned statically.
+// As in the sequential algorithm, the search stops at the first discovered
+// solution (here, at branch granularity), with the shortest of any
+// concurrently discovered solutions winning.
+template<typename F>
+Base<F> ParallelTransposedHelper
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = NTrans.Width();
+    const Int n = NTrans.Height();
+    if( n > m )
+        LogicError("Expected height(N) >= width(N)");
+    Zeros( v, n, 1 );
+    if( n == 0 )
+        return Real(0);
+    const Real failedNorm = 2*upperBounds(n-1)+1;
+
+    // Flatten the admissible top-level branches: for each level r of the
+    // top-most nonzero coordinate, the values along the constrained spiral
+    // whose contribution, d(r) |v(r)|, lies beneath the corresponding
+    // bound. As in the sequential algorithm, a level is finished at the
+    // first violation.
+    vector<Int> branchLevels;
+    vector<F> branchCoords;
+    for( Int r=0; r<n; ++r )
+    {
+        SpiralState<F> spiral;
+        spiral.Initialize( true );
+        while( true )
+        {
+            const F coord = spiral.Step();
+            if( d(r)*Abs(coord) >= upperBounds((n-1)-r) )
+                break;
+            branchLevels.push_back( r );
+            branchCoords.push_back( coord );
+        }
+    }
+    const Int numBranches = branchLevels.size();
+
+    Real bestNorm = failedNorm;
+    Matrix<F> vBest;
+    bool stop = false;
+
+    #pragma omp parallel
+    {
+        // Thread-local workspace reused across this thread's subtrees
+        Matrix<F> vCand, partialSums, centers, products;
+        Matrix<Int> sumIndices;
+        Matrix<Real> partialNorms;
+        Zeros( vCand, n, 1 );
+        Zeros( partialSums, n+1, n );
+        Zeros( sumIndices, n+1, 1 );
+        Zeros( partialNorms, n+1, 1 );
+        Zeros( centers, n, 1 );
+        Zeros( products, n, 1 );
+        vector<SpiralState<F>> spiralStates(n);
+
+        #pragma omp for schedule(dynamic,1)
+        for( Int b=0; b<numBranches; ++b )
+        {
+            bool haveStopped;
+            #pragma omp critical (el_gnr_enum_best)
+            haveStopped = stop;
+            if( haveStopped )
+                continue;
+
+            const Real norm =
+              TransposedSubtreeHelper
+              ( d, NTrans, upperBounds, branchLevels[b], branchCoords[b],
+                vCand, partialSums, sumIndices, partialNorms, centers,
+                products, spiralStates );
+            if( norm < upperBounds(n-1) )
+            {
+                #pragma omp critical (el_gnr_enum_best)
+                {
+                    if( norm < bestNorm )
+                    {
+                        bestNorm = norm;
+                        vBest = vCand;
+                    }
+                    stop = true;
+                }
+            }
+        }
+    }
+
+    if( bestNorm < upperBounds(n-1) )
+    {
+        v = vBest;
+        return bestNorm;
+    }
+    return failedNorm;
+}
+
+#endif // ifdef EL_HYBRID
+
 } // namespace gnr_enum
 
 template<typename F>
@@ -241,6 +444,14 @@ Base<F> GNREnumeration
   const EnumCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    if( ctrl.parallel && omp_get_max_threads() > 1 && N.Width() > 1 )
+    {
+        Matrix<F> NTrans;
+        Transpose( N, NTrans );
+        return gnr_enum::ParallelTransposedHelper( d, NTrans, upperBounds, v );
+    }
+#endif
     if( ctrl.explicitTranspose )
     {
         Matrix<F> NTrans;
@@ -39,13 +39,253 @@ Int ZDependenceSearch
     return info.nullity;
 }
 
+namespace z_dependence {
+
+// Expand the requested precision ladder, dropping any rungs at or above
+// the input precision (which is always attempted last as a fallback)
+inline vector<unsigned>
+Ladder( const vector<unsigned>& requested, unsigned inputPrec )
+{
+    vector<unsigned> ladder;
+    if( requested.empty() )
+    {
+        for( unsigned prec=64u; prec<inputPrec; prec*=2u )
+            ladder.push_back( prec );
+    }
+    else
+    {
+        for( auto prec : requested )
+            if( prec < inputPrec )
+                ladder.push_back( prec );
+    }
+    return ladder;
+}
+
+// Attempt the quadratic-form search at the current working precision and
+// return the (unverified) nullity alongside the unimodular transformation
+template<typename Field>
+Int RungSearch
+( const Matrix<Field>& z,
+        Base<Field> NSqrt,
+        Matrix<Field>& U,
+  const LLLCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = z.Height();
+    const Int m = n+1;
+
+    Matrix<Field> B;
+    Identity( B, m, n );
+    auto bLastRow = B( IR(m-1), ALL );
+    Transpose( z, bLastRow );
+    Scale( NSqrt, bLastRow );
+
+    Matrix<Field> R;
+    auto info = LLL( B, U, R, ctrl );
+    return info.nullity;
+}
+
+// Lift the unimodular transformation found at a working precision (exactly,
+// as it is integer-valued), re-evaluate the residuals of its trailing
+// 'nullity' columns (the kernel candidates) at the input precision, and,
+// if every candidate passes, reconstruct the reduced basis as
+// B := [I; sqrt(N) z^T] U.
+template<typename Field>
+bool LiftAndVerify
+( const Matrix<Field>& z,
+        Base<Field> NSqrt,
+        Int nullity,
+  const Matrix<Field>& URung,
+        Base<Field> relTol,
+        Matrix<Field>& B,
+        Matrix<Field>& U )
+{
+    EL_DEBUG_CSE
+    const Int n = z.Height();
+    const Int m = n+1;
+    if( nullity <= 0 )
+        return false;
+
+    Copy( URung, U );
+    auto K = U( ALL, IR(n-nullity,n) );
+
+    Matrix<Field> zTrans, resid;
+    Transpose( z, zTrans );
+    Gemm( NORMAL, NORMAL, Field(NSqrt), zTrans, K, resid );
+    for( Int j=0; j<nullity; ++j )
+    {
+        auto k = K( ALL, IR(j) );
+        if( Abs(resid(0,j)) > relTol*FrobeniusNorm(k) )
+            return false;
+    }
+
+    B.Resize( m, n );
+    auto BTop = B( IR(0,n), ALL );
+    BTop = U;
+    auto bLastRow = B( IR(m-1), ALL );
+    Gemm( NORMAL, NORMAL, Field(NSqrt), zTrans, U, Field(0), bLastRow );
+    return true;
+}
+
+} // namespace z_dependence
+
+template<typename Field>
+Int ZDependenceLadderSearch
+( const Matrix<Field>& z,
+        Base<Field> NSqrt,
+        Matrix<Field>& B,
+        Matrix<Field>& U,
+  const RelationLadderCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( z.Width() != 1 )
+        LogicError("z was assumed to be a column vector");
+#ifdef EL_HAVE_MPC
+    typedef Base<Field> Real;
+    if( !IsFixedPrecision<Real>::value )
+    {
+        const mpfr_prec_t inputPrec = mpfr::Precision();
+        const auto ladder =
+          z_dependence::Ladder( ctrl.precisionLadder, unsigned(inputPrec) );
+        for( auto rungPrec : ladder )
+        {
+            mpfr::SetPrecision( rungPrec );
+            Matrix<Field> URung;
+            Int nullity = 0;
+            try
+            {
+                Matrix<Field> zRung;
+                Copy( z, zRung );
+                LLLCtrl<Real> ctrlRung( ctrl.lllCtrl );
+                nullity =
+                  z_dependence::RungSearch( zRung, NSqrt, URung, ctrlRung );
+            }
+            catch( std::exception& e )
+            { nullity = 0; }
+            mpfr::SetPrecision( inputPrec );
+
+            if( nullity > 0 &&
+                z_dependence::LiftAndVerify
+                ( z, NSqrt, nullity, URung, ctrl.relTol, B, U ) )
+            {
+                if( ctrl.progress )
+                    Output
+                    ("Verified ",nullity," relation(s) found at precision ",
+                     rungPrec);
+                return nullity;
+            }
+        }
+    }
+#endif
+    // Fall back to the one-shot search at the input precision
+    return ZDependenceSearch( z, NSqrt, B, U, ctrl.lllCtrl );
+}
+
+template<typename Field>
+void ZDependenceSweep
+( const Matrix<Field>& Z,
+        Base<Field> NSqrt,
+        vector<Matrix<Field>>& B,
+        vector<Matrix<Field>>& U,
+        vector<Int>& numFound,
+  const RelationLadderCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int numCands = Z.Width();
+    B.resize( numCands );
+    U.resize( numCands );
+    numFound.assign( numCands, 0 );
+    vector<char> resolved( numCands, 0 );
+
+#ifdef EL_HAVE_MPC
+    if( !IsFixedPrecision<Real>::value )
+    {
+        const mpfr_prec_t inputPrec = mpfr::Precision();
+        const auto ladder =
+          z_dependence::Ladder( ctrl.precisionLadder, unsigned(inputPrec) );
+        vector<Matrix<Field>> URung( numCands );
+        vector<Int> nullities( numCands, 0 );
+        for( auto rungPrec : ladder )
+        {
+            // The default precision is process-global, so each rung is
+            // entered and left serially; the searches themselves are
+            // independent (and the recycled mpfr structures are pooled
+            // per thread)
+            mpfr::SetPrecision( rungPrec );
+            EL_PARALLEL_FOR
+            for( Int cand=0; cand<numCands; ++cand )
+            {
+                if( resolved[cand] )
+                    continue;
+                try
+                {
+                    Matrix<Field> zRung;
+                    Copy( Z(ALL,IR(cand)), zRung );
+                    LLLCtrl<Real> ctrlRung( ctrl.lllCtrl );
+                    nullities[cand] =
+                      z_dependence::RungSearch
+                      ( zRung, NSqrt, URung[cand], ctrlRung );
+                }
+                catch( std::exception& e )
+                { nullities[cand] = 0; }
+            }
+            mpfr::SetPrecision( inputPrec );
+
+            // Verify the surviving candidates at the input precision
+            for( Int cand=0; cand<numCands; ++cand )
+            {
+                if( resolved[cand] || nullities[cand] <= 0 )
+                    continue;
+                auto z = Z( ALL, IR(cand) );
+                if( z_dependence::LiftAndVerify
+                    ( z, NSqrt, nullities[cand], URung[cand], ctrl.relTol,
+                      B[cand], U[cand] ) )
+                {
+                    numFound[cand] = nullities[cand];
+                    resolved[cand] = 1;
+                    if( ctrl.progress )
+                        Output
+                        ("Resolved candidate ",cand," at precision ",rungPrec);
+                }
+                nullities[cand] = 0;
+            }
+        }
+    }
+#endif
+
+    // Run any remaining candidates at the input precision
+    EL_PARALLEL_FOR
+    for( Int cand=0; cand<numCands; ++cand )
+    {
+        if( resolved[cand] )
+            continue;
+        auto z = Z( ALL, IR(cand) );
+        numFound[cand] =
+          ZDependenceSearch( z, NSqrt, B[cand], U[cand], ctrl.lllCtrl );
+    }
+}
+
 #define PROTO(Field) \
   template Int ZDependenceSearch \
   ( const Matrix<Field>& z, \
           Base<Field> NSqrt, \
           Matrix<Field>& B, \
           Matrix<Field>& U, \
-    const LLLCtrl<Base<Field>>& ctrl );
+    const LLLCtrl<Base<Field>>& ctrl ); \
+  template Int ZDependenceLadderSearch \
+  ( const Matrix<Field>& z, \
+          Base<Field> NSqrt, \
+          Matrix<Field>& B, \
+          Matrix<Field>& U, \
+    const RelationLadderCtrl<Base<Field>>& ctrl ); \
+  template void ZDependenceSweep \
+  ( const Matrix<Field>& Z, \
+          Base<Field> NSqrt, \
+          vector<Matrix<Field>>& B, \
+          vector<Matrix<Field>>& U, \
+          vector<Int>& numFound, \
+    const RelationLadderCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
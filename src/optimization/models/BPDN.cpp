@@ -9,6 +9,7 @@
 #include <El.hpp>
 #include "./BPDN/ADMM.hpp"
 #include "./BPDN/IPM.hpp"
+#include "./BPDN/PathADMM.hpp"
 
 namespace El {
 
@@ -70,6 +71,30 @@ void BPDN
     bpdn::IPM( A, b, lambda, x, ctrl.ipmCtrl );
 }
 
+template<typename Real>
+void BPDNPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    bpdn::PathADMM( A, b, lambdas, Real(0), X, ctrl );
+}
+
+template<typename Real>
+void BPDNPath
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+  const Matrix<Real>& lambdas,
+        AbstractDistMatrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    bpdn::PathADMM( A, b, lambdas, Real(0), X, ctrl );
+}
+
 #define PROTO(Real) \
   template void BPDN \
   ( const Matrix<Real>& A, \
@@ -94,7 +119,19 @@ void BPDN
     const DistMultiVec<Real>& b, \
           Real lambda, \
           DistMultiVec<Real>& x, \
-    const BPDNCtrl<Real>& ctrl );
+    const BPDNCtrl<Real>& ctrl ); \
+  template void BPDNPath \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& lambdas, \
+          Matrix<Real>& X, \
+    const bpdn::ADMMCtrl<Real>& ctrl ); \
+  template void BPDNPath \
+  ( const AbstractDistMatrix<Real>& A, \
+    const AbstractDistMatrix<Real>& b, \
+    const Matrix<Real>& lambdas, \
+          AbstractDistMatrix<Real>& X, \
+    const bpdn::ADMMCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
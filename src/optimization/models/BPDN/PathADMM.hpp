@@ -0,0 +1,344 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// A regularization-path variant of the ADMM solver in ADMM.hpp: the entire
+// (typically decreasing) sequence of l1 penalties is solved with a single
+// factorization of A^H A + rho I (or its Woodbury complement), since the
+// splitting places both regularization terms in the z-update, and each
+// solve is warm-started from the previous solution. With a fixed Tikhonov
+// penalty lambda2, the z-update for
+//     min 1/2 || A x - b ||_2^2 + lambda1 || x ||_1 + lambda2 || x ||_2^2
+// is a soft-thresholding followed by the contraction rho/(rho+2*lambda2),
+// so the same engine serves both the BPDN (lambda2=0) and elastic-net
+// paths. No equilibration is applied, matching the single-solve ADMM.
+
+namespace El {
+namespace bpdn {
+
+template<typename Field>
+Int PathADMM
+( const Matrix<Field>& A,
+  const Matrix<Field>& b,
+  const Matrix<Base<Field>>& lambda1s,
+        Base<Field> lambda2,
+        Matrix<Field>& X,
+  const ADMMCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numLambdas = lambda1s.Height();
+    EL_DEBUG_ONLY(
+      if( lambda1s.Width() != 1 )
+          LogicError("lambda1s must be a column vector");
+    )
+    Zeros( X, n, numLambdas );
+
+    // The factored system does not involve the regularization parameters,
+    // so it is shared across the entire path
+    Matrix<Field> P;
+    if( m >= n )
+    {
+        Identity( P, n, n );
+        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
+    }
+    else
+    {
+        Identity( P, m, m );
+        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
+    }
+    if( ctrl.inv )
+        HPDInverse( LOWER, P );
+    else
+        Cholesky( LOWER, P );
+
+    // Cache w := A^H b
+    Matrix<Field> w;
+    Gemv( ADJOINT, Field(1), A, b, w );
+
+    const Real zScale = ctrl.rho / (ctrl.rho + 2*lambda2);
+
+    Int totalIter=0;
+    Matrix<Field> x, z, u, s, zOld, xHat;
+    Zeros( x, n, 1 );
+    Zeros( z, n, 1 );
+    Zeros( u, n, 1 );
+    for( Int whichLambda=0; whichLambda<numLambdas; ++whichLambda )
+    {
+        // Warm-start from the (x,z,u) of the previous value of lambda1
+        const Real lambda1 = lambda1s(whichLambda);
+
+        Int numIter=0;
+        while( numIter < ctrl.maxIter )
+        {
+            zOld = z;
+
+            // x := (A^H A + rho) \ (A^H b + rho*(z-u))
+            x = w;
+            Axpy(  ctrl.rho, z, x );
+            Axpy( -ctrl.rho, u, x );
+            if( m >= n )
+            {
+                if( ctrl.inv )
+                {
+                    s = x;
+                    Hemv( LOWER, Field(1), P, s, Field(0), x );
+                }
+                else
+                {
+                    Trsv( LOWER, NORMAL, NON_UNIT, P, x );
+                    Trsv( LOWER, ADJOINT, NON_UNIT, P, x );
+                }
+            }
+            else
+            {
+                Gemv( NORMAL, Field(1), A, x, s );
+                if( ctrl.inv )
+                {
+                    auto t( s );
+                    Hemv( LOWER, Field(1), P, t, Field(0), s );
+                }
+                else
+                {
+                    Trsv( LOWER, NORMAL, NON_UNIT, P, s );
+                    Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
+                }
+                Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
+                x *= 1/ctrl.rho;
+            }
+
+            // xHat := alpha x + (1-alpha) zOld
+            xHat = x;
+            xHat *= ctrl.alpha;
+            Axpy( 1-ctrl.alpha, zOld, xHat );
+
+            // z := SoftThresh(xHat+u,lambda1/rho) rho/(rho+2*lambda2)
+            z = xHat;
+            z += u;
+            SoftThreshold( z, lambda1/ctrl.rho );
+            if( lambda2 != Real(0) )
+                z *= zScale;
+
+            // u := u + (xHat - z)
+            u += xHat;
+            u -= z;
+
+            // rNorm := || x - z ||_2
+            s = x;
+            s -= z;
+            const Real rNorm = FrobeniusNorm( s );
+
+            // sNorm := || rho*(z-zOld) ||_2
+            s = z;
+            s -= zOld;
+            const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+
+            const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
+                ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+            const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
+                ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+
+            if( ctrl.progress )
+            {
+                s = b;
+                Gemv( NORMAL, Field(-1), A, x, Field(1), s );
+                const Real resid = FrobeniusNorm( s );
+                const Real obj = Real(1)/Real(2)*resid*resid +
+                    lambda1*OneNorm(z) + lambda2*Pow(FrobeniusNorm(z),Real(2));
+                Output
+                ("lambda1=",lambda1,", ",numIter,": ||x-z||_2=",rNorm,
+                 ", epsPri=",epsPri,", |rho| ||z-zOld||_2=",sNorm,
+                 ", and epsDual=",epsDual,", objective=",obj);
+            }
+
+            if( rNorm < epsPri && sNorm < epsDual )
+                break;
+            ++numIter;
+        }
+        if( ctrl.maxIter == numIter )
+            RuntimeError
+            ("Lasso path failed to converge for lambda1=",lambda1);
+        totalIter += numIter;
+
+        auto xPath = X( ALL, IR(whichLambda) );
+        xPath = z;
+    }
+    return totalIter;
+}
+
+template<typename Field>
+Int PathADMM
+( const AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Field>& bPre,
+  const Matrix<Base<Field>>& lambda1s,
+        Base<Field> lambda2,
+        AbstractDistMatrix<Field>& XPre,
+  const ADMMCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+
+    DistMatrixReadProxy<Field,Field,MC,MR>
+      AProx( APre ),
+      bProx( bPre );
+    DistMatrixWriteProxy<Field,Field,MC,MR>
+      XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& b = bProx.GetLocked();
+    auto& X = XProx.Get();
+
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numLambdas = lambda1s.Height();
+    const Grid& g = A.Grid();
+    EL_DEBUG_ONLY(
+      if( lambda1s.Width() != 1 )
+          LogicError("lambda1s must be a column vector");
+    )
+    Zeros( X, n, numLambdas );
+
+    // The factored system does not involve the regularization parameters,
+    // so it is shared across the entire path
+    DistMatrix<Field> P(g);
+    if( m >= n )
+    {
+        Identity( P, n, n );
+        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
+    }
+    else
+    {
+        Identity( P, m, m );
+        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
+    }
+    if( ctrl.inv )
+        HPDInverse( LOWER, P );
+    else
+        Cholesky( LOWER, P );
+
+    // Cache w := A^H b
+    DistMatrix<Field> w(g);
+    Gemv( ADJOINT, Field(1), A, b, w );
+
+    const Real zScale = ctrl.rho / (ctrl.rho + 2*lambda2);
+
+    Int totalIter=0;
+    DistMatrix<Field> x(g), z(g), u(g), s(g), zOld(g), xHat(g);
+    Zeros( x, n, 1 );
+    Zeros( z, n, 1 );
+    Zeros( u, n, 1 );
+    for( Int whichLambda=0; whichLambda<numLambdas; ++whichLambda )
+    {
+        // Warm-start from the (x,z,u) of the previous value of lambda1
+        const Real lambda1 = lambda1s(whichLambda);
+
+        Int numIter=0;
+        while( numIter < ctrl.maxIter )
+        {
+            zOld = z;
+
+            // x := (A^H A + rho) \ (A^H b + rho*(z-u))
+            x = w;
+            Axpy(  ctrl.rho, z, x );
+            Axpy( -ctrl.rho, u, x );
+            if( m >= n )
+            {
+                if( ctrl.inv )
+                {
+                    s = x;
+                    Hemv( LOWER, Field(1), P, s, Field(0), x );
+                }
+                else
+                {
+                    Trsv( LOWER, NORMAL, NON_UNIT, P, x );
+                    Trsv( LOWER, ADJOINT, NON_UNIT, P, x );
+                }
+            }
+            else
+            {
+                Gemv( NORMAL, Field(1), A, x, s );
+                if( ctrl.inv )
+                {
+                    auto t( s );
+                    Hemv( LOWER, Field(1), P, t, Field(0), s );
+                }
+                else
+                {
+                    Trsv( LOWER, NORMAL, NON_UNIT, P, s );
+                    Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
+                }
+                Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
+                x *= 1/ctrl.rho;
+            }
+
+            // xHat := alpha x + (1-alpha) zOld
+            xHat = x;
+            xHat *= ctrl.alpha;
+            Axpy( 1-ctrl.alpha, zOld, xHat );
+
+            // z := SoftThresh(xHat+u,lambda1/rho) rho/(rho+2*lambda2)
+            z = xHat;
+            z += u;
+            SoftThreshold( z, lambda1/ctrl.rho );
+            if( lambda2 != Real(0) )
+                z *= zScale;
+
+            // u := u + (xHat - z)
+            u += xHat;
+            u -= z;
+
+            // rNorm := || x - z ||_2
+            s = x;
+            s -= z;
+            const Real rNorm = FrobeniusNorm( s );
+
+            // sNorm := || rho*(z-zOld) ||_2
+            s = z;
+            s -= zOld;
+            const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+
+            const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
+                ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+            const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
+                ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+
+            if( ctrl.progress )
+            {
+                s = b;
+                Gemv( NORMAL, Field(-1), A, x, Field(1), s );
+                const Real resid = FrobeniusNorm( s );
+                const Real obj = Real(1)/Real(2)*resid*resid +
+                    lambda1*OneNorm(z) + lambda2*Pow(FrobeniusNorm(z),Real(2));
+                if( g.Rank() == 0 )
+                {
+                    Output
+                    ("lambda1=",lambda1,", ",numIter,": ||x-z||_2=",rNorm,
+                     ", epsPri=",epsPri,", |rho| ||z-zOld||_2=",sNorm,
+                     ", and epsDual=",epsDual,", objective=",obj);
+                }
+            }
+
+            if( rNorm < epsPri && sNorm < epsDual )
+                break;
+            ++numIter;
+        }
+        if( ctrl.maxIter == numIter )
+            RuntimeError
+            ("Lasso path failed to converge for lambda1=",lambda1);
+        totalIter += numIter;
+
+        auto xPath = X( ALL, IR(whichLambda) );
+        xPath = z;
+    }
+    return totalIter;
+}
+
+} // namespace bpdn
+} // namespace El
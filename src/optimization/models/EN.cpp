@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./BPDN/PathADMM.hpp"
 
 // An elastic net seeks the solution to the optimization problem
 //
@@ -349,6 +350,39 @@ void EN
     x.ProcessQueues();
 }
 
+// The path solver halves both penalties so that the ADMM engine, which
+// minimizes (1/2) || A x - b ||_2^2 plus the regularization, matches the
+// elastic-net objective above (which has no 1/2 on the quadratic term)
+template<typename Real>
+void ENPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& lambda1s,
+        Real lambda2,
+        Matrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> lambda1sHalf( lambda1s );
+    lambda1sHalf *= Real(1)/Real(2);
+    bpdn::PathADMM( A, b, lambda1sHalf, lambda2/Real(2), X, ctrl );
+}
+
+template<typename Real>
+void ENPath
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+  const Matrix<Real>& lambda1s,
+        Real lambda2,
+        AbstractDistMatrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> lambda1sHalf( lambda1s );
+    lambda1sHalf *= Real(1)/Real(2);
+    bpdn::PathADMM( A, b, lambda1sHalf, lambda2/Real(2), X, ctrl );
+}
+
 #define PROTO(Real) \
   template void EN \
   ( const Matrix<Real>& A, \
@@ -377,7 +411,21 @@ void EN
           Real lambda1, \
           Real lambda2, \
           DistMultiVec<Real>& x, \
-    const qp::affine::Ctrl<Real>& ctrl );
+    const qp::affine::Ctrl<Real>& ctrl ); \
+  template void ENPath \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& lambda1s, \
+          Real lambda2, \
+          Matrix<Real>& X, \
+    const bpdn::ADMMCtrl<Real>& ctrl ); \
+  template void ENPath \
+  ( const AbstractDistMatrix<Real>& A, \
+    const AbstractDistMatrix<Real>& b, \
+    const Matrix<Real>& lambda1s, \
+          Real lambda2, \
+          AbstractDistMatrix<Real>& X, \
+    const bpdn::ADMMCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
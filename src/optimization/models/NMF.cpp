@@ -14,6 +14,225 @@ namespace El {
 // Better convergence criterions. E.g., accept a relative tolerance in addition
 // to the maximum number of iterations.
 
+namespace nmf {
+
+// One HALS sweep over the rank-one blocks of the factorization: given the
+// cached Gram matrix G of the opposing factor and the cached cross product
+// C, each column of the (locally stored) factor F is refined via
+//
+//   F(:,j) := max( F(:,j) + (C(:,j) - F G(:,j)) / G(j,j), 0 ).
+//
+// Every row of F is updated independently, so the same kernel serves both
+// the sequential factor and the local portion of a [VC,STAR] distributed
+// factor. The squared norms of the applied corrections and of the updated
+// columns are accumulated per block so that the caller can measure
+// per-block convergence (globally, in the distributed case).
+template<typename Real>
+void HALSSweep
+(       Matrix<Real>& F,
+  const Matrix<Real>& C,
+  const Matrix<Real>& G,
+  const vector<bool>& converged,
+        Matrix<Real>& deltaNorms,
+        Matrix<Real>& colNorms )
+{
+    EL_DEBUG_CSE
+    const Int mLoc = F.Height();
+    const Int k = F.Width();
+    deltaNorms.Resize( k, 1 );
+    colNorms.Resize( k, 1 );
+
+          Real* FBuf = F.Buffer();
+    const Real* CBuf = C.LockedBuffer();
+    const Real* GBuf = G.LockedBuffer();
+    const Int FLDim = F.LDim();
+    const Int CLDim = C.LDim();
+    const Int GLDim = G.LDim();
+
+    Matrix<Real> v;
+    v.Resize( mLoc, 1 );
+    Real* vBuf = v.Buffer();
+
+    for( Int j=0; j<k; ++j )
+    {
+        deltaNorms(j) = 0;
+        colNorms(j) = 0;
+        if( converged[j] )
+            continue;
+        const Real gjj = GBuf[j+j*GLDim];
+        if( gjj == Real(0) )
+        {
+            // A numerically vanishing block is left unchanged
+            continue;
+        }
+
+        // v := C(:,j) - F G(:,j)
+        MemCopy( vBuf, &CBuf[j*CLDim], mLoc );
+        for( Int l=0; l<k; ++l )
+        {
+            const Real gamma = GBuf[l+j*GLDim];
+            if( gamma == Real(0) )
+                continue;
+            const Real* fCol = &FBuf[l*FLDim];
+            EL_SIMD
+            for( Int i=0; i<mLoc; ++i )
+                vBuf[i] -= gamma*fCol[i];
+        }
+
+        // F(:,j) := max( F(:,j) + v / G(j,j), 0 )
+        Real* fj = &FBuf[j*FLDim];
+        Real deltaSum = 0;
+        Real colSum = 0;
+        for( Int i=0; i<mLoc; ++i )
+        {
+            const Real fNew = Max( fj[i] + vBuf[i]/gjj, Real(0) );
+            const Real delta = fNew - fj[i];
+            deltaSum += delta*delta;
+            colSum += fNew*fNew;
+            fj[i] = fNew;
+        }
+        deltaNorms(j) = deltaSum;
+        colNorms(j) = colSum;
+    }
+}
+
+// Mark the blocks whose latest correction was negligible relative to the
+// updated column so that subsequent sweeps skip them; the return value
+// reports whether every block has converged
+template<typename Real>
+bool MarkConvergedBlocks
+( const Matrix<Real>& deltaNorms,
+  const Matrix<Real>& colNorms,
+        Real tol,
+        vector<bool>& converged )
+{
+    EL_DEBUG_CSE
+    const Int k = deltaNorms.Height();
+    bool allConverged = true;
+    for( Int j=0; j<k; ++j )
+    {
+        if( !converged[j] && deltaNorms(j) <= tol*tol*colNorms(j) )
+            converged[j] = true;
+        allConverged = allConverged && converged[j];
+    }
+    return allConverged;
+}
+
+template<typename Real>
+void HALS
+( const Matrix<Real>& A,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int k = X.Width();
+    // As with the NNLS-based algorithm, X must be externally initialized;
+    // Y is refined from wherever it starts, so default it to zero if the
+    // caller did not provide an initial guess
+    if( Y.Height() != n || Y.Width() != k )
+        Zeros( Y, n, k );
+
+    Matrix<Real> G, C, deltaNorms, colNorms;
+    vector<bool> converged;
+    for( Int iter=0; iter<ctrl.maxIter; ++iter )
+    {
+        // Refine Y with the cached Gram matrix X^H X and cross product A^H X
+        Gemm( ADJOINT, NORMAL, Real(1), X, X, G );
+        Gemm( ADJOINT, NORMAL, Real(1), A, X, C );
+        converged.assign( k, false );
+        for( Int sweep=0; sweep<ctrl.halsMaxSweeps; ++sweep )
+        {
+            HALSSweep( Y, C, G, converged, deltaNorms, colNorms );
+            if( MarkConvergedBlocks
+                ( deltaNorms, colNorms, ctrl.halsTol, converged ) )
+                break;
+        }
+
+        // Refine X with the cached Gram matrix Y^H Y and cross product A Y
+        Gemm( ADJOINT, NORMAL, Real(1), Y, Y, G );
+        Gemm( NORMAL, NORMAL, Real(1), A, Y, C );
+        converged.assign( k, false );
+        for( Int sweep=0; sweep<ctrl.halsMaxSweeps; ++sweep )
+        {
+            HALSSweep( X, C, G, converged, deltaNorms, colNorms );
+            if( MarkConvergedBlocks
+                ( deltaNorms, colNorms, ctrl.halsTol, converged ) )
+                break;
+        }
+    }
+}
+
+template<typename Real>
+void HALS
+( const DistMatrix<Real>& A,
+        DistMatrix<Real>& X,
+        DistMatrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int n = A.Width();
+    const Int k = X.Width();
+    if( Y.Height() != n || Y.Width() != k )
+        Zeros( Y, n, k );
+
+    // The block updates only couple the columns of a factor, so, with the
+    // Gram matrix replicated and the factor and cross product distributed
+    // over [VC,STAR], every sweep is communication-free up to the two
+    // length-k AllReduces which decide the per-block early exits
+    DistMatrix<Real> GGen(g), C(g);
+    DistMatrix<Real,STAR,STAR> G(g);
+    DistMatrix<Real,VC,STAR> FVC(g), CVC(g);
+    Matrix<Real> deltaNorms, colNorms;
+    vector<bool> converged;
+    for( Int iter=0; iter<ctrl.maxIter; ++iter )
+    {
+        // Refine Y with the cached Gram matrix X^H X and cross product A^H X
+        Gemm( ADJOINT, NORMAL, Real(1), X, X, GGen );
+        G = GGen;
+        Gemm( ADJOINT, NORMAL, Real(1), A, X, C );
+        FVC = Y;
+        CVC = C;
+        converged.assign( k, false );
+        for( Int sweep=0; sweep<ctrl.halsMaxSweeps; ++sweep )
+        {
+            HALSSweep
+            ( FVC.Matrix(), CVC.LockedMatrix(), G.LockedMatrix(),
+              converged, deltaNorms, colNorms );
+            mpi::AllReduce( deltaNorms.Buffer(), int(k), FVC.ColComm() );
+            mpi::AllReduce( colNorms.Buffer(), int(k), FVC.ColComm() );
+            if( MarkConvergedBlocks
+                ( deltaNorms, colNorms, ctrl.halsTol, converged ) )
+                break;
+        }
+        Y = FVC;
+
+        // Refine X with the cached Gram matrix Y^H Y and cross product A Y
+        Gemm( ADJOINT, NORMAL, Real(1), Y, Y, GGen );
+        G = GGen;
+        Gemm( NORMAL, NORMAL, Real(1), A, Y, C );
+        FVC = X;
+        CVC = C;
+        converged.assign( k, false );
+        for( Int sweep=0; sweep<ctrl.halsMaxSweeps; ++sweep )
+        {
+            HALSSweep
+            ( FVC.Matrix(), CVC.LockedMatrix(), G.LockedMatrix(),
+              converged, deltaNorms, colNorms );
+            mpi::AllReduce( deltaNorms.Buffer(), int(k), FVC.ColComm() );
+            mpi::AllReduce( colNorms.Buffer(), int(k), FVC.ColComm() );
+            if( MarkConvergedBlocks
+                ( deltaNorms, colNorms, ctrl.halsTol, converged ) )
+                break;
+        }
+        X = FVC;
+    }
+}
+
+} // namespace nmf
+
 template<typename Real>
 void NMF
 ( const Matrix<Real>& A,
@@ -22,6 +241,11 @@ void NMF
   const NMFCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.hals )
+    {
+        nmf::HALS( A, X, Y, ctrl );
+        return;
+    }
 
     Matrix<Real> AAdj, XAdj, YAdj;
     Adjoint( A, AAdj );
@@ -54,6 +278,12 @@ void NMF
     auto& X = XProx.Get();
     auto& Y = YProx.Get();
 
+    if( ctrl.hals )
+    {
+        nmf::HALS( A, X, Y, ctrl );
+        return;
+    }
+
     DistMatrix<Real> AAdj(A.Grid()), XAdj(A.Grid()), YAdj(A.Grid());
     Adjoint( A, AAdj );
 
@@ -59,7 +59,7 @@ void ADMM
     const Real tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    Matrix<Field> E, Y;
+    Matrix<Field> E, Y, QWarm;
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -92,6 +92,8 @@ void ADMM
         Int rank;
         if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
+        else if( ctrl.useIncremental )
+            rank = svt::Incremental( L, Real(1)/beta, QWarm );
         else
             rank = SVT( L, Real(1)/beta );
 
@@ -165,7 +167,7 @@ void ADMM
     const Real tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    DistMatrix<Field> E( M.Grid() ), Y( M.Grid() );
+    DistMatrix<Field> E( M.Grid() ), Y( M.Grid() ), QWarm( M.Grid() );
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -198,6 +200,8 @@ void ADMM
         Int rank;
         if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
+        else if( ctrl.useIncremental )
+            rank = svt::Incremental( L, Real(1)/beta, QWarm );
         else
             rank = SVT( L, Real(1)/beta );
 
@@ -285,7 +289,7 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    Matrix<Field> LLast, SLast, E;
+    Matrix<Field> LLast, SLast, E, QWarm;
     while( true )
     {
         ++numIts;
@@ -311,6 +315,8 @@ void ALM
             Axpy( Field(1)/beta, Y, L );
             if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
+            else if( ctrl.useIncremental )
+                rank = svt::Incremental( L, Real(1)/beta, QWarm );
             else
                 rank = SVT( L, Real(1)/beta );
 
@@ -434,7 +440,8 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    DistMatrix<Field> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() );
+    DistMatrix<Field> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() ),
+      QWarm( M.Grid() );
     while( true )
     {
         ++numIts;
@@ -460,6 +467,8 @@ void ALM
             Axpy( Field(1)/beta, Y, L );
             if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
+            else if( ctrl.useIncremental )
+                rank = svt::Incremental( L, Real(1)/beta, QWarm );
             else
                 rank = SVT( L, Real(1)/beta );
 
@@ -59,6 +59,43 @@ void SVM
     svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
+// The factored-kernel drivers exploit the exact equivalence between a
+// kernel machine over K = L L^H and a linear machine over the rows of L:
+// once the early-exit pivoted Cholesky has extracted the numerical rank,
+// the usual QP is posed over the m x k factor, so the interior-point
+// method's dense KKT factorizations shrink accordingly.
+template<typename Real>
+void KernelSVM
+( const Matrix<Real>& K,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& L,
+        Matrix<Real>& x,
+  const SVMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Permutation P;
+    LowRankCholesky
+    ( LOWER, K, L, P, ctrl.kernelRelTol, ctrl.maxKernelRank );
+    svm::IPM( L, d, lambda, x, ctrl.ipmCtrl );
+}
+
+template<typename Real>
+void KernelSVM
+( const AbstractDistMatrix<Real>& K,
+  const AbstractDistMatrix<Real>& d,
+        Real lambda,
+        AbstractDistMatrix<Real>& L,
+        AbstractDistMatrix<Real>& x,
+  const SVMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistPermutation P( K.Grid() );
+    LowRankCholesky
+    ( LOWER, K, L, P, ctrl.kernelRelTol, ctrl.maxKernelRank );
+    svm::IPM( L, d, lambda, x, ctrl.ipmCtrl );
+}
+
 #define PROTO(Real) \
   template void SVM \
   ( const Matrix<Real>& A, \
@@ -83,6 +120,20 @@ void SVM
     const DistMultiVec<Real>& d, \
           Real lambda, \
           DistMultiVec<Real>& x, \
+    const SVMCtrl<Real>& ctrl ); \
+  template void KernelSVM \
+  ( const Matrix<Real>& K, \
+    const Matrix<Real>& d, \
+          Real lambda, \
+          Matrix<Real>& L, \
+          Matrix<Real>& x, \
+    const SVMCtrl<Real>& ctrl ); \
+  template void KernelSVM \
+  ( const AbstractDistMatrix<Real>& K, \
+    const AbstractDistMatrix<Real>& d, \
+          Real lambda, \
+          AbstractDistMatrix<Real>& L, \
+          AbstractDistMatrix<Real>& x, \
     const SVMCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
@@ -48,7 +48,7 @@ void LogisticProx( Matrix<Real>& A, const Real& tau, Int numIts )
         }
         return beta;
       };
-    EntrywiseMap( A, MakeFunction(logisticProx) );
+    EntrywiseMap( A, logisticProx );
 }
 
 template<typename Real>
@@ -84,7 +84,7 @@ void LogisticProx( AbstractDistMatrix<Real>& A, const Real& tau, Int numIts )
         }
         return beta;
       };
-    EntrywiseMap( A, MakeFunction(logisticProx) );
+    EntrywiseMap( A, logisticProx );
 }
 
 #define PROTO(Real) \
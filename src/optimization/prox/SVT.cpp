@@ -10,6 +10,7 @@
 
 #include "./SVT/Normal.hpp"
 #include "./SVT/Cross.hpp"
+#include "./SVT/Incremental.hpp"
 #include "./SVT/PivotedQR.hpp"
 #include "./SVT/TSQR.hpp"
 
@@ -78,6 +79,12 @@ Int SVT( DistMatrix<Field,U,STAR>& A, const Base<Field>& tau, bool relative )
   ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, bool relative ); \
   template Int svt::Cross \
   ( DistMatrix<Field,VC,STAR>& A, const Base<Field>& tau, bool relative ); \
+  template Int svt::Incremental \
+  ( Matrix<Field>& A, const Base<Field>& tau, Matrix<Field>& Q, \
+    bool relative ); \
+  template Int svt::Incremental \
+  ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, \
+    DistMatrix<Field>& Q, bool relative ); \
   template Int svt::PivotedQR \
   ( Matrix<Field>& A, const Base<Field>& tau, Int numSteps, bool relative ); \
   template Int svt::PivotedQR \
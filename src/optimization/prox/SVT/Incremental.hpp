@@ -0,0 +1,202 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVT_INCREMENTAL_HPP
+#define EL_SVT_INCREMENTAL_HPP
+
+namespace El {
+namespace svt {
+
+// Soft-threshold via a warm-started partial SVD: the dominant left subspace
+// of the previous iterate (passed in and out through Q) is augmented with a
+// random block, refined with a few steps of block subspace iteration, and
+// expanded until the smallest captured singular value falls below the
+// threshold, so that only the singular triplets above the threshold are ever
+// resolved. This is a heuristic appropriate for proximal loops (e.g., RPCA)
+// whose subspaces vary slowly from one iteration to the next.
+
+template<typename Field>
+Int Incremental
+( Matrix<Field>& A,
+  const Base<Field>& tau,
+        Matrix<Field>& Q,
+  bool relative )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min( m, n );
+    const Int oversample = 10;
+    const Int numPowerIts = 2;
+    if( minDim == 0 )
+        return 0;
+
+    // Seed the subspace with the previous iterate's left singular vectors,
+    // augmented with a random block to capture newly entering directions
+    Int blockSize = Min( Max(Q.Width(),Int(1))+oversample, minDim );
+    Matrix<Field> G;
+    if( Q.Height() == m && Q.Width() > 0 )
+    {
+        const Int numWarm = Min( Q.Width(), blockSize );
+        G.Resize( m, blockSize );
+        auto GWarm = G( ALL, IR(0,numWarm) );
+        GWarm = Q( ALL, IR(0,numWarm) );
+        if( numWarm < blockSize )
+        {
+            Matrix<Field> R;
+            Gaussian( R, m, blockSize-numWarm );
+            auto GRand = G( ALL, IR(numWarm,blockSize) );
+            GRand = R;
+        }
+    }
+    else
+        Gaussian( G, m, blockSize );
+
+    Matrix<Field> U, V, W, B;
+    Matrix<Real> s;
+    while( true )
+    {
+        // Refine the subspace with a few steps of block power iteration
+        // on A A^H
+        qr::ExplicitUnitary( G );
+        for( Int it=0; it<numPowerIts; ++it )
+        {
+            Gemm( ADJOINT, NORMAL, Field(1), A, G, W );
+            qr::ExplicitUnitary( W );
+            Gemm( NORMAL, NORMAL, Field(1), A, W, G );
+            qr::ExplicitUnitary( G );
+        }
+
+        // Compute the SVD of the projection of A onto the subspace
+        Gemm( ADJOINT, NORMAL, Field(1), G, A, B );
+        SVD( B, U, s, V );
+
+        const Int k = s.Height();
+        const Real thresh = ( relative ? tau*s(0) : tau );
+        if( blockSize >= minDim || s(k-1) <= thresh )
+            break;
+
+        // The entire captured spectrum lies above the threshold, so expand
+        // the block with a fresh random portion and try again
+        const Int newBlockSize = Min( 2*blockSize, minDim );
+        Matrix<Field> GNew( m, newBlockSize );
+        auto GNewL = GNew( ALL, IR(0,blockSize) );
+        GNewL = G;
+        Matrix<Field> R;
+        Gaussian( R, m, newBlockSize-blockSize );
+        auto GNewR = GNew( ALL, IR(blockSize,newBlockSize) );
+        GNewR = R;
+        G = GNew;
+        blockSize = newBlockSize;
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+
+    // Rotate the subspace basis into the left singular vectors, saving the
+    // dominant portion for the next warm start, and reconstruct A
+    Gemm( NORMAL, NORMAL, Field(1), G, U, W );
+    Q = W( ALL, IR(0,rank) );
+    DiagonalScale( RIGHT, NORMAL, s, W );
+    Gemm( NORMAL, ADJOINT, Field(1), W, V, Field(0), A );
+
+    return rank;
+}
+
+template<typename Field>
+Int Incremental
+( AbstractDistMatrix<Field>& APre,
+  const Base<Field>& tau,
+        DistMatrix<Field>& Q,
+  bool relative )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min( m, n );
+    const Int oversample = 10;
+    const Int numPowerIts = 2;
+    const Grid& g = A.Grid();
+    if( minDim == 0 )
+        return 0;
+
+    Int blockSize = Min( Max(Q.Width(),Int(1))+oversample, minDim );
+    DistMatrix<Field> G(g);
+    if( Q.Height() == m && Q.Width() > 0 )
+    {
+        const Int numWarm = Min( Q.Width(), blockSize );
+        G.Resize( m, blockSize );
+        auto GWarm = G( ALL, IR(0,numWarm) );
+        GWarm = Q( ALL, IR(0,numWarm) );
+        if( numWarm < blockSize )
+        {
+            DistMatrix<Field> R(g);
+            Gaussian( R, m, blockSize-numWarm );
+            auto GRand = G( ALL, IR(numWarm,blockSize) );
+            GRand = R;
+        }
+    }
+    else
+        Gaussian( G, m, blockSize );
+
+    DistMatrix<Field> U(g), V(g), W(g), B(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    while( true )
+    {
+        qr::ExplicitUnitary( G );
+        for( Int it=0; it<numPowerIts; ++it )
+        {
+            Gemm( ADJOINT, NORMAL, Field(1), A, G, W );
+            qr::ExplicitUnitary( W );
+            Gemm( NORMAL, NORMAL, Field(1), A, W, G );
+            qr::ExplicitUnitary( G );
+        }
+
+        Gemm( ADJOINT, NORMAL, Field(1), G, A, B );
+        SVD( B, U, s, V );
+
+        const Int k = s.Height();
+        const Real thresh = ( relative ? tau*s.Get(0,0) : tau );
+        if( blockSize >= minDim || s.Get(k-1,0) <= thresh )
+            break;
+
+        const Int newBlockSize = Min( 2*blockSize, minDim );
+        DistMatrix<Field> GNew(g);
+        GNew.AlignWith( G );
+        GNew.Resize( m, newBlockSize );
+        auto GNewL = GNew( ALL, IR(0,blockSize) );
+        GNewL = G;
+        DistMatrix<Field> R(g);
+        Gaussian( R, m, newBlockSize-blockSize );
+        auto GNewR = GNew( ALL, IR(blockSize,newBlockSize) );
+        GNewR = R;
+        G = GNew;
+        blockSize = newBlockSize;
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+
+    Gemm( NORMAL, NORMAL, Field(1), G, U, W );
+    Q = W( ALL, IR(0,rank) );
+    DiagonalScale( RIGHT, NORMAL, s, W );
+    Gemm( NORMAL, ADJOINT, Field(1), W, V, Field(0), A );
+
+    return rank;
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_INCREMENTAL_HPP
@@ -31,7 +31,7 @@ void SoftThreshold( Matrix<Field>& A, const Base<Field>& tau, bool relative )
         tauMod *= MaxNorm(A);
     auto softThresh =
       [&]( const Field& alpha ) { return SoftThreshold(alpha,tauMod); };
-    EntrywiseMap( A, MakeFunction(softThresh) );
+    EntrywiseMap( A, softThresh );
 }
 
 template<typename Field>
@@ -44,7 +44,7 @@ void SoftThreshold
         tauMod *= MaxNorm(A);
     auto softThresh =
       [&]( const Field& alpha ) { return SoftThreshold(alpha,tauMod); };
-    EntrywiseMap( A, MakeFunction(softThresh) );
+    EntrywiseMap( A, softThresh );
 }
 
 #define PROTO(Field) \
@@ -8,6 +8,16 @@
 */
 #include <El.hpp>
 
+#include <cstdlib>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace El {
 
 // Please see http://lpsolve.sourceforge.net/5.5/mps-format.htm for a very
@@ -182,6 +192,141 @@ struct AffineLPEntry
   Real value;
 };
 
+namespace mps {
+
+// Scans an MPS file line-by-line over a read-only memory map of its contents
+// so that ingestion avoids both the filesystem round-trips of 'std::getline'
+// and the per-line 'std::stringstream' construction of the previous reader,
+// which dominated the load time of multi-gigabyte models. On platforms
+// without mmap (or if the map cannot be established), the entire file is
+// instead buffered in memory, which preserves the scanning interface.
+class MappedFile
+{
+public:
+    explicit MappedFile( const string& filename );
+    ~MappedFile();
+
+    // Return the half-open range of the next line (stripped of any trailing
+    // carriage return) and advance, or return false at the end of the file.
+    bool NextLine( const char*& lineBeg, const char*& lineEnd );
+
+    // Restart the scan from the beginning of the file.
+    void Reset();
+
+private:
+    const char* data_=nullptr;
+    size_t size_=0;
+    size_t offset_=0;
+    bool mapped_=false;
+    vector<char> buffer_;
+};
+
+MappedFile::MappedFile( const string& filename )
+{
+    EL_DEBUG_CSE
+#ifndef _WIN32
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd != -1 )
+    {
+        struct stat fileStat;
+        if( fstat( fd, &fileStat ) == 0 && fileStat.st_size > 0 )
+        {
+            void* baseAddress =
+              mmap( nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if( baseAddress != MAP_FAILED )
+            {
+                data_ = static_cast<const char*>(baseAddress);
+                size_ = fileStat.st_size;
+                mapped_ = true;
+                // We will pass over the file from beginning to end (twice),
+                // so encourage aggressive read-ahead.
+                madvise( baseAddress, size_, MADV_SEQUENTIAL );
+            }
+        }
+        close( fd );
+    }
+#endif
+    if( !mapped_ )
+    {
+        std::ifstream file( filename.c_str(), std::ios::binary );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        file.seekg( 0, std::ios::end );
+        buffer_.resize( size_t(file.tellg()) );
+        file.seekg( 0, std::ios::beg );
+        if( buffer_.size() > 0 )
+            file.read( buffer_.data(), buffer_.size() );
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+    }
+}
+
+MappedFile::~MappedFile()
+{
+#ifndef _WIN32
+    if( mapped_ )
+        munmap( const_cast<char*>(data_), size_ );
+#endif
+}
+
+bool MappedFile::NextLine( const char*& lineBeg, const char*& lineEnd )
+{
+    if( offset_ >= size_ )
+        return false;
+    lineBeg = data_ + offset_;
+    const char* newline =
+      static_cast<const char*>
+      ( std::memchr( lineBeg, '\n', size_-offset_ ) );
+    if( newline == nullptr )
+    {
+        lineEnd = data_ + size_;
+        offset_ = size_;
+    }
+    else
+    {
+        lineEnd = newline;
+        offset_ = size_t(newline-data_) + 1;
+    }
+    if( lineEnd > lineBeg && lineEnd[-1] == '\r' )
+        --lineEnd;
+    return true;
+}
+
+void MappedFile::Reset()
+{ offset_ = 0; }
+
+// Split a line into its whitespace-delimited tokens. MPS row and variable
+// names are almost always short enough for the small-string optimization,
+// so, since the token vector is reused across lines, tokenization typically
+// performs no heap allocation.
+inline void Tokenize
+( const char* lineBeg, const char* lineEnd, vector<string>& tokens )
+{
+    tokens.clear();
+    const char* pos = lineBeg;
+    while( pos < lineEnd )
+    {
+        while( pos < lineEnd && (*pos == ' ' || *pos == '\t') )
+            ++pos;
+        const char* tokenBeg = pos;
+        while( pos < lineEnd && *pos != ' ' && *pos != '\t' )
+            ++pos;
+        if( pos > tokenBeg )
+            tokens.emplace_back( tokenBeg, pos );
+    }
+}
+
+// Parse a floating-point value without stream overhead and return whether
+// the entire token was consumed.
+inline bool ExtractValue( const string& token, double& value )
+{
+    char* tokenEnd;
+    value = std::strtod( token.c_str(), &tokenEnd );
+    return tokenEnd != token.c_str() && *tokenEnd == '\0';
+}
+
+} // namespace mps
+
 // We form the primal problem
 //
 //   arginf_{x,s} { c^T x | A x = b, G x + s = h, s >= 0 },
@@ -234,7 +379,7 @@ public:
 
 private:
     string filename_;
-    std::ifstream file_;
+    mps::MappedFile file_;
 
     bool minimize_;
     bool keepNonnegativeWithZeroUpperBound_;
@@ -256,10 +401,8 @@ private:
     bool initializedBoundsSection_=false;
     bool boundsHasName_;
 
-    // Temporaries for the metadata extraction process.
-    string line_;
-    string token_, rowType_, rowName_, variableName_, boundMark_;
-    double value_;
+    // A reusable token buffer for scanning data lines.
+    vector<string> tokens_;
 
     // For the final loop over the variable dictionary to extract the
     // nonpositive and nonnegative bounds.
@@ -272,45 +415,41 @@ MPSReader::MPSReader
   bool minimize,
   bool keepNonnegativeWithZeroUpperBound )
 : filename_(filename),
-  file_(filename.c_str()),
+  file_(filename),
   minimize_(minimize),
   keepNonnegativeWithZeroUpperBound_(keepNonnegativeWithZeroUpperBound)
 {
     EL_DEBUG_CSE
     if( compressed )
         LogicError("Compressed reads are not yet supported");
-    if( !file_.is_open() )
-        RuntimeError("Could not open ",filename);
 
     // Rather than assuming that std::map<string,Int>::size() is constant-time,
     // we can maintain counters for the sizes of the variable dictionary.
     Int variableCounter=0;
 
-    // Temporaries for the metadata extraction process.
-    string token, rowType, rowName, variableName, boundMark;
-    string rhsNameCandidate, boundNameCandidate;
+    // The line currently being scanned and its tokens.
+    const char* lineBeg;
+    const char* lineEnd;
+    vector<string> tokens;
     double value;
 
     // TODO(poulson): Convert each token to upper-case letters before each
     // comparison. While capital letters are used by convention, they are
     // not required.
     MPSSection section = MPS_NONE;
-    string line;
-    while( std::getline( file_, line ) )
+    while( file_.NextLine( lineBeg, lineEnd ) )
     {
         // We first determine which section we are in
         // ------------------------------------------
-        std::stringstream sectionStream( line );
-        const char firstChar = sectionStream.peek();
+        const char firstChar = ( lineBeg == lineEnd ? '\0' : *lineBeg );
         const bool isDataLine =
           firstChar == ' ' ||
           firstChar == '\t' ||
           firstChar == '*' ||
           firstChar == '#';
 
-        // The first token on each line should be a string. We will check it for
-        // equivalence with each section string.
-        if( !(sectionStream >> token) )
+        mps::Tokenize( lineBeg, lineEnd, tokens );
+        if( tokens.size() == 0 )
         {
             // This line only consists of whitespace.
             continue;
@@ -318,12 +457,14 @@ MPSReader::MPSReader
 
         if( !isDataLine )
         {
+            const string& token = tokens[0];
             if( token == "NAME" )
             {
                 if( meta_.name != "" )
                     LogicError("Multiple 'NAME' sections");
-                if( !(sectionStream >> meta_.name) )
+                if( tokens.size() < 2 )
                     LogicError("Missing 'NAME' string");
+                meta_.name = tokens[1];
                 section = MPS_NAME;
             }
             else if( token == "OBJSENSE" )
@@ -389,11 +530,10 @@ MPSReader::MPSReader
         // No section marker was found, so handle this data line.
         if( section == MPS_ROWS )
         {
-            std::stringstream rowStream( line );
-            if( !(rowStream >> rowType) )
-                LogicError("Invalid 'ROWS' section");
-            if( !(rowStream >> rowName) )
+            if( tokens.size() < 2 )
                 LogicError("Invalid 'ROWS' section");
+            const string& rowType = tokens[0];
+            const string& rowName = tokens[1];
             MPSRowData rowData;
             // We set the 'typeIndex' fields later since it is not uncommon
             // (e.g., see tuff.mps) for rows to be empty.
@@ -424,9 +564,7 @@ MPSReader::MPSReader
         }
         else if( section == MPS_COLUMNS )
         {
-            std::stringstream columnStream( line );
-            if( !(columnStream >> variableName) )
-                LogicError("Invalid 'COLUMNS' section");
+            const string& variableName = tokens[0];
             auto variableIter = meta_.variableDict.find( variableName );
             if( variableIter == meta_.variableDict.end() )
             {
@@ -441,20 +579,22 @@ MPSReader::MPSReader
             // from this line.
             for( Int pair=0; pair<2; ++pair )
             {
-                if( !(columnStream >> rowName) )
+                const Int rowToken = 1 + 2*pair;
+                if( rowToken >= Int(tokens.size()) )
                 {
                     if( pair == 0 )
                         LogicError("Invalid 'COLUMNS' section");
                     else
                         break;
                 }
-                if( !(columnStream >> value) )
+                if( rowToken+1 >= Int(tokens.size()) ||
+                    !mps::ExtractValue( tokens[rowToken+1], value ) )
                     LogicError("Invalid 'COLUMNS' section");
                 ++variableData.numNonzeros;
 
-                auto rowIter = meta_.rowDict.find( rowName );
+                auto rowIter = meta_.rowDict.find( tokens[rowToken] );
                 if( rowIter == meta_.rowDict.end() )
-                    LogicError("Could not find row ",rowName);
+                    LogicError("Could not find row ",tokens[rowToken]);
                 auto& rowData = rowIter->second;
                 if( rowData.type == MPS_EQUALITY_ROW )
                 {
@@ -487,11 +627,7 @@ MPSReader::MPSReader
         {
             if( !initializedRHSSection_ )
             {
-                std::stringstream rhsTestStream( line );
-                Int numTokens=0;
-                string rhsToken;
-                while( rhsTestStream >> rhsToken )
-                    ++numTokens;
+                const Int numTokens = tokens.size();
                 if( numTokens == 2 || numTokens == 4 )
                 {
                     // There were either one or two pairs with no name.
@@ -507,15 +643,14 @@ MPSReader::MPSReader
                 {
                     LogicError("Invalid 'RHS' section (1)");
                 }
-                
+
                 initializedRHSSection_ = true;
             }
 
-            std::stringstream rhsStream( line );
+            const Int offset = ( rhsHasName_ ? 1 : 0 );
             if( rhsHasName_ )
             {
-                if( !(rhsStream >> rhsNameCandidate) )
-                    LogicError("Invalid 'RHS' section (2)");
+                const string& rhsNameCandidate = tokens[0];
                 if( meta_.numRHS == 0 )
                 {
                     // We should currently have that rhsName == "".
@@ -532,14 +667,16 @@ MPSReader::MPSReader
             // from this line.
             for( Int pair=0; pair<2; ++pair )
             {
-                if( !(rhsStream >> rowName) )
+                const Int rowToken = offset + 2*pair;
+                if( rowToken >= Int(tokens.size()) )
                 {
                     if( pair == 0 )
                         LogicError("Invalid 'RHS' section (3)");
                     else
                         break;
                 }
-                if( !(rhsStream >> value) )
+                if( rowToken+1 >= Int(tokens.size()) ||
+                    !mps::ExtractValue( tokens[rowToken+1], value ) )
                     LogicError("Invalid 'RHS' section (4)");
             }
         }
@@ -547,91 +684,88 @@ MPSReader::MPSReader
         {
             if( !initializedBoundsSection_ )
             {
-                std::stringstream boundsTestStream( line );
-                if( !(boundsTestStream >> boundMark) )
+                if( tokens.size() < 2 )
                     LogicError("Invalid 'BOUNDS' section");
-                if( !(boundsTestStream >> token) )
-                    LogicError("Invalid 'BOUNDS' section");
-
-                Int numTokens=2;
-                string rhsToken;
-                while( boundsTestStream >> rhsToken )
-                    ++numTokens;
-                if( boundMark == "LO" ||
-                    boundMark == "UP" ||
-                    boundMark == "FX" )
+                const string& mark = tokens[0];
+                const Int numTokens = tokens.size();
+                if( mark == "LO" ||
+                    mark == "UP" ||
+                    mark == "FX" )
                 {
                     if( numTokens == 4 )
                         boundsHasName_ = true;
                     else if( numTokens == 3 )
                         boundsHasName_ = false;
                     else
-                        LogicError("Invalid ",boundMark," 'BOUNDS' line");
+                        LogicError("Invalid ",mark," 'BOUNDS' line");
                 }
-                else if( boundMark == "FR" ||
-                         boundMark == "MI" ||
-                         boundMark == "PL" )
+                else if( mark == "FR" ||
+                         mark == "MI" ||
+                         mark == "PL" )
                 {
                     if( numTokens == 3 )
                         boundsHasName_ = true;
                     else if( numTokens == 2 )
                         boundsHasName_ = false;
                     else
-                        LogicError("Invalid ",boundMark," 'BOUNDS' line");
+                        LogicError("Invalid ",mark," 'BOUNDS' line");
                 }
                 else
-                    LogicError("Unknown bound mark ",boundMark);
+                    LogicError("Unknown bound mark ",mark);
 
                 // If there is a name, it occurred in the second position.
                 if( boundsHasName_ )
-                    meta_.boundName = token;
+                    meta_.boundName = tokens[1];
 
                 initializedBoundsSection_ = true;
             }
 
-            std::stringstream boundStream( line );
-            // We already have the first token of a bounding row, which should
-            // be of the same general form as
+            // Each bounding row should be of the same general form as
             //
             //   FX BOUNDROW VARIABLENAME 1734.
             //
             // in the case of 'VARIABLENAME' being fixed ('FX') at the value
             // 1734 (with this problem's bound name being 'BOUNDROW').
-            if( !(boundStream >> boundMark) )
-                LogicError("Invalid 'BOUNDS' section");
+            const string& boundMark = tokens[0];
+            Int tokenOffset = 1;
             if( boundsHasName_ )
             {
-                if( !(boundStream >> boundNameCandidate) )
+                if( Int(tokens.size()) <= tokenOffset )
                     LogicError("Invalid 'BOUNDS' section");
-                if( meta_.boundName != boundNameCandidate )
+                if( meta_.boundName != tokens[1] )
                     LogicError
                     ("Only single problem instances are currently supported "
                      "(multiple bound names were encountered)");
+                tokenOffset = 2;
             }
-            if( !(boundStream >> variableName) )
+            if( Int(tokens.size()) <= tokenOffset )
                 LogicError("Invalid 'BOUNDS' section");
+            const string& variableName = tokens[tokenOffset];
             auto variableIter = meta_.variableDict.find( variableName );
             if( variableIter == meta_.variableDict.end() )
                 LogicError
                 ("Invalid 'BOUNDS' section (name ",variableName," not found)");
             MPSVariableData& data = variableIter->second;
+            const bool haveValue =
+              tokenOffset+1 < Int(tokens.size()) &&
+              mps::ExtractValue( tokens[tokenOffset+1], value );
             if( boundMark == "UP" )
             {
-                if( !(boundStream >> value) )
+                if( !haveValue )
                     LogicError("Invalid 'BOUNDS' section");
                 data.upperBounded = true;
                 data.upperBound = value;
             }
             else if( boundMark == "LO" )
             {
-                if( !(boundStream >> value) )
+                if( !haveValue )
                     LogicError("Invalid 'BOUNDS' section");
                 data.lowerBounded = true;
                 data.lowerBound = value;
             }
             else if( boundMark == "FX" )
             {
-                if( !(boundStream >> value) )
+                if( !haveValue )
                     LogicError("Invalid 'BOUNDS' section");
                 data.fixed = true;
                 data.fixedValue = value;
@@ -857,8 +991,7 @@ MPSReader::MPSReader
     // 'QueuedEntry'/'GetEntry' cycle.
 
     // Reset the file.
-    file_.clear();
-    file_.seekg( 0, std::ios::beg );
+    file_.Reset();
 
     // Extract the number of variables
     // (the matrix 'A' is 'm x n' and 'G' is 'k x n').
@@ -895,21 +1028,21 @@ bool MPSReader::QueuedEntry()
 {
     EL_DEBUG_CSE
 
+    const char* lineBeg;
+    const char* lineEnd;
     while( queuedEntries_.size() == 0 &&
            section_ != MPS_END &&
-           std::getline( file_, line_ ) )
+           file_.NextLine( lineBeg, lineEnd ) )
     {
-        std::stringstream sectionStream( line_ );
-        const char firstChar = sectionStream.peek();
+        const char firstChar = ( lineBeg == lineEnd ? '\0' : *lineBeg );
         const bool isDataLine =
           firstChar == ' ' ||
           firstChar == '\t' ||
           firstChar == '*' ||
           firstChar == '#';
 
-        // The first token on each line should be a string. We will check it for
-        // equivalence with each section string.
-        if( !(sectionStream >> token_) )
+        mps::Tokenize( lineBeg, lineEnd, tokens_ );
+        if( tokens_.size() == 0 )
         {
             // This line only consists of whitespace.
             continue;
@@ -917,42 +1050,43 @@ bool MPSReader::QueuedEntry()
 
         if( !isDataLine )
         {
-            if( token_ == "NAME" )
+            const string& token = tokens_[0];
+            if( token == "NAME" )
             {
                 section_ = MPS_NAME;
             }
-            else if( token_ == "OBJSENSE" )
+            else if( token == "OBJSENSE" )
             {
                 LogicError("OBJSENSE is not yet handled");
             }
-            else if( token_ == "ROWS" )
+            else if( token == "ROWS" )
             {
                 section_ = MPS_ROWS;
             }
-            else if( token_ == "COLUMNS" )
+            else if( token == "COLUMNS" )
             {
                 section_ = MPS_COLUMNS;
             }
-            else if( token_ == "RHS" )
+            else if( token == "RHS" )
             {
                 section_ = MPS_RHS;
             }
-            else if( token_ == "BOUNDS" )
+            else if( token == "BOUNDS" )
             {
                 section_ = MPS_BOUNDS;
             }
-            else if( token_ == "RANGES" )
+            else if( token == "RANGES" )
             {
                 section_ = MPS_RANGES;
             }
-            else if( token_ == "ENDATA" )
+            else if( token == "ENDATA" )
             {
                 section_ = MPS_END;
                 break;
             }
             else
             {
-                LogicError("Section token ",token_," is not recognized");
+                LogicError("Section token ",token," is not recognized");
             }
             continue;
         }
@@ -964,14 +1098,12 @@ bool MPSReader::QueuedEntry()
         }
         else if( section_ == MPS_COLUMNS )
         {
-           double columnValue;
-           std::stringstream columnStream( line_ );
+            double columnValue;
 
-           if( !(columnStream >> variableName_) )
-                LogicError("Invalid 'COLUMNS' section");
-            auto variableIter = meta_.variableDict.find( variableName_ );
+            const string& variableName = tokens_[0];
+            auto variableIter = meta_.variableDict.find( variableName );
             if( variableIter == meta_.variableDict.end() )
-                LogicError("Could not find variable ",variableName_);
+                LogicError("Could not find variable ",variableName);
             const MPSVariableData& variableData = variableIter->second;
             const Int column = variableData.index;
 
@@ -979,18 +1111,20 @@ bool MPSReader::QueuedEntry()
             // from this line.
             for( Int pair=0; pair<2; ++pair )
             {
-                if( !(columnStream >> rowName_) )
+                const Int rowToken = 1 + 2*pair;
+                if( rowToken >= Int(tokens_.size()) )
                 {
                     if( pair == 0 )
                         LogicError("Invalid 'COLUMNS' section");
                     else
                         break;
                 }
-                if( !(columnStream >> columnValue) )
+                if( rowToken+1 >= Int(tokens_.size()) ||
+                    !mps::ExtractValue( tokens_[rowToken+1], columnValue ) )
                     LogicError("Invalid 'COLUMNS' section");
-                auto rowIter = meta_.rowDict.find( rowName_ );
+                auto rowIter = meta_.rowDict.find( tokens_[rowToken] );
                 if( rowIter == meta_.rowDict.end() )
-                    LogicError("Could not find row ",rowName_);
+                    LogicError("Could not find row ",tokens_[rowToken]);
                 const auto& rowData = rowIter->second;
                 AffineLPEntry<double> entry;
                 if( rowData.type == MPS_EQUALITY_ROW )
@@ -1041,30 +1175,27 @@ bool MPSReader::QueuedEntry()
         else if( section_ == MPS_RHS )
         {
             double rhsValue;
-            std::stringstream rhsStream( line_ );
 
-            if( rhsHasName_ )
-            {
-                if( !(rhsStream >> token_) )
-                    LogicError("Invalid 'RHS' section");
-            }
+            const Int tokenOffset = ( rhsHasName_ ? 1 : 0 );
 
             // There should be either one or two pairs of entries left to read
             // from this line.
             for( Int pair=0; pair<2; ++pair )
             {
-                if( !(rhsStream >> rowName_) )
+                const Int rowToken = tokenOffset + 2*pair;
+                if( rowToken >= Int(tokens_.size()) )
                 {
                     if( pair == 0 )
                         LogicError("Invalid 'RHS' section");
                     else
                         break;
                 }
-                if( !(rhsStream >> rhsValue) )
+                if( rowToken+1 >= Int(tokens_.size()) ||
+                    !mps::ExtractValue( tokens_[rowToken+1], rhsValue ) )
                     LogicError("Invalid 'RHS' section");
-                auto rowIter = meta_.rowDict.find( rowName_ );
+                auto rowIter = meta_.rowDict.find( tokens_[rowToken] );
                 if( rowIter == meta_.rowDict.end() )
-                    LogicError("Could not find row ",rowName_);
+                    LogicError("Could not find row ",tokens_[rowToken]);
                 const auto& rowData = rowIter->second;
                 AffineLPEntry<double> entry;
                 if( rowData.type == MPS_EQUALITY_ROW )
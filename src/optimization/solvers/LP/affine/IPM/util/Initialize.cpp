@@ -91,7 +91,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsilon = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsilon)*Max(Nrm2(solution.s),Real(1));
+        const Real gammaDual   = Sqrt(epsilon)*Max(Nrm2(solution.z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -VectorMinLoc( solution.s ).value;
+            if( alphaPrimal >= -gammaPrimal )
+                Shift( solution.s, alphaPrimal+1 );
+            const Real alphaDual = -VectorMinLoc( solution.z ).value;
+            if( alphaDual >= -gammaDual )
+                Shift( solution.z, alphaDual+1 );
+        }
+        else
+        {
+            LowerClip( solution.s, gammaPrimal );
+            LowerClip( solution.z, gammaDual   );
+        }
         return;
     }
 
@@ -218,7 +239,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsilon = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsilon)*Max(Nrm2(solution.s),Real(1));
+        const Real gammaDual   = Sqrt(epsilon)*Max(Nrm2(solution.z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -VectorMinLoc( solution.s ).value;
+            if( alphaPrimal >= -gammaPrimal )
+                Shift( solution.s, alphaPrimal+1 );
+            const Real alphaDual = -VectorMinLoc( solution.z ).value;
+            if( alphaDual >= -gammaDual )
+                Shift( solution.z, alphaDual+1 );
+        }
+        else
+        {
+            LowerClip( solution.s, gammaPrimal );
+            LowerClip( solution.z, gammaDual   );
+        }
         return;
     }
 
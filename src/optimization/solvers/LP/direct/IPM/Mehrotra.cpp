@@ -2054,6 +2054,12 @@ void EquilibratedMehrotra
     ForceSimpleAlignments( error, grid );
 
     DistMultiVec<Real> prod(grid);
+
+    // State for the (optionally delayed) convergence test
+    vector<Real> convStats(4), prevStats(4);
+    mpi::Request<Real> convRequest;
+    bool convPending = false;
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -2079,59 +2085,139 @@ void EquilibratedMehrotra
 
         // Check for convergence
         // =====================
-        // |primal - dual| / (1 + |primal|) <= tol ?
-        // -----------------------------------------
-        const Real primObj = Dot(problem.c,solution.x);
-        const Real dualObj = -Dot(problem.b,solution.y);
-        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
-        // || r_b ||_2 / (1 + || b ||_2) <= tol ?
-        // --------------------------------------
+        // The criteria are
+        //
+        //   |primal - dual| / (1 + |primal|) <= tol,
+        //   || r_b ||_2 / (1 + || b ||_2)   <= tol,
+        //   || r_c ||_2 / (1 + || c ||_2)   <= tol,
+        //
+        // and the reductions behind them may optionally be launched as a
+        // single nonblocking AllReduce which is only consumed in the next
+        // iteration (see ctrl.delayedTermination).
+
+        // r_b := A x - b
+        // --------------
         residual.primalEquality = problem.b;
         Gemv
         ( NORMAL, Real(1), problem.A, solution.x,
           Real(-1), residual.primalEquality );
-        const Real rbNrm2 = FrobeniusNorm( residual.primalEquality );
-        const Real rbConv = rbNrm2 / (1+bNrm2);
-        Axpy( -deltaPerm*deltaPerm, solution.y, residual.primalEquality );
-        // || r_c ||_2 / (1 + || c ||_2) <= tol ?
-        // --------------------------------------
+        // r_c := A^T y - z + c
+        // --------------------
         residual.dualEquality = problem.c;
         Gemv
         ( TRANSPOSE, Real(1), problem.A, solution.y,
           Real(1), residual.dualEquality );
         residual.dualEquality -= solution.z;
-        const Real rcNrm2 = FrobeniusNorm( residual.dualEquality );
-        const Real rcConv = rcNrm2 / (1+cNrm2);
-        Axpy( gammaPerm*gammaPerm, solution.x, residual.dualEquality );
-        // Now check the pieces
-        // --------------------
-        relError = Max(Max(objConv,rbConv),rcConv);
-        if( ctrl.print )
+
+        Real rbNrm2 = Real(0);
+        Real rcNrm2 = Real(0);
+        if( ctrl.delayedTermination )
         {
-            const Real xNrm2 = FrobeniusNorm( solution.x );
-            const Real yNrm2 = FrobeniusNorm( solution.y );
-            const Real zNrm2 = FrobeniusNorm( solution.z );
-            if( commRank == 0 )
-                Output
-                ("iter ",numIts,":\n",Indent(),
-                 "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
-                 "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
-                 "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
-                 "  ||  w  ||_max = ",wMaxNorm,"\n",Indent(),
-                 "  || r_b ||_2 = ",rbNrm2,"\n",Indent(),
-                 "  || r_c ||_2 = ",rcNrm2,"\n",Indent(),
-                 "  || r_b ||_2 / (1 + || b ||_2) = ",rbConv,"\n",Indent(),
-                 "  || r_c ||_2 / (1 + || c ||_2) = ",rcConv,"\n",Indent(),
-                 "  primal = ",primObj,"\n",Indent(),
-                 "  dual   = ",dualObj,"\n",Indent(),
-                 "  |primal - dual| / (1 + |primal|) = ",objConv);
+            // Accumulate the local contributions to the objectives and the
+            // squared residual norms, consume the reduction launched in the
+            // previous iteration, and launch this iterate's reduction so
+            // that its latency overlaps the factorization and solves. The
+            // squared norms forgo the overflow-safe scaling performed by
+            // FrobeniusNorm, which is harmless for a convergence test.
+            convStats[0] =
+              Dot( problem.c.LockedMatrix(), solution.x.LockedMatrix() );
+            convStats[1] =
+              Dot( problem.b.LockedMatrix(), solution.y.LockedMatrix() );
+            convStats[2] =
+              Dot( residual.primalEquality.LockedMatrix(),
+                   residual.primalEquality.LockedMatrix() );
+            convStats[3] =
+              Dot( residual.dualEquality.LockedMatrix(),
+                   residual.dualEquality.LockedMatrix() );
+            if( convPending )
+            {
+                mpi::Wait( convRequest );
+                convPending = false;
+                const Real primObjPrev = prevStats[0];
+                const Real dualObjPrev = -prevStats[1];
+                const Real objConvPrev =
+                  Abs(primObjPrev-dualObjPrev) / (1+Abs(primObjPrev));
+                const Real rbConvPrev = Sqrt(prevStats[2]) / (1+bNrm2);
+                const Real rcConvPrev = Sqrt(prevStats[3]) / (1+cNrm2);
+                relError = Max(Max(objConvPrev,rbConvPrev),rcConvPrev);
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("iter ",numIts-1," (delayed):\n",Indent(),
+                     "  || r_b ||_2 / (1 + || b ||_2) = ",rbConvPrev,"\n",
+                     Indent(),
+                     "  || r_c ||_2 / (1 + || c ||_2) = ",rcConvPrev,"\n",
+                     Indent(),
+                     "  |primal - dual| / (1 + |primal|) = ",objConvPrev);
+                if( relError <= ctrl.targetTol )
+                    break;
+            }
+            if( numIts == ctrl.maxIts && relError > ctrl.minTol )
+                RuntimeError
+                ("Maximum number of iterations (",ctrl.maxIts,") exceeded ",
+                 "without achieving minTol=",ctrl.minTol);
+            prevStats = convStats;
+            mpi::IAllReduce
+            ( prevStats.data(), 4, mpi::SUM, grid.Comm(), convRequest );
+            convPending = true;
+
+            // These diagnostics are blocking and so defeat the purpose of
+            // the delayed test, but they are only debugging output
+            if( ctrl.checkResiduals && ctrl.print )
+            {
+                rbNrm2 = FrobeniusNorm( residual.primalEquality );
+                rcNrm2 = FrobeniusNorm( residual.dualEquality );
+            }
         }
-        if( relError <= ctrl.targetTol )
-            break;
-        if( numIts == ctrl.maxIts && relError > ctrl.minTol )
-            RuntimeError
-            ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
-             "achieving minTol=",ctrl.minTol);
+        else
+        {
+            // |primal - dual| / (1 + |primal|) <= tol ?
+            // -----------------------------------------
+            const Real primObj = Dot(problem.c,solution.x);
+            const Real dualObj = -Dot(problem.b,solution.y);
+            const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+            // || r_b ||_2 / (1 + || b ||_2) <= tol ?
+            // --------------------------------------
+            rbNrm2 = FrobeniusNorm( residual.primalEquality );
+            const Real rbConv = rbNrm2 / (1+bNrm2);
+            // || r_c ||_2 / (1 + || c ||_2) <= tol ?
+            // --------------------------------------
+            rcNrm2 = FrobeniusNorm( residual.dualEquality );
+            const Real rcConv = rcNrm2 / (1+cNrm2);
+            // Now check the pieces
+            // --------------------
+            relError = Max(Max(objConv,rbConv),rcConv);
+            if( ctrl.print )
+            {
+                const Real xNrm2 = FrobeniusNorm( solution.x );
+                const Real yNrm2 = FrobeniusNorm( solution.y );
+                const Real zNrm2 = FrobeniusNorm( solution.z );
+                if( commRank == 0 )
+                    Output
+                    ("iter ",numIts,":\n",Indent(),
+                     "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
+                     "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
+                     "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
+                     "  ||  w  ||_max = ",wMaxNorm,"\n",Indent(),
+                     "  || r_b ||_2 = ",rbNrm2,"\n",Indent(),
+                     "  || r_c ||_2 = ",rcNrm2,"\n",Indent(),
+                     "  || r_b ||_2 / (1 + || b ||_2) = ",rbConv,"\n",Indent(),
+                     "  || r_c ||_2 / (1 + || c ||_2) = ",rcConv,"\n",Indent(),
+                     "  primal = ",primObj,"\n",Indent(),
+                     "  dual   = ",dualObj,"\n",Indent(),
+                     "  |primal - dual| / (1 + |primal|) = ",objConv);
+            }
+            if( relError <= ctrl.targetTol )
+                break;
+            if( numIts == ctrl.maxIts && relError > ctrl.minTol )
+                RuntimeError
+                ("Maximum number of iterations (",ctrl.maxIts,") exceeded ",
+                 "without achieving minTol=",ctrl.minTol);
+        }
+
+        // Add the permanent regularization to the residuals
+        // -------------------------------------------------
+        Axpy( -deltaPerm*deltaPerm, solution.y, residual.primalEquality );
+        Axpy( gammaPerm*gammaPerm, solution.x, residual.dualEquality );
 
         // Compute the affine search direction
         // ===================================
@@ -2535,6 +2621,9 @@ void EquilibratedMehrotra
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
     }
+    // Complete any convergence reduction which is still in flight
+    if( convPending )
+        mpi::Wait( convRequest );
     SetIndent( indent );
 }
 
@@ -94,7 +94,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsilon = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsilon)*Max(Nrm2(solution.x),Real(1));
+        const Real gammaDual   = Sqrt(epsilon)*Max(Nrm2(solution.z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -VectorMinLoc( solution.x ).value;
+            if( alphaPrimal >= -gammaPrimal )
+                Shift( solution.x, alphaPrimal+1 );
+            const Real alphaDual = -VectorMinLoc( solution.z ).value;
+            if( alphaDual >= -gammaDual )
+                Shift( solution.z, alphaDual+1 );
+        }
+        else
+        {
+            LowerClip( solution.x, gammaPrimal );
+            LowerClip( solution.z, gammaDual   );
+        }
         return;
     }
 
@@ -206,7 +227,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsilon = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsilon)*Max(Nrm2(solution.x),Real(1));
+        const Real gammaDual   = Sqrt(epsilon)*Max(Nrm2(solution.z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -VectorMinLoc( solution.x ).value;
+            if( alphaPrimal >= -gammaPrimal )
+                Shift( solution.x, alphaPrimal+1 );
+            const Real alphaDual = -VectorMinLoc( solution.z ).value;
+            if( alphaDual >= -gammaDual )
+                Shift( solution.z, alphaDual+1 );
+        }
+        else
+        {
+            LowerClip( solution.x, gammaPrimal );
+            LowerClip( solution.z, gammaDual   );
+        }
         return;
     }
 
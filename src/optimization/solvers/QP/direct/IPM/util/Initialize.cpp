@@ -97,7 +97,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsilon = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsilon)*Max(Nrm2(x),Real(1));
+        const Real gammaDual   = Sqrt(epsilon)*Max(Nrm2(z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -VectorMinLoc( x ).value;
+            if( alphaPrimal >= -gammaPrimal )
+                Shift( x, alphaPrimal+1 );
+            const Real alphaDual = -VectorMinLoc( z ).value;
+            if( alphaDual >= -gammaDual )
+                Shift( z, alphaDual+1 );
+        }
+        else
+        {
+            LowerClip( x, gammaPrimal );
+            LowerClip( z, gammaDual   );
+        }
         return;
     }
 
@@ -205,7 +226,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsilon = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsilon)*Max(Nrm2(x),Real(1));
+        const Real gammaDual   = Sqrt(epsilon)*Max(Nrm2(z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -VectorMinLoc( x ).value;
+            if( alphaPrimal >= -gammaPrimal )
+                Shift( x, alphaPrimal+1 );
+            const Real alphaDual = -VectorMinLoc( z ).value;
+            if( alphaDual >= -gammaDual )
+                Shift( z, alphaDual+1 );
+        }
+        else
+        {
+            LowerClip( x, gammaPrimal );
+            LowerClip( z, gammaDual   );
+        }
         return;
     }
 
@@ -321,7 +363,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsilon = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsilon)*Max(Nrm2(x),Real(1));
+        const Real gammaDual   = Sqrt(epsilon)*Max(Nrm2(z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -VectorMinLoc( x ).value;
+            if( alphaPrimal >= -gammaPrimal )
+                Shift( x, alphaPrimal+1 );
+            const Real alphaDual = -VectorMinLoc( z ).value;
+            if( alphaDual >= -gammaDual )
+                Shift( z, alphaDual+1 );
+        }
+        else
+        {
+            LowerClip( x, gammaPrimal );
+            LowerClip( z, gammaDual   );
+        }
         return;
     }
 
@@ -462,7 +525,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsilon = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsilon)*Max(Nrm2(x),Real(1));
+        const Real gammaDual   = Sqrt(epsilon)*Max(Nrm2(z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -VectorMinLoc( x ).value;
+            if( alphaPrimal >= -gammaPrimal )
+                Shift( x, alphaPrimal+1 );
+            const Real alphaDual = -VectorMinLoc( z ).value;
+            if( alphaDual >= -gammaDual )
+                Shift( z, alphaDual+1 );
+        }
+        else
+        {
+            LowerClip( x, gammaPrimal );
+            LowerClip( z, gammaDual   );
+        }
         return;
     }
 
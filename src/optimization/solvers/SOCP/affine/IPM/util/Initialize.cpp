@@ -100,7 +100,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsWS = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsWS)*Max(Nrm2(s),Real(1));
+        const Real gammaDual   = Sqrt(epsWS)*Max(Nrm2(z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -soc::MinEig( s, orders, firstInds );
+            if( alphaPrimal >= -gammaPrimal )
+                soc::Shift( s, alphaPrimal+1, orders, firstInds );
+            const Real alphaDual = -soc::MinEig( z, orders, firstInds );
+            if( alphaDual >= -gammaDual )
+                soc::Shift( z, alphaDual+1, orders, firstInds );
+        }
+        else
+        {
+            soc::PushInto( s, orders, firstInds, 1+gammaPrimal );
+            soc::PushInto( z, orders, firstInds, 1+gammaDual );
+        }
         return;
     }
 
@@ -224,7 +245,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsWS = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsWS)*Max(Nrm2(s),Real(1));
+        const Real gammaDual   = Sqrt(epsWS)*Max(Nrm2(z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -soc::MinEig( s, orders, firstInds, cutoff );
+            if( alphaPrimal >= -gammaPrimal )
+                soc::Shift( s, alphaPrimal+1, orders, firstInds );
+            const Real alphaDual = -soc::MinEig( z, orders, firstInds, cutoff );
+            if( alphaDual >= -gammaDual )
+                soc::Shift( z, alphaDual+1, orders, firstInds );
+        }
+        else
+        {
+            soc::PushInto( s, orders, firstInds, 1+gammaPrimal, cutoff );
+            soc::PushInto( z, orders, firstInds, 1+gammaDual, cutoff );
+        }
         return;
     }
 
@@ -356,7 +398,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsWS = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsWS)*Max(Nrm2(s),Real(1));
+        const Real gammaDual   = Sqrt(epsWS)*Max(Nrm2(z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -soc::MinEig( s, orders, firstInds );
+            if( alphaPrimal >= -gammaPrimal )
+                soc::Shift( s, alphaPrimal+1, orders, firstInds );
+            const Real alphaDual = -soc::MinEig( z, orders, firstInds );
+            if( alphaDual >= -gammaDual )
+                soc::Shift( z, alphaDual+1, orders, firstInds );
+        }
+        else
+        {
+            soc::PushInto( s, orders, firstInds, 1+gammaPrimal );
+            soc::PushInto( z, orders, firstInds, 1+gammaDual );
+        }
         return;
     }
 
@@ -511,7 +574,28 @@ void Initialize
     }
     if( primalInit && dualInit )
     {
-        // TODO(poulson): Perform a consistency check
+        // Accept the user-provided pair as a warm start: rather than
+        // computing fresh least-squares initializations, simply apply the
+        // standard safeguard to push the iterates into the interior of the
+        // cone, since warm starts from a nearby solve typically lie
+        // numerically on the boundary
+        const Real epsWS = limits::Epsilon<Real>();
+        const Real gammaPrimal = Sqrt(epsWS)*Max(Nrm2(s),Real(1));
+        const Real gammaDual   = Sqrt(epsWS)*Max(Nrm2(z),Real(1));
+        if( standardShift )
+        {
+            const Real alphaPrimal = -soc::MinEig( s, orders, firstInds, cutoffPar );
+            if( alphaPrimal >= -gammaPrimal )
+                soc::Shift( s, alphaPrimal+1, orders, firstInds );
+            const Real alphaDual = -soc::MinEig( z, orders, firstInds, cutoffPar );
+            if( alphaDual >= -gammaDual )
+                soc::Shift( z, alphaDual+1, orders, firstInds );
+        }
+        else
+        {
+            soc::PushInto( s, orders, firstInds, 1+gammaPrimal, cutoffPar );
+            soc::PushInto( z, orders, firstInds, 1+gammaDual, cutoffPar );
+        }
         return;
     }
 
@@ -0,0 +1,185 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+// The contexts cache the Cholesky factor (and the log-determinant read off
+// of its diagonal) of a Hermitian positive-definite matrix so that the log
+// barrier, log-det divergences, and triangular-solve-based trace terms of
+// the same iterate share one factorization. The divergence reuses the
+// cached factors of both contexts and matches the one-shot LogDetDiv,
+//   tr(inv(B) A) - log det(inv(B) A) - n,
+// with the log-determinant term taken from the cached diagonals.
+
+template<typename Field>
+CholeskyContext<Field>::CholeskyContext
+( UpperOrLower uplo, const Matrix<Field>& A )
+: uplo_(uplo), factor_(A)
+{
+    EL_DEBUG_CSE
+    Cholesky( uplo_, factor_ );
+
+    Matrix<Field> d;
+    GetDiagonal( factor_, d );
+    const Int n = d.Height();
+    logDet_ = 0;
+    for( Int i=0; i<n; ++i )
+        logDet_ += 2*Log( RealPart(d(i)) );
+}
+
+template<typename Field>
+UpperOrLower CholeskyContext<Field>::Uplo() const
+{ return uplo_; }
+
+template<typename Field>
+Int CholeskyContext<Field>::Height() const
+{ return factor_.Height(); }
+
+template<typename Field>
+Base<Field> CholeskyContext<Field>::LogDet() const
+{ return logDet_; }
+
+template<typename Field>
+Base<Field> CholeskyContext<Field>::LogBarrier() const
+{ return -logDet_; }
+
+template<typename Field>
+Base<Field> CholeskyContext<Field>::LogDetDiv
+( const CholeskyContext<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( uplo_ != B.uplo_ )
+          LogicError("Contexts must store the same triangle");
+      if( Height() != B.Height() )
+          LogicError("Contexts must be of the same size");
+    )
+    typedef Base<Field> Real;
+    const Int n = Height();
+
+    Matrix<Field> G( factor_ );
+    if( uplo_ == LOWER )
+    {
+        Trstrm( LEFT, uplo_, NORMAL, NON_UNIT, Field(1), B.factor_, G );
+    }
+    else
+    {
+        MakeTrapezoidal( uplo_, G );
+        Trsm( LEFT, uplo_, NORMAL, NON_UNIT, Field(1), B.factor_, G );
+    }
+    MakeTrapezoidal( uplo_, G );
+    const Real frobNorm = FrobeniusNorm( G );
+
+    return frobNorm*frobNorm - (logDet_-B.logDet_) - Real(n);
+}
+
+template<typename Field>
+void CholeskyContext<Field>::Solve( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    cholesky::SolveAfter( uplo_, NORMAL, factor_, B );
+}
+
+template<typename Field>
+const Matrix<Field>& CholeskyContext<Field>::Factor() const
+{ return factor_; }
+
+template<typename Field>
+DistCholeskyContext<Field>::DistCholeskyContext
+( UpperOrLower uplo, const AbstractDistMatrix<Field>& A )
+: uplo_(uplo), factor_(A)
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = factor_.Grid();
+    Cholesky( uplo_, factor_ );
+
+    DistMatrix<Field,MD,STAR> d(g);
+    GetDiagonal( factor_, d );
+    Real localLogDet(0);
+    if( d.Participating() )
+    {
+        const Int nLocalDiag = d.LocalHeight();
+        for( Int iLoc=0; iLoc<nLocalDiag; ++iLoc )
+            localLogDet += 2*Log( RealPart(d.GetLocal(iLoc,0)) );
+    }
+    logDet_ = mpi::AllReduce( localLogDet, g.VCComm() );
+}
+
+template<typename Field>
+UpperOrLower DistCholeskyContext<Field>::Uplo() const
+{ return uplo_; }
+
+template<typename Field>
+Int DistCholeskyContext<Field>::Height() const
+{ return factor_.Height(); }
+
+template<typename Field>
+Base<Field> DistCholeskyContext<Field>::LogDet() const
+{ return logDet_; }
+
+template<typename Field>
+Base<Field> DistCholeskyContext<Field>::LogBarrier() const
+{ return -logDet_; }
+
+template<typename Field>
+Base<Field> DistCholeskyContext<Field>::LogDetDiv
+( const DistCholeskyContext<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( factor_, B.factor_ );
+      if( uplo_ != B.uplo_ )
+          LogicError("Contexts must store the same triangle");
+      if( Height() != B.Height() )
+          LogicError("Contexts must be of the same size");
+    )
+    typedef Base<Field> Real;
+    const Int n = Height();
+
+    DistMatrix<Field> G( factor_ );
+    if( uplo_ == LOWER )
+    {
+        Trstrm( LEFT, uplo_, NORMAL, NON_UNIT, Field(1), B.factor_, G );
+    }
+    else
+    {
+        MakeTrapezoidal( uplo_, G );
+        Trsm( LEFT, uplo_, NORMAL, NON_UNIT, Field(1), B.factor_, G );
+    }
+    MakeTrapezoidal( uplo_, G );
+    const Real frobNorm = FrobeniusNorm( G );
+
+    return frobNorm*frobNorm - (logDet_-B.logDet_) - Real(n);
+}
+
+template<typename Field>
+void DistCholeskyContext<Field>::Solve( AbstractDistMatrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    cholesky::SolveAfter( uplo_, NORMAL, factor_, B );
+}
+
+template<typename Field>
+const DistMatrix<Field>& DistCholeskyContext<Field>::Factor() const
+{ return factor_; }
+
+#define PROTO(Field) \
+  template class CholeskyContext<Field>; \
+  template class DistCholeskyContext<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -74,10 +74,158 @@ void Covariance
     MakeHermitian( LOWER, S );
 }
 
+// The accumulators maintain the scatter matrix and column sums of the
+// observation history rather than the covariance itself, so that a batch
+// of k observations costs one rank-k Herk plus a Gemv, and so that batches
+// may later be removed to implement sliding windows. Note that, as with
+// any scatter-based formulation, accuracy degrades when the mean is large
+// relative to the deviations; callers with poorly centered data should
+// pre-shift their observations.
+
+template<typename Field>
+CovarianceAccumulator<Field>::CovarianceAccumulator( Int n )
+: n_(n)
+{
+    EL_DEBUG_CSE
+    Zeros( scatter_, n, n );
+    Zeros( sum_, n, 1 );
+}
+
+template<typename Field>
+void CovarianceAccumulator<Field>::Update( const Matrix<Field>& D )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( D.Width() != n_ )
+          LogicError("Observation batch was of the wrong width");
+    )
+    Matrix<Field> ones;
+    Ones( ones, D.Height(), 1 );
+    Herk( LOWER, ADJOINT, Base<Field>(1), D, Base<Field>(1), scatter_ );
+    Gemv( TRANSPOSE, Field(1), D, ones, Field(1), sum_ );
+    numObs_ += D.Height();
+}
+
+template<typename Field>
+void CovarianceAccumulator<Field>::Downdate( const Matrix<Field>& D )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( D.Width() != n_ )
+          LogicError("Observation batch was of the wrong width");
+      if( D.Height() > numObs_ )
+          LogicError("Cannot remove more observations than were added");
+    )
+    Matrix<Field> ones;
+    Ones( ones, D.Height(), 1 );
+    Herk( LOWER, ADJOINT, Base<Field>(-1), D, Base<Field>(1), scatter_ );
+    Gemv( TRANSPOSE, Field(-1), D, ones, Field(1), sum_ );
+    numObs_ -= D.Height();
+}
+
+template<typename Field>
+Int CovarianceAccumulator<Field>::NumObservations() const
+{ return numObs_; }
+
+template<typename Field>
+void CovarianceAccumulator<Field>::Covariance( Matrix<Field>& S ) const
+{
+    EL_DEBUG_CSE
+    if( numObs_ < 2 )
+        LogicError("Covariance requires at least two observations");
+    // As in the one-shot routine above,
+    //   S = (conj(D^H D) - numObs xMean xMean^H) / (numObs-1),
+    // where the cross terms vanish since the deviations sum to zero
+    S = scatter_;
+    Conjugate( S );
+    Matrix<Field> xMean( sum_ );
+    xMean *= Field(1)/Field(numObs_);
+    Her( LOWER, Base<Field>(-numObs_), xMean, S );
+    S *= Field(1)/Field(numObs_-1);
+    MakeHermitian( LOWER, S );
+}
+
+template<typename Field>
+DistCovarianceAccumulator<Field>::DistCovarianceAccumulator
+( const Grid& g, Int n )
+: n_(n), scatter_(g), sum_(g)
+{
+    EL_DEBUG_CSE
+    Zeros( scatter_, n, n );
+    Zeros( sum_, n, 1 );
+}
+
+template<typename Field>
+void DistCovarianceAccumulator<Field>::Update
+( const AbstractDistMatrix<Field>& DPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( DPre, scatter_ );
+      if( DPre.Width() != n_ )
+          LogicError("Observation batch was of the wrong width");
+    )
+    DistMatrixReadProxy<Field,Field,MC,MR> DProx( DPre );
+    auto& D = DProx.GetLocked();
+
+    DistMatrix<Field> ones( D.Grid() );
+    Ones( ones, D.Height(), 1 );
+    Herk( LOWER, ADJOINT, Base<Field>(1), D, Base<Field>(1), scatter_ );
+    Gemv( TRANSPOSE, Field(1), D, ones, Field(1), sum_ );
+    numObs_ += D.Height();
+}
+
+template<typename Field>
+void DistCovarianceAccumulator<Field>::Downdate
+( const AbstractDistMatrix<Field>& DPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( DPre, scatter_ );
+      if( DPre.Width() != n_ )
+          LogicError("Observation batch was of the wrong width");
+      if( DPre.Height() > numObs_ )
+          LogicError("Cannot remove more observations than were added");
+    )
+    DistMatrixReadProxy<Field,Field,MC,MR> DProx( DPre );
+    auto& D = DProx.GetLocked();
+
+    DistMatrix<Field> ones( D.Grid() );
+    Ones( ones, D.Height(), 1 );
+    Herk( LOWER, ADJOINT, Base<Field>(-1), D, Base<Field>(1), scatter_ );
+    Gemv( TRANSPOSE, Field(-1), D, ones, Field(1), sum_ );
+    numObs_ -= D.Height();
+}
+
+template<typename Field>
+Int DistCovarianceAccumulator<Field>::NumObservations() const
+{ return numObs_; }
+
+template<typename Field>
+void DistCovarianceAccumulator<Field>::Covariance
+( AbstractDistMatrix<Field>& SPre ) const
+{
+    EL_DEBUG_CSE
+    if( numObs_ < 2 )
+        LogicError("Covariance requires at least two observations");
+    DistMatrixWriteProxy<Field,Field,MC,MR> SProx( SPre );
+    auto& S = SProx.Get();
+
+    S = scatter_;
+    Conjugate( S );
+    DistMatrix<Field> xMean( sum_ );
+    xMean *= Field(1)/Field(numObs_);
+    Her( LOWER, Base<Field>(-numObs_), xMean, S );
+    S *= Field(1)/Field(numObs_-1);
+    MakeHermitian( LOWER, S );
+}
+
 #define PROTO(Field) \
   template void Covariance( const Matrix<Field>& D, Matrix<Field>& S ); \
   template void Covariance \
-  ( const AbstractDistMatrix<Field>& D, AbstractDistMatrix<Field>& S );
+  ( const AbstractDistMatrix<Field>& D, AbstractDistMatrix<Field>& S ); \
+  template class CovarianceAccumulator<Field>; \
+  template class DistCovarianceAccumulator<Field>;
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
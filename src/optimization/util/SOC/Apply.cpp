@@ -23,16 +23,33 @@ void Apply
   const Matrix<Int>& firstInds )
 {
     EL_DEBUG_CSE
-    soc::Dots( x, y, z, orders, firstInds );
-    auto xRoots = x;
-    auto yRoots = y;
-    cone::Broadcast( xRoots, orders, firstInds );
-    cone::Broadcast( yRoots, orders, firstInds );
-
     const Int height = x.Height();
-    for( Int i=0; i<height; ++i )
-        if( i != firstInds(i) )
-            z(i) += xRoots(i)*y(i) + yRoots(i)*x(i);
+    // Rather than composing soc::Dots with two cone broadcasts, make a
+    // single pass over the (contiguously stored) cones
+    z.Resize( height, 1 );
+    const Real* xBuf = x.LockedBuffer();
+    const Real* yBuf = y.LockedBuffer();
+          Real* zBuf = z.Buffer();
+    const Int* orderBuf = orders.LockedBuffer();
+    for( Int i=0; i<height; )
+    {
+        const Int order = orderBuf[i];
+        EL_DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        const Real x0 = xBuf[i];
+        const Real y0 = yBuf[i];
+        Real dot = x0*y0;
+        EL_SIMD
+        for( Int k=1; k<order; ++k )
+            dot += xBuf[i+k]*yBuf[i+k];
+        zBuf[i] = dot;
+        EL_SIMD
+        for( Int k=1; k<order; ++k )
+            zBuf[i+k] = x0*yBuf[i+k] + y0*xBuf[i+k];
+        i += order;
+    }
 }
 
 template<typename Real,
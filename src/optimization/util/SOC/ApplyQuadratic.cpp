@@ -23,25 +23,40 @@ void ApplyQuadratic
   const Matrix<Int>& firstInds )
 {
     EL_DEBUG_CSE
-
-    // detRy := det(x) R y
-    Matrix<Real> d;
-    soc::Dets( x, d, orders, firstInds );
-    cone::Broadcast( d, orders, firstInds );
-    auto Ry = y;
-    soc::Reflect( Ry, orders, firstInds );
-    Matrix<Real> detRy;
-    Hadamard( d, Ry, detRy );
-
-    // z := 2 (x^T y) x
-    Matrix<Real> xTy;
-    soc::Dots( x, y, xTy, orders, firstInds );
-    cone::Broadcast( xTy, orders, firstInds );
-    Hadamard( xTy, x, z );
-    z *= 2;
-
-    // z := z - detRy
-    z -= detRy;
+    const Int height = x.Height();
+    // Expanding the two components of Q_x y in terms of det(x) and x^T y
+    // allows each (contiguously stored) cone to be handled in one pass
+    // rather than composing soc::Dets, soc::Dots, soc::Reflect, two cone
+    // broadcasts, and two Hadamard products
+    z.Resize( height, 1 );
+    const Real* xBuf = x.LockedBuffer();
+    const Real* yBuf = y.LockedBuffer();
+          Real* zBuf = z.Buffer();
+    const Int* orderBuf = orders.LockedBuffer();
+    for( Int i=0; i<height; )
+    {
+        const Int order = orderBuf[i];
+        EL_DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        const Real x0 = xBuf[i];
+        const Real y0 = yBuf[i];
+        Real det = x0*x0;
+        Real dot = x0*y0;
+        EL_SIMD
+        for( Int k=1; k<order; ++k )
+        {
+            det -= xBuf[i+k]*xBuf[i+k];
+            dot += xBuf[i+k]*yBuf[i+k];
+        }
+        // (R y)_0 = y_0, while (R y)_k = -y_k for k >= 1
+        zBuf[i] = 2*dot*x0 - det*y0;
+        EL_SIMD
+        for( Int k=1; k<order; ++k )
+            zBuf[i+k] = 2*dot*xBuf[i+k] + det*yBuf[i+k];
+        i += order;
+    }
 }
 
 template<typename Real,
@@ -22,17 +22,33 @@ void Inverse
   const Matrix<Int>& firstInds )
 {
     EL_DEBUG_CSE
-
-    Matrix<Real> dInv;
-    soc::Dets( x, dInv, orders, firstInds );
-    cone::Broadcast( dInv, orders, firstInds );
-    auto entryInv = []( const Real& alpha ) { return Real(1)/alpha; };
-    EntrywiseMap( dInv, MakeFunction(entryInv) );
-
-    auto Rx = x;
-    soc::Reflect( Rx, orders, firstInds );
-
-    Hadamard( dInv, Rx, xInv );
+    const Int height = x.Height();
+    // Form (R x) / det(x) in a single pass over the (contiguously stored)
+    // cones rather than composing soc::Dets, a cone broadcast, an
+    // entrywise inversion, soc::Reflect, and a Hadamard product
+    xInv.Resize( height, 1 );
+    const Real* xBuf = x.LockedBuffer();
+          Real* xInvBuf = xInv.Buffer();
+    const Int* orderBuf = orders.LockedBuffer();
+    for( Int i=0; i<height; )
+    {
+        const Int order = orderBuf[i];
+        EL_DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        const Real x0 = xBuf[i];
+        Real det = x0*x0;
+        EL_SIMD
+        for( Int k=1; k<order; ++k )
+            det -= xBuf[i+k]*xBuf[i+k];
+        const Real detInv = Real(1)/det;
+        xInvBuf[i] = x0*detInv;
+        EL_SIMD
+        for( Int k=1; k<order; ++k )
+            xInvBuf[i+k] = -xBuf[i+k]*detInv;
+        i += order;
+    }
 }
 
 template<typename Real,
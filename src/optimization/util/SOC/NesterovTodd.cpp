@@ -166,51 +166,51 @@ void VandenbergheNT
     typedef Promote<Real> PReal;
     const Int n = s.Height();
 
-    // Promote the floating-point precision
-    // ====================================
-    Matrix<PReal> sProm, zProm;
-    Copy( s, sProm );
-    Copy( z, zProm );
-
-    // Normalize with respect to the Jordan determinant
-    // ================================================
-    Matrix<PReal> sDets, zDets;
-    soc::Dets( sProm, sDets, orders, firstInds );
-    soc::Dets( zProm, zDets, orders, firstInds );
-    cone::Broadcast( sDets, orders, firstInds );
-    cone::Broadcast( zDets, orders, firstInds );
-    for( Int i=0; i<n; ++i )
+    // Each cone is stored contiguously, so the determinants, the 'gamma'
+    // coefficient, and the scaled combination of s and R z can all be
+    // formed in a single fused pass per cone (in promoted precision)
+    // rather than composing soc::Dets, soc::Dots, soc::Reflect, two cone
+    // broadcasts, and the subsequent entrywise rescalings
+    w.Resize( n, 1 );
+    const Real* sBuf = s.LockedBuffer();
+    const Real* zBuf = z.LockedBuffer();
+          Real* wBuf = w.Buffer();
+    const Int* orderBuf = orders.LockedBuffer();
+    for( Int i=0; i<n; )
     {
-        sProm(i) /= Sqrt(sDets(i));
-        zProm(i) /= Sqrt(zDets(i));
-    }
-
-    // Compute the 'gamma' coefficients
-    // ================================
-    Matrix<PReal> gammas;
-    soc::Dots( zProm, sProm, gammas, orders, firstInds );
-    cone::Broadcast( gammas, orders, firstInds );
-    for( Int i=0; i<n; ++i )
-        gammas(i) = Sqrt((PReal(1)+gammas(i))/PReal(2));
-
-    // Compute the normalized scaling point
-    // ====================================
-    auto wProm = zProm;
-    soc::Reflect( wProm, orders, firstInds );
-    wProm += sProm;
-    DiagonalSolve( LEFT, NORMAL, gammas, wProm );
-    wProm *= PReal(1)/PReal(2);
-
-    // Rescale the scaling point
-    // =========================
-    for( Int i=0; i<n; ++i )
-    {
-        const PReal sDet = sDets(i);
-        const PReal zDet = zDets(i);
+        const Int order = orderBuf[i];
+        EL_DEBUG_ONLY(
+          if( i != firstInds(i) )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        const PReal s0 = PReal(sBuf[i]);
+        const PReal z0 = PReal(zBuf[i]);
+        PReal sDet = s0*s0;
+        PReal zDet = z0*z0;
+        PReal dot = s0*z0;
+        for( Int k=1; k<order; ++k )
+        {
+            const PReal sk = PReal(sBuf[i+k]);
+            const PReal zk = PReal(zBuf[i+k]);
+            sDet -= sk*sk;
+            zDet -= zk*zk;
+            dot += sk*zk;
+        }
+        const PReal sDetRoot = Sqrt(sDet);
+        const PReal zDetRoot = Sqrt(zDet);
+
+        const PReal gamma =
+          Sqrt((PReal(1)+dot/(sDetRoot*zDetRoot))/PReal(2));
         const PReal scale = Pow(sDet,PReal(0.25))/Pow(zDet,PReal(0.25));
-        wProm(i) *= scale;
+
+        // w := (scale/(2 gamma)) (sbar + R zbar)
+        const PReal sCoeff = scale/(2*gamma*sDetRoot);
+        const PReal zCoeff = scale/(2*gamma*zDetRoot);
+        wBuf[i] = Real(sCoeff*s0 + zCoeff*z0);
+        for( Int k=1; k<order; ++k )
+            wBuf[i+k] = Real(sCoeff*PReal(sBuf[i+k]) - zCoeff*PReal(zBuf[i+k]));
+        i += order;
     }
-    Copy( wProm, w );
 }
 
 template<typename Real,
@@ -0,0 +1,156 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <cstdio>
+using namespace El;
+
+// Round-trip checks of the chunked BINARY_COMPRESSED (.elbz) container:
+// every available codec is exercised through each combination of
+// sequential/parallel writes and sequential/distributed/parallel reads,
+// and the restored entries are required to match the originals exactly.
+
+std::string CodecName( Compression codec )
+{
+    switch( codec )
+    {
+    case COMPRESSION_NONE:        return "no compression";
+    case COMPRESSION_SHUFFLE_RLE: return "shuffle+RLE";
+    case COMPRESSION_LZ4:         return "LZ4";
+    case COMPRESSION_ZSTD:        return "Zstd";
+    default:                      return "unknown codec";
+    }
+}
+
+template<typename T>
+void RequireEqual
+( const Matrix<T>& A, const Matrix<T>& B, const string& label )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(label,": size changed across the round trip");
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A.Get(i,j) != B.Get(i,j) )
+                LogicError
+                (label,": entry (",i,",",j,") changed across the round trip");
+}
+
+template<typename T>
+void RequireEqual
+( const DistMatrix<T>& A, const DistMatrix<T>& B, const string& label )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(label,": size changed across the round trip");
+    // Both matrices use the default alignments, so the locally-owned
+    // entries may be compared directly
+    Int numDiff = 0;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) != B.GetLocal(iLoc,jLoc) )
+                ++numDiff;
+    numDiff = mpi::AllReduce( numDiff, A.Grid().VCComm() );
+    if( numDiff != 0 )
+        LogicError(label,": ",numDiff," entries changed across the round trip");
+}
+
+template<typename T>
+void TestCodec( Compression codec, const Grid& grid, Int m, Int n )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing ",CodecName(codec)," with ",TypeName<T>());
+    PushIndent();
+    SetBinaryCompression( codec );
+    const string base = "BinaryCompressedTest";
+    const string filename = base + ".elbz";
+
+    // Round trip a sequential matrix through the root
+    if( grid.Rank() == 0 )
+    {
+        Matrix<T> A, B;
+        Uniform( A, m, n );
+        Write( A, base, BINARY_COMPRESSED );
+        Read( B, filename );
+        RequireEqual( A, B, "sequential round trip" );
+    }
+    mpi::Barrier( grid.Comm() );
+
+    DistMatrix<T> A(grid);
+    Uniform( A, m, n );
+
+    // A sequential write chunks over contiguous column panels; restore it
+    // with a distributed read and with a parallel MPI-IO read
+    Write( A, base, BINARY_COMPRESSED );
+    mpi::Barrier( grid.Comm() );
+    {
+        DistMatrix<T> B(grid), C(grid);
+        Read( B, filename );
+        RequireEqual( A, B, "distributed read of sequential write" );
+        ParallelRead( C, filename );
+        RequireEqual( A, C, "parallel read of sequential write" );
+    }
+
+    // A parallel write stores each rank's strided local matrix as its own
+    // chunk; restore it through the root and with a parallel read
+    ParallelWrite( A, base, BINARY_COMPRESSED );
+    mpi::Barrier( grid.Comm() );
+    {
+        DistMatrix<T> B(grid), C(grid);
+        Read( B, filename, AUTO, true );
+        RequireEqual( A, B, "sequential read of parallel write" );
+        ParallelRead( C, filename );
+        RequireEqual( A, C, "parallel read of parallel write" );
+    }
+
+    if( grid.Rank() == 0 )
+        std::remove( filename.c_str() );
+    mpi::Barrier( grid.Comm() );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",120);
+        const Int n = Input("--width","width of matrix",75);
+        // A deliberately small chunk target so that even modest matrices
+        // produce several chunks and exercise the chunk-table logic
+        const Int chunkSize =
+          Input("--chunkSize","target uncompressed bytes per chunk",4096);
+        ProcessInput();
+        PrintInputReport();
+        ComplainIfDebug();
+
+        SetCompressionChunkSize( chunkSize );
+        const Grid grid( comm );
+
+        const Compression codecs[] =
+          { COMPRESSION_NONE, COMPRESSION_SHUFFLE_RLE,
+            COMPRESSION_LZ4, COMPRESSION_ZSTD };
+        for( Compression codec : codecs )
+        {
+            if( !HaveCompression(codec) )
+            {
+                OutputFromRoot
+                (grid.Comm(),"Skipping ",CodecName(codec),
+                 " (not available in this build)");
+                continue;
+            }
+            TestCodec<float>( codec, grid, m, n );
+            TestCodec<double>( codec, grid, m, n );
+            TestCodec<Complex<double>>( codec, grid, m, n );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
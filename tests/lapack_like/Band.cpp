@@ -0,0 +1,207 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Fill A with a random band and mirror it into the dense matrix ADense,
+// so that the band kernels can be checked against their dense counterparts
+template<typename Field>
+void MakeBand
+( Int n, Int kl, Int ku,
+  BandMatrix<Field>& A,
+  Matrix<Field>& ADense )
+{
+    A.Resize( n, n, kl, ku );
+    Zeros( ADense, n, n );
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iBeg = Max( j-ku, Int(0) );
+        const Int iEnd = Min( j+kl+1, n );
+        for( Int i=iBeg; i<iEnd; ++i )
+        {
+            const Field alpha = SampleUniform<Field>();
+            A.Set( i, j, alpha );
+            ADense.Set( i, j, alpha );
+        }
+    }
+}
+
+// As above, but Hermitian positive-definite with bandwidth kd on each side
+// (via a diagonal shift which guarantees strict diagonal dominance)
+template<typename Field>
+void MakeHPDBand
+( Int n, Int kd,
+  BandMatrix<Field>& A,
+  Matrix<Field>& ADense )
+{
+    typedef Base<Field> Real;
+    A.Resize( n, n, kd, kd );
+    Zeros( ADense, n, n );
+    for( Int j=0; j<n; ++j )
+    {
+        const Int iEnd = Min( j+kd+1, n );
+        for( Int i=j+1; i<iEnd; ++i )
+        {
+            const Field alpha = SampleUniform<Field>();
+            A.Set( i, j, alpha );
+            A.Set( j, i, Conj(alpha) );
+            ADense.Set( i, j, alpha );
+            ADense.Set( j, i, Conj(alpha) );
+        }
+        const Field delta = SampleUniform<Real>() + Real(2*kd+2);
+        A.Set( j, j, delta );
+        ADense.Set( j, j, delta );
+    }
+}
+
+template<typename Field>
+void TestCorrectness
+( const BandMatrix<Field>& AOrig,
+  const Matrix<Field>& ADense,
+  const Matrix<Field>& B,
+  const Matrix<Field>& X )
+{
+    typedef Base<Field> Real;
+    const Int n = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( ADense );
+    const Real oneNormX = OneNorm( X );
+
+    // Investigate the residual, || B - A X ||_oo, applying the original
+    // band with the gbmv-based Multiply
+    auto R( B );
+    Multiply( NORMAL, Field(-1), AOrig, X, Field(1), R );
+    const Real infError = InfinityNorm( R );
+    const Real relError = infError / (eps*n*Max(oneNormA,oneNormX));
+    Output
+    ("|| B - A X ||_oo / (eps n Max(||A||_1,||X||_1)) = ",relError);
+
+    // Also compare against the dense solve of the same systems
+    auto XDense( B );
+    LinearSolve( ADense, XDense );
+    XDense -= X;
+    const Real infDiff = InfinityNorm( XDense );
+    const Real relDiff = infDiff / (eps*n*oneNormX);
+    Output
+    ("|| XDense - X ||_oo / (eps n ||X||_1) = ",relDiff);
+
+    // TODO: Use a more refined failure condition
+    if( relError > Real(100) || relDiff > Real(1000) )
+        LogicError("Relative error was unacceptably large");
+}
+
+template<typename Field>
+void TestBandLU
+( Int n, Int kl, Int ku, Int numRHS, bool correctness, bool print )
+{
+    Output("Testing band LU with ",TypeName<Field>());
+    PushIndent();
+
+    BandMatrix<Field> A;
+    Matrix<Field> ADense;
+    MakeBand( n, kl, ku, A, ADense );
+    auto AOrig( A );
+    if( print )
+        Print( ADense, "A" );
+
+    Output("Starting band LU factorization...");
+    Timer timer;
+    timer.Start();
+    Matrix<Int> p;
+    LU( A, p );
+    Output(timer.Stop()," seconds");
+    if( print )
+        Print( A.LockedBands(), "bands after factorization" );
+
+    if( correctness )
+    {
+        Matrix<Field> B;
+        Uniform( B, n, numRHS );
+        auto X( B );
+        lu::SolveAfter( NORMAL, A, p, X );
+        TestCorrectness( AOrig, ADense, B, X );
+    }
+    PopIndent();
+}
+
+template<typename Field>
+void TestBandCholesky
+( UpperOrLower uplo, Int n, Int kd, Int numRHS, bool correctness, bool print )
+{
+    Output("Testing band Cholesky with ",TypeName<Field>());
+    PushIndent();
+
+    BandMatrix<Field> A;
+    Matrix<Field> ADense;
+    MakeHPDBand( n, kd, A, ADense );
+    auto AOrig( A );
+    if( print )
+        Print( ADense, "A" );
+
+    Output("Starting band Cholesky factorization...");
+    Timer timer;
+    timer.Start();
+    Cholesky( uplo, A );
+    Output(timer.Stop()," seconds");
+    if( print )
+        Print( A.LockedBands(), "bands after factorization" );
+
+    if( correctness )
+    {
+        Matrix<Field> B;
+        Uniform( B, n, numRHS );
+        auto X( B );
+        cholesky::SolveAfter( uplo, A, X );
+        TestCorrectness( AOrig, ADense, B, X );
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--size","size of matrix",100);
+        const Int kl = Input("--kl","number of subdiagonals",7);
+        const Int ku = Input("--ku","number of superdiagonals",4);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",20);
+        const bool correctness =
+          Input("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+        ComplainIfDebug();
+
+        // The band kernels dispatch directly to sequential LAPACK
+        if( mpi::Rank() == 0 )
+        {
+            TestBandLU<float>( n, kl, ku, numRHS, correctness, print );
+            TestBandLU<Complex<float>>( n, kl, ku, numRHS, correctness, print );
+            TestBandLU<double>( n, kl, ku, numRHS, correctness, print );
+            TestBandLU<Complex<double>>
+            ( n, kl, ku, numRHS, correctness, print );
+
+            const Int kd = Max( kl, ku );
+            TestBandCholesky<float>
+            ( LOWER, n, kd, numRHS, correctness, print );
+            TestBandCholesky<Complex<float>>
+            ( LOWER, n, kd, numRHS, correctness, print );
+            TestBandCholesky<double>
+            ( UPPER, n, kd, numRHS, correctness, print );
+            TestBandCholesky<Complex<double>>
+            ( UPPER, n, kd, numRHS, correctness, print );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -85,6 +85,7 @@ template<typename F>
 void TestSequentialCholesky
 ( UpperOrLower uplo,
   bool pivot,
+  bool tiled,
   Int m,
   bool print,
   bool printDiag,
@@ -106,6 +107,12 @@ void TestSequentialCholesky
     timer.Start();
     if( pivot )
         Cholesky( uplo, A, p );
+    else if( tiled )
+    {
+        CholeskyCtrl ctrl;
+        ctrl.variant = CHOLESKY_TILED;
+        Cholesky( uplo, A, ctrl );
+    }
     else
         Cholesky( uplo, A );
     const double runTime = timer.Stop();
@@ -203,6 +210,7 @@ main( int argc, char* argv[] )
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool pivot = Input("--pivot","use pivoting?",false);
+        const bool tiled = Input("--tiled","use tiled sequential algorithm?",false);
         const bool correctness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -235,38 +243,38 @@ main( int argc, char* argv[] )
         if( sequential && mpi::Rank(comm) == 0 )
         {
             TestSequentialCholesky<float>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<float>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<double>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<double>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
 
 #ifdef EL_HAVE_QD
             TestSequentialCholesky<DoubleDouble>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<QuadDouble>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
 
             TestSequentialCholesky<Complex<DoubleDouble>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<QuadDouble>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestSequentialCholesky<Quad>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<Quad>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestSequentialCholesky<BigFloat>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<BigFloat>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
 #endif
         }
 
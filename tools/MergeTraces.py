@@ -0,0 +1,84 @@
+#!/usr/bin/env python
+#
+#  Copyright (c) 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+# Merge the per-rank binary trace dumps written at El::Finalize (see
+# include/El/core/Trace.hpp) into a single Chrome-trace JSON file, which can
+# be viewed with chrome://tracing or https://ui.perfetto.dev. Each rank
+# becomes a process row and each event carries its payload size and
+# communicator size as arguments.
+#
+# Usage: MergeTraces.py [-o trace.json] [El-Trace-Proc*.bin ...]
+#
+import glob
+import json
+import struct
+import sys
+
+CATEGORIES = { 0: 'MPI', 1: 'BLAS' }
+HEADER_FORMAT = '<8siiiqq'
+EVENT_FORMAT = '<ddqii16s'
+
+def ParseTrace(filename):
+    events = []
+    with open(filename,'rb') as f:
+        headerSize = struct.calcsize(HEADER_FORMAT)
+        magic, version, rank, eventSize, numStored, numRecorded = \
+          struct.unpack(HEADER_FORMAT,f.read(headerSize))
+        if magic != b'ELTRACE\0':
+            raise ValueError('%s is not an Elemental trace dump' % filename)
+        if eventSize != struct.calcsize(EVENT_FORMAT):
+            raise ValueError('%s has an unsupported record size' % filename)
+        if numRecorded > numStored:
+            sys.stderr.write(
+              '%s: %d of %d events were overwritten by ring-buffer wrap\n' \
+              % (filename,numRecorded-numStored,numRecorded))
+        for e in range(numStored):
+            start, stop, byteCount, commSize, category, name = \
+              struct.unpack(EVENT_FORMAT,f.read(eventSize))
+            events.append(
+              { 'name': name.split(b'\0')[0].decode(),
+                'cat': CATEGORIES.get(category,str(category)),
+                'ph': 'X',
+                'pid': rank,
+                'tid': 0,
+                'ts': start*1.e6,
+                'dur': (stop-start)*1.e6,
+                'args': { 'bytes': byteCount, 'commSize': commSize } })
+    return events
+
+def main(args):
+    output = 'trace.json'
+    filenames = []
+    skipNext = False
+    for i, arg in enumerate(args):
+        if skipNext:
+            skipNext = False
+        elif arg == '-o':
+            output = args[i+1]
+            skipNext = True
+        else:
+            filenames.append(arg)
+    if not filenames:
+        filenames = sorted(glob.glob('El-Trace-Proc*.bin'))
+    if not filenames:
+        sys.stderr.write('No trace dumps found\n')
+        return 1
+
+    traceEvents = []
+    for filename in filenames:
+        traceEvents += ParseTrace(filename)
+    with open(output,'w') as f:
+        json.dump(
+          { 'traceEvents': traceEvents, 'displayTimeUnit': 'ms' }, f )
+    print('Merged %d events from %d ranks into %s' \
+          % (len(traceEvents),len(filenames),output))
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))